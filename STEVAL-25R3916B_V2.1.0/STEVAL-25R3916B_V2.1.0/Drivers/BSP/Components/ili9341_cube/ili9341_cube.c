@@ -86,6 +86,7 @@ LCD_DrvTypeDef   ili9341_drv =
   ili9341_GetLcdPixelHeight,
   0,
   0,
+  ili9341_ReadRegion,
 };
 
 /**
@@ -413,6 +414,105 @@ uint16_t ili9341_ReadPixel( uint16_t Xpos, uint16_t Ypos )
   return read_pix;
 }
 
+/**
+  * @brief  Convert RAMRD pixels (3 bytes R, G, B) to RGB565, little endian.
+  * @param  pSrc Word aligned raw pixel data.
+  * @param  pDst RGB565 output buffer.
+  * @param  Count Number of pixels to convert.
+  * @return None
+  */
+static void ili9341_Rgb666ToRgb565( const uint32_t *pSrc, uint8_t *pDst, uint32_t Count )
+{
+  const uint8_t *raw;
+  uint32_t w0, w1, w2;
+  uint16_t pix;
+
+  /* 4 pixels fit in 3 words: R0 G0 B0 R1 | G1 B1 R2 G2 | B2 R3 G3 B3 */
+  while( Count >= 4U )
+  {
+    w0 = pSrc[0];
+    w1 = pSrc[1];
+    w2 = pSrc[2];
+
+    pix = (uint16_t)(((w0 & 0xF8U) << 8) | ((w0 >> 5) & 0x7E0U) | ((w0 >> 19) & 0x1FU));
+    pDst[0] = (uint8_t)pix;
+    pDst[1] = (uint8_t)(pix >> 8);
+    pix = (uint16_t)(((w0 >> 16) & 0xF800U) | ((w1 & 0xFCU) << 3) | ((w1 >> 11) & 0x1FU));
+    pDst[2] = (uint8_t)pix;
+    pDst[3] = (uint8_t)(pix >> 8);
+    pix = (uint16_t)(((w1 >> 8) & 0xF800U) | ((w1 >> 21) & 0x7E0U) | ((w2 >> 3) & 0x1FU));
+    pDst[4] = (uint8_t)pix;
+    pDst[5] = (uint8_t)(pix >> 8);
+    pix = (uint16_t)((w2 & 0xF800U) | ((w2 >> 13) & 0x7E0U) | (w2 >> 27));
+    pDst[6] = (uint8_t)pix;
+    pDst[7] = (uint8_t)(pix >> 8);
+
+    pSrc  += 3;
+    pDst  += 8;
+    Count -= 4U;
+  }
+
+  raw = (const uint8_t *)pSrc;
+  while( Count > 0U )
+  {
+    pix = (uint16_t)(((raw[0] & 0xF8U) << 8) | ((raw[1] & 0xFCU) << 3) | (raw[2] >> 3));
+    pDst[0] = (uint8_t)pix;
+    pDst[1] = (uint8_t)(pix >> 8);
+    raw  += 3;
+    pDst += 2;
+    Count--;
+  }
+}
+
+/**
+  * @brief  Read a rectangle of pixels from RAM.
+  *         Rows are fetched with a single RAMRD burst each (several rows per burst
+  *         for narrow regions), instead of one window setup and read per pixel.
+  * @param  Xpos X position of the region.
+  * @param  Ypos Y position of the region.
+  * @param  Width Region width.
+  * @param  Height Region height.
+  * @param  pData RGB565 pixels, little endian, row after row (Width * Height * 2 bytes).
+  * @return None
+  */
+void ili9341_ReadRegion( uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint8_t *pData )
+{
+  /* 1 dummy byte + 3 bytes per pixel. The dummy byte is stored at offset 3 so that
+     pixel data starts word aligned at raw[1] */
+  uint32_t raw[1 + ((3U * ILI9341_LCD_PIXEL_WIDTH) / 4U)];
+  uint32_t pixels;
+  uint16_t rows;
+
+  if( (Width == 0U) || (Height == 0U) ||
+      ((Xpos + Width) > ILI9341_LCD_PIXEL_WIDTH) || ((Ypos + Height) > ILI9341_LCD_PIXEL_HEIGHT) )
+  {
+    return;
+  }
+
+  /* As many full rows as the burst buffer can hold */
+  rows = ILI9341_LCD_PIXEL_WIDTH / Width;
+
+  while( Height > 0U )
+  {
+    if( rows > Height )
+    {
+      rows = Height;
+    }
+    pixels = (uint32_t)rows * Width;
+
+    /* Window end is inclusive: the GRAM pointer wraps to the next row at Xpos */
+    ili9341_SetDisplayWindow( Xpos, Ypos, Width - 1U, rows - 1U );
+    LCD_IO_ReadBuffer( LCD_RAMRD, ((uint8_t *)raw) + 3, 1U + (3U * pixels) );
+    ili9341_readmem_mode = 1;
+
+    ili9341_Rgb666ToRgb565( &raw[1], pData, pixels );
+
+    pData  += 2U * pixels;
+    Ypos   += rows;
+    Height -= rows;
+  }
+}
+
 
 /**
   * @brief  Draw horizontal line.
@@ -424,19 +524,11 @@ uint16_t ili9341_ReadPixel( uint16_t Xpos, uint16_t Ypos )
   */
 void ili9341_DrawHLine( uint16_t RGB_Code, uint16_t Xpos, uint16_t Ypos, uint16_t Length )
 {
-  uint16_t i = 0;
-  uint16_t buffer[ILI9341_LCD_PIXEL_WIDTH];
-
   /* Set Cursor */
   ili9341_SetDisplayWindow( Xpos, Ypos, Length, 1 );
 
-
-  for( i = 0; i < Length; i++ )
-  {
-    /* Write 16-bit GRAM Reg */
-    buffer[i] = RGB_Code;
-  }
-  LCD_IO_WriteBuffer16(buffer,Length);
+  /* Write 16-bit GRAM Reg */
+  LCD_IO_WriteRepeat16( RGB_Code, Length );
 }
 
 /**
@@ -449,18 +541,11 @@ void ili9341_DrawHLine( uint16_t RGB_Code, uint16_t Xpos, uint16_t Ypos, uint16_
   */
 void ili9341_DrawVLine( uint16_t RGB_Code, uint16_t Xpos, uint16_t Ypos, uint16_t Length )
 {
-  uint16_t i = 0;
-  uint16_t buffer[ILI9341_LCD_PIXEL_HEIGHT];
-
   /* Set Cursor */
   ili9341_SetDisplayWindow( Xpos, Ypos, 0, Length );
 
-  for( i = 0; i < Length; i++ )
-  {
-    /* Write 16-bit GRAM Reg */
-    buffer[i] = RGB_Code;
-  }
-  LCD_IO_WriteBuffer16(buffer,Length);
+  /* Write 16-bit GRAM Reg */
+  LCD_IO_WriteRepeat16( RGB_Code, Length );
 }
 
 /**
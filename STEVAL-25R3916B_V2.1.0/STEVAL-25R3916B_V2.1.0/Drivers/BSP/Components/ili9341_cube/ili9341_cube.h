@@ -208,6 +208,7 @@ void     ili9341_SetCursor( uint16_t Xpos, uint16_t Ypos );
 void     ili9341_SetDisplayWindow( uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height );
 void     ili9341_WritePixel( uint16_t Xpos, uint16_t Ypos, uint16_t Val );
 uint16_t ili9341_ReadPixel( uint16_t Xpos, uint16_t Ypos );
+void     ili9341_ReadRegion( uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint8_t *pData );
 void     ili9341_DrawHLine( uint16_t RGB_Code, uint16_t Xpos, uint16_t Ypos, uint16_t Length );
 void     ili9341_DrawVLine( uint16_t RGB_Code, uint16_t Xpos, uint16_t Ypos, uint16_t Length );
 uint16_t ili9341_GetLcdPixelWidth( void );
@@ -222,8 +223,13 @@ void     LCD_IO_WriteData( uint8_t RegValue );
 void     LCD_IO_WriteData16( uint16_t RegValue );
 void     LCD_IO_WriteReg( uint8_t Reg );
 uint32_t LCD_IO_ReadData( uint16_t RegValue, uint8_t ReadSize );
+void     LCD_IO_ReadBuffer( uint16_t RegValue, uint8_t *buffer, uint32_t length );
 void     LCD_Delay ( uint32_t delay );
 void     LCD_IO_WriteBuffer16( uint16_t* buffer, uint32_t length );
+void     LCD_IO_WriteConstBuffer16( const uint16_t* buffer, uint32_t length );
+void     LCD_IO_WriteRepeat16( uint16_t Value, uint32_t Count );
+void     LCD_IO_Notify( void (*Callback)( void ) );
+void     LCD_IO_WaitIdle( void );
 
 #ifdef __cplusplus
 }
@@ -798,8 +798,9 @@ void stmpe811_TS_Start(uint16_t DeviceAddr)
   */
   IOE_Write(DeviceAddr, STMPE811_REG_TSC_CFG, 0x9A); 
   
-  /* Configure the Touch FIFO threshold: single point reading */
-  IOE_Write(DeviceAddr, STMPE811_REG_FIFO_TH, 0x01);
+  /* Configure the Touch FIFO threshold: in interrupt mode the samples are
+     drained by batches of STMPE811_TS_FIFO_TH, polling is not affected */
+  IOE_Write(DeviceAddr, STMPE811_REG_FIFO_TH, STMPE811_TS_FIFO_TH);
   
   /* Clear the FIFO memory content. */
   IOE_Write(DeviceAddr, STMPE811_REG_FIFO_STA, 0x01);
@@ -884,6 +885,63 @@ void stmpe811_TS_GetXY(uint16_t DeviceAddr, uint16_t *X, uint16_t *Y)
   IOE_Write(DeviceAddr, STMPE811_REG_FIFO_STA, 0x00);
 }
 
+/**
+  * @brief  Return the touch status reported by the touch screen controller,
+  *         without any side effect on the FIFO.
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @retval 1 if the panel is touched, 0 otherwise.
+  */
+uint8_t stmpe811_TS_IsTouched(uint16_t DeviceAddr)
+{
+  return ((IOE_Read(DeviceAddr, STMPE811_REG_TSC_CTRL) & (uint8_t)STMPE811_TS_CTRL_STATUS) != 0);
+}
+
+/**
+  * @brief  Drain the touch screen FIFO: all the available samples (up to Size)
+  *         are read in a single I2C burst from the non auto-increment data register.
+  * @param  DeviceAddr: Device address on communication Bus.
+  * @param  X: Pointer to X samples buffer
+  * @param  Y: Pointer to Y samples buffer
+  * @param  Size: Size of the samples buffers (up to STMPE811_TS_FIFO_BURST)
+  * @retval Number of samples read.
+  */
+uint8_t stmpe811_TS_ReadFIFO(uint16_t DeviceAddr, uint16_t *X, uint16_t *Y, uint8_t Size)
+{
+  uint8_t  dataXYZ[STMPE811_TS_FIFO_BURST * STMPE811_TS_SAMPLE_SIZE];
+  uint8_t  count;
+  uint8_t  idx;
+  uint8_t *sample;
+  
+  if(Size > STMPE811_TS_FIFO_BURST)
+  {
+    Size = STMPE811_TS_FIFO_BURST;
+  }
+  
+  count = IOE_Read(DeviceAddr, STMPE811_REG_FIFO_SIZE);
+  if(count > Size)
+  {
+    count = Size;
+  }
+  
+  if(count > 0)
+  {
+    if(IOE_ReadMultiple(DeviceAddr, STMPE811_REG_TSC_DATA_NON_INC, dataXYZ, count * STMPE811_TS_SAMPLE_SIZE) != 0)
+    {
+      return 0;
+    }
+    
+    /* Each sample is 12-bit X, 12-bit Y and 8-bit Z */
+    for(idx = 0; idx < count; idx++)
+    {
+      sample = &dataXYZ[idx * STMPE811_TS_SAMPLE_SIZE];
+      X[idx] = ((uint16_t)sample[0] << 4) | (sample[1] >> 4);
+      Y[idx] = ((uint16_t)(sample[1] & 0x0F) << 8) | sample[2];
+    }
+  }
+  
+  return count;
+}
+
 /**
   * @brief  Configure the selected source to generate a global interrupt or not
   * @param  DeviceAddr: Device address on communication Bus.  
@@ -893,8 +951,12 @@ void stmpe811_TS_EnableIT(uint16_t DeviceAddr)
 {
   IOE_ITConfig();
   
-  /* Enable global TS IT source */
-  stmpe811_EnableITSource(DeviceAddr, STMPE811_TS_IT); 
+  /* Only store the samples moving out of the tracking window: a steady touch
+     does not fill the FIFO, hence does not raise FIFO threshold interrupts */
+  IOE_Write(DeviceAddr, STMPE811_REG_TSC_CTRL, STMPE811_TS_CTRL_ENABLE | STMPE811_TS_CTRL_TRACK_32);
+  
+  /* Enable touch, FIFO threshold and FIFO overflow IT sources */
+  stmpe811_EnableITSource(DeviceAddr, STMPE811_TS_IT_EVENTS); 
   
   /* Enable global interrupt */
   stmpe811_EnableGlobalIT(DeviceAddr);
@@ -912,6 +974,9 @@ void stmpe811_TS_DisableIT(uint16_t DeviceAddr)
   
   /* Disable global TS IT source */
   stmpe811_DisableITSource(DeviceAddr, STMPE811_TS_IT); 
+  
+  /* Back to continuous sampling for the polling mode */
+  IOE_Write(DeviceAddr, STMPE811_REG_TSC_CTRL, STMPE811_TS_CTRL_ENABLE);
 }
 
 /**
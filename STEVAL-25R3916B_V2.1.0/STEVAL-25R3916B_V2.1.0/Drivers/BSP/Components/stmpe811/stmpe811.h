@@ -99,6 +99,13 @@
 #define STMPE811_GIT_TOUCH              0x01  /* Touch is detected interrupt    */      
 #define STMPE811_ALL_GIT                0x1F  /* All global interrupts          */
 #define STMPE811_TS_IT                  (STMPE811_GIT_TOUCH | STMPE811_GIT_FTH |  STMPE811_GIT_FOV | STMPE811_GIT_FF | STMPE811_GIT_FE) /* Touch screen interrupts */
+/* Touch screen interrupts used in interrupt mode (FIFO empty would fire after each drain) */
+#define STMPE811_TS_IT_EVENTS           (STMPE811_GIT_TOUCH | STMPE811_GIT_FTH | STMPE811_GIT_FOV)
+
+/* Touch screen FIFO */
+#define STMPE811_TS_FIFO_TH             4     /* Samples raising the FIFO threshold interrupt */
+#define STMPE811_TS_FIFO_BURST          32    /* Maximum samples drained per I2C burst        */
+#define STMPE811_TS_SAMPLE_SIZE         4     /* XYZ sample size in TSC_DATA                  */
     
 /* General Control Registers */ 
 #define STMPE811_REG_SYS_CTRL1          0x03
@@ -194,6 +201,7 @@
 /* TS registers masks */
 #define STMPE811_TS_CTRL_ENABLE         0x01  
 #define STMPE811_TS_CTRL_STATUS         0x80
+#define STMPE811_TS_CTRL_TRACK_32       0x40  /* Window tracking index: 32 ADC steps */
 /**
   * @}
   */ 
@@ -249,6 +257,8 @@ void     stmpe811_IO_ClearIT(uint16_t DeviceAddr, uint32_t IO_Pin);
 void     stmpe811_TS_Start(uint16_t DeviceAddr);
 uint8_t  stmpe811_TS_DetectTouch(uint16_t DeviceAddr);
 void     stmpe811_TS_GetXY(uint16_t DeviceAddr, uint16_t *X, uint16_t *Y);
+uint8_t  stmpe811_TS_IsTouched(uint16_t DeviceAddr);
+uint8_t  stmpe811_TS_ReadFIFO(uint16_t DeviceAddr, uint16_t *X, uint16_t *Y, uint8_t Size);
 void     stmpe811_TS_EnableIT(uint16_t DeviceAddr);
 void     stmpe811_TS_DisableIT(uint16_t DeviceAddr);
 uint8_t  stmpe811_TS_ITStatus (uint16_t DeviceAddr);
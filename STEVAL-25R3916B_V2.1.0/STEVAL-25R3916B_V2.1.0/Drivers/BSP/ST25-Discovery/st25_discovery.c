@@ -22,6 +22,7 @@
   
 /* Includes ------------------------------------------------------------------*/
 #include "st25_discovery.h"
+#include <string.h>
 #if defined(USE_NFCTAG)
 #include "st25_discovery_nfctag.h"
 #endif
@@ -111,6 +112,43 @@ uint32_t I2cxTimeout = ST25_DISCOVERY_I2Cx_TIMEOUT; /*<! Value of Timeout when I
                                                      
 #if defined(HAL_SPI_MODULE_ENABLED) && defined(USE_LCD)
 static uint8_t Is_LCD_IO_Initialized = 0;
+
+#if ST25_DISCOVERY_LCD_DMA
+/**
+ * @brief LCD transfer queue operations
+ */
+typedef enum
+{
+  LCD_IO_OP_REG = 0,   /* Command byte, WRX low          */
+  LCD_IO_OP_DATA8,     /* 8-bit parameter                */
+  LCD_IO_OP_DATA16,    /* 16-bit data word               */
+  LCD_IO_OP_BURST,     /* Pixel burst (DMA)              */
+  LCD_IO_OP_FILL,      /* Repeated colour (DMA)          */
+  LCD_IO_OP_NOTIFY     /* Completion callback            */
+} LCD_IO_OpTypeDef;
+
+typedef struct
+{
+  uint8_t   Op;                 /* LCD_IO_OpTypeDef                              */
+  uint8_t   Staging;            /* Staging buffer released at the end, or 0xFF   */
+  uint16_t  Value;              /* Register, data word or fill colour (DMA source) */
+  uint16_t *pData;              /* Burst source                                  */
+  uint32_t  Length;             /* Remaining pixels of a burst or fill           */
+  void    (*Callback)( void );  /* Notify callback                               */
+} LCD_IO_QueueItemTypeDef;
+
+#define LCD_IO_NO_STAGING     0xFFU
+
+static DMA_HandleTypeDef        hdma_spi2_tx;
+static LCD_IO_QueueItemTypeDef  LcdQueue[ST25_DISCOVERY_LCD_QUEUE_SIZE];
+static volatile uint32_t        LcdQueueHead = 0;   /* Next operation to execute, advanced by the engine */
+static volatile uint32_t        LcdQueueTail = 0;   /* Next free slot, advanced by the producer */
+static volatile uint8_t         LcdQueueBusy = 0;   /* Engine running or DMA transfer in flight */
+static uint16_t                 LcdQueueChunk = 0;  /* Size of the DMA transfer in flight */
+static uint16_t                 LcdStaging[2][ST25_DISCOVERY_LCD_STAGING_SIZE];
+static volatile uint8_t         LcdStagingBusy[2] = {0, 0};
+static uint8_t                  LcdStagingNext = 0;
+#endif /* ST25_DISCOVERY_LCD_DMA */
 #endif /* HAL_SPI_MODULE_ENABLED && USE_LCD */
                                                      
 #if defined(HAL_ADC_MODULE_ENABLED) && defined(USE_ST25DV)
@@ -140,6 +178,37 @@ static OPAMP_HandleTypeDef hOpamp1;
 static I2C_HandleTypeDef hi2c1;
 #if defined(USE_NFCTAG)
 static I2C_HandleTypeDef hi2c2;
+
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+/**
+ * @brief NFCTAG transfer engine states
+ */
+typedef enum
+{
+  NFCTAG_IO_IDLE = 0,     /* No transfer                               */
+  NFCTAG_IO_XFER,         /* Chunk read (interrupts) or written (DMA)  */
+  NFCTAG_IO_WRITE_CYCLE,  /* EEPROM programming, waiting for the timer */
+  NFCTAG_IO_POLL          /* Ready poll, device address only           */
+} NFCTAG_IO_StateTypeDef;
+
+typedef struct
+{
+  uint8_t               Write;       /* Write transfer                                  */
+  uint8_t               WriteCycle;  /* Each chunk is followed by an EEPROM write cycle */
+  uint16_t              DevAddr;     /* Target device address                           */
+  uint16_t              TarAddr;     /* Memory address of the next chunk                */
+  uint8_t              *pData;       /* Data of the next chunk                          */
+  uint32_t              Remaining;   /* Bytes not transferred yet                       */
+  uint16_t              Chunk;       /* Size of the chunk in flight                     */
+  uint32_t              PollStart;   /* Tick at the end of the last chunk written       */
+  NFCMEM_IO_Callback_t  Callback;    /* End of transfer callback                        */
+} NFCTAG_IO_TransferTypeDef;
+
+static DMA_HandleTypeDef          hdma_i2c2_tx;
+static NFCTAG_IO_TransferTypeDef  NfctagXfer;
+static volatile uint8_t           NfctagState = NFCTAG_IO_IDLE;   /* NFCTAG_IO_StateTypeDef */
+static volatile int32_t           NfctagStatus = NFCTAG_OK;       /* Status of the last transfer */
+#endif /* ST25_DISCOVERY_NFCTAG_ASYNC */
 #endif
 static I2C_HandleTypeDef hi2c3;
 
@@ -165,6 +234,22 @@ static uint8_t              STM32_I2C2_IsNacked( void );
 static HAL_StatusTypeDef    STM32_I2C2_IsDeviceReady( const uint8_t DevAddr, const uint32_t Trials );
 static void                 STM32_I2C2_MspInit( void );
 static void                 STM32_I2C2_MspDeInit( void );
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+static void                 STM32_I2C2_AsyncInit( void );
+static void                 STM32_I2C2_AsyncDeInit( void );
+static int32_t              NFCTAG_IO_StartTransfer( uint8_t Write, uint16_t DevAddr, uint16_t TarAddr, uint8_t *pData,
+                                                     uint32_t Size, NFCMEM_IO_Callback_t Callback );
+static HAL_StatusTypeDef    NFCTAG_IO_NextChunk( void );
+static void                 NFCTAG_IO_ChunkDone( void );
+static void                 NFCTAG_IO_Continue( void );
+static void                 NFCTAG_IO_WriteCycle( uint32_t Delay );
+static void                 NFCTAG_IO_End( int32_t Status );
+static void                 NFCTAG_IO_Abort( void );
+static void                 NFCTAG_IO_MemTxCpltCallback( I2C_HandleTypeDef *hi2c );
+static void                 NFCTAG_IO_MemRxCpltCallback( I2C_HandleTypeDef *hi2c );
+static void                 NFCTAG_IO_MasterTxCpltCallback( I2C_HandleTypeDef *hi2c );
+static void                 NFCTAG_IO_ErrorCallback( I2C_HandleTypeDef *hi2c );
+#endif /* ST25_DISCOVERY_NFCTAG_ASYNC */
 #endif /* USE_NFCTAG */
 
 static void                 STM32_I2C3_Init( void );
@@ -191,9 +276,25 @@ static void                 STM32_OPAMP1_MspDeInit( OPAMP_HandleTypeDef *hOpamp
 #if defined(HAL_SPI_MODULE_ENABLED) && defined(USE_LCD)
 static void                 STM32_SPI2_Init( void );
 static uint32_t             STM32_SPI2_Read( uint8_t ReadSize, uint8_t *buffer );
+static void                 STM32_SPI2_ReadBuffer( uint8_t *buffer, uint32_t length );
 static void                 STM32_SPI2_Write( uint16_t Value );
 static void                 STM32_SPI2_Error( void );
 static void                 STM32_SPI2_MspInit( SPI_HandleTypeDef *hspi );
+static void                 LCD_IO_SetWidth( uint32_t w16 );
+static void                 LCD_IO_SendReg( uint8_t Reg );
+static void                 LCD_IO_SendData( uint32_t w16, uint16_t Value );
+#if ST25_DISCOVERY_LCD_DMA
+static void                 STM32_SPI2_DmaInit( void );
+static void                 LCD_IO_Queue( uint8_t Op, uint16_t Value );
+static LCD_IO_QueueItemTypeDef *LCD_IO_QueueSlot( void );
+static void                 LCD_IO_QueueCommit( void );
+static void                 LCD_IO_QueueRun( void );
+static void                 LCD_IO_QueueDmaDone( uint8_t Abort );
+static void                 LCD_IO_WaitEngine( uint32_t *tickstart );
+static HAL_StatusTypeDef    LCD_IO_StartChunk( LCD_IO_QueueItemTypeDef *item );
+static void                 LCD_IO_SendBurst( LCD_IO_QueueItemTypeDef *item );
+static void                 LCD_IO_EndBurst( LCD_IO_QueueItemTypeDef *item );
+#endif /* ST25_DISCOVERY_LCD_DMA */
 #endif /* HAL_SPI_MODULE_ENABLED && USE_LCD */
 
 #if defined(HAL_SPI_MODULE_ENABLED) && defined(USE_LCD)
@@ -203,7 +304,13 @@ void                        LCD_IO_WriteData( uint8_t Data );
 void                        LCD_IO_WriteData16( uint16_t RegValue );
 void                        LCD_IO_WriteMultipleData( uint8_t *pData, uint32_t Size );
 uint32_t                    LCD_IO_ReadData( uint16_t RegValue, uint8_t ReadSize );
+void                        LCD_IO_ReadBuffer( uint16_t RegValue, uint8_t *buffer, uint32_t length );
 void                        LCD_IO_WriteReg( uint8_t LCDReg );
+void                        LCD_IO_WriteBuffer16( uint16_t* buffer, uint32_t length );
+void                        LCD_IO_WriteConstBuffer16( const uint16_t* buffer, uint32_t length );
+void                        LCD_IO_WriteRepeat16( uint16_t Value, uint32_t Count );
+void                        LCD_IO_Notify( void (*Callback)( void ) );
+void                        LCD_IO_WaitIdle( void );
 void                        LCD_Delay( uint32_t delay );
 #endif /* HAL_SPI_MODULE_ENABLED && USE_LCD */
 
@@ -487,6 +594,21 @@ int32_t NFCMEM_IO_MemWrite( uint16_t DevAddr, uint16_t TarAddr, const uint8_t *
   int32_t ret;
   uint32_t tickstart;
   
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  if( Size > 0U )
+  {
+    /* The write cycles are polled from the timer, the bus stays free while the EEPROM is programmed */
+    NFCMEM_IO_Wait( );
+    ret = NFCMEM_IO_MemWriteAsync( DevAddr, TarAddr, pData, Size, NULL );
+    if( ret == NFCTAG_OK )
+    {
+      ret = NFCMEM_IO_Wait( );
+    }
+    NFCMEM_IO_MemWriteCompleted_Callback( Size );
+    return ret;
+  }
+#endif /* ST25_DISCOVERY_NFCTAG_ASYNC */
+
   ret = NFCTAG_IO_MemWrite( pData, DevAddr, TarAddr, Size );
   if( ret == NFCTAG_OK )
   {
@@ -572,6 +694,122 @@ int32_t NFCMEM_IO_Tick(void)
 {
   return HAL_GetTick();
 }
+
+/**
+  * @brief  Starts reading data at a specific address from the NFCTAG, returns without waiting.
+  * @note   The data is read by the I2C2 interrupts.
+  * @param  DevAddr : Target device address
+  * @param  TarAddr : I2C data memory address to read
+  * @param  pData: pointer to store read data, untouched by the application until the end of the read
+  * @param  Size : Size in bytes of the value to be read
+  * @param  Callback : called from the interrupts with the NFCTAG status at the end of the read, or NULL
+  * @retval NFCTAG enum status, the callback is only called when NFCTAG_OK is returned
+  */
+int32_t NFCMEM_IO_MemReadAsync( uint16_t DevAddr, uint16_t TarAddr, uint8_t * const pData, uint32_t Size,
+                                NFCMEM_IO_Callback_t Callback )
+{
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  return NFCTAG_IO_StartTransfer( 0, DevAddr, TarAddr, pData, Size, Callback );
+#else
+  int32_t ret = NFCMEM_IO_MemRead( DevAddr, TarAddr, pData, (uint16_t)Size );
+  
+  if( Callback != NULL )
+  {
+    Callback( ret );
+  }
+  return NFCTAG_OK;
+#endif /* ST25_DISCOVERY_NFCTAG_ASYNC */
+}
+
+/**
+  * @brief  Starts writing data at a specific address in the NFCTAG, returns without waiting.
+  * @note   The data is cut in chunks that do not cross ST25_DISCOVERY_NFCTAG_PAGE_SIZE boundaries,
+  *         sent by the I2C2 TX DMA. Out of the dynamic registers and mailbox, each chunk is
+  *         followed by an EEPROM write cycle polled from the timer interrupt.
+  * @param  DevAddr : Target device address
+  * @param  TarAddr : I2C data memory address to write
+  * @param  pData: pointer to the data to write, unchanged until the end of the write
+  * @param  Size : Size in bytes of the value to be written
+  * @param  Callback : called from the interrupts with the NFCTAG status at the end of the write, or NULL
+  * @retval NFCTAG enum status, the callback is only called when NFCTAG_OK is returned
+  */
+int32_t NFCMEM_IO_MemWriteAsync( uint16_t DevAddr, uint16_t TarAddr, const uint8_t * const pData, uint32_t Size,
+                                 NFCMEM_IO_Callback_t Callback )
+{
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  return NFCTAG_IO_StartTransfer( 1, DevAddr, TarAddr, (uint8_t *)pData, Size, Callback );
+#else
+  int32_t ret = NFCTAG_OK;
+  uint32_t offset = 0;
+  uint32_t chunk;
+  
+  while( (offset < Size) && (ret == NFCTAG_OK) )
+  {
+    chunk = ST25_DISCOVERY_NFCTAG_PAGE_SIZE - ((TarAddr + offset) % ST25_DISCOVERY_NFCTAG_PAGE_SIZE);
+    chunk = (chunk < (Size - offset)) ? chunk : (Size - offset);
+    ret = NFCMEM_IO_MemWrite( DevAddr, TarAddr + offset, pData + offset, (uint16_t)chunk );
+    offset += chunk;
+  }
+  if( Callback != NULL )
+  {
+    Callback( ret );
+  }
+  return NFCTAG_OK;
+#endif /* ST25_DISCOVERY_NFCTAG_ASYNC */
+}
+
+/**
+  * @brief  Checks if an asynchronous NFCTAG transfer is running.
+  * @retval 1 while the transfer is running, 0 otherwise
+  */
+uint8_t NFCMEM_IO_IsBusy( void )
+{
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  return (NfctagState != NFCTAG_IO_IDLE) ? 1U : 0U;
+#else
+  return 0U;
+#endif /* ST25_DISCOVERY_NFCTAG_ASYNC */
+}
+
+/**
+  * @brief  Waits for the end of the asynchronous NFCTAG transfer.
+  * @note   The wait is bounded per chunk: the bytes of the chunk on the bus, then ST25DV_WRITE_TIMEOUT.
+  *         A transfer that stops progressing (lost interrupt) is aborted: the I2C2 is reset and
+  *         the callback of the transfer is called from here with NFCTAG_TIMEOUT.
+  * @retval NFCTAG enum status of the last transfer
+  */
+int32_t NFCMEM_IO_Wait( void )
+{
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  uint32_t tickstart = HAL_GetTick( );
+  uint32_t remaining = NfctagXfer.Remaining;
+  uint32_t timeout;
+
+  while( NfctagState != NFCTAG_IO_IDLE )
+  {
+    if( NfctagXfer.Remaining != remaining )
+    {
+      /* A chunk ended, the next one has its own bound */
+      remaining = NfctagXfer.Remaining;
+      tickstart = HAL_GetTick( );
+    }
+
+    /* I2C Timeout: (transfer size in bytes) * (bits per bytes) * (extra delay) / (I2C speed) */
+    timeout = (NfctagXfer.Chunk * 8U * 1000U * 2U) / ST25_DISCOVERY_I2C2_SPEED;
+    if( timeout < ST25_DISCOVERY_I2Cx_TIMEOUT )
+    {
+      timeout = ST25_DISCOVERY_I2Cx_TIMEOUT;
+    }
+    if( (HAL_GetTick( ) - tickstart) >= (timeout + ST25DV_WRITE_TIMEOUT) )
+    {
+      NFCTAG_IO_Abort( );
+    }
+  }
+  return NfctagStatus;
+#else
+  return NFCTAG_OK;
+#endif /* ST25_DISCOVERY_NFCTAG_ASYNC */
+}
 /******************************** LINK NFCTAG *****************************/
 /**
   * @brief  This functions converts HAL status to NFCTAG status
@@ -629,6 +867,9 @@ static int32_t NFCTAG_IO_DeInit( void )
 int32_t NFCTAG_IO_MemWrite( const uint8_t * const pData, const uint8_t DevAddr, 
                                          const uint16_t TarAddr, const uint16_t Size )
 {
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  NFCMEM_IO_Wait( );
+#endif
   return NFCTAG_ConvertStatus( STM32_I2C2_MemWrite(pData, DevAddr, TarAddr, Size) );
 }
 
@@ -643,6 +884,9 @@ int32_t NFCTAG_IO_MemWrite( const uint8_t * const pData, const uint8_t DevAddr,
 int32_t NFCTAG_IO_MemRead( uint8_t * const pData, const uint8_t DevAddr, const uint16_t TarAddr, 
                                         const uint16_t Size )
 {
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  NFCMEM_IO_Wait( );
+#endif
   return NFCTAG_ConvertStatus( STM32_I2C2_MemRead(pData, DevAddr, TarAddr, Size) );
 }
 
@@ -655,6 +899,9 @@ int32_t NFCTAG_IO_MemRead( uint8_t * const pData, const uint8_t DevAddr, const u
   */
 int32_t NFCTAG_IO_Read( uint8_t * const pData, const uint8_t DevAddr, const uint16_t Size )
 {
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  NFCMEM_IO_Wait( );
+#endif
   return NFCTAG_ConvertStatus( STM32_I2C2_Read(pData, DevAddr, Size) );
 }
 
@@ -676,6 +923,9 @@ uint8_t NFCTAG_IO_IsNacked( void )
   */
 int32_t NFCTAG_IO_IsDeviceReady( const uint8_t DevAddr, const uint32_t Trials )
 {
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  NFCMEM_IO_Wait( );
+#endif
   return NFCTAG_ConvertStatus( STM32_I2C2_IsDeviceReady(DevAddr, Trials) );
 }
 #endif /* USE_NFCTAG */
@@ -799,6 +1049,10 @@ static void STM32_I2C1_ITConfig(void)
   gpio_initstruct.Speed = GPIO_SPEED_FREQ_LOW;
   gpio_initstruct.Mode  = GPIO_MODE_IT_FALLING;
   HAL_GPIO_Init( ST25_DISCOVERY_STMPE811_INT_GPIO_PORT, &gpio_initstruct );
+  
+  /* Enable and set IO expander EXTI Interrupt to the lowest priority */
+  HAL_NVIC_SetPriority( ST25_DISCOVERY_STMPE811_INT_EXTI, 0x0F, 0x00 );
+  HAL_NVIC_EnableIRQ( ST25_DISCOVERY_STMPE811_INT_EXTI );
 }
 
 /**
@@ -928,6 +1182,9 @@ static HAL_StatusTypeDef STM32_I2C2_Init( void )
     /* Init the I2C */
     STM32_I2C2_MspInit( );
     ret_val = HAL_I2C_Init( &hi2c2 );
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+    STM32_I2C2_AsyncInit( );
+#endif
   }
   
   return ret_val;
@@ -936,6 +1193,9 @@ static HAL_StatusTypeDef STM32_I2C2_Init( void )
 HAL_StatusTypeDef STM32_I2C2_DeInit( void )
 {
   /* DeInit the I2C */
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  STM32_I2C2_AsyncDeInit( );
+#endif
   STM32_I2C2_MspDeInit( );
   return HAL_I2C_DeInit( &hi2c2 );
   
@@ -1105,6 +1365,390 @@ static void STM32_I2C2_MspDeInit( void )
     /* Disable I2Cx clock */
   __HAL_RCC_I2C2_CLK_DISABLE( );
 }
+
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+/**
+  * @brief  Configures the NFCTAG transfer engine: I2C2 interrupts, TX DMA and write cycle timer.
+  * @note   The RX DMA request (DMA1 channel 5) is used by the LCD, reads run on interrupts.
+  *         The timer registers are set directly, HAL_TIM_Base_MspInit is defined by the WiFi module.
+  * @param  None
+  * @return None
+  */
+static void STM32_I2C2_AsyncInit( void )
+{
+  /* TX DMA */
+  ST25_DISCOVERY_I2C2_DMA_CLK_ENABLE( );
+  hdma_i2c2_tx.Instance                 = ST25_DISCOVERY_I2C2_TX_DMA_CHANNEL;
+  hdma_i2c2_tx.Init.Request             = ST25_DISCOVERY_I2C2_TX_DMA_REQUEST;
+  hdma_i2c2_tx.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  hdma_i2c2_tx.Init.PeriphInc           = DMA_PINC_DISABLE;
+  hdma_i2c2_tx.Init.MemInc              = DMA_MINC_ENABLE;
+  hdma_i2c2_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_i2c2_tx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  hdma_i2c2_tx.Init.Mode                = DMA_NORMAL;
+  hdma_i2c2_tx.Init.Priority            = DMA_PRIORITY_MEDIUM;
+  HAL_DMA_Init( &hdma_i2c2_tx );
+  __HAL_LINKDMA( &hi2c2, hdmatx, hdma_i2c2_tx );
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+  /* Callbacks of hi2c2 only, after HAL_I2C_Init which sets the default ones */
+  HAL_I2C_RegisterCallback( &hi2c2, HAL_I2C_MEM_TX_COMPLETE_CB_ID, NFCTAG_IO_MemTxCpltCallback );
+  HAL_I2C_RegisterCallback( &hi2c2, HAL_I2C_MEM_RX_COMPLETE_CB_ID, NFCTAG_IO_MemRxCpltCallback );
+  HAL_I2C_RegisterCallback( &hi2c2, HAL_I2C_MASTER_TX_COMPLETE_CB_ID, NFCTAG_IO_MasterTxCpltCallback );
+  HAL_I2C_RegisterCallback( &hi2c2, HAL_I2C_ERROR_CB_ID, NFCTAG_IO_ErrorCallback );
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+
+  /* Write cycle timer: 10 kHz counter, one pulse, update interrupt on overflow only */
+  ST25_DISCOVERY_NFCTAG_TIM_CLK_ENABLE( );
+  ST25_DISCOVERY_NFCTAG_TIM->CR1  = TIM_CR1_OPM | TIM_CR1_URS;
+  ST25_DISCOVERY_NFCTAG_TIM->PSC  = (SystemCoreClock / 10000U) - 1U;
+  ST25_DISCOVERY_NFCTAG_TIM->EGR  = TIM_EGR_UG;
+  ST25_DISCOVERY_NFCTAG_TIM->SR   = 0U;
+  ST25_DISCOVERY_NFCTAG_TIM->DIER = TIM_DIER_UIE;
+
+  HAL_NVIC_SetPriority( ST25_DISCOVERY_I2C2_EV_IRQn, 3, 0 );
+  HAL_NVIC_EnableIRQ( ST25_DISCOVERY_I2C2_EV_IRQn );
+  HAL_NVIC_SetPriority( ST25_DISCOVERY_I2C2_ER_IRQn, 3, 0 );
+  HAL_NVIC_EnableIRQ( ST25_DISCOVERY_I2C2_ER_IRQn );
+  HAL_NVIC_SetPriority( ST25_DISCOVERY_I2C2_TX_DMA_IRQn, 3, 0 );
+  HAL_NVIC_EnableIRQ( ST25_DISCOVERY_I2C2_TX_DMA_IRQn );
+  HAL_NVIC_SetPriority( ST25_DISCOVERY_NFCTAG_TIM_IRQn, 3, 0 );
+  HAL_NVIC_EnableIRQ( ST25_DISCOVERY_NFCTAG_TIM_IRQn );
+
+  NfctagState = NFCTAG_IO_IDLE;
+}
+
+/**
+  * @brief  Stops the NFCTAG transfer engine.
+  * @param  None
+  * @return None
+  */
+static void STM32_I2C2_AsyncDeInit( void )
+{
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_NFCTAG_TIM_IRQn );
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_I2C2_TX_DMA_IRQn );
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_I2C2_ER_IRQn );
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_I2C2_EV_IRQn );
+
+  ST25_DISCOVERY_NFCTAG_TIM->CR1 = 0U;
+  ST25_DISCOVERY_NFCTAG_TIM_CLK_DISABLE( );
+  HAL_DMA_DeInit( &hdma_i2c2_tx );
+
+  NfctagState = NFCTAG_IO_IDLE;
+}
+
+/**
+  * @brief  Starts an asynchronous transfer, the next chunks are started from the interrupts.
+  * @param  Write : 1 to write, 0 to read
+  * @param  DevAddr : Target device address
+  * @param  TarAddr : I2C data memory address
+  * @param  pData : pointer to the data
+  * @param  Size : Size in bytes of the transfer
+  * @param  Callback : End of transfer callback, or NULL
+  * @retval NFCTAG enum status
+  */
+static int32_t NFCTAG_IO_StartTransfer( uint8_t Write, uint16_t DevAddr, uint16_t TarAddr, uint8_t *pData,
+                                        uint32_t Size, NFCMEM_IO_Callback_t Callback )
+{
+  if( (pData == NULL) || (Size == 0U) )
+  {
+    return NFCTAG_ERROR;
+  }
+  if( NfctagState != NFCTAG_IO_IDLE )
+  {
+    return NFCTAG_BUSY;
+  }
+
+  NfctagXfer.Write      = Write;
+  /* The dynamic registers and the mailbox are RAM: no write cycle */
+  NfctagXfer.WriteCycle = (Write != 0U) && !((DevAddr == NFCMEM_DATA_I2C_ADDR) && (TarAddr >= NFCMEM_DYN_REG_ADDR));
+  NfctagXfer.DevAddr    = DevAddr;
+  NfctagXfer.TarAddr    = TarAddr;
+  NfctagXfer.pData      = pData;
+  NfctagXfer.Remaining  = Size;
+  NfctagXfer.Callback   = Callback;
+  NfctagStatus          = NFCTAG_OK;
+
+  if( NFCTAG_IO_NextChunk( ) != HAL_OK )
+  {
+    NfctagState = NFCTAG_IO_IDLE;
+    return NFCTAG_ERROR;
+  }
+  return NFCTAG_OK;
+}
+
+/**
+  * @brief  Starts the next chunk: writes stop at the page boundaries, reads at the HAL size limit.
+  * @param  None
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NFCTAG_IO_NextChunk( void )
+{
+  uint32_t chunk = 0xFFFFU;
+
+  if( NfctagXfer.Write )
+  {
+    chunk = ST25_DISCOVERY_NFCTAG_PAGE_SIZE - (NfctagXfer.TarAddr % ST25_DISCOVERY_NFCTAG_PAGE_SIZE);
+  }
+  if( chunk > NfctagXfer.Remaining )
+  {
+    chunk = NfctagXfer.Remaining;
+  }
+  NfctagXfer.Chunk = (uint16_t)chunk;
+  NfctagState = NFCTAG_IO_XFER;
+
+  if( NfctagXfer.Write )
+  {
+    return HAL_I2C_Mem_Write_DMA( &hi2c2, NfctagXfer.DevAddr, NfctagXfer.TarAddr, I2C_MEMADD_SIZE_16BIT,
+                                  NfctagXfer.pData, NfctagXfer.Chunk );
+  }
+  return HAL_I2C_Mem_Read_IT( &hi2c2, NfctagXfer.DevAddr, NfctagXfer.TarAddr, I2C_MEMADD_SIZE_16BIT,
+                              NfctagXfer.pData, NfctagXfer.Chunk );
+}
+
+/**
+  * @brief  End of a chunk on the bus: waits for the write cycle or goes on with the transfer.
+  * @param  None
+  * @return None
+  */
+static void NFCTAG_IO_ChunkDone( void )
+{
+  uint32_t blocks = ((NfctagXfer.TarAddr % ST25_DISCOVERY_NFCTAG_BLOCK_SIZE) + NfctagXfer.Chunk
+                     + ST25_DISCOVERY_NFCTAG_BLOCK_SIZE - 1U) / ST25_DISCOVERY_NFCTAG_BLOCK_SIZE;
+
+  NfctagXfer.TarAddr   += NfctagXfer.Chunk;
+  NfctagXfer.pData     += NfctagXfer.Chunk;
+  NfctagXfer.Remaining -= NfctagXfer.Chunk;
+
+  if( NfctagXfer.WriteCycle )
+  {
+    /* The device does not answer while programming, the first poll is sent once the blocks are likely written */
+    NfctagXfer.PollStart = HAL_GetTick( );
+    NFCTAG_IO_WriteCycle( blocks * ST25_DISCOVERY_NFCTAG_BLOCK_WRITE_US );
+  }
+  else
+  {
+    NFCTAG_IO_Continue( );
+  }
+}
+
+/**
+  * @brief  Starts the next chunk, or ends the transfer.
+  * @param  None
+  * @return None
+  */
+static void NFCTAG_IO_Continue( void )
+{
+  if( NfctagXfer.Remaining == 0U )
+  {
+    NFCTAG_IO_End( NFCTAG_OK );
+  }
+  else if( NFCTAG_IO_NextChunk( ) != HAL_OK )
+  {
+    NFCTAG_IO_End( NFCTAG_ERROR );
+  }
+}
+
+/**
+  * @brief  Arms the write cycle timer.
+  * @param  Delay : Delay in us before the next ready poll
+  * @return None
+  */
+static void NFCTAG_IO_WriteCycle( uint32_t Delay )
+{
+  uint32_t ticks = (Delay + 99U) / 100U;
+
+  NfctagState = NFCTAG_IO_WRITE_CYCLE;
+  ST25_DISCOVERY_NFCTAG_TIM->ARR = (ticks > 1U) ? (ticks - 1U) : 1U;
+  ST25_DISCOVERY_NFCTAG_TIM->CNT = 0U;
+  ST25_DISCOVERY_NFCTAG_TIM->CR1 |= TIM_CR1_CEN;
+}
+
+/**
+  * @brief  Ends the asynchronous transfer and calls its callback.
+  * @param  Status : NFCTAG enum status of the transfer
+  * @return None
+  */
+static void NFCTAG_IO_End( int32_t Status )
+{
+  NfctagStatus = Status;
+  /* Idle before the callback, which may start the next transfer */
+  NfctagState  = NFCTAG_IO_IDLE;
+  if( NfctagXfer.Callback != NULL )
+  {
+    NfctagXfer.Callback( Status );
+  }
+}
+
+/**
+  * @brief  Stops a transfer whose interrupts stopped coming: resets the I2C2 and ends the transfer.
+  * @param  None
+  * @return None
+  */
+static void NFCTAG_IO_Abort( void )
+{
+  uint8_t running;
+
+  /* No interrupt may end the transfer from now on */
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_NFCTAG_TIM_IRQn );
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_I2C2_TX_DMA_IRQn );
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_I2C2_ER_IRQn );
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_I2C2_EV_IRQn );
+  running = (NfctagState != NFCTAG_IO_IDLE) ? 1U : 0U;
+
+  BSP_I2C2_ReInit( );
+  if( running != 0U )
+  {
+    NFCTAG_IO_End( NFCTAG_TIMEOUT );
+  }
+}
+
+/**
+  * @brief  Memory write completed, I2C2 chunk written by the DMA.
+  * @param  hi2c : I2C handle
+  * @return None
+  */
+static void NFCTAG_IO_MemTxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+  if( (hi2c->Instance == ST25_DISCOVERY_I2C2) && (NfctagState == NFCTAG_IO_XFER) )
+  {
+    NFCTAG_IO_ChunkDone( );
+  }
+}
+
+/**
+  * @brief  Memory read completed, I2C2 chunk read.
+  * @param  hi2c : I2C handle
+  * @return None
+  */
+static void NFCTAG_IO_MemRxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+  if( (hi2c->Instance == ST25_DISCOVERY_I2C2) && (NfctagState == NFCTAG_IO_XFER) )
+  {
+    NFCTAG_IO_ChunkDone( );
+  }
+}
+
+/**
+  * @brief  Master transmit completed: the ready poll was acknowledged, the write cycle is over.
+  * @param  hi2c : I2C handle
+  * @return None
+  */
+static void NFCTAG_IO_MasterTxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+  if( (hi2c->Instance == ST25_DISCOVERY_I2C2) && (NfctagState == NFCTAG_IO_POLL) )
+  {
+    NFCTAG_IO_Continue( );
+  }
+}
+
+/**
+  * @brief  I2C error: a NACK on the ready poll means the EEPROM is still programming.
+  * @param  hi2c : I2C handle
+  * @return None
+  */
+static void NFCTAG_IO_ErrorCallback( I2C_HandleTypeDef *hi2c )
+{
+  if( (hi2c->Instance != ST25_DISCOVERY_I2C2) || (NfctagState == NFCTAG_IO_IDLE) )
+  {
+    return;
+  }
+
+  if( (NfctagState == NFCTAG_IO_POLL) && (hi2c->ErrorCode == HAL_I2C_ERROR_AF) )
+  {
+    if( (HAL_GetTick( ) - NfctagXfer.PollStart) < ST25DV_WRITE_TIMEOUT )
+    {
+      NFCTAG_IO_WriteCycle( ST25_DISCOVERY_NFCTAG_POLL_PERIOD_US );
+    }
+    else
+    {
+      NFCTAG_IO_End( NFCTAG_TIMEOUT );
+    }
+  }
+  else
+  {
+    NFCTAG_IO_End( (hi2c->ErrorCode == HAL_I2C_ERROR_AF) ? NFCTAG_NACK : NFCTAG_ERROR );
+  }
+}
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS != 1)
+/* Without USE_HAL_I2C_REGISTER_CALLBACKS, the HAL calls the same callbacks for every I2C handle:
+   the BSP defines them here. An application with its own I2C callbacks must instead set
+   USE_HAL_I2C_REGISTER_CALLBACKS to 1 in stm32l4xx_hal_conf.h, the BSP then registers them on hi2c2 only. */
+void HAL_I2C_MemTxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+  NFCTAG_IO_MemTxCpltCallback( hi2c );
+}
+
+void HAL_I2C_MemRxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+  NFCTAG_IO_MemRxCpltCallback( hi2c );
+}
+
+void HAL_I2C_MasterTxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+  NFCTAG_IO_MasterTxCpltCallback( hi2c );
+}
+
+void HAL_I2C_ErrorCallback( I2C_HandleTypeDef *hi2c )
+{
+  NFCTAG_IO_ErrorCallback( hi2c );
+}
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+#endif /* ST25_DISCOVERY_NFCTAG_ASYNC */
+
+/**
+  * @brief  This function handles the I2C2 event interrupt.
+  * @param  None
+  * @return None
+  */
+void BSP_NFCMEM_I2C_EV_IRQHandler( void )
+{
+  HAL_I2C_EV_IRQHandler( &hi2c2 );
+}
+
+/**
+  * @brief  This function handles the I2C2 error interrupt.
+  * @param  None
+  * @return None
+  */
+void BSP_NFCMEM_I2C_ER_IRQHandler( void )
+{
+  HAL_I2C_ER_IRQHandler( &hi2c2 );
+}
+
+/**
+  * @brief  This function handles the I2C2 TX DMA interrupt.
+  * @param  None
+  * @return None
+  */
+void BSP_NFCMEM_DMA_IRQHandler( void )
+{
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  HAL_DMA_IRQHandler( &hdma_i2c2_tx );
+#endif
+}
+
+/**
+  * @brief  This function handles the write cycle timer interrupt: sends the ready poll.
+  * @param  None
+  * @return None
+  */
+void BSP_NFCMEM_TIM_IRQHandler( void )
+{
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  ST25_DISCOVERY_NFCTAG_TIM->SR = ~TIM_SR_UIF;
+  if( NfctagState == NFCTAG_IO_WRITE_CYCLE )
+  {
+    NfctagState = NFCTAG_IO_POLL;
+    /* Device address only, acknowledged once the EEPROM write cycle is over */
+    if( HAL_I2C_Master_Transmit_IT( &hi2c2, NfctagXfer.DevAddr, NULL, 0 ) != HAL_OK )
+    {
+      NFCTAG_IO_End( NFCTAG_ERROR );
+    }
+  }
+#endif
+}
 #endif /* USE_NFCTAG */
 
 /**
@@ -1305,9 +1949,39 @@ static void STM32_SPI2_Init( void )
 
     STM32_SPI2_MspInit( &hspi2 );
     HAL_SPI_Init( &hspi2 );
+#if ST25_DISCOVERY_LCD_DMA
+    STM32_SPI2_DmaInit( );
+#endif /* ST25_DISCOVERY_LCD_DMA */
   }
 }
 
+#if ST25_DISCOVERY_LCD_DMA
+/**
+  * @brief  Initializes the SPI2 TX DMA channel used by the LCD transfer queue.
+  * @note   Half-word transfers: 16-bit SPI frames, one RGB565 pixel per request.
+  */
+static void STM32_SPI2_DmaInit( void )
+{
+  ST25_DISCOVERY_SPI2_DMA_CLK_ENABLE( );
+
+  hdma_spi2_tx.Instance                 = ST25_DISCOVERY_SPI2_TX_DMA_CHANNEL;
+  hdma_spi2_tx.Init.Request             = ST25_DISCOVERY_SPI2_TX_DMA_REQUEST;
+  hdma_spi2_tx.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  hdma_spi2_tx.Init.PeriphInc           = DMA_PINC_DISABLE;
+  hdma_spi2_tx.Init.MemInc              = DMA_MINC_ENABLE;
+  hdma_spi2_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  hdma_spi2_tx.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+  hdma_spi2_tx.Init.Mode                = DMA_NORMAL;
+  hdma_spi2_tx.Init.Priority            = DMA_PRIORITY_HIGH;
+  HAL_DMA_Init( &hdma_spi2_tx );
+
+  __HAL_LINKDMA( &hspi2, hdmatx, hdma_spi2_tx );
+
+  HAL_NVIC_SetPriority( ST25_DISCOVERY_SPI2_TX_DMA_IRQn, 3, 0 );
+  HAL_NVIC_EnableIRQ( ST25_DISCOVERY_SPI2_TX_DMA_IRQn );
+}
+#endif /* ST25_DISCOVERY_LCD_DMA */
+
 
 /**
   * @brief  Initializes SPI HAL for 8 bits data.
@@ -1416,14 +2090,41 @@ static void STM32_SPI2_WriteBuffer( uint16_t *Values , uint16_t length)
   }
 }
 
-
 /**
-  * @brief  SPI error treatment function.
+  * @brief  Reads a buffer from device in a single transfer.
+  * @param  buffer: Location of the data read
+  * @param  length: Number of bytes to read
   */
-static void STM32_SPI2_Error( void )
+static void STM32_SPI2_ReadBuffer( uint8_t *buffer, uint32_t length )
 {
-  /* De-initialize the SPI communication BUS */
-  HAL_SPI_DeInit( &hspi2 );
+  HAL_StatusTypeDef status = HAL_OK;
+  uint16_t          chunk;
+
+  /* HAL transfer size is 16 bits wide */
+  while( (length > 0) && (status == HAL_OK) )
+  {
+    chunk   = (length > 0xFFFFU) ? 0xFFFFU : (uint16_t)length;
+    status  = HAL_SPI_Receive( &hspi2, buffer, chunk, SpixTimeout );
+    buffer += chunk;
+    length -= chunk;
+  }
+
+  /* Check the communication status */
+  if( status != HAL_OK )
+  {
+    /* Re-Initialize the BUS */
+    STM32_SPI2_Error( );
+  }
+}
+
+
+/**
+  * @brief  SPI error treatment function.
+  */
+static void STM32_SPI2_Error( void )
+{
+  /* De-initialize the SPI communication BUS */
+  HAL_SPI_DeInit( &hspi2 );
   
   /* Re-Initiaize the SPI communication BUS */
   STM32_SPI2_Init( );
@@ -1525,17 +2226,8 @@ void LCD_IO_Init( void )
   */
 void LCD_IO_SetDataWidth( uint32_t w16 )
 {
-  if( w16 != hspi2.Init.DataSize )
-  {
-    if( w16 == SPI_DATASIZE_16BIT )
-    {
-      STM32_SPI2_InitConfig_16BitsData( );
-    }
-    else
-    {
-      STM32_SPI2_InitConfig_8BitsData( );
-    }
-  }
+  LCD_IO_WaitIdle( );
+  LCD_IO_SetWidth( w16 );
 }
 
 /**
@@ -1543,6 +2235,7 @@ void LCD_IO_SetDataWidth( uint32_t w16 )
   */
 void BSP_LCD_LowFreq( void )
 {
+  LCD_IO_WaitIdle( );
   /* SPI Config */
   STM32_SPI2_InitConfig_LowFreq( );
 }
@@ -1552,6 +2245,7 @@ void BSP_LCD_LowFreq( void )
   */
 void BSP_LCD_HighFreq( void )
 {
+  LCD_IO_WaitIdle( );
   STM32_SPI2_InitConfig_HighFreq( );
 }
 
@@ -1560,17 +2254,11 @@ void BSP_LCD_HighFreq( void )
   */
 void LCD_IO_WriteReg( uint8_t Reg ) 
 {
-  LCD_IO_SetDataWidth( SPI_DATASIZE_8BIT );
-  
-  /* Reset WRX to send command */
-  ST25_DISCOVERY_LCD_WRX_LOW( );
-  
-  /* Reset LCD control line(/CS) and Send command */
-  ST25_DISCOVERY_LCD_CS_LOW( );
-  STM32_SPI2_Write( Reg );
-  
-  /* Deselect: Chip Select high */
-  ST25_DISCOVERY_LCD_CS_HIGH( );
+#if ST25_DISCOVERY_LCD_DMA
+  LCD_IO_Queue( LCD_IO_OP_REG, Reg );
+#else
+  LCD_IO_SendReg( Reg );
+#endif /* ST25_DISCOVERY_LCD_DMA */
 }
 
 /**
@@ -1578,17 +2266,11 @@ void LCD_IO_WriteReg( uint8_t Reg )
   */
 void LCD_IO_WriteData( uint8_t RegValue )
 {
-  LCD_IO_SetDataWidth( SPI_DATASIZE_8BIT );
-
-  /* Set WRX to send data */
-  ST25_DISCOVERY_LCD_WRX_HIGH( );
-  
-  /* Reset LCD control line(/CS) and Send data */
-  ST25_DISCOVERY_LCD_CS_LOW( );
-  STM32_SPI2_Write( RegValue );
-  
-  /* Deselect: Chip Select high */
-  ST25_DISCOVERY_LCD_CS_HIGH( );
+#if ST25_DISCOVERY_LCD_DMA
+  LCD_IO_Queue( LCD_IO_OP_DATA8, RegValue );
+#else
+  LCD_IO_SendData( SPI_DATASIZE_8BIT, RegValue );
+#endif /* ST25_DISCOVERY_LCD_DMA */
 }
 
 /**
@@ -1596,35 +2278,176 @@ void LCD_IO_WriteData( uint8_t RegValue )
   */
 void LCD_IO_WriteData16( uint16_t RegValue )
 {
-  LCD_IO_SetDataWidth( SPI_DATASIZE_16BIT );
+#if ST25_DISCOVERY_LCD_DMA
+  LCD_IO_Queue( LCD_IO_OP_DATA16, RegValue );
+#else
+  LCD_IO_SendData( SPI_DATASIZE_16BIT, RegValue );
+#endif /* ST25_DISCOVERY_LCD_DMA */
+}
+
+/**
+  * @brief  Writes a buffer of 16bits data values.
+  * @note   With the transfer queue, the data is copied to a staging buffer and
+  *         sent by DMA: the caller may reuse its buffer as soon as this returns.
+  */
+void LCD_IO_WriteBuffer16( uint16_t* buffer, uint32_t length )
+{
+#if ST25_DISCOVERY_LCD_DMA
+  LCD_IO_QueueItemTypeDef *item;
+  uint32_t                 chunk;
+  uint32_t                 tickstart;
+  uint8_t                  staging;
+
+  while( length > 0 )
+  {
+    chunk = (length > ST25_DISCOVERY_LCD_STAGING_SIZE) ? ST25_DISCOVERY_LCD_STAGING_SIZE : length;
+
+    /* Alternate between the two staging buffers: one is filled while the other is sent */
+    staging        = LcdStagingNext;
+    LcdStagingNext ^= 1U;
+    tickstart      = HAL_GetTick( );
+    while( LcdStagingBusy[staging] != 0 )
+    {
+      LCD_IO_WaitEngine( &tickstart );
+    }
+    memcpy( LcdStaging[staging], buffer, chunk * sizeof(uint16_t) );
+    LcdStagingBusy[staging] = 1;
+
+    item          = LCD_IO_QueueSlot( );
+    item->Op      = LCD_IO_OP_BURST;
+    item->Staging = staging;
+    item->pData   = LcdStaging[staging];
+    item->Length  = chunk;
+    LCD_IO_QueueCommit( );
+
+    buffer += chunk;
+    length -= chunk;
+  }
+#else
+  LCD_IO_SetWidth( SPI_DATASIZE_16BIT );
   
   /* Set WRX to send data */
   ST25_DISCOVERY_LCD_WRX_HIGH( );
   
   /* Reset LCD control line(/CS) and Send data */
   ST25_DISCOVERY_LCD_CS_LOW( );
-  STM32_SPI2_Write( RegValue );
+  while( length > 0 )
+  {
+    uint16_t chunk = (length > 0xFFFFU) ? 0xFFFFU : (uint16_t)length;
+    STM32_SPI2_WriteBuffer( buffer, chunk );
+    buffer += chunk;
+    length -= chunk;
+  }
   
   /* Deselect: Chip Select high */
   ST25_DISCOVERY_LCD_CS_HIGH( );
+#endif /* ST25_DISCOVERY_LCD_DMA */
 }
 
 /**
-  * @brief  Writes 16bits data value.
+  * @brief  Writes a buffer of 16bits data values that does not change (constant data in flash).
+  * @note   With the transfer queue, the data is sent by DMA straight from the buffer,
+  *         without staging copy: the buffer must be half-word aligned and stay
+  *         unchanged until sent.
+  * @param  buffer Data values to write
+  * @param  length Number of 16bits words to write
   */
-void LCD_IO_WriteBuffer16( uint16_t* buffer, uint32_t length )
+void LCD_IO_WriteConstBuffer16( const uint16_t* buffer, uint32_t length )
 {
-  LCD_IO_SetDataWidth( SPI_DATASIZE_16BIT );
-  
-  /* Set WRX to send data */
+#if ST25_DISCOVERY_LCD_DMA
+  LCD_IO_QueueItemTypeDef *item;
+
+  if( length == 0 )
+  {
+    return;
+  }
+  item          = LCD_IO_QueueSlot( );
+  item->Op      = LCD_IO_OP_BURST;
+  item->Staging = LCD_IO_NO_STAGING;
+  item->pData   = (uint16_t *)buffer;
+  item->Length  = length;
+  LCD_IO_QueueCommit( );
+#else
+  LCD_IO_WriteBuffer16( (uint16_t *)buffer, length );
+#endif /* ST25_DISCOVERY_LCD_DMA */
+}
+
+/**
+  * @brief  Writes the same 16bits data value several times (colour fill).
+  * @param  Value Data value to repeat
+  * @param  Count Number of 16bits words to write
+  */
+void LCD_IO_WriteRepeat16( uint16_t Value, uint32_t Count )
+{
+#if ST25_DISCOVERY_LCD_DMA
+  LCD_IO_QueueItemTypeDef *item;
+
+  if( Count == 0 )
+  {
+    return;
+  }
+  item          = LCD_IO_QueueSlot( );
+  item->Op      = LCD_IO_OP_FILL;
+  item->Staging = LCD_IO_NO_STAGING;
+  item->Value   = Value;
+  item->Length  = Count;
+  LCD_IO_QueueCommit( );
+#else
+  uint16_t buffer[32];
+  uint32_t i;
+
+  for( i = 0; i < (sizeof(buffer) / sizeof(buffer[0])); i++ )
+  {
+    buffer[i] = Value;
+  }
+
+  LCD_IO_SetWidth( SPI_DATASIZE_16BIT );
   ST25_DISCOVERY_LCD_WRX_HIGH( );
-  
-  /* Reset LCD control line(/CS) and Send data */
   ST25_DISCOVERY_LCD_CS_LOW( );
-  STM32_SPI2_WriteBuffer( buffer, length );
-  
-  /* Deselect: Chip Select high */
+  while( Count > 0 )
+  {
+    i = (Count > (sizeof(buffer) / sizeof(buffer[0]))) ? (sizeof(buffer) / sizeof(buffer[0])) : Count;
+    STM32_SPI2_WriteBuffer( buffer, (uint16_t)i );
+    Count -= i;
+  }
   ST25_DISCOVERY_LCD_CS_HIGH( );
+#endif /* ST25_DISCOVERY_LCD_DMA */
+}
+
+/**
+  * @brief  Calls a function once every LCD write issued before has been sent.
+  * @note   With the transfer queue, the callback may run from the DMA interrupt.
+  * @param  Callback Function to call
+  */
+void LCD_IO_Notify( void (*Callback)( void ) )
+{
+#if ST25_DISCOVERY_LCD_DMA
+  LCD_IO_QueueItemTypeDef *item;
+
+  item           = LCD_IO_QueueSlot( );
+  item->Op       = LCD_IO_OP_NOTIFY;
+  item->Staging  = LCD_IO_NO_STAGING;
+  item->Callback = Callback;
+  LCD_IO_QueueCommit( );
+#else
+  Callback( );
+#endif /* ST25_DISCOVERY_LCD_DMA */
+}
+
+/**
+  * @brief  Waits until every queued LCD write has been sent.
+  * @note   Must not be called with interrupts masked.
+  */
+void LCD_IO_WaitIdle( void )
+{
+#if ST25_DISCOVERY_LCD_DMA
+  uint32_t tickstart = HAL_GetTick( );
+
+  while( LcdQueueBusy != 0 )
+  {
+    LCD_IO_WaitEngine( &tickstart );
+  }
+#endif /* ST25_DISCOVERY_LCD_DMA */
 }
 
 /**
@@ -1668,14 +2491,364 @@ uint32_t LCD_IO_ReadData( uint16_t RegValue, uint8_t ReadSize )
   return readvalue;
 }
 
+/**
+  * @brief  Reads a block of data after a command, keeping CS low for the whole burst.
+  * @param  RegValue Address of the register to read
+  * @param  buffer Location of the data read (raw bytes, as sent by the LCD)
+  * @param  length Number of bytes to read
+  */
+void LCD_IO_ReadBuffer( uint16_t RegValue, uint8_t *buffer, uint32_t length )
+{
+  LCD_IO_SetDataWidth( SPI_DATASIZE_8BIT );
+  
+  /* Reset WRX to send command */
+  ST25_DISCOVERY_LCD_WRX_LOW( );
+  
+  /* Select: Chip Select low */
+  ST25_DISCOVERY_LCD_CS_LOW( );
+
+  STM32_SPI2_Write( RegValue );
+  STM32_SPI2_ReadBuffer( buffer, length );
+
+  /* Deselect: Chip Select high */
+  ST25_DISCOVERY_LCD_CS_HIGH( );
+
+  /* Set WRX to send data */
+  ST25_DISCOVERY_LCD_WRX_HIGH( );
+}
+
 /**
   * @brief  Wait for loop in ms.
   * @param  Delay in ms.
   */
 void LCD_Delay( uint32_t Delay )
 {
+  /* Delays separate LCD commands (reset, sleep out): the previous ones must be sent */
+  LCD_IO_WaitIdle( );
   HAL_Delay( Delay );
 }
+
+/**
+  * @brief  Sets the SPI frame size used for the next LCD access.
+  */
+static void LCD_IO_SetWidth( uint32_t w16 )
+{
+  if( w16 != hspi2.Init.DataSize )
+  {
+    if( w16 == SPI_DATASIZE_16BIT )
+    {
+      STM32_SPI2_InitConfig_16BitsData( );
+    }
+    else
+    {
+      STM32_SPI2_InitConfig_8BitsData( );
+    }
+  }
+}
+
+/**
+  * @brief  Sends a command byte (polling).
+  */
+static void LCD_IO_SendReg( uint8_t Reg )
+{
+  LCD_IO_SetWidth( SPI_DATASIZE_8BIT );
+  
+  /* Reset WRX to send command */
+  ST25_DISCOVERY_LCD_WRX_LOW( );
+  
+  /* Reset LCD control line(/CS) and Send command */
+  ST25_DISCOVERY_LCD_CS_LOW( );
+  STM32_SPI2_Write( Reg );
+  
+  /* Deselect: Chip Select high */
+  ST25_DISCOVERY_LCD_CS_HIGH( );
+}
+
+/**
+  * @brief  Sends a 8 or 16 bits data value (polling).
+  */
+static void LCD_IO_SendData( uint32_t w16, uint16_t Value )
+{
+  LCD_IO_SetWidth( w16 );
+
+  /* Set WRX to send data */
+  ST25_DISCOVERY_LCD_WRX_HIGH( );
+  
+  /* Reset LCD control line(/CS) and Send data */
+  ST25_DISCOVERY_LCD_CS_LOW( );
+  STM32_SPI2_Write( Value );
+  
+  /* Deselect: Chip Select high */
+  ST25_DISCOVERY_LCD_CS_HIGH( );
+}
+
+#if ST25_DISCOVERY_LCD_DMA
+/**
+  * @brief  Queues a command or data value.
+  */
+static void LCD_IO_Queue( uint8_t Op, uint16_t Value )
+{
+  LCD_IO_QueueItemTypeDef *item;
+
+  item          = LCD_IO_QueueSlot( );
+  item->Op      = Op;
+  item->Staging = LCD_IO_NO_STAGING;
+  item->Value   = Value;
+  LCD_IO_QueueCommit( );
+}
+
+/**
+  * @brief  Called while waiting for the engine: after SpixTimeout ms without progress the
+  *         DMA completion is considered lost, the transfer in flight is dropped and the
+  *         queue goes on with the next operation.
+  * @param  tickstart Start of the wait, restarted after a recovery
+  */
+static void LCD_IO_WaitEngine( uint32_t *tickstart )
+{
+  if( (HAL_GetTick( ) - *tickstart) <= SpixTimeout )
+  {
+    return;
+  }
+
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_SPI2_TX_DMA_IRQn );
+  if( LcdQueueBusy != 0 )
+  {
+    HAL_DMA_Abort( &hdma_spi2_tx );
+    STM32_SPI2_Error( );
+    LCD_IO_QueueDmaDone( 1 );
+  }
+  HAL_NVIC_EnableIRQ( ST25_DISCOVERY_SPI2_TX_DMA_IRQn );
+  *tickstart = HAL_GetTick( );
+}
+
+/**
+  * @brief  Returns the next free queue slot, waiting for the engine if the queue is full.
+  */
+static LCD_IO_QueueItemTypeDef *LCD_IO_QueueSlot( void )
+{
+  uint32_t tickstart = HAL_GetTick( );
+
+  while( (LcdQueueTail - LcdQueueHead) >= ST25_DISCOVERY_LCD_QUEUE_SIZE )
+  {
+    LCD_IO_WaitEngine( &tickstart );
+  }
+  return &LcdQueue[LcdQueueTail % ST25_DISCOVERY_LCD_QUEUE_SIZE];
+}
+
+/**
+  * @brief  Publishes the slot returned by LCD_IO_QueueSlot and starts the engine if idle.
+  */
+static void LCD_IO_QueueCommit( void )
+{
+  uint8_t kick = 0;
+
+  if( LcdQueueBusy == 0 )
+  {
+    /* Idle: no DMA transfer in flight, the interrupt cannot run */
+    LcdQueueTail++;
+    LcdQueueBusy = 1;
+    LCD_IO_QueueRun( );
+    return;
+  }
+
+  /* The engine clears LcdQueueBusy from the DMA interrupt when it finds the queue empty */
+  HAL_NVIC_DisableIRQ( ST25_DISCOVERY_SPI2_TX_DMA_IRQn );
+  LcdQueueTail++;
+  if( LcdQueueBusy == 0 )
+  {
+    LcdQueueBusy = 1;
+    kick = 1;
+  }
+  HAL_NVIC_EnableIRQ( ST25_DISCOVERY_SPI2_TX_DMA_IRQn );
+
+  if( kick != 0 )
+  {
+    LCD_IO_QueueRun( );
+  }
+}
+
+/**
+  * @brief  Executes queued operations in order until a DMA transfer is started
+  *         or the queue is empty.
+  * @note   Runs from the producer when the queue was idle, then from the DMA
+  *         completion: only one instance can run at a time.
+  */
+static void LCD_IO_QueueRun( void )
+{
+  LCD_IO_QueueItemTypeDef *item;
+
+  while( LcdQueueHead != LcdQueueTail )
+  {
+    item = &LcdQueue[LcdQueueHead % ST25_DISCOVERY_LCD_QUEUE_SIZE];
+    switch( item->Op )
+    {
+      case LCD_IO_OP_REG:
+        LCD_IO_SendReg( (uint8_t)item->Value );
+        break;
+
+      case LCD_IO_OP_DATA8:
+        LCD_IO_SendData( SPI_DATASIZE_8BIT, item->Value );
+        break;
+
+      case LCD_IO_OP_DATA16:
+        LCD_IO_SendData( SPI_DATASIZE_16BIT, item->Value );
+        break;
+
+      case LCD_IO_OP_NOTIFY:
+        item->Callback( );
+        break;
+
+      default:
+        if( item->Length < ST25_DISCOVERY_LCD_DMA_MIN_SIZE )
+        {
+          LCD_IO_SendBurst( item );
+          LCD_IO_EndBurst( item );
+          break;
+        }
+        /* Burst or fill: resumed by LCD_IO_QueueDmaDone */
+        if( LCD_IO_StartChunk( item ) == HAL_OK )
+        {
+          return;
+        }
+        STM32_SPI2_Error( );
+        LCD_IO_EndBurst( item );
+        break;
+    }
+    LcdQueueHead++;
+  }
+  LcdQueueBusy = 0;
+}
+
+/**
+  * @brief  Starts the DMA transfer of the next chunk of a burst or fill.
+  */
+static HAL_StatusTypeDef LCD_IO_StartChunk( LCD_IO_QueueItemTypeDef *item )
+{
+  uint8_t *source;
+
+  /* HAL transfer size is 16 bits wide */
+  LcdQueueChunk = (item->Length > 0xFFFFU) ? 0xFFFFU : (uint16_t)item->Length;
+
+  LCD_IO_SetWidth( SPI_DATASIZE_16BIT );
+  ST25_DISCOVERY_LCD_WRX_HIGH( );
+  ST25_DISCOVERY_LCD_CS_LOW( );
+
+  /* A fill sends the same colour for every pixel: the DMA source address stays fixed */
+  __HAL_DMA_DISABLE( &hdma_spi2_tx );
+  if( item->Op == LCD_IO_OP_FILL )
+  {
+    CLEAR_BIT( hdma_spi2_tx.Instance->CCR, DMA_CCR_MINC );
+    source = (uint8_t *)&item->Value;
+  }
+  else
+  {
+    SET_BIT( hdma_spi2_tx.Instance->CCR, DMA_CCR_MINC );
+    source = (uint8_t *)item->pData;
+  }
+
+  return HAL_SPI_Transmit_DMA( &hspi2, source, LcdQueueChunk );
+}
+
+/**
+  * @brief  Sends a short burst or fill by polling.
+  */
+static void LCD_IO_SendBurst( LCD_IO_QueueItemTypeDef *item )
+{
+  uint16_t  fill[ST25_DISCOVERY_LCD_DMA_MIN_SIZE];
+  uint16_t *source = item->pData;
+  uint32_t  i;
+
+  if( item->Op == LCD_IO_OP_FILL )
+  {
+    for( i = 0; i < item->Length; i++ )
+    {
+      fill[i] = item->Value;
+    }
+    source = fill;
+  }
+
+  LCD_IO_SetWidth( SPI_DATASIZE_16BIT );
+  ST25_DISCOVERY_LCD_WRX_HIGH( );
+  ST25_DISCOVERY_LCD_CS_LOW( );
+  STM32_SPI2_WriteBuffer( source, (uint16_t)item->Length );
+}
+
+/**
+  * @brief  Ends a burst or fill: releases the LCD and the staging buffer.
+  */
+static void LCD_IO_EndBurst( LCD_IO_QueueItemTypeDef *item )
+{
+  /* Deselect: Chip Select high */
+  ST25_DISCOVERY_LCD_CS_HIGH( );
+
+  if( item->Staging != LCD_IO_NO_STAGING )
+  {
+    LcdStagingBusy[item->Staging] = 0;
+  }
+}
+
+/**
+  * @brief  DMA transfer done: continues the current burst or fill, then the queue.
+  * @param  Abort 1 if the transfer failed, the rest of the operation is dropped
+  */
+static void LCD_IO_QueueDmaDone( uint8_t Abort )
+{
+  LCD_IO_QueueItemTypeDef *item = &LcdQueue[LcdQueueHead % ST25_DISCOVERY_LCD_QUEUE_SIZE];
+
+  item->Length -= LcdQueueChunk;
+  if( item->Op == LCD_IO_OP_BURST )
+  {
+    item->pData += LcdQueueChunk;
+  }
+
+  if( (Abort == 0) && (item->Length > 0) )
+  {
+    if( LCD_IO_StartChunk( item ) == HAL_OK )
+    {
+      return;
+    }
+    STM32_SPI2_Error( );
+  }
+
+  LCD_IO_EndBurst( item );
+  LcdQueueHead++;
+  LCD_IO_QueueRun( );
+}
+
+/**
+  * @brief  SPI Tx transfer complete callback.
+  */
+void HAL_SPI_TxCpltCallback( SPI_HandleTypeDef *hspi )
+{
+  if( hspi->Instance == ST25_DISCOVERY_SPI2 )
+  {
+    LCD_IO_QueueDmaDone( 0 );
+  }
+}
+
+/**
+  * @brief  SPI error callback.
+  */
+void HAL_SPI_ErrorCallback( SPI_HandleTypeDef *hspi )
+{
+  if( hspi->Instance == ST25_DISCOVERY_SPI2 )
+  {
+    /* Re-Initialize the BUS and go on with the next operation */
+    STM32_SPI2_Error( );
+    LCD_IO_QueueDmaDone( 1 );
+  }
+}
+#endif /* ST25_DISCOVERY_LCD_DMA */
+
+/**
+  * @brief  Handles the SPI2 TX DMA interrupt (LCD transfer queue).
+  */
+void BSP_LCD_DMA_IRQHandler( void )
+{
+#if ST25_DISCOVERY_LCD_DMA
+  HAL_DMA_IRQHandler( &hdma_spi2_tx );
+#endif /* ST25_DISCOVERY_LCD_DMA */
+}
 #endif /* HAL_SPI_MODULE_ENABLED && USE_LCD */
 
 /*******************************************************************************
@@ -82,6 +82,13 @@ typedef enum
   I2CANSW_NACK
 }ST25_DISCOVERY_I2CANSW_TypeDef;
 
+#if defined(USE_NFCTAG)
+/**
+ * @brief  End of an asynchronous NFCTAG transfer, called from the interrupts with the NFCTAG status
+ */
+typedef void (*NFCMEM_IO_Callback_t)( int32_t Status );
+#endif /* USE_NFCTAG */
+
 
 #define ST25_DISCOVERY_LEDn                                       2
 
@@ -192,6 +199,49 @@ typedef enum
 #define ST25_DISCOVERY_I2C2_TIMINGS                               0x10B5163A /* 400KHz */
 #define ST25_DISCOVERY_I2C2_SPEED                                 400000 /* 400KHz */
 
+/** 
+* @brief  NFCTAG transfer engine
+*         When enabled, NFCTAG memory accesses are cut in page aligned chunks:
+*         writes are sent by the I2C2 TX DMA, reads by the I2C2 interrupts (the
+*         I2C2 RX DMA request is on DMA1 channel 5, used by the LCD transfer queue)
+*         and the EEPROM write cycles are polled from a timer interrupt.
+* @note   Only built with USE_NFCTAG and USE_ST25DV. The ST25DV component (st25dv.h,
+*         st25dvxxkc.h) is not part of this package and the ST25R3916 projects define
+*         neither: the engine is not integrated in a firmware, it runs on the host model
+*         of Utilities/HostSim/NfctagIo.
+*/
+#ifndef ST25_DISCOVERY_NFCTAG_ASYNC
+#define ST25_DISCOVERY_NFCTAG_ASYNC                               1
+#endif
+/* Bytes of a sequential write: a write chunk never crosses a page boundary */
+#ifndef ST25_DISCOVERY_NFCTAG_PAGE_SIZE
+#define ST25_DISCOVERY_NFCTAG_PAGE_SIZE                           256
+#endif
+/* EEPROM programming: the write cycle lasts up to 5 ms per 4 bytes block written */
+#define ST25_DISCOVERY_NFCTAG_BLOCK_SIZE                          4
+/* Delay (in us per block) before the first ready poll, and period of the next polls */
+#ifndef ST25_DISCOVERY_NFCTAG_BLOCK_WRITE_US
+#define ST25_DISCOVERY_NFCTAG_BLOCK_WRITE_US                      4000
+#endif
+#ifndef ST25_DISCOVERY_NFCTAG_POLL_PERIOD_US
+#define ST25_DISCOVERY_NFCTAG_POLL_PERIOD_US                      500
+#endif
+#define ST25_DISCOVERY_I2C2_EV_IRQn                               I2C2_EV_IRQn
+#define ST25_DISCOVERY_I2C2_ER_IRQn                               I2C2_ER_IRQn
+#define ST25_DISCOVERY_I2C2_EV_IRQHandler                         I2C2_EV_IRQHandler
+#define ST25_DISCOVERY_I2C2_ER_IRQHandler                         I2C2_ER_IRQHandler
+#define ST25_DISCOVERY_I2C2_DMA_CLK_ENABLE()                      __HAL_RCC_DMA1_CLK_ENABLE()
+#define ST25_DISCOVERY_I2C2_TX_DMA_CHANNEL                        DMA1_Channel4
+#define ST25_DISCOVERY_I2C2_TX_DMA_REQUEST                        DMA_REQUEST_3
+#define ST25_DISCOVERY_I2C2_TX_DMA_IRQn                           DMA1_Channel4_IRQn
+#define ST25_DISCOVERY_I2C2_TX_DMA_IRQHandler                     DMA1_Channel4_IRQHandler
+/* Write cycle timer, 10 kHz counter */
+#define ST25_DISCOVERY_NFCTAG_TIM                                 TIM7
+#define ST25_DISCOVERY_NFCTAG_TIM_CLK_ENABLE()                    __HAL_RCC_TIM7_CLK_ENABLE()
+#define ST25_DISCOVERY_NFCTAG_TIM_CLK_DISABLE()                   __HAL_RCC_TIM7_CLK_DISABLE()
+#define ST25_DISCOVERY_NFCTAG_TIM_IRQn                            TIM7_IRQn
+#define ST25_DISCOVERY_NFCTAG_TIM_IRQHandler                      TIM7_IRQHandler
+
 #if defined(USE_ST25DV)  
 #define NFCMEM_I2C_TIMEOUT                                        ST25DV_I2C_TIMEOUT
 
@@ -371,6 +421,33 @@ typedef enum
 #define ST25_DISCOVERY_LCD_CS_HIGH()                              HAL_GPIO_WritePin(ST25_DISCOVERY_SPI2_SCK_NSS_GPIO_PORT, ST25_DISCOVERY_SPI2_NSS_PIN, GPIO_PIN_SET) 
 #define ST25_DISCOVERY_LCD_NCS_GPIO_CLK_ENABLE()                  ST25_DISCOVERY_SPI2_SCK_NSS_GPIO_CLK_ENABLE()
 
+/** 
+* @brief  LCD transfer queue
+*         When enabled, LCD writes are queued and pixel bursts / colour fills are
+*         sent by the SPI2 TX DMA while the CPU prepares the next content.
+*         Reads, frequency changes and delays wait for the queue to drain.
+*/
+#ifndef ST25_DISCOVERY_LCD_DMA
+#define ST25_DISCOVERY_LCD_DMA                                    1
+#endif
+/* Number of pending LCD operations (register, data, burst, fill, notify) */
+#ifndef ST25_DISCOVERY_LCD_QUEUE_SIZE
+#define ST25_DISCOVERY_LCD_QUEUE_SIZE                             32
+#endif
+/* Size in pixels of each of the two row staging buffers used for bursts */
+#ifndef ST25_DISCOVERY_LCD_STAGING_SIZE
+#define ST25_DISCOVERY_LCD_STAGING_SIZE                           512
+#endif
+/* Bursts and fills shorter than this (in pixels) are sent by polling: cheaper than a DMA set-up */
+#ifndef ST25_DISCOVERY_LCD_DMA_MIN_SIZE
+#define ST25_DISCOVERY_LCD_DMA_MIN_SIZE                           16
+#endif
+#define ST25_DISCOVERY_SPI2_DMA_CLK_ENABLE()                      __HAL_RCC_DMA1_CLK_ENABLE()
+#define ST25_DISCOVERY_SPI2_TX_DMA_CHANNEL                        DMA1_Channel5
+#define ST25_DISCOVERY_SPI2_TX_DMA_REQUEST                        DMA_REQUEST_1
+#define ST25_DISCOVERY_SPI2_TX_DMA_IRQn                           DMA1_Channel5_IRQn
+#define ST25_DISCOVERY_SPI2_TX_DMA_IRQHandler                     DMA1_Channel5_IRQHandler
+
 #endif /* HAL_SPI_MODULE_ENABLED && USE_LCD */
 
 /*################################ GPO NFCMEM #######################################*/
@@ -411,7 +488,9 @@ typedef enum
 
 /*########################## MEMORY NFCMEM WRAPPER #################################*/
 #if defined(USE_ST25DV)
-
+/* Dynamic registers and mailbox: RAM from this address of the user memory, no write cycle */
+#define NFCMEM_DATA_I2C_ADDR                                      ST25DV_ADDR_DATA_I2C
+#define NFCMEM_DYN_REG_ADDR                                       ST25DV_GPO_DYN_REG
 #endif /* USE_ST25DV */
 
 #endif /* USE_NFCTAG */
@@ -439,6 +518,16 @@ int32_t        NFCMEM_IO_Read( uint8_t * const pData, const uint8_t DevAddr, con
 uint8_t        NFCMEM_IO_IsNacked( void );
 int32_t        NFCMEM_IO_IsDeviceReady( uint16_t DevAddress,  uint32_t Trials );
 int32_t        NFCMEM_IO_Tick(void);
+int32_t        NFCMEM_IO_MemReadAsync( uint16_t DevAddr, uint16_t TarAddr, uint8_t * const pData, uint32_t Size,
+                                       NFCMEM_IO_Callback_t Callback );
+int32_t        NFCMEM_IO_MemWriteAsync( uint16_t DevAddr, uint16_t TarAddr, const uint8_t * const pData, uint32_t Size,
+                                        NFCMEM_IO_Callback_t Callback );
+uint8_t        NFCMEM_IO_IsBusy( void );
+int32_t        NFCMEM_IO_Wait( void );
+void           BSP_NFCMEM_I2C_EV_IRQHandler( void );
+void           BSP_NFCMEM_I2C_ER_IRQHandler( void );
+void           BSP_NFCMEM_DMA_IRQHandler( void );
+void           BSP_NFCMEM_TIM_IRQHandler( void );
 
 #endif /* USE_NFCTAG && USE_ST25DV */
 
@@ -452,6 +541,7 @@ void          BSP_ST25DV_EH_DeInit(void);
 #if defined(HAL_SPI_MODULE_ENABLED) && defined(USE_LCD)
 void          BSP_LCD_LowFreq(void);
 void          BSP_LCD_HighFreq(void);
+void          BSP_LCD_DMA_IRQHandler(void);
 
 #endif /* HAL_SPI_MODULE_ENABLED && USE_LCD */
 
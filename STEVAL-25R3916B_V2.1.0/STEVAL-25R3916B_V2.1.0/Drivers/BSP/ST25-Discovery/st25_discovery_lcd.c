@@ -57,6 +57,7 @@
   #include "fw_command.h"
 #endif
 #include <stdlib.h>
+#include <string.h>
 
 /** @addtogroup BSP
   * @{
@@ -76,6 +77,8 @@
 #define max(a,b) (((a)>(b))?(a):(b))
 #define min(a,b) (((a)<(b))?(a):(b))
 #define ABS(X)  ((X) > 0 ? (X) : -(X)) 
+/* Longest text run: screen width with the narrowest font (Font8) */
+#define TEXT_RUN_MAX_GLYPHS    64
 
 LCD_DrawPropTypeDef DrawProp;
 static LCD_DrvTypeDef  *LcdDrv;
@@ -83,7 +86,10 @@ static LCD_DrvTypeDef  *LcdDrv;
 static uint8_t enableGreyScale;
 
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
+static void DrawGlyphRun(uint16_t Xpos, uint16_t Ypos, const uint8_t * const *Glyphs, uint32_t Count);
+static const uint8_t *GetGlyph(uint8_t Ascii);
 static void FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3);
+static void DrawLineRun(int32_t Xpos, int32_t Ypos, int32_t Length, uint8_t Vertical);
 
 /**
   * @brief  Initializes the LCD.
@@ -121,17 +127,47 @@ uint8_t BSP_LCD_Init(void)
   return LCD_OK;
 }  
 
+/**
+  * @brief  Reads a rectangle of the LCD memory.
+  * @param  Xpos: X position of the region
+  * @param  Ypos: Y position of the region
+  * @param  Width: Region width
+  * @param  Height: Region height
+  * @param  pData: RGB565 pixels, little endian, row after row (Width * Height * 2 bytes)
+  * @retval LCD state: LCD_ERROR when the LCD driver cannot read its memory
+  */
+uint8_t BSP_LCD_ReadRegion(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint8_t *pData)
+{
+  if(LcdDrv->ReadRegion == NULL)
+  {
+    return LCD_ERROR;
+  }
+
+  /* Lowered the SPI freq to enable reads */
+  BSP_LCD_LowFreq();
+  LcdDrv->ReadRegion(Xpos, Ypos, Width, Height, pData);
+  /* Resetting the SPI freq for write only */
+  BSP_LCD_HighFreq();
+
+  return LCD_OK;
+}
+
 #ifdef ENABLE_SCREEN_CAPTURE
 /**
   * @brief  Reads the LCD memory and copy it to the internal flash, used to do screen captures.
-  * @retval None.
+  * @retval LCD state: LCD_ERROR when the LCD driver cannot read its memory, the flash is left untouched
   */
-void BSP_LCD_CaptureScreen(void)
+uint8_t BSP_LCD_CaptureScreen(void)
 {
   const uint32_t screencaptureaddress = 0x080D0000; /* Needing 0x25800 bytes in flash, (height * (width * sizeof uint16_t)) => 240 * (320 * 2)) */
   uint32_t width = BSP_LCD_GetXSize();
   uint32_t height = BSP_LCD_GetYSize();
 
+  if(LcdDrv->ReadRegion == NULL)
+  {
+    return LCD_ERROR;
+  }
+
   /* Lowered the SPI freq to enable reads */
   BSP_LCD_LowFreq();
 
@@ -143,14 +179,11 @@ void BSP_LCD_CaptureScreen(void)
   FLASH_If_PageErase( screencaptureaddress, FIRMWARE_FLASH_LAST_PAGE_ADDRESS );
 #endif /* ST25DX_DISCOVERY_MB1283 */
 
-  /* Storing LCD screen content to flash memory, be patient it may take a while */
+  /* Storing LCD screen content to flash memory, one GRAM burst per row */
   uint16_t buffer[320];
   for(int y = 0 ; y < height; y++)
   {
-    for(int x = 0; x < width; x++)
-    {
-        buffer[x] =  LcdDrv->ReadPixel(x,y);
-    } 
+    LcdDrv->ReadRegion(0, y, width, 1, (uint8_t *)buffer);
 #if defined(ST25DX_DISCOVERY_MB1283)
     FLASH_If_WriteBuffer( (screencaptureaddress + (y * sizeof(buffer))), FIRMWARE_FLASH_LAST_PAGE_ADDRESS, (uint8_t *)buffer, sizeof(buffer) );
 #elif defined(ST25_DISCOVERY_MB1396)
@@ -169,6 +202,7 @@ void BSP_LCD_CaptureScreen(void)
   /* Resetting the SPI freq for write only */
   BSP_LCD_HighFreq();
 
+  return LCD_OK;
 }
 #endif
 
@@ -347,15 +381,9 @@ void BSP_LCD_ReSetColorKeying(void)
   */
 void BSP_LCD_Clear(uint16_t Color)
 { 
-  uint32_t counter = 0;
-  uint32_t color_backup = DrawProp.TextColor; 
-  DrawProp.TextColor = Color;
-  
-  for(counter = 0; counter < BSP_LCD_GetYSize(); counter++)
-  {
-    BSP_LCD_DrawHLine(0, counter, BSP_LCD_GetXSize());
-  }
-  DrawProp.TextColor = color_backup; 
+  /* One window over the whole screen, filled with a single repeated colour */
+  BSP_LCD_SetDisplayWindow(0, 0, BSP_LCD_GetXSize() - 1, BSP_LCD_GetYSize() - 1);
+  LCD_IO_WriteRepeat16(Color, (uint32_t)BSP_LCD_GetXSize() * BSP_LCD_GetYSize());
   BSP_LCD_SetTextColor(DrawProp.TextColor);
 }
 
@@ -438,12 +466,7 @@ void BSP_LCD_DisplayChar(uint16_t Line, uint16_t Columns, uint8_t Ascii)
   */
 void BSP_LCD_DisplayCharAt(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  if(Ascii < ' ' || Ascii > '~')
-  {
-    Ascii = ' ';
-  }
-  DrawChar(Xpos, Ypos, &DrawProp.pFont->table[(Ascii-' ') *\
-  DrawProp.pFont->Height * ((DrawProp.pFont->Width + 7) / 8)]);
+  DrawChar(Xpos, Ypos, GetGlyph(Ascii));
 }
 
 /**
@@ -463,12 +486,14 @@ void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Line_M
   uint16_t refcolumn = 1, i = 0;
   uint32_t size = 0, xsize = 0; 
   uint8_t  *ptr = Text;
+  const uint8_t *glyphs[TEXT_RUN_MAX_GLYPHS];
   
   /* Get the text size */
   while (*ptr++) size ++ ;
   
   /* Characters number per line */
   xsize = (BSP_LCD_GetXSize()/DrawProp.pFont->Width);
+  size = min(size, xsize);
   
   switch (Mode)
   {
@@ -494,17 +519,20 @@ void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Line_M
     }
   }
   
-  /* Send the string character by character on lCD */
-  while ((*Text != 0) & (((BSP_LCD_GetXSize() - (i*DrawProp.pFont->Width)) & 0xFFFF) >= DrawProp.pFont->Width))
-  {
-    /* Display one character on LCD */
-    BSP_LCD_DisplayCharAt(refcolumn, Ypos, *Text);
-    /* Decrement the column position by 16 */
-    refcolumn += DrawProp.pFont->Width;
-    /* Point on the next character */
-    Text++;
-    i++;
+  /* Keep the characters fitting on the screen */
+  if(refcolumn >= BSP_LCD_GetXSize())
+  {
+    return;
+  }
+  size = min(size, (BSP_LCD_GetXSize() - refcolumn) / DrawProp.pFont->Width);
+  size = min(size, TEXT_RUN_MAX_GLYPHS);
+
+  /* Send the whole string in a single LCD window */
+  for(i = 0; i < size; i++)
+  {
+    glyphs[i] = GetGlyph(Text[i]);
   }
+  DrawGlyphRun(refcolumn, Ypos, glyphs, size);
 }
 
 /**
@@ -533,37 +561,20 @@ void BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr)
 void BSP_LCD_DisplayStringLineWSize(uint16_t Line, uint8_t *ptr, uint8_t size)
 { 
   uint32_t i = 0;
-  uint16_t refcolumn;
-	char space[]={" "};
+  uint32_t count;
+  const uint8_t *glyphs[20];
             
-  refcolumn = 0;
   if (size>20) size=20;
 	
 	//LCD_ClearLine(Line);
             
-  /* Send the string character by character on lCD */
-  while (i < size) 
-  {
-    /* Display one character on LCD */
-    BSP_LCD_DisplayChar(Line, refcolumn, *ptr);
-    /* Decrement the column position by deltacolumn(16 or -16 for HX8347D) */
-    refcolumn ++;
-    /* Point on the next character */
-    ptr++;
-    /* Increment the character counter */
-    i++;
+  /* The string padded with spaces up to 20 characters, in a single LCD window */
+  count = min(20, BSP_LCD_GetXSize() / DrawProp.pFont->Width);
+  for(i = 0; i < count; i++)
+  {
+    glyphs[i] = GetGlyph((i < size) ? ptr[i] : ' ');
   }
-	
-	do
-	{
-		/* Display one character on LCD */
-    BSP_LCD_DisplayChar(Line, refcolumn, (uint8_t)(space[0]));
-    /* Decrement the column position by deltacolumn(16 or -16 for HX8347D) */
-    refcolumn ++;
-    /* Increment the character counter */
-    i++;
-	}
-	while(i < 20);
+  DrawGlyphRun(0, Line * DrawProp.pFont->Height, glyphs, count);
 }
 
 /**
@@ -640,7 +651,7 @@ void BSP_LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
   int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
   yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-  curpixel = 0;
+  curpixel = 0, runx = 0, runy = 0, runlength = 0;
   
   deltax = ABS(x2 - x1);        /* The difference between the x's */
   deltay = ABS(y2 - y1);        /* The difference between the y's */
@@ -688,9 +699,15 @@ void BSP_LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
     numpixels = deltay;         /* There are more y-values than x-values */
   }
   
+  /* Pixels are gathered in horizontal (vertical for steep lines) runs, each run is sent as a single burst */
   for (curpixel = 0; curpixel <= numpixels; curpixel++)
   {
-    BSP_LCD_DrawPixel(x, y, DrawProp.TextColor);  /* Draw the current pixel */
+    if (runlength == 0)                       /* Start a new run at the current pixel */
+    {
+      runx = x;
+      runy = y;
+    }
+    runlength++;
     num += numadd;                            /* Increase the numerator by the top of the fraction */
     if (num >= den)                           /* Check if numerator >= denominator */
     {
@@ -700,6 +717,23 @@ void BSP_LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
     }
     x += xinc2;                               /* Change the x as appropriate */
     y += yinc2;                               /* Change the y as appropriate */
+
+    if (deltax >= deltay)                     /* Run ends when y changes, or on the last pixel */
+    {
+      if ((y != runy) || (curpixel == numpixels))
+      {
+        DrawLineRun((xinc2 > 0) ? runx : (runx - runlength + 1), runy, runlength, 0);
+        runlength = 0;
+      }
+    }
+    else                                      /* Run ends when x changes, or on the last pixel */
+    {
+      if ((x != runx) || (curpixel == numpixels))
+      {
+        DrawLineRun(runx, (yinc2 > 0) ? runy : (runy - runlength + 1), runlength, 1);
+        runlength = 0;
+      }
+    }
   }
 }
 
@@ -883,6 +917,57 @@ void BSP_LCD_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t
   BSP_LCD_SetDisplayWindow(0, 0, BSP_LCD_GetXSize(), BSP_LCD_GetYSize());
 }
 
+/**
+  * @brief  Draws a RGB565 picture stored high byte first (as in-house BMP pictures).
+  *         Pixels are byte swapped into a row buffer and sent as whole rows
+  *         (several rows per burst for narrow pictures). The part out of the screen is clipped.
+  * @param  Xpos:   X position in the LCD (in pixels)
+  * @param  Ypos:   Y position in the LCD (in pixels)
+  * @param  Width:  Picture width (in pixels)
+  * @param  Height: Picture height (in pixels)
+  * @param  pData:  Pointer to the pixels, row after row (Width * Height * 2 bytes), no alignment required.
+  * @retval None
+  */
+void BSP_LCD_BlitRGB565BE(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint8_t *pData)
+{
+  uint16_t buffer[ILI9341_LCD_PIXEL_WIDTH];
+  uint16_t *pBuff;
+  const uint8_t *pSrc;
+  uint32_t drawwidth, drawheight, rows, row, col;
+
+  if((Xpos >= BSP_LCD_GetXSize()) || (Ypos >= BSP_LCD_GetYSize()) || (Width == 0) || (Height == 0))
+  {
+    return;
+  }
+  drawwidth  = min(Width, BSP_LCD_GetXSize() - Xpos);
+  drawheight = min(Height, BSP_LCD_GetYSize() - Ypos);
+
+  BSP_LCD_SetDisplayWindow(Xpos, Ypos, drawwidth - 1, drawheight - 1);
+
+  /* As many full rows as the buffer can hold */
+  rows = ILI9341_LCD_PIXEL_WIDTH / drawwidth;
+  while(drawheight > 0)
+  {
+    if(rows > drawheight)
+    {
+      rows = drawheight;
+    }
+    pBuff = buffer;
+    for(row = 0; row < rows; row++)
+    {
+      pSrc = pData;
+      for(col = 0; col < drawwidth; col++)
+      {
+        *(pBuff++) = (uint16_t)((pSrc[0] << 8) | pSrc[1]);
+        pSrc += 2;
+      }
+      pData += 2 * Width;
+    }
+    LCD_IO_WriteBuffer16(buffer, rows * drawwidth);
+    drawheight -= rows;
+  }
+}
+
 /**
   * @brief  Draws a full rectangle.
   * @param  Xpos: X position (in pixels)
@@ -894,6 +979,13 @@ void BSP_LCD_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t
 void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
 {
   BSP_LCD_SetTextColor(DrawProp.TextColor);
+  if((Width > 0) && ((Xpos + Width) <= BSP_LCD_GetXSize()) && ((Ypos + Height) < BSP_LCD_GetYSize()))
+  {
+    /* Rectangle on screen: one window and a single repeated colour for its Height + 1 lines */
+    BSP_LCD_SetDisplayWindow(Xpos, Ypos, Width - 1, Height);
+    LCD_IO_WriteRepeat16(DrawProp.TextColor, (uint32_t)Width * (Height + 1));
+    return;
+  }
   do
   {
     BSP_LCD_DrawHLine(Xpos, Ypos++, Width);    
@@ -1246,56 +1338,34 @@ void BSP_LCD_WindowModeDisable(void)
  */
 void BSP_LCD_WriteBMP_FAT(uint16_t Xpos, uint16_t Ypos, const char* BmpName)
 {
-  uint32_t index = 0, size = 0, width=0, height=0;
-  uint16_t *pBmpWord=0;
-	uint16_t data;
+  uint32_t width=0, height=0;
  
   /* Read bitmap width*/
   width  = BmpName[0]+1; 
   /* Read bitmap height*/
   height = BmpName[1]+1; 
-	/* Read bitmap size */
-	size   = width * height;  /* nb of 16 bits */
 	
-	if (BSP_LCD_SetDisplayWindow(Xpos, Ypos, width-1 , height-1) != LCD_OK)
-	{
-			BSP_LCD_WindowModeDisable();
-			return;
-	}
-
-	pBmpWord = (uint16_t *) (&BmpName[5]);
-	/* Send them on the screen */
-	for(index = 0; index < size; index++)
-	{
-		data = (*pBmpWord & 0xFF00)>>8;
-		data += (*pBmpWord & 0x00FF)<<8;
-		
-    BSP_LCD_DrawPixel( ILI9341_NO_CURSOR, ILI9341_NO_CURSOR, data );
-		pBmpWord++;
-	} 
+	/* Pixels are stored high byte first */
+	BSP_LCD_BlitRGB565BE(Xpos, Ypos, width, height, (const uint8_t *)&BmpName[5]);
 
 	BSP_LCD_WindowModeDisable();
 }
 
-typedef struct RGB
-{
-  uint8_t B;
-  uint8_t G;
-  uint8_t R;
-}RGB_typedef;
-RGB_typedef *RGB_matrix;
-
-
-/* This structure is used to control picture cropping (to only display part of big pictures, fitting the LCD screen dimensions) */
+/* This structure is used to place JPEG pictures on the LCD (scaled down and cropped to fit the requested area) */
 static struct {
-  uint32_t factor;        /* Only display one out of <factor> pixels. */
-  uint32_t line_counter;  /* Count the line position, as the information is not provided by the libJPEG. */
-  uint32_t first_row;     /* Used to center the crop. */
-  uint32_t first_col;     /* Used to center the crop. */
-  uint32_t last_row;     /* Used to center the crop. */
-  uint32_t last_col;     /* Used to center the crop. */
+  uint16_t Xpos;        /* LCD position of the picture. */
+  uint16_t Ypos;
+  uint16_t max_width;   /* LCD area available for the picture. */
+  uint16_t max_height;
+  uint16_t first_col;   /* Crop origin in the picture, when not fitting. */
+  uint16_t first_row;
+  uint8_t  fit;         /* 1: scale down and center the picture in the area, 0: crop at full scale from first_col/first_row. */
 } crop;
 
+/* RGB565 color of each grey level, when grey scale is enabled */
+static uint16_t GreyScaleLut[256];
+static uint8_t  GreyScaleLutReady;
+
 
 uint16_t BSP_LCD_FadeColor(uint16_t startColor, uint16_t endColor,int  nbSteps,int  currentStep)
 {
@@ -1316,62 +1386,230 @@ uint16_t BSP_LCD_FadeColor(uint16_t startColor, uint16_t endColor,int  nbSteps,i
   return returnColor;
 }
 
-static uint16_t BSP_LCD_ConvertToGreyScale(uint8_t b, uint8_t g, uint8_t r)
+/**
+  * @brief  Gets the grey scale palette, built on first use.
+  * @retval 256 entries RGB565 table, indexed by the picture luma.
+  */
+static const uint16_t *BSP_LCD_GetGreyScaleLut(void)
 {
-  uint16_t greyValue = (1 * r + 1 * g + 1 * b) / 3;
+  uint32_t level;
 
-  return BSP_LCD_FadeColor( LCD_COLOR_GRAY, LCD_COLOR_WHITE, 255, greyValue);
+  if(!GreyScaleLutReady)
+  {
+    for(level = 0; level < 256; level++)
+    {
+      GreyScaleLut[level] = BSP_LCD_FadeColor( LCD_COLOR_GRAY, LCD_COLOR_WHITE, 255, level);
+    }
+    GreyScaleLutReady = 1;
+  }
+  return GreyScaleLut;
 }
 
 /**
-  * @brief  Draws a 24 Bytes Pixel Line on LCD.
-  * @param  Row: pointer to the row to draw.
-  * @param  DataLength: length of data.
-  * @retval 0 when finish.
+  * @brief  JPEG decoder setup callback: selects the DCT scaling and the output window, and sets the LCD window.
+  * @param  Width: picture width.
+  * @param  Height: picture height.
+  * @param  Window: output window to fill.
+  * @retval 0 to go on with the decoding.
   */
-static uint8_t BSP_LCD_Write24BPixelLine(uint8_t* Row, uint32_t DataLength)
+static uint8_t BSP_LCD_JpegSetup(uint32_t Width, uint32_t Height, jpeg_window_t *Window)
 {
-   
-  RGB_matrix =  (RGB_typedef*)Row;
-  uint16_t  ARGB32Buffer[320];
-  uint32_t counter = 0;
-  uint32_t width =  DataLength / 3;
-  uint32_t crop_width = 0;
-  
-  if(((crop.line_counter % crop.factor) != 0) ||  /* If crop factor is > 1, bypass some lines */
-    (crop.line_counter < crop.first_row) ||       /* Bypass the first picture rows, to center the crop */
-    (crop.line_counter >= crop.last_row))         /* Bypass the last picture rows, to center the crop */
+  uint32_t scaled_width;
+  uint32_t scaled_height;
+
+  Window->scale_num = 8;
+  if(crop.fit)
+  {
+    /* Smallest scaling still covering the area in both directions (no white band) */
+    while((Window->scale_num > 1) &&
+          (JPEG_SCALED_SIZE(Width, Window->scale_num - 1) >= crop.max_width) &&
+          (JPEG_SCALED_SIZE(Height, Window->scale_num - 1) >= crop.max_height))
+    {
+      Window->scale_num--;
+    }
+    scaled_width = JPEG_SCALED_SIZE(Width, Window->scale_num);
+    scaled_height = JPEG_SCALED_SIZE(Height, Window->scale_num);
+
+    /* Center the crop on the picture */
+    Window->width = scaled_width > crop.max_width ? crop.max_width : scaled_width;
+    Window->height = scaled_height > crop.max_height ? crop.max_height : scaled_height;
+    Window->first_col = (scaled_width - Window->width) / 2;
+    Window->first_row = (scaled_height - Window->height) / 2;
+  }
+  else
+  {
+    if((crop.first_col >= Width) || (crop.first_row >= Height))
+    {
+      return 1;
+    }
+    Window->first_col = crop.first_col;
+    Window->first_row = crop.first_row;
+    Window->width = (Width - crop.first_col) > crop.max_width ? crop.max_width : (Width - crop.first_col);
+    Window->height = (Height - crop.first_row) > crop.max_height ? crop.max_height : (Height - crop.first_row);
+  }
+  Window->grey_lut = enableGreyScale ? BSP_LCD_GetGreyScaleLut() : NULL;
+
+  BSP_LCD_SetDisplayWindow(crop.Xpos, crop.Ypos, Window->width - 1, Window->height - 1);
+  return 0;
+}
+
+/**
+  * @brief  JPEG decoder output callback: draws a strip of RGB565 pixels in the LCD window.
+  * @param  Pixels: RGB565 pixels, window rows one after the other.
+  * @param  NbPixels: number of pixels.
+  * @retval 0 to go on with the decoding.
+  */
+static uint8_t BSP_LCD_WriteJpegStrip(uint16_t *Pixels, uint32_t NbPixels)
+{
+  LCD_IO_WriteBuffer16(Pixels, NbPixels);
+  return 0;
+}
+
+/**
+  * @brief  Colour of an RGB565 picture pixel, mapped to the grey scale palette when enabled.
+  * @param  Color: RGB565 pixel.
+  * @param  GreyLut: grey scale palette, NULL for colour display.
+  * @retval Displayed colour.
+  */
+static uint16_t BSP_LCD_PictColor(uint16_t Color, const uint16_t *GreyLut)
+{
+  uint32_t red, green, blue;
+
+  if(GreyLut == NULL)
+  {
+    return Color;
+  }
+  /* Luma of the 8 bits components, as decoded from a JPEG picture */
+  red   = ((Color >> 8) & 0xF8) | (Color >> 13);
+  green = ((Color >> 3) & 0xFC) | ((Color >> 9) & 0x03);
+  blue  = ((Color << 3) & 0xF8) | ((Color >> 2) & 0x07);
+  return GreyLut[((red * 77) + (green * 150) + (blue * 29)) >> 8];
+}
+
+/**
+  * @brief  Sends RGB565 picture pixels to the LCD window.
+  *         Half-word aligned pixels are sent by DMA straight from the flash, otherwise
+  *         (or in grey scale) they are copied through a buffer.
+  * @param  pData: pixels, 16 bits words stored low byte first.
+  * @param  NbPixels: number of pixels.
+  * @param  GreyLut: grey scale palette, NULL for colour display.
+  * @retval None
+  */
+static void BSP_LCD_WritePictPixels(const uint8_t *pData, uint32_t NbPixels, const uint16_t *GreyLut)
+{
+  uint16_t buffer[ILI9341_LCD_PIXEL_WIDTH];
+  uint32_t chunk, i;
+
+  if((GreyLut == NULL) && (((uintptr_t)pData & 1U) == 0U))
   {
-    crop.line_counter++;
-    return 0; 
+    LCD_IO_WriteConstBuffer16((const uint16_t *)pData, NbPixels);
+    return;
+  }
+  while(NbPixels > 0)
+  {
+    chunk = min(NbPixels, ILI9341_LCD_PIXEL_WIDTH);
+    for(i = 0; i < chunk; i++)
+    {
+      buffer[i] = BSP_LCD_PictColor((uint16_t)(pData[0] | (pData[1] << 8)), GreyLut);
+      pData += 2;
+    }
+    LCD_IO_WriteBuffer16(buffer, chunk);
+    NbPixels -= chunk;
+  }
+}
+
+/**
+  * @brief  Draws an RGB565 picture (see IS_RGB565_PICT): pixels are sent as they are stored,
+  *         a run of a RLE picture is sent as a colour fill. The part out of the area
+  *         or of the screen is clipped.
+  * @param  Xpos: X position in the LCD (in pixels).
+  * @param  Ypos: Y position in the LCD (in pixels).
+  * @param  MaxWidth: maximum display width.
+  * @param  MaxHeight: maximum display height.
+  * @Param  Pict: pointer to the picture data.
+  * @retval None
+  */
+static void BSP_LCD_DrawRGB565Pict(uint16_t Xpos, uint16_t Ypos, uint16_t MaxWidth, uint16_t MaxHeight, const char* Pict)
+{
+  const uint8_t  *pict = (const uint8_t *)Pict;
+  const uint8_t  *pData = pict + LCD_PICT_HEADER_SIZE;
+  const uint8_t  *pEnd;
+  const uint16_t *lut = enableGreyScale ? BSP_LCD_GetGreyScaleLut() : NULL;
+  uint32_t width  = pict[6] | (pict[7] << 8);
+  uint32_t height = pict[8] | (pict[9] << 8);
+  uint32_t drawwidth, drawheight, pos, last, col, count, n;
+  uint16_t word, color = 0;
+  uint8_t  run = 0;
+
+  if((Xpos >= BSP_LCD_GetXSize()) || (Ypos >= BSP_LCD_GetYSize()))
+  {
+    return;
+  }
+  drawwidth  = min(min(width, MaxWidth), BSP_LCD_GetXSize() - Xpos);
+  drawheight = min(min(height, MaxHeight), BSP_LCD_GetYSize() - Ypos);
+  if((drawwidth == 0) || (drawheight == 0))
+  {
+    return;
   }
-  crop.line_counter++;
+  BSP_LCD_SetDisplayWindow(Xpos, Ypos, drawwidth - 1, drawheight - 1);
 
-  for(counter = 0; counter < width; counter++)
+  pEnd = pData + 2 * (pict[12] | (pict[13] << 8) | (pict[14] << 16) | ((uint32_t)pict[15] << 24));
+  pos  = 0;
+  last = drawheight * width;
+  while((pData < pEnd) && (pos < last))
   {
-    if ((counter % crop.factor) ||      /* If crop factor is > 1, bypass some columns */
-         (counter < crop.first_col) ||  /* Bypass the first columns, to center the crop */
-          (counter >= crop.last_col))   /* Bypass the last columns, to center the crop */
-    {    
-      continue;
+    if(pict[4] == LCD_PICT_FORMAT_RLE)
+    {
+      word   = (uint16_t)(pData[0] | (pData[1] << 8));
+      pData += 2;
+      run    = ((word & LCD_PICT_RLE_RUN) != 0);
+      count  = (word & ~LCD_PICT_RLE_RUN) + 1;
+      if(run)
+      {
+        color  = BSP_LCD_PictColor((uint16_t)(pData[0] | (pData[1] << 8)), lut);
+        pData += 2;
+      }
+    }
+    else
+    {
+      count = (pEnd - pData) / 2;
     }
 
-    if(enableGreyScale)
+    /* Packets go across the rows: they are only split where columns are clipped */
+    while((count > 0) && (pos < last))
+    {
+      col = pos % width;
+      if(drawwidth == width)
+      {
+        n = min(count, last - pos);
+      }
+      else
+      {
+        n = min(count, ((col < drawwidth) ? drawwidth : width) - col);
+      }
+      if(col < drawwidth)
+      {
+        if(run)
+        {
+          LCD_IO_WriteRepeat16(color, n);
+        }
+        else
+        {
+          BSP_LCD_WritePictPixels(pData, n, lut);
+        }
+      }
+      if(!run)
+      {
+        pData += 2 * n;
+      }
+      pos   += n;
+      count -= n;
+    }
+    if(!run)
     {
-      ARGB32Buffer[crop_width]  = BSP_LCD_ConvertToGreyScale(RGB_matrix[counter].R, RGB_matrix[counter].G,RGB_matrix[counter].B);
-//      ARGB32Buffer[crop_width]  = LCD_COLOR_BLUE;
-    } else {
-      ARGB32Buffer[crop_width]  = (uint16_t)
-      (
-      (((RGB_matrix[counter].B >> 3)<<11)|
-        ((RGB_matrix[counter].G >> 2)<<5)|
-        (RGB_matrix[counter].R >> 3))
-      );
+      pData += 2 * count;
     }
-    crop_width++;
   }
-  LCD_IO_WriteBuffer16(ARGB32Buffer,crop_width);
-  return 0;
 }
 
 /**
@@ -1388,6 +1626,9 @@ void BSP_LCD_GetPictureDim(const char * Pict, uint32_t* Width, uint32_t* Height)
 		// JPEG
 		jpeg_getsize(Pict,Width,Height);
 		
+	} else if(IS_RGB565_PICT(Pict)) {
+    *Width = (uint8_t)Pict[6] | ((uint8_t)Pict[7] << 8);
+    *Height = (uint8_t)Pict[8] | ((uint8_t)Pict[9] << 8);
 	} else {
 		// Assume it's in-house BMP
 		*Width = Pict[0];
@@ -1410,57 +1651,19 @@ uint32_t BSP_LCD_DisplayCropPicture(uint16_t Xpos, uint16_t Ypos, uint16_t cropX
 {
 	if(IS_JPEG(Pict))
 	{
-		// JPEG
-		uint32_t w,h;
-		jpeg_getsize(Pict,&w,&h);
-
-    /* Set default values to the crop settings. => no crop required*/
-    crop.factor = 1;
-    crop.first_row = 0;
-    crop.first_col = 0;
-    crop.last_col = w;
-    crop.last_row = h;
-    crop.line_counter = 0;
-
-    /* Picture is too big: need to crop it. */
-    if((w > cropX) || (h > cropY))
-    {
-      /* Compute croping factor */
-      uint32_t x_factor = w / cropX;
-      uint32_t y_factor = h / cropY;
-      /* Select smaller factor to use the whole LCD (no white band) */
-      crop.factor = x_factor > y_factor ? y_factor : x_factor;
-      /* Just for safety: should never happen. */
-      crop.factor = crop.factor == 0 ? 1 : crop.factor;
-      
-      /* Compute number of pixels for the cropped picture */
-      uint32_t crop_x_length = crop.factor * cropX;
-      uint32_t crop_y_length = crop.factor * cropY;
-      /* Compute crop margins to center the crop on the picture */
-      if(h > crop_y_length)
-      {
-        crop.first_row = (h - crop_y_length)/2;
-        crop.last_row = crop.first_row + crop_y_length;
-      }
-      if(w > crop_x_length)
-      {
-        crop.first_col = (w - crop_x_length)/2;
-        crop.last_col = crop.first_col + crop_x_length;
-      }
-    }
-
-    uint16_t winX = (w/crop.factor);
-    uint16_t winY = (h/crop.factor);
-    if(winX > cropX)
-      winX = cropX;
-    if(winY > cropY)
-      winY = cropY;
-
-//		BSP_LCD_SetDisplayWindow(Xpos, Ypos, (w/crop.factor)-1 , (h/crop.factor)-1);
-		BSP_LCD_SetDisplayWindow(Xpos, Ypos, winX-1 , winY-1);
+    /* The picture is scaled down with the DCT when bigger than the area, then center cropped */
+    crop.fit = 1;
+    crop.Xpos = Xpos;
+    crop.Ypos = Ypos;
+    crop.max_width = cropX;
+    crop.max_height = cropY;
 
 		// Display on LCD
-		return jpeg_decode(Pict,BSP_LCD_Write24BPixelLine);
+		return jpeg_decode(Pict, BSP_LCD_JpegSetup, BSP_LCD_WriteJpegStrip);
+	} else if(IS_RGB565_PICT(Pict)) {
+    /* Pre-converted picture, no decoding: the top left part is displayed when bigger than the area */
+    BSP_LCD_DrawRGB565Pict(Xpos, Ypos, cropX, cropY, Pict);
+    return 0;
 	} else {
 		// Assume it's in-house BMP
 		BSP_LCD_WriteBMP_FAT(Xpos, Ypos, Pict);
@@ -1479,26 +1682,19 @@ uint32_t BSP_LCD_DisplayCropPicture(uint16_t Xpos, uint16_t Ypos, uint16_t cropX
   */
 uint32_t BSP_LCD_DisplayCropJpeg(pPoint PictPos, pPoint PictCropPos, uint16_t CropWidth, uint16_t CropHeight, const char* Pict)
 {
-  uint32_t w,h;
-  
   if(IS_JPEG(Pict))
-	{
-		jpeg_getsize(Pict, &w, &h);
-    
-    /* Set default values to the crop settings. */
-    crop.factor = 1;
-    crop.first_row = PictCropPos->Y;
+  {
+    crop.fit = 0;
+    crop.Xpos = PictPos->X;
+    crop.Ypos = PictPos->Y;
     crop.first_col = PictCropPos->X;
-    crop.last_col = PictCropPos->X + CropWidth;
-    crop.last_row = PictCropPos->Y + CropHeight;
-    crop.line_counter = 0;
-    
-    BSP_LCD_SetDisplayWindow(PictPos->X, PictPos->Y, CropWidth-1, CropHeight-1);
+    crop.first_row = PictCropPos->Y;
+    crop.max_width = CropWidth;
+    crop.max_height = CropHeight;
 
     // Display on LCD
-    jpeg_decode(Pict,BSP_LCD_Write24BPixelLine);
-    
-	} 
+    jpeg_decode(Pict, BSP_LCD_JpegSetup, BSP_LCD_WriteJpegStrip);
+  }
 
   return 0;
 }
@@ -1524,26 +1720,156 @@ void BSP_LCD_SetGreyScale(uint8_t enable)
                             Static Function
 *******************************************************************************/
 
+/* Text run pixels, sent to the LCD window band by band */
+static uint16_t TextRunBuffer[LCD_TEXT_RUN_BUFFER_SIZE];
+
+/* Expanded glyph cache, a slot holds one glyph of one font for one color pair */
+static struct {
+  const sFONT    *font;
+  const uint8_t  *glyph;
+  uint16_t        TextColor;
+  uint16_t        BackColor;
+  uint32_t        run;          /* Last text run using the slot, not evicted during that run. */
+  uint16_t        pixels[LCD_GLYPH_CACHE_SLOT_SIZE];
+} GlyphCache[LCD_GLYPH_CACHE_SLOTS];
+static uint32_t GlyphCacheRun;
+
 /**
-  * @brief  Draws a character on LCD.
+  * @brief  Gets the character data of the current font.
+  * @param  Ascii: Character ascii code, out of 0x20..0x7E displayed as a space.
+  * @retval Pointer to the character data
+  */
+static const uint8_t *GetGlyph(uint8_t Ascii)
+{
+  if(Ascii < ' ' || Ascii > '~')
+  {
+    Ascii = ' ';
+  }
+  return &DrawProp.pFont->table[(Ascii-' ') *\
+  DrawProp.pFont->Height * ((DrawProp.pFont->Width + 7) / 8)];
+}
+
+/**
+  * @brief  Expands one row of a character to RGB565 pixels.
+  * @param  pchar: Pointer to the row in the character data.
+  * @param  width: Character width (in pixels).
+  * @param  pBuff: Pixels output, width pixels.
+  * @retval None
+  */
+static void ExpandGlyphRow(const uint8_t *pchar, uint16_t width, uint16_t *pBuff)
+{
+  uint32_t j;
+  uint32_t line;
+  uint32_t mask;
+  
+  switch(((width + 7)/8))
+  {
+  case 1:
+    line =  pchar[0];
+    break;    
+
+  case 2:
+    line =  (pchar[0]<< 8) | pchar[1];
+    break;
+    
+  case 3:
+    line =  (pchar[0]<< 16) | (pchar[1]<< 8) | pchar[2];
+    break;
+  
+  case 4:
+  default:
+    line =  ((uint32_t)pchar[0]<< 24) | (pchar[1]<< 16) | (pchar[2]<< 8) | pchar[3];
+    break;
+  }  
+  
+  /* Pixels are MSB first, the row is padded to a byte boundary on the right */
+  mask = 1UL << (8 * ((width + 7)/8) - 1);
+  for (j = 0; j < width; j++)
+  {
+    *(pBuff++) = (line & mask) ? DrawProp.TextColor : DrawProp.BackColor;
+    mask >>= 1;
+  }
+}
+
+/**
+  * @brief  Gets a character expanded with the current font and colors from the glyph cache.
+  * @param  c: Pointer to the character data.
+  * @retval Width x Height pixels, NULL when the character cannot be cached.
+  */
+static const uint16_t *GlyphCacheLookup(const uint8_t *c)
+{
+  const sFONT *font = DrawProp.pFont;
+  uint32_t bytes = (font->Width + 7)/8;
+  uint32_t i, slot, victim;
+
+  /* Only characters of the font table: the data of BSP_LCD_DrawChar may be anywhere */
+  if( (font->Width * font->Height > LCD_GLYPH_CACHE_SLOT_SIZE) ||
+      (c < font->table) || (c >= font->table + ('~' - ' ' + 1) * font->Height * bytes) )
+  {
+    return NULL;
+  }
+
+  for(slot = 0; slot < LCD_GLYPH_CACHE_SLOTS; slot++)
+  {
+    if( (GlyphCache[slot].glyph == c) && (GlyphCache[slot].font == font) &&
+        (GlyphCache[slot].TextColor == DrawProp.TextColor) && (GlyphCache[slot].BackColor == DrawProp.BackColor) )
+    {
+      GlyphCache[slot].run = GlyphCacheRun;
+      return GlyphCache[slot].pixels;
+    }
+  }
+
+  /* Miss: replace the least recently used slot, unless all of them are used by the current run */
+  victim = 0;
+  for(slot = 1; slot < LCD_GLYPH_CACHE_SLOTS; slot++)
+  {
+    if((GlyphCacheRun - GlyphCache[slot].run) > (GlyphCacheRun - GlyphCache[victim].run))
+    {
+      victim = slot;
+    }
+  }
+  if(GlyphCache[victim].run == GlyphCacheRun)
+  {
+    return NULL;
+  }
+  slot = victim;
+
+  for(i = 0; i < font->Height; i++)
+  {
+    ExpandGlyphRow(c + bytes * i, font->Width, &GlyphCache[slot].pixels[font->Width * i]);
+  }
+  GlyphCache[slot].font      = font;
+  GlyphCache[slot].glyph     = c;
+  GlyphCache[slot].TextColor = DrawProp.TextColor;
+  GlyphCache[slot].BackColor = DrawProp.BackColor;
+  GlyphCache[slot].run       = GlyphCacheRun;
+  return GlyphCache[slot].pixels;
+}
+
+/**
+  * @brief  Draws characters side by side on LCD, in a single window.
   * @param  Xpos: specifies the X position (in pixels).
   * @param  Ypos: specifies the Y position (in pixels).
-  * @param  c: Pointer to the character data
+  * @param  Glyphs: Pointers to the character data
+  * @param  Count: Number of characters (max TEXT_RUN_MAX_GLYPHS)
   * @retval None
   */
-static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
+static void DrawGlyphRun(uint16_t Xpos, uint16_t Ypos, const uint8_t * const *Glyphs, uint32_t Count)
 {
-  uint32_t i = 0, j = 0;
-  uint16_t height, width;
-  uint8_t offset;
-  uint8_t *pchar;
-  uint32_t line;
+  const uint16_t *expanded[TEXT_RUN_MAX_GLYPHS];
+  uint32_t i, k, n;
+  uint32_t runwidth, bandrows;
+  uint16_t height, width, bytes;
   uint16_t *pBuff;
-// Font limit for this function: font36 36 pixels x 25 pixels
-  uint16_t buffer[36*25];
 
   height = DrawProp.pFont->Height;
   width  = DrawProp.pFont->Width;
+  bytes  = (width + 7)/8;
+  runwidth = width * Count;
+  if( (Count == 0) || (Count > TEXT_RUN_MAX_GLYPHS) || (runwidth > LCD_TEXT_RUN_BUFFER_SIZE) )
+  {
+    return;
+  }
   
   /* overhead, Ystart & Yend are used as a workaround when the screen height is not a multiple of the font height,
      the last line is being croped.
@@ -1555,55 +1881,85 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
   {
     Ystart += overhead / 2;
     Yend -= overhead / 2 +  (overhead % 2);
-  } else {
-    // if overhead is negative -> no overhead at all
-    overhead = 0;
   }
 
-  pBuff = buffer;
+  /* Cached characters are copied, the others are expanded row by row */
+  GlyphCacheRun++;
+  for(k = 0; k < Count; k++)
+  {
+    expanded[k] = GlyphCacheLookup(Glyphs[k]);
+  }
 
-  BSP_LCD_SetCursor( Xpos, Ypos );
+  BSP_LCD_SetDisplayWindow(Xpos, Ypos, runwidth - 1, (Yend - Ystart) - 1);
 
-  offset =  8 *((width + 7)/8) -  width ;
-  
-  for(i = Ystart; i < (Yend); i++)
+  bandrows = LCD_TEXT_RUN_BUFFER_SIZE / runwidth;
+  for(i = Ystart; i < Yend; )
   {
-    pchar = ((uint8_t *)c + (width + 7)/8 * i);
-    
-    switch(((width + 7)/8))
-    {
-    case 1:
-      line =  pchar[0];
-      break;    
-
-    case 2:
-      line =  (pchar[0]<< 8) | pchar[1];
-      break;
-      
-    case 3:
-      line =  (pchar[0]<< 16) | (pchar[1]<< 8) | pchar[2];
-      break;
-    
-    case 4:
-    default:
-      line =  (pchar[0]<< 24) | (pchar[1]<< 16) | (pchar[2]<< 8) | pchar[3];
-      break;
-    }  
-    
-    for (j = 0; j < width; j++)
+    pBuff = TextRunBuffer;
+    for(n = 0; (n < bandrows) && (i < Yend); n++, i++)
     {
-      if(line & (1 << (width- j + offset- 1))) 
+      for(k = 0; k < Count; k++)
       {
-        *(pBuff++) = DrawProp.TextColor;
+        if(expanded[k] != NULL)
+        {
+          memcpy(pBuff, &expanded[k][width * i], width * sizeof(uint16_t));
+        }
+        else
+        {
+          ExpandGlyphRow(Glyphs[k] + bytes * i, width, pBuff);
+        }
+        pBuff += width;
       }
-      else
-      {
-        *(pBuff++) = DrawProp.BackColor;
-
-      } 
     }
+    LCD_IO_WriteBuffer16(TextRunBuffer, pBuff - TextRunBuffer);
+  }
+}
+
+/**
+  * @brief  Draws a character on LCD.
+  * @param  Xpos: specifies the X position (in pixels).
+  * @param  Ypos: specifies the Y position (in pixels).
+  * @param  c: Pointer to the character data
+  * @retval None
+  */
+static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
+{
+  DrawGlyphRun(Xpos, Ypos, &c, 1);
+}
+
+/**
+  * @brief  Draws a run of line pixels with a single window burst, clipped to the screen.
+  * @param  Xpos: Run first X position (in pixels), may be negative
+  * @param  Ypos: Run first Y position (in pixels), may be negative
+  * @param  Length: Run length (in pixels)
+  * @param  Vertical: 0 for an horizontal run, 1 for a vertical one
+  * @retval None
+  */
+static void DrawLineRun(int32_t Xpos, int32_t Ypos, int32_t Length, uint8_t Vertical)
+{
+  int32_t *start = Vertical ? &Ypos : &Xpos;
+  int32_t  size  = (int32_t)(Vertical ? BSP_LCD_GetYSize() : BSP_LCD_GetXSize());
+
+  /* A run going left/up may start before the screen edge: keep its visible part */
+  if(*start < 0)
+  {
+    Length += *start;
+    *start  = 0;
+  }
+  if((Length <= 0) || (Xpos < 0) || (Ypos < 0) ||
+     (Xpos >= (int32_t)BSP_LCD_GetXSize()) || (Ypos >= (int32_t)BSP_LCD_GetYSize()))
+  {
+    return;
+  }
+  Length = min(Length, size - *start);
+  if(Vertical)
+  {
+    BSP_LCD_DrawVLine((uint16_t)Xpos, (uint16_t)Ypos, (uint16_t)Length);
+  }
+  else
+  {
+    BSP_LCD_DrawHLine((uint16_t)Xpos, (uint16_t)Ypos, (uint16_t)Length);
   }
-  LCD_IO_WriteBuffer16(buffer, width * (height - overhead));
 }
 
 /**
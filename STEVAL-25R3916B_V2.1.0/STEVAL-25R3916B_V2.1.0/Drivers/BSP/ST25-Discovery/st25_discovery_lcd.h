@@ -158,6 +158,39 @@ typedef enum
   */ 
 #define LCD_DEFAULT_FONT         Font22
 
+/** 
+  * @brief LCD text rendering: a string is drawn as one window, its pixels are
+  *        sent band by band from a buffer of LCD_TEXT_RUN_BUFFER_SIZE pixels
+  *        (at least one screen row). Expanded glyphs (one font, one color pair)
+  *        are kept in LCD_GLYPH_CACHE_SLOTS slots of LCD_GLYPH_CACHE_SLOT_SIZE
+  *        pixels, larger fonts are expanded on the fly.
+  */ 
+#ifndef LCD_TEXT_RUN_BUFFER_SIZE
+#define LCD_TEXT_RUN_BUFFER_SIZE   2048
+#endif
+#ifndef LCD_GLYPH_CACHE_SLOTS
+#define LCD_GLYPH_CACHE_SLOTS      8
+#endif
+#ifndef LCD_GLYPH_CACHE_SLOT_SIZE
+#define LCD_GLYPH_CACHE_SLOT_SIZE  (11 * 16)   /* Font16 */
+#endif
+
+/** 
+  * @brief RGB565 pictures, made from JPEG pictures by Utilities/PictureConverter
+  *        and displayed without decoding. A 16 bytes header:
+  *        "R565", format, 0, width (2 bytes), height (2 bytes), 0, 0, number of
+  *        16 bits data words (4 bytes), all little endian, then the data words:
+  *        - LCD_PICT_FORMAT_RAW: the pixels, row after row.
+  *        - LCD_PICT_FORMAT_RLE: packets of a count word and the pixels (count + 1 pixels),
+  *          or of a count word with LCD_PICT_RLE_RUN set and one colour (repeated count + 1 times).
+  *        The array must be half-word aligned to be sent by DMA straight from the flash.
+  */ 
+#define LCD_PICT_HEADER_SIZE     16
+#define LCD_PICT_FORMAT_RAW      0x00
+#define LCD_PICT_FORMAT_RLE      0x01
+#define LCD_PICT_RLE_RUN         0x8000
+#define IS_RGB565_PICT(ptr)      (((ptr)[0] == 'R') && ((ptr)[1] == '5') && ((ptr)[2] == '6') && ((ptr)[3] == '5'))
+
 /** 
   * @brief  LCD Direction  
   */ 
@@ -218,6 +251,7 @@ void BSP_LCD_DrawPolygon(pPoint Points, uint16_t PointCount);
 void BSP_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
 void BSP_LCD_DrawBitmap(uint16_t Xpos, uint16_t Ypos, uint8_t *pbmp);
 void BSP_LCD_DrawRGBImage(uint16_t Xpos, uint16_t Ypos, uint16_t Xsize, uint16_t Ysize, uint8_t *pbmp);
+void BSP_LCD_BlitRGB565BE(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint8_t *pData);
 void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 void BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount);
@@ -232,7 +266,8 @@ void BSP_LCD_DisplayOn(void);
 // Picture display
 void BSP_LCD_DisplayPicture(uint16_t Xpos, uint16_t Ypos, const char* Pict);
 void BSP_LCD_GetPictureDim(const char * Pict, uint32_t* Width, uint32_t* Height);
-void BSP_LCD_CaptureScreen(void);
+uint8_t BSP_LCD_CaptureScreen(void);
+uint8_t BSP_LCD_ReadRegion(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint8_t *pData);
 uint32_t BSP_LCD_DisplayCropPicture(uint16_t Xpos, uint16_t Ypos, uint16_t cropX, uint16_t cropY, const char* Pict);
 uint32_t BSP_LCD_DisplayCropJpeg(pPoint PictOrig, pPoint PictCrop, uint16_t CropWidth, uint16_t CropHeight, const char* Pict);
 
@@ -1981,6 +1981,96 @@ int32_t BSP_NFCTAG_ReadMBLength_Dyn(const uint32_t Instance, uint8_t *const pMBL
   return ret_value;
 }
 
+/**
+  * @brief  Starts reading data in the nfctag user memory, returns without waiting.
+  * @param  pData : pointer to store read data, untouched until the end of the read
+  * @param  TarAddr : I2C data memory address to read
+  * @param  Size : Size in bytes of the value to be read
+  * @param  Callback : called from the interrupts with the NFCTAG status at the end of the read, or NULL
+  * @retval NFCTAG enum status
+  */
+int32_t BSP_NFCTAG_ReadDataAsync(const uint32_t Instance, uint8_t *const pData, const uint16_t TarAddr, \
+                                 const uint32_t Size, NFCMEM_IO_Callback_t Callback)
+{
+  UNUSED(Instance);
+  return NFCMEM_IO_MemReadAsync(NFCMEM_DATA_I2C_ADDR, TarAddr, pData, Size, Callback);
+}
+
+/**
+  * @brief  Starts writing data in the nfctag user memory, returns without waiting.
+  * @note   The write is cut at the page boundaries, the write cycles are polled from the interrupts.
+  * @param  pData : pointer to the data to write, unchanged until the end of the write
+  * @param  TarAddr : I2C data memory address to write
+  * @param  Size : Size in bytes of the value to be written
+  * @param  Callback : called from the interrupts with the NFCTAG status at the end of the write, or NULL
+  * @retval NFCTAG enum status
+  */
+int32_t BSP_NFCTAG_WriteDataAsync(const uint32_t Instance, const uint8_t *const pData, const uint16_t TarAddr, \
+                                  const uint32_t Size, NFCMEM_IO_Callback_t Callback)
+{
+  UNUSED(Instance);
+  return NFCMEM_IO_MemWriteAsync(NFCMEM_DATA_I2C_ADDR, TarAddr, pData, Size, Callback);
+}
+
+/**
+  * @brief  Starts reading N bytes of data from the Mailbox, returns without waiting.
+  * @param  pData   Pointer on the buffer used to return the read data.
+  * @param  Offset  Offset in the Mailbox memory, byte number to start the read.
+  * @param  NbByte  Number of bytes to be read.
+  * @param  Callback Called from the interrupts with the NFCTAG status at the end of the read, or NULL.
+  * @return int32_t enum status.
+  */
+int32_t BSP_NFCTAG_ReadMailboxDataAsync(const uint32_t Instance, uint8_t *const pData, const uint16_t Offset, \
+                                        const uint16_t NbByte, NFCMEM_IO_Callback_t Callback)
+{
+  UNUSED(Instance);
+  if((Offset + NbByte) > ST25DV_MAX_MAILBOX_LENGTH)
+  {
+    return NFCTAG_ERROR;
+  }
+  
+  return NFCMEM_IO_MemReadAsync(NFCMEM_DATA_I2C_ADDR, ST25DV_MAILBOX_RAM_REG + Offset, pData, NbByte, Callback);
+}
+
+/**
+  * @brief  Starts writing N bytes of data in the Mailbox from the first Mailbox Address, returns without waiting.
+  * @param  pData   Pointer to the buffer containing the data to be written.
+  * @param  NbByte  Number of bytes to be written.
+  * @param  Callback Called from the interrupts with the NFCTAG status at the end of the write, or NULL.
+  * @return int32_t enum status.
+  */
+int32_t BSP_NFCTAG_WriteMailboxDataAsync(const uint32_t Instance, const uint8_t *const pData, const uint16_t NbByte, \
+                                         NFCMEM_IO_Callback_t Callback)
+{
+  UNUSED(Instance);
+  if(NbByte > ST25DV_MAX_MAILBOX_LENGTH)
+  {
+    return NFCTAG_ERROR;
+  }
+  
+  return NFCMEM_IO_MemWriteAsync(NFCMEM_DATA_I2C_ADDR, ST25DV_MAILBOX_RAM_REG, pData, NbByte, Callback);
+}
+
+/**
+  * @brief  Checks if an asynchronous nfctag transfer is running.
+  * @return 1 while the transfer is running, 0 otherwise.
+  */
+uint8_t BSP_NFCTAG_IsBusy(const uint32_t Instance)
+{
+  UNUSED(Instance);
+  return NFCMEM_IO_IsBusy();
+}
+
+/**
+  * @brief  Waits for the end of the asynchronous nfctag transfer.
+  * @return int32_t enum status of the transfer.
+  */
+int32_t BSP_NFCTAG_WaitTransfer(const uint32_t Instance)
+{
+  UNUSED(Instance);
+  return NFCMEM_IO_Wait();
+}
+
 
 
 /**
@@ -166,6 +166,16 @@ int32_t BSP_NFCTAG_GetMBEN_Dyn(const uint32_t Instance, void *const pMBEN);
 int32_t BSP_NFCTAG_SetMBEN_Dyn(const uint32_t Instance);
 int32_t BSP_NFCTAG_ResetMBEN_Dyn(const uint32_t Instance);
 int32_t BSP_NFCTAG_ReadMBLength_Dyn(const uint32_t Instance, uint8_t *const pMBLength);
+int32_t BSP_NFCTAG_ReadDataAsync(const uint32_t Instance, uint8_t *const pData, const uint16_t TarAddr, \
+                                 const uint32_t Size, NFCMEM_IO_Callback_t Callback);
+int32_t BSP_NFCTAG_WriteDataAsync(const uint32_t Instance, const uint8_t *const pData, const uint16_t TarAddr, \
+                                  const uint32_t Size, NFCMEM_IO_Callback_t Callback);
+int32_t BSP_NFCTAG_ReadMailboxDataAsync(const uint32_t Instance, uint8_t *const pData, const uint16_t Offset, \
+                                        const uint16_t NbByte, NFCMEM_IO_Callback_t Callback);
+int32_t BSP_NFCTAG_WriteMailboxDataAsync(const uint32_t Instance, const uint8_t *const pData, const uint16_t NbByte, \
+                                         NFCMEM_IO_Callback_t Callback);
+uint8_t BSP_NFCTAG_IsBusy(const uint32_t Instance);
+int32_t BSP_NFCTAG_WaitTransfer(const uint32_t Instance);
 
 
 int32_t NFC_IO_Init(void);
@@ -39,6 +39,8 @@ static bool NdefSupportV = false;
 static uint8_t  t2tReadReq[]    = { 0x30, 0x00 };                                                                                 /* T2T READ Block:0 */
 /* NFC T2 Write command */
 static uint8_t  t2tWriteReq[]    = { 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00 };                                                                                 /* T2T READ Block:0 */
+/* NFC T2 Fast Read command */
+static uint8_t  t2tFastReadReq[] = { 0x3A, 0x00, 0x00 };                                                                          /* T2T FAST_READ Start page, End page */
 /* NFC T3 Check command */
 static uint8_t  t3tCheckReq[]   =  { 0x06, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x01, 0x09, 0x00, 0x01, 0x80, 0x00 };   /* T3T Check/Read command */
 /* NFC T3 Update command */
@@ -57,6 +59,75 @@ static uint8_t  t4tReadBinary[] = {0x00, 0xB0, 0x00, 0x00, 0x00};
 /* NFC T4 Success code */
 static uint8_t t4Success[] = {0x90,0x00};
 
+/****************** Transfer planner *****************************/
+/* Number of tags whose transfer capabilities are remembered */
+#define BSP_NFCTAG_CAPS_ENTRIES           4
+/* Longest tag identifier kept in the capabilities cache (triple size NFCID1) */
+#define BSP_NFCTAG_CAPS_UID_LENGTH        10
+/* Largest payload requested in a single tag response, fits the 0xFF bytes RX buffers */
+#define BSP_NFCTAG_MAX_XFER_LENGTH        0xF0
+
+/* Capability probe status */
+#define BSP_NFCTAG_CAP_UNKNOWN            0
+#define BSP_NFCTAG_CAP_SUPPORTED          1
+#define BSP_NFCTAG_CAP_REJECTED           2
+
+/* Transfer capabilities of a tag, learnt at activation and while exchanging with it */
+typedef struct {
+  uint8_t  uid[BSP_NFCTAG_CAPS_UID_LENGTH]; /* Tag identifier (NFCID1, PUPI, NFCID2 or UID) */
+  uint8_t  uidLen;                          /* Identifier length, 0 for an unused entry */
+  uint8_t  type;                            /* rfalNfcDevType of the tag */
+  uint8_t  t2tFastRead;                     /* T2T: FAST_READ probe status */
+  uint16_t t2tFastReadEnd;                  /* T2T: lowest page a READ or FAST_READ up to it was NAKed, 0 when none */
+  uint16_t t4tMaxLe;                        /* T4T: MLe from the CC file, 0 when unknown */
+  uint16_t t4tMaxLc;                        /* T4T: MLc from the CC file, 0 when unknown */
+  uint8_t  t3tMaxCheckBlocks;               /* T3T: blocks per Check (Nbr), 0 when unknown */
+  uint8_t  t3tMaxUpdateBlocks;              /* T3T: blocks per Update (Nbw), 0 when unknown */
+  uint8_t  t5tBlockSize;                    /* T5T: block size in bytes, 0 until probed */
+  uint8_t  t5tExtended;                     /* T5T: extended (16-bit block number) commands probe status */
+  uint8_t  t5tMaxReadBlocks;                /* T5T: blocks per Read Multiple Blocks, 1 for single block reads */
+  uint8_t  t5tWriteMultiple;                /* T5T: Write Multiple Blocks probe status */
+} BSP_NFCTAG_Caps_t;
+
+static BSP_NFCTAG_Caps_t CapsCache[BSP_NFCTAG_CAPS_ENTRIES];
+static uint8_t CapsNext = 0;
+/* Capabilities of the current tag */
+static BSP_NFCTAG_Caps_t *Caps = NULL;
+
+/* Returns the capabilities entry of a tag, recycling the oldest entry for a new tag */
+static BSP_NFCTAG_Caps_t *BSP_NFCTAG_GetCaps(rfalNfcDevice *device)
+{
+  uint8_t uidLen = device->nfcidLen;
+  BSP_NFCTAG_Caps_t *entry;
+  uint8_t i;
+
+  if((device->nfcid == NULL) || (uidLen > BSP_NFCTAG_CAPS_UID_LENGTH))
+  {
+    uidLen = 0;
+  }
+
+  for(i = 0; (i < BSP_NFCTAG_CAPS_ENTRIES) && (uidLen != 0); i++)
+  {
+    entry = &CapsCache[i];
+    if((entry->uidLen == uidLen) && (entry->type == device->type) && (memcmp(entry->uid, device->nfcid, uidLen) == 0))
+    {
+      return entry;
+    }
+  }
+
+  // unknown tag: nothing learnt yet
+  entry = &CapsCache[CapsNext];
+  CapsNext = (CapsNext + 1) % BSP_NFCTAG_CAPS_ENTRIES;
+  memset(entry, 0, sizeof(BSP_NFCTAG_Caps_t));
+  entry->type = device->type;
+  entry->uidLen = uidLen;
+  if(uidLen != 0)
+  {
+    memcpy(entry->uid, device->nfcid, uidLen);
+  }
+  return entry;
+}
+
 /****************** NFCA *****************************/
 /* NFCA RX Buffer length in bytes */
 #define BSP_NFCTAG_NFCA_RXBUF_LENGTH 0xFF
@@ -132,6 +203,228 @@ uint8_t BSP_NFCTAG_T4_SelectFile(uint16_t fileId)
   return NFCTAG_OK;
 }
 
+/* Largest T4 Read Binary Le: short APDU, our FSD (less PCB, CRC and status word) and the CC MLe */
+static uint16_t t4tGetMaxLe(void)
+{
+    uint16_t maxLe = rfalIsoDepFSxI2FSx(RFAL_ISODEP_FSDI_DEFAULT) - 1 - 2 - sizeof(t4Success);
+
+    if(maxLe > 0xFF)
+    {
+        maxLe = 0xFF;
+    }
+    if((Caps->t4tMaxLe != 0) && (Caps->t4tMaxLe < maxLe))
+    {
+        maxLe = Caps->t4tMaxLe;
+    }
+    return maxLe;
+}
+
+/* Largest T4 Update Binary Lc: short APDU, tag FSC (less PCB, CRC and APDU header) and the CC MLc */
+static uint16_t t4tGetMaxLc(void)
+{
+    uint16_t fsc = Current->proto.isoDep.info.FSx;
+    uint16_t maxLc = 0xFF;
+
+    if((fsc > (1 + 2 + sizeof(t4tWriteData))) && ((fsc - (1 + 2 + sizeof(t4tWriteData))) < maxLc))
+    {
+        maxLc = fsc - (1 + 2 + sizeof(t4tWriteData));
+    }
+    if((Caps->t4tMaxLc != 0) && (Caps->t4tMaxLc < maxLc))
+    {
+        maxLc = Caps->t4tMaxLc;
+    }
+    return maxLc;
+}
+
+/* Reads the selected T4 file with Read Binary commands as large as the tag and the frame sizes allow */
+static uint8_t t4tReadBinaryData(uint8_t* buffer, uint32_t offset, uint32_t length)
+{
+    rfalIsoDepBufFormat rxBuf;
+    uint16_t maxLe = t4tGetMaxLe();
+    ReturnCode err;
+
+    while (length > 0)
+    {
+        uint16_t rxLen = 0;
+        uint16_t le = (length > maxLe) ? maxLe : length;
+
+        t4tReadBinary[2] = offset >> 8;
+        t4tReadBinary[3] = offset & 0xFF;
+        t4tReadBinary[4] = le;
+        err = t4tSendCommand(t4tReadBinary, sizeof(t4tReadBinary), &rxBuf, &rxLen);
+        if(( err != RFAL_ERR_NONE ) || (rxLen <= 2))
+        {
+            return NFCTAG_ERROR;
+        }
+        rxLen -= 2; // status bytes
+        if(rxLen > le)
+        {
+            rxLen = le;
+        }
+        memcpy(buffer, rxBuf.inf, rxLen);
+        buffer += rxLen;
+        offset += rxLen;
+        length -= rxLen;
+    }
+    return NFCTAG_OK;
+}
+
+/* Writes the selected T4 file with Update Binary commands as large as the tag and the frame sizes allow */
+static uint8_t t4tUpdateBinaryData(uint8_t* buffer, uint32_t offset, uint32_t length)
+{
+    rfalIsoDepBufFormat rxBuf;
+    uint8_t cmd[sizeof(t4tWriteData) + 0xFF];
+    uint16_t maxLc = t4tGetMaxLc();
+    ReturnCode err;
+
+    while (length > 0)
+    {
+        uint16_t rxLen = 0;
+        uint16_t lc = (length > maxLc) ? maxLc : length;
+
+        memcpy(cmd, t4tWriteData, sizeof(t4tWriteData));
+        cmd[2] = offset >> 8;
+        cmd[3] = offset & 0xFF;
+        cmd[4] = lc;
+        memcpy(&cmd[5], buffer, lc);
+        err = t4tSendCommand(cmd, sizeof(t4tWriteData) + lc, &rxBuf, &rxLen);
+        if(( err != RFAL_ERR_NONE ) || (rxLen < sizeof(t4Success)) || memcmp(&rxBuf.inf[rxLen - sizeof(t4Success)], t4Success, sizeof(t4Success)))
+        {
+            // not a success code
+            return NFCTAG_ERROR;
+        }
+        buffer += lc;
+        offset += lc;
+        length -= lc;
+    }
+    return NFCTAG_OK;
+}
+
+/* Selects the NDEF file declared in the CC file, learning the MLe/MLc limits on the way */
+static uint8_t t4tSelectNdefFile(void)
+{
+    uint8_t cc[11];
+    uint16_t ndefFileId;
+
+    // CCLEN (2), version (1), MLe (2), MLc (2), NDEF file control TLV: T (1), L (1), file Id (2)...
+    Caps->t4tMaxLe = 0;
+    Caps->t4tMaxLc = 0;
+    BSP_NFCTAG_T4_SelectFile(0xE103);
+    if(t4tReadBinaryData(cc, 0, sizeof(cc)) != NFCTAG_OK)
+    {
+        return NFCTAG_ERROR;
+    }
+    Caps->t4tMaxLe = (cc[3] << 8) | cc[4];
+    Caps->t4tMaxLc = (cc[5] << 8) | cc[6];
+    ndefFileId = (cc[9] << 8) | cc[10];
+    return BSP_NFCTAG_T4_SelectFile(ndefFileId);
+}
+
+/* Tells if a T2T answered with a 4-bit NAK: the tag refused the command */
+static bool t2tIsNak(ReturnCode err, uint16_t rxLen)
+{
+    return ((err >= RFAL_ERR_INCOMPLETE_BYTE) && (err <= RFAL_ERR_INCOMPLETE_BYTE_07) && (rxLen == 1));
+}
+
+/* Remembers that a FAST_READ up to this page is NAKed: the readable memory of the tag ends before it */
+static void t2tSetFastReadEnd(uint16_t page)
+{
+    if((Caps->t2tFastReadEnd == 0) || (page < Caps->t2tFastReadEnd))
+    {
+        Caps->t2tFastReadEnd = page;
+    }
+}
+
+/* Wakes up and selects the T2 tag again, as a NAK sends it back to the IDLE state */
+static ReturnCode t2tReselect(void)
+{
+    ReturnCode           err;
+    rfalNfcaSensRes      sensRes;
+    rfalNfcaSelRes       selRes;
+
+    err = rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_WUPA, &sensRes );
+    if(err != RFAL_ERR_NONE)
+    {
+        return err;
+    }
+    return rfalNfcaPollerSelect( Current->dev.nfca.nfcId1, Current->dev.nfca.nfcId1Len, &selRes );
+}
+
+/* Reads T2 tag pages, with FAST_READ when the span is longer than a READ and the tag supports it */
+static uint8_t t2tReadData(uint8_t* buffer, uint32_t offset, uint32_t length)
+{
+    uint8_t rxBuf[BSP_NFCTAG_NFCA_RXBUF_LENGTH];
+    ReturnCode err;
+
+    while (length > 0)
+    {
+        uint16_t firstPage = offset / 4;
+        uint16_t lastPage = (offset + length - 1) / 4;
+        uint16_t rxLen = 0;
+        uint16_t expected;
+
+        err = RFAL_ERR_PARAM;
+        // a FAST_READ up to a page already NAKed would be NAKed again: stop short of it
+        if((Caps->t2tFastReadEnd != 0) && (lastPage >= Caps->t2tFastReadEnd))
+        {
+            lastPage = (firstPage < Caps->t2tFastReadEnd) ? (Caps->t2tFastReadEnd - 1) : firstPage;
+        }
+        // READ always returns 4 pages
+        if((Caps->t2tFastRead == BSP_NFCTAG_CAP_SUPPORTED) && ((lastPage - firstPage) >= 4))
+        {
+            if((lastPage - firstPage + 1) > (BSP_NFCTAG_MAX_XFER_LENGTH / 4))
+            {
+                lastPage = firstPage + (BSP_NFCTAG_MAX_XFER_LENGTH / 4) - 1;
+            }
+            expected = (lastPage - firstPage + 1) * 4;
+            t2tFastReadReq[1] = firstPage;
+            t2tFastReadReq[2] = lastPage;
+            err = rfalTransceiveBlockingTxRx( t2tFastReadReq, sizeof(t2tFastReadReq), rxBuf, sizeof(rxBuf), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
+            if((err != RFAL_ERR_NONE) || (rxLen != expected))
+            {
+                // e.g. end page out of the tag memory: the tag NAKed, fall back to READ
+                if(t2tIsNak(err, rxLen))
+                {
+                    t2tSetFastReadEnd(lastPage);
+                }
+                if(t2tReselect() != RFAL_ERR_NONE)
+                {
+                    return NFCTAG_ERROR;
+                }
+                err = RFAL_ERR_PARAM;
+            }
+        }
+        if(err != RFAL_ERR_NONE)
+        {
+            expected = 16;
+            t2tReadReq[1] = firstPage;
+            err = rfalTransceiveBlockingTxRx( t2tReadReq, sizeof(t2tReadReq), rxBuf, sizeof(rxBuf), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
+            if((err != RFAL_ERR_NONE) || (rxLen != expected))
+            {
+                // page out of the tag memory: no FAST_READ up to it next time, and the tag is selected again for the next requests
+                if(t2tIsNak(err, rxLen))
+                {
+                    t2tSetFastReadEnd(firstPage);
+                    (void)t2tReselect();
+                }
+                return NFCTAG_ERROR;
+            }
+        }
+
+        // skip the first bytes if offset is not aligned
+        rxLen -= offset % 4;
+        if(rxLen > length)
+        {
+            rxLen = length;
+        }
+        memcpy(buffer, &rxBuf[offset % 4], rxLen);
+        buffer += rxLen;
+        offset += rxLen;
+        length -= rxLen;
+    }
+    return NFCTAG_OK;
+}
+
 /* NFCA Tag activation stage (Select Tag and NDEF file) */
 static uint8_t BSP_NFCTAG_Activate_NfcA(void)
 {
@@ -140,7 +433,6 @@ static uint8_t BSP_NFCTAG_Activate_NfcA(void)
     rfalNfcaSelRes       selRes;
     rfalIsoDepBufFormat rxBuf;
     uint16_t rxBufLen = sizeof(rxBuf);
-    uint16_t ndefFileId;
 
     if(Current->type != RFAL_NFC_LISTEN_TYPE_NFCA)
     {
@@ -155,10 +447,7 @@ static uint8_t BSP_NFCTAG_Activate_NfcA(void)
       err = t4tSendCommand(t4tSelectNdefApp, sizeof(t4tSelectNdefApp), &rxBuf, &rxBufLen);
       if(err == RFAL_ERR_NONE)
       {
-          BSP_NFCTAG_T4_SelectFile(0xE103);
-          BSP_NFCTAG_ReadData_NfcA((uint8_t*)&ndefFileId, 9, 2);
-          ndefFileId = (ndefFileId >> 8) | ((ndefFileId & 0xFF) << 8) ;
-          err = BSP_NFCTAG_T4_SelectFile(ndefFileId);
+          err = t4tSelectNdefFile();
           if( err != RFAL_ERR_NONE )
           {
               return NFCTAG_ERROR;
@@ -195,6 +484,33 @@ static uint8_t BSP_NFCTAG_Activate_NfcA(void)
       *CurrentProtocol->NdefSupport = true;
     }
 
+    if((Current->dev.nfca.type == RFAL_NFCA_T2T) && (Caps->t2tFastRead == BSP_NFCTAG_CAP_UNKNOWN))
+    {
+        uint8_t pages[BSP_NFCTAG_NFCA_RXBUF_LENGTH];
+        uint16_t rxLen = 0;
+
+        // probe FAST_READ once per tag on the first 4 pages, which always exist
+        t2tFastReadReq[1] = 0;
+        t2tFastReadReq[2] = 3;
+        err = rfalTransceiveBlockingTxRx( t2tFastReadReq, sizeof(t2tFastReadReq), pages, sizeof(pages), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
+        if((err == RFAL_ERR_NONE) && (rxLen == 16))
+        {
+            Caps->t2tFastRead = BSP_NFCTAG_CAP_SUPPORTED;
+        }
+        else
+        {
+            // only a NAK tells the command is not supported, it is probed again at the next activation otherwise
+            if(t2tIsNak(err, rxLen))
+            {
+                Caps->t2tFastRead = BSP_NFCTAG_CAP_REJECTED;
+            }
+            if(t2tReselect() != RFAL_ERR_NONE)
+            {
+                return NFCTAG_ERROR;
+            }
+        }
+    }
+
     if( Current->dev.nfca.type == RFAL_NFCA_T4T)
     {       
     /*******************************************************************************/
@@ -216,11 +532,8 @@ static uint8_t BSP_NFCTAG_Activate_NfcA(void)
             return NFCTAG_RESPONSE_ERROR;
         }
         
-        // get NDEF file Id from CCfile
-        BSP_NFCTAG_T4_SelectFile(0xE103);
-        BSP_NFCTAG_ReadData_NfcA((uint8_t*)&ndefFileId, 9, 2);
-        ndefFileId = (ndefFileId >> 8) | ((ndefFileId & 0xFF) << 8) ;
-        err = BSP_NFCTAG_T4_SelectFile(ndefFileId);
+        // get NDEF file Id and transfer limits from CCfile
+        err = t4tSelectNdefFile();
         if( err != RFAL_ERR_NONE )
         {
             return NFCTAG_ERROR;
@@ -239,166 +552,111 @@ static uint8_t BSP_NFCTAG_ReadData_NfcA(uint8_t* buffer, uint32_t offset, uint32
     uint8_t err;
     // read bytes
     uint16_t rxLen = rxBufLen;
-    
-    uint16_t readBytes = 0;
-    uint16_t currentOffset = offset;
-    uint16_t currentLength = length;
-    while (currentLength > 0)
-    {
 
-      switch( Current->dev.nfca.type )
-      {
-          /*******************************************************************************/
-          case RFAL_NFCA_T1T:
-              /* To perform presence check, on this example a T1T Read command is used */
-              err = rfalT1TPollerRall(Current->dev.nfca.nfcId1, rxBuf, rxBufLen,&rxLen );
-              if((rxLen < (length + currentOffset)) || (rxLen < 2))
-              {
-                // Read all read less than expected length
-                // could be because of rxBufLen < tag length
-                return NFCTAG_ERROR;
-              }
-              rxLen = length;
-              memcpy(buffer,&rxBuf[currentOffset],length); 
-              break;
-              
-          /*******************************************************************************/
-          case RFAL_NFCA_T2T:
-              // 4 bytes blocks
-              t2tReadReq[1] = currentOffset / 4;
-              /* To perform presence check, on this example a T2T Read command is used */
-              err = rfalTransceiveBlockingTxRx( t2tReadReq, sizeof(t2tReadReq), rxBuf, rxBufLen, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
-              rxLen -= currentOffset%4;
-              if(rxLen > currentLength)
-              {
-                rxLen = currentLength;
-              }
-              memcpy(buffer + readBytes,&rxBuf[currentOffset%4],rxLen);
-              break;
-                      
-          /*******************************************************************************/
-          case RFAL_NFCA_T4T:
-              t4tReadBinary[2] = (currentOffset) >> 8;
-              t4tReadBinary[3] = (currentOffset) & 0xFF;
-              t4tReadBinary[4] = (currentLength) > rxBufLen ? rxBufLen : (currentLength);
-
-              err = t4tSendCommand(t4tReadBinary, sizeof(t4tReadBinary), (rfalIsoDepBufFormat*)&rxBuf, &rxLen);
-              if(rxLen > 2)
-              {
-                rxLen -= 2; // status bytes
-                if(rxLen > currentLength)
-                  rxLen = currentLength;
-                memcpy(buffer + readBytes,&((rfalIsoDepBufFormat*)rxBuf)->inf[0],rxLen);
-              }
-              else
-              {
-                rxLen = 0;
-              }
-              break;
-          
-          /*******************************************************************************/
-          default:
+    switch( Current->dev.nfca.type )
+    {
+        /*******************************************************************************/
+        case RFAL_NFCA_T1T:
+            /* To perform presence check, on this example a T1T Read command is used */
+            err = rfalT1TPollerRall(Current->dev.nfca.nfcId1, rxBuf, rxBufLen,&rxLen );
+            if(( err != RFAL_ERR_NONE ) || (rxLen < (length + offset)) || (rxLen < 2))
+            {
+              // Read all read less than expected length
+              // could be because of rxBufLen < tag length
               return NFCTAG_ERROR;
-      }
-      if(( err != RFAL_ERR_NONE ) || (rxLen == 0 ))
-      {
-        return NFCTAG_ERROR;
-      }
-      else
-      {
-        currentOffset += rxLen;
-        currentLength -= rxLen;
-        readBytes += rxLen;
-      }
-    } // while (currentLength > 0)
-    return NFCTAG_OK;
+            }
+            memcpy(buffer,&rxBuf[offset],length); 
+            return NFCTAG_OK;
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_T2T:
+            return t2tReadData(buffer, offset, length);
+                    
+        /*******************************************************************************/
+        case RFAL_NFCA_T4T:
+            return t4tReadBinaryData(buffer, offset, length);
+        
+        /*******************************************************************************/
+        default:
+            return NFCTAG_ERROR;
+    }
 }
 
 /* NFCA Tag write data method */
 uint8_t BSP_NFCTAG_WriteData_NfcA(uint8_t* buffer, uint32_t offset, uint32_t length)
 {
-    uint8_t rxBuf[RFAL_ISODEP_DEFAULT_FSC + RFAL_ISODEP_PROLOGUE_SIZE];
+    uint8_t rxBuf[BSP_NFCTAG_NFCA_RXBUF_LENGTH];
     uint16_t rxLen = 0xF0;
     uint8_t status = 0xFF;
     uint16_t currentOffset = offset;
     uint16_t lastOffset = offset + length;
-    uint16_t nbBytesToWrite = length;
-    uint8_t cmd[256 + 5 + 10];
     uint8_t nbBytesWritten = 0;
-    uint8_t block[10] = {0};
+    uint8_t block[4] = {0};
 
-    while (currentOffset < lastOffset)
+    switch( Current->dev.nfca.type )
     {
-
-      switch( Current->dev.nfca.type )
-      {
-          /*******************************************************************************/
-          case RFAL_NFCA_T1T:
+        /*******************************************************************************/
+        case RFAL_NFCA_T1T:
+            while (currentOffset < lastOffset)
+            {
               // -2 as H0 & H1 are not considered for block id
               status = rfalT1TPollerWrite( Current->dev.nfca.nfcId1,  currentOffset -2,  *buffer );
               if(status != RFAL_ERR_NONE)
                 return NFCTAG_ERROR;
               currentOffset ++;
               buffer++;
-              break;
-              
-          /*******************************************************************************/
-          case RFAL_NFCA_T2T:
+            }
+            break;
+            
+        /*******************************************************************************/
+        case RFAL_NFCA_T2T:
+            // WRITE is limited to a single page: only the partially written edge pages are read first
+            while (currentOffset < lastOffset)
+            {
+              /* Manage offset and length for block based memories */
+              uint8_t blockInternalOffset = currentOffset % 4;
+              uint8_t blockInternalLength = 4 - (currentOffset % 4);
+              blockInternalLength = blockInternalLength > (lastOffset - currentOffset) ? (lastOffset - currentOffset) : blockInternalLength;
+
+              if((blockInternalOffset) || (blockInternalLength%4))
+              {
+                // READ returns 4 pages, only the first one is used
+                t2tReadReq[1] = currentOffset / 4;
+                status = rfalTransceiveBlockingTxRx( t2tReadReq, sizeof(t2tReadReq), rxBuf, sizeof(rxBuf), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
+                if((status != RFAL_ERR_NONE) || (rxLen < sizeof(block)))
                 {
-                  /* Manage offset and length for block based memories */
-                  uint8_t blockInternalOffset = currentOffset % 4;
-                  uint8_t blockInternalLength = 4 - (currentOffset % 4);
-                  blockInternalLength = blockInternalLength > nbBytesToWrite ? nbBytesToWrite : blockInternalLength;
-
-                  if((blockInternalOffset) || (blockInternalLength%4))
-                  {
-                    // 4 bytes block
-                    t2tReadReq[1] = currentOffset / 4;
-                    status = rfalTransceiveBlockingTxRx( t2tReadReq, sizeof(t2tReadReq), block, 0xF0, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
-                    if(status != RFAL_ERR_NONE)
-                    {
-                      return NFCTAG_ERROR;
-                    }
-                    // remove first byte (tag status)
-                    memcpy(&block[blockInternalOffset],buffer,blockInternalLength);
-                    buffer += blockInternalLength;
-                    nbBytesWritten = blockInternalLength;
-
-                  } else {
-                    memcpy(block, buffer, 4);
-                    buffer += 4;
-                    nbBytesWritten = 4;
-                  }
-
-                  t2tWriteReq[1] = currentOffset/4;
-                  memcpy(&t2tWriteReq[2], block, 4);
-                  status = rfalTransceiveBlockingTxRx( t2tWriteReq, sizeof(t2tWriteReq), rxBuf, 0xF0, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
-                  if(status >= RFAL_ERR_INCOMPLETE_BYTE)
-                    status = RFAL_ERR_NONE;
-                  if(status != RFAL_ERR_NONE)
-                    return NFCTAG_ERROR;
-                  currentOffset +=nbBytesWritten;
+                  return NFCTAG_ERROR;
                 }
-              break;
-                      
-          /*******************************************************************************/
-          case RFAL_NFCA_T4T:
-          case RFAL_NFCA_NFCDEP:
-          case RFAL_NFCA_T4T_NFCDEP:
-            memcpy(cmd,t4tWriteData,sizeof(t4tWriteData));
-            cmd[2] = offset >> 8;
-            cmd[3] = offset & 0xFF;
-            cmd[4] = length;
-            memcpy(&cmd[5], buffer, length);
-            status = t4tSendCommand(cmd, sizeof(t4tWriteData) + length, (rfalIsoDepBufFormat*)&rxBuf, &rxLen);
-            currentOffset +=length;
-            if(memcmp(&rxBuf[1],t4Success,sizeof(t4Success)))
-            {
-              // not a success code
-               return NFCTAG_ERROR;
+                memcpy(block, rxBuf, sizeof(block));
+                memcpy(&block[blockInternalOffset],buffer,blockInternalLength);
+                buffer += blockInternalLength;
+                nbBytesWritten = blockInternalLength;
+
+              } else {
+                memcpy(block, buffer, 4);
+                buffer += 4;
+                nbBytesWritten = 4;
+              }
+
+              t2tWriteReq[1] = currentOffset/4;
+              memcpy(&t2tWriteReq[2], block, 4);
+              status = rfalTransceiveBlockingTxRx( t2tWriteReq, sizeof(t2tWriteReq), rxBuf, 0xF0, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
+              if(status >= RFAL_ERR_INCOMPLETE_BYTE)
+                status = RFAL_ERR_NONE;
+              if(status != RFAL_ERR_NONE)
+                return NFCTAG_ERROR;
+              currentOffset +=nbBytesWritten;
             }
             break;
-      }
+                    
+        /*******************************************************************************/
+        case RFAL_NFCA_T4T:
+        case RFAL_NFCA_NFCDEP:
+        case RFAL_NFCA_T4T_NFCDEP:
+            return t4tUpdateBinaryData(buffer, offset, length);
+
+        default:
+            break;
     }
 
   if(status == RFAL_ERR_NONE)
@@ -506,40 +764,7 @@ static uint8_t BSP_NFCTAG_ReadData_NfcB(uint8_t* buffer, uint32_t offset, uint32
       readBytes += bytesInBlock;
     }
   } else if (Current->type == RFAL_NFC_LISTEN_TYPE_NFCB) {
-      uint8_t rxBuf[RFAL_ISODEP_DEFAULT_FSC + RFAL_ISODEP_PROLOGUE_SIZE];
-      uint16_t rxBufLen = 0xF0;
-      uint8_t err;
-      // read bytes
-      uint16_t rxLen = rxBufLen;
-      
-      uint16_t readBytes = 0;
-      uint16_t currentOffset = offset;
-      uint16_t currentLength = length;
-      while (currentLength > 0)
-      {
-        t4tReadBinary[2] = (currentOffset) >> 8;
-        t4tReadBinary[3] = (currentOffset) & 0xFF;
-        t4tReadBinary[4] = (currentLength) > rxBufLen ? rxBufLen : (currentLength);
-
-        err = t4tSendCommand(t4tReadBinary, sizeof(t4tReadBinary), (rfalIsoDepBufFormat*)&rxBuf, &rxLen);
-        if(rxLen > 2)
-        {
-          rxLen -= 2; // status bytes
-          if(rxLen > currentLength)
-            rxLen = currentLength;
-          memcpy(buffer + readBytes,&((rfalIsoDepBufFormat*)rxBuf)->inf[0],rxLen);
-        } else {
-          rxLen = 0;
-        }
-        if(( err != RFAL_ERR_NONE ) || (rxLen == 0 ))
-        {
-          return NFCTAG_ERROR;
-        } else {
-          currentOffset += rxLen;
-          currentLength -= rxLen;
-          readBytes += rxLen;
-        }
-      }
+      return t4tReadBinaryData(buffer, offset, length);
   }
   return NFCTAG_OK;
 }
@@ -547,15 +772,16 @@ static uint8_t BSP_NFCTAG_ReadData_NfcB(uint8_t* buffer, uint32_t offset, uint32
 /* NFCB Tag write data method */
 static uint8_t BSP_NFCTAG_WriteData_NfcB(uint8_t* buffer, uint32_t offset, uint32_t length)
 {
-    uint8_t rxBuf[0xFF];
-    uint16_t rxLen = 0xF0;
     uint8_t status = 0xFF;
     uint16_t currentOffset = offset;
     uint16_t lastOffset = offset + length;
-    uint16_t nbBytesToWrite = length;
-    uint8_t cmd[256 + 5 + 10];
     uint8_t nbBytesWritten = 0;
 
+    if(Current->type == RFAL_NFC_LISTEN_TYPE_NFCB)
+    {
+      return t4tUpdateBinaryData(buffer, offset, length);
+    }
+
     while (currentOffset < lastOffset)
     {
       switch( Current->type )
@@ -566,7 +792,7 @@ static uint8_t BSP_NFCTAG_WriteData_NfcB(uint8_t* buffer, uint32_t offset, uint3
           rfalSt25tbBlock block;
           uint8_t blockInternalOffset = currentOffset % 4;
           uint8_t blockInternalLength = 4 - (currentOffset % 4);
-          blockInternalLength = blockInternalLength > nbBytesToWrite ? nbBytesToWrite : blockInternalLength;
+          blockInternalLength = blockInternalLength > (lastOffset - currentOffset) ? (lastOffset - currentOffset) : blockInternalLength;
 
           if((blockInternalOffset) || (blockInternalLength%4))
           {
@@ -594,17 +820,8 @@ static uint8_t BSP_NFCTAG_WriteData_NfcB(uint8_t* buffer, uint32_t offset, uint3
           currentOffset +=nbBytesWritten;
         }          
         break;
-        case RFAL_NFC_LISTEN_TYPE_NFCB:
-            memcpy(cmd,t4tWriteData,sizeof(t4tWriteData));
-            cmd[2] = offset >> 8;
-            cmd[3] = offset & 0xFF;
-            cmd[4] = length;
-            memcpy(&cmd[5], buffer, length);
-            status = t4tSendCommand(cmd, sizeof(t4tWriteData) + length, (rfalIsoDepBufFormat*)&rxBuf, &rxLen);
-            currentOffset +=length;
-        break;
         default:
-          break;
+          return NFCTAG_ERROR;
       }
     }
     
@@ -626,6 +843,51 @@ static BSP_NFCTAG_Protocol_t apiNfcB = {
 
 
 /****************** NFCF *****************************/
+/* NFCF Check: blocks per command that fit the RX buffer (header is 13 bytes) */
+#define BSP_NFCTAG_T3T_MAX_CHECK_BLOCKS   ((BSP_NFCTAG_MAX_XFER_LENGTH - 13) / 16)
+/* NFCF Update: blocks per command that fit a frame (header + block list + data) */
+#define BSP_NFCTAG_T3T_MAX_UPDATE_BLOCKS  ((BSP_NFCTAG_MAX_XFER_LENGTH - 13) / (16 + 3))
+/* NFCF T3T command header length (command code, NFCID2, service list) */
+#define BSP_NFCTAG_T3T_HEADER_LENGTH      12
+
+/* Builds a T3T Check/Update request for numBlocks blocks from firstBlock, returns its length */
+static uint16_t t3tBuildRequest(uint8_t* txBuf, const uint8_t* header, uint16_t firstBlock, uint8_t numBlocks)
+{
+  uint16_t txLen = BSP_NFCTAG_T3T_HEADER_LENGTH;
+  uint16_t blockId;
+
+  memcpy(txBuf, header, BSP_NFCTAG_T3T_HEADER_LENGTH);
+  memcpy(&txBuf[1], Current->dev.nfcf.sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN );  /* Assign device's NFCID for the command */
+  txBuf[txLen++] = numBlocks;
+  for(blockId = firstBlock; blockId < (firstBlock + numBlocks); blockId++)
+  {
+    if(blockId <= 0xFF)
+    {
+      // 2 bytes block list element
+      txBuf[txLen++] = 0x80;
+      txBuf[txLen++] = blockId;
+    }
+    else
+    {
+      // 3 bytes block list element
+      txBuf[txLen++] = 0x00;
+      txBuf[txLen++] = blockId & 0xFF;
+      txBuf[txLen++] = blockId >> 8;
+    }
+  }
+  return txLen;
+}
+
+/* Blocks per command allowed by the tag (Nbr/Nbw) and by the frame size */
+static uint8_t t3tMaxBlocks(uint8_t tagLimit, uint8_t frameLimit)
+{
+  if((tagLimit == 0) || (tagLimit > frameLimit))
+  {
+    return (tagLimit == 0) ? 1 : frameLimit;
+  }
+  return tagLimit;
+}
+
 /* NFCF Tag Select */
 static uint8_t BSP_NFCTAG_Activate_NfcF(void)
 {
@@ -642,7 +904,21 @@ static uint8_t BSP_NFCTAG_Activate_NfcF(void)
   }
   else
   {
+    uint16_t checksum = 0;
+    int i;
+
     *CurrentProtocol->NdefSupport = true;
+
+    // Attribute information block: Nbr and Nbw, guarded by the checksum of bytes 0 to 13
+    for(i = 0; i < 14; i++)
+    {
+      checksum += testBuf[i];
+    }
+    if(checksum == ((testBuf[14] << 8) | testBuf[15]))
+    {
+      Caps->t3tMaxCheckBlocks = testBuf[1];
+      Caps->t3tMaxUpdateBlocks = testBuf[2];
+    }
   }
 
   return NFCTAG_OK;
@@ -654,36 +930,47 @@ static uint8_t BSP_NFCTAG_ReadData_NfcF(uint8_t* buffer, uint32_t offset, uint32
   uint8_t err;
   uint8_t txRxBuf[0xFF];
   uint16_t rxBufLen = 0xF0;
-  // read bytes
-  uint16_t rxLen = rxBufLen;
-  uint16_t firstBlock =  (offset / 16);
-  uint16_t lastBlock = (length + offset - 1) / 16;
-  uint16_t blockNumber = lastBlock - firstBlock + 1;
-  memset(txRxBuf,0,rxBufLen);
-
-  /* To perform presence check, on this example a T3T Check/Read command is used */
-  memcpy( &t3tCheckReq[1], Current->dev.nfcf.sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN );  /* Assign device's NFCID for Check command */
-  t3tCheckReq[12] = blockNumber;
-  memcpy(txRxBuf, t3tCheckReq, sizeof(t3tCheckReq));
-  int i = 0;
-  for(int blockId = firstBlock ; blockId <= lastBlock ; blockId++)
-  {
-    txRxBuf[13 + i*2] = 0x80;
-    txRxBuf[14 + i*2] = blockId;
-    i++;
-  }
-  err = rfalTransceiveBlockingTxRx(txRxBuf, sizeof(t3tCheckReq) + ((blockNumber-1) * 2), txRxBuf, rxBufLen, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
-  if(err != RFAL_ERR_NONE)
-  {
-    return NFCTAG_ERROR;
-  }
-  if((int)((int)rxLen - 13 - (int)(offset%16)) < (int)length)
+  uint16_t rxLen;
+  uint16_t blockId =  (offset / 16);
+  uint8_t maxBlocks = t3tMaxBlocks(Caps->t3tMaxCheckBlocks, BSP_NFCTAG_T3T_MAX_CHECK_BLOCKS);
+
+  while(length > 0)
   {
-    return NFCTAG_RESPONSE_ERROR;
+    uint16_t skip = offset % 16;
+    uint16_t blockNumber = (skip + length + 15) / 16;
+    uint16_t txLen;
+    uint16_t nbBytes;
+
+    if(blockNumber > maxBlocks)
+    {
+      blockNumber = maxBlocks;
+    }
+
+    /* To perform presence check, on this example a T3T Check/Read command is used */
+    txLen = t3tBuildRequest(txRxBuf, t3tCheckReq, blockId, blockNumber);
+    rxLen = 0;
+    err = rfalTransceiveBlockingTxRx(txRxBuf, txLen, txRxBuf, rxBufLen, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
+    if(err != RFAL_ERR_NONE)
+    {
+      return NFCTAG_ERROR;
+    }
+    nbBytes = (blockNumber * 16) - skip;
+    if(nbBytes > length)
+    {
+      nbBytes = length;
+    }
+    if(rxLen < (13 + skip + nbBytes))
+    {
+      return NFCTAG_RESPONSE_ERROR;
+    }
+
+    memcpy(buffer, &txRxBuf[13 + skip], nbBytes);
+    buffer += nbBytes;
+    offset += nbBytes;
+    length -= nbBytes;
+    blockId += blockNumber;
   }
 
-  memcpy(buffer, &txRxBuf[13 + (offset%16)], length);
-  
   return NFCTAG_OK;
 }
 
@@ -692,33 +979,60 @@ static uint8_t BSP_NFCTAG_WriteData_NfcF(uint8_t* buffer, uint32_t offset, uint3
 {
   uint8_t err;
   uint8_t txRxBuf[0xFF];
+  uint8_t blocks[BSP_NFCTAG_T3T_MAX_UPDATE_BLOCKS * 16];
   uint16_t rxBufLen = 0xF0;
-  // read bytes
-  uint16_t rxLen = rxBufLen;
-  uint16_t firstBlock =  (offset / 16);
-  uint16_t lastBlock = (length + offset - 1) / 16;
+  uint16_t rxLen;
+  uint16_t blockId =  (offset / 16);
+  uint8_t maxBlocks = t3tMaxBlocks(Caps->t3tMaxUpdateBlocks, BSP_NFCTAG_T3T_MAX_UPDATE_BLOCKS);
 
-  memcpy(&t3tUpdateReq[1], Current->dev.nfcf.sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN );  /* Assign device's NFCID for Check command */
-  
-  int currentOffset = offset;
-  for(int blockId = firstBlock; blockId <= lastBlock; blockId++)
+  while(length > 0)
   {
-    int currentLength = 16 - currentOffset % 16;
-    currentLength = currentLength > length ? length : currentLength;
+    uint16_t skip = offset % 16;
+    uint16_t blockNumber = (skip + length + 15) / 16;
+    uint16_t txLen;
+    uint16_t nbBytes;
 
-    t3tUpdateReq[14] = blockId;
-
-    BSP_NFCTAG_ReadData_NfcF(&t3tUpdateReq[15], (blockId * 16), 16);
-    memcpy(&t3tUpdateReq[15] + currentOffset % 16, buffer, currentLength);
+    if(blockNumber > maxBlocks)
+    {
+      blockNumber = maxBlocks;
+    }
+    nbBytes = (blockNumber * 16) - skip;
+    if(nbBytes > length)
+    {
+      nbBytes = length;
+    }
 
-    err = rfalTransceiveBlockingTxRx(t3tUpdateReq, sizeof(t3tUpdateReq), txRxBuf, rxBufLen, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20));
-    if(err != RFAL_ERR_NONE)
+    // only the partially written edge blocks are read back
+    if(skip != 0)
+    {
+      if(BSP_NFCTAG_ReadData_NfcF(blocks, blockId * 16, 16) != NFCTAG_OK)
+      {
+        return NFCTAG_ERROR;
+      }
+    }
+    if(((skip + nbBytes) % 16) && ((skip == 0) || (blockNumber > 1)))
+    {
+      if(BSP_NFCTAG_ReadData_NfcF(&blocks[(blockNumber - 1) * 16], (blockId + blockNumber - 1) * 16, 16) != NFCTAG_OK)
+      {
+        return NFCTAG_ERROR;
+      }
+    }
+    memcpy(&blocks[skip], buffer, nbBytes);
+
+    txLen = t3tBuildRequest(txRxBuf, t3tUpdateReq, blockId, blockNumber);
+    memcpy(&txRxBuf[txLen], blocks, blockNumber * 16);
+    txLen += blockNumber * 16;
+    rxLen = 0;
+    err = rfalTransceiveBlockingTxRx(txRxBuf, txLen, txRxBuf, rxBufLen, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20));
+    // response: length, code, NFCID2, status flag 1, status flag 2
+    if((err != RFAL_ERR_NONE) || (rxLen < 12) || (txRxBuf[10] != 0))
     {
       return NFCTAG_ERROR;
     }
-    currentOffset += currentLength;
-    length -= currentLength;
-    buffer += currentLength;
+    buffer += nbBytes;
+    offset += nbBytes;
+    length -= nbBytes;
+    blockId += blockNumber;
   }
 
   return NFCTAG_OK;
@@ -736,16 +1050,13 @@ static BSP_NFCTAG_Protocol_t apiNfcF = {
 /****************** NFCV*****************************/
 /* NFCV RX buffer length in bytes */
 #define BSP_NFCTAG_NFCV_RXBUF_LENGTH 0xFF
+/* T5 Write Multiple Blocks: blocks per command, not crossing a group of as many blocks */
+#define BSP_NFCTAG_T5T_WRITE_MULTIPLE_BLOCKS 4
 /* T5 read single block command */
-static uint8_t t5ExtReadSingleBlock[] =   {0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 static uint8_t vicExtReadSingleBlock[] =   {0x2A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 /* T5 read multiple block command */
-static uint8_t t5ExtReadMultipleBlock[] = {0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 static uint8_t vicExtReadMultipleBlock[] = {0x2A, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-/* T5 default block size */
-static uint16_t t5BlockSize = 4;
 static uint8_t isVicinity = 0;
-static uint8_t t5MultipleBlockSupport = 0;
 
 uint8_t BSP_NFCTAG_CheckVicinity()
 {
@@ -776,7 +1087,7 @@ static uint8_t BSP_NFCTAG_Activate_NfcV(void)
   if(Current->type == RFAL_NFC_LISTEN_TYPE_NFCV)
   {
     uint8_t status;
-    uint8_t rxBuf[16];
+    uint8_t rxBuf[1 + RFAL_NFCV_MAX_BLOCK_LEN + 2];
     uint16_t rcvlen;
     
     // make sure the field is on
@@ -784,28 +1095,36 @@ static uint8_t BSP_NFCTAG_Activate_NfcV(void)
     
     isVicinity = BSP_NFCTAG_CheckVicinity();
 
-    // let's consider it supports read multiple block
-    status = rfalNfcvPollerExtendedGetSystemInformation( (RFAL_NFCV_REQ_FLAG_DEFAULT | RFAL_NFCV_REQ_FLAG_ADDRESS), Current->dev.nfcv.InvRes.UID, 0x30, rxBuf, 16, &rcvlen );
-    if(status == RFAL_ERR_NONE)
+    // probes are run once per tag
+    if(Caps->t5tBlockSize == 0)
     {
-      t5MultipleBlockSupport = 1;
-    }
-
-    status = rfalNfcvPollerReadSingleBlock( 0x22, Current->dev.nfcv.InvRes.UID, 0,  rxBuf, 16, &t5BlockSize );
+      status = rfalNfcvPollerExtendedGetSystemInformation( (RFAL_NFCV_REQ_FLAG_DEFAULT | RFAL_NFCV_REQ_FLAG_ADDRESS), Current->dev.nfcv.InvRes.UID, 0x30, rxBuf, sizeof(rxBuf), &rcvlen );
+      if(status == RFAL_ERR_NONE)
+      {
+        Caps->t5tExtended = BSP_NFCTAG_CAP_SUPPORTED;
+      }
+      else if(status == RFAL_ERR_NOTSUPP)
+      {
+        Caps->t5tExtended = BSP_NFCTAG_CAP_REJECTED;
+      }
 
-    // don't count the status byte
-    t5BlockSize--;
-    if(status == RFAL_ERR_NONE)
-    {
-      *CurrentProtocol->NdefSupport = true;
+      status = rfalNfcvPollerReadSingleBlock( 0x22, Current->dev.nfcv.InvRes.UID, 0,  rxBuf, sizeof(rxBuf), &rcvlen );
+      // don't count the status byte
+      if((status == RFAL_ERR_NONE) && (rcvlen > 1) && (rcvlen <= (1 + RFAL_NFCV_MAX_BLOCK_LEN)))
+      {
+        Caps->t5tBlockSize = rcvlen - 1;
+      }
+      else
+      {
+        // assume block size is 4
+        Caps->t5tBlockSize = 4;
+      }
 
+      // let's consider it reads as many blocks as the RX buffer holds, until it fails to
+      Caps->t5tMaxReadBlocks = BSP_NFCTAG_MAX_XFER_LENGTH / Caps->t5tBlockSize;
+      Caps->t5tWriteMultiple = isVicinity ? BSP_NFCTAG_CAP_REJECTED : BSP_NFCTAG_CAP_UNKNOWN;
     }
-    else
-    {
-      // assume block size is 4
-      t5BlockSize = 4;
-      *CurrentProtocol->NdefSupport = true;
-    }
+    *CurrentProtocol->NdefSupport = true;
     return NFCTAG_OK;
   }
   else
@@ -815,103 +1134,125 @@ static uint8_t BSP_NFCTAG_Activate_NfcV(void)
   } 
 }
 
+/* Reads T5 blocks with the single or multiple blocks command matching the count and block numbers */
+static ReturnCode t5tReadBlocks(uint16_t firstBlock, uint16_t numBlocks, uint8_t* rxBuf, uint16_t* rcvLen)
+{
+  const uint8_t* uid = Current->dev.nfcv.InvRes.UID;
+
+  if(isVicinity)
+  {
+    // use extended command
+    uint8_t* txBuf = (numBlocks > 1) ? vicExtReadMultipleBlock : vicExtReadSingleBlock;
+    uint16_t txBufLen = (numBlocks > 1) ? sizeof(vicExtReadMultipleBlock) : sizeof(vicExtReadSingleBlock);
+
+    memcpy(&txBuf[2], uid, RFAL_NFCV_UID_LEN);
+    txBuf[10] = firstBlock & 0xFF;
+    txBuf[11] = firstBlock >> 8;
+    if(numBlocks > 1)
+    {
+      txBuf[12] = numBlocks - 1;
+    }
+    return rfalTransceiveBlockingTxRx( txBuf, txBufLen, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
+  }
+  if((firstBlock + numBlocks - 1) <= 0xFF)
+  {
+    if(numBlocks > 1)
+    {
+      return rfalNfcvPollerReadMultipleBlocks( 0x22, uid, firstBlock, numBlocks - 1, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, rcvLen );
+    }
+    return rfalNfcvPollerReadSingleBlock( 0x22, uid, firstBlock, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, rcvLen );
+  }
+  if(numBlocks > 1)
+  {
+    return rfalNfcvPollerExtendedReadMultipleBlocks( 0x22, uid, firstBlock, numBlocks - 1, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, rcvLen );
+  }
+  return rfalNfcvPollerExtendedReadSingleBlock( 0x22, uid, firstBlock, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, rcvLen );
+}
+
+/* Writes T5 blocks with the single or multiple blocks command matching the count and block numbers */
+static ReturnCode t5tWriteBlocks(uint16_t firstBlock, uint16_t numBlocks, const uint8_t* data)
+{
+  uint8_t txBuf[4 + 4 + RFAL_NFCV_UID_LEN + (BSP_NFCTAG_T5T_WRITE_MULTIPLE_BLOCKS * RFAL_NFCV_MAX_BLOCK_LEN)];
+  const uint8_t* uid = Current->dev.nfcv.InvRes.UID;
+  uint8_t blockSize = Caps->t5tBlockSize;
 
+  if((firstBlock + numBlocks - 1) <= 0xFF)
+  {
+    if(numBlocks > 1)
+    {
+      return rfalNfcvPollerWriteMultipleBlocks( 0x22, uid, firstBlock, numBlocks, txBuf, sizeof(txBuf), blockSize, data, numBlocks * blockSize );
+    }
+    return rfalNfcvPollerWriteSingleBlock( 0x22, uid, firstBlock, data, blockSize );
+  }
+  if(numBlocks > 1)
+  {
+    return rfalNfcvPollerExtendedWriteMultipleBlocks( 0x22, uid, firstBlock, numBlocks, txBuf, sizeof(txBuf), blockSize, data, numBlocks * blockSize );
+  }
+  return rfalNfcvPollerExtendedWriteSingleBlock( 0x22, uid, firstBlock, data, blockSize );
+}
 
 /* NFCV Tag read data */
 static uint8_t BSP_NFCTAG_ReadData_NfcV(uint8_t* buffer, uint32_t offset, uint32_t length)
 {
-
-  int i = 0;
-  uint16_t nbBytesRead = 0;
   uint8_t status = RFAL_ERR_NONE;
-  uint8_t  *txBuf;
-  uint16_t txBufLen;
   uint8_t rxBuf[BSP_NFCTAG_NFCV_RXBUF_LENGTH];
+  uint16_t blockSize;
+  uint16_t maxBlocks;
 
   if((Current->type != RFAL_NFC_LISTEN_TYPE_NFCV) || (length == 0))
   {
     return NFCTAG_ERROR;
   }
+  blockSize = Caps->t5tBlockSize;
+  maxBlocks = Caps->t5tMaxReadBlocks;
 
   // make sure the field is on
   rfalFieldOnAndStartGT();      
 
-  // stick with readSingleBlock
-  while(i < length)
+  while(length > 0)
   {
-    uint32_t rxLen = length - i;
-    if(rxLen > 0xF0)
+    uint16_t blockId = offset / blockSize;
+    uint16_t skip = offset % blockSize;
+    uint16_t numBlocks = (skip + length + blockSize - 1) / blockSize;
+    uint16_t nbBytesRead = 0;
+
+    if(numBlocks > maxBlocks)
     {
-      rxLen = 0xF0;
+      numBlocks = maxBlocks;
     }
-    
-    // first try to use readMultipleBlock
-    if(t5MultipleBlockSupport)
+    // without extended commands, don't cross the 8-bit block number boundary
+    if(!isVicinity && (Caps->t5tExtended != BSP_NFCTAG_CAP_SUPPORTED) && (blockId <= 0xFF) && ((blockId + numBlocks) > 0x100))
     {
-      if(isVicinity)
-      {
-        // use extended command
-        vicExtReadMultipleBlock[10] = ((offset + i) / t5BlockSize) & 0xFF;
-        vicExtReadMultipleBlock[11] = ((offset + i) / t5BlockSize) >> 8;
-        vicExtReadMultipleBlock[12] = ((rxLen - 1) / t5BlockSize) & 0xFF;
-        txBuf = vicExtReadMultipleBlock;
-        txBufLen = sizeof(vicExtReadMultipleBlock); 
-        memcpy(&txBuf[2],Current->dev.nfcv.InvRes.UID, 8);
-        nbBytesRead = rxLen;
-        status = rfalTransceiveBlockingTxRx( vicExtReadMultipleBlock, txBufLen, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, &nbBytesRead, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
-      } else if((offset + length) < 0xFF)
+      numBlocks = 0x100 - blockId;
+    }
+
+    status = t5tReadBlocks(blockId, numBlocks, rxBuf, &nbBytesRead);
+    if((status != RFAL_ERR_NONE) || (nbBytesRead != (1 + (numBlocks * blockSize))))
+    {
+      if(numBlocks == 1)
       {
-        nbBytesRead = 0xF0;
-        status = rfalNfcvPollerReadMultipleBlocks( 0x22, Current->dev.nfcv.InvRes.UID, (offset + i)/t5BlockSize, (rxLen - 1) / t5BlockSize, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH , &nbBytesRead);
-      } else {
-        // use extended command
-        t5ExtReadMultipleBlock[10] = ((offset + i) / t5BlockSize) & 0xFF;
-        t5ExtReadMultipleBlock[11] = ((offset + i) / t5BlockSize) >> 8;
-        t5ExtReadMultipleBlock[12] = ((rxLen - 1) / t5BlockSize) & 0xFF;
-        t5ExtReadMultipleBlock[13] = ((rxLen - 1) / t5BlockSize) >> 8;
-        txBuf = t5ExtReadMultipleBlock;
-        txBufLen = sizeof(t5ExtReadMultipleBlock); 
-        memcpy(&txBuf[2],Current->dev.nfcv.InvRes.UID,8);
-        nbBytesRead = rxLen;
-        status = rfalTransceiveBlockingTxRx( t5ExtReadMultipleBlock, txBufLen, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, &nbBytesRead, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
+        return NFCTAG_ERROR;
       }
+      // looks like read multiple blocks failed: retry with half as many blocks
+      maxBlocks = numBlocks / 2;
+      continue;
     }
-    if ((status != RFAL_ERR_NONE) || (!t5MultipleBlockSupport))
+    if(maxBlocks < Caps->t5tMaxReadBlocks)
     {
-      // looks like read multiple blocks failed!
-      t5MultipleBlockSupport = 0;
+      // remember the largest request the tag accepted
+      Caps->t5tMaxReadBlocks = maxBlocks;
+    }
 
-      // try read single block
-      if (isVicinity)
-      {
-        vicExtReadSingleBlock[10] = ((offset + i)/t5BlockSize) & 0xFF;
-        vicExtReadSingleBlock[11] = ((offset + i)/t5BlockSize) >> 8;
-        txBuf = vicExtReadSingleBlock;
-        txBufLen = sizeof(vicExtReadSingleBlock); 
-        nbBytesRead = t5BlockSize;
-        memcpy(&txBuf[2],Current->dev.nfcv.InvRes.UID,8);
-        status = rfalTransceiveBlockingTxRx( vicExtReadSingleBlock, txBufLen, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, &nbBytesRead, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
-      } else if (((offset + i)/t5BlockSize) < 0xFF)
-      {
-         nbBytesRead = t5BlockSize;
-         status = rfalNfcvPollerReadSingleBlock( 0x22, Current->dev.nfcv.InvRes.UID, (offset + i)/t5BlockSize,  rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, &nbBytesRead );
-      } else {
-        t5ExtReadSingleBlock[10] = ((offset + i)/t5BlockSize) & 0xFF;
-        t5ExtReadSingleBlock[11] = ((offset + i)/t5BlockSize) >> 8;
-        txBuf = t5ExtReadSingleBlock;
-        txBufLen = sizeof(t5ExtReadSingleBlock); 
-        nbBytesRead = t5BlockSize;
-        memcpy(&txBuf[2],Current->dev.nfcv.InvRes.UID,8);
-        status = rfalTransceiveBlockingTxRx( t5ExtReadSingleBlock, txBufLen, rxBuf, BSP_NFCTAG_NFCV_RXBUF_LENGTH, &nbBytesRead, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(20) );
-      }
+    // remove status byte & first bytes if offset is not aligned
+    nbBytesRead = nbBytesRead - 1 - skip;
+    if(nbBytesRead > length)
+    {
+      nbBytesRead = length;
     }
-    if ((status != RFAL_ERR_NONE) || (nbBytesRead < (1 + (offset+i)%4)))
-      return NFCTAG_ERROR;
-   // remove status byte & first bytes if offset is not aligned
-   nbBytesRead--;
-   nbBytesRead -= (offset + i) % t5BlockSize;
-   memcpy(buffer + i, &rxBuf[1 + ((offset + i) % t5BlockSize)],(nbBytesRead > length) ? length : nbBytesRead);
-   i += nbBytesRead;
+    memcpy(buffer, &rxBuf[1 + skip], nbBytesRead);
+    buffer += nbBytesRead;
+    offset += nbBytesRead;
+    length -= nbBytesRead;
   }
   return NFCTAG_OK;
 }
@@ -922,42 +1263,64 @@ static uint8_t BSP_NFCTAG_WriteData_NfcV(uint8_t* buffer, uint32_t offset, uint3
   uint32_t currentOffset = offset;
   uint32_t lastOffset = offset + length;
   uint8_t status;
-  uint8_t block[16] = {0};
+  uint8_t rxBuf[BSP_NFCTAG_NFCV_RXBUF_LENGTH];
+  uint8_t block[RFAL_NFCV_MAX_BLOCK_LEN] = {0};
   uint16_t nbBytesRead = 0;
-  uint16_t nbBytesToWrite = length;
-  uint8_t nbBytesWritten = 0;
+  uint16_t blockSize = Caps->t5tBlockSize;
 
   while(currentOffset < lastOffset)
   {
-    uint8_t blockInternalOffset = currentOffset % t5BlockSize;
-    uint8_t blockInternalLength = t5BlockSize - (currentOffset % t5BlockSize);
-    blockInternalLength = blockInternalLength > nbBytesToWrite ? nbBytesToWrite : blockInternalLength;
+    uint16_t blockId = currentOffset / blockSize;
+    uint8_t blockInternalOffset = currentOffset % blockSize;
+    uint32_t blockInternalLength = blockSize - blockInternalOffset;
+    blockInternalLength = blockInternalLength > (lastOffset - currentOffset) ? (lastOffset - currentOffset) : blockInternalLength;
 
-    if((blockInternalOffset) || (blockInternalLength%4))
+    if((blockInternalOffset) || (blockInternalLength < blockSize))
     {
-      status = rfalNfcvPollerReadSingleBlock( 0x22, Current->dev.nfcv.InvRes.UID, currentOffset/t5BlockSize,  block, 10, &nbBytesRead );
-      if((status != RFAL_ERR_NONE) || (block[0] != 0))
+      // partially written block: read, modify, write back
+      status = t5tReadBlocks(blockId, 1, rxBuf, &nbBytesRead);
+      if((status != RFAL_ERR_NONE) || (rxBuf[0] != 0) || (nbBytesRead < (1 + blockSize)))
       {
         return NFCTAG_ERROR;
       }
       // remove first byte (tag status)
-      memmove(block, &block[1], t5BlockSize);
+      memcpy(block, &rxBuf[1], blockSize);
       memcpy(&block[blockInternalOffset],buffer,blockInternalLength);
-      buffer += blockInternalLength;
-      nbBytesWritten = blockInternalLength;
+      status = t5tWriteBlocks(blockId, 1, block);
+    }
+    else
+    {
+      uint16_t numBlocks = (lastOffset - currentOffset) / blockSize;
 
-    } else {
-      memcpy(block, buffer, t5BlockSize);
-      buffer += t5BlockSize;
-      nbBytesWritten = t5BlockSize;
+      // Write Multiple Blocks within a group of blocks, falls back to single blocks if the tag rejects it
+      numBlocks = (numBlocks > (BSP_NFCTAG_T5T_WRITE_MULTIPLE_BLOCKS - (blockId % BSP_NFCTAG_T5T_WRITE_MULTIPLE_BLOCKS))) ? (BSP_NFCTAG_T5T_WRITE_MULTIPLE_BLOCKS - (blockId % BSP_NFCTAG_T5T_WRITE_MULTIPLE_BLOCKS)) : numBlocks;
+      status = RFAL_ERR_PARAM;
+      if((numBlocks > 1) && (Caps->t5tWriteMultiple != BSP_NFCTAG_CAP_REJECTED))
+      {
+        status = t5tWriteBlocks(blockId, numBlocks, buffer);
+        if(status == RFAL_ERR_NONE)
+        {
+          Caps->t5tWriteMultiple = BSP_NFCTAG_CAP_SUPPORTED;
+        }
+        else if(status == RFAL_ERR_NOTSUPP)
+        {
+          // the tag answered "command not supported": a transmission error or a failed write does not tell
+          Caps->t5tWriteMultiple = BSP_NFCTAG_CAP_REJECTED;
+        }
+      }
+      if(status != RFAL_ERR_NONE)
+      {
+        numBlocks = 1;
+        status = t5tWriteBlocks(blockId, 1, buffer);
+      }
+      blockInternalLength = numBlocks * blockSize;
     }
-    
-    status = rfalNfcvPollerWriteSingleBlock( 0x22, Current->dev.nfcv.InvRes.UID, currentOffset / t5BlockSize, block, t5BlockSize );
     if(status != RFAL_ERR_NONE)
     {
       return NFCTAG_ERROR;
     }
-    currentOffset +=nbBytesWritten;
+    buffer += blockInternalLength;
+    currentOffset += blockInternalLength;
   }
   return NFCTAG_OK;
 }
@@ -1009,6 +1372,7 @@ uint8_t BSP_NFCTAG_Init(rfalNfcDevice * device)
 
   // set current operating tag with provided instance
   Current = device;
+  Caps = BSP_NFCTAG_GetCaps(device);
 
   return NFCTAG_OK;
 
@@ -1052,6 +1416,7 @@ uint8_t BSP_NFCTAG_Activate(rfalNfcDevice * device)
 
   // set current operating tag with provided instance
   Current = device;
+  Caps = BSP_NFCTAG_GetCaps(device);
 
   if((CurrentProtocol != NULL) && (CurrentProtocol->activate != NULL))
   {
@@ -36,8 +36,27 @@
   * @{
   */ 
 
+/* Gesture events queue depth, consecutive moves are merged in a single event */
+#define TS_EVENT_QUEUE_SIZE     8
+/* Minimum displacement (in pixels) reported as a move */
+#define TS_MOVE_THRESHOLD       5
+
 static TS_DrvTypeDef     *TsDrv = NULL;
 static uint16_t          TsXBoundary, TsYBoundary;
+static uint8_t           TsITMode = 0;
+static volatile uint8_t  TsITPending = 0;
+static uint8_t           TsTouched = 0;
+static uint8_t           TsPressed = 0;
+static uint16_t          TsX = 0, TsY = 0;
+static TS_EventTypeDef   TsEvents[TS_EVENT_QUEUE_SIZE];
+static uint8_t           TsEventHead = 0, TsEventCount = 0;
+
+static void     TS_Service(void);
+static void     TS_Process(void);
+static void     TS_FilterSamples(uint16_t *x, uint16_t *y, uint8_t count);
+static uint16_t TS_Median(uint16_t *samples, uint8_t count);
+static void     TS_Calibrate(uint16_t x, uint16_t y, uint16_t *X, uint16_t *Y);
+static void     TS_PostEvent(TS_EventIdTypeDef Id);
 
 /**
   * @brief  Initializes and configures the touch screen functionalities and 
@@ -75,6 +94,8 @@ uint8_t BSP_TS_Init(uint16_t XSize, uint16_t YSize)
 
 /**
   * @brief  Configures and enables the touch screen interrupts.
+  *         Once enabled, the touch screen controller is only accessed when its
+  *         interrupt line has been asserted (touch, release or FIFO threshold).
   * @retval TS_OK: if ITconfig is OK. Other value if error.
   */
 uint8_t BSP_TS_ITConfig(void)
@@ -86,6 +107,11 @@ uint8_t BSP_TS_ITConfig(void)
     /* Enable the TS ITs */
     TsDrv->EnableIT(ST25_DISCOVERY_TS_I2C_ADDRESS);
     
+    /* Synchronize with the current controller state on next access */
+    TsITMode = 1;
+    TsTouched = stmpe811_TS_IsTouched(ST25_DISCOVERY_TS_I2C_ADDRESS);
+    TsITPending = 1;
+    
     ret = TS_OK;
   }
 
@@ -111,100 +137,295 @@ uint8_t BSP_TS_ITGetStatus(void)
 
 /**
   * @brief  Returns status and positions of the touch screen.
+  *         In interrupt mode, this function only accesses the I2C bus when the
+  *         touch screen controller has signaled new data.
   * @param  TsState: Pointer to touch screen current state structure
   */
 void BSP_TS_GetState(TS_StateTypeDef* TsState)
 {
-  static uint32_t _x = 0, _y = 0;
-  uint16_t xDiff, yDiff , x , y, xr, yr;
-  
   if(TsDrv == NULL)
   {
     TsState->TouchDetected = 0;
     TsState->X = 0;
     TsState->Y = 0;
+    return;
   }
-  else
+  
+  TS_Service();
+  
+  TsState->TouchDetected = TsPressed;
+  TsState->X = TsX;
+  TsState->Y = TsY;
+}
+
+/**
+  * @brief  Gets the oldest pending touch screen gesture event.
+  * @param  TsEvent: Pointer to the event structure to fill
+  * @retval 1 if an event has been returned, 0 if the queue is empty.
+  */
+uint8_t BSP_TS_GetEvent(TS_EventTypeDef *TsEvent)
+{
+  if(TsDrv == NULL)
   {
-    TsState->TouchDetected = TsDrv->DetectTouch(ST25_DISCOVERY_TS_I2C_ADDRESS);
+    return 0;
   }
   
-  if(TsState->TouchDetected)
+  TS_Service();
+  
+  if(TsEventCount == 0)
   {
-    TsDrv->GetXY(ST25_DISCOVERY_TS_I2C_ADDRESS, &x, &y);
-    
-    /* Y value first correction */
-    y -= 360;  
-    
-    /* Y value second correction */
-    yr = y / 11;
-    
-    /* Return y position value */
-    if(yr <= 0)
-    {
-      yr = 0;
-    }
-    else if (yr > TsYBoundary)
-    {
-      yr = TsYBoundary - 1;
-    }
-    else
-    {}
-    y = yr;
-    
-    /* X value first correction */
-    if(x <= 3000)
+    return 0;
+  }
+  
+  *TsEvent = TsEvents[TsEventHead];
+  TsEventHead = (TsEventHead + 1) % TS_EVENT_QUEUE_SIZE;
+  TsEventCount--;
+  
+  return 1;
+}
+
+/**
+  * @brief  Clears all touch screen interrupts.
+  */  
+void BSP_TS_ITClear(void)
+{
+  if(TsDrv != NULL)
+  {
+    /* Clear TS IT pending bits */
+    TsDrv->ClearIT(ST25_DISCOVERY_TS_I2C_ADDRESS);
+  }
+}
+
+/**
+  * @brief  Touch screen interrupt handler, to be called from the IO expander
+  *         EXTI handler. The controller is not accessed from interrupt context:
+  *         the FIFO is drained on next BSP_TS_GetState or BSP_TS_GetEvent call.
+  */
+void BSP_TS_IRQHandler(void)
+{
+  TsITPending = 1;
+}
+
+/**
+  * @brief  Accesses the touch screen controller only when needed: in interrupt
+  *         mode, when it has signaled new data or until the first sample of a
+  *         new touch is available (with window tracking, a steady touch only
+  *         stores a single sample, that does not reach the FIFO threshold).
+  */
+static void TS_Service(void)
+{
+  if((TsITMode == 0) || (TsITPending != 0) || ((TsTouched != 0) && (TsPressed == 0)))
+  {
+    TS_Process();
+  }
+}
+
+/**
+  * @brief  Reads the touch status and drains the touch screen FIFO, then updates
+  *         the touch state and posts the resulting gesture events.
+  */
+static void TS_Process(void)
+{
+  uint16_t x[STMPE811_TS_FIFO_BURST], y[STMPE811_TS_FIFO_BURST];
+  uint8_t  status = 0;
+  uint8_t  count;
+  
+  if(TsITMode != 0)
+  {
+    TsITPending = 0;
+    status = TsDrv->GetITStatus(ST25_DISCOVERY_TS_I2C_ADDRESS);
+  }
+  
+  /* In interrupt mode, the touch status only changes along with a touch interrupt */
+  if((TsITMode == 0) || ((status & STMPE811_GIT_TOUCH) != 0))
+  {
+    TsTouched = stmpe811_TS_IsTouched(ST25_DISCOVERY_TS_I2C_ADDRESS);
+  }
+  
+  /* A full burst means more samples may be left in the FIFO */
+  do
+  {
+    count = stmpe811_TS_ReadFIFO(ST25_DISCOVERY_TS_I2C_ADDRESS, x, y, STMPE811_TS_FIFO_BURST);
+    if(count > 0)
     {
-      x = 3870 - x;
+      TS_FilterSamples(x, y, count);
     }
-    else
+  } while(count == STMPE811_TS_FIFO_BURST);
+  
+  if(TsTouched == 0)
+  {
+    if(TsPressed != 0)
     {
-      x = 3800 - x;
+      TS_PostEvent(TS_EVENT_RELEASE);
     }
+    TsPressed = 0;
+  }
+  
+  if(status != 0)
+  {
+    /* Only clear the sources that have been handled */
+    stmpe811_ClearGlobalIT(ST25_DISCOVERY_TS_I2C_ADDRESS, status);
+  }
+  
+  /* The interrupt line is level driven: if a source has been raised in the
+     meantime, the line stays low and no new edge will be generated */
+  if((TsITMode != 0) && 
+     (HAL_GPIO_ReadPin(ST25_DISCOVERY_STMPE811_INT_GPIO_PORT, ST25_DISCOVERY_STMPE811_INT_PIN) == GPIO_PIN_RESET))
+  {
+    TsITPending = 1;
+  }
+}
+
+/**
+  * @brief  Filters a batch of raw samples (median) and updates the touch state.
+  *         Contact bounces are filtered out by the controller touch detection
+  *         delay: a press is validated by its first complete sample.
+  * @param  x: Raw X samples, sorted in place
+  * @param  y: Raw Y samples, sorted in place
+  * @param  count: Number of samples
+  */
+static void TS_FilterSamples(uint16_t *x, uint16_t *y, uint8_t count)
+{
+  uint16_t X, Y, xDiff, yDiff;
+  
+  TS_Calibrate(TS_Median(x, count), TS_Median(y, count), &X, &Y);
+  
+  if(TsPressed == 0)
+  {
+    TsPressed = 1;
+    TsX = X;
+    TsY = Y;
+    TS_PostEvent(TS_EVENT_PRESS);
+  }
+  else
+  {
+    xDiff = X > TsX ? (X - TsX) : (TsX - X);
+    yDiff = Y > TsY ? (Y - TsY) : (TsY - Y);
     
-    /* X value second correction */  
-    xr = x / 15;
-    
-    /* Return X position value */
-    if(xr <= 0)
+    if(xDiff + yDiff > TS_MOVE_THRESHOLD)
     {
-      xr = 0;
+      TsX = X;
+      TsY = Y;
+      TS_PostEvent(TS_EVENT_MOVE);
     }
-    else if (xr > TsXBoundary)
-    {
-      xr = TsXBoundary - 1;
-    }
-    else 
-    {}
-    
-    x = xr;
-    xDiff = x > _x? (x - _x): (_x - x);
-    yDiff = y > _y? (y - _y): (_y - y); 
-    
-    if (xDiff + yDiff > 5)
+  }
+}
+
+/**
+  * @brief  Returns the median value of a samples buffer.
+  * @param  samples: Samples buffer, sorted in place
+  * @param  count: Number of samples
+  * @retval Median value.
+  */
+static uint16_t TS_Median(uint16_t *samples, uint8_t count)
+{
+  uint16_t value;
+  uint8_t  i, j;
+  
+  for(i = 1; i < count; i++)
+  {
+    value = samples[i];
+    for(j = i; (j > 0) && (samples[j - 1] > value); j--)
     {
-      _x = x;
-      _y = TsYBoundary - y; 
+      samples[j] = samples[j - 1];
     }
-    
-    /* Update the X position */
-    TsState->X = _y;
-    
-    /* Update the Y position */  
-    TsState->Y = _x;
+    samples[j] = value;
   }
+  
+  return samples[count / 2];
 }
 
 /**
-  * @brief  Clears all touch screen interrupts.
-  */  
-void BSP_TS_ITClear(void)
+  * @brief  Converts raw controller coordinates to LCD coordinates.
+  * @param  x: Raw X value
+  * @param  y: Raw Y value
+  * @param  X: Pointer to LCD X position
+  * @param  Y: Pointer to LCD Y position
+  */
+static void TS_Calibrate(uint16_t x, uint16_t y, uint16_t *X, uint16_t *Y)
 {
-  if(TsDrv != NULL)
+  uint16_t xr, yr;
+  
+  /* Y value first correction */
+  y -= 360;  
+  
+  /* Y value second correction */
+  yr = y / 11;
+  
+  /* Return y position value */
+  if(yr <= 0)
   {
-    /* Clear TS IT pending bits */
-    TsDrv->ClearIT(ST25_DISCOVERY_TS_I2C_ADDRESS);
+    yr = 0;
+  }
+  else if (yr > TsYBoundary)
+  {
+    yr = TsYBoundary - 1;
+  }
+  else
+  {}
+  
+  /* X value first correction */
+  if(x <= 3000)
+  {
+    x = 3870 - x;
+  }
+  else
+  {
+    x = 3800 - x;
+  }
+  
+  /* X value second correction */  
+  xr = x / 15;
+  
+  /* Return X position value */
+  if(xr <= 0)
+  {
+    xr = 0;
   }
+  else if (xr > TsXBoundary)
+  {
+    xr = TsXBoundary - 1;
+  }
+  else 
+  {}
+  
+  /* Controller axes are swapped with regard to the LCD */
+  *X = TsYBoundary - yr;
+  *Y = xr;
+}
+
+/**
+  * @brief  Posts a gesture event at current position, the oldest event is
+  *         dropped if the queue is full.
+  * @param  Id: Event identifier
+  */
+static void TS_PostEvent(TS_EventIdTypeDef Id)
+{
+  uint8_t idx;
+  
+  if(TsEventCount > 0)
+  {
+    /* Merge consecutive moves */
+    idx = (TsEventHead + TsEventCount - 1) % TS_EVENT_QUEUE_SIZE;
+    if((Id == TS_EVENT_MOVE) && (TsEvents[idx].Id == TS_EVENT_MOVE))
+    {
+      TsEvents[idx].X = TsX;
+      TsEvents[idx].Y = TsY;
+      return;
+    }
+  }
+  
+  if(TsEventCount == TS_EVENT_QUEUE_SIZE)
+  {
+    TsEventHead = (TsEventHead + 1) % TS_EVENT_QUEUE_SIZE;
+    TsEventCount--;
+  }
+  
+  idx = (TsEventHead + TsEventCount) % TS_EVENT_QUEUE_SIZE;
+  TsEvents[idx].Id = Id;
+  TsEvents[idx].X = TsX;
+  TsEvents[idx].Y = TsY;
+  TsEventCount++;
 }
 
 
@@ -66,11 +66,28 @@ typedef enum
   TS_ERROR    = 0x01,
   TS_TIMEOUT  = 0x02
 }TS_StatusTypeDef;
+
+typedef enum 
+{
+  TS_EVENT_PRESS    = 0x01,
+  TS_EVENT_MOVE     = 0x02,
+  TS_EVENT_RELEASE  = 0x03
+}TS_EventIdTypeDef;
+
+typedef struct
+{
+  TS_EventIdTypeDef Id;
+  uint16_t X;
+  uint16_t Y;
+}TS_EventTypeDef;
+
 uint8_t BSP_TS_Init(uint16_t XSize, uint16_t YSize);
 void    BSP_TS_GetState(TS_StateTypeDef *TsState);
+uint8_t BSP_TS_GetEvent(TS_EventTypeDef *TsEvent);
 uint8_t BSP_TS_ITConfig(void);
 uint8_t BSP_TS_ITGetStatus(void);
 void    BSP_TS_ITClear(void);
+void    BSP_TS_IRQHandler(void);
 
 
 /**
@@ -88,9 +88,10 @@
 #define NDEF_T2T_MAX_RSVD_AREAS      3U                                                /*!< Number of reserved areas including 1 Dyn Lock area           */
 
 #define NDEF_T3T_BLOCK_SIZE         16U                                                /*!< size for a block in t3t                                      */
-#define NDEF_T3T_MAX_NB_BLOCKS       4U                                                /*!< size for a block in t3t                                      */
+#define NDEF_T3T_MAX_NB_BLOCKS       4U                                                /*!< Max number of blocks per UPDATE in t3t                       */
+#define NDEF_T3T_MAX_NB_READ_BLOCKS 15U                                                /*!< Max number of blocks per CHECK in t3t (T3T 1.0 5.4.1.10)     */
 #define NDEF_T3T_BLOCK_NUM_MAX_SIZE  3U                                                /*!< Maximun size for a block number                              */
-#define NDEF_T3T_MAX_RX_SIZE      ((NDEF_T3T_BLOCK_SIZE*NDEF_T3T_MAX_NB_BLOCKS) + 13U) /*!< size for a CHECK Response 13 bytes (LEN+07h+NFCID2+Status+Nos) + (block size x Max Nob)                                                */
+#define NDEF_T3T_MAX_RX_SIZE      ((NDEF_T3T_BLOCK_SIZE*NDEF_T3T_MAX_NB_READ_BLOCKS) + 13U) /*!< size for a CHECK Response 13 bytes (LEN+07h+NFCID2+Status+Nos) + (block size x Max Nob)                                                */
 #define NDEF_T3T_MAX_TX_SIZE      (((NDEF_T3T_BLOCK_SIZE + NDEF_T3T_BLOCK_NUM_MAX_SIZE) * NDEF_T3T_MAX_NB_BLOCKS) + 14U) \
                                                                                        /*!< size for an UPDATE command, 11 bytes (LEN+08h+NFCID2+Nos) + 2 bytes for 1 SC + 1 byte for NoB + (block size + block num Len) x Max NoB */
 
@@ -137,6 +138,14 @@ typedef enum {
     NDEF_STATE_READONLY    = 0x03U,                            /*!< Valid NDEF found. Read only                        */
 } ndefState;
 
+/*! NDEF presence check methods */
+typedef enum {
+    NDEF_PRES_CHK_AUTO          = 0x00U,                       /*!< Cheapest method known to work with the device      */
+    NDEF_PRES_CHK_READ          = 0x01U,                       /*!< Read command on the tag memory (e.g. ReadBinary)   */
+    NDEF_PRES_CHK_RF            = 0x02U,                       /*!< Protocol level probe: T4T R(NAK), T5T Inventory, T2T Read in current sector */
+    NDEF_PRES_CHK_ISODEP_IBLOCK = 0x03U,                       /*!< T4T: ISO-DEP I-Block with empty INF                */
+} ndefPresCheckMethod;
+
 /*! NDEF Information */
 typedef struct {
     uint8_t                  majorVersion;                     /*!< Major version                                      */
@@ -265,7 +274,7 @@ typedef struct {
     uint8_t                      NFCID2[RFAL_NFCF_NFCID2_LEN];        /*!< NFCID2                                                  */
     uint8_t                      txbuf[NDEF_T3T_MAX_TX_SIZE];         /*!< Tx buffer dedicated for T3T internal operations         */
     uint8_t                      rxbuf[NDEF_T3T_MAX_RX_SIZE];         /*!< Rx buffer dedicated for T3T internal operations         */
-    rfalNfcfBlockListElem        listBlocks[NDEF_T3T_MAX_NB_BLOCKS];  /*!< block number list for T3T internal operations           */
+    rfalNfcfBlockListElem        listBlocks[NDEF_T3T_MAX_NB_READ_BLOCKS]; /*!< block number list for T3T internal operations        */
 } ndefT3TContext;
 #endif
 
@@ -322,6 +331,7 @@ typedef struct {
     ndefDeviceType               type;                         /*!< NDEF Device type                                   */
     ndefDevice                   device;                       /*!< NDEF Device                                        */
     ndefState                    state;                        /*!< Tag state e.g. NDEF_STATE_INITIALIZED              */
+    ndefPresCheckMethod          presChk;                      /*!< Presence check method                              */
     ndefCapabilityContainer      cc;                           /*!< Capability Container                               */
     uint32_t                     messageLen;                   /*!< NDEF message length                                */
     uint32_t                     messageOffset;                /*!< NDEF message offset                                */
@@ -597,6 +607,26 @@ ndefStatus ndefPollerWriteMessage(ndefContext *ctx, const ndefMessage *message);
 ndefStatus ndefPollerCheckPresence(ndefContext *ctx);
 
 
+/*!
+ *****************************************************************************
+ * \brief Set Presence Check method
+ *
+ * This method selects how ndefPollerCheckPresence() probes the tag.
+ * NDEF_PRES_CHK_AUTO (default after ndefPollerContextInitialization()) uses
+ * the protocol level probe and falls back to a read command for the rest
+ * of the session if the device does not handle it.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   method : presence check method
+ *
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NOTSUPP      : Method not available for this tag type
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ndefStatus ndefPollerSetPresenceCheckMethod(ndefContext *ctx, ndefPresCheckMethod method);
+
+
 /*!
  *****************************************************************************
  * \brief Check Available Space
@@ -246,6 +246,7 @@ ndefStatus ndefPollerContextInitialization(ndefContext *ctx, const ndefDevice *d
     }
 
     ctx->ndefPollWrapper = ndefPollerWrappers[type];
+    ctx->presChk         = NDEF_PRES_CHK_AUTO;
 
     /* ndefPollWrapper is NULL when support of a given tag type is not enabled */
     if( (ctx->ndefPollWrapper == NULL) || (ctx->ndefPollWrapper->pollerContextInitialization == NULL) )
@@ -426,6 +427,25 @@ ndefStatus ndefPollerCheckPresence(ndefContext *ctx)
     return (ctx->ndefPollWrapper->pollerCheckPresence)(ctx);
 }
 
+/*******************************************************************************/
+ndefStatus ndefPollerSetPresenceCheckMethod(ndefContext *ctx, ndefPresCheckMethod method)
+{
+    if( (ctx == NULL) || (method > NDEF_PRES_CHK_ISODEP_IBLOCK) )
+    {
+        return ERR_PARAM;
+    }
+
+    /* Empty I-Block is ISO-DEP only, T3T has a single (Check) method */
+    if( ((method == NDEF_PRES_CHK_ISODEP_IBLOCK) && (ctx->type != NDEF_DEV_T4T)) ||
+        ((method == NDEF_PRES_CHK_RF) && (ctx->type == NDEF_DEV_T3T))               )
+    {
+        return ERR_NOTSUPP;
+    }
+
+    ctx->presChk = method;
+    return ERR_NONE;
+}
+
 /*******************************************************************************/
 ndefStatus ndefPollerCheckAvailableSpace(const ndefContext *ctx, uint32_t messageLen)
 {
@@ -1105,7 +1105,8 @@ ndefStatus ndefT2TPollerCheckPresence(ndefContext *ctx)
         return ERR_PARAM;
     }
 
-    blockAddr = 0U;
+    /* Stay in the current sector unless asked for the legacy read, SECTOR_SELECT is a two step exchange */
+    blockAddr = (ctx->presChk == NDEF_PRES_CHK_READ) ? 0U : ((uint16_t)ctx->subCtx.t2t.currentSecNo << 8U);
     ret = ndefT2TPollerReadBlock(ctx, blockAddr, ctx->subCtx.t2t.cacheBuf);
     if( ret != ERR_NONE )
     {
@@ -81,6 +81,7 @@
 #define NDEF_T3T_ATTRIB_INFO_BLOCK_NB         0U /*!< T3T attribute info block number                    */
 #define NDEF_T3T_BLOCKNB_CONF              0x80U /*!< T3T TxRx config value for Read/Write block         */
 #define NDEF_T3T_CHECK_NB_BLOCKS_LEN          1U /*!< T3T Length of the Nb of blocks in the CHECK reply  */
+#define NDEF_T3T_CHECK_RES_HDR_LEN  RFAL_NFCF_CHECK_RES_HDR_LEN /*!< T3T CHECK reply length up to the blocks data */
 
 
 /*
@@ -111,6 +112,7 @@
  * LOCAL FUNCTION PROTOTYPES
  ******************************************************************************
  */
+static ndefStatus ndefT3TPollerCheckBlocks                   (ndefContext *ctx, uint16_t blockNum, uint8_t nbBlocks, uint8_t *frameBuf);
 static ndefStatus ndefT3TPollerReadBlocks                    (ndefContext *ctx, uint16_t blockNum, uint8_t nbBlocks, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen);
 static ndefStatus ndefT3TPollerReadAttributeInformationBlock (ndefContext *ctx);
 
@@ -126,23 +128,17 @@ static ndefStatus ndefT3TPollerWriteAttributeInformationBlock(ndefContext *ctx);
  */
 
 /*******************************************************************************/
-static ndefStatus ndefT3TPollerReadBlocks(ndefContext *ctx, uint16_t blockNum, uint8_t nbBlocks, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+static ndefStatus ndefT3TPollerCheckBlocks(ndefContext *ctx, uint16_t blockNum, uint8_t nbBlocks, uint8_t *frameBuf)
 {
     ReturnCode                 ret;
-    uint16_t                   requestedDataSize;
+    uint16_t                   frameLen;
     rfalNfcfServBlockListParam servBlock;
     rfalNfcfBlockListElem*     listBlocks;
     uint8_t                    index;
     uint16_t                   rcvdLen = 0U;
     rfalNfcfServ               serviceCodeLst = 0x000BU; /* serviceCodeLst */
 
-    if( (ctx == NULL) || (ctx->type != NDEF_DEV_T3T) )
-    {
-        return ERR_PARAM;
-    }
-
-    requestedDataSize = (uint16_t)nbBlocks * NDEF_T3T_BLOCK_SIZE;
-    if( rxBufLen < requestedDataSize )
+    if( (nbBlocks == 0U) || (nbBlocks > NDEF_T3T_MAX_NB_READ_BLOCKS) )
     {
         return ERR_PARAM;
     }
@@ -161,22 +157,46 @@ static ndefStatus ndefT3TPollerReadBlocks(ndefContext *ctx, uint16_t blockNum, u
     servBlock.numBlock  = nbBlocks;
     servBlock.blockList = listBlocks;
 
-    ret = rfalNfcfPollerCheck(ctx->subCtx.t3t.NFCID2, &servBlock, ctx->subCtx.t3t.rxbuf, (uint16_t)sizeof(ctx->subCtx.t3t.rxbuf), &rcvdLen);
+    /* The response is kept as received: the blocks data lands at frameBuf[NDEF_T3T_CHECK_RES_HDR_LEN] */
+    frameLen = (uint16_t)(NDEF_T3T_CHECK_RES_HDR_LEN + ((uint16_t)nbBlocks * NDEF_T3T_BLOCK_SIZE));
+    ret = rfalNfcfPollerCheckInPlace(ctx->subCtx.t3t.NFCID2, &servBlock, frameBuf, frameLen, &rcvdLen);
     if (ret != RFAL_ERR_NONE)
     {
         return ERR_REQUEST;
     }
-    if( rcvdLen != (uint16_t)(NDEF_T3T_CHECK_NB_BLOCKS_LEN + requestedDataSize) )
+    if( (rcvdLen != frameLen) || (frameBuf[NDEF_T3T_CHECK_RES_HDR_LEN - NDEF_T3T_CHECK_NB_BLOCKS_LEN] != nbBlocks) )
     {
         return ERR_REQUEST;
     }
-    if( requestedDataSize > 0U )
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+static ndefStatus ndefT3TPollerReadBlocks(ndefContext *ctx, uint16_t blockNum, uint8_t nbBlocks, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+{
+    ndefStatus                 res;
+    uint16_t                   requestedDataSize;
+
+    if( (ctx == NULL) || (ctx->type != NDEF_DEV_T3T) )
     {
-        (void)ST_MEMMOVE( rxBuf, &ctx->subCtx.t3t.rxbuf[NDEF_T3T_CHECK_NB_BLOCKS_LEN], requestedDataSize );
-        if (rcvLen != NULL)
-        {
-            *rcvLen = requestedDataSize;
-        }
+        return ERR_PARAM;
+    }
+
+    requestedDataSize = (uint16_t)nbBlocks * NDEF_T3T_BLOCK_SIZE;
+    if( rxBufLen < requestedDataSize )
+    {
+        return ERR_PARAM;
+    }
+
+    res = ndefT3TPollerCheckBlocks(ctx, blockNum, nbBlocks, ctx->subCtx.t3t.rxbuf);
+    if (res != ERR_NONE)
+    {
+        return res;
+    }
+    (void)ST_MEMMOVE( rxBuf, &ctx->subCtx.t3t.rxbuf[NDEF_T3T_CHECK_RES_HDR_LEN], requestedDataSize );
+    if (rcvLen != NULL)
+    {
+        *rcvLen = requestedDataSize;
     }
     return ERR_NONE;
 }
@@ -184,112 +204,74 @@ static ndefStatus ndefT3TPollerReadBlocks(ndefContext *ctx, uint16_t blockNum, u
 /*******************************************************************************/
 ndefStatus ndefT3TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
 {
-    ndefStatus      res        = ERR_NONE;
-    uint16_t        nbRead     = 0U;
-    uint32_t        currentLen = len;
-    uint32_t        lvRcvLen   = 0U;
-    const uint16_t  blockLen   = (uint16_t) NDEF_T3T_BLOCKLEN;
-    uint16_t        startBlock = (uint16_t) (offset / blockLen);
-    uint16_t        startAddr  = (uint16_t) (startBlock * blockLen);
-    uint16_t        startOffset= (uint16_t) (offset -  (uint32_t) startAddr);
+    ndefStatus      res;
+    const uint32_t  blockLen   = (uint32_t) NDEF_T3T_BLOCKLEN;
+    uint32_t        endAddr;
+    uint32_t        startBlock;
+    uint32_t        nbTotal;
+    uint32_t        chunk;
+    uint32_t        chunkAddr;
+    uint32_t        chunkEnd;
+    uint32_t        cpyAddr;
+    uint32_t        cpyEnd;
     uint16_t        nbBlocks   = (uint16_t) NDEF_T3T_MAX_NB_BLOCKS;
+    uint16_t        nbChunk;
 
     ndefT3TLogD("ndefT3TPollerReadBytes offset: 0x%8.8x, Len %d\r\n", offset, len);
-    ndefT3TLogD("ndefT3TPollerReadBytes currentLen: %d, startBlock %d\r\n", currentLen, startBlock);
 
-    if( (ctx == NULL) || (ctx->type != NDEF_DEV_T3T) || (len == 0U) )
+    if( (ctx == NULL) || (ctx->type != NDEF_DEV_T3T) || (len == 0U) || (buf == NULL) )
     {
         return ERR_PARAM;
     }
-    if (ctx->state != NDEF_STATE_INVALID)
+    if ( (ctx->state != NDEF_STATE_INVALID) && (ctx->cc.t3t.nbR != 0U) )
     {
-        nbBlocks = MIN(ctx->cc.t3t.nbR, NDEF_T3T_MAX_NB_BLOCKS);
+        nbBlocks = MIN(ctx->cc.t3t.nbR, NDEF_T3T_MAX_NB_READ_BLOCKS);
     }
 
-    if ( startOffset != 0U )
-    {
-        /* Unaligned read, need to use a tmp buffer */
-        res = ndefT3TPollerReadBlocks(ctx, startBlock, 1U /* One block */ , ctx->subCtx.t3t.rxbuf, blockLen, &nbRead);
-        if (res != ERR_NONE)
-        {
-            /* Check result */
-            return res;
-        }
-        if (nbRead != NDEF_T3T_BLOCKLEN)
-        {
-            /* Check length */
-            return ERR_MEM_CORRUPT;
-        }
-
-        nbRead = (uint16_t) (nbRead - (uint16_t)startOffset);
-        if ((uint32_t) nbRead > currentLen)
-        {
-            nbRead = (uint16_t) currentLen;
-        }
-        if (nbRead > 0U)
-        {
-            (void)ST_MEMCPY(buf, &ctx->subCtx.t3t.rxbuf[offset], (uint32_t)nbRead);
-        }
-        lvRcvLen   += (uint32_t) nbRead;
-        currentLen -= (uint32_t) nbRead;
-        startBlock++;
-        ndefT3TLogD("ndefT3TPollerReadBytes currentLen: %d, startBlock %d\r\n", currentLen, startBlock);
-    }
+    /* Split the blocks covering [offset; offset+len[ in as few CHECKs as the tag allows.
+     * The unaligned head and tail blocks are part of the first and last CHECK.        */
+    endAddr    = offset + len;
+    startBlock = offset / blockLen;
+    nbTotal    = ((endAddr + (blockLen - 1U)) / blockLen) - startBlock;
+    chunk      = (nbTotal - 1U) / nbBlocks;
 
-    while ( currentLen >= (uint32_t)blockLen )
+    /* CHECKs are issued from the last one: a CHECK received straight into the caller
+     * buffer puts its response header on bytes which are still to be read            */
+    do
     {
-        if ( currentLen < ((uint32_t)blockLen * nbBlocks) )
-        {
-              /* Reduce the nb of blocks to read */
-              nbBlocks = (uint16_t) (currentLen / blockLen);
-        }
-        res = ndefT3TPollerReadBlocks(ctx, startBlock, (uint8_t)nbBlocks, ctx->subCtx.t3t.rxbuf, blockLen * nbBlocks, &nbRead);
-        if (res != ERR_NONE)
-        {
-            /* Check result */
-            return res;
-        }
-        if (nbRead != (blockLen * nbBlocks))
-        {
-            /* Check length */
-            return ERR_MEM_CORRUPT;
-        }
-        (void)ST_MEMCPY(&buf[lvRcvLen], ctx->subCtx.t3t.rxbuf, (uint32_t)currentLen);
-        lvRcvLen   += nbRead;
-        currentLen -= nbRead;
-        startBlock += nbBlocks;
-        ndefT3TLogD("ndefT3TPollerReadBytes currentLen: %d, startBlock %d\r\n", currentLen, startBlock);
-    }
+        chunkAddr = (startBlock + (chunk * nbBlocks)) * blockLen;
+        nbChunk   = (uint16_t) MIN((uint32_t)nbBlocks, nbTotal - (chunk * nbBlocks));
+        chunkEnd  = chunkAddr + ((uint32_t)nbChunk * blockLen);
+        ndefT3TLogD("ndefT3TPollerReadBytes block %d, nbBlocks %d\r\n", chunkAddr / blockLen, nbChunk);
 
-    if( currentLen > 0U )
-    {
-        /* Unaligned read, need to use a tmp buffer */
-        res = ndefT3TPollerReadBlocks(ctx, startBlock, 1U /* One block */, ctx->subCtx.t3t.rxbuf, blockLen, &nbRead);
-        if (res != ERR_NONE)
+        if( (chunkAddr >= (offset + NDEF_T3T_CHECK_RES_HDR_LEN)) && (chunkEnd <= endAddr) )
         {
-            /* Check result */
-            return res;
+            /* Aligned and room for the response header: zero-copy */
+            res = ndefT3TPollerCheckBlocks(ctx, (uint16_t)(chunkAddr / blockLen), (uint8_t)nbChunk, &buf[(chunkAddr - offset) - NDEF_T3T_CHECK_RES_HDR_LEN]);
+            if (res != ERR_NONE)
+            {
+                return res;
+            }
         }
-        if (nbRead != NDEF_T3T_BLOCKLEN)
+        else
         {
-            /* Check length */
-            return ERR_MEM_CORRUPT;
+            /* Unaligned head or tail, need to use a tmp buffer */
+            res = ndefT3TPollerCheckBlocks(ctx, (uint16_t)(chunkAddr / blockLen), (uint8_t)nbChunk, ctx->subCtx.t3t.rxbuf);
+            if (res != ERR_NONE)
+            {
+                return res;
+            }
+            cpyAddr = (chunkAddr > offset) ? chunkAddr : offset;
+            cpyEnd  = MIN(chunkEnd, endAddr);
+            (void)ST_MEMCPY(&buf[cpyAddr - offset], &ctx->subCtx.t3t.rxbuf[NDEF_T3T_CHECK_RES_HDR_LEN + (cpyAddr - chunkAddr)], cpyEnd - cpyAddr);
         }
-        /* currentLen > 0U */
-        (void)ST_MEMCPY(&buf[lvRcvLen], ctx->subCtx.t3t.rxbuf, (uint32_t)currentLen);
-        lvRcvLen   += (uint32_t) currentLen;
-        currentLen -= (uint32_t) currentLen;
-    }
+    } while( chunk-- > 0U );
 
-    if( currentLen != 0U )
-    {
-        res = ERR_SYSTEM;
-    }
     if( rcvdLen != NULL )
     {
-        *rcvdLen = lvRcvLen;
+        *rcvdLen = len;
     }
-    return res;
+    return ERR_NONE;
 }
 
 /*******************************************************************************/
@@ -845,13 +845,36 @@ ndefStatus ndefT4TPollerTagFormat(ndefContext *ctx, const ndefCapabilityContaine
 ndefStatus ndefT4TPollerCheckPresence(ndefContext *ctx)
 {
     rfalIsoDepApduTxRxParam  isoDepAPDU;
+    rfalIsoDepPresCheckParam presParam;
     ReturnCode               ret;
+    bool                     probeFailed;
 
     if( (ctx == NULL) || (ctx->type != NDEF_DEV_T4T) )
     {
         return ERR_PARAM;
     }
 
+    probeFailed = false;
+    if( ctx->presChk != NDEF_PRES_CHK_READ )
+    {
+        /* ISO-DEP level probe: no APDU, no selected file needed */
+        presParam.method = (ctx->presChk == NDEF_PRES_CHK_ISODEP_IBLOCK) ? RFAL_ISODEP_PRES_CHK_IBLOCK : RFAL_ISODEP_PRES_CHK_RNAK;
+        presParam.FWT    = ctx->subCtx.t4t.FWT;
+        presParam.dFWT   = ctx->subCtx.t4t.dFWT;
+        presParam.FSx    = ctx->subCtx.t4t.FSx;
+        presParam.DID    = ctx->subCtx.t4t.DID;
+
+        ret = rfalIsoDepPresenceCheck(presParam);
+        if( (ret == RFAL_ERR_NONE) || (ctx->presChk != NDEF_PRES_CHK_AUTO) )
+        {
+            return (ret == RFAL_ERR_NONE ? ERR_NONE : ERR_REQUEST);
+        }
+
+        /* No reply or not as ISO14443-4 mandates: the device may just ignore R(NAK),
+         * confirm with ReadBinary below and keep using it if the device answers     */
+        probeFailed = true;
+    }
+
     ndefT4TInitializeIsoDepTxRxParam(ctx, &isoDepAPDU);
     (void)rfalT4TPollerComposeReadData(isoDepAPDU.txBuf, 0, 1, &isoDepAPDU.txBufLen);
 
@@ -866,6 +889,12 @@ ndefStatus ndefT4TPollerCheckPresence(ndefContext *ctx)
         ret = rfalIsoDepGetApduTransceiveStatus();
     } while (ret == RFAL_ERR_BUSY);
 
+    if( probeFailed && (ret == RFAL_ERR_NONE) )
+    {
+        /* Present but the probe did not work: use ReadBinary from now on */
+        ctx->presChk = NDEF_PRES_CHK_READ;
+    }
+
     return (ret == RFAL_ERR_NONE ? ERR_NONE : ERR_REQUEST);
 }
 
@@ -729,15 +729,41 @@ ndefStatus ndefT5TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint
 /*******************************************************************************/
 ndefStatus ndefT5TIsDevicePresent(ndefContext *ctx)
 {
-    ndefStatus          ret;
-    uint16_t            blockAddr;
-    uint16_t            rcvLen;
+    ndefStatus           ret;
+    ReturnCode           rfalRet;
+    uint16_t             blockAddr;
+    uint16_t             rcvLen;
+    rfalNfcvInventoryRes invRes;
 
     if( (ctx == NULL) || (ctx->type != NDEF_DEV_T5T) )
     {
         return ERR_PARAM;
     }
 
+    /* Addressed mode: a 1 slot Inventory without mask is shorter than an addressed
+     * read (no UID in the request). Selected/non-addressed reads are already short */
+    if( (ctx->presChk == NDEF_PRES_CHK_RF) || ((ctx->presChk == NDEF_PRES_CHK_AUTO) && (ctx->subCtx.t5t.uid != NULL)) )
+    {
+        rfalRet = rfalNfcvPollerInventory(RFAL_NFCV_NUM_SLOTS_1, 0U, NULL, &invRes, &rcvLen);
+        if( (rfalRet == RFAL_ERR_NONE) && (ST_BYTECMP(invRes.UID, ctx->device.dev.nfcv.InvRes.UID, RFAL_NFCV_UID_LEN) == 0) )
+        {
+            return ERR_NONE;
+        }
+        if( (rfalRet == RFAL_ERR_TIMEOUT) && (ctx->presChk == NDEF_PRES_CHK_RF) )
+        {
+            return ERR_REQUEST;
+        }
+        /* Collision/other tag: confirm with an addressed read. On timeout in AUTO the
+         * tag may be quiet: if the read succeeds, use the read from now on */
+        ndefT5TInvalidateCache(ctx);
+        ret = ndefT5TPollerReadSingleBlock(ctx, 0U, ctx->subCtx.t5t.txrxBuf, (uint16_t)sizeof(ctx->subCtx.t5t.txrxBuf), &rcvLen);
+        if( (ret == ERR_NONE) && (rfalRet == RFAL_ERR_TIMEOUT) )
+        {
+            ctx->presChk = NDEF_PRES_CHK_READ;
+        }
+        return ret;
+    }
+
     ndefT5TInvalidateCache(ctx);
 
     blockAddr = 0U;
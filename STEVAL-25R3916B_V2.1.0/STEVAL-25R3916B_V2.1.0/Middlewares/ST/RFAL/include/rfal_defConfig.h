@@ -273,6 +273,10 @@
     #define platformLog(...)                           /*!< Log method                                    */
 #endif /* platformLog */
 
+#ifndef platformTrace
+    #define platformTrace( evt, val )                  /*!< Records a timestamped RF trace event          */
+#endif /* platformTrace */
+
 #ifndef platformAssert                                                                             
     #define platformAssert( exp )                      /*!< Asserts whether the given expression is true */
 #endif /* platformAssert */
@@ -415,6 +415,25 @@ typedef struct
     uint8_t                  DID;                      /*!< Device ID (RFAL_ISODEP_NO_DID if no DID) */
 } rfalIsoDepApduTxRxParam;
 
+
+/*! ISO DEP Presence Check methods (PCD only) */
+typedef enum
+{
+    RFAL_ISODEP_PRES_CHK_RNAK   = 0,                   /*!< R(NAK) with current block number, PICC replies R(ACK) without changing state  ISO14443-4 7.5.5 Rule 12 */
+    RFAL_ISODEP_PRES_CHK_IBLOCK = 1,                   /*!< I-Block with empty INF, PICC replies with an I-Block (block number advances) */
+} rfalIsoDepPresCheckMethod;
+
+
+/*! Structure of parameters used on ISO DEP Presence Check */
+typedef struct
+{
+    rfalIsoDepPresCheckMethod method;                  /*!< Presence check method                    */
+    uint32_t                  FWT;                     /*!< FWT to be used                           */
+    uint32_t                  dFWT;                    /*!< Delta FWT to be used                     */
+    uint16_t                  FSx;                     /*!< Other device Frame Size (FSC)            */
+    uint8_t                   DID;                     /*!< Device ID (RFAL_ISODEP_NO_DID if no DID) */
+} rfalIsoDepPresCheckParam;
+
 /*
  ******************************************************************************
  * GLOBAL FUNCTION PROTOTYPES
@@ -835,6 +854,68 @@ ReturnCode rfalIsoDepStartDeselect( void );
 ReturnCode rfalIsoDepGetDeselectStatus( void );
 
 
+/*! 
+ *****************************************************************************
+ *  \brief  Presence Check
+ *
+ *  This function verifies that the activated PICC is still in the field 
+ *  using a protocol level probe instead of an application (APDU) exchange.
+ *  It blocks until the probe has completed.
+ *
+ *  RFAL_ISODEP_PRES_CHK_RNAK sends a R(NAK) carrying the PCD's block number, 
+ *  which is always different from the PICC's one after a completed 
+ *  exchange. The PICC answers with R(ACK) and keeps its state, no 
+ *  application is involved and no file needs to be selected.
+ *  RFAL_ISODEP_PRES_CHK_IBLOCK sends an I-Block without INF, the answer 
+ *  I-Block is discarded.
+ *
+ *  \param[in]  param : presence check method and device parameters
+ *
+ *  \return RFAL_ERR_NONE        : PICC is present
+ *  \return RFAL_ERR_WRONG_STATE : Not in PCD role
+ *  \return RFAL_ERR_PROTO       : Unexpected block received
+ *  \return RFAL_ERR_TIMEOUT     : No response rcvd from PICC 
+ *
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepPresenceCheck( rfalIsoDepPresCheckParam param );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief  Start Presence Check
+ *
+ *  This function starts the presence check probe 
+ *  \see rfalIsoDepPresenceCheck
+ *
+ *  \param[in]  param : presence check method and device parameters
+ *
+ *  \return RFAL_ERR_NONE        : Presence check started
+ *  \return RFAL_ERR_WRONG_STATE : Not in PCD role
+ *  \return RFAL_ERR_PARAM       : Invalid parameter
+ *
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepStartPresenceCheck( rfalIsoDepPresCheckParam param );
+
+
+/*! 
+ *****************************************************************************
+ *  \brief  Get Presence Check Status
+ *
+ *  This function returns the status of the presence check started with
+ *  rfalIsoDepStartPresenceCheck()
+ *
+ *  \return RFAL_ERR_BUSY    : Operation is ongoing
+ *  \return RFAL_ERR_NONE    : PICC is present
+ *  \return RFAL_ERR_PROTO   : Unexpected block received
+ *  \return RFAL_ERR_TIMEOUT : No response rcvd from PICC 
+ *
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepGetPresenceCheckStatus( void );
+
+
 /*! 
  *****************************************************************************
  *  \brief  ISO-DEP Poller Handle NFC-A Activation
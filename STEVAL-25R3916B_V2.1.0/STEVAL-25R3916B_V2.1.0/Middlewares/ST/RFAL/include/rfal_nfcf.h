@@ -101,6 +101,7 @@
 #define RFAL_NFCF_CHECKUPDATE_RES_ST1_POS        9U      /*!< Check|Update Res Status Flag 1 position    T3T 1.0  Table 8  */
 #define RFAL_NFCF_CHECKUPDATE_RES_ST2_POS        10U     /*!< Check|Update Res Status Flag 2 position    T3T 1.0  Table 8  */
 #define RFAL_NFCF_CHECKUPDATE_RES_NOB_POS        11U     /*!< Check|Update Res Number of Blocks position T3T 1.0  Table 8  */
+#define RFAL_NFCF_CHECK_RES_HDR_LEN              13U     /*!< Check Res length up to the block data (LEN+Cmd+NFCID2+ST1+ST2+NoB) */
 
 #define RFAL_NFCF_STATUS_FLAG_SUCCESS            0x00U   /*!< Check response Number of Blocks position   T3T 1.0  Table 11 */
 #define RFAL_NFCF_STATUS_FLAG_ERROR              0xFFU   /*!< Check response Number of Blocks position   T3T 1.0  Table 11 */
@@ -398,6 +399,32 @@ ReturnCode rfalNfcfPollerGetCollisionResolutionStatus( void );
 ReturnCode rfalNfcfPollerCheck( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvdLen );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-F Poller Check/Read in place
+ *  
+ * Same as rfalNfcfPollerCheck() but the response is left as received: the 
+ * blocks data starts at rxBuf[RFAL_NFCF_CHECK_RES_HDR_LEN]. 
+ * This allows the caller to receive the blocks straight into their final 
+ * location, providing RFAL_NFCF_CHECK_RES_HDR_LEN bytes ahead of it.
+ *
+ * \param[in]  nfcid2      : nfcid2 of the device
+ * \param[in]  servBlock   : parameter containing the list of Services and
+ *                           Blocks to be addressed by this command
+ * \param[out] rxBuf       : buffer to place the check/read response
+ * \param[in]  rxBufLen    : size of the rxBuf
+ * \param[out] rcvdLen     : length of the response placed in rxBuf
+ *
+ * \return RFAL_ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return RFAL_ERR_PARAM        : Invalid parameters
+ * \return RFAL_ERR_IO           : Generic internal error
+ * \return RFAL_ERR_REQUEST      : The request was executed with error
+ * \return RFAL_ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerCheckInPlace( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvdLen );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-F Poller Update/Write
@@ -141,6 +141,9 @@ ReturnCode rfalSt25tbPollerCheckPresence( uint8_t *chipId );
  * retrieves its UID and then deselects.
  * In case only one device is identified the ST25TB device is left in select
  * state.
+ * When only a few devices are estimated to be left after a Pcall16 round,
+ * the collided slots are resolved by Selecting the possible Chip IDs
+ * instead of running a new round.
  *   
  * \param[in]  devLimit      : device limit value, and size st25tbDevList
  * \param[out] st25tbDevList : ST35TB listener device info
@@ -157,6 +160,33 @@ ReturnCode rfalSt25tbPollerCheckPresence( uint8_t *chipId );
  */
 ReturnCode rfalSt25tbPollerCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Inventory and Read
+ *  
+ * This method performs the same Collision resolution as 
+ * rfalSt25tbPollerCollisionResolution() and, on each device found, reads 
+ * nBlocks blocks while the device is selected and then sends a Completion.
+ * Completed devices no longer reply until the field is reset, which also 
+ * keeps them out of the rest of the inventory.
+ * A device whose blocks could not be read is not reported.
+ *   
+ * \param[in]  devLimit      : device limit value, and size st25tbDevList
+ * \param[out] st25tbDevList : ST35TB listener device info
+ * \param[out] devCnt        : Devices found counter
+ * \param[in]  blockAddress  : address of the first block to be read
+ * \param[in]  nBlocks       : number of blocks read on each device
+ * \param[out] blocks        : location to place the data read, nBlocks per
+ *                             device in st25tbDevList order (devLimit * nBlocks)
+ * 
+ * \return RFAL_ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return RFAL_ERR_PARAM        : Invalid parameters
+ * \return RFAL_ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerInventoryRead( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, uint8_t blockAddress, uint8_t nBlocks, rfalSt25tbBlock *blocks );
+
 /*! 
  *****************************************************************************
  * \brief  ST25TB Poller Initiate
@@ -133,6 +133,8 @@
 
 /*! Maximum length of control message (no INF) */
 #define ISODEP_CONTROLMSG_BUF_LEN       (RFAL_ISODEP_PCB_LEN + RFAL_ISODEP_DID_LEN + RFAL_ISODEP_NAD_LEN + ISODEP_SWTX_PARAM_LEN)
+#define ISODEP_PRES_CHK_INF_LEN         (8U)         /*!< INF bytes kept from a presence check reply (e.g. SW1 SW2) */
+#define ISODEP_PRES_CHK_BUF_LEN         (ISODEP_HDR_MAX_LEN + ISODEP_PRES_CHK_INF_LEN) /*!< Presence check buffer length */
 
 #define ISODEP_FWT_DEACTIVATION         (71680U)     /*!< FWT used for DESELECT  Digital 2.2 B10  ISO1444-4 7.2 & 8.1 */
 #define ISODEP_MAX_RERUNS               (0x0FFFFFFFU)/*!< Maximum rerun retrys for a blocking protocol run*/
@@ -344,6 +346,7 @@ typedef enum
     ISODEP_ST_PCD_TX,               /*!< PCD Transmission State         */
     ISODEP_ST_PCD_RX,               /*!< PCD Reception State            */
     ISODEP_ST_PCD_WAIT_DSL,         /*!< PCD Wait for DSL response      */
+    ISODEP_ST_PCD_WAIT_PRES,        /*!< PCD Wait for presence check    */
         
     ISODEP_ST_PICC_ACT_ATS,         /*!< PICC has replied to RATS (ATS) */
     ISODEP_ST_PICC_ACT_ATTRIB,      /*!< PICC has replied to ATTRIB     */
@@ -413,6 +416,9 @@ typedef struct{
   uint8_t         ctrlBuf[ISODEP_CONTROLMSG_BUF_LEN];    /*!< Control msg buf   */
   uint16_t        ctrlRxLen;  /*!< Control msg rcvd len                         */
   
+  rfalIsoDepPresCheckMethod presChk;                     /*!< Presence check method        */
+  uint8_t         presChkBuf[ISODEP_PRES_CHK_BUF_LEN];   /*!< Presence check buffer        */
+  
   union {  /*  PRQA S 0750 # MISRA 19.2 - Members of the union will not be used concurrently, only one frame at a time */      
     #if RFAL_FEATURE_NFCA
         rfalIsoDepRats       ratsReq;
@@ -1075,6 +1081,141 @@ ReturnCode rfalIsoDepGetDeselectStatus( void )
     return ret;
 }
 
+
+/*******************************************************************************/
+ReturnCode rfalIsoDepPresenceCheck( rfalIsoDepPresCheckParam param )
+{
+    ReturnCode ret;
+    
+    RFAL_EXIT_ON_ERR( ret, rfalIsoDepStartPresenceCheck( param ) );
+    rfalRunBlocking( ret, rfalIsoDepGetPresenceCheckStatus() );
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalIsoDepStartPresenceCheck( rfalIsoDepPresCheckParam param )
+{
+    ReturnCode ret;
+    
+    if( gIsoDep.role != ISODEP_ROLE_PCD )
+    {
+        return RFAL_ERR_WRONG_STATE;
+    }
+    
+    gIsoDep.fwt          = param.FWT;
+    gIsoDep.dFwt         = param.dFWT;
+    gIsoDep.fsx          = param.FSx;
+    gIsoDep.did          = param.DID;
+    gIsoDep.presChk      = param.method;
+    
+    /* Use the local presence check buffer, the reply is not forwarded */
+    gIsoDep.rxLen        = &gIsoDep.ctrlRxLen;
+    gIsoDep.rxBuf        = gIsoDep.presChkBuf;
+    gIsoDep.rxBufLen     = ISODEP_PRES_CHK_BUF_LEN - ISODEP_HDR_MAX_LEN;
+    gIsoDep.rxBufInfPos  = ISODEP_HDR_MAX_LEN;
+    gIsoDep.txBuf        = gIsoDep.presChkBuf;
+    gIsoDep.txBufInfPos  = ISODEP_HDR_MAX_LEN;
+    gIsoDep.txBufLen     = 0U;
+    gIsoDep.isTxChaining = false;
+    gIsoDep.isRxChaining = false;
+    rfalIsoDepClearCounters();
+    
+    gIsoDep.hdrLen = RFAL_ISODEP_PCB_LEN;
+    if ((gIsoDep.did != RFAL_ISODEP_NO_DID) && (gIsoDep.did != RFAL_ISODEP_DID_00))  { gIsoDep.hdrLen  += RFAL_ISODEP_DID_LEN;  }
+    if (gIsoDep.nad != RFAL_ISODEP_NO_NAD)  { gIsoDep.hdrLen  += RFAL_ISODEP_NAD_LEN;  }
+    
+    switch( param.method )
+    {
+        case RFAL_ISODEP_PRES_CHK_IBLOCK:
+            /* Empty I-Block goes through the regular data exchange */
+            gIsoDep.state = ISODEP_ST_PCD_TX;
+            return RFAL_ERR_NONE;
+            
+        case RFAL_ISODEP_PRES_CHK_RNAK:
+            ret = rfalIsoDepHandleControlMsg( ISODEP_R_NAK, RFAL_ISODEP_NO_PARAM );
+            gIsoDep.state = ((ret == RFAL_ERR_NONE) ? ISODEP_ST_PCD_WAIT_PRES : ISODEP_ST_IDLE);
+            return ret;
+            
+        default:
+            return RFAL_ERR_PARAM;
+    }
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalIsoDepGetPresenceCheckStatus( void )
+{
+    ReturnCode ret;
+    uint8_t    rxPCB;
+    bool       dummyB;
+    
+    if( gIsoDep.presChk == RFAL_ISODEP_PRES_CHK_IBLOCK )
+    {
+        /* Any correct I-Block reply (e.g. an error SW) proves presence */
+        RFAL_EXIT_ON_BUSY( ret, rfalIsoDepDataExchangePCD( gIsoDep.rxLen, &dummyB ) );
+        gIsoDep.state = ISODEP_ST_IDLE;
+        return ret;
+    }
+    
+    if( gIsoDep.state != ISODEP_ST_PCD_WAIT_PRES )
+    {
+        return RFAL_ERR_WRONG_STATE;
+    }
+    
+    ret = rfalGetTransceiveStatus();
+    switch( ret )
+    {
+        case RFAL_ERR_BUSY:
+            return RFAL_ERR_BUSY;
+            
+        /* Rule 4 - No/invalid reply -> R(NAK) again until R retries are exhausted */
+        case RFAL_ERR_TIMEOUT:
+        case RFAL_ERR_CRC:
+        case RFAL_ERR_PAR:
+        case RFAL_ERR_FRAMING:
+        case RFAL_ERR_INCOMPLETE_BYTE:
+            ret = rfalIsoDepHandleControlMsg( ISODEP_R_NAK, RFAL_ISODEP_NO_PARAM );
+            if( ret != RFAL_ERR_NONE )
+            {
+                gIsoDep.state = ISODEP_ST_IDLE;
+                return ret;
+            }
+            return RFAL_ERR_BUSY;
+            
+        case RFAL_ERR_NONE:
+            break;
+            
+        default:
+            gIsoDep.state = ISODEP_ST_IDLE;
+            return ret;
+    }
+    
+    gIsoDep.state = ISODEP_ST_IDLE;
+    *gIsoDep.rxLen = rfalConvBitsToBytes( *gIsoDep.rxLen );
+    
+    if( (*gIsoDep.rxLen) < gIsoDep.hdrLen )
+    {
+        return RFAL_ERR_PROTO;
+    }
+    
+    rxPCB = gIsoDep.rxBuf[ ISODEP_PCB_POS ];
+    if( (gIsoDep.did != RFAL_ISODEP_NO_DID) && (gIsoDep.did != RFAL_ISODEP_DID_00) && ( (!rfalIsoDep_PCBhasDID(rxPCB)) || (gIsoDep.did != gIsoDep.rxBuf[ ISODEP_DID_POS ])) )
+    {
+        return RFAL_ERR_PROTO;
+    }
+    
+    /* Rule 12 - R(ACK) with the PICC's block number, nothing to update on our side   */
+    /* Rule 11 - PICC re-sent its last I-Block (block numbers were equal), also keep  */
+    if( rfalIsoDep_PCBisRACK(rxPCB) || rfalIsoDep_PCBisIBlock(rxPCB) )
+    {
+        return RFAL_ERR_NONE;
+    }
+    
+    return RFAL_ERR_PROTO;
+}
+
 #endif /* RFAL_FEATURE_ISO_DEP_POLL */
 
 
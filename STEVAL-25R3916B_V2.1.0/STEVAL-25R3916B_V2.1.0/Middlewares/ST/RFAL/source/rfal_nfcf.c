@@ -161,6 +161,7 @@ static rfalNfcf gNfcf;  /*!< RFAL NFC-F instance  */
 ******************************************************************************
 */
 static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t *curDevIdx, uint8_t devLimit, bool overwrite, bool *nfcDepFound );
+static ReturnCode rfalNfcfPollerCheckInt( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvdLen, bool removeHdr );
 
 
 /*
@@ -427,7 +428,7 @@ ReturnCode rfalNfcfPollerGetCollisionResolutionStatus( void )
 }
 
 /*******************************************************************************/
-ReturnCode rfalNfcfPollerCheck( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvdLen )
+static ReturnCode rfalNfcfPollerCheckInt( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvdLen, bool removeHdr )
 {
     uint8_t       txBuf[RFAL_NFCF_CHECK_REQ_MAX_LEN];
     uint8_t       msgIt;
@@ -498,8 +499,8 @@ ReturnCode rfalNfcfPollerCheck( const uint8_t* nfcid2, const rfalNfcfServBlockLi
         {
             ret = RFAL_ERR_REQUEST;
         }
-        /* CHECK succesfull, remove header */
-        else
+        /* CHECK succesfull, remove header unless the caller wants it in place */
+        else if( removeHdr )
         {
             (*rcvdLen) -= (RFAL_NFCF_LENGTH_LEN + RFAL_NFCF_CHECKUPDATE_RES_NOB_POS);
             
@@ -508,12 +509,30 @@ ReturnCode rfalNfcfPollerCheck( const uint8_t* nfcid2, const rfalNfcfServBlockLi
                 RFAL_MEMMOVE( rxBuf, &checkRes[RFAL_NFCF_CHECKUPDATE_RES_NOB_POS], (*rcvdLen) );
             }
         }
+        else
+        {
+            /* MISRA 15.7 - Empty else */
+        }
     }
     
     return ret;
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerCheck( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvdLen )
+{
+    return rfalNfcfPollerCheckInt( nfcid2, servBlock, rxBuf, rxBufLen, rcvdLen, true );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerCheckInPlace( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvdLen )
+{
+    return rfalNfcfPollerCheckInt( nfcid2, servBlock, rxBuf, rxBufLen, rcvdLen, false );
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcfPollerUpdate( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock,  uint8_t *txBuf, uint16_t txBufLen, const uint8_t *blockData, uint8_t *rxBuf, uint16_t rxBufLen )
 {
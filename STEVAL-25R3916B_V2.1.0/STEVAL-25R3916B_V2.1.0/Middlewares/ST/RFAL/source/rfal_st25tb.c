@@ -61,6 +61,7 @@
 #define RFAL_ST25TB_SLOTS            16U                                /*!< ST25TB number of slots                           */
 #define RFAL_ST25TB_SLOTNUM_MASK     0x0FU                              /*!< ST25TB Slot Number bit mask on SlotMarker        */
 #define RFAL_ST25TB_SLOTNUM_SHIFT    4U                                 /*!< ST25TB Slot Number shift on SlotMarker           */
+#define RFAL_ST25TB_PROBE_MAX_DEVS   4U                                 /*!< ST25TB max estimated devices left resolved by Chip ID probing */
 
 #define RFAL_ST25TB_INITIATE_CMD1    0x06U                              /*!< ST25TB Initiate command byte1                    */
 #define RFAL_ST25TB_INITIATE_CMD2    0x00U                              /*!< ST25TB Initiate command byte2                    */
@@ -130,12 +131,37 @@ typedef struct
     rfalSt25tbBlock data;               /*!< Block Data                   */
 } rfalSt25tbWriteBlockReq;
 
+/*! Blocks read on each device found by the inventory */
+typedef struct
+{
+    uint8_t              blockAddress;  /*!< First block address          */
+    uint8_t              nBlocks;       /*!< Number of blocks per device  */
+    rfalSt25tbBlock      *blocks;       /*!< nBlocks per device, in order */
+} rfalSt25tbInvRead;
+
 
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Add Device
+ *  
+ * This method selects a device, retrieves its UID and, if requested, reads its
+ * blocks and sends it a Completion
+ *   
+ * \param[in]  chipId        : chip ID of the device
+ * \param[out] st25tbDevList : ST35TB listener device info
+ * \param[out] devCnt        : Devices found counter
+ * \param[in]  invRead       : blocks to read on each device, NULL if none
+ * 
+ * \return ret               : Select, Get UID or Read Block result
+ *****************************************************************************
+ */
+static ReturnCode rfalSt25tbPollerAddDevice( uint8_t chipId, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, const rfalSt25tbInvRead *invRead );
+
 /*! 
  *****************************************************************************
  * \brief  ST25TB Poller Do Collision Resolution
@@ -145,11 +171,49 @@ typedef struct
  * \param[in]  devLimit      : device limit value, and size st25tbDevList
  * \param[out] st25tbDevList : ST35TB listener device info
  * \param[out] devCnt        : Devices found counter
+ * \param[in]  invRead       : blocks to read on each device, NULL if none
  * 
- * \return colPending         : true if a collision was detected
+ * \return colSlots          : bit mask of the slots where a collision was detected
  *****************************************************************************
  */
-static bool rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt );
+static uint16_t rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, const rfalSt25tbInvRead *invRead );
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Probe Slots
+ *  
+ * This method resolves the collided slots of the last Pcall16 round without a
+ * new round: the devices of slot n still hold n in the 4 LSB of their Chip ID,
+ * so each of the 16 possible Chip IDs is tried with a Select
+ *   
+ * \param[in]  colSlots      : bit mask of the collided slots
+ * \param[in]  devLimit      : device limit value, and size st25tbDevList
+ * \param[out] st25tbDevList : ST35TB listener device info
+ * \param[out] devCnt        : Devices found counter
+ * \param[in]  invRead       : blocks to read on each device, NULL if none
+ * 
+ * \return colSlots          : bit mask of the slots that could not be resolved
+ *****************************************************************************
+ */
+static uint16_t rfalSt25tbPollerProbeSlots( uint16_t colSlots, uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, const rfalSt25tbInvRead *invRead );
+
+/*! 
+ *****************************************************************************
+ * \brief  ST25TB Poller Inventory
+ *  
+ * This method performs the ST25TB Collision resolution shared by
+ * rfalSt25tbPollerCollisionResolution() and rfalSt25tbPollerInventoryRead()
+ *   
+ * \param[in]  devLimit      : device limit value, and size st25tbDevList
+ * \param[out] st25tbDevList : ST35TB listener device info
+ * \param[out] devCnt        : Devices found counter
+ * \param[in]  invRead       : blocks to read on each device, NULL if none
+ * 
+ * \return RFAL_ERR_PARAM     : Invalid parameters
+ * \return RFAL_ERR_NONE      : No error
+ *****************************************************************************
+ */
+static ReturnCode rfalSt25tbPollerInventory( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, const rfalSt25tbInvRead *invRead );
 
 /*
 ******************************************************************************
@@ -158,14 +222,81 @@ static bool rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbL
 */
 
 
-static bool rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt )
+static ReturnCode rfalSt25tbPollerAddDevice( uint8_t chipId, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, const rfalSt25tbInvRead *invRead )
+{
+    uint8_t    i;
+    ReturnCode ret;
+    
+    st25tbDevList[*devCnt].chipID       = chipId;
+    st25tbDevList[*devCnt].isDeselected = false;
+    
+    /* Select Device, retrieve its UID  */
+    ret = rfalSt25tbPollerSelect( chipId );
+
+    /* By Selecting this device, the previous gets Deselected */
+    if( (*devCnt) > 0U )
+    {
+        st25tbDevList[(*devCnt)-1U].isDeselected = true;
+    }
+
+    if( (ret == RFAL_ERR_CRC) || (ret == RFAL_ERR_FRAMING) )
+    {
+        /* Several devices share this Chip ID and are now all Selected: put them back for the next Pcall16 round */
+        rfalSt25tbPollerResetToInventory();
+        return ret;
+    }
+
+    if( RFAL_ERR_NONE == ret )
+    {
+        ret = rfalSt25tbPollerGetUID( &st25tbDevList[*devCnt].UID );
+    }
+    
+    if( RFAL_ERR_NONE == ret )
+    {
+        /* A listed device put back by a Chip ID clash is found again: keep a single entry */
+        for( i = 0; i < *devCnt; i++ )
+        {
+            if( RFAL_BYTECMP( st25tbDevList[i].UID, st25tbDevList[*devCnt].UID, RFAL_ST25TB_UID_LEN ) == 0 )
+            {
+                st25tbDevList[i].chipID       = chipId;
+                st25tbDevList[i].isDeselected = false;
+                return RFAL_ERR_NONE;
+            }
+        }
+    }
+    
+    if( (RFAL_ERR_NONE == ret) && (invRead != NULL) )
+    {
+        /* Read while the device is still Selected, then retire it: it will not answer for the rest of the inventory */
+        for( i = 0; (i < invRead->nBlocks) && (RFAL_ERR_NONE == ret); i++ )
+        {
+            ret = rfalSt25tbPollerReadBlock( (invRead->blockAddress + i), &invRead->blocks[((uint16_t)(*devCnt) * invRead->nBlocks) + i] );
+        }
+        
+        if( RFAL_ERR_NONE == ret )
+        {
+            rfalSt25tbPollerCompletion();
+            st25tbDevList[*devCnt].isDeselected = true;
+        }
+    }
+
+    if( RFAL_ERR_NONE == ret )
+    {
+        (*devCnt)++;
+    }
+    
+    return ret;
+}
+
+
+static uint16_t rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, const rfalSt25tbInvRead *invRead )
 {
     uint8_t    i;
     uint8_t    chipId;
     ReturnCode ret;
-    bool col;
+    uint16_t   colSlots;
 
-    col = false;
+    colSlots = 0;
     
     for(i = 0; i < RFAL_ST25TB_SLOTS; i++)
     {
@@ -185,43 +316,152 @@ static bool rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbL
         if( ret == RFAL_ERR_NONE )
         {
             /* Found another device */
-            st25tbDevList[*devCnt].chipID       = chipId;
-            st25tbDevList[*devCnt].isDeselected = false;
-            
-            /* Select Device, retrieve its UID  */
-            ret = rfalSt25tbPollerSelect( chipId );
+            ret = rfalSt25tbPollerAddDevice( chipId, st25tbDevList, devCnt, invRead );
+        }
+        
+        if( (ret == RFAL_ERR_CRC) || (ret == RFAL_ERR_FRAMING) )
+        {
+            colSlots |= (uint16_t)(1U << i);
+        }
+        
+        if( *devCnt >= devLimit )
+        {
+            break;
+        }
+    }
+    return colSlots;
+}
+
 
-            /* By Selecting this device, the previous gets Deselected */
-            if( (*devCnt) > 0U )
+static uint16_t rfalSt25tbPollerProbeSlots( uint16_t colSlots, uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, const rfalSt25tbInvRead *invRead )
+{
+    uint8_t    slot;
+    uint8_t    i;
+    uint8_t    j;
+    uint8_t    chipId;
+    uint8_t    found;
+    bool       resolved;
+    uint16_t   pending;
+    ReturnCode ret;
+    
+    pending = 0;
+    
+    for( slot = 0; (slot < RFAL_ST25TB_SLOTS) && (*devCnt < devLimit); slot++ )
+    {
+        if( (colSlots & (1U << slot)) == 0U )
+        {
+            continue;
+        }
+        
+        found    = 0;
+        resolved = true;
+        
+        for( i = 0; (i < RFAL_ST25TB_SLOTS) && (*devCnt < devLimit); i++ )
+        {
+            chipId = (uint8_t)((i << RFAL_ST25TB_SLOTNUM_SHIFT) | slot);
+            
+            /* A device already listed would answer the Select as well */
+            for( j = 0; j < *devCnt; j++ )
             {
-                st25tbDevList[(*devCnt)-1U].isDeselected = true;
+                if( st25tbDevList[j].chipID == chipId )
+                {
+                    break;
+                }
             }
-
-            if( RFAL_ERR_NONE == ret )
+            if( j < *devCnt )
             {
-                ret = rfalSt25tbPollerGetUID( &st25tbDevList[*devCnt].UID );
+                resolved = false;
+                continue;
             }
-
-            if( RFAL_ERR_NONE == ret )
+            
+            ret = rfalSt25tbPollerAddDevice( chipId, st25tbDevList, devCnt, invRead );
+            if( ret == RFAL_ERR_NONE )
             {
-                (*devCnt)++;
+                found++;
+            }
+            else if( ret != RFAL_ERR_TIMEOUT )
+            {
+                /* Devices sharing the same Chip ID, or a device that could not be added */
+                resolved = false;
+            }
+            else
+            {
+                /* MISRA 15.7 - Empty else */
             }
         }
-        else if( (ret == RFAL_ERR_CRC) || (ret == RFAL_ERR_FRAMING) )
+        
+        /* A collided slot holds at least two devices, fewer means some were not heard */
+        if( (resolved == false) || (found < 2U) )
         {
-            col = true;
+            pending |= (uint16_t)(1U << slot);
         }
-        else
+    }
+    
+    return pending;
+}
+
+
+static ReturnCode rfalSt25tbPollerInventory( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, const rfalSt25tbInvRead *invRead )
+{
+    uint8_t    i;
+    uint8_t    chipId;
+    uint8_t    colCnt;
+    uint16_t   colSlots;
+    ReturnCode ret;
+    
+    if( (st25tbDevList == NULL) || (devCnt == NULL) || (devLimit == 0U) )
+    {
+        return RFAL_ERR_PARAM;
+    }
+    
+    *devCnt = 0;
+    
+    /* Step 1: Send Initiate */
+    ret = rfalSt25tbPollerInitiate( &chipId );
+    if( ret == RFAL_ERR_NONE )
+    {
+        /* If only 1 answer is detected retrieve its UID and keep it Selected */
+        rfalSt25tbPollerAddDevice( chipId, st25tbDevList, devCnt, invRead );
+    }
+    
+    /* Always proceed to Pcall16 anticollision as phase differences of tags can lead to no tag recognized, even if there is one */
+    while( *devCnt < devLimit )
+    {
+        /* Multiple device responses */
+        colSlots = rfalSt25tbPollerDoCollisionResolution( devLimit, st25tbDevList, devCnt, invRead );
+        if( colSlots == 0U )
         {
-            /* MISRA 15.7 - Empty else */
+            break;
         }
         
-        if( *devCnt >= devLimit )
+        /* Estimate the devices left (Schoute: 2.39 per collided slot). If only a few, *
+         * probe their Chip IDs rather than running a new round over all 16 slots    */
+        colCnt = 0;
+        for( i = 0; i < RFAL_ST25TB_SLOTS; i++ )
         {
-            break;
+            colCnt += (uint8_t)((colSlots >> i) & 1U);
+        }
+        
+        if( (((uint16_t)colCnt * 239U) / 100U) <= RFAL_ST25TB_PROBE_MAX_DEVS )
+        {
+            if( rfalSt25tbPollerProbeSlots( colSlots, devLimit, st25tbDevList, devCnt, invRead ) == 0U )
+            {
+                /* Devices of a slot missed by phase cancellation are still in Inventory: check with a single Initiate */
+                ret = rfalSt25tbPollerInitiate( &chipId );
+                if( ret == RFAL_ERR_TIMEOUT )
+                {
+                    break;
+                }
+                
+                if( ret == RFAL_ERR_NONE )
+                {
+                    rfalSt25tbPollerAddDevice( chipId, st25tbDevList, devCnt, invRead );
+                }
+            }
         }
     }
-    return col;
+
+    return RFAL_ERR_NONE;
 }
 
 
@@ -407,51 +647,25 @@ ReturnCode rfalSt25tbPollerGetUID( rfalSt25tbUID *UID )
 /*******************************************************************************/
 ReturnCode rfalSt25tbPollerCollisionResolution( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt )
 {
+    return rfalSt25tbPollerInventory( devLimit, st25tbDevList, devCnt, NULL );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerInventoryRead( uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, uint8_t blockAddress, uint8_t nBlocks, rfalSt25tbBlock *blocks )
+{
+    rfalSt25tbInvRead invRead;
     
-    uint8_t    chipId;
-    ReturnCode ret;
-    bool       detected;  /* collision or device was detected */
-    
-    if( (st25tbDevList == NULL) || (devCnt == NULL) || (devLimit == 0U) )
+    if( (blocks == NULL) || (nBlocks == 0U) )
     {
         return RFAL_ERR_PARAM;
     }
     
-    *devCnt = 0;
+    invRead.blockAddress = blockAddress;
+    invRead.nBlocks      = nBlocks;
+    invRead.blocks       = blocks;
     
-    /* Step 1: Send Initiate */
-    ret = rfalSt25tbPollerInitiate( &chipId );
-    if( ret == RFAL_ERR_NONE )
-    {
-        /* If only 1 answer is detected */
-        st25tbDevList[*devCnt].chipID       = chipId;
-        st25tbDevList[*devCnt].isDeselected = false;
-        
-        /* Retrieve its UID and keep it Selected*/
-        ret = rfalSt25tbPollerSelect( chipId );
-        
-        if( RFAL_ERR_NONE == ret )
-        {
-            ret = rfalSt25tbPollerGetUID( &st25tbDevList[*devCnt].UID );
-        }
-        
-        if( RFAL_ERR_NONE == ret )
-        {
-            (*devCnt)++;
-        }
-    }
-    /* Always proceed to Pcall16 anticollision as phase differences of tags can lead to no tag recognized, even if there is one */
-    if( *devCnt < devLimit )
-    {
-        /* Multiple device responses */
-        do
-        {
-            detected = rfalSt25tbPollerDoCollisionResolution( devLimit, st25tbDevList, devCnt );
-        }
-        while( (detected == true) && (*devCnt < devLimit) );
-    }
-
-    return RFAL_ERR_NONE;
+    return rfalSt25tbPollerInventory( devLimit, st25tbDevList, devCnt, &invRead );
 }
 
 
@@ -2009,6 +2009,7 @@ static void rfalTransceiveTx( void )
         #if 0 /* Debug purposes */
             rfalLogD( "RFAL: lastSt: %d curSt: %d \r\n", gRFAL.TxRx.lastState, gRFAL.TxRx.state );
         #endif
+        platformTrace( ST25R3916_TRACE_TXRX_STATE, (uint32_t)gRFAL.TxRx.state );
 
         gRFAL.TxRx.lastState = gRFAL.TxRx.state;
     }
@@ -2321,6 +2322,7 @@ static void rfalTransceiveRx( void )
         #if 0 /* Debug purposes */
             rfalLogD( "RFAL: lastSt: %d curSt: %d \r\n", gRFAL.TxRx.lastState, gRFAL.TxRx.state );
         #endif
+        platformTrace( ST25R3916_TRACE_TXRX_STATE, (uint32_t)gRFAL.TxRx.state );
 
         gRFAL.TxRx.lastState = gRFAL.TxRx.state;
     }
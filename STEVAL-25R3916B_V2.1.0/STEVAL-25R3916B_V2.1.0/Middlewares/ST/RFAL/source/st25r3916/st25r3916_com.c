@@ -180,6 +180,7 @@ static void st25r3916comStart( void )
 {
     /* Make this operation atomic, disabling ST25R3916 interrupt during communications*/
     platformProtectST25RComm();
+    platformTrace( ST25R3916_TRACE_COM_START, 0U );
     
 #ifdef RFAL_USE_I2C
     /* I2C Start and send Slave Address */
@@ -208,6 +209,7 @@ static void st25r3916comStop( void )
     /* Release the chip select */
     platformSpiDeselect();
 #endif /* RFAL_USE_I2C */
+    platformTrace( ST25R3916_TRACE_COM_STOP, 0U );
     
     /* reEnable the ST25R3916 interrupt */
     platformUnprotectST25RComm();
@@ -407,6 +409,8 @@ ReturnCode st25r3916ReadFifo( uint8_t* buf, uint16_t length )
         st25r3916comRepeatStart();
         st25r3916comRx( buf, length );
         st25r3916comStop();
+        
+        platformTrace( ST25R3916_TRACE_FIFO_READ, length );
     }
 
     return RFAL_ERR_NONE;
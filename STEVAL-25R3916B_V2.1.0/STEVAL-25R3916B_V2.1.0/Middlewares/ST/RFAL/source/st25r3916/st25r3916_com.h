@@ -81,6 +81,13 @@
 /*! Full Passive target memory length */
 #define ST25R3916_PTM_LEN                                   (ST25R3916_PTM_A_LEN + ST25R3916_PTM_B_LEN + ST25R3916_PTM_F_LEN + ST25R3916_PTM_TSN_LEN)
 
+/* RF trace events reported through platformTrace() */
+#define ST25R3916_TRACE_TXRX_STATE                          0x01U    /*!< Transceive state change, value: new rfalTransceiveState */
+#define ST25R3916_TRACE_IRQ                                 0x02U    /*!< Interrupts read from the chip, value: IRQ status  */
+#define ST25R3916_TRACE_COM_START                           0x03U    /*!< SPI/I2C transaction start                            */
+#define ST25R3916_TRACE_COM_STOP                            0x04U    /*!< SPI/I2C transaction end                              */
+#define ST25R3916_TRACE_FIFO_READ                           0x05U    /*!< FIFO read, value: number of bytes                    */
+
 
 
 
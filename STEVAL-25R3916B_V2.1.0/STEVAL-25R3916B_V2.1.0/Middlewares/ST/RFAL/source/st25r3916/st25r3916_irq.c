@@ -127,6 +127,8 @@ void st25r3916CheckForReceivedInterrupts( void )
        irqStatus |= (uint32_t)iregs[3]<<24;
    }
    
+   platformTrace( ST25R3916_TRACE_IRQ, irqStatus );
+   
    /* Forward all interrupts, even masked ones to application */
    platformProtectST25RIrqStatus();
    st25r3916interrupt.status |= irqStatus;
@@ -86,6 +86,7 @@
 #define RFAL_CMD_DISPATCHER                    0x68U    /*!< RFAL command dispatcher */
 
 #define RFAL_CMD_GET_TRANSCEIVE_RSSI           0x70U    /*!< Get Transceive RSSI */
+#define RFAL_CMD_GET_TRACE                     0x71U    /*!< Get RF transaction trace */
 
 #define ST25R3916_CMD_ADJUST_REGULATORS        0xD6U    /*!< Adjust regulators                                       */
 #define ST25R3916_CMD_MEASURE_VDD              0xDFU    /*!< Measure power supply voltage                            */
@@ -76,4 +76,33 @@ stError flash_PageErase(uint32_t pageStart, uint32_t nb, uint32_t bank);
  */
 stError flash_Program(uint32_t flashAddr, const uint64_t* data, uint32_t length);
 
+
+/*!
+ *****************************************************************************
+ * \brief Flash double ECC error handler
+ *
+ * To be called from NMI_Handler: a read of a double-word whose programming
+ * was interrupted (e.g. power loss) raises a double ECC error NMI. This
+ * function clears the error and latches its address for flash_EccError().
+ *
+ *****************************************************************************
+ */
+void flash_EccNmiHandler(void);
+
+
+/*!
+ *****************************************************************************
+ * \brief Check for a double ECC error in a Flash range
+ *
+ * Reports once a double ECC error latched by flash_EccNmiHandler() inside
+ * the given range. The data read there is not reliable.
+ *
+ * \param[in] flashAddr: Start address of the range
+ * \param[in] length:    Length in bytes of the range
+ *
+ * \return true if a double ECC error was detected in the range
+ *****************************************************************************
+ */
+bool flash_EccError(uint32_t flashAddr, uint32_t length);
+
 #endif /*__FLASH_DRIVER_H */
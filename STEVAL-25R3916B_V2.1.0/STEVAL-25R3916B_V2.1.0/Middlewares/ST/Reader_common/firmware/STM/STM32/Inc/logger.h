@@ -55,8 +55,29 @@
 * DEFINES
 ******************************************************************************
 */
-#define LOGGER_ON   1
-#define LOGGER_OFF  0
+#define LOGGER_ON      1
+#define LOGGER_OFF     0
+#define LOGGER_BINARY  2   /*!< Log calls record raw arguments, formatting is done on the host */
+
+#ifndef LOGGER_BIN_RING_WORDS
+#define LOGGER_BIN_RING_WORDS  512U   /*!< Binary log ring size in 32-bit words, power of 2 */
+#endif
+
+#define LOGGER_BIN_MAX_ARGS    8U     /*!< Maximum number of arguments recorded per log call */
+#define LOGGER_BIN_MAX_STR     68U    /*!< Maximum number of bytes recorded per %s argument  */
+#define LOGGER_BIN_SYNC        0xB1U  /*!< Binary record marker (bits 31..24 of first word)  */
+#define LOGGER_BIN_HEX_TAG     0x01U  /*!< First byte of a hex2Str() string in binary mode    */
+
+/*! Number of arguments following the format string (up to LOGGER_BIN_MAX_ARGS).
+ *  9 to 24 arguments expand to an undeclared identifier: the call does not compile */
+#define LOGGER_NARGS(...)      LOGGER_NARGS_(__VA_ARGS__, LOGGER_NARGS_X, LOGGER_NARGS_X, LOGGER_NARGS_X, LOGGER_NARGS_X, \
+                                             LOGGER_NARGS_X, LOGGER_NARGS_X, LOGGER_NARGS_X, LOGGER_NARGS_X,                 \
+                                             LOGGER_NARGS_X, LOGGER_NARGS_X, LOGGER_NARGS_X, LOGGER_NARGS_X,                 \
+                                             LOGGER_NARGS_X, LOGGER_NARGS_X, LOGGER_NARGS_X, LOGGER_NARGS_X,                 \
+                                             8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOGGER_NARGS_(fmt, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16,         \
+                      a17, a18, a19, a20, a21, a22, a23, a24, n, ...)  n
+#define LOGGER_NARGS_X         logger_binary_mode_supports_up_to_8_arguments
 
 /*!
  *****************************************************************************
@@ -78,10 +99,58 @@ extern void logUsartInit(UART_HandleTypeDef *husart);
  */
 extern int logUsart(const char* format, ...);
 
+/*!
+ *****************************************************************************
+ *  \brief  Records a log call into the binary log ring
+ *
+ *  Used in place of logUsart() when USE_LOGGER is LOGGER_BINARY: no
+ *  formatting is done on the target. Each call stores a record of
+ *  little-endian 32-bit words:
+ *   - word 0 : LOGGER_BIN_SYNC << 24 | sequence << 8 | number of argument words
+ *   - word 1 : address of the format string (resolved from the ELF on host)
+ *   - word 2 : timestamp (DWT cycle counter)
+ *   - word 3.. : the arguments, in order. A %s argument is its byte count n
+ *                followed by the n bytes (no terminating 0, at most
+ *                LOGGER_BIN_MAX_STR) padded to words, any other argument a
+ *                32-bit value.
+ *
+ *  A %s string built by hex2Str() holds LOGGER_BIN_HEX_TAG, the data length
+ *  and the raw data: the host formats it in hex. 64-bit and floating point
+ *  arguments are not supported. A gap in the sequence tells records were
+ *  dropped because the ring was full. Utilities/LogDecoder decodes records.
+ *
+ *  \param[in] nargs : number of arguments following format
+ *  \param[in] format : printf-like format string, must reside in flash
+ *
+ *  \return number of words recorded, 0 if the record was dropped
+ *
+ *****************************************************************************
+ */
+extern int logBinary(uint32_t nargs, const char* format, ...);
+
+/*!
+ *****************************************************************************
+ *  \brief  Sends pending binary log records
+ *
+ *  To be called from the application idle loop. Uses DMA when the UART has a
+ *  Tx DMA channel linked, blocking transfer otherwise. Does nothing unless
+ *  USE_LOGGER is LOGGER_BINARY.
+ *
+ *****************************************************************************
+ */
+extern void logUsartFlush(void);
+
+#if (USE_LOGGER == LOGGER_BINARY)
+#define logUsart(...)          logBinary(LOGGER_NARGS(__VA_ARGS__), __VA_ARGS__)
+#endif
+
 /*!
  *****************************************************************************
  *  \brief  helper to convert hex data into formated string
  *
+ *  In LOGGER_BINARY mode the data is only copied, tagged for logBinary(),
+ *  the string is formatted by the host decoder.
+ *
  *  \param[in] data : pointer to buffer to be dumped.
  *
  *  \param[in] dataLen : buffer length
@@ -51,6 +51,11 @@
 * GLOBAL DEFINES
 ******************************************************************************
 */
+#ifndef TIMER_TRACE_LEN
+#define TIMER_TRACE_LEN              256U   /*!< Number of RF trace entries kept, power of 2 */
+#endif
+
+#define TIMER_TRACE_ENTRY_LEN        8U     /*!< Length of an exported RF trace entry        */
  
  /*! 
  *****************************************************************************
@@ -125,4 +130,51 @@ void timerStopwatchStart( void );
  */
 uint32_t timerStopwatchMeasure( void );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  Trace Record
+ *  
+ * Records an RF trace event with a microsecond timestamp. Called through 
+ * platformTrace() when RFAL_TRACE is defined, from main loop or ISR context.
+ * The event is dropped if the trace buffer is full.
+ * 
+ * \param[in]  evt : event identifier (ST25R3916_TRACE_xxx)
+ * \param[in]  val : event value
+ *****************************************************************************
+ */
+void timerTraceRecord( uint8_t evt, uint32_t val );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  Trace Read
+ *  
+ * Moves the oldest recorded trace events into the given buffer. Each entry
+ * is TIMER_TRACE_ENTRY_LEN bytes, little endian:
+ *   - bytes 0..2 : time in us since the previous entry (since the clear for
+ *                  the first one), 0xFFFFFF if 16 s or more
+ *   - byte  3    : event identifier
+ *   - bytes 4..7 : event value
+ * 
+ * \param[out] buf    : buffer where to place the entries
+ * \param[in]  bufLen : buffer length
+ * \param[out] lost   : number of events dropped since last read (may be NULL)
+ *
+ * \return Number of entries placed in buf, always 0 if RFAL_TRACE is not defined
+ *****************************************************************************
+ */
+uint16_t timerTraceRead( uint8_t *buf, uint16_t bufLen, uint16_t *lost );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  Trace Clear
+ *  
+ * Discards all recorded trace events and restarts the time reference. The
+ * cycle counter is enabled if needed but not reset (shared with the logger)
+ *****************************************************************************
+ */
+void timerTraceClear( void );
+
 #endif /* TIMER_H */
@@ -42,6 +42,12 @@
 #include "main.h"
 
 
+#if defined(STM32L4)
+static volatile bool     flashEccErr;   /* double ECC error latched by the NMI */
+static volatile uint32_t flashEccAddr;  /* ... and its address                */
+#endif /* STM32L4 */
+
+
 /*!
  *****************************************************************************
  * \brief Erase given page(s) in Flash
@@ -197,3 +203,52 @@ stError flash_Program(uint32_t flashAddr, const uint64_t* data, uint32_t length)
     }
     return err;
 }
+
+/*!
+ *****************************************************************************
+ * \brief Flash double ECC error handler
+ *
+ * Clear ECCD so that the NMI is not raised again and latch the address.
+ *
+ *****************************************************************************
+ */
+void flash_EccNmiHandler(void)
+{
+#if defined(STM32L4)
+    uint32_t eccr = FLASH->ECCR;
+
+    if ((eccr & FLASH_FLAG_ECCD) != 0U)
+    {
+        flashEccAddr = FLASH_BASE + (eccr & FLASH_ECCR_ADDR_ECC);
+#if defined(FLASH_ECCR_BK_ECC)
+        if ((eccr & FLASH_ECCR_BK_ECC) != 0U)
+        {
+            flashEccAddr += FLASH_BANK_SIZE;
+        }
+#endif
+        flashEccErr = true;
+        __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ECCD);
+    }
+#endif /* STM32L4 */
+}
+
+/*!
+ *****************************************************************************
+ * \brief Check for a double ECC error in a Flash range
+ *
+ *****************************************************************************
+ */
+bool flash_EccError(uint32_t flashAddr, uint32_t length)
+{
+#if defined(STM32L4)
+    if (flashEccErr && (flashEccAddr >= (flashAddr & ~(sizeof(uint64_t) - 1U))) && (flashEccAddr < (flashAddr + length)))
+    {
+        flashEccErr = false;
+        return true;
+    }
+#else
+    (void)flashAddr;
+    (void)length;
+#endif /* STM32L4 */
+    return false;
+}
@@ -45,13 +45,29 @@
 */
 
 
-#if (USE_LOGGER == LOGGER_ON)
+#if (USE_LOGGER == LOGGER_ON) || (USE_LOGGER == LOGGER_BINARY)
 #define MAX_HEX_STR         4
 #define MAX_HEX_STR_LENGTH  128
 char hexStr[MAX_HEX_STR][MAX_HEX_STR_LENGTH];
 uint8_t hexStrIdx = 0;
 #endif /* #if USE_LOGGER == LOGGER_ON */
 
+#if (USE_LOGGER == LOGGER_BINARY)
+#define LOGGER_BIN_RING_MASK  (LOGGER_BIN_RING_WORDS - 1U)
+#define LOGGER_BIN_HDR_WORDS  3U
+
+/* Written by log calls (any context) under a short critical section, read by the flush */
+static uint32_t          logBinRing[LOGGER_BIN_RING_WORDS];
+static volatile uint32_t logBinHead = 0;
+/* Only written by logUsartFlush() */
+static volatile uint32_t logBinTail = 0;
+static uint32_t          logBinTxWords = 0;  /* Words handed to the DMA */
+static uint16_t          logBinSeq = 0;
+
+static uint32_t logBinStrArgs(const char* format);
+static uint32_t logBinStrLen(const char* str);
+#endif /* #if USE_LOGGER == LOGGER_BINARY */
+
 
 #if (USE_LOGGER == LOGGER_OFF && !defined(HAL_UART_MODULE_ENABLED))
   #define UART_HandleTypeDef void
@@ -71,6 +87,12 @@ uint8_t logUsartTx(uint8_t *data, uint16_t dataLen);
 void logUsartInit(UART_HandleTypeDef *husart)
 {
     pLogUsart = husart;
+
+  #if (USE_LOGGER == LOGGER_BINARY)
+    /* Timestamps use the cycle counter, shared with the RF trace: never reset it */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+  #endif /* #if USE_LOGGER == LOGGER_BINARY */
 }
 
 /**
@@ -86,7 +108,7 @@ uint8_t logUsartTx(uint8_t *data, uint16_t dataLen)
   {
     return HAL_ERROR;
   }
-  #if (USE_LOGGER == LOGGER_ON)
+  #if (USE_LOGGER == LOGGER_ON) || (USE_LOGGER == LOGGER_BINARY)
   {
     return HAL_UART_Transmit(pLogUsart, data, dataLen, USART_TIMEOUT);
   }
@@ -97,6 +119,7 @@ uint8_t logUsartTx(uint8_t *data, uint16_t dataLen)
   #endif /* #if USE_LOGGER == LOGGER_ON */
 }
 
+#if (USE_LOGGER != LOGGER_BINARY)
 int logUsart(const char* format, ...)
 {
   #if (USE_LOGGER == LOGGER_ON)
@@ -118,12 +141,245 @@ int logUsart(const char* format, ...)
   }
   #endif /* #if USE_LOGGER == LOGGER_ON */
 }
+#endif /* #if USE_LOGGER != LOGGER_BINARY */
+
+#if (USE_LOGGER == LOGGER_BINARY)
+/* Bit i set when argument i of format is a %s */
+static uint32_t logBinStrArgs(const char* format)
+{
+  uint32_t mask = 0;
+  uint32_t idx = 0;
+  const char *p = format;
+
+  while( (*p != '\0') && (idx < LOGGER_BIN_MAX_ARGS) )
+  {
+    if( *p++ != '%' )
+    {
+      continue;
+    }
+    if( *p == '%' )
+    {
+      p++;
+      continue;
+    }
+    while( (*p == '-') || (*p == '+') || (*p == ' ') || (*p == '#') || (*p == '0') )
+    {
+      p++;
+    }
+    /* Width and precision given as '*' take an argument */
+    if( *p == '*' )
+    {
+      idx++;
+      p++;
+    }
+    while( (*p >= '0') && (*p <= '9') )
+    {
+      p++;
+    }
+    if( *p == '.' )
+    {
+      p++;
+      if( *p == '*' )
+      {
+        idx++;
+        p++;
+      }
+      while( (*p >= '0') && (*p <= '9') )
+      {
+        p++;
+      }
+    }
+    while( (*p == 'h') || (*p == 'l') || (*p == 'z') || (*p == 'j') || (*p == 't') )
+    {
+      p++;
+    }
+    if( (*p == 's') && (idx < LOGGER_BIN_MAX_ARGS) )
+    {
+      mask |= (1UL << idx);
+    }
+    if( *p != '\0' )
+    {
+      p++;
+    }
+    idx++;
+  }
+  return mask;
+}
+
+/* Number of bytes of a %s argument to record */
+static uint32_t logBinStrLen(const char* str)
+{
+  uint32_t len = 0;
+
+  if( str == NULL )
+  {
+    return 0;
+  }
+  if( (uint8_t)str[0] == LOGGER_BIN_HEX_TAG )
+  {
+    /* hex2Str() data: tag, length, raw bytes */
+    len = 2U + (uint8_t)str[1];
+  }
+  else
+  {
+    while( (len < LOGGER_BIN_MAX_STR) && (str[len] != '\0') )
+    {
+      len++;
+    }
+  }
+  return (len > LOGGER_BIN_MAX_STR) ? LOGGER_BIN_MAX_STR : len;
+}
+#endif /* #if USE_LOGGER == LOGGER_BINARY */
+
+int logBinary(uint32_t nargs, const char* format, ...)
+{
+  #if (USE_LOGGER == LOGGER_BINARY)
+  {
+    uint32_t    arg[LOGGER_BIN_MAX_ARGS];
+    const char *str[LOGGER_BIN_MAX_ARGS];
+    uint32_t    strArgs;
+    uint32_t    argWords = 0;
+    uint32_t    words;
+    uint32_t    pos;
+    uint32_t    primask;
+    uint32_t    i;
+    uint32_t    j;
+    va_list     argptr;
+
+    /* Collect the arguments, strings are copied into the record */
+    strArgs = logBinStrArgs(format);
+    va_start(argptr, format);
+    for( i = 0; i < nargs; i++ )
+    {
+      if( (strArgs & (1UL << i)) != 0U )
+      {
+        str[i]    = va_arg(argptr, const char*);
+        arg[i]    = logBinStrLen(str[i]);
+        argWords += 1U + ((arg[i] + 3U) / 4U);
+      }
+      else
+      {
+        arg[i]    = va_arg(argptr, uint32_t);
+        argWords += 1U;
+      }
+    }
+    va_end(argptr);
+    words = LOGGER_BIN_HDR_WORDS + argWords;
+
+    /* Reserve and fill the record atomically versus interrupts */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    pos = logBinHead;
+    if( (pos - logBinTail + words) > LOGGER_BIN_RING_WORDS )
+    {
+      /* Ring full: drop, the sequence gap tells the host */
+      logBinSeq++;
+      __set_PRIMASK(primask);
+      return 0;
+    }
+    logBinRing[pos++ & LOGGER_BIN_RING_MASK] = ((uint32_t)LOGGER_BIN_SYNC << 24) | ((uint32_t)logBinSeq++ << 8) | argWords;
+    logBinRing[pos++ & LOGGER_BIN_RING_MASK] = (uint32_t)format;
+    logBinRing[pos++ & LOGGER_BIN_RING_MASK] = DWT->CYCCNT;
+    for( i = 0; i < nargs; i++ )
+    {
+      logBinRing[pos++ & LOGGER_BIN_RING_MASK] = arg[i];
+      if( (strArgs & (1UL << i)) != 0U )
+      {
+        for( j = 0; j < arg[i]; j += 4U )
+        {
+          uint32_t w = 0;
+          uint32_t n = ((arg[i] - j) < 4U) ? (arg[i] - j) : 4U;
+          memcpy(&w, &str[i][j], n);
+          logBinRing[pos++ & LOGGER_BIN_RING_MASK] = w;
+        }
+      }
+    }
+    logBinHead = pos;
+    __set_PRIMASK(primask);
+
+    return (int)words;
+  }
+  #else
+  {
+    return 0;
+  }
+  #endif /* #if USE_LOGGER == LOGGER_BINARY */
+}
+
+void logUsartFlush(void)
+{
+  #if (USE_LOGGER == LOGGER_BINARY)
+  {
+    uint32_t tail = logBinTail;
+    uint32_t start;
+    uint32_t words;
+
+    if(pLogUsart == 0)
+    {
+      return;
+    }
+
+    if(logBinTxWords != 0U)
+    {
+      /* Previous DMA transfer still ongoing */
+      if(pLogUsart->gState != HAL_UART_STATE_READY)
+      {
+        return;
+      }
+      tail += logBinTxWords;
+      logBinTxWords = 0;
+      logBinTail = tail;
+    }
+
+    /* Send the contiguous part of the pending records */
+    start = tail & LOGGER_BIN_RING_MASK;
+    words = logBinHead - tail;
+    if( words > (LOGGER_BIN_RING_WORDS - start) )
+    {
+      words = LOGGER_BIN_RING_WORDS - start;
+    }
+    if(words == 0U)
+    {
+      return;
+    }
+
+    if(pLogUsart->hdmatx != NULL)
+    {
+      if(HAL_UART_Transmit_DMA(pLogUsart, (uint8_t*)&logBinRing[start], (uint16_t)(words * sizeof(uint32_t))) == HAL_OK)
+      {
+        logBinTxWords = words;
+      }
+    }
+    else
+    {
+      logUsartTx((uint8_t*)&logBinRing[start], (uint16_t)(words * sizeof(uint32_t)));
+      logBinTail = tail + words;
+    }
+  }
+  #endif /* #if USE_LOGGER == LOGGER_BINARY */
+}
 
 /* */
 
 char* hex2Str(unsigned char * data, size_t dataLen)
 {
-#if (USE_LOGGER == LOGGER_ON)
+#if (USE_LOGGER == LOGGER_BINARY)
+    /* Raw data for logBinary(), the host formats it */
+    uint8_t idx = hexStrIdx;
+
+    if( dataLen > (LOGGER_BIN_MAX_STR - 2U) )
+    {
+        dataLen = LOGGER_BIN_MAX_STR - 2U;
+    }
+    hexStr[idx][0] = (char)LOGGER_BIN_HEX_TAG;
+    hexStr[idx][1] = (char)dataLen;
+    memcpy(&hexStr[idx][2], data, dataLen);
+
+    hexStrIdx++;
+    hexStrIdx %= MAX_HEX_STR;
+
+    return hexStr[idx];
+#elif (USE_LOGGER == LOGGER_ON)
     const char * hex = "0123456789ABCDEF";
     
     unsigned char * pin  = data;
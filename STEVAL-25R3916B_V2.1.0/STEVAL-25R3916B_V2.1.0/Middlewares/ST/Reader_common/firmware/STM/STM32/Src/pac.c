@@ -57,18 +57,39 @@
 
 /* Private typedef -----------------------------------------------------------*/
 
-/* Configuration of Persistent Analog Config */
+/* Record header of the Persistent Analog Config log
+ * The header occupies one flash programming unit and is followed by 'count' units of payload.
+ * The crc32 covers the first 4 bytes of the header and the whole payload so a record torn by
+ * a power loss is detected on the next mount. */
 typedef struct
 {
-    /* use volatile to prevent the compiler to get rid of Flash access on high optimization level*/
-    const uint8_t* volatile table;        /* Current Analog Config Table          */
-    volatile uint32_t       crc32;        /* CRC32 of the current Analog Config   */
-    volatile uint32_t       crc32_neg;    /* !CRC32 of the current Analog Config  */
-    volatile uint32_t       crc32_orig;   /* CRC32 of the original Analog Config  */
-    volatile uint32_t       configLength; /* Current Analog Config Table Length   */
-    volatile uint32_t       unused[3];    /* Padding to reach multiple of double-words (8 bytes alignment)
+    uint8_t                 type;         /* Record type: DATA or COMMIT           */
+    uint8_t                 chunk;        /* DATA: first table chunk carried       */
+    uint8_t                 count;        /* Number of payload programming units   */
+    uint8_t                 unused;
+    uint32_t                crc32;        /* CRC32 of header[0..3] + payload       */
+} t_AnalogConfigRecord;
+
+/* Payload of a COMMIT record, closing an update of the Analog Config */
+typedef struct
+{
+    uint32_t                configLength; /* Current Analog Config Table Length   */
+    uint32_t                crc32;        /* CRC32 of the current Analog Config   */
+    uint32_t                crc32_orig;   /* CRC32 of the original Analog Config  */
+    uint32_t                unused;       /* Padding to reach multiple of double-words (8 bytes alignment)
                                              and quad-words (16 bytes alignment)*/
-} t_AnalogConfigPage;
+} t_AnalogConfigCommit;
+
+/* RAM view of the Persistent Analog Config log, rebuilt at mount */
+typedef struct
+{
+    bool                    mounted;      /* A valid page with a committed table was found       */
+    bool                    dirty;        /* Log tail is not clean: compact before next append   */
+    uint8_t                 page;         /* Active page                                         */
+    uint32_t                seq;          /* Sequence number of the active page                  */
+    uint32_t                writePos;     /* Offset in log of the next free programming unit     */
+    t_AnalogConfigCommit    commit;       /* Last committed table info                           */
+} t_AnalogConfigLog;
 
 
 /* Private define ------------------------------------------------------------*/
@@ -83,81 +104,443 @@ typedef struct
 #define ANALOG_CONFIG_FLASH_PAGE_NUM     ((ANALOG_CONFIG_OFFSET % FLASH_BANK_SIZE) / (FLASH_PAGE_SIZE))
 #define ANALOG_CONFIG_FLASH_PAGE_BANK    (((ANALOG_CONFIG_OFFSET / FLASH_BANK_SIZE) == 0) ? FLASH_BANK_1 : FLASH_BANK_2)
 
-#ifndef ANALOG_CONFIG_FLASH_PAGE_COUNT
-#define ANALOG_CONFIG_FLASH_PAGE_COUNT   ((RFAL_ANALOG_CONFIG_TBL_SIZE + (FLASH_PAGE_SIZE - 1)) / (FLASH_PAGE_SIZE))
-#endif
-
+/* The log alternates between two pages: updates are appended to the active page and
+ * the latest committed table is compacted into the other page once it is full */
+#define ANALOG_CONFIG_FLASH_PAGE_COUNT   (2U)
 #define ANALOG_CONFIG_FLASH_SIZE         ((FLASH_PAGE_SIZE) * ANALOG_CONFIG_FLASH_PAGE_COUNT)
 
-#define ANALOG_CONFIG_HEADER_ADDRESS     (ANALOG_CONFIG_ADDRESS)
+/* Flash programming unit: every record is aligned on it */
+#if defined(STM32U5)
+#define ANALOG_CONFIG_PROG_SIZE          (16U)   /* quad-word   */
+#else
+#define ANALOG_CONFIG_PROG_SIZE          (8U)    /* double-word */
+#endif
 
-#define ANALOG_CONFIG_DATA_ADDRESS       (ANALOG_CONFIG_ADDRESS    + sizeof(t_AnalogConfigPage))
-#define ANALOG_CONFIG_DATA_LENGTH        (ANALOG_CONFIG_FLASH_SIZE - sizeof(t_AnalogConfigPage))
+#define ANALOG_CONFIG_CHUNK_COUNT        ((RFAL_ANALOG_CONFIG_TBL_SIZE) / ANALOG_CONFIG_PROG_SIZE)
+#define ANALOG_CONFIG_COMMIT_UNITS       (16U / ANALOG_CONFIG_PROG_SIZE) /* sizeof(t_AnalogConfigCommit) */
+#define ANALOG_CONFIG_CHUNKS(len)        (((len) + (ANALOG_CONFIG_PROG_SIZE - 1U)) / ANALOG_CONFIG_PROG_SIZE)
+#define ANALOG_CONFIG_REC_SIZE(count)    (ANALOG_CONFIG_PROG_SIZE * (1U + (count)))
 
+#define ANALOG_CONFIG_LOG_MAGIC          (0x31434150UL) /* "PAC1": page header marker */
+#define ANALOG_CONFIG_REC_DATA           (0xA5U)        /* Record carrying table chunks */
+#define ANALOG_CONFIG_REC_COMMIT         (0x5AU)        /* Record closing an update     */
+#define ANALOG_CONFIG_NO_OFFSET          (0xFFFFU)      /* Chunk not present in the log */
 
 #define ANALOG_CONFIG_CRC_MARKER_BAD     0xbadd
-#define ANALOG_CONFIG_CRC_MARKER_DEAD    0xdead
 #define ANALOG_CONFIG_CRC_MARKER_CACA    0xcaca
 
+#if ((RFAL_ANALOG_CONFIG_TBL_SIZE) % 16) != 0
+#error "RFAL Analog Config table size must be multiple of quad words due to HAL_FLASH_Program() pace"
+#endif
+
+#if (ANALOG_CONFIG_CHUNK_COUNT > 0xFF)
+#error "Analog Config chunk index must fit in the record header"
+#endif
+
+/* Trick to check a full Analog Config table fits in one flash page */
+extern bool checker_log_page_size[ (ANALOG_CONFIG_REC_SIZE(ANALOG_CONFIG_CHUNK_COUNT) + ANALOG_CONFIG_REC_SIZE(ANALOG_CONFIG_COMMIT_UNITS) + ANALOG_CONFIG_PROG_SIZE) <= FLASH_PAGE_SIZE ? 1 : -1 ];
 
-/* Reserve an entire page of Flash memory */
+
+/* Reserve two entire pages of Flash memory */
 
 #if defined( __CC_ARM ) || defined(__ARMCC_VERSION) /* compiled with Keil v5 or v6 */
 
-#define ANALOG_CONFIG_HEADER_ADDR 0x08018000
-#define ANALOG_CONFIG_DATA_ADDR   0x08018020
+#ifndef ANALOG_CONFIG_LOG_ADDR
+#define ANALOG_CONFIG_LOG_ADDR    0x08018000
+#endif
 
 /* Trick to check the value manually set matches the computed defines */
-extern bool checker_header_addr[ ANALOG_CONFIG_HEADER_ADDRESS == ANALOG_CONFIG_HEADER_ADDR ? 1 : -1 ];
-extern bool checker_data_addr  [ ANALOG_CONFIG_DATA_ADDRESS   == ANALOG_CONFIG_DATA_ADDR   ? 1 : -1 ];
+extern bool checker_log_addr[ ANALOG_CONFIG_ADDRESS == ANALOG_CONFIG_LOG_ADDR ? 1 : -1 ];
 
 #define str(address)            #address
 #define sectionAt(address)      ".ARM.__at_" str(address)
 
-const t_AnalogConfigPage __attribute__(( section(sectionAt(ANALOG_CONFIG_HEADER_ADDR)) )) PersistentAnalogConfig  = {.table = NULL, .crc32 = ANALOG_CONFIG_CRC_MARKER_BAD, .crc32_neg = ANALOG_CONFIG_CRC_MARKER_DEAD, .crc32_orig = ANALOG_CONFIG_CRC_MARKER_CACA, .configLength = 0};
-const uint8_t            __attribute__(( section(sectionAt(ANALOG_CONFIG_DATA_ADDR))   )) PersistentAnalogConfigTable[ANALOG_CONFIG_DATA_LENGTH] = {0};
+const uint8_t            __attribute__(( section(sectionAt(ANALOG_CONFIG_LOG_ADDR)) )) PersistentAnalogConfigLog[ANALOG_CONFIG_FLASH_SIZE] = {0};
 
 #elif defined( __ICCARM__ ) /* compiled with IAR */
 
-const t_AnalogConfigPage PersistentAnalogConfig @ ANALOG_CONFIG_HEADER_ADDRESS = {.table = NULL, .crc32 = ANALOG_CONFIG_CRC_MARKER_BAD, .crc32_neg = ANALOG_CONFIG_CRC_MARKER_DEAD, .crc32_orig = ANALOG_CONFIG_CRC_MARKER_CACA, .configLength = 0};
-const uint8_t            PersistentAnalogConfigTable[ANALOG_CONFIG_DATA_LENGTH] @ ANALOG_CONFIG_DATA_ADDRESS = {0};
+const uint8_t            PersistentAnalogConfigLog[ANALOG_CONFIG_FLASH_SIZE] @ ANALOG_CONFIG_ADDRESS = {0};
 
 #elif defined( __GNUC__ ) /* compiled with GCC */
 
-const t_AnalogConfigPage __attribute__((section(".ST25R_PAC"))) PersistentAnalogConfig  = {.table = NULL, .crc32 = ANALOG_CONFIG_CRC_MARKER_BAD, .crc32_neg = ANALOG_CONFIG_CRC_MARKER_DEAD, .crc32_orig = ANALOG_CONFIG_CRC_MARKER_CACA, .configLength = 0};
-const uint8_t            __attribute__((section(".ST25R_PAC"))) PersistentAnalogConfigTable[ANALOG_CONFIG_DATA_LENGTH] = {0};
+const uint8_t            __attribute__((section(".ST25R_PAC"))) PersistentAnalogConfigLog[ANALOG_CONFIG_FLASH_SIZE] = {0};
 
 #endif
 
+/* use volatile to prevent the compiler to get rid of Flash access on high optimization level*/
+static const uint8_t * volatile pacFlash = PersistentAnalogConfigLog;
+
+/* Log offset of the latest copy of each table chunk: lookup is a single access */
+static uint16_t          pacIndex[ANALOG_CONFIG_CHUNK_COUNT];
+static t_AnalogConfigLog pacLog;
+
+/* Allocate uint64_t array to align on 64-bit boundary ( size / sizeof(uint64_t) to get size in bytes) */
+static uint64_t tmpAC[(RFAL_ANALOG_CONFIG_TBL_SIZE) / sizeof(uint64_t)];
+static uint64_t pacRecHeader[ANALOG_CONFIG_PROG_SIZE / sizeof(uint64_t)];
+static uint64_t pacCommit[sizeof(t_AnalogConfigCommit) / sizeof(uint64_t)];
+
 
 /* Private function prototypes -----------------------------------------------*/
-static bool persistentAnalogConfig_IsInstalled(const t_AnalogConfigPage * cfg);
-static bool persistentAnalogConfig_Install(const t_AnalogConfigPage * cfg);
+static uint32_t persistentAnalogConfig_Fnv(uint32_t crc, const volatile uint8_t * buf, uint32_t bufLen);
+static bool     persistentAnalogConfig_IsErased(uint32_t offset);
+static bool     persistentAnalogConfig_ReadRecord(uint32_t offset, uint32_t pageEnd, t_AnalogConfigRecord * rec);
+static bool     persistentAnalogConfig_MountPage(uint8_t page, uint32_t seq);
+static bool     persistentAnalogConfig_Mount(void);
+static stError  persistentAnalogConfig_Append(uint8_t type, uint8_t chunk, uint8_t count, const uint64_t * data);
+static uint32_t persistentAnalogConfig_ChangedRun(uint32_t first, uint32_t chunks);
+static stError  persistentAnalogConfig_Compact(uint16_t sizeAC);
+static bool     persistentAnalogConfig_Install(void);
+
+
+/*!
+ *****************************************************************************
+ * \brief Compute CRC32_FNV-1a
+ *
+ * Continue the hash computation over the given (flash or RAM) buffer
+ *
+ *****************************************************************************
+ */
+static uint32_t persistentAnalogConfig_Fnv(uint32_t crc, const volatile uint8_t * buf, uint32_t bufLen)
+{
+    const volatile uint8_t * end = buf + bufLen;
+    while ( buf < end )
+    {
+        /* xor the bottom with the current octet */
+        crc ^= ( uint32_t ) * buf;
+        /* multiply by the 32 bit FNV magic prime mod 2^32 FNV_32_PRIME  = 0x01000193 --> 0001 0000 0000 0000 0001 1001 0011 */
+        crc += ( crc << 1 ) + ( crc << 4 ) + ( crc << 7 ) + ( crc << 8 ) + ( crc << 24 );/* crc *= FNV_32_PRIME; */
+        ++ buf;
+    }
+    return ( crc );
+}
+
+/*!
+ *****************************************************************************
+ * \brief Tell if a programming unit of the log is erased
+ *
+ *****************************************************************************
+ */
+static bool persistentAnalogConfig_IsErased(uint32_t offset)
+{
+    for (uint32_t i = 0; i < ANALOG_CONFIG_PROG_SIZE; i++)
+    {
+        if (pacFlash[offset + i] != 0xFFU)
+        {
+            return(false);
+        }
+    }
+    return(true);
+}
+
+/*!
+ *****************************************************************************
+ * \brief Read and check a log record
+ *
+ * return true when the record at offset is complete and its CRC matches
+ *
+ *****************************************************************************
+ */
+static bool persistentAnalogConfig_ReadRecord(uint32_t offset, uint32_t pageEnd, t_AnalogConfigRecord * rec)
+{
+    uint32_t crc;
+    bool     ok;
 
+    for (uint32_t i = 0; i < sizeof(t_AnalogConfigRecord); i++)
+    {
+        ((uint8_t*)rec)[i] = pacFlash[offset + i];
+    }
+
+    /* A double-word torn by a power loss may read back with a double ECC error */
+    if (flash_EccError((uint32_t)pacFlash + offset, ANALOG_CONFIG_PROG_SIZE))
+    {
+        return(false);
+    }
+
+    if (rec->type == ANALOG_CONFIG_REC_DATA)
+    {
+        if ((rec->count == 0U) || (((uint32_t)rec->chunk + rec->count) > ANALOG_CONFIG_CHUNK_COUNT))
+        {
+            return(false);
+        }
+    }
+    else if (rec->type == ANALOG_CONFIG_REC_COMMIT)
+    {
+        if (rec->count != ANALOG_CONFIG_COMMIT_UNITS)
+        {
+            return(false);
+        }
+    }
+    else
+    {
+        return(false);
+    }
+
+    if ((offset + ANALOG_CONFIG_REC_SIZE(rec->count)) > pageEnd)
+    {
+        return(false);
+    }
+
+    crc = persistentAnalogConfig_Fnv((uint32_t)0x811c9dc5ul, (const uint8_t*)rec, sizeof(uint32_t));
+    crc = persistentAnalogConfig_Fnv(crc, &pacFlash[offset + ANALOG_CONFIG_PROG_SIZE], (uint32_t)rec->count * ANALOG_CONFIG_PROG_SIZE);
+    ok  = (crc == rec->crc32);
+
+    if (flash_EccError((uint32_t)pacFlash + offset + ANALOG_CONFIG_PROG_SIZE, (uint32_t)rec->count * ANALOG_CONFIG_PROG_SIZE))
+    {
+        ok = false;
+    }
+    return(ok);
+}
 
 /*!
  *****************************************************************************
- * \brief Tell if Persistent Analog Config table is installed
+ * \brief Mount one page of the Persistent Analog Config log
  *
- * return true when Persistent Analog Config parameters have been initialised. Initialised doesn't mean valid!
+ * Replay the records of the page up to the last COMMIT and build the RAM
+ * chunk index. Records following the last COMMIT belong to an update
+ * interrupted by a power loss and are ignored.
+ *
+ * return true when the page holds a committed Analog Config
  *
  *****************************************************************************
  */
-static bool persistentAnalogConfig_IsInstalled(const t_AnalogConfigPage * cfg)
+static bool persistentAnalogConfig_MountPage(uint8_t page, uint32_t seq)
 {
-    /* Check if persistent Analog config table is installed */
-    if (   (cfg->configLength == 0)
-        && (cfg->crc32        == ANALOG_CONFIG_CRC_MARKER_BAD)
-        && (cfg->crc32_neg    == ANALOG_CONFIG_CRC_MARKER_DEAD)
-        && (cfg->crc32_orig   == ANALOG_CONFIG_CRC_MARKER_CACA)
-        && (cfg->table        == NULL) )
+    t_AnalogConfigRecord rec;
+    uint32_t pageBase = (uint32_t)page * FLASH_PAGE_SIZE;
+    uint32_t pageEnd  = pageBase + FLASH_PAGE_SIZE;
+    uint32_t pos;
+    uint32_t committedEnd = 0;
+
+    memset(&pacLog, 0, sizeof(pacLog));
+    memset(pacIndex, 0xFF, sizeof(pacIndex));
+    pacLog.page = page;
+    pacLog.seq  = seq;
+
+    /* First pass: check records and find the end of the last complete update */
+    pos = pageBase + ANALOG_CONFIG_PROG_SIZE;
+    while ((pos + ANALOG_CONFIG_PROG_SIZE) <= pageEnd)
+    {
+        bool erased = persistentAnalogConfig_IsErased(pos);
+        if (flash_EccError((uint32_t)pacFlash + pos, ANALOG_CONFIG_PROG_SIZE))
+        {
+            /* Header torn while programmed: neither erased nor readable */
+            pacLog.dirty = true;
+            break;
+        }
+        if (erased)
+        {
+            break;
+        }
+        if (persistentAnalogConfig_ReadRecord(pos, pageEnd, &rec) == false)
+        {
+            /* Torn record: the tail can't be appended anymore */
+            pacLog.dirty = true;
+            break;
+        }
+        pos += ANALOG_CONFIG_REC_SIZE(rec.count);
+        if (rec.type == ANALOG_CONFIG_REC_COMMIT)
+        {
+            committedEnd = pos;
+        }
+    }
+
+    if (committedEnd == 0U)
     {
         return(false);
     }
+    pacLog.writePos = pos;
+    pacLog.dirty   |= (pos != committedEnd);
+
+    /* Second pass: replay committed records into the index */
+    pos = pageBase + ANALOG_CONFIG_PROG_SIZE;
+    while (pos < committedEnd)
+    {
+        persistentAnalogConfig_ReadRecord(pos, pageEnd, &rec);
+        if (rec.type == ANALOG_CONFIG_REC_DATA)
+        {
+            for (uint32_t i = 0; i < rec.count; i++)
+            {
+                pacIndex[rec.chunk + i] = (uint16_t)(pos + ((1U + i) * ANALOG_CONFIG_PROG_SIZE));
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < sizeof(t_AnalogConfigCommit); i++)
+            {
+                ((uint8_t*)&pacLog.commit)[i] = pacFlash[pos + ANALOG_CONFIG_PROG_SIZE + i];
+            }
+        }
+        pos += ANALOG_CONFIG_REC_SIZE(rec.count);
+    }
 
+    pacLog.mounted = true;
     return(true);
 }
 
+/*!
+ *****************************************************************************
+ * \brief Mount the Persistent Analog Config log
+ *
+ * Mount the most recent page, falling back to the other one when its content
+ * is not usable (e.g. compaction interrupted while erasing it).
+ *
+ * return true when a committed Analog Config is available
+ *
+ *****************************************************************************
+ */
+static bool persistentAnalogConfig_Mount(void)
+{
+    bool     valid[ANALOG_CONFIG_FLASH_PAGE_COUNT];
+    uint32_t seq[ANALOG_CONFIG_FLASH_PAGE_COUNT];
+    uint8_t  newest;
+
+    /* Look for the page headers */
+    for (uint8_t p = 0; p < ANALOG_CONFIG_FLASH_PAGE_COUNT; p++)
+    {
+        uint32_t pageBase = (uint32_t)p * FLASH_PAGE_SIZE;
+        uint32_t magic    = (uint32_t)pacFlash[pageBase] | ((uint32_t)pacFlash[pageBase + 1U] << 8) | ((uint32_t)pacFlash[pageBase + 2U] << 16) | ((uint32_t)pacFlash[pageBase + 3U] << 24);
+        seq[p]   = (uint32_t)pacFlash[pageBase + 4U] | ((uint32_t)pacFlash[pageBase + 5U] << 8) | ((uint32_t)pacFlash[pageBase + 6U] << 16) | ((uint32_t)pacFlash[pageBase + 7U] << 24);
+        valid[p] = (flash_EccError((uint32_t)pacFlash + pageBase, ANALOG_CONFIG_PROG_SIZE) == false) && (magic == ANALOG_CONFIG_LOG_MAGIC);
+    }
+
+    newest = ((valid[0] == false) || (valid[1] && ((int32_t)(seq[1] - seq[0]) > 0))) ? 1U : 0U;
+
+    if (valid[newest] && persistentAnalogConfig_MountPage(newest, seq[newest]))
+    {
+        return(true);
+    }
+    if (valid[1U - newest] && persistentAnalogConfig_MountPage(1U - newest, seq[1U - newest]))
+    {
+        /* The newest page is not usable: let next update compact over it */
+        pacLog.seq = seq[newest];
+        return(true);
+    }
+
+    memset(&pacLog, 0, sizeof(pacLog));
+    return(false);
+}
+
+/*!
+ *****************************************************************************
+ * \brief Append a record to the active page
+ *
+ * The header is programmed first: a record interrupted by a power loss fails
+ * its CRC check on the next mount.
+ *
+ *****************************************************************************
+ */
+static stError persistentAnalogConfig_Append(uint8_t type, uint8_t chunk, uint8_t count, const uint64_t * data)
+{
+    t_AnalogConfigRecord * rec = (t_AnalogConfigRecord*)pacRecHeader;
+    uint32_t addr = (uint32_t)PersistentAnalogConfigLog + pacLog.writePos;
+    uint32_t len  = (uint32_t)count * ANALOG_CONFIG_PROG_SIZE;
+
+    memset(pacRecHeader, 0, sizeof(pacRecHeader));
+    rec->type   = type;
+    rec->chunk  = chunk;
+    rec->count  = count;
+    rec->crc32  = persistentAnalogConfig_Fnv((uint32_t)0x811c9dc5ul, (const uint8_t*)rec, sizeof(uint32_t));
+    rec->crc32  = persistentAnalogConfig_Fnv(rec->crc32, (const uint8_t*)data, len);
+
+    /* Any failure leaves an unusable tail */
+    pacLog.dirty = true;
+    if (flash_Program(addr, pacRecHeader, ANALOG_CONFIG_PROG_SIZE) != ERR_NONE)
+    {
+        return ERR_WRITE;
+    }
+    if (flash_Program(addr + ANALOG_CONFIG_PROG_SIZE, data, len) != ERR_NONE)
+    {
+        return ERR_WRITE;
+    }
+    pacLog.dirty = false;
+
+    if (type == ANALOG_CONFIG_REC_DATA)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            pacIndex[chunk + i] = (uint16_t)(pacLog.writePos + ((1U + i) * ANALOG_CONFIG_PROG_SIZE));
+        }
+    }
+    pacLog.writePos += ANALOG_CONFIG_REC_SIZE(count);
+
+    return ERR_NONE;
+}
+
+/*!
+ *****************************************************************************
+ * \brief Count consecutive table chunks differing from the stored table
+ *
+ * Compare tmpAC with the latest stored copy of each chunk, starting at first
+ *
+ *****************************************************************************
+ */
+static uint32_t persistentAnalogConfig_ChangedRun(uint32_t first, uint32_t chunks)
+{
+    const uint8_t *tmpAC8 = (const uint8_t*)tmpAC;
+    uint32_t       run    = 0;
+
+    while ((first + run) < chunks)
+    {
+        uint16_t offset = pacIndex[first + run];
+
+        if ((offset != ANALOG_CONFIG_NO_OFFSET) && (memcmp(&tmpAC8[(first + run) * ANALOG_CONFIG_PROG_SIZE], &pacFlash[offset], ANALOG_CONFIG_PROG_SIZE) == 0))
+        {
+            break;
+        }
+        run++;
+    }
+    return run;
+}
+
+/*!
+ *****************************************************************************
+ * \brief Compact the log into the other page
+ *
+ * Write the whole table held in tmpAC and its COMMIT to the erased spare page,
+ * then its page header. The previous page stays valid until the header is
+ * programmed, so an interrupted compaction falls back to it.
+ *
+ *****************************************************************************
+ */
+static stError persistentAnalogConfig_Compact(uint16_t sizeAC)
+{
+    uint8_t  page   = pacLog.mounted ? (uint8_t)(1U - pacLog.page) : 0U;
+    uint32_t seq    = pacLog.mounted ? (pacLog.seq + 1U) : 0U;
+    uint8_t  chunks = (uint8_t)ANALOG_CONFIG_CHUNKS(sizeAC);
+    uint64_t pageHeader[ANALOG_CONFIG_PROG_SIZE / sizeof(uint64_t)];
+    stError  err;
+
+    /* Erase page, or both when no page can be trusted anymore */
+    err = flash_PageErase(ANALOG_CONFIG_FLASH_PAGE_NUM + page, pacLog.mounted ? 1U : ANALOG_CONFIG_FLASH_PAGE_COUNT, ANALOG_CONFIG_FLASH_PAGE_BANK);
+    if (err != ERR_NONE)
+    {
+        return ERR_IO;
+    }
+
+    memset(pacIndex, 0xFF, sizeof(pacIndex));
+    pacLog.writePos = ((uint32_t)page * FLASH_PAGE_SIZE) + ANALOG_CONFIG_PROG_SIZE;
+
+    /* Program data */
+    if (chunks > 0U)
+    {
+        err = persistentAnalogConfig_Append(ANALOG_CONFIG_REC_DATA, 0, chunks, tmpAC);
+    }
+    if (err == ERR_NONE)
+    {
+        err = persistentAnalogConfig_Append(ANALOG_CONFIG_REC_COMMIT, 0, ANALOG_CONFIG_COMMIT_UNITS, pacCommit);
+    }
+
+    /* Validate the page now */
+    if (err == ERR_NONE)
+    {
+        memset(pageHeader, 0, sizeof(pageHeader));
+        ((uint32_t*)pageHeader)[0] = ANALOG_CONFIG_LOG_MAGIC;
+        ((uint32_t*)pageHeader)[1] = seq;
+        err = flash_Program((uint32_t)PersistentAnalogConfigLog + ((uint32_t)page * FLASH_PAGE_SIZE), pageHeader, ANALOG_CONFIG_PROG_SIZE);
+    }
+    return err;
+}
+
 /*!
  *****************************************************************************
  * \brief Install Persistent Analog Config table
@@ -166,12 +549,35 @@ static bool persistentAnalogConfig_IsInstalled(const t_AnalogConfigPage * cfg)
  *
  *****************************************************************************
  */
-static bool persistentAnalogConfig_Install(const t_AnalogConfigPage * cfg)
+static bool persistentAnalogConfig_Install(void)
 {
-    const uint8_t * cfgTable = cfg->table;
-    uint16_t cfgTableLength  = cfg->configLength;
+    uint8_t *tmpAC8 = (uint8_t*)tmpAC;
+    uint16_t sizeAC = (uint16_t)pacLog.commit.configLength;
+
+    if (sizeAC > sizeof(tmpAC))
+    {
+        return(false);
+    }
+
+    /* Gather the table from the latest copy of each chunk */
+    for (uint32_t i = 0; i < ANALOG_CONFIG_CHUNKS(sizeAC); i++)
+    {
+        if (pacIndex[i] == ANALOG_CONFIG_NO_OFFSET)
+        {
+            return(false);
+        }
+        for (uint32_t j = 0; j < ANALOG_CONFIG_PROG_SIZE; j++)
+        {
+            tmpAC8[(i * ANALOG_CONFIG_PROG_SIZE) + j] = pacFlash[pacIndex[i] + j];
+        }
+    }
+
+    if (persistentAnalogConfig_CalcHash(tmpAC8, sizeAC) != pacLog.commit.crc32)
+    {
+        return(false);
+    }
 
-    return (rfalAnalogConfigListWriteRaw(cfgTable, cfgTableLength) == ERR_NONE);
+    return (rfalAnalogConfigListWriteRaw(tmpAC8, sizeAC) == ERR_NONE);
 }
 
 /*!
@@ -185,8 +591,8 @@ static bool persistentAnalogConfig_Install(const t_AnalogConfigPage * cfg)
 bool persistentAnalogConfig_Enable(void)
 {
     bool ret = true;
-    
-    if (persistentAnalogConfig_IsInstalled(&PersistentAnalogConfig) == false)
+
+    if (persistentAnalogConfig_Mount() == false)
     {
         /* Create the persistent table when it is empty or invalid */
         ret = (persistentAnalogConfig_Program() == ERR_NONE);
@@ -194,9 +600,9 @@ bool persistentAnalogConfig_Enable(void)
     else
     {
         /* Install Persistent Analog Config stored in Flash memory */
-        ret = persistentAnalogConfig_Install(&PersistentAnalogConfig);
+        ret = persistentAnalogConfig_Install();
     }
-    
+
     return ret;
 }
 
@@ -212,17 +618,8 @@ uint32_t persistentAnalogConfig_CalcHash( const uint8_t * buf, uint16_t bufLen )
 {
     /* Compute CRC32_FNV-1a */
     const uint32_t  init = ((uint32_t)0x811c9dc5ul);
-    uint32_t        crc  = init;
-    const uint8_t * end  = buf + bufLen;
-    while ( buf < end )
-    {
-        /* xor the bottom with the current octet */
-        crc ^= ( uint32_t ) * buf;
-        /* multiply by the 32 bit FNV magic prime mod 2^32 FNV_32_PRIME  = 0x01000193 --> 0001 0000 0000 0000 0001 1001 0011 */
-        crc += ( crc << 1 ) + ( crc << 4 ) + ( crc << 7 ) + ( crc << 8 ) + ( crc << 24 );/* crc *= FNV_32_PRIME; */
-        ++ buf;
-    }
-    return ( crc );
+
+    return persistentAnalogConfig_Fnv( init, buf, bufLen );
 }
 
 /*!
@@ -235,17 +632,14 @@ uint32_t persistentAnalogConfig_CalcHash( const uint8_t * buf, uint16_t bufLen )
  */
 void persistentAnalogConfig_GetHash( uint32_t *origCrc, uint32_t *curCrc )
 {
-    /* use volatile to prevent the compiler to get rid of Flash access on high optimization level */
-    const volatile t_AnalogConfigPage * cfg = & PersistentAnalogConfig;
-
     if( origCrc != NULL )
     {
-        *origCrc = cfg->crc32_orig;
+        *origCrc = pacLog.mounted ? pacLog.commit.crc32_orig : ANALOG_CONFIG_CRC_MARKER_CACA;
     }
-    
+
     if( curCrc != NULL )
     {
-        *curCrc = cfg->crc32;
+        *curCrc = pacLog.mounted ? pacLog.commit.crc32 : ANALOG_CONFIG_CRC_MARKER_BAD;
     }
 }
 
@@ -253,85 +647,91 @@ void persistentAnalogConfig_GetHash( uint32_t *origCrc, uint32_t *curCrc )
  *****************************************************************************
  * \brief Program Persistent Analog Config page
  *
- * Retrieve actual Analog Configs in RAM and write it permanently to dedicated flash page
+ * Retrieve actual Analog Configs in RAM and append the chunks which differ
+ * from the stored table to the log, followed by a COMMIT record.
+ * The log is compacted into the other page when the active one is full.
  *
  *****************************************************************************
  */
-
-#if ((RFAL_ANALOG_CONFIG_TBL_SIZE) % 16) != 0
-#error "RFAL Analog Config table size must be multiple of quad words due to HAL_FLASH_Program() pace"
-#endif
-
-/* Allocate uint64_t array to align on 64-bit boundary ( size / sizeof(uint64_t) to get size in bytes) */
-static uint64_t tmpAC[(RFAL_ANALOG_CONFIG_TBL_SIZE) / sizeof(uint64_t)];
-
 stError persistentAnalogConfig_Program( void )
 {
-    stError             err = ERR_NONE;
-    ReturnCode          ret;
-    t_AnalogConfigPage  AC_Config;
-    uint16_t            sizeAC;
+    stError               err = ERR_NONE;
+    ReturnCode            ret;
+    t_AnalogConfigCommit *commit = (t_AnalogConfigCommit*)pacCommit;
+    uint8_t              *tmpAC8 = (uint8_t*)tmpAC;
+    uint16_t              sizeAC;
+    uint32_t              chunks;
+    uint32_t              needed;
+    uint32_t              i;
+    uint32_t              run;
 
     /* Retrieve current RFAL AC Table from RAM */
-    ret = rfalAnalogConfigListReadRaw( (uint8_t*)tmpAC, sizeof(tmpAC), & sizeAC );
+    ret = rfalAnalogConfigListReadRaw( tmpAC8, sizeof(tmpAC), & sizeAC );
     if (ret != RFAL_ERR_NONE)
     {
         return ERR_IO;
     }
 
-    /* Compute checksum */
-    uint32_t checksum32 = persistentAnalogConfig_CalcHash( (uint8_t*)tmpAC, sizeAC );
+    /* Pad the last chunk */
+    memset(&tmpAC8[sizeAC], 0, sizeof(tmpAC) - sizeAC);
+    chunks = ANALOG_CONFIG_CHUNKS(sizeAC);
 
-#if defined(STM32L4) || defined(STM32G0)
-    uint32_t pad_count = sizeof(uint64_t) - (sizeAC % sizeof(uint64_t));
-#elif defined(STM32U5)
-    uint32_t pad_count = (2*sizeof(uint64_t)) - (sizeAC % (2*sizeof(uint64_t)));
-#endif
-    if (pad_count != 0)
+    /* Construct commit info */
+    memset(pacCommit, 0, sizeof(pacCommit));
+    commit->configLength = (uint32_t )sizeAC;
+    commit->crc32        = persistentAnalogConfig_CalcHash( tmpAC8, sizeAC );
+    commit->crc32_orig   = pacLog.mounted ? pacLog.commit.crc32_orig : commit->crc32; /* Set original value */
+
+    if (pacLog.mounted && (pacLog.dirty == false))
     {
-        for (uint32_t i = 0; i < pad_count; i++)
+        if ((pacLog.commit.configLength == commit->configLength) && (pacLog.commit.crc32 == commit->crc32))
         {
-            tmpAC[sizeAC + i] = 0;
+            /* Nothing changed: no flash access */
+            return ERR_NONE;
         }
-    }
-
-    /* Construct header info */
-    memcpy(& AC_Config, (const void*)& PersistentAnalogConfig, sizeof(AC_Config));
-    AC_Config.table        = PersistentAnalogConfigTable; /* point to persistent page */
-    AC_Config.configLength = (uint32_t )sizeAC;           /* change the original size */
-    AC_Config.crc32        = (uint32_t )checksum32;       /* store computed crc */
-    AC_Config.crc32_neg    = (uint32_t )~checksum32;      /* store crc complement */
-    if (AC_Config.crc32_orig == ANALOG_CONFIG_CRC_MARKER_CACA)
-    {
-        AC_Config.crc32_orig = checksum32; /* Set original value */
-    }
-
-    /* Erase page(s) */
-    err = flash_PageErase(ANALOG_CONFIG_FLASH_PAGE_NUM, ANALOG_CONFIG_FLASH_PAGE_COUNT, ANALOG_CONFIG_FLASH_PAGE_BANK);
-    if (err != ERR_NONE)
-    {
-        return ERR_IO;
-    }
 
-    /* Program data */
-    err = flash_Program((uint32_t) & PersistentAnalogConfigTable, tmpAC, sizeAC);
-    if (err != ERR_NONE)
-    {
-        err = ERR_WRITE;
-    }
+        /* Size the changed runs of chunks, lookup goes through the index */
+        needed = ANALOG_CONFIG_REC_SIZE(ANALOG_CONFIG_COMMIT_UNITS);
+        for (i = 0; i < chunks; i = i + run)
+        {
+            run     = persistentAnalogConfig_ChangedRun(i, chunks);
+            needed += (run > 0U) ? ANALOG_CONFIG_REC_SIZE(run) : 0U;
+            run     = (run > 0U) ? run : 1U;
+        }
 
-    /* Compute the CRC really in flash */
-    AC_Config.crc32_neg = (uint32_t )~ persistentAnalogConfig_CalcHash( PersistentAnalogConfigTable, sizeAC );
-    
-    /* Program the header now */
-    if (flash_Program((uint32_t) & PersistentAnalogConfig, (uint64_t*) & AC_Config, sizeof(t_AnalogConfigPage)) != ERR_NONE)
-    {
-        /* Don't overwrite previous error */
-        if (err == ERR_NONE)
+        if ((pacLog.writePos + needed) <= (((uint32_t)pacLog.page + 1U) * FLASH_PAGE_SIZE))
         {
-            err = ERR_WRITE;
+            /* Program the changed runs, then commit */
+            for (i = 0; (i < chunks) && (err == ERR_NONE); i = i + run)
+            {
+                run = persistentAnalogConfig_ChangedRun(i, chunks);
+                if (run > 0U)
+                {
+                    err = persistentAnalogConfig_Append(ANALOG_CONFIG_REC_DATA, (uint8_t)i, (uint8_t)run, &tmpAC[(i * ANALOG_CONFIG_PROG_SIZE) / sizeof(uint64_t)]);
+                }
+                run = (run > 0U) ? run : 1U;
+            }
+            if (err == ERR_NONE)
+            {
+                err = persistentAnalogConfig_Append(ANALOG_CONFIG_REC_COMMIT, 0, ANALOG_CONFIG_COMMIT_UNITS, pacCommit);
+            }
+            if (err == ERR_NONE)
+            {
+                memcpy(&pacLog.commit, commit, sizeof(pacLog.commit));
+                return ERR_NONE;
+            }
+
+            /* Append refused (e.g. over a double-word torn by a power loss):
+             * restore a consistent view and compact right away */
+            persistentAnalogConfig_Mount();
         }
     }
 
+    /* Empty, torn or full log: rewrite the whole table in the spare page */
+    err = persistentAnalogConfig_Compact(sizeAC);
+
+    /* Rebuild the view from what really is in flash */
+    persistentAnalogConfig_Mount();
+
     return err;
 }
@@ -138,6 +138,9 @@ typedef struct
 #define PERSISTENT_CONFIG_HASH_MARKER_DEAD  0xddaaeedd
 #define PERSISTENT_CONFIG_HASH_MARKER_CACA  0xcacacaca
 
+#define PERSISTENT_CONFIG_INDEX_SIZE        (PC_TAG_DLMA_RAW_DATA + 1U)   /* One entry per TLV tag */
+#define PERSISTENT_CONFIG_NO_OFFSET         (0xFFFFU)                     /* Tag not stored        */
+
 
 /* Reserve an entire page of Flash memory */
 
@@ -168,9 +171,68 @@ const uint8_t                   __attribute__((section(".ST25R_PC"))) Persistent
 #endif
 
 
+/* Offset of each TLV tag in the persistent data, built once instead of scanning on every lookup */
+static uint16_t pcTagOffset[PERSISTENT_CONFIG_INDEX_SIZE];
+static bool     pcTagIndexed = false;
+
+
 /* Private function prototypes -----------------------------------------------*/
+static void persistentConfig_IndexTlvs(const uint8_t *data, uint16_t offset, uint16_t end);
+static void persistentConfig_BuildIndex(const t_PersistentConfigHeader * cfg);
 static bool persistentConfig_Install(const t_PersistentConfigHeader * cfg);
 
+/*!
+ *****************************************************************************
+ * \brief Index a list of TLVs
+ *
+ * Record the offset of the first occurrence of each tag found between offset
+ * and end, walking into the DPO and DLMA parent TLVs.
+ *
+ *****************************************************************************
+ */
+static void persistentConfig_IndexTlvs(const uint8_t *data, uint16_t offset, uint16_t end)
+{
+    uint16_t len;
+    uint16_t valueOffset;
+
+    while(offset < end){
+        TLV_TAG tag = getTlvTag(&data[offset]);
+
+        len         = getTlvLen(&data[offset]);
+        valueOffset = offset + sizeof(TLV_TAG) + getTlvLenSizeof(&data[offset]);
+
+        if((tag < PERSISTENT_CONFIG_INDEX_SIZE) && (pcTagOffset[tag] == PERSISTENT_CONFIG_NO_OFFSET)){
+            pcTagOffset[tag] = offset;
+            if((tag == TLV_TAG_DPO) || (tag == TLV_TAG_DLMA)){
+                /* parent TAG: index children */
+                persistentConfig_IndexTlvs(data, valueOffset, RFAL_MIN((uint16_t)(valueOffset + len), end));
+            }
+        }
+        if(len == 0){
+            break;
+        }
+        offset = valueOffset + len;
+    }
+}
+
+/*!
+ *****************************************************************************
+ * \brief Build the TLV tag index
+ *
+ * Index the configuration stored in flash, if any
+ *
+ *****************************************************************************
+ */
+static void persistentConfig_BuildIndex(const t_PersistentConfigHeader * cfg)
+{
+    memset(pcTagOffset, 0xFF, sizeof(pcTagOffset));
+
+    if(cfg->data == PersistentConfigTable){
+        persistentConfig_IndexTlvs(cfg->data, 0, PERSISTENT_CONFIG_DATA_MAX_SIZE);
+    }
+    pcTagIndexed = true;
+}
+
 /*!
  *****************************************************************************
  * \brief Install Persistent Analog Config table
@@ -182,18 +244,13 @@ static bool persistentConfig_Install(const t_PersistentConfigHeader * cfg);
 static bool persistentConfig_Install(const t_PersistentConfigHeader * cfg)
 {
     uint16_t offset = 0;
-#if RFAL_FEATURE_DPO
-    uint16_t parentDpoTlvPos = 0;
-#endif /* RFAL_FEATURE_DPO */
-#if RFAL_FEATURE_DLMA
-    uint16_t parentDlmaTlvPos = 0;
-#endif /* RFAL_FEATURE_DLMA */
     uint16_t length = 0;
     ReturnCode ret = -1;
 
 #if RFAL_FEATURE_DYNAMIC_ANALOG_CONFIG
     /* Get AC and apply */
-    if(findTlvExt ((uint8_t *)cfg->data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_AC, &offset)){
+    offset = pcTagOffset[TLV_TAG_AC];
+    if(offset != PERSISTENT_CONFIG_NO_OFFSET){
         length = getTlvLen((uint8_t*)&cfg->data[offset]);
         ret = rfalAnalogConfigListWriteRaw(&cfg->data[offset + sizeof(TLV_TAG) + getTlvLenSizeof(&cfg->data[offset])], length);
     }
@@ -202,33 +259,21 @@ static bool persistentConfig_Install(const t_PersistentConfigHeader * cfg)
     
 #if RFAL_FEATURE_DPO
     /* Get DPO configurtaion and apply */
-    if(findTlvExt ((uint8_t *)cfg->data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_DPO, &offset)){
-        parentDpoTlvPos = offset;
-        parentDpoTlvPos += sizeof(TLV_TAG);
-        parentDpoTlvPos += getTlvLenSizeof(&cfg->data[offset]);
-        
-        /* parent TAG found, now look for data */        
-        if(findTlvExt ((uint8_t *)cfg->data, PERSISTENT_CONFIG_DATA_MAX_SIZE - (parentDpoTlvPos + sizeof(TLV_TAG)), TLV_TAG_DPO_DATA, &parentDpoTlvPos)){
-            length = getTlvLen((uint8_t*)&cfg->data[parentDpoTlvPos]);
-            ret |= rfalDpoTableWrite((rfalDpoEntry*)&cfg->data[parentDpoTlvPos + sizeof(TLV_TAG) + getTlvLenSizeof(&cfg->data[parentDpoTlvPos])], length/sizeof(rfalDpoEntry));
-        }      
+    offset = pcTagOffset[TLV_TAG_DPO_DATA];
+    if(offset != PERSISTENT_CONFIG_NO_OFFSET){
+        length = getTlvLen((uint8_t*)&cfg->data[offset]);
+        ret |= rfalDpoTableWrite((rfalDpoEntry*)&cfg->data[offset + sizeof(TLV_TAG) + getTlvLenSizeof(&cfg->data[offset])], length/sizeof(rfalDpoEntry));
     }
 #endif /* RFAL_FEATURE_DPO */
 
     
 #if RFAL_FEATURE_DLMA
     /* Get DLMA configurtaion and apply */
-    if(findTlvExt ((uint8_t *)cfg->data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_DLMA, &offset)){
-        parentDlmaTlvPos = offset;
-        parentDlmaTlvPos += sizeof(TLV_TAG);
-        parentDlmaTlvPos += getTlvLenSizeof(&cfg->data[offset]);
-        
-        /* parent TAG found, now look for data */        
-        if(findTlvExt ((uint8_t *)cfg->data, PERSISTENT_CONFIG_DATA_MAX_SIZE - (parentDlmaTlvPos + sizeof(TLV_TAG)), TLV_TAG_DLMA_DATA, &parentDlmaTlvPos)){
-            length = getTlvLen((uint8_t*)&cfg->data[parentDlmaTlvPos]);
-            ret |= rfalDlmaTableWrite((rfalDlmaEntry*)&cfg->data[parentDlmaTlvPos + sizeof(TLV_TAG) + getTlvLenSizeof(&cfg->data[parentDlmaTlvPos])], length/sizeof(rfalDlmaEntry));
-        }       
-    }    
+    offset = pcTagOffset[TLV_TAG_DLMA_DATA];
+    if(offset != PERSISTENT_CONFIG_NO_OFFSET){
+        length = getTlvLen((uint8_t*)&cfg->data[offset]);
+        ret |= rfalDlmaTableWrite((rfalDlmaEntry*)&cfg->data[offset + sizeof(TLV_TAG) + getTlvLenSizeof(&cfg->data[offset])], length/sizeof(rfalDlmaEntry));
+    }
 #endif /* RFAL_FEATURE_DLMA */
     
     return (ret == ERR_NONE);
@@ -258,6 +303,7 @@ bool persistentConfig_Enable(void)
     else 
     {
         /* Install Persistent Analog Config stored in Flash memory */
+        persistentConfig_BuildIndex(&PersistentConfig);
         ret = persistentConfig_Install(&PersistentConfig);
     }
 
@@ -429,7 +475,8 @@ stError persistentConfig_Program (pcID pcId)
                 }
                 else{
                     /* otherwise backup existing flash data */                    
-                    if(findTlvExt ((uint8_t *)pcHeader.data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_AC, &tlvDataOffset)){
+                    tlvDataOffset = (PersistentConfig.data == PersistentConfigTable) ? pcTagOffset[TLV_TAG_AC] : PERSISTENT_CONFIG_NO_OFFSET;
+                    if(tlvDataOffset != PERSISTENT_CONFIG_NO_OFFSET){
                         tlvLength = getTlvLen((uint8_t*)&pcHeader.data[tlvDataOffset]);
                         tmpAcSize = (sizeof(TLV_TAG) + getTlvLenSizeof(&pcHeader.data[tlvDataOffset]) + tlvLength);
                         /* Check to ensure in bound array access */
@@ -496,7 +543,8 @@ stError persistentConfig_Program (pcID pcId)
                 }
                 else{
                     /* otherwise backup existing flash data */                    
-                    if(findTlvExt ((uint8_t *)pcHeader.data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_DPO, &tlvDataOffset)){
+                    tlvDataOffset = (PersistentConfig.data == PersistentConfigTable) ? pcTagOffset[TLV_TAG_DPO] : PERSISTENT_CONFIG_NO_OFFSET;
+                    if(tlvDataOffset != PERSISTENT_CONFIG_NO_OFFSET){
                         tlvLength = getTlvLen((uint8_t*)&pcHeader.data[tlvDataOffset]);
                         tmpDpoSize = (sizeof(TLV_TAG) + getTlvLenSizeof(&pcHeader.data[tlvDataOffset]) + tlvLength);
                         /* Check to ensure in bound array access */
@@ -562,7 +610,8 @@ stError persistentConfig_Program (pcID pcId)
                 }
                 else{
                     /* otherwise backup existing flash data */                    
-                    if(findTlvExt ((uint8_t *)pcHeader.data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_DLMA, &tlvDataOffset)){
+                    tlvDataOffset = (PersistentConfig.data == PersistentConfigTable) ? pcTagOffset[TLV_TAG_DLMA] : PERSISTENT_CONFIG_NO_OFFSET;
+                    if(tlvDataOffset != PERSISTENT_CONFIG_NO_OFFSET){
                         tlvLength = getTlvLen((uint8_t*)&pcHeader.data[tlvDataOffset]);
                         tmpDlmaSize = (sizeof(TLV_TAG) + getTlvLenSizeof(&pcHeader.data[tlvDataOffset]) + tlvLength);
                         /* Check to ensure in bound array access */
@@ -624,6 +673,9 @@ stError persistentConfig_Program (pcID pcId)
         }
     }
 
+    /* Flash content moved: refresh the tag index */
+    persistentConfig_BuildIndex(&PersistentConfig);
+
     return err;
 }
 
@@ -637,6 +689,10 @@ stError persistentConfig_Get(const pcTAG persistentConfig, uint8_t* data, const
         /* no memory to store reply available  */
         return err;
     }
+
+    if(!pcTagIndexed){
+        persistentConfig_BuildIndex(&PersistentConfig);
+    }
        
     switch(persistentConfig){
 #if PERSISTENTCONFIG_GET_PC_TAG_AC_RAW_DATA
@@ -648,17 +704,15 @@ stError persistentConfig_Get(const pcTAG persistentConfig, uint8_t* data, const
                 /* not enough memory to store reply available  */
                 return err;
             }
-            if(findTlvExt ((uint8_t *)(&PersistentConfig)->data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_DPO, &offset)){
-                /* if parent TAG found look for child */
-                offset += sizeof(TLV_TAG) + getTlvLenSizeof(&(&PersistentConfig)->data[offset]);
-                if(findTlvExt ((uint8_t *)(&PersistentConfig)->data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_DPO_IS_ENABLED, &offset)){
-                    uint8_t tmpT, tmpV;
-                    offset += getTlv8(&(&PersistentConfig)->data[offset], &tmpT, &tmpV);                
-                    *dataLength = sizeof(uint8_t);
-                    data[0] = tmpV;
-                    err = ERR_NONE;
-                }
-            }        
+            /* child TAG is only indexed when its parent TAG is found */
+            offset = pcTagOffset[TLV_TAG_DPO_IS_ENABLED];
+            if(offset != PERSISTENT_CONFIG_NO_OFFSET){
+                uint8_t tmpT, tmpV;
+                offset += getTlv8(&(&PersistentConfig)->data[offset], &tmpT, &tmpV);                
+                *dataLength = sizeof(uint8_t);
+                data[0] = tmpV;
+                err = ERR_NONE;
+            }
             break;
         }
 #if PERSISTENTCONFIG_GET_PC_TAG_DPO_RAW_DATA
@@ -670,17 +724,15 @@ stError persistentConfig_Get(const pcTAG persistentConfig, uint8_t* data, const
                 /* not enough memory to store reply available  */
                 return err;
             }
-            if(findTlvExt ((uint8_t *)(&PersistentConfig)->data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_DLMA, &offset)){
-                /* if parent TAG found look for child */
-                offset += sizeof(TLV_TAG) + getTlvLenSizeof(&(&PersistentConfig)->data[offset]);
-                if(findTlvExt ((uint8_t *)(&PersistentConfig)->data, PERSISTENT_CONFIG_DATA_MAX_SIZE, TLV_TAG_DLMA_IS_ENABLED, &offset)){
-                    uint8_t tmpT, tmpV;
-                    offset += getTlv8(&(&PersistentConfig)->data[offset], &tmpT, &tmpV);
-                    *dataLength = sizeof(uint8_t);
-                    data[0] = tmpV;
-                    err = ERR_NONE;
-                }
-            }        
+            /* child TAG is only indexed when its parent TAG is found */
+            offset = pcTagOffset[TLV_TAG_DLMA_IS_ENABLED];
+            if(offset != PERSISTENT_CONFIG_NO_OFFSET){
+                uint8_t tmpT, tmpV;
+                offset += getTlv8(&(&PersistentConfig)->data[offset], &tmpT, &tmpV);
+                *dataLength = sizeof(uint8_t);
+                data[0] = tmpV;
+                err = ERR_NONE;
+            }
             break;
         }
 #if PERSISTENTCONFIG_GET_PC_TAG_DLMA_RAW_DATA  
@@ -44,6 +44,10 @@
 ******************************************************************************
 */
 
+#define TIMER_TRACE_MASK          (TIMER_TRACE_LEN - 1U)
+#define TIMER_TRACE_TS_MASK       0x00FFFFFFU
+#define TIMER_TRACE_DELTA_MAX_MS  16000U       /* Longer gaps are saturated, below the 24 bits us and the CYCCNT wraps */
+
 /*
 ******************************************************************************
 * LOCAL VARIABLES
@@ -52,6 +56,17 @@
 
 static uint32_t timerStopwatchTick;
 
+#ifdef RFAL_TRACE
+/* Entry: time since the previous entry (us, 24 bits) | event << 24, followed by the value */
+static uint32_t          timerTrace[TIMER_TRACE_LEN][2];
+static volatile uint16_t timerTraceHead;
+static volatile uint16_t timerTraceTail;
+static uint16_t          timerTraceLost;
+static bool              timerTraceStarted;
+static uint32_t          timerTraceRefCyc;   /* CYCCNT of the last entry, us remainder excluded */
+static uint32_t          timerTraceRefTick;  /* SysTick of the last entry                        */
+#endif /* RFAL_TRACE */
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -114,3 +129,130 @@ uint32_t timerStopwatchMeasure( void )
   return (uint32_t)(platformGetSysTick() - timerStopwatchTick);
 }
 
+
+/*******************************************************************************/
+void timerTraceRecord( uint8_t evt, uint32_t val )
+{
+#ifdef RFAL_TRACE
+  uint32_t primask;
+  uint16_t head;
+  uint32_t cyc;
+  uint32_t tick;
+  uint32_t cycPerUs;
+  uint32_t delta;
+  
+  if( !timerTraceStarted )
+  {
+    timerTraceClear();
+  }
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  
+  head = timerTraceHead;
+  if( (uint16_t)(head - timerTraceTail) >= TIMER_TRACE_LEN )
+  {
+    timerTraceLost++;
+  }
+  else
+  {
+    /* Time since the previous entry: wrap free as long as entries are less than
+       TIMER_TRACE_DELTA_MAX_MS apart, saturated otherwise. Dropped events don't
+       move the reference so the host sum stays exact */
+    cyc      = DWT->CYCCNT;
+    tick     = platformGetSysTick();
+    cycPerUs = SystemCoreClock / 1000000U;
+    if( (tick - timerTraceRefTick) >= TIMER_TRACE_DELTA_MAX_MS )
+    {
+      delta            = TIMER_TRACE_TS_MASK;
+      timerTraceRefCyc = cyc;
+    }
+    else
+    {
+      delta             = (cyc - timerTraceRefCyc) / cycPerUs;
+      delta             = ((delta > TIMER_TRACE_TS_MASK) ? TIMER_TRACE_TS_MASK : delta);
+      timerTraceRefCyc += delta * cycPerUs;
+    }
+    timerTraceRefTick = tick;
+    
+    timerTrace[head & TIMER_TRACE_MASK][0] = delta | ((uint32_t)evt << 24);
+    timerTrace[head & TIMER_TRACE_MASK][1] = val;
+    timerTraceHead = head + 1U;
+  }
+  
+  __set_PRIMASK(primask);
+#else
+  (void)evt;
+  (void)val;
+#endif /* RFAL_TRACE */
+}
+
+
+/*******************************************************************************/
+uint16_t timerTraceRead( uint8_t *buf, uint16_t bufLen, uint16_t *lost )
+{
+  uint16_t n = 0;
+  
+#ifdef RFAL_TRACE
+  uint32_t primask;
+  uint16_t tail = timerTraceTail;
+  uint8_t  i;
+  
+  while( (tail != timerTraceHead) && (bufLen >= TIMER_TRACE_ENTRY_LEN) )
+  {
+    for( i = 0; i < 4U; i++ )
+    {
+      buf[i]      = (uint8_t)(timerTrace[tail & TIMER_TRACE_MASK][0] >> (8U * i));
+      buf[i + 4U] = (uint8_t)(timerTrace[tail & TIMER_TRACE_MASK][1] >> (8U * i));
+    }
+    buf    += TIMER_TRACE_ENTRY_LEN;
+    bufLen -= TIMER_TRACE_ENTRY_LEN;
+    tail++;
+    n++;
+  }
+  timerTraceTail = tail;
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if( lost != NULL )
+  {
+    *lost = timerTraceLost;
+  }
+  timerTraceLost = 0;
+  __set_PRIMASK(primask);
+#else
+  (void)buf;
+  (void)bufLen;
+  if( lost != NULL )
+  {
+    *lost = 0;
+  }
+#endif /* RFAL_TRACE */
+  
+  return n;
+}
+
+
+/*******************************************************************************/
+void timerTraceClear( void )
+{
+#ifdef RFAL_TRACE
+  uint32_t primask;
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  
+  /* The cycle counter is shared (logger timestamps): enable it, never reset it */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+  
+  timerTraceRefCyc  = DWT->CYCCNT;
+  timerTraceRefTick = platformGetSysTick();
+  timerTraceStarted = true;
+  timerTraceTail    = timerTraceHead;
+  timerTraceLost    = 0;
+  
+  __set_PRIMASK(primask);
+#endif /* RFAL_TRACE */
+}
+
@@ -338,6 +338,8 @@
 
 #define ST_COM_LOG_D2H                     0x6A /* logging object from device to host only */
 
+#define ST_COM_EVENT_D2H                   0x6C /* unsolicited event from device to host only */
+
 /* 0x6B = reserved protocol id
    This will become 0xEB at sending because it is:
    ST_COM_WRITE_READ_NOT | ST_COM_CTRL_CMD_ENTER_BOOTLOADER == 0x80 | 0x6B = 0xEB */
@@ -346,7 +348,7 @@
 /* 0x7F = reserved protocol id */
 #define ST_COM_FLUSH                       0x7F
 
-/* currently available reserved numbers are: 0x6A and 0x6C - 0x7E */
+/* currently available reserved numbers are: 0x6D - 0x7E */
 
 /* all unused numbers between 0x00 and 0x5F are forwarded in the firmware (by the stream_dispatcher.c)
    to the function
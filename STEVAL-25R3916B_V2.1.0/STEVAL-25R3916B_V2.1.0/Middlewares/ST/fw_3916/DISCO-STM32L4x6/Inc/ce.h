@@ -40,6 +40,9 @@
 * GLOBAL DEFINES
 ******************************************************************************
 */
+#define CE_RULES_MAX                16U     /*!< Max number of APDU rules answered on target      */
+#define CE_RULES_POOL_LEN           512U    /*!< Storage for rule C-APDU, mask and R-APDU bytes   */
+#define CE_NDEF_FILE_LEN            1024U   /*!< Emulated T4T NDEF file size (including NLEN)     */
 
 /*
 ******************************************************************************
@@ -68,6 +71,11 @@ enum cardEmulationCommand
     CARDEMULATION_CMD_SET_TX_F                  = 0x16,
     
     CARDEMULATION_CMD_GET_LISTEN_STATE          = 0x21,
+
+    CARDEMULATION_CMD_ADD_RULE                  = 0x31, /*!< add a C-APDU/R-APDU rule answered on target. */
+    CARDEMULATION_CMD_CLEAR_RULES               = 0x32, /*!< remove all rules. */
+    CARDEMULATION_CMD_SET_NDEF                  = 0x33, /*!< write into the emulated NDEF file. */
+    CARDEMULATION_CMD_GET_NDEF                  = 0x34, /*!< read from the emulated NDEF file. */
 };
 //
 //enum cardEmulationState
@@ -96,4 +104,15 @@ extern ReturnCode ceSetTx(const uint8_t cmd, const uint8_t* rxData, const uint16
 
 extern ReturnCode ceGetListenState(uint8_t *txData, uint16_t *txSize);
 
+/*
+ * Rule format: | cmdLen | cmd (cmdLen) | mask (cmdLen) | rspLen | rsp (rspLen) |
+ * A C-APDU matches when its first cmdLen bytes equal cmd on the mask bits.
+ */
+extern ReturnCode ceAddRule(const uint8_t *rxData, const uint16_t rxSize);
+extern ReturnCode ceClearRules( void );
+
+/* NDEF file access: | offset (2 bytes LE) | data | and | offset (2 bytes LE) | length | */
+extern ReturnCode ceSetNdef(const uint8_t *rxData, const uint16_t rxSize);
+extern ReturnCode ceGetNdef(const uint8_t *rxData, const uint16_t rxSize, uint8_t *txData, uint16_t *txSize);
+
 #endif /* CARDEMULATION_H */
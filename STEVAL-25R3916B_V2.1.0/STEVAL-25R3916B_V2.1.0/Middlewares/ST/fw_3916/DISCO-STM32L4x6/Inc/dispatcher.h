@@ -38,6 +38,21 @@
 * INCLUDES
 ******************************************************************************
 */
+#include <stdint.h>
+
+/*
+******************************************************************************
+* GLOBAL DEFINES
+******************************************************************************
+*/
+/* Events pushed to the GUI as ST_COM_EVENT_D2H packets: | event | data | */
+#define DISPATCHER_EVT_TRANSCEIVE_DONE      0x01U   /*!< ISO-DEP APDU transceive finished, data: status (2 bytes LE)      */
+#define DISPATCHER_EVT_WAKEUP               0x02U   /*!< Wake-up mode detected a tag (field/amplitude/phase change)       */
+#define DISPATCHER_EVT_CE_RX                0x03U   /*!< Card emulation C-APDU ready to be fetched with ceGetRx()         */
+#define DISPATCHER_EVT_CE_DEACTIVATED       0x04U   /*!< Card emulation link lost or put to sleep, data: status (2 bytes) */
+#define DISPATCHER_EVT_OVERFLOW             0xFFU   /*!< Events were dropped, data: number of events dropped              */
+
+#define DISPATCHER_EVT_DATA_MAX             2U      /*!< Max event data length                                            */
 
 /*
 ******************************************************************************
@@ -56,6 +71,20 @@
  */
 extern void dispatcherWorker(void);
 
+/*! 
+ *****************************************************************************
+ *  \brief  Queue an event for the GUI
+ *
+ * The event is sent unsolicited by applProcessCyclic() if the GUI enabled it
+ * (RFAL_CMD_SET_EVENT_MASK), otherwise it is discarded. Bit (evt - 1) of the
+ * mask enables event evt.
+ *
+ *  \param[in] evt  : DISPATCHER_EVT_xxx
+ *  \param[in] data : event data, may be NULL if len is 0
+ *  \param[in] len  : data length, up to DISPATCHER_EVT_DATA_MAX
+ */
+extern void dispatcherPushEvent(uint8_t evt, const uint8_t *data, uint8_t len);
+
 
 #endif /* DISPATCHER_H */
 
@@ -82,6 +82,7 @@ typedef enum
 	MODE_ALGO_PAR_SWEEP_AND_SER_BINARY_SEARCH = 0x20, /*!< Default algorithm: Sweep and search binary */
 	MODE_ALGO_2DIM_BINARY_SEARCH = 0x30,  /*!< 2 Dimensional binary search */
 	MODE_ALGO_HILL_CLIMB = 0x40,          /*!< Hill climbing */
+	MODE_ALGO_COARSE_TO_FINE = 0x50,      /*!< Coarse grid refined with a parabolic fit, window halved per level */
 }tuningAlgorithmMode_t;
 
 
@@ -30,6 +30,7 @@
 #include "rfal_isoDep.h"
 #include "rfal_nfca.h"
 #include "logger.h"
+#include "dispatcher.h"
 
 /*
 ******************************************************************************
@@ -37,6 +38,48 @@
 ******************************************************************************
 */
 
+#define CE_APDU_HDR_LEN         4U         /* CLA INS P1 P2                          */
+#define CE_SW_LEN               2U         /* SW1 SW2                                */
+
+#define CE_INS_SELECT           0xA4U
+#define CE_INS_READ_BINARY      0xB0U
+#define CE_INS_UPDATE_BINARY    0xD6U
+
+#define CE_SW_OK                0x9000U
+#define CE_SW_WRONG_LENGTH      0x6700U
+#define CE_SW_NOT_ALLOWED       0x6986U
+#define CE_SW_NOT_FOUND         0x6A82U
+#define CE_SW_WRONG_OFFSET      0x6B00U
+#define CE_SW_INS_NOT_SUPPORTED 0x6D00U
+
+#define CE_NDEF_CC_FID          0xE103U
+#define CE_NDEF_FID             0xE104U
+#define CE_NDEF_CC_LEN          15U
+#define CE_NDEF_MLE             0x003BU    /* Max R-APDU data, fits the smallest usual FSD */
+#define CE_NDEF_MLC             0x0034U    /* Max C-APDU data */
+
+/*
+******************************************************************************
+* LOCAL DATA TYPES
+******************************************************************************
+*/
+
+/* APDU rule, bytes stored in ceRulePool as | cmd & mask | mask | rsp | */
+typedef struct
+{
+    uint16_t pos;
+    uint8_t  cmdLen;
+    uint8_t  rspLen;
+} ceRule;
+
+typedef enum
+{
+    CE_NDEF_SEL_NONE,
+    CE_NDEF_SEL_APP,
+    CE_NDEF_SEL_CC,
+    CE_NDEF_SEL_FILE,
+} ceNdefSelection;
+
 
 
 /*
@@ -44,8 +87,11 @@
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
-void ceNfcaCardemu4A(uint8_t mode, rfalIsoDepTxRxParam *isoDepTxRxParam);
+bool ceNfcaCardemu4A(uint8_t mode, rfalIsoDepTxRxParam *isoDepTxRxParam);
 void ceNfcfCardemu3(uint8_t mode, rfalTransceiveContext *ctx);
+static uint16_t ceMatchRule(const uint8_t *cApdu, uint16_t cLen, uint8_t *rApdu);
+static uint16_t ceNdefProcess(const uint8_t *cApdu, uint16_t cLen, uint8_t *rApdu);
+static void ceEventDeactivated(ReturnCode status);
 
 
 /*
@@ -83,6 +129,29 @@ rfalIsoDepTxRxParam                     isoDepTxRxParam;
 
 bool                                    rxReady = false;
 bool                                    txReady = false;
+static ReturnCode                       rxStatusA = RFAL_ERR_NONE;   /* Deactivation to report on next ceGetRx() */
+
+static ceRule                           ceRules[CE_RULES_MAX];
+static uint8_t                          ceRulesCnt = 0;
+static uint8_t                          ceRulePool[CE_RULES_POOL_LEN];
+static uint16_t                         ceRulePoolLen = 0;
+
+static uint8_t                          ceNdefFile[CE_NDEF_FILE_LEN];
+static bool                             ceNdefLoaded = false;        /* ceNdefFile written by the host through SET_NDEF */
+static ceNdefSelection                  ceNdefSel = CE_NDEF_SEL_NONE;
+
+static const uint8_t                    ceNdefAid[] = { 0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01 };
+static const uint8_t                    ceNdefCc[CE_NDEF_CC_LEN] =
+{
+    0x00, CE_NDEF_CC_LEN,                                      /* CCLEN             */
+    0x20,                                                      /* Mapping version   */
+    (uint8_t)(CE_NDEF_MLE >> 8), (uint8_t)CE_NDEF_MLE,         /* MLe               */
+    (uint8_t)(CE_NDEF_MLC >> 8), (uint8_t)CE_NDEF_MLC,         /* MLc               */
+    0x04, 0x06,                                                /* NDEF File Control */
+    (uint8_t)(CE_NDEF_FID >> 8), (uint8_t)CE_NDEF_FID,
+    (uint8_t)(CE_NDEF_FILE_LEN >> 8), (uint8_t)CE_NDEF_FILE_LEN,
+    0x00, 0x00                                                 /* Read/Write access */
+};
 
 
 /***************************************************************************/
@@ -119,6 +188,8 @@ void ceInitalize( void )
     isFirstF_Frame = false;
     rxReady = false;
     txReady = false;
+    rxStatusA = RFAL_ERR_NONE;
+    ceNdefSel = CE_NDEF_SEL_NONE;
     
     ceEnabled = false;
 }
@@ -193,6 +264,7 @@ void ceHandler( void )
                     
                         case RFAL_ERR_NONE:
                             isActivatedA = true;
+                            ceNdefSel = CE_NDEF_SEL_NONE;
                             break;
     
                         // all other error cases are simple ignored ..
@@ -200,43 +272,50 @@ void ceHandler( void )
                             break;
                     }
                 }
-            }else
-            {   // process command internal
-                if(CARDEMULATION_PROCESS_INTERNAL == (emuMode & CARDEMULATION_PROCESS_INTERNAL))
-                {   
-                    switch (rfalIsoDepGetTransceiveStatus())
-                    {
-                        case RFAL_ERR_SLEEP_REQ:
-                            retCode = rfalListenSleepStart( RFAL_LM_STATE_SLEEP_A , rxBuf, RX_BUF_LENGTH, &rxRcvdLen );
-                            rxReady = txReady = isActivatedA = false;
-                            if (RFAL_ERR_LINK_LOSS == retCode)
-                            {
-                                rfalListenStop();
-                                rfalListenStart(configMask, &configA, &configB, &configF, rxBuf, rfalConvBytesToBits(RX_BUF_LENGTH), &rxRcvdLen);
-                            }
-                            break;
-                        case RFAL_ERR_LINK_LOSS:
+            }else if(!rxReady && !txReady)
+            {   // process commands on target, within the FDT. Only the
+                // ones not handled here are held for the host (ceGetRx)
+                retCode = rfalIsoDepGetTransceiveStatus();
+                switch (retCode)
+                {
+                    case RFAL_ERR_SLEEP_REQ:
+                        retCode = rfalListenSleepStart( RFAL_LM_STATE_SLEEP_A , rxBuf, RX_BUF_LENGTH, &rxRcvdLen );
+                        rxReady = txReady = isActivatedA = false;
+                        rxStatusA = RFAL_ERR_SLEEP_REQ;
+                        ceEventDeactivated(rxStatusA);
+                        if (RFAL_ERR_LINK_LOSS == retCode)
+                        {
                             rfalListenStop();
                             rfalListenStart(configMask, &configA, &configB, &configF, rxBuf, rfalConvBytesToBits(RX_BUF_LENGTH), &rxRcvdLen);
-                            rxReady = txReady = isActivatedA = false;                        
-                            break;
-                            
-                        case RFAL_ERR_AGAIN:
-                            // handle RX chaining..                        
-                            // copy RX to my buffer                        
-                            // send via USB to Host -> blocking
-                            
-                            //rfalIsoDepStartTransceive(isoDepTxRxParam);
-                            break;
-                            
-                        case RFAL_ERR_NONE:
-                            ceNfcaCardemu4A(emuMode, &isoDepTxRxParam);
-                            break;
-                            
-                        // all other error cases are simple ignored ..
-                        default:
-                            break;
-                    }
+                        }
+                        break;
+                    case RFAL_ERR_LINK_LOSS:
+                        rfalListenStop();
+                        rfalListenStart(configMask, &configA, &configB, &configF, rxBuf, rfalConvBytesToBits(RX_BUF_LENGTH), &rxRcvdLen);
+                        rxReady = txReady = isActivatedA = false;                        
+                        rxStatusA = RFAL_ERR_LINK_LOSS;
+                        ceEventDeactivated(rxStatusA);
+                        break;
+                        
+                    case RFAL_ERR_AGAIN:
+                        // handle RX chaining..                        
+                        // copy RX to my buffer                        
+                        // send via USB to Host -> blocking
+                        
+                        //rfalIsoDepStartTransceive(isoDepTxRxParam);
+                        break;
+                        
+                    case RFAL_ERR_NONE:
+                        if(!ceNfcaCardemu4A(emuMode, &isoDepTxRxParam))
+                        {   // miss: keep it for the host
+                            rxReady = true;
+                            dispatcherPushEvent(DISPATCHER_EVT_CE_RX, NULL, 0);
+                        }
+                        break;
+                        
+                    // all other error cases are simple ignored ..
+                    default:
+                        break;
                 }
             }
             break;
@@ -407,46 +486,25 @@ ReturnCode ceGetRx(const uint8_t cmd, uint8_t *txData, uint16_t *txSize)
     switch (cmd)
     {
         case CARDEMULATION_CMD_GET_RX_A:
-            if(isActivatedA)
-            {                
-                err = rfalIsoDepGetTransceiveStatus();
-               
-                switch (err)
-                {
-                    case RFAL_ERR_SLEEP_REQ:
-                        /* FIXME: RFAL_ERR_SLEEP_REQ is signaled after S(DSL)
-                         * response was sent. Issuing SleepStart will
-                         * re-enable automtatic responses to WUPA/ALL_REQ.
-                         * ceGetRx() gets triggered by USB (every few ms).
-                         * Calling SleepStart() here may be too late.*/
-                        err = rfalListenSleepStart( RFAL_LM_STATE_SLEEP_A , rxBuf, RX_BUF_LENGTH, &rxRcvdLen );
-                        rxReady = txReady = isActivatedA = false;
-                        if (RFAL_ERR_LINK_LOSS == err)
-                        {
-                            rfalListenStop();
-                            rfalListenStart(configMask, &configA, &configB, &configF, rxBuf, rfalConvBytesToBits(RX_BUF_LENGTH), &rxRcvdLen);
-                        }
-                        break;
-                    case RFAL_ERR_LINK_LOSS:
-                    default:
-                        rfalListenStop();
-                        rfalListenStart(configMask, &configA, &configB, &configF, rxBuf, rfalConvBytesToBits(RX_BUF_LENGTH), &rxRcvdLen);
-                        rxReady = txReady = isActivatedA = false;                        
-                        break;
+            // ceHandler() polls the link and answers what it can, here
+            // only the commands it left for the host are picked up
+            if(rxReady)
+            {
+                RFAL_MEMCPY(txData, isoDepTxRxParam.rxBuf->inf, *isoDepTxRxParam.rxLen);
+                *txSize = *isoDepTxRxParam.rxLen;
                     
-                    case RFAL_ERR_BUSY:           /* Transceive ongoing                              */
-                    case RFAL_ERR_AGAIN:          /* Chaining packet received - handling to be added */
-                        break;
-                        
-                    case RFAL_ERR_NONE:
-                        RFAL_MEMCPY(txData, isoDepTxRxParam.rxBuf->inf, *isoDepTxRxParam.rxLen);
-                        *txSize = *isoDepTxRxParam.rxLen;
-                            
-                        rxReady = false;
-                        txReady = true;
-                        break;
-                }
-
+                rxReady = false;
+                txReady = true;
+                err = RFAL_ERR_NONE;
+            }
+            else if(rxStatusA != RFAL_ERR_NONE)
+            {   // report deactivation once
+                err = rxStatusA;
+                rxStatusA = RFAL_ERR_NONE;
+            }
+            else if(isActivatedA)
+            {
+                err = RFAL_ERR_BUSY;
             }
             break;
             
@@ -566,27 +624,285 @@ ReturnCode ceGetListenState(uint8_t * txData, uint16_t *txSize)
     return RFAL_ERR_NONE;
 }
 
+/***************************************************************************/
+/*                                                                         */
+/***************************************************************************/
+ReturnCode ceAddRule(const uint8_t *rxData, const uint16_t rxSize)
+{
+    uint8_t  cmdLen;
+    uint8_t  rspLen;
+    uint16_t i;
+    uint8_t *pool;
+    
+    //   0        1..n   n+1..2n   2n+1     ..
+    // | cmdLen | cmd  | mask    | rspLen | rsp |
+    if(rxSize < 1U)
+    {
+        return RFAL_ERR_PARAM;
+    }
+    cmdLen = rxData[0];
+    if((cmdLen == 0U) || (rxSize < (2U + (2U * cmdLen))))
+    {
+        return RFAL_ERR_PARAM;
+    }
+    rspLen = rxData[1U + (2U * cmdLen)];
+    if((rspLen < CE_SW_LEN) || (rxSize < (2U + (2U * cmdLen) + rspLen)) || (rspLen > (TX_BUF_LENGTH - RFAL_ISODEP_PROLOGUE_SIZE)))
+    {
+        return RFAL_ERR_PARAM;
+    }
+    if((ceRulesCnt >= CE_RULES_MAX) || ((ceRulePoolLen + (2U * cmdLen) + rspLen) > CE_RULES_POOL_LEN))
+    {
+        return RFAL_ERR_NOMEM;
+    }
+    
+    // store the command already masked, so matching is a plain compare
+    pool = &ceRulePool[ceRulePoolLen];
+    for(i = 0; i < cmdLen; i++)
+    {
+        pool[i]          = rxData[1U + i] & rxData[1U + cmdLen + i];
+        pool[cmdLen + i] = rxData[1U + cmdLen + i];
+    }
+    RFAL_MEMCPY(&pool[2U * cmdLen], &rxData[2U + (2U * cmdLen)], rspLen);
+    
+    ceRules[ceRulesCnt].pos    = ceRulePoolLen;
+    ceRules[ceRulesCnt].cmdLen = cmdLen;
+    ceRules[ceRulesCnt].rspLen = rspLen;
+    ceRulesCnt++;
+    ceRulePoolLen += (2U * cmdLen) + rspLen;
+    
+    return RFAL_ERR_NONE;
+}
 
+/***************************************************************************/
+/*                                                                         */
+/***************************************************************************/
+ReturnCode ceClearRules( void )
+{
+    ceRulesCnt    = 0;
+    ceRulePoolLen = 0;
+    return RFAL_ERR_NONE;
+}
 
+/***************************************************************************/
+/*                                                                         */
+/***************************************************************************/
+ReturnCode ceSetNdef(const uint8_t *rxData, const uint16_t rxSize)
+{
+    uint16_t offset;
+    
+    if(rxSize < 2U)
+    {
+        return RFAL_ERR_PARAM;
+    }
+    offset = (uint16_t)rxData[0] | ((uint16_t)rxData[1] << 8);
+    if((offset + (rxSize - 2U)) > CE_NDEF_FILE_LEN)
+    {
+        return RFAL_ERR_PARAM;
+    }
+    RFAL_MEMCPY(&ceNdefFile[offset], &rxData[2], (rxSize - 2U));
+    ceNdefLoaded = true;
+    return RFAL_ERR_NONE;
+}
 
+/***************************************************************************/
+/*                                                                         */
+/***************************************************************************/
+ReturnCode ceGetNdef(const uint8_t *rxData, const uint16_t rxSize, uint8_t *txData, uint16_t *txSize)
+{
+    uint16_t offset;
+    uint16_t len;
+    
+    if(rxSize < 3U)
+    {
+        return RFAL_ERR_PARAM;
+    }
+    offset = (uint16_t)rxData[0] | ((uint16_t)rxData[1] << 8);
+    len    = RFAL_MIN( (uint16_t)rxData[2], *txSize );
+    if((offset + len) > CE_NDEF_FILE_LEN)
+    {
+        return RFAL_ERR_PARAM;
+    }
+    RFAL_MEMCPY(txData, &ceNdefFile[offset], len);
+    *txSize = len;
+    return RFAL_ERR_NONE;
+}
 
-void ceNfcaCardemu4A(uint8_t mode, rfalIsoDepTxRxParam *isoDepTxRxParam)
+/***************************************************************************/
+/*                                                                         */
+/***************************************************************************/
+static uint16_t ceMatchRule(const uint8_t *cApdu, uint16_t cLen, uint8_t *rApdu)
 {
-    switch(mode)
+    uint8_t        r;
+    uint8_t        i;
+    const uint8_t *pool;
+    
+    for(r = 0; r < ceRulesCnt; r++)
     {
-        case CARDEMULATION_MODE_REFLECT: 
-            // echo ..
-            isoDepTxRxParam->txBuf = isoDepTxRxParam->rxBuf;
-            isoDepTxRxParam->txBufLen = *(isoDepTxRxParam->rxLen);
-            rfalIsoDepStartTransceive(*isoDepTxRxParam);
-            break;
+        if(cLen < ceRules[r].cmdLen)
+        {
+            continue;
+        }
         
-        case CARDEMULATION_MODE_NDEF:
-            // Stub for internal NDEF processing
+        pool = &ceRulePool[ceRules[r].pos];
+        for(i = 0; i < ceRules[r].cmdLen; i++)
+        {
+            if((cApdu[i] & pool[ceRules[r].cmdLen + i]) != pool[i])
+            {
+                break;
+            }
+        }
+        
+        if(i == ceRules[r].cmdLen)
+        {
+            RFAL_MEMCPY(rApdu, &pool[2U * ceRules[r].cmdLen], ceRules[r].rspLen);
+            return ceRules[r].rspLen;
+        }
+    }
+    return 0;
+}
+
+/***************************************************************************/
+/*                                                                         */
+/***************************************************************************/
+static void ceEventDeactivated(ReturnCode status)
+{
+    uint8_t data[2] = { (uint8_t)status, (uint8_t)(status >> 8) };
+    dispatcherPushEvent(DISPATCHER_EVT_CE_DEACTIVATED, data, sizeof(data));
+}
 
+/***************************************************************************/
+/*                                                                         */
+/***************************************************************************/
+static uint16_t ceSetSw(uint8_t *rApdu, uint16_t len, uint16_t sw)
+{
+    rApdu[len]      = (uint8_t)(sw >> 8);
+    rApdu[len + 1U] = (uint8_t)sw;
+    return (len + CE_SW_LEN);
+}
+
+/***************************************************************************/
+/*  NFC Forum T4T NDEF application: SELECT, READ BINARY, UPDATE BINARY     */
+/***************************************************************************/
+static uint16_t ceNdefProcess(const uint8_t *cApdu, uint16_t cLen, uint8_t *rApdu)
+{
+    const uint8_t *file;
+    uint16_t       fileLen;
+    uint16_t       offset;
+    uint16_t       len;
+    
+    if((cLen < CE_APDU_HDR_LEN) || (cApdu[0] != 0x00U))
+    {
+        return 0;
+    }
+    offset = ((uint16_t)cApdu[2] << 8) | cApdu[3];
+    
+    switch(cApdu[1])
+    {
+        case CE_INS_SELECT:
+            if((cApdu[2] == 0x04U) && (cLen >= (CE_APDU_HDR_LEN + 1U + sizeof(ceNdefAid))) && (cApdu[4] == sizeof(ceNdefAid))
+               && (RFAL_BYTECMP(&cApdu[5], ceNdefAid, sizeof(ceNdefAid)) == 0))
+            {
+                ceNdefSel = CE_NDEF_SEL_APP;
+                return ceSetSw(rApdu, 0, CE_SW_OK);
+            }
+            if((cApdu[2] == 0x00U) && (cLen >= (CE_APDU_HDR_LEN + 3U)) && (cApdu[4] == 2U) && (ceNdefSel != CE_NDEF_SEL_NONE))
+            {
+                switch(((uint16_t)cApdu[5] << 8) | cApdu[6])
+                {
+                    case CE_NDEF_CC_FID: ceNdefSel = CE_NDEF_SEL_CC;   return ceSetSw(rApdu, 0, CE_SW_OK);
+                    case CE_NDEF_FID:    ceNdefSel = CE_NDEF_SEL_FILE; return ceSetSw(rApdu, 0, CE_SW_OK);
+                    default:             break;
+                }
+            }
+            return ceSetSw(rApdu, 0, CE_SW_NOT_FOUND);
+            
+        case CE_INS_READ_BINARY:
+            if(ceNdefSel == CE_NDEF_SEL_CC)
+            {
+                file = ceNdefCc;     fileLen = CE_NDEF_CC_LEN;
+            }
+            else if(ceNdefSel == CE_NDEF_SEL_FILE)
+            {
+                file = ceNdefFile;   fileLen = CE_NDEF_FILE_LEN;
+            }
+            else
+            {
+                return ceSetSw(rApdu, 0, CE_SW_NOT_ALLOWED);
+            }
+            if(offset >= fileLen)
+            {
+                return ceSetSw(rApdu, 0, CE_SW_WRONG_OFFSET);
+            }
+            len = ((cLen > CE_APDU_HDR_LEN) && (cApdu[4] != 0U)) ? cApdu[4] : 256U;
+            len = RFAL_MIN( len, (uint16_t)(fileLen - offset) );
+            len = RFAL_MIN( len, CE_NDEF_MLE );
+            RFAL_MEMCPY(rApdu, &file[offset], len);
+            return ceSetSw(rApdu, len, CE_SW_OK);
+            
+        case CE_INS_UPDATE_BINARY:
+            if(ceNdefSel != CE_NDEF_SEL_FILE)
+            {
+                return ceSetSw(rApdu, 0, CE_SW_NOT_ALLOWED);
+            }
+            if((cLen <= CE_APDU_HDR_LEN) || (cLen < (CE_APDU_HDR_LEN + 1U + cApdu[4])))
+            {
+                return ceSetSw(rApdu, 0, CE_SW_WRONG_LENGTH);
+            }
+            if((offset + cApdu[4]) > CE_NDEF_FILE_LEN)
+            {
+                return ceSetSw(rApdu, 0, CE_SW_WRONG_OFFSET);
+            }
+            RFAL_MEMCPY(&ceNdefFile[offset], &cApdu[5], cApdu[4]);
+            return ceSetSw(rApdu, 0, CE_SW_OK);
+            
         default:
             break;
     }
+    return 0;
+}
+
+
+
+
+
+bool ceNfcaCardemu4A(uint8_t mode, rfalIsoDepTxRxParam *isoDepTxRxParam)
+{
+    const uint8_t *cApdu = isoDepTxRxParam->rxBuf->inf;
+    uint16_t       cLen  = *(isoDepTxRxParam->rxLen);
+    uint8_t       *rApdu = txBufA->inf;
+    uint16_t       rLen;
+    
+    if((mode & (uint8_t)~CARDEMULATION_PROCESS_INTERNAL) == CARDEMULATION_MODE_REFLECT)
+    {
+        // echo ..
+        isoDepTxRxParam->txBuf = isoDepTxRxParam->rxBuf;
+        isoDepTxRxParam->txBufLen = *(isoDepTxRxParam->rxLen);
+        rfalIsoDepStartTransceive(*isoDepTxRxParam);
+        return true;
+    }
+    
+    // host loaded rules first, then the NDEF application: only when there is no host to
+    // forward to, or the host loaded the NDEF file, otherwise the host answers as before
+    rLen = ceMatchRule(cApdu, cLen, rApdu);
+    if((rLen == 0U) && ((mode & CARDEMULATION_MODE_NDEF) != 0U)
+       && (((mode & CARDEMULATION_PROCESS_INTERNAL) != 0U) || ceNdefLoaded))
+    {
+        rLen = ceNdefProcess(cApdu, cLen, rApdu);
+    }
+    if((rLen == 0U) && ((mode & CARDEMULATION_PROCESS_INTERNAL) != 0U))
+    {   // no host to forward to
+        rLen = ceSetSw(rApdu, 0, CE_SW_INS_NOT_SUPPORTED);
+    }
+    if(rLen == 0U)
+    {
+        return false;
+    }
+    
+    isoDepTxRxParam->txBuf    = txBufA;
+    isoDepTxRxParam->txBufLen = rLen;
+    *isoDepTxRxParam->rxLen   = 0;
+    rfalIsoDepStartTransceive(*isoDepTxRxParam);
+    return true;
 }
 
 
@@ -102,6 +102,13 @@
 #define PERSISTENT_ANALOG_CONFIG_ERASE 1
 #define PERSISTENT_ANALOG_CONFIG_CRC   2
 
+/* Virtual register addresses as used by applReadReg()/applWriteReg():
+   0x00-0x3F space A, 0x40-0x7F space B, 0x80-0xBF test registers */
+#define VREG_TEST                      0x80U
+#define VREG_SPACE_MASK                0xC0U
+#define VREG_ADDR_MASK                 0x3FU
+#define VREG_SNAPSHOT_LEN              0x80U  /* space A and B, test registers are not part of the snapshot */
+
 /*! Command codes for NFC protocol. */
 enum nfcCommand
 {
@@ -171,6 +178,13 @@ enum rfalCommand
     RFAL_CMD_DPO_GET_CURRENT_TABLE_ENTRY       = 0x67U,    /*!< DPO Get current table index */
     
     RFAL_CMD_GET_TRANSCEIVE_RSSI               = 0x70,
+    RFAL_CMD_GET_TRACE                         = 0x71,
+    RFAL_CMD_SET_EVENT_MASK                    = 0x72,
+    RFAL_CMD_READ_REGS                         = 0x73,
+    RFAL_CMD_WRITE_REGS                        = 0x74,
+    RFAL_CMD_READ_REG_RANGE                    = 0x75,
+    RFAL_CMD_WRITE_REG_RANGE                   = 0x76,
+    RFAL_CMD_REG_SNAPSHOT_DIFF                 = 0x77,
 };
 enum IsodepCommand
 {
@@ -238,6 +252,24 @@ static uint16_t                gRcvdLen;                 /* rx length used only
 static rfalIsoDepApduBufFormat gIsoDepApduBuffer;        /* Buffer dedicated to apdu */
 static bool                    gIsoDepTransceiveOngoing; /* On going flag for APDU tranceive */
 static ReturnCode              gIsoDepTransceiveError;   /* status of APDU transceive        */
+static bool                    gWakeUpOngoing;           /* Wake-up mode started by the GUI  */
+static uint8_t                 gRegSnapshot[VREG_SNAPSHOT_LEN]; /* Register values last reported to the GUI */
+static uint8_t                 gRegSnapshotKnown[VREG_SNAPSHOT_LEN / 8U]; /* Registers already reported once */
+
+// Events pushed to the GUI through applProcessCyclic()
+#define EVT_QUEUE_LEN   16U
+typedef struct
+{
+    uint8_t evt;
+    uint8_t len;
+    uint8_t data[DISPATCHER_EVT_DATA_MAX];
+} dispatcherEvent;
+
+static dispatcherEvent         gEvtQueue[EVT_QUEUE_LEN];
+static uint8_t                 gEvtHead;                 /* next to write */
+static uint8_t                 gEvtTail;                 /* next to send  */
+static uint8_t                 gEvtLost;                 /* dropped since last overflow event */
+static uint8_t                 gEvtMask;                 /* enabled events, none by default   */
 
 
 /*
@@ -262,6 +294,9 @@ static ReturnCode processFeliCa       (const uint8_t *rxData, uint16_t rxSize, u
 static ReturnCode processIsoDep       (const uint8_t *rxData, uint16_t rxSize, uint8_t *txData, uint16_t *txSize);
 static ReturnCode processCardEmulation(const uint8_t *rxData, const uint16_t rxSize, uint8_t *txData, uint16_t *txSize);
 static ReturnCode processDefault      (const uint8_t *rxData, const uint16_t rxSize, uint8_t *txData, uint16_t *txSize);
+static ReturnCode readVirtualRegs     (uint8_t vreg, uint8_t *values, uint8_t len);
+static ReturnCode writeVirtualRegs    (uint8_t vreg, const uint8_t *values, uint8_t len);
+static ReturnCode processRegSnapshotDiff(const uint8_t *rxData, uint16_t rxSize, uint8_t *txData, uint16_t *txSize);
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -700,6 +735,51 @@ uint8_t processProtocols ( const uint8_t * rxData, uint16_t rxSize, uint8_t * tx
       <tr><th>Content</th><td>rxLen</td><td>rxData</td></tr>
     </table>
 
+  -  RFAL Get Trace (firmware built with RFAL_TRACE, otherwise no entries are returned)
+    <table>
+      <tr><th>   Byte</th> <th>0</th> <th>1</th> </tr>
+      <tr><th>Content</th><td>0x71(ID)</td> <td>clear: 1 discards the trace and restarts timestamps, 0 reads</td> </tr>
+    </table>
+     returns status RFAL_ERR_NONE and the oldest entries that fit, to be called until count is 0:
+    <table>
+      <tr><th>   Byte</th><th>0..1</th><th>2..3</th><th>4..4+8*count</th></tr>
+      <tr><th>Content</th><td>count</td><td>lost events</td><td>entries: timestamp us (3 bytes), event, value (4 bytes)</td></tr>
+    </table>
+
+  -  Register list / range access. Addresses are virtual as for ST_COM_READ_REG:
+     0x00-0x3F space A, 0x40-0x7F space B, 0x80-0xBF test registers.
+     A range stays within one space and is accessed with a single auto-increment transfer.
+    <table>
+      <tr><th>   Byte</th> <th>0</th> <th>1..n</th> <th>Response</th> </tr>
+      <tr><th>Read list</th><td>0x73(ID)</td> <td>addr0 addr1 ..</td> <td>val0 val1 ..</td> </tr>
+      <tr><th>Write list</th><td>0x74(ID)</td> <td>addr0 val0 addr1 val1 ..</td> <td>-</td> </tr>
+      <tr><th>Read range</th><td>0x75(ID)</td> <td>start count</td> <td>count values</td> </tr>
+      <tr><th>Write range</th><td>0x76(ID)</td> <td>start val0 val1 ..</td> <td>-</td> </tr>
+      <tr><th>Snapshot diff</th><td>0x77(ID)</td> <td>reset: 1 reports all registers</td> <td>addr val pairs changed since last call</td> </tr>
+    </table>
+     The snapshot covers space A and B without the interrupt registers (reading them clears them).
+     Pairs that do not fit in the response are reported by the next call.
+
+  -  RFAL Set Event Mask
+    <table>
+      <tr><th>   Byte</th> <th>0</th> <th>1</th> </tr>
+      <tr><th>Content</th><td>0x72(ID)</td> <td>mask: bit (evt-1) enables DISPATCHER_EVT_xxx, 0 disables and flushes</td> </tr>
+    </table>
+     returns status RFAL_ERR_NONE. Enabled events are then sent unsolicited with protocol ST_COM_EVENT_D2H:
+    <table>
+      <tr><th>   Byte</th><th>0</th><th>1..</th></tr>
+      <tr><th>Content</th><td>event</td><td>event data</td></tr>
+    </table>
+
+  -  LCD region capture (only with ENABLE_SCREEN_CAPTURE)
+    <table>
+      <tr><th>   Byte</th> <th>0</th> <th>1..2</th> <th>3..4</th> <th>5..6</th> <th>7..8</th> </tr>
+      <tr><th>Content</th><td>0x28(ID)</td> <td>x (LE)</td> <td>y (LE)</td> <td>width (LE)</td> <td>height (LE)</td> </tr>
+    </table>
+     returns status RFAL_ERR_NONE and as many whole rows of the region as fit in the response,
+     RGB565 little endian. The host repeats the command with y advanced by the number of rows received.
+     A full 320x240 screen is read with one GRAM burst per row instead of one window setup per pixel.
+
   */
 static uint8_t processCmd ( const uint8_t * rxData, uint16_t rxSize, uint8_t * txData, uint16_t *txSize)
 {
@@ -916,6 +996,32 @@ static uint8_t processCmd ( const uint8_t * rxData, uint16_t rxSize, uint8_t * t
         rfalInitialize();
         rfalSetPreTxRxCallback( rfalPreTransceiveCb ); /* Restore callback cleared by rfalInitialize()*/
     }
+#ifdef ENABLE_SCREEN_CAPTURE
+    if (cmd == 0x28) /* LCD region capture */
+    {
+        uint16_t x, y, w, h, rows;
+        
+        if (bufSize < 8) return (uint8_t)RFAL_ERR_PARAM;
+        READ_VAL16_LE(x, uint16_t, buf);
+        READ_VAL16_LE(y, uint16_t, buf);
+        READ_VAL16_LE(w, uint16_t, buf);
+        READ_VAL16_LE(h, uint16_t, buf);
+        
+        if ((w == 0U) || (h == 0U) || (((uint32_t)x + w) > BSP_LCD_GetXSize()) || (((uint32_t)y + h) > BSP_LCD_GetYSize()))
+        {
+            return (uint8_t)RFAL_ERR_PARAM;
+        }
+        
+        /* Whole rows only, the host advances y by the rows received */
+        rows = *txSize / (2U * w);
+        if (rows == 0U) return (uint8_t)RFAL_ERR_NOMEM;
+        if (rows > h) rows = h;
+        
+        if (BSP_LCD_ReadRegion(x, y, w, rows, txData) != LCD_OK) return (uint8_t)RFAL_ERR_NOTSUPP;
+        *txSize = rows * w * 2U;
+        err = RFAL_ERR_NONE;
+    }
+#endif /* ENABLE_SCREEN_CAPTURE */
 
     // ----------------------------------------------------------------------
     // - Group: Card emulation ----------------------------------------------
@@ -1172,6 +1278,7 @@ static uint8_t processCmd ( const uint8_t * rxData, uint16_t rxSize, uint8_t * t
         config.cap.aaInclMeas = *buf++;
         config.cap.aaWeight = (rfalWumAAWeight)*buf++;
         err = rfalWakeUpModeStart( &config );
+        gWakeUpOngoing = (err == RFAL_ERR_NONE);
         *txSize = 0;
     }
     if (cmd == RFAL_CHIP_CMD_WAKEUP_HASWOKE){
@@ -1198,6 +1305,7 @@ static uint8_t processCmd ( const uint8_t * rxData, uint16_t rxSize, uint8_t * t
     }
     if (cmd == RFAL_CHIP_CMD_WAKEUP_STOP){
         err= rfalWakeUpModeStop( );
+        gWakeUpOngoing = false;
     }
     if (cmd == RFAL_CMD_DPO_GET_CURRENT_TABLE_ENTRY){
         if (* txSize < 1){ *txSize = 0; return RFAL_ERR_REQUEST;}
@@ -1265,6 +1373,66 @@ static uint8_t processCmd ( const uint8_t * rxData, uint16_t rxSize, uint8_t * t
         if (*txSize) *txSize = 2;
     }
 
+    if (cmd == RFAL_CMD_GET_TRACE){
+        uint16_t count;
+        uint16_t lost;
+        if (*txSize < 4){ *txSize = 0; return RFAL_ERR_REQUEST;}
+        if ((bufSize >= 1) && (buf[0] == 1)){
+            timerTraceClear();
+        }
+        count = timerTraceRead(&txData[4], *txSize - 4, &lost);
+        txData[0] = ((count>>0)&0xFF);
+        txData[1] = ((count>>8)&0xFF);
+        txData[2] = ((lost>>0)&0xFF);
+        txData[3] = ((lost>>8)&0xFF);
+        *txSize = 4 + (count * TIMER_TRACE_ENTRY_LEN);
+        err = RFAL_ERR_NONE;
+    }
+
+    if (cmd == RFAL_CMD_READ_REGS){
+        uint16_t i;
+        if (*txSize < bufSize){ *txSize = 0; return RFAL_ERR_NOMEM;}
+        err = RFAL_ERR_NONE;
+        for (i = 0; (i < bufSize) && (err == RFAL_ERR_NONE); i++){
+            err = readVirtualRegs(buf[i], &txData[i], 1);
+        }
+        *txSize = (err == RFAL_ERR_NONE) ? bufSize : 0;
+    }
+    if (cmd == RFAL_CMD_WRITE_REGS){
+        uint16_t i;
+        if ((bufSize % 2) != 0){ *txSize = 0; return RFAL_ERR_PARAM;}
+        err = RFAL_ERR_NONE;
+        for (i = 0; (i < bufSize) && (err == RFAL_ERR_NONE); i += 2){
+            err = writeVirtualRegs(buf[i], &buf[i + 1], 1);
+        }
+        *txSize = 0;
+    }
+    if (cmd == RFAL_CMD_READ_REG_RANGE){
+        if (bufSize < 2) { *txSize = 0; return RFAL_ERR_PARAM;}
+        if (*txSize < buf[1]){ *txSize = 0; return RFAL_ERR_NOMEM;}
+        err = readVirtualRegs(buf[0], txData, buf[1]);
+        *txSize = (err == RFAL_ERR_NONE) ? buf[1] : 0;
+    }
+    if (cmd == RFAL_CMD_WRITE_REG_RANGE){
+        if ((bufSize < 2) || (bufSize > (VREG_ADDR_MASK + 2U))) { *txSize = 0; return RFAL_ERR_PARAM;}
+        err = writeVirtualRegs(buf[0], &buf[1], (uint8_t)(bufSize - 1));
+        *txSize = 0;
+    }
+    if (cmd == RFAL_CMD_REG_SNAPSHOT_DIFF){
+        err = processRegSnapshotDiff(buf, bufSize, txData, txSize);
+    }
+
+    if (cmd == RFAL_CMD_SET_EVENT_MASK){
+        if (bufSize < 1) { *txSize = 0; return RFAL_ERR_PARAM;}
+        gEvtMask = buf[0];
+        if (gEvtMask == 0){ /* flush what was not sent */
+            gEvtTail = gEvtHead;
+            gEvtLost = 0;
+        }
+        *txSize = 0;
+        err = RFAL_ERR_NONE;
+    }
+
     if ((cmd>>4) >= 0x8)
         err = processProtocols(rxData, rxSize, txData, txSize);
 
@@ -1286,9 +1454,41 @@ void dispatcherWorker()
         gIsoDepTransceiveError = rfalIsoDepGetApduTransceiveStatus();
         if (RFAL_ERR_BUSY != gIsoDepTransceiveError)
         { /* if not busy anymore the transceive is supposed to be finished */
+            uint8_t status[2] = { (uint8_t)gIsoDepTransceiveError, (uint8_t)(gIsoDepTransceiveError >> 8) };
             gIsoDepTransceiveOngoing = false;
+            dispatcherPushEvent(DISPATCHER_EVT_TRANSCEIVE_DONE, status, sizeof(status));
         }
     }
+
+    if ((gWakeUpOngoing == true) && (rfalWakeUpModeHasWoke() == true))
+    { /* report once, the GUI reads the details with RFAL_CHIP_CMD_WAKEUP_GETINFO */
+        gWakeUpOngoing = false;
+        dispatcherPushEvent(DISPATCHER_EVT_WAKEUP, NULL, 0);
+    }
+}
+
+void dispatcherPushEvent(uint8_t evt, const uint8_t *data, uint8_t len)
+{
+    dispatcherEvent *e;
+
+    if ((evt == 0U) || (evt > 8U) || ((gEvtMask & (1U << (evt - 1U))) == 0U))
+    {
+        return;
+    }
+    if ((uint8_t)(gEvtHead - gEvtTail) >= EVT_QUEUE_LEN)
+    {
+        if (gEvtLost < 0xFFU) gEvtLost++;
+        return;
+    }
+
+    e = &gEvtQueue[gEvtHead % EVT_QUEUE_LEN];
+    e->evt = evt;
+    e->len = RFAL_MIN(len, DISPATCHER_EVT_DATA_MAX);
+    if (e->len > 0U)
+    {
+        RFAL_MEMCPY(e->data, data, e->len);
+    }
+    gEvtHead++;
 }
 
 /*
@@ -2858,6 +3058,28 @@ static ReturnCode processCardEmulation(const uint8_t * rxData, const uint16_t rx
             (*txSize)++;
             break;
 
+        case CARDEMULATION_CMD_ADD_RULE:
+            err = txData[0] = ceAddRule(&rxData[2], rxSize - 2);
+            *txSize = 1;
+            break;
+
+        case CARDEMULATION_CMD_CLEAR_RULES:
+            err = txData[0] = ceClearRules();
+            *txSize = 1;
+            break;
+
+        case CARDEMULATION_CMD_SET_NDEF:
+            err = txData[0] = ceSetNdef(&rxData[2], rxSize - 2);
+            *txSize = 1;
+            break;
+
+        case CARDEMULATION_CMD_GET_NDEF:
+            (*txSize)--;
+            err = txData[0] = ceGetNdef(&rxData[2], rxSize - 2, &txData[1], txSize);
+            if (err != RFAL_ERR_NONE) *txSize = 0;
+            (*txSize)++;
+            break;
+
         default:
             err = RFAL_ERR_PARAM;
             break;
@@ -2914,11 +3136,128 @@ ReturnCode processDefault(const uint8_t *rxData, const uint16_t rxSize, uint8_t
 
 uint8_t applProcessCyclic ( uint8_t * protocol, uint16_t * txSize, uint8_t * txData, uint16_t remainingSize )
 {
+    const dispatcherEvent *e;
+
     if ( counter == 0 ){ /* do not log this every time : is called cyclic */
     }
     counter++;
     *txSize = 0;
-    return ST_STREAM_NO_ERROR; /* cyclic is always called, so it is no error if there is no function */
+
+    /* one event per packet, called again as long as something was produced */
+    if (remainingSize < (ST_STREAM_HEADER_SIZE + 1U + DISPATCHER_EVT_DATA_MAX))
+    {
+        return ST_STREAM_NO_ERROR;
+    }
+    if (gEvtTail != gEvtHead)
+    {
+        e = &gEvtQueue[gEvtTail % EVT_QUEUE_LEN];
+        txData[0] = e->evt;
+        RFAL_MEMCPY(&txData[1], e->data, e->len);
+        *txSize = 1U + e->len;
+        gEvtTail++;
+    }
+    else if (gEvtLost != 0U)
+    {
+        txData[0] = DISPATCHER_EVT_OVERFLOW;
+        txData[1] = gEvtLost;
+        *txSize = 2;
+        gEvtLost = 0;
+    }
+    else
+    {
+        return ST_STREAM_NO_ERROR; /* cyclic is always called, so it is no error if there is no function */
+    }
+    *protocol = ST_COM_EVENT_D2H;
+    return ST_STREAM_NO_ERROR;
+}
+
+/*!
+  Read \a len consecutive virtual registers starting at \a vreg. Space A and B
+  ranges use one auto-increment transfer, test registers are read one by one.
+  */
+static ReturnCode readVirtualRegs(uint8_t vreg, uint8_t *values, uint8_t len)
+{
+    uint8_t i;
+
+    if ((len == 0U) || (vreg >= (VREG_TEST + VREG_ADDR_MASK + 1U)) || (((vreg & VREG_ADDR_MASK) + len) > (VREG_ADDR_MASK + 1U)))
+    {
+        return RFAL_ERR_PARAM;
+    }
+    if ((vreg & VREG_TEST) != 0U)
+    {
+        for (i = 0; i < len; i++)
+        {
+            rfalChipReadTestReg( ((vreg + i) & VREG_ADDR_MASK), &values[i] );
+        }
+        return RFAL_ERR_NONE;
+    }
+    return rfalChipReadReg( vreg, values, len );
+}
+
+/*!
+  Write \a len consecutive virtual registers starting at \a vreg, see readVirtualRegs()
+  */
+static ReturnCode writeVirtualRegs(uint8_t vreg, const uint8_t *values, uint8_t len)
+{
+    uint8_t i;
+
+    if ((len == 0U) || (vreg >= (VREG_TEST + VREG_ADDR_MASK + 1U)) || (((vreg & VREG_ADDR_MASK) + len) > (VREG_ADDR_MASK + 1U)))
+    {
+        return RFAL_ERR_PARAM;
+    }
+    if ((vreg & VREG_TEST) != 0U)
+    {
+        for (i = 0; i < len; i++)
+        {
+            rfalChipWriteTestReg( ((vreg + i) & VREG_ADDR_MASK), values[i] );
+        }
+        return RFAL_ERR_NONE;
+    }
+    return rfalChipWriteReg( vreg, values, len );
+}
+
+/*!
+  Report the registers which changed since the last call as addr/val pairs.
+  Space A is read in two transfers around the interrupt registers, which
+  would be cleared by the read, and space B in one.
+  */
+static ReturnCode processRegSnapshotDiff(const uint8_t *rxData, uint16_t rxSize, uint8_t *txData, uint16_t *txSize)
+{
+    uint8_t  regs[VREG_SNAPSHOT_LEN];
+    uint16_t max = *txSize;
+    uint16_t n = 0;
+    uint8_t  i;
+
+    if ((rxSize >= 1) && (rxData[0] == 1))
+    {
+        RFAL_MEMSET(gRegSnapshotKnown, 0, sizeof(gRegSnapshotKnown));
+    }
+
+    readVirtualRegs( 0x00, regs, ST25R3916_REG_IRQ_MAIN );
+    readVirtualRegs( (ST25R3916_REG_IRQ_TARGET + 1U), &regs[ST25R3916_REG_IRQ_TARGET + 1U], (VREG_ADDR_MASK - ST25R3916_REG_IRQ_TARGET) );
+    readVirtualRegs( ST25R3916_SPACE_B, &regs[ST25R3916_SPACE_B], (VREG_ADDR_MASK + 1U) );
+
+    for (i = 0; i < VREG_SNAPSHOT_LEN; i++)
+    {
+        if ((i >= ST25R3916_REG_IRQ_MAIN) && (i <= ST25R3916_REG_IRQ_TARGET))
+        {
+            continue;
+        }
+        if (((gRegSnapshotKnown[i / 8U] & (1U << (i % 8U))) != 0U) && (gRegSnapshot[i] == regs[i]))
+        {
+            continue;
+        }
+        if ((n + 2U) > max)
+        { /* keep the old value so it is reported next time */
+            break;
+        }
+        txData[n++] = i;
+        txData[n++] = regs[i];
+        gRegSnapshot[i] = regs[i];
+        gRegSnapshotKnown[i / 8U] |= (uint8_t)(1U << (i % 8U));
+    }
+    *txSize = n;
+    return RFAL_ERR_NONE;
 }
 
 uint8_t applReadReg ( uint16_t rxSize, const uint8_t * rxData, uint16_t *txSize, uint8_t * txData)
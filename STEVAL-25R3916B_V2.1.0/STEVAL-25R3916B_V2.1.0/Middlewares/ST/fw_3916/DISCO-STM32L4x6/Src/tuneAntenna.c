@@ -69,9 +69,31 @@
 #include "rfal_chip.h"
 #include "logger.h"
 
-#define CAP_DELAY_MAX           10
+#define CAP_DELAY_MAX           10      /*!< Max time for the caps to settle after a change [ms]          */
+#define CAP_SETTLE_STEP         1       /*!< Interval between two settle-check measurements [ms]          */
+#define CAP_SETTLE_TOL          1       /*!< Max amp/phase change between two readings to be settled      */
+#define CAP_SETTLE_CNT          2       /*!< Consecutive stable readings needed                           */
 #define MAX_MEASURES            6000
 
+#define MEMO_LEN                64U     /*!< Measured points kept per tuning (power of 2)                 */
+#define MEMO_IDX(s, p)          ((((uint32_t)(s) * 31U) + (uint32_t)(p)) & (MEMO_LEN - 1U))
+
+#define CTF_COARSE_POINTS       5       /*!< Grid points per axis on the first coarse-to-fine level       */
+#define CTF_FINE_POINTS         3       /*!< Grid points per axis on the following levels                 */
+
+/*! Already measured (serCap, parCap) point */
+typedef struct{
+    uint8_t serCap;
+    uint8_t parCap;
+    uint8_t amplitude;
+    uint8_t phase;
+    bool    valid;
+}tuneMemo_t;
+
+static tuneMemo_t tuneMemo[MEMO_LEN];
+static uint16_t   curSerCap;            /*!< Value in ANT_TUNE_A, 0xFFFF unknown                          */
+static uint16_t   curParCap;            /*!< Value in ANT_TUNE_B, 0xFFFF unknown                          */
+
 static ReturnCode findOptimunWithSweepLines(tuningParams_t *tuningParams, tuningStatus_t *tuningStatus);
 
 static ReturnCode narrowSector(tuningParams_t *tuningParams, uint32_t *midVal, tuningStatus_t *tuningStatus);
@@ -80,7 +102,11 @@ static ReturnCode findOptimunWith2DimBinSearch(tuningParams_t *tuningParams, tun
 static ReturnCode findOptimunWithHillClimb(tuningParams_t *tuningParams, tuningStatus_t *tuningStatus);
 static ReturnCode getHillClimbDirection(uint32_t *fmin, tuningParams_t *tuningParams, tuningStatus_t *tuningStatus);
 
+static ReturnCode findOptimunWithCoarseToFine(tuningParams_t *tuningParams, tuningStatus_t *tuningStatus);
+static uint8_t predictVertex(uint8_t center, uint8_t step, uint8_t first, uint8_t last, uint32_t fLow, uint32_t fMid, uint32_t fHigh);
+
 static ReturnCode getValues(uint8_t serCap, uint8_t parCap, uint8_t *amplitude, uint8_t *phase, uint16_t *measureCnt);
+static ReturnCode measureSettled(uint8_t *amplitude, uint8_t *phase);
 static bool isFirst(tuningParams_t *tuningParams, uint8_t ampFirst, uint8_t phaFirst, uint8_t ampLast, uint8_t phaLast);
 static uint32_t calcF(tuningParams_t *tuningParams, uint8_t amplitude, uint8_t phase);
 static uint8_t sat_addu8b(uint8_t x, uint8_t y);
@@ -94,6 +120,11 @@ static uint8_t sat_subu8b(uint8_t x, uint8_t y);
 static ReturnCode initialize(tuningParams_t *tuningParams, tuningStatus_t *tuningStatus)
 {
     tuningStatus->measureCnt = 0;
+
+    // measurements of a previous tuning may be stale (field, load)
+    RFAL_MEMSET(tuneMemo, 0, sizeof(tuneMemo));
+    curSerCap = 0xFFFF;
+    curParCap = 0xFFFF;
     return RFAL_ERR_NONE;
 }
 
@@ -117,10 +148,22 @@ ReturnCode tuneAntenna(tuningParams_t *tuningParams, tuningStatus_t *tuningStatu
                 err |= findOptimunWithHillClimb(tuningParams, tuningStatus);
                 break;
 
+            case MODE_ALGO_COARSE_TO_FINE:
+                err |= findOptimunWithCoarseToFine(tuningParams, tuningStatus);
+                break;
+
             default:
                 err = RFAL_ERR_PARAM;
         }
 
+        // memoized points are not re-applied, leave the chip on the tuned point
+        // rather than on the last one actually measured
+        if(err == RFAL_ERR_NONE){
+            st25r3916WriteRegister(ST25R3916_REG_ANT_TUNE_A, tuningStatus->AAT_A_tuned);
+            st25r3916WriteRegister(ST25R3916_REG_ANT_TUNE_B, tuningStatus->AAT_B_tuned);
+            curSerCap = tuningStatus->AAT_A_tuned;
+            curParCap = tuningStatus->AAT_B_tuned;
+        }
     }
     return err;
 }
@@ -157,7 +200,6 @@ static ReturnCode findOptimunWithSweepLines(tuningParams_t *tuningParams, tuning
         getValues(yCap, xCapFirst, &ampFirst, &phaFirst, &tuningStatus->measureCnt);
         getValues(yCap, xCapLast, &ampLast, &phaLast, &tuningStatus->measureCnt);
         TUNE_LOG("%d-%d, %d-%d : ",xCapFirst, yCap, xCapLast,yCap);
-        tuningStatus->measureCnt += 2;
 
         xCapFirst = tuningParams->AAT_B_first;
         xCapLast = tuningParams->AAT_B_last;
@@ -187,7 +229,6 @@ static ReturnCode findOptimunWithSweepLines(tuningParams_t *tuningParams, tuning
                 xAmpWinner = ampFirst;
                 xPhaWinner = phaFirst;
             }
-            tuningStatus->measureCnt++;
         }
 
         // update the winner ?
@@ -358,6 +399,115 @@ static ReturnCode getHillClimbDirection(uint32_t *fmin, tuningParams_t *tuningPa
     return minIdx > 0;
 }
 
+// --------------------------------------------------------------------------
+static ReturnCode findOptimunWithCoarseToFine(tuningParams_t *tuningParams, tuningStatus_t *tuningStatus)
+{
+    // Sample a grid over the current window, refine the best grid point
+    // with a parabola fitted through its neighbours on each axis, then
+    // shrink the window around the winner until the step reaches 1.
+    // Grid points shared between levels come from the memo table.
+    ReturnCode err = RFAL_ERR_NONE;
+    uint8_t  yFirst = tuningParams->AAT_A_first, yLast = tuningParams->AAT_A_last;
+    uint8_t  xFirst = tuningParams->AAT_B_first, xLast = tuningParams->AAT_B_last;
+    uint8_t  points = CTF_COARSE_POINTS;
+    uint8_t  yBest = yFirst, xBest = xFirst;
+    uint8_t  aBest = 0, pBest = 0;
+    uint32_t fBest = 0xFFFFFFFF;
+    uint32_t f[CTF_COARSE_POINTS][CTF_COARSE_POINTS];
+    uint8_t  a, p;
+
+    if ((yFirst > yLast) || (xFirst > xLast)) {
+        return RFAL_ERR_PARAM;
+    }
+
+    for (;;)
+    {
+        uint8_t yStep = (uint8_t)RFAL_MAX(1, ((yLast - yFirst) + points - 2) / (points - 1));
+        uint8_t xStep = (uint8_t)RFAL_MAX(1, ((xLast - xFirst) + points - 2) / (points - 1));
+        uint8_t iBest = 0, jBest = 0;
+        uint32_t fLevel = 0xFFFFFFFF;
+
+        for (uint8_t i = 0; i < points; i++) {
+            uint8_t y = (uint8_t)RFAL_MIN((uint32_t)yFirst + (uint32_t)i * yStep, yLast);
+            for (uint8_t j = 0; j < points; j++) {
+                uint8_t x = (uint8_t)RFAL_MIN((uint32_t)xFirst + (uint32_t)j * xStep, xLast);
+                err |= getValues(y, x, &a, &p, &tuningStatus->measureCnt);
+                f[i][j] = calcF(tuningParams, a, p);
+                if (f[i][j] < fLevel) {
+                    fLevel = f[i][j];
+                    iBest = i;
+                    jBest = j;
+                }
+            }
+        }
+        yBest = (uint8_t)RFAL_MIN((uint32_t)yFirst + (uint32_t)iBest * yStep, yLast);
+        xBest = (uint8_t)RFAL_MIN((uint32_t)xFirst + (uint32_t)jBest * xStep, xLast);
+        fBest = fLevel;
+        TUNE_LOG("grid %d/%d best %d %d: %d\n", yStep, xStep, xBest, yBest, fBest);
+
+        // surrogate: vertex of the parabola through the best point and its grid neighbours
+        if ((yStep > 1U) || (xStep > 1U)) {
+            uint8_t yPred = yBest, xPred = xBest;
+            if ((iBest > 0U) && (iBest < (points - 1U))) {
+                yPred = predictVertex(yBest, yStep, yFirst, yLast, f[iBest - 1U][jBest], fBest, f[iBest + 1U][jBest]);
+            }
+            if ((jBest > 0U) && (jBest < (points - 1U))) {
+                xPred = predictVertex(xBest, xStep, xFirst, xLast, f[iBest][jBest - 1U], fBest, f[iBest][jBest + 1U]);
+            }
+            if ((yPred != yBest) || (xPred != xBest)) {
+                err |= getValues(yPred, xPred, &a, &p, &tuningStatus->measureCnt);
+                if (calcF(tuningParams, a, p) < fBest) {
+                    fBest = calcF(tuningParams, a, p);
+                    yBest = yPred;
+                    xBest = xPred;
+                }
+            }
+        }
+
+        if (((yStep <= 1U) && (xStep <= 1U)) || (fBest == 0U)) {
+            break;
+        }
+        if (tuningStatus->measureCnt > MAX_MEASURES) {
+            err = RFAL_ERR_OVERRUN;
+            break;
+        }
+
+        // next window: half a step around the winner, step halves each level
+        yStep = (yStep + 1U) / 2U;
+        xStep = (xStep + 1U) / 2U;
+        yFirst = (uint8_t)RFAL_MAX((int32_t)tuningParams->AAT_A_first, (int32_t)yBest - (int32_t)yStep);
+        yLast  = (uint8_t)RFAL_MIN((int32_t)tuningParams->AAT_A_last,  (int32_t)yBest + (int32_t)yStep);
+        xFirst = (uint8_t)RFAL_MAX((int32_t)tuningParams->AAT_B_first, (int32_t)xBest - (int32_t)xStep);
+        xLast  = (uint8_t)RFAL_MIN((int32_t)tuningParams->AAT_B_last,  (int32_t)xBest + (int32_t)xStep);
+        points = CTF_FINE_POINTS;
+    }
+
+    // memo hit: no extra measurement
+    getValues(yBest, xBest, &aBest, &pBest, &tuningStatus->measureCnt);
+    tuningStatus->AAT_A_tuned = yBest;
+    tuningStatus->AAT_B_tuned = xBest;
+    tuningStatus->ampTuned = aBest;
+    tuningStatus->phaTuned = pBest;
+
+    return err;
+}
+
+// --------------------------------------------------------------------------
+static uint8_t predictVertex(uint8_t center, uint8_t step, uint8_t first, uint8_t last, uint32_t fLow, uint32_t fMid, uint32_t fHigh)
+{
+    // vertex offset of the parabola through (-step,fLow) (0,fMid) (+step,fHigh)
+    int32_t curv = (int32_t)fLow - (2 * (int32_t)fMid) + (int32_t)fHigh;
+    int32_t pos;
+
+    if (curv <= 0) {
+        return center;          // not convex, keep the sampled point
+    }
+    pos = (int32_t)center + ((((int32_t)fLow - (int32_t)fHigh) * (int32_t)step) / (2 * curv));
+    pos = RFAL_MAX(pos, (int32_t)first);
+    pos = RFAL_MIN(pos, (int32_t)last);
+    return (uint8_t)pos;
+}
+
 // --------------------------------------------------------------------------
 static uint32_t calcF(tuningParams_t *tuningParams, uint8_t amplitude, uint8_t phase)
 {
@@ -387,24 +537,74 @@ static bool isFirst(tuningParams_t *tuningParams, uint8_t ampFirst, uint8_t phaF
 // --------------------------------------------------------------------------
 static ReturnCode getValues(uint8_t serCap, uint8_t parCap, uint8_t *amplitude, uint8_t *phase, uint16_t *measureCnt)
 {
-    // set AAT_A (serial) and AAT_B (parallel)
-    ReturnCode err = RFAL_ERR_IO;
+    ReturnCode err;
+    tuneMemo_t *memo = &tuneMemo[MEMO_IDX(serCap, parCap)];
+
+    // the algorithms revisit points, reuse what was already measured
+    if (memo->valid && (memo->serCap == serCap) && (memo->parCap == parCap)) {
+        *amplitude = memo->amplitude;
+        *phase = memo->phase;
+        return RFAL_ERR_NONE;
+    }
 
-    st25r3916WriteRegister(ST25R3916_REG_ANT_TUNE_A, serCap);
-    st25r3916WriteRegister(ST25R3916_REG_ANT_TUNE_B, parCap);
+    // set AAT_A (serial) and AAT_B (parallel), skip the unchanged one
+    if (curSerCap != serCap) {
+        st25r3916WriteRegister(ST25R3916_REG_ANT_TUNE_A, serCap);
+        curSerCap = serCap;
+    }
+    if (curParCap != parCap) {
+        st25r3916WriteRegister(ST25R3916_REG_ANT_TUNE_B, parCap);
+        curParCap = parCap;
+    }
+
+    // get amplitude and phase once the caps have settled..
+    err = measureSettled(amplitude, phase);
+
+    if (err == RFAL_ERR_NONE) {
+        memo->serCap = serCap;
+        memo->parCap = parCap;
+        memo->amplitude = *amplitude;
+        memo->phase = *phase;
+        memo->valid = true;
+    }
 
-    // wait till caps have settled..
-    platformDelay(CAP_DELAY_MAX);
-    
-    // get amplitude and phase ..
-    err = rfalChipMeasureAmplitude(amplitude);
-    err |= rfalChipMeasurePhase(phase);
-        
     //
     (*measureCnt)++;
     return err;
 }
 
+// --------------------------------------------------------------------------
+static ReturnCode measureSettled(uint8_t *amplitude, uint8_t *phase)
+{
+    // Instead of always waiting CAP_DELAY_MAX, measure every CAP_SETTLE_STEP
+    // until CAP_SETTLE_CNT consecutive readings agree, bounded by CAP_DELAY_MAX
+    ReturnCode err;
+    uint8_t    a, p;
+    uint32_t   waited = 0;
+    uint8_t    stableCnt = 0;
+
+    err = rfalChipMeasureAmplitude(amplitude);
+    err |= rfalChipMeasurePhase(phase);
+
+    while ((err == RFAL_ERR_NONE) && (waited < CAP_DELAY_MAX)) {
+        platformDelay(CAP_SETTLE_STEP);
+        waited += CAP_SETTLE_STEP;
+
+        err = rfalChipMeasureAmplitude(&a);
+        err |= rfalChipMeasurePhase(&p);
+
+        bool stable = ((((a > *amplitude) ? (a - *amplitude) : (*amplitude - a)) <= CAP_SETTLE_TOL) &&
+                       (((p > *phase) ? (p - *phase) : (*phase - p)) <= CAP_SETTLE_TOL));
+        *amplitude = a;
+        *phase = p;
+        stableCnt = stable ? (stableCnt + 1U) : 0U;
+        if (stableCnt >= CAP_SETTLE_CNT) {
+            break;
+        }
+    }
+    return err;
+}
+
 static uint8_t sat_addu8b(uint8_t x, uint8_t y){
 	uint8_t res = x + y;
 	res |= -(res < x);
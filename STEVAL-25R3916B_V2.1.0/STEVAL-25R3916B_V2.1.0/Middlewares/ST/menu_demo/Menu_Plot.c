@@ -1,6 +1,7 @@
 #include "Menu_plot.h"
 #include "math.h"
 #include "stdio.h"
+#include "stdlib.h"
 
 
 
@@ -20,20 +21,65 @@ static Menu_Plot_Point_t getPointPosition(Menu_Plot_Geo_t *geo, Menu_Plot_Point_
   return p_pix;
 }
 
-void Menu_DisplaySegment(Menu_Plot_Point_t a, Menu_Plot_Point_t b)
+// Fill the union of the size x size brushes laid from (x0,y0) to (x1,y1), either on a row or on a column
+static void Menu_FillRun(int x0, int y0, int x1, int y1, uint32_t size)
 {
-  float adj = a.y - b.y;
-//  float opp = b.y - a.y;
-  float opp = b.x - a.x;
-  float hyp = sqrt(adj*adj + opp*opp);
-  float cos = opp / hyp;
-  float sin = adj / hyp;
+  int x = (x0 < x1) ? x0 : x1;
+  int y = (y0 < y1) ? y0 : y1;
+  Menu_FillRectangle(x, y, abs(x1 - x0) + size, abs(y1 - y0) + size);
+}
 
-  for(int i = 0 ; i < hyp ; i +=1)
+// Integer Bresenham: consecutive pixels on the same row (x-major) or column (y-major)
+// are merged in a single fill instead of one brush fill per unit step
+void Menu_DisplaySegmentWidth(Menu_Plot_Point_t a, Menu_Plot_Point_t b, uint32_t size)
+{
+  int dx = abs(b.x - a.x);
+  int dy = abs(b.y - a.y);
+  int sx = (a.x < b.x) ? 1 : -1;
+  int sy = (a.y < b.y) ? 1 : -1;
+  int err;
+  int runX = a.x;
+  int runY = a.y;
+
+  if(dx >= dy)
   {
-      Menu_FillRectangle(a.x + i * cos,a.y - i * sin,2,2);
+    err = dx / 2;
+    for(int i = 0 ; i < dx ; i++)
+    {
+      err -= dy;
+      if(err < 0)
+      {
+        Menu_FillRun(runX, a.y, a.x, a.y, size);
+        a.y += sy;
+        err += dx;
+        runX = a.x + sx;
+      }
+      a.x += sx;
+    }
+    Menu_FillRun(runX, a.y, a.x, a.y, size);
   }
+  else
+  {
+    err = dy / 2;
+    for(int i = 0 ; i < dy ; i++)
+    {
+      err -= dx;
+      if(err < 0)
+      {
+        Menu_FillRun(a.x, runY, a.x, a.y, size);
+        a.x += sx;
+        err += dy;
+        runY = a.y + sy;
+      }
+      a.y += sy;
+    }
+    Menu_FillRun(a.x, runY, a.x, a.y, size);
+  }
+}
 
+void Menu_DisplaySegment(Menu_Plot_Point_t a, Menu_Plot_Point_t b)
+{
+  Menu_DisplaySegmentWidth(a, b, 2);
 }
 
 static Menu_Plot_Point_t Menu_AddPoints (Menu_Plot_Point_t* a, Menu_Plot_Point_t* b)
@@ -58,7 +104,7 @@ void Menu_DisplaySinglePoint(Menu_Plot_Point_t* p)
   Menu_DisplaySegment(Menu_AddPoints(p,&seg2), Menu_SubPoints(p,&seg2));
 }
 
-void Menu_DisplayPoints(Menu_Plot_Geo_t *geo, Menu_Plot_t *plots)
+static void Menu_DisplayPointsFrom(Menu_Plot_Geo_t *geo, Menu_Plot_t *plots, uint32_t first)
 {
   Menu_Plot_Point_t p_pos, last_p_pos;
 //  const char txt[] = "X";
@@ -66,17 +112,28 @@ void Menu_DisplayPoints(Menu_Plot_Geo_t *geo, Menu_Plot_t *plots)
   //uint32_t Yrange = geo->maxVal - geo->minVal;
   //Menu_SetStyle(PLOT_AXES);
 
-  for(int pid = 0; pid < plots->length; pid++)
+  // start from the previous point so that the segment joining the new points is drawn
+  uint32_t pid = (first > 0) ? first - 1 : 0;
+  last_p_pos = getPointPosition(geo, &plots->points[pid]);
+  for(; pid < plots->length; pid++)
   {
     p_pos = getPointPosition(geo, &plots->points[pid]);
     //Menu_DisplayStringAt(x,y,txt);
-    Menu_DisplaySinglePoint(&p_pos);
-    if(pid > 0)
-      Menu_DisplaySegment(last_p_pos, p_pos);
+    if(pid >= first)
+    {
+      Menu_DisplaySinglePoint(&p_pos);
+      if(pid > 0)
+        Menu_DisplaySegment(last_p_pos, p_pos);
+    }
     last_p_pos = p_pos;
   }
 }
 
+void Menu_DisplayPoints(Menu_Plot_Geo_t *geo, Menu_Plot_t *plots)
+{
+  Menu_DisplayPointsFrom(geo, plots, 0);
+}
+
 
 void Menu_DisplayGrid(Menu_Plot_Geo_t *geo)
 {
@@ -89,10 +146,11 @@ void Menu_DisplayGrid(Menu_Plot_Geo_t *geo)
   uint32_t gridSpace = division / geo->yFactor ;
   uint32_t firstY = geo->y + geo->height + ((int)geo->minVal - first_value) / geo->yFactor ;
 
-  if(division > 0)
+  if((division > 0) && (gridSpace > 0))
   {
     Menu_SetStyle(PLOT_GRID);
-    for(uint32_t y = firstY ; y > (geo->y); y = y - gridSpace)
+    // stop at the top of the graph without wrapping around 0
+    for(uint32_t y = firstY ; y > (geo->y); y = (y > gridSpace) ? (y - gridSpace) : 0)
     {
       char txt[20];
       if(value != 0)
@@ -215,6 +273,25 @@ Menu_Plot_Geo_t Menu_DisplayCenterPlot(uint32_t width, uint32_t height, Menu_Plo
   return geo;
 }
 
+uint8_t Menu_UpdatePlot(Menu_Plot_Geo_t *geo, Menu_Plot_t *plot, uint32_t first)
+{
+  // new points must fit in the current scale, otherwise the whole plot is to be redrawn
+  for(uint32_t i = first; i < plot->length; i++)
+  {
+    if((plot->points[i].x < geo->minX) || (plot->points[i].x > geo->maxX) ||
+       (plot->points[i].y < geo->minVal) || (plot->points[i].y > geo->maxVal))
+    {
+      return 0;
+    }
+  }
+  if(first < plot->length)
+  {
+    Menu_SetStyle(plot->style);
+    Menu_DisplayPointsFrom(geo, plot, first);
+  }
+  return 1;
+}
+
 uint8_t Menu_PlotInput(Menu_Plot_Geo_t *geo, Menu_Position_t *touch, Menu_Plot_Point_t *value)
 {
   uint8_t valid = 0;
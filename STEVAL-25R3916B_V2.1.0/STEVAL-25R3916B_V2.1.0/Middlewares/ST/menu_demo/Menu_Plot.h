@@ -22,6 +22,11 @@ typedef struct {
 
 Menu_Plot_Geo_t Menu_DisplayCenterPlot(uint32_t width, uint32_t height, Menu_Plot_t *plots, uint32_t nbPlots, uint32_t minRange);
 void Menu_DisplaySegment(Menu_Plot_Point_t a, Menu_Plot_Point_t b);
+void Menu_DisplaySegmentWidth(Menu_Plot_Point_t a, Menu_Plot_Point_t b, uint32_t size);
+// draw only plot->points[first..length-1], returns 0 if they don't fit in geo and the plot has to be redrawn
+// no screen of the ST25R3916 demo plots a live curve yet: it is meant to be called after appending points
+// to a plot displayed with Menu_DisplayCenterPlot, instead of redrawing it
+uint8_t Menu_UpdatePlot(Menu_Plot_Geo_t *geo, Menu_Plot_t *plot, uint32_t first);
 uint8_t Menu_PlotInput(Menu_Plot_Geo_t *geo, Menu_Position_t *touch, Menu_Plot_Point_t *value);
 
 #endif // _MENU_PLOT_H_
@@ -1,32 +1,48 @@
 #include "Menu_Plot.h"
 #include "Menu_Tickbox.h"
 
-void Menu_DisplayTickbox(Menu_Tickbox_t *t)
+static void Menu_DrawTickbox(Menu_Widget_t *widget, const Menu_Rect_t *clip);
+
+// Tick end points, the tick goes past the right side of the box
+static void Menu_GetTick(Menu_Tickbox_t *t, Menu_Plot_Point_t *a, Menu_Plot_Point_t *b, Menu_Plot_Point_t *b2, Menu_Plot_Point_t *c)
 {
-  Menu_Plot_Point_t a,b,b2,c;
   uint32_t tick_incr = t->size /4;
-  a.x = t->x + tick_incr;
-  a.y = t->y + tick_incr;
-  b.x = t->x + 2*tick_incr + 1;
-  b.y = t->y + 3*tick_incr - 1;
-  b2.x = b.x ;
-  b2.y = b.y + 1;
-  c.x = t->x + 5*tick_incr;
-  c.y = t->y;
+  a->x = t->x + tick_incr;
+  a->y = t->y + tick_incr;
+  b->x = t->x + 2*tick_incr + 1;
+  b->y = t->y + 3*tick_incr - 1;
+  b2->x = b->x ;
+  b2->y = b->y + 1;
+  c->x = t->x + 5*tick_incr;
+  c->y = t->y;
+}
+
+static void Menu_DisplayTick(Menu_Tickbox_t *t, ColorStyles_t style)
+{
+  Menu_Plot_Point_t a,b,b2,c;
+  Menu_GetTick(t, &a, &b, &b2, &c);
+  Menu_SetStyle(style);
+  Menu_DisplaySegment(a,b);
+  Menu_DisplaySegment(b2,c);
+}
+
+void Menu_DisplayTickbox(Menu_Tickbox_t *t)
+{
+  // top, bottom, left & right sides of the box
+  Menu_Rect_t border[4] = {{t->x, t->y, t->size, 3},
+                           {t->x, t->y + t->size, t->size, 3},
+                           {t->x, t->y, 3, t->size + 1},
+                           {t->x + t->size, t->y, 3, t->size + 3}};
 
   if(!t->state)
   {
-    Menu_SetStyle(CLEAR_PLAIN);
-    Menu_DisplaySegment(a,b);
-    Menu_DisplaySegment(b2,c);
+    Menu_DisplayTick(t, CLEAR_PLAIN);
   }
 
   Menu_SetStyle(PLAIN);
 
-  Menu_FillRectangle(t->x,t->y,t->size,2);
-  Menu_FillRectangle(t->x,t->y+t->size,t->size,2);
-  Menu_FillRectangle(t->x,t->y,3,t->size);
-  Menu_FillRectangle(t->x+t->size,t->y,3,t->size+2);
+  for(int i = 0; i < 4; i++)
+    Menu_FillRect(&border[i]);
 /*
   Menu_DisplayStringAt(t->x + t->size + Menu_GetFontWidth(),
                        t->y + ((int)t->size - Menu_GetFontHeight())/2,
@@ -34,20 +50,63 @@ void Menu_DisplayTickbox(Menu_Tickbox_t *t)
 */
   if(t->state)
   {
-    Menu_SetStyle(TICKBOX_CHECK);
-    Menu_DisplaySegment(a,b);
-    Menu_DisplaySegment(b2,c);
+    Menu_DisplayTick(t, TICKBOX_CHECK);
+  }
+  t->painted = t->state;
+  t->widget.Dirty = MENU_WIDGET_CLEAN;
+}
+
+// Widget paint function: a toggle only draws or clears the tick, and restores the box sides the tick crossed
+static void Menu_DrawTickbox(Menu_Widget_t *widget, const Menu_Rect_t *clip)
+{
+  Menu_Tickbox_t *t = (Menu_Tickbox_t *)widget;
+  Menu_Plot_Point_t a,b,b2,c;
+  Menu_Rect_t tick, part;
+
+  if(clip != NULL)
+  {
+    Menu_DisplayTickbox(t);
+    return;
+  }
+  if(t->state == t->painted)
+  {
+    return;
+  }
+
+  if(t->state)
+  {
+    Menu_DisplayTick(t, TICKBOX_CHECK);
+  } else {
+    Menu_Rect_t border[4] = {{t->x, t->y, t->size, 3},
+                             {t->x, t->y + t->size, t->size, 3},
+                             {t->x, t->y, 3, t->size + 1},
+                             {t->x + t->size, t->y, 3, t->size + 3}};
+    Menu_DisplayTick(t, CLEAR_PLAIN);
+    // segments are drawn with a 2x3 pixels brush
+    Menu_GetTick(t, &a, &b, &b2, &c);
+    tick.X = a.x;
+    tick.Y = c.y;
+    tick.Width = c.x + 2 - a.x;
+    tick.Height = b2.y + 3 - c.y;
+    Menu_SetStyle(PLAIN);
+    for(int i = 0; i < 4; i++)
+    {
+      if(Menu_RectIntersect(&border[i], &tick, &part))
+        Menu_FillRect(&part);
+    }
   }
+  t->painted = t->state;
 }
 
 void Menu_TickboxInput(Menu_Tickbox_t* t, Menu_Position_t* touch)
 {
-  uint32_t tick_incr = t->size /4;  
+  uint32_t tick_incr = t->size /4;
   if((touch->X > (t->x - tick_incr)) && (touch->X < (t->x + t->size + tick_incr)) &&
     (touch->Y > (t->y - tick_incr)) && (touch->Y < (t->y + t->size + tick_incr)))
   {
      t->state = !t->state;
-     Menu_DisplayTickbox(t);
+     Menu_WidgetInvalidate(&t->widget, MENU_WIDGET_DIRTY_STATE);
+     Menu_WidgetUpdate(&t->widget);
   }
 }
 
@@ -64,14 +123,17 @@ void Menu_RefreshTickbox(Menu_Tickbox_t* t)
 Menu_Tickbox_t Menu_InitTickbox(uint32_t x, uint32_t y, uint32_t size, uint8_t state, char *str)
 {
   Menu_Tickbox_t t;
+  uint32_t width = 5*(size/4) + 2;
   t.x = x;
   t.y = y;
   t.size = size;
   t.state = state;
+  t.painted = state;
   t.str = str;
+  // returned by value: the tickbox is repainted on its own, it is not added to the screen widgets
+  Menu_WidgetInit(&t.widget, x, y, (width > (size + 3)) ? width : (size + 3), size + 3, 0, &Menu_DrawTickbox);
 
   Menu_RefreshTickbox(&t);
 
   return t;
 }
-
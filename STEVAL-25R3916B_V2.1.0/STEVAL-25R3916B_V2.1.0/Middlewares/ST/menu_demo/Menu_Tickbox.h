@@ -1,12 +1,15 @@
 #ifndef _MENU_TICKBOX_H_
 #define _MENU_TICKBOX_H_
 #include "Menu_config.h"
+#include "Menu_widget.h"
 
 typedef struct {
+Menu_Widget_t widget;   /* first member: the widget paint function gets the tickbox from it */
 uint32_t x;
 uint32_t y;
 uint32_t size;
 uint8_t state;
+uint8_t painted;        /* state currently displayed */
 char *str;
 } Menu_Tickbox_t;
 
@@ -31,6 +31,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "Menu_core.h"
 #include "Menu_config.h"
+#include "Menu_widget.h"
 #include "string.h"
 #include "stdio.h"
 #include "math.h"
@@ -340,6 +341,7 @@ void Menu_MsgStatus(const char* Title, const char* Msg, Msg_type_t MsgType)
   const char * MsgPtr = Msg;
 
   do {  
+    Menu_WidgetReset();
     Menu_DisplayClear();
     /* Display header */
     if((MsgType == MSG_STATUS_ERROR) || (MsgType == MSG_INFO_ERROR))
@@ -927,6 +929,7 @@ void Menu_DisplayIconsMenu(void)
   uint32_t maxNbLine = Menu_GetDisplayHeight() / Menu_GetFontHeight();
 
   /* Clear*/
+  Menu_WidgetReset();
   Menu_DisplayClear();
   Menu_SetStyle(HEADER);
 
@@ -952,6 +955,7 @@ static void Menu_DisplayListMenu(void)
   uint32_t Line = 0, index = 0;
   
   /* Clear the LCD Screen */
+  Menu_WidgetReset();
   Menu_DisplayClear();
 
   Menu_SetStyle(HEADER);
@@ -1073,7 +1077,11 @@ void Menu_MainLoop(tMenu main)
         }
         // don't run menu function when notified by callback 
         if((execFunc != NULL) && (NxtLast != MENU_CALLBACK_LAST))
+        {
+          // the function builds its own screen
+          Menu_WidgetReset();
           execFunc();
+        }
       
         if(NxtLast == MENU_CALLBACK_LAST)
         {
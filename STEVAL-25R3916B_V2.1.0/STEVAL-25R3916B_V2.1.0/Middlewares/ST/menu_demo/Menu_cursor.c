@@ -1,9 +1,10 @@
 #include "Menu_config.h"
 #include "Menu_cursor.h"
 
-static void Menu_DisplayBar(Menu_Bar_t *bar);
+static void Menu_DrawBar(Menu_Widget_t *widget, const Menu_Rect_t *clip);
+static void Menu_DrawCursor(Menu_Widget_t *widget, const Menu_Rect_t *clip);
 static uint32_t Menu_CursorGetPosition(Menu_Cursor_t *cursor);
-static void Menu_ClearCursor(Menu_Cursor_t *cursor);
+static void Menu_UpdateCursor(Menu_Cursor_t *cursor);
 
 
 /** @brief Initialize a Menu_Bar_t structure with provided inputs and draw it on the display
@@ -41,7 +42,15 @@ Menu_Status_t Menu_BarInit(uint32_t x, uint32_t y, uint32_t length, Menu_Bar_Dir
     }
   }
 
-  Menu_DisplayBar(bar);
+  // the bar is a 1 pixel wide line
+  if(bar->Direction == MENU_BAR_VERTICAL)
+  {
+    Menu_WidgetInit(&bar->Widget, bar->X, bar->Y, 1, bar->Length, MENU_WIDGET_OPAQUE, &Menu_DrawBar);
+  } else {
+    Menu_WidgetInit(&bar->Widget, bar->X, bar->Y, bar->Length, 1, MENU_WIDGET_OPAQUE, &Menu_DrawBar);
+  }
+  Menu_WidgetAdd(&bar->Widget);
+  Menu_WidgetRefresh();
   return MENU_OK;
 }
 
@@ -111,7 +120,11 @@ Menu_Status_t Menu_CursorInit(Menu_Bar_t *bar, uint32_t minValue, uint32_t maxVa
     cursor->maxY = (cursor->maxY > displayHeight) ? displayHeight : cursor->maxY;
   }
 
-  Menu_DisplayPicture(cursor->X, cursor->Y, cursor->Picture);
+  // the cursor is painted above its bar
+  cursor->Painted = NULL;
+  Menu_WidgetInit(&cursor->Widget, cursor->X, cursor->Y, cursor->Width, cursor->Height, MENU_WIDGET_OPAQUE, &Menu_DrawCursor);
+  Menu_WidgetAdd(&cursor->Widget);
+  Menu_WidgetRefresh();
 
   return MENU_OK;
 }
@@ -131,7 +144,6 @@ Menu_Status_t Menu_CursorSetValue(Menu_Cursor_t *cursor, uint32_t value)
     return MENU_ERROR;
   }
 
-  Menu_ClearCursor(cursor);
   cursor->Value = value;
   if(cursor->Bar->Direction == MENU_BAR_VERTICAL)
   {
@@ -139,7 +151,7 @@ Menu_Status_t Menu_CursorSetValue(Menu_Cursor_t *cursor, uint32_t value)
   } else {
     cursor->X = Menu_CursorGetPosition(cursor);
   }
-  Menu_DisplayPicture(cursor->X, cursor->Y, cursor->Picture);
+  Menu_UpdateCursor(cursor);
   cursor->Callback(cursor);
 
   return MENU_OK;
@@ -158,9 +170,7 @@ uint8_t Menu_CursorInput(Menu_Cursor_t *cursor, Menu_Position_t *touch)
     if((touch->X > cursor->minX) && (touch->X < cursor->maxX) &&
         (touch->Y > cursor->minY) && (touch->Y < cursor->maxY))
     {
-      // the user touched the cursor area: update the cursor accordingly
-      Menu_ClearCursor(cursor);
-      // update position & value
+      // the user touched the cursor area: update position & value
       if(cursor->Bar->Direction == MENU_BAR_VERTICAL)
       {
         if(touch->Y < cursor->Bar->Y)
@@ -179,7 +189,7 @@ uint8_t Menu_CursorInput(Menu_Cursor_t *cursor, Menu_Position_t *touch)
 
       }
       // display new position
-      Menu_DisplayPicture(cursor->X, cursor->Y, cursor->Picture);
+      Menu_UpdateCursor(cursor);
       cursor->Callback(cursor);
 
       // touch detected
@@ -200,7 +210,6 @@ uint8_t Menu_CursorJoyInput(Menu_Cursor_t *cursor, Menu_Direction_t *JoyState)
 {
   if(((JoyState->Dir == MENU_DOWN) || (JoyState->Dir == MENU_UP)) && (cursor->Bar->Direction == MENU_BAR_VERTICAL))
   {
-    Menu_ClearCursor(cursor);
     if(JoyState->Dir == MENU_UP)
     {
       if((cursor->Y > cursor->minY) && (cursor->Value > cursor->Min))
@@ -217,13 +226,12 @@ uint8_t Menu_CursorJoyInput(Menu_Cursor_t *cursor, Menu_Direction_t *JoyState)
       }
     }
     cursor->Value = ((cursor->Max - cursor->Min) *(cursor->Y - cursor->Bar->Y)) / cursor->Bar->Length;
-    Menu_DisplayPicture(cursor->X, cursor->Y, cursor->Picture);
+    Menu_UpdateCursor(cursor);
     cursor->Callback(cursor);
     return 1;
   }
   else if(((JoyState->Dir == MENU_LEFT) || (JoyState->Dir == MENU_RIGHT)) && (cursor->Bar->Direction == MENU_BAR_HORIZONTAL))
   {
-    Menu_ClearCursor(cursor);
     if(JoyState->Dir == MENU_LEFT)
     {
       if((cursor->X > cursor->minX) && (cursor->Value > cursor->Min))
@@ -240,7 +248,7 @@ uint8_t Menu_CursorJoyInput(Menu_Cursor_t *cursor, Menu_Direction_t *JoyState)
       }
     }
     cursor->Value = ((cursor->Max - cursor->Min) *(cursor->X - cursor->Bar->X)) / cursor->Bar->Length;
-    Menu_DisplayPicture(cursor->X, cursor->Y, cursor->Picture);
+    Menu_UpdateCursor(cursor);
     cursor->Callback(cursor);
     return 1;
   }
@@ -249,11 +257,27 @@ uint8_t Menu_CursorJoyInput(Menu_Cursor_t *cursor, Menu_Direction_t *JoyState)
 }
 
 
-static void Menu_ClearCursor(Menu_Cursor_t *cursor)
+/* Repaint the cursor where it changed: the area it left is cleared and the bar restored
+   below it, the picture is displayed again only if it moved or was replaced */
+static void Menu_UpdateCursor(Menu_Cursor_t *cursor)
+{
+  Menu_WidgetMove(&cursor->Widget, cursor->X, cursor->Y);
+  if(cursor->Picture != cursor->Painted)
+  {
+    Menu_WidgetInvalidate(&cursor->Widget, MENU_WIDGET_DIRTY_STATE);
+  }
+  Menu_WidgetRefresh();
+  // the callback runs with the bar style selected, whether the bar was repainted or not
+  Menu_SetStyle(cursor->Bar->Style);
+}
+
+static void Menu_DrawCursor(Menu_Widget_t *widget, const Menu_Rect_t *clip)
 {
-  Menu_SetStyle(CLEAR_PLAIN);
-  Menu_FillRectangle(cursor->X,cursor->Y,cursor->Width,cursor->Height);
-  Menu_DisplayBar(cursor->Bar);
+  Menu_Cursor_t *cursor = (Menu_Cursor_t *)widget;
+  // a picture can't be partially displayed: the clip is ignored
+  (void)clip;
+  Menu_DisplayPicture(cursor->X, cursor->Y, cursor->Picture);
+  cursor->Painted = cursor->Picture;
 }
 
 static uint32_t Menu_CursorGetPosition(Menu_Cursor_t *cursor)
@@ -266,13 +290,15 @@ static uint32_t Menu_CursorGetPosition(Menu_Cursor_t *cursor)
   }
 }
 
-static void Menu_DisplayBar(Menu_Bar_t *bar)
+static void Menu_DrawBar(Menu_Widget_t *widget, const Menu_Rect_t *clip)
 {
-  Menu_SetStyle(bar->Style);
-  if (bar->Direction == MENU_BAR_VERTICAL)
+  Menu_Bar_t *bar = (Menu_Bar_t *)widget;
+  Menu_Rect_t segment;
+
+  if((clip == NULL) || !Menu_RectIntersect(&bar->Widget.Area, clip, &segment))
   {
-    Menu_DisplayRectangle(bar->X,bar->Y,0,bar->Length);
-  } else {
-    Menu_DisplayRectangle(bar->X,bar->Y,bar->Length,0);
+    segment = bar->Widget.Area;
   }
+  Menu_SetStyle(bar->Style);
+  Menu_FillRect(&segment);
 }
@@ -5,12 +5,15 @@
   #error Please include this file after including Menu_config.h
 #endif
 
+#include "Menu_widget.h"
+
 typedef enum {
   MENU_BAR_VERTICAL = 0,
   MENU_BAR_HORIZONTAL
 } Menu_Bar_Direction_t;
 
 typedef struct {
+  Menu_Widget_t Widget;           /* first member: the widget paint function gets the bar from it */
   ColorStyles_t Style;
   uint32_t X;
   uint32_t Y;
@@ -22,11 +25,13 @@ struct Menu_Cursor_t;
 typedef void (*Menu_CursorCallback_t)(struct Menu_Cursor_t*) ;
 
 typedef struct Menu_Cursor_t {
+  Menu_Widget_t Widget;           /* first member: the widget paint function gets the cursor from it */
   Menu_Bar_t *Bar;
   uint32_t Value;
   uint32_t Max;
   uint32_t Min;
   const char *Picture;
+  const char *Painted;            /* picture currently displayed */
   uint32_t Width;
   uint32_t Height;
   uint32_t X;
@@ -1,4 +1,5 @@
 #include "Menu_tab.h"
+#include "Menu_widget.h"
 #include "string.h"
 
 void Menu_DisplayTabName(Menu_Tab_t* tab, uint32_t tabId)
@@ -40,7 +41,8 @@ void Menu_TabLoop(Menu_Tab_Setup_t* setup, uint32_t nbTab)
   Menu_SetStyle(GREY);
   for (int i = 1; i < tab.nbTab ; i ++)
     Menu_DisplayTabName(&tab,i);
-  // run first callback for first tab
+  // run first callback for first tab, each tab content starts without widgets
+  Menu_WidgetReset();
   if(setup[tab.current].firstCb != NULL)
     status = setup[tab.current].firstCb();
 
@@ -72,6 +74,7 @@ void Menu_TabLoop(Menu_Tab_Setup_t* setup, uint32_t nbTab)
             Menu_SetStyle(PLAIN);
             Menu_DisplayTabName(&tab,nxtTab);
             tab.current = nxtTab;
+            Menu_WidgetReset();
             if(setup[tab.current].firstCb != NULL)
               status = setup[tab.current].firstCb();
           }
@@ -95,6 +98,7 @@ void Menu_TabLoop(Menu_Tab_Setup_t* setup, uint32_t nbTab)
           Menu_SetStyle(PLAIN);
           Menu_DisplayTabName(&tab,(tab.current + 1));
           tab.current = (tab.current + 1);
+          Menu_WidgetReset();
           if(setup[tab.current].firstCb != NULL)
             status = setup[tab.current].firstCb();
         }
@@ -112,6 +116,7 @@ void Menu_TabLoop(Menu_Tab_Setup_t* setup, uint32_t nbTab)
           Menu_SetStyle(PLAIN);
           Menu_DisplayTabName(&tab,(tab.current - 1));
           tab.current = (tab.current - 1);
+          Menu_WidgetReset();
           if(setup[tab.current].firstCb != NULL)
             status = setup[tab.current].firstCb();
         }
@@ -0,0 +1,375 @@
+/**
+  ******************************************************************************
+  * @file    Menu_widget.c
+  * @author  MMY Application Team
+  * @brief   Retained widgets and dirty rectangles for the menu framework.
+  *          Widgets of a screen are kept in a back to front list. A change
+  *          marks the widget dirty, and a moved or removed widget damages the
+  *          area it leaves. Menu_WidgetRefresh() then clears only the damaged
+  *          rectangles not covered by an opaque widget, and repaints only the
+  *          widgets touching a damaged rectangle or marked dirty.
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include "Menu_widget.h"
+
+/* Maximum number of pieces a damaged rectangle is split into around opaque widgets */
+#define MENU_WIDGET_MAX_PIECES  8
+
+/* Widgets of the current screen, back to front */
+static Menu_Widget_t *WidgetList = NULL;
+/* Damaged rectangles, cleared and repainted on next refresh */
+static Menu_Rect_t WidgetDamage[MENU_WIDGET_MAX_DAMAGE];
+static uint32_t WidgetNbDamage = 0;
+
+static uint32_t Menu_RectArea(const Menu_Rect_t *rect)
+{
+  return rect->Width * rect->Height;
+}
+
+/** @brief Compute the intersection of two rectangles
+  * @param a First rectangle
+  * @param b Second rectangle
+  * @param res Intersection, may be NULL when only the test is needed
+  * @retval 0 The rectangles don't intersect
+  * @retval 1 The rectangles intersect
+  */
+uint8_t Menu_RectIntersect(const Menu_Rect_t *a, const Menu_Rect_t *b, Menu_Rect_t *res)
+{
+  uint32_t x0 = (a->X > b->X) ? a->X : b->X;
+  uint32_t y0 = (a->Y > b->Y) ? a->Y : b->Y;
+  uint32_t x1 = ((a->X + a->Width) < (b->X + b->Width)) ? (a->X + a->Width) : (b->X + b->Width);
+  uint32_t y1 = ((a->Y + a->Height) < (b->Y + b->Height)) ? (a->Y + a->Height) : (b->Y + b->Height);
+
+  if((x0 >= x1) || (y0 >= y1))
+  {
+    return 0;
+  }
+  if(res != NULL)
+  {
+    res->X = x0;
+    res->Y = y0;
+    res->Width = x1 - x0;
+    res->Height = y1 - y0;
+  }
+  return 1;
+}
+
+/** @brief Compute the bounding box of two rectangles, an empty rectangle is ignored
+  * @param a First rectangle
+  * @param b Second rectangle
+  * @param res Bounding box, may be one of the inputs
+  */
+void Menu_RectUnion(const Menu_Rect_t *a, const Menu_Rect_t *b, Menu_Rect_t *res)
+{
+  uint32_t x0, y0, x1, y1;
+
+  if(Menu_RectArea(a) == 0)
+  {
+    *res = *b;
+    return;
+  }
+  if(Menu_RectArea(b) == 0)
+  {
+    *res = *a;
+    return;
+  }
+  x0 = (a->X < b->X) ? a->X : b->X;
+  y0 = (a->Y < b->Y) ? a->Y : b->Y;
+  x1 = ((a->X + a->Width) > (b->X + b->Width)) ? (a->X + a->Width) : (b->X + b->Width);
+  y1 = ((a->Y + a->Height) > (b->Y + b->Height)) ? (a->Y + a->Height) : (b->Y + b->Height);
+  res->X = x0;
+  res->Y = y0;
+  res->Width = x1 - x0;
+  res->Height = y1 - y0;
+}
+
+/** @brief Fill a rectangle with the current style
+  * @param rect Rectangle to fill, exactly Width x Height pixels
+  */
+void Menu_FillRect(const Menu_Rect_t *rect)
+{
+  if(Menu_RectArea(rect) != 0)
+  {
+    // Menu_FillRectangle fills Height + 1 lines
+    Menu_FillRectangle(rect->X, rect->Y, rect->Width, rect->Height - 1);
+  }
+}
+
+/** @brief Initialize a widget, it is neither displayed nor added to the screen
+  * @param widget Widget to initialize
+  * @param x Widget position on X-axis
+  * @param y Widget position on Y-axis
+  * @param width Widget width
+  * @param height Widget height
+  * @param flags Widget properties (MENU_WIDGET_OPAQUE)
+  * @param draw Widget paint function
+  */
+void Menu_WidgetInit(Menu_Widget_t *widget, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint8_t flags, Menu_WidgetDraw_t draw)
+{
+  widget->Area.X = x;
+  widget->Area.Y = y;
+  widget->Area.Width = width;
+  widget->Area.Height = height;
+  widget->Dirty = MENU_WIDGET_DIRTY_AREA;
+  widget->Flags = flags;
+  widget->Draw = draw;
+  widget->Next = NULL;
+}
+
+/** @brief Add a widget on top of the current screen, a widget already on the screen is kept at its place
+  * @param widget Widget to add
+  */
+void Menu_WidgetAdd(Menu_Widget_t *widget)
+{
+  Menu_Widget_t **link = &WidgetList;
+
+  while(*link != NULL)
+  {
+    if(*link == widget)
+    {
+      return;
+    }
+    link = &((*link)->Next);
+  }
+  widget->Next = NULL;
+  *link = widget;
+}
+
+/** @brief Forget the widgets and the damage of the current screen, to be called when the screen is cleared
+  */
+void Menu_WidgetReset(void)
+{
+  while(WidgetList != NULL)
+  {
+    Menu_Widget_t *next = WidgetList->Next;
+    WidgetList->Next = NULL;
+    WidgetList = next;
+  }
+  WidgetNbDamage = 0;
+}
+
+/** @brief Mark a widget dirty, it is repainted on next refresh
+  * @param widget Widget to invalidate
+  * @param dirty MENU_WIDGET_DIRTY_STATE or MENU_WIDGET_DIRTY_AREA
+  */
+void Menu_WidgetInvalidate(Menu_Widget_t *widget, uint8_t dirty)
+{
+  widget->Dirty |= dirty;
+}
+
+/** @brief Move a widget: the area it leaves is damaged and the new one is repainted on next refresh
+  * @param widget Widget to move
+  * @param x New position on X-axis
+  * @param y New position on Y-axis
+  */
+void Menu_WidgetMove(Menu_Widget_t *widget, uint32_t x, uint32_t y)
+{
+  if((widget->Area.X == x) && (widget->Area.Y == y))
+  {
+    return;
+  }
+  Menu_WidgetDamage(&widget->Area);
+  widget->Area.X = x;
+  widget->Area.Y = y;
+  widget->Dirty |= MENU_WIDGET_DIRTY_AREA;
+}
+
+/** @brief Damage a display area: it is cleared and the widgets on it are repainted on next refresh.
+  *        The rectangle is merged with the damaged rectangles it overlaps or nearly touches,
+  *        or with the closest one when the damage list is full.
+  * @param rect Damaged area
+  */
+void Menu_WidgetDamage(const Menu_Rect_t *rect)
+{
+  Menu_Rect_t r = *rect;
+  Menu_Rect_t merged;
+  uint32_t i = 0;
+
+  if(Menu_RectArea(&r) == 0)
+  {
+    return;
+  }
+
+  // a merged rectangle may reach rectangles it was not touching before: restart the scan
+  while(i < WidgetNbDamage)
+  {
+    Menu_RectUnion(&WidgetDamage[i], &r, &merged);
+    if(Menu_RectArea(&merged) <= (Menu_RectArea(&WidgetDamage[i]) + Menu_RectArea(&r) + MENU_WIDGET_MERGE_SLACK))
+    {
+      r = merged;
+      WidgetDamage[i] = WidgetDamage[--WidgetNbDamage];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+
+  if(WidgetNbDamage == MENU_WIDGET_MAX_DAMAGE)
+  {
+    // no room left: grow the rectangle which grows the least
+    uint32_t best = 0;
+    uint32_t bestGrowth = 0xFFFFFFFF;
+    for(i = 0; i < WidgetNbDamage; i++)
+    {
+      Menu_RectUnion(&WidgetDamage[i], &r, &merged);
+      if((Menu_RectArea(&merged) - Menu_RectArea(&WidgetDamage[i])) < bestGrowth)
+      {
+        bestGrowth = Menu_RectArea(&merged) - Menu_RectArea(&WidgetDamage[i]);
+        best = i;
+      }
+    }
+    Menu_RectUnion(&WidgetDamage[best], &r, &r);
+    WidgetDamage[best] = WidgetDamage[--WidgetNbDamage];
+    // the grown rectangle may now touch other ones
+    Menu_WidgetDamage(&r);
+    return;
+  }
+
+  WidgetDamage[WidgetNbDamage++] = r;
+}
+
+/* Clear a damaged rectangle, except below the opaque widgets which repaint it anyway */
+static void Menu_WidgetClearBackground(const Menu_Rect_t *rect)
+{
+  Menu_Rect_t piece[MENU_WIDGET_MAX_PIECES];
+  Menu_Rect_t split[MENU_WIDGET_MAX_PIECES];
+  uint32_t nbPiece = 1;
+  Menu_Widget_t *widget;
+  uint32_t i;
+
+  piece[0] = *rect;
+  for(widget = WidgetList; widget != NULL; widget = widget->Next)
+  {
+    uint32_t nbSplit = 0;
+    if(!(widget->Flags & MENU_WIDGET_OPAQUE))
+    {
+      continue;
+    }
+    for(i = 0; i < nbPiece; i++)
+    {
+      Menu_Rect_t *p = &piece[i];
+      Menu_Rect_t o;
+      if(!Menu_RectIntersect(p, &widget->Area, &o) || ((nbSplit + 4) > MENU_WIDGET_MAX_PIECES))
+      {
+        // untouched, or no room to split it: clear the whole piece
+        split[nbSplit++] = *p;
+        continue;
+      }
+      // up to 4 pieces around the widget: above, below, left and right
+      if(o.Y > p->Y)
+      {
+        split[nbSplit].X = p->X; split[nbSplit].Y = p->Y;
+        split[nbSplit].Width = p->Width; split[nbSplit].Height = o.Y - p->Y;
+        nbSplit++;
+      }
+      if((o.Y + o.Height) < (p->Y + p->Height))
+      {
+        split[nbSplit].X = p->X; split[nbSplit].Y = o.Y + o.Height;
+        split[nbSplit].Width = p->Width; split[nbSplit].Height = (p->Y + p->Height) - (o.Y + o.Height);
+        nbSplit++;
+      }
+      if(o.X > p->X)
+      {
+        split[nbSplit].X = p->X; split[nbSplit].Y = o.Y;
+        split[nbSplit].Width = o.X - p->X; split[nbSplit].Height = o.Height;
+        nbSplit++;
+      }
+      if((o.X + o.Width) < (p->X + p->Width))
+      {
+        split[nbSplit].X = o.X + o.Width; split[nbSplit].Y = o.Y;
+        split[nbSplit].Width = (p->X + p->Width) - (o.X + o.Width); split[nbSplit].Height = o.Height;
+        nbSplit++;
+      }
+    }
+    for(i = 0; i < nbSplit; i++)
+    {
+      piece[i] = split[i];
+    }
+    nbPiece = nbSplit;
+  }
+
+  for(i = 0; i < nbPiece; i++)
+  {
+    Menu_FillRect(&piece[i]);
+  }
+}
+
+/** @brief Repaint the invalidated parts of the current screen:
+  *        damaged rectangles are cleared, then the widgets are repainted back to front,
+  *        each one once, on the part of its area that was damaged.
+  */
+void Menu_WidgetRefresh(void)
+{
+  Menu_Widget_t *widget;
+  uint32_t i;
+
+  for(widget = WidgetList; widget != NULL; widget = widget->Next)
+  {
+    if(widget->Dirty & MENU_WIDGET_DIRTY_AREA)
+    {
+      Menu_WidgetDamage(&widget->Area);
+    }
+  }
+
+  if(WidgetNbDamage != 0)
+  {
+    Menu_SetStyle(CLEAR_PLAIN);
+    for(i = 0; i < WidgetNbDamage; i++)
+    {
+      Menu_WidgetClearBackground(&WidgetDamage[i]);
+    }
+  }
+
+  for(widget = WidgetList; widget != NULL; widget = widget->Next)
+  {
+    Menu_Rect_t clip = {0, 0, 0, 0};
+    Menu_Rect_t part;
+    for(i = 0; i < WidgetNbDamage; i++)
+    {
+      if(Menu_RectIntersect(&widget->Area, &WidgetDamage[i], &part))
+      {
+        Menu_RectUnion(&clip, &part, &clip);
+      }
+    }
+    if(Menu_RectArea(&clip) != 0)
+    {
+      widget->Draw(widget, &clip);
+    } else if(widget->Dirty & MENU_WIDGET_DIRTY_STATE) {
+      widget->Draw(widget, NULL);
+    }
+    widget->Dirty = MENU_WIDGET_CLEAN;
+  }
+  WidgetNbDamage = 0;
+}
+
+/** @brief Repaint a widget which is not part of the screen list, from its dirty flags only
+  * @param widget Widget to repaint
+  */
+void Menu_WidgetUpdate(Menu_Widget_t *widget)
+{
+  if(widget->Dirty & MENU_WIDGET_DIRTY_AREA)
+  {
+    if(!(widget->Flags & MENU_WIDGET_OPAQUE))
+    {
+      Menu_SetStyle(CLEAR_PLAIN);
+      Menu_FillRect(&widget->Area);
+    }
+    widget->Draw(widget, &widget->Area);
+  } else if(widget->Dirty & MENU_WIDGET_DIRTY_STATE) {
+    widget->Draw(widget, NULL);
+  }
+  widget->Dirty = MENU_WIDGET_CLEAN;
+}
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    Menu_widget.h
+  * @author  MMY Application Team
+  * @brief   Retained widgets and dirty rectangles for the menu framework.
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#ifndef _MENU_WIDGET_H_
+#define _MENU_WIDGET_H_
+
+#include "stdint.h"
+#include "Menu_config.h"
+
+/** Number of damaged rectangles kept before they are merged into each other */
+#define MENU_WIDGET_MAX_DAMAGE       4
+/** Extra pixels accepted when merging two damaged rectangles into their bounding box */
+#define MENU_WIDGET_MERGE_SLACK     64
+
+/** Widget dirty flags */
+#define MENU_WIDGET_CLEAN         0x00  /**< Display matches the widget */
+#define MENU_WIDGET_DIRTY_STATE   0x01  /**< Widget state changed in place, only the changed parts are repainted */
+#define MENU_WIDGET_DIRTY_AREA    0x02  /**< Whole widget area has to be repainted */
+
+/** Widget properties */
+#define MENU_WIDGET_OPAQUE        0x01  /**< Widget paints every pixel of its area, no background needed below it */
+
+/** Rectangle on the display, Width and Height in pixels */
+typedef struct {
+  uint32_t X;
+  uint32_t Y;
+  uint32_t Width;
+  uint32_t Height;
+} Menu_Rect_t;
+
+struct Menu_Widget_t;
+/** Widget paint function: clip is the invalidated part of the widget area to repaint,
+    or NULL to repaint only what changed since the last paint (MENU_WIDGET_DIRTY_STATE) */
+typedef void (*Menu_WidgetDraw_t)(struct Menu_Widget_t *widget, const Menu_Rect_t *clip);
+
+/** Retained description of a displayed item */
+typedef struct Menu_Widget_t {
+  Menu_Rect_t Area;               /**< Bounding box of the widget on the display */
+  uint8_t Dirty;                  /**< MENU_WIDGET_CLEAN or a combination of MENU_WIDGET_DIRTY_xxx */
+  uint8_t Flags;                  /**< Combination of widget properties */
+  Menu_WidgetDraw_t Draw;         /**< Paint function */
+  struct Menu_Widget_t *Next;     /**< Next widget on the screen, painted above this one */
+} Menu_Widget_t;
+
+uint8_t Menu_RectIntersect(const Menu_Rect_t *a, const Menu_Rect_t *b, Menu_Rect_t *res);
+void Menu_RectUnion(const Menu_Rect_t *a, const Menu_Rect_t *b, Menu_Rect_t *res);
+void Menu_FillRect(const Menu_Rect_t *rect);
+
+void Menu_WidgetInit(Menu_Widget_t *widget, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint8_t flags, Menu_WidgetDraw_t draw);
+void Menu_WidgetAdd(Menu_Widget_t *widget);
+void Menu_WidgetReset(void);
+void Menu_WidgetInvalidate(Menu_Widget_t *widget, uint8_t dirty);
+void Menu_WidgetMove(Menu_Widget_t *widget, uint32_t x, uint32_t y);
+void Menu_WidgetDamage(const Menu_Rect_t *rect);
+void Menu_WidgetRefresh(void);
+void Menu_WidgetUpdate(Menu_Widget_t *widget);
+
+#endif
@@ -52,11 +52,21 @@ uint8_t ptype,ssap,dsap;
 static LLCP_ConfigStruct 			LLCP_LocalConfig;
 static LLCP_ConfigStruct 			LLCP_RemoteConfig;
 
+/* Outgoing (possibly aggregated) frame and incoming frame in Initiator mode */
+static uint8_t								LLCP_FrameBuff[LLCP_MAX_LENGTH];
+/* Copy of a received AGF, its PDUs are dispatched one by one */
+static uint8_t								LLCP_AGFBuff[LLCP_MAX_LENGTH];
+
 
 static void LLCP_DecodeHeader(uint16_t * plength, uint8_t * Buffer, uint8_t * dsap, uint8_t * ptype,uint8_t * ssap);
 static void WritePDUHeader(uint8_t DSAP, uint8_t PTYPE, uint8_t SSAP, uint8_t * Buffer );
 static int8_t LLCP_GetService( uint8_t SAP);
 static int8_t LLCP_GetLLC( uint8_t DSAP, uint8_t SSAP);
+static void LLCP_SetLinkParam( LLCP_LLC * LLC );
+static bool LLCP_IsSendWindowOpen( LLCP_LLC * LLC );
+static void LLCP_WriteI( LLCP_LLC * LLC, uint16_t InfoLength );
+static bool LLCP_AppendPDU( uint8_t * Frame, uint16_t * Offset, uint8_t * NbPDU, LLCP_LLC * LLC );
+static uint16_t LLCP_BuildFrame( uint8_t * Frame );
 #if 0
 static int8_t LLCP_GetSAP( char * uri);
 #endif
@@ -103,6 +113,26 @@ static int8_t LLCP_GetLLC( uint8_t DSAP,uint8_t SSAP)
 	return -1;
 }
 
+/* MIU and RW of a data link before any CONNECT/CC parameter is received */
+static void LLCP_SetLinkParam( LLCP_LLC * LLC )
+{
+	if(LLCP_RemoteConfig.MIUX < LLCP_LocalConfig.MIUX)
+		LLC->MIU = LLCP_DEFAULT_MIU + LLCP_RemoteConfig.MIUX;
+	else
+		LLC->MIU = LLCP_DEFAULT_MIU + LLCP_LocalConfig.MIUX;
+	
+	LLC->RW = LLCP_DEFAULT_RW;
+}
+
+/* An I PDU can be sent as long as less than RW of them are waiting for an acknowledge */
+static bool LLCP_IsSendWindowOpen( LLCP_LLC * LLC )
+{
+	if(IS_D_BUSY_FLAG(LLC->Flags))
+		return false;
+	
+	return (((uint8_t)(LLC->V_S - LLC->V_SA)) & LLCP_V_R_MASK) < LLC->RW;
+}
+
 #if 0
 static int8_t LLCP_GetSAP(char * uri)
 {
@@ -137,6 +167,7 @@ uint8_t LLCP_Init( void )
 	LLCP_RemoteConfig.MIUX=0; /* default is 128, MIU = 128 + MIUX */
 	LLCP_RemoteConfig.WKS=0;
 	LLCP_RemoteConfig.LTO=10;  /* default 100ms if not transmitted */
+	LLCP_RemoteConfig.RW=LLCP_DEFAULT_RW;
 	LLCP_RemoteConfig.OPT=0;
 	
 	/* map LLCP function with NFCDEP layer */
@@ -207,7 +238,7 @@ uint8_t LLCP_ConnectService( uint8_t SAP, LLCP_LLC **LLC )
 		Connections[NbConnections].V_RA = 0x00;
 		Connections[NbConnections].Flags=0;
 		Connections[NbConnections].MIU=LLCP_DEFAULT_MIU+LLCP_LocalConfig.MIUX;
-		Connections[NbConnections].RW=0;
+		Connections[NbConnections].RW=LLCP_DEFAULT_RW;
 		*LLC=&Connections[NbConnections];
 		
 		for(i=0; i<LLCP_NB_SERVICE_MAX; i++)
@@ -323,55 +354,22 @@ uint32_t DBG_LLCP_TX_index = 0;
 /* Function call periodicly only in Initiator mode*/
 uint8_t LLCP_Send ( void )
 {
-	uint8_t i = 0;
+	uint16_t Length;
+	
+	/* Every pending PDU that fits in one frame is sent, SYMM if none */
+	Length = LLCP_BuildFrame(LLCP_FrameBuff);
 	
-  for(i=0;i<NbConnections;i++)
-  {
-		/* First do we have an internal LLCP data to send */
-		if(IS_LLCP_MESS_FLAG( Connections[i].Flags))
-		{					
-			break;				
-		}
-		/* Second do we have a message from upper layer to send */
-		else if(IS_OUT_MESS_FLAG( Connections[i].Flags))
-    { 
-			if(Connections[i].ConnectDisconnect == LLCP_CONNECTION_CLAIM)
-			{	
-				LLCP_SendCONNECT(&Connections[i]);
-				Connections[i].ConnectDisconnect = LLCP_NO_ACTION;		
-			}
-			else if(Connections[i].ConnectDisconnect == LLCP_DISCONNECTION_CLAIM)
-			{
-				LLCP_SendDISC(&Connections[i]);
-				Connections[i].ConnectDisconnect = LLCP_NO_ACTION;
-			}
-			else			
-				LLCP_SendI(&Connections[i]);
-			
-			break;	
-    }
-	}
-
-	if(i>=NbConnections)
-	{
-		/* No message from upper layer to send, or LLCP answer to send, SYMM frame must be send */
-		LLCP_SendSYMM();
-		i = LLCP_GetLLC(0x00,0x00);
-	} 
 #ifdef DEBUG_LLCP
-  else if(DBG_LLCP_TX_index < 10) {
-      memcpy(&DBG_LLCP_TX[DBG_LLCP_TX_index++],Connections[i].LLCInternalBuff,
-                Connections[i].LLCBuffLength > 20 ? 20 : Connections[i].LLCBuffLength);
+  if((Length != 2) && (DBG_LLCP_TX_index < 10)) {
+      memcpy(&DBG_LLCP_TX[DBG_LLCP_TX_index++],LLCP_FrameBuff, Length > 20 ? 20 : Length);
   }
 #endif
 
-//	if (PCDNFCDEP_Dep (0x00, Connections[i].LLCInternalBuff, &(Connections[i].LLCBuffLength) ) == PCDNFCDEP_SUCESSSCODE)
-  if(nfcDepTxRx(Connections[i].LLCInternalBuff,Connections[i].LLCBuffLength,
-                      Connections[i].LLCInternalBuff,512,
-                      &Connections[i].LLCBuffLength) == ERR_NONE)
+  if(nfcDepTxRx(LLCP_FrameBuff,Length,
+                      LLCP_FrameBuff,sizeof(Connections[0].LLCInternalBuff),
+                      &Length) == ERR_NONE)
 	{		
-		CLEAR_LLCP_MESS_FLAG( Connections[i].Flags);
-		LLCP_HandlePDU(&(Connections[i].LLCBuffLength),Connections[i].LLCInternalBuff);			
+		LLCP_HandlePDU(&Length,LLCP_FrameBuff);			
 		return LLCP_SUCCESS_CODE;
 	}
 	else
@@ -418,7 +416,6 @@ DBG_PROBE_INIT(pSendReceive,10, 20, 1);
 void LLCP_Reply(uint8_t *pSendReceive, uint16_t *nbByte)
 {
 	uint8_t result;
-  uint8_t i =0;
 	
   if((*nbByte != 2) || pSendReceive[0] || pSendReceive[1])
   {
@@ -432,45 +429,115 @@ void LLCP_Reply(uint8_t *pSendReceive, uint16_t *nbByte)
 		/* Need to stop everything */
 	}
 	
+	/* Fill NFCDEP answer buffer, SYMM if nothing to send */
+	*nbByte = LLCP_BuildFrame(pSendReceive);
+}
+
+
+/*****************************************************************************/
+/*														Frame building																 */
+/*****************************************************************************/
+
+/* Append the PDU pending in the LLC buffer to the frame, preceded by its AGF length field */
+static bool LLCP_AppendPDU( uint8_t * Frame, uint16_t * Offset, uint8_t * NbPDU, LLCP_LLC * LLC )
+{
+	if((*Offset + LLCP_AGF_LENGTH_L + LLC->LLCBuffLength) > LLCP_AGF_MAX_LENGTH)
+		return false;
+	
+	Frame[(*Offset)++] = (LLC->LLCBuffLength & 0xFF00) >> 8;
+	Frame[(*Offset)++] = (LLC->LLCBuffLength & 0x00FF);
+	memcpy(&Frame[*Offset], LLC->LLCInternalBuff, LLC->LLCBuffLength);
+	*Offset += LLC->LLCBuffLength;
+	(*NbPDU)++;
+	CLEAR_LLCP_MESS_FLAG(LLC->Flags);
+	
+	return true;
+}
+
+/* Collect the pending PDUs of all the connections in one frame.
+   A single PDU is sent as is, several are sent in an AGF, SYMM is sent if none.
+   Frame must be at least LLCP_AGF_MAX_LENGTH long, returns the frame length */
+static uint16_t LLCP_BuildFrame( uint8_t * Frame )
+{
+	uint16_t Offset = LLCP_OFFSET_AGF_INFO;
+	uint16_t InfoLength;
+	uint8_t NbPDU = 0;
+	uint8_t i;
+	
 	for(i=0;i<NbConnections;i++)
-  {
+	{
+		/* Upper layer has read the data received while we were busy, reopen the remote send window */
+		if(IS_L_BUSY_FLAG(Connections[i].Flags) && !IS_IN_MESS_FLAG(Connections[i].Flags) && !IS_LLCP_MESS_FLAG(Connections[i].Flags))
+		{
+			CLEAR_L_BUSY_FLAG(Connections[i].Flags);
+			LLCP_SendRR(&Connections[i]);
+		}
+		
+		/* First do we have an internal LLCP data to send */
 		if(IS_LLCP_MESS_FLAG( Connections[i].Flags))
-			break;
-		else if(IS_OUT_MESS_FLAG( Connections[i].Flags))
+		{
+			/* SYMM is only sent when there is nothing else */
+			if((Connections[i].LLCBuffLength == 0x02) && (Connections[i].LLCInternalBuff[0] == 0x00) && (Connections[i].LLCInternalBuff[1] == 0x00))
+			{
+				CLEAR_LLCP_MESS_FLAG( Connections[i].Flags);
+			}
+			else if(!LLCP_AppendPDU(Frame, &Offset, &NbPDU, &Connections[i]))
+			{
+				/* No room left, keep it (and what follows on this link) for next frame */
+				continue;
+			}
+		}
+		
+		/* Second do we have a message from upper layer to send */
+		if(IS_OUT_MESS_FLAG( Connections[i].Flags))
 		{
 			if(Connections[i].ConnectDisconnect == LLCP_CONNECTION_CLAIM)
 			{	
 				LLCP_SendCONNECT(&Connections[i]);
 				Connections[i].ConnectDisconnect = LLCP_NO_ACTION;
-				break;
+				LLCP_AppendPDU(Frame, &Offset, &NbPDU, &Connections[i]);
 			}
 			else if(Connections[i].ConnectDisconnect == LLCP_DISCONNECTION_CLAIM)
 			{
 				LLCP_SendDISC(&Connections[i]);
-				Connections[i].ConnectDisconnect = LLCP_NO_ACTION;	
-				break;
+				Connections[i].ConnectDisconnect = LLCP_NO_ACTION;
+				LLCP_AppendPDU(Frame, &Offset, &NbPDU, &Connections[i]);
 			}
 			else
-			{	
-				/* Send I */
-				LLCP_SendI(&Connections[i]);
-				break;
+			{
+				/* Send I PDUs while the remote receive window and the frame allow it */
+				while(IS_OUT_MESS_FLAG( Connections[i].Flags) && LLCP_IsSendWindowOpen(&Connections[i]))
+				{
+					if((Offset + LLCP_AGF_LENGTH_L + LLCP_OFFSET_I_INFO + LLCP_AGF_MIN_INFO) > LLCP_AGF_MAX_LENGTH)
+						break;
+					
+					InfoLength = LLCP_AGF_MAX_LENGTH - Offset - LLCP_AGF_LENGTH_L - LLCP_OFFSET_I_INFO;
+					if(InfoLength > Connections[i].MIU)
+						InfoLength = Connections[i].MIU;
+					
+					LLCP_WriteI(&Connections[i], InfoLength);
+					LLCP_AppendPDU(Frame, &Offset, &NbPDU, &Connections[i]);
+				}
 			}
 		}
 	}
 	
-	/* No message to send, SYMM must be sent */
-	if(i>= NbConnections)
-	{	
-		LLCP_SendSYMM();
-		i = LLCP_GetLLC(0x00,0x00);
+	if(NbPDU == 0)
+	{
+		/* No message from upper layer to send, or LLCP answer to send, SYMM frame must be send */
+		WritePDUHeader(LLCP_SYMM_DSAP, LLCP_PTYPE_SYMM, LLCP_SYMM_SSAP, Frame);
+		return 0x02;
+	}
+	else if(NbPDU == 1)
+	{
+		/* No need to aggregate, remove the AGF length field */
+		Offset -= (LLCP_OFFSET_AGF_INFO + LLCP_AGF_LENGTH_L);
+		memmove(Frame, &Frame[LLCP_OFFSET_AGF_INFO + LLCP_AGF_LENGTH_L], Offset);
+		return Offset;
 	}
 	
-	/* Fill NFCDEP answer buffer */
-	memcpy(pSendReceive, Connections[i].LLCInternalBuff, Connections[i].LLCBuffLength);
-	*nbByte = Connections[i].LLCBuffLength;
-	CLEAR_LLCP_MESS_FLAG( Connections[i].Flags);
-	
+	WritePDUHeader(LLCP_SYMM_DSAP, LLCP_PTYPE_AGF, LLCP_SYMM_SSAP, Frame);
+	return Offset;
 }
 
 
@@ -505,6 +572,8 @@ uint8_t LLCP_HandlePDU(	uint16_t  *pLength, uint8_t * Buffer)
 	/* Service not available send a DM message, but need to create a LLC struct for the service not connected...*/
 	//if( i==-1)
 		//LLCP_SendDM(LLC,LLCP_DM_NOT_CONNECTED);
+	if( index < 0)
+		return LLCP_ERRORCODE_NO_LLC;
 	
 	memcpy(Connections[index].LLCInternalBuff, Buffer, *pLength);
 	Connections[index].LLCBuffLength = *pLength;
@@ -598,7 +667,29 @@ uint8_t LLCP_ReplyToPAX ( LLCP_LLC * LLC )
 /* AGF Aggregated Frame */
 uint8_t LLCP_ReplyToAGF ( LLCP_LLC * LLC )
 {
-	/* Not Implemented Yet */
+	uint16_t Length = LLC->LLCBuffLength;
+	uint16_t Offset = LLCP_OFFSET_AGF_INFO;
+	uint16_t PDULength;
+	
+	/* LLC buffer is reused by the encapsulated PDUs, work on a copy */
+	memcpy(LLCP_AGFBuff, LLC->LLCInternalBuff, Length);
+	
+	while((Offset + LLCP_AGF_LENGTH_L) <= Length)
+	{
+		PDULength = ((uint16_t)(LLCP_AGFBuff[Offset])<<8) + LLCP_AGFBuff[Offset+1];
+		Offset += LLCP_AGF_LENGTH_L;
+		
+		/* Malformed AGF, ignore the remaining PDUs */
+		if((PDULength < 0x02) || ((Offset + PDULength) > Length))
+			break;
+		
+		/* AGF within AGF is not allowed */
+		LLCP_DecodeHeader(&PDULength, &LLCP_AGFBuff[Offset], &dsap, &ptype, &ssap);
+		if(ptype != LLCP_PTYPE_AGF)
+			LLCP_HandlePDU(&PDULength, &LLCP_AGFBuff[Offset]);
+		
+		Offset += PDULength;
+	}
 	
 	if(TargetMode)
 		return(LLCP_SendSYMM());
@@ -636,13 +727,11 @@ uint8_t LLCP_ReplyToCONNECT ( LLCP_LLC * LLC, uint8_t SSAP)
 		LLC->V_SA = 0x00;
 		LLC->V_R = 0x00;
 		LLC->V_RA = 0x00;
+		CLEAR_D_BUSY_FLAG(LLC->Flags);
+		CLEAR_L_BUSY_FLAG(LLC->Flags);
+		LLCP_SetLinkParam(LLC);
 		LLCP_HandleTLVCONNECT(LLC);
 		SET_CONNECTION_FLAG(LLC->Flags);
-		
-		if(LLCP_RemoteConfig.MIUX < LLCP_LocalConfig.MIUX)
-			LLC->MIU = LLCP_DEFAULT_MIU + LLCP_RemoteConfig.MIUX;
-		else
-			LLC->MIU = LLCP_DEFAULT_MIU + LLCP_LocalConfig.MIUX;
 				
 		LLCP_SendCC(LLC);
 	}
@@ -663,14 +752,10 @@ uint8_t LLCP_ReplyToCC ( LLCP_LLC * LLC )
 {
 	SET_CONNECTION_FLAG(LLC->Flags);
 	CLEAR_ASK_CONN_FLAG(LLC->Flags);
+	LLCP_SetLinkParam(LLC);
 	/* Do we have TLV parameters to update ? */
-	if( LLC->LLCBuffLength > 2)   
-		LLCP_HandleTLVPAX( &(LLC->LLCInternalBuff[2]), LLC->LLCBuffLength-2);
-	
-	if(LLCP_RemoteConfig.MIUX < LLCP_LocalConfig.MIUX)
-		LLC->MIU = LLCP_DEFAULT_MIU + LLCP_RemoteConfig.MIUX;
-	else
-		LLC->MIU = LLCP_DEFAULT_MIU + LLCP_LocalConfig.MIUX;	
+	if( LLC->LLCBuffLength > LLCP_OFFSET_TLV)   
+		LLCP_HandleTLVCONNECT(LLC);
 	
 	if(TargetMode)
 		return(LLCP_SendSYMM());
@@ -706,12 +791,36 @@ uint8_t LLCP_ReplyToFRMR ( LLCP_LLC * LLC)
 /* I Information */
 uint8_t LLCP_ReplyToI ( LLCP_LLC * LLC )
 {
-	LLC->V_R = ((LLC->LLCInternalBuff[2] & 0xF0)>>4)+1;
-	memcpy(LLC->InMessage,&(LLC->LLCInternalBuff[LLCP_OFFSET_I_INFO]),LLC->LLCBuffLength-LLCP_OFFSET_I_INFO);
-	LLC->InLength=LLC->LLCBuffLength-LLCP_OFFSET_I_INFO;
+	uint16_t InfoLength = LLC->LLCBuffLength-LLCP_OFFSET_I_INFO;
+	uint16_t Offset = 0;
+	
+	/* N(R) acknowledges our own I PDUs */
+	LLC->V_SA=(LLC->LLCInternalBuff[LLCP_OFFSET_SEQ]&LLCP_N_R_MASK);
+	
+	/* Several I PDUs can be received in one AGF, append to data not yet read by upper layer */
+	if(IS_IN_MESS_FLAG(LLC->Flags))
+		Offset = LLC->InLength;
+	
+	if((Offset + InfoLength) > LLCP_MAX_LENGTH)
+	{
+		/* Remote did not stop on our RNR or ignored our RW: PDU is lost, RR is sent once upper layer has read its data */
+		SET_L_BUSY_FLAG(LLC->Flags);
+		return LLCP_SendRNR(LLC);
+	}
+	
+	LLC->V_R = (((LLC->LLCInternalBuff[LLCP_OFFSET_SEQ] & LLCP_N_S_MASK)>>4)+1) & LLCP_V_R_MASK;
+	memcpy(&LLC->InMessage[Offset],&(LLC->LLCInternalBuff[LLCP_OFFSET_I_INFO]),InfoLength);
+	LLC->InLength=Offset+InfoLength;
 	/* Inform upper layer */
   SET_IN_MESS_FLAG(LLC->Flags);
     
+	/* Remote may send up to RW PDUs after our acknowledge: stop it while they would not fit */
+	if((LLCP_MAX_LENGTH - LLC->InLength) < (LLCP_LocalConfig.RW * (LLCP_DEFAULT_MIU + LLCP_LocalConfig.MIUX)))
+	{
+		SET_L_BUSY_FLAG(LLC->Flags);
+		return LLCP_SendRNR(LLC);
+	}
+	
   /* Reply with RR */
 	LLCP_SendRR(LLC);
 	
@@ -722,6 +831,7 @@ uint8_t LLCP_ReplyToI ( LLCP_LLC * LLC )
 uint8_t LLCP_ReplyToRR ( LLCP_LLC * LLC )
 {
 	LLC->V_SA=(LLC->LLCInternalBuff[LLCP_OFFSET_SEQ]&LLCP_N_R_MASK);
+	CLEAR_D_BUSY_FLAG(LLC->Flags);
     
   if(TargetMode)
 		return(LLCP_SendSYMM());
@@ -734,7 +844,11 @@ uint8_t LLCP_ReplyToRNR ( LLCP_LLC * LLC )
 {
 	LLC->V_SA=(LLC->LLCInternalBuff[LLCP_OFFSET_SEQ]&LLCP_N_R_MASK);
 	
-	/* must send again the missing I PDU i guess */
+	/* No more I PDU until remote sends RR */
+	SET_D_BUSY_FLAG(LLC->Flags);
+	
+	if(TargetMode)
+		return(LLCP_SendSYMM());
 	
 	return LLCP_SUCCESS_CODE;
 }
@@ -780,10 +894,13 @@ uint8_t LLCP_SendCONNECT ( LLCP_LLC * LLC)
 	LLC->V_SA = 0x00;
 	LLC->V_R = 0x00;
 	LLC->V_RA = 0x00;
-	
+	CLEAR_D_BUSY_FLAG(LLC->Flags);
+	CLEAR_L_BUSY_FLAG(LLC->Flags);
+	LLCP_SetLinkParam(LLC);
 
 	WritePDUHeader (LLC->DSAP,LLCP_PTYPE_CONNECT,LLC->SSAP,LLC->LLCInternalBuff);
-	LLC->LLCBuffLength=0x02;
+	/* Advertise our receive window */
+	LLC->LLCBuffLength=LLCP_OFFSET_TLV + LLCP_WritePAXTLV(&LLC->LLCInternalBuff[LLCP_OFFSET_TLV], LLCP_TLV_RW_F);
 	SET_LLCP_MESS_FLAG(LLC->Flags);
 	CLEAR_OUT_MESS_FLAG( LLC->Flags);
 	return LLCP_SUCCESS_CODE;
@@ -802,7 +919,8 @@ uint8_t LLCP_SendDISC ( LLCP_LLC * LLC)
 uint8_t LLCP_SendCC ( LLCP_LLC * LLC )
 {
 	WritePDUHeader (LLC->DSAP,LLCP_PTYPE_CC,LLC->SSAP,LLC->LLCInternalBuff);
-	LLC->LLCBuffLength = 0x02;
+	/* Advertise our receive window */
+	LLC->LLCBuffLength = LLCP_OFFSET_TLV + LLCP_WritePAXTLV(&LLC->LLCInternalBuff[LLCP_OFFSET_TLV], LLCP_TLV_RW_F);
 	SET_LLCP_MESS_FLAG(LLC->Flags);	
 	
 	return LLCP_SUCCESS_CODE;
@@ -829,16 +947,19 @@ uint8_t LLCP_SendFRMR ( LLCP_LLC * LLC, uint8_t Flags, uint8_t Ptype, uint8_t Se
 	return LLCP_SUCCESS_CODE;
 }
 
-uint8_t LLCP_SendI ( LLCP_LLC * LLC)
+/* Write next I PDU carrying at most InfoLength bytes of the upper layer message */
+static void LLCP_WriteI ( LLCP_LLC * LLC, uint16_t InfoLength )
 {
 	WritePDUHeader(LLC->DSAP,LLCP_PTYPE_I,LLC->SSAP,LLC->LLCInternalBuff);
-	LLC->LLCInternalBuff[0x02]=(LLC->V_R & LLCP_V_R_MASK) + ((LLC->V_S<<4)& LLCP_V_S_MASK);
-	LLC->LLCBuffLength=0x03;
+	LLC->LLCInternalBuff[LLCP_OFFSET_SEQ]=(LLC->V_R & LLCP_V_R_MASK) + ((LLC->V_S<<4)& LLCP_V_S_MASK);
+	LLC->LLCBuffLength=LLCP_OFFSET_I_INFO;
+	/* N(R) acknowledges received I PDUs */
+	LLC->V_RA=LLC->V_R;
 	
 	/* Can we send all data in one PDU? */
-	if( LLC->OutLength <= (LLC->MIU))
+	if( LLC->OutLength <= InfoLength)
 	{	
-		memcpy(&(LLC->LLCInternalBuff[0x03]),LLC->OutMessage,LLC->OutLength);
+		memcpy(&(LLC->LLCInternalBuff[LLCP_OFFSET_I_INFO]),LLC->OutMessage,LLC->OutLength);
 		LLC->LLCBuffLength += LLC->OutLength;
 		LLC->OutLength = 0;
 		/* all data of the message has been sent */
@@ -846,15 +967,20 @@ uint8_t LLCP_SendI ( LLCP_LLC * LLC)
 	}
 	else
 	{
-		memcpy(&(LLC->LLCInternalBuff[0x03]),LLC->OutMessage,LLC->MIU);
-		LLC->LLCBuffLength += LLC->MIU;
+		memcpy(&(LLC->LLCInternalBuff[LLCP_OFFSET_I_INFO]),LLC->OutMessage,InfoLength);
+		LLC->LLCBuffLength += InfoLength;
 		
-		LLC->OutLength -= LLC->MIU;
-		memcpy(LLC->OutMessage, &LLC->OutMessage[LLC->MIU], LLC->OutLength );
+		LLC->OutLength -= InfoLength;
+		memmove(LLC->OutMessage, &LLC->OutMessage[InfoLength], LLC->OutLength );
 	}
 	
 	LLC->V_S++;
 	SET_LLCP_MESS_FLAG(LLC->Flags);		
+}
+
+uint8_t LLCP_SendI ( LLCP_LLC * LLC)
+{
+	LLCP_WriteI(LLC, LLC->MIU);
 	
 	return LLCP_SUCCESS_CODE;
 }
@@ -872,7 +998,12 @@ uint8_t LLCP_SendRR ( LLCP_LLC * LLC )
 
 uint8_t LLCP_SendRNR 				( LLCP_LLC * LLC)
 {
-	/* Not implemented yet */	
+	WritePDUHeader (LLC->DSAP,LLCP_PTYPE_RNR,LLC->SSAP, LLC->LLCInternalBuff );
+	LLC->LLCInternalBuff[LLCP_OFFSET_SEQ]=LLC->V_R &LLCP_N_R_MASK;
+	LLC->V_RA=LLC->V_R;
+	LLC->LLCBuffLength=0x03;
+	SET_LLCP_MESS_FLAG(LLC->Flags);
+	
 	return LLCP_SUCCESS_CODE;
 }
 
@@ -949,17 +1080,23 @@ uint8_t LLCP_WritePAXTLV( uint8_t * Buffer , uint8_t TLVFlags )
 }
 
 
+/* Parameters of CONNECT and CC PDU, MIU and RW of the data link */
 uint8_t LLCP_HandleTLVCONNECT(LLCP_LLC * LLC)
 {	
-	uint16_t Offset = 0;
+	uint16_t Offset = LLCP_OFFSET_TLV;
+	uint16_t MIU;
 	
-	while(Offset<=LLC->LLCBuffLength){
+	while((Offset + 2) <= LLC->LLCBuffLength){
 		switch(LLC->LLCInternalBuff[Offset]){
 			case LLCP_TLV_MIUX_T:			/********************* MIUX *************/
 				if(LLC->LLCInternalBuff[Offset+1]==LLCP_TLV_MIUX_L)
 				{
-					LLC->MIU=*(uint16_t *) &(LLC->LLCInternalBuff[Offset+2])+LLCP_DEFAULT_MIU;
-					Offset+=LLCP_TLV_MIUX_L+2;
+					MIU = ((((uint16_t)(LLC->LLCInternalBuff[Offset+2])<<8) + LLC->LLCInternalBuff[Offset+3]) & LLCP_MIUX_MASK) + LLCP_DEFAULT_MIU;
+					/* Cannot exceed our own MIU */
+					if(MIU < (LLCP_DEFAULT_MIU + LLCP_LocalConfig.MIUX))
+						LLC->MIU = MIU;
+					else
+						LLC->MIU = LLCP_DEFAULT_MIU + LLCP_LocalConfig.MIUX;
 				}
 				else
 				{
@@ -969,8 +1106,7 @@ uint8_t LLCP_HandleTLVCONNECT(LLCP_LLC * LLC)
 			case LLCP_TLV_RW_T :				/********************* RW *************/
 				if(LLC->LLCInternalBuff[Offset+1]==LLCP_TLV_RW_L)
 				{
-					LLC->RW= LLC->LLCInternalBuff[Offset+2];
-					Offset+=LLCP_TLV_RW_L+2;
+					LLC->RW= LLC->LLCInternalBuff[Offset+2] & LLCP_RW_MASK;
 				}
 				else
 				{
@@ -979,11 +1115,11 @@ uint8_t LLCP_HandleTLVCONNECT(LLCP_LLC * LLC)
 				break;
 			case LLCP_TLV_SN_T :
 			  /*	#warning "Not Implemented Yet" */
-			
 			default:
-				return LLCP_ERRORCODE_WRONG_TLV;
-						
+				/* Skipped */
+				break;
 		}	
+		Offset += LLC->LLCInternalBuff[Offset+1] + 2;
 	}
 		return LLCP_SUCCESS_CODE;
 }
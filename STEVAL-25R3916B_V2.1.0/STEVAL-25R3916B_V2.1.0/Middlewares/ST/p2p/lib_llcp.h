@@ -46,10 +46,13 @@ typedef const uint8_t uc8;   /*!< Read Only */
 #define LLCP_VERSION										0x11
 #define LLCP_MAX_MIU									  LLCP_MAX_LENGTH
 #define LLCP_LTO												0x96				/* 150 *10 ms = 1.5s */
-#define LLCP_RW                         0x09
+#define LLCP_RW                         0x02        /* RW x MIU (128) fits twice in InMessage (LLCP_MAX_LENGTH) */
 #define LLCP_CLASS											0x03
 #define LLCP_WKS												0x0013      /* 0 LLCP, 1 SDP, 4 SNEP */
 
+#define LLCP_AGF_MAX_LENGTH							0xF0				/* 240, aggregated frame must fit in one NFC-DEP frame (LR 254) */
+#define LLCP_AGF_MIN_INFO								0x10				/* Smallest I PDU information field worth appending to a frame */
+
 /*****************************************************************************/
 /*															STRUCTURE																		 */
 /*****************************************************************************/
@@ -159,6 +162,10 @@ typedef struct{
 #define LLCP_OFFSET_SEQ						0x02
 #define LLCP_OFFSET_I_INFO				0x03
 #define LLCP_OFFSET_UI_INFO				0x02
+#define LLCP_OFFSET_TLV						0x02
+#define LLCP_OFFSET_AGF_INFO			0x02
+
+#define LLCP_AGF_LENGTH_L					0x02
 
 /*****************************************************************************/
 /*															LLCP DISCONNECTED MODE											 */
@@ -230,6 +237,7 @@ typedef struct{
 #define LLCP_OPT_MASK							0x03
 
 #define LLCP_DEFAULT_MIU					128
+#define LLCP_DEFAULT_RW						0x01
 
 
 #define LLCP_CONNECTION_FLAG_MASK				0x01
@@ -62,6 +62,11 @@ static SNEP_Server SNEPServer;
 static uint8_t SNEPInBuffer[LLCP_MAX_LENGTH];
 static uint8_t SNEPOutBuffer[LLCP_MAX_LENGTH];
 
+/* Fragment level interface */
+static uint8_t SNEP_PutHeader[SNEP_OFFSET_PUT_NDEF];
+static SNEP_NdefProducer SNEP_Producer = NULL;
+static SNEP_NdefConsumer SNEP_Consumer = NULL;
+
 static uint8_t SNEP_Connect2LLCPServer(LLCP_LLC* LLC);
 static uint8_t SNEP_Disconnect2LLCPServer( LLCP_LLC* LLC );
 
@@ -70,8 +75,11 @@ static uint8_t SNEP_Disconnect2LLCPServer( LLCP_LLC* LLC );
 static uint8_t SNEP_SendGetCMD( void  );
 static uint8_t SNEP_SendRejectCMD( void  );
 #endif
-static uint8_t SNEP_SendPutCMD( uint8_t *pBuffer, uint16_t  size );
-static uint8_t SNEP_SendContinue( uint8_t *pBuffer, uint16_t  size );
+static uint8_t SNEP_SendPutCMD( uint16_t  size );
+static uint8_t SNEP_SendContinue( uint16_t  size );
+static uint16_t SNEP_Produce( uint8_t *pBuffer, uint16_t  size );
+static uint16_t SNEP_BufferProducer( uint32_t Offset, uint8_t *pBuffer, uint16_t size );
+static void SNEP_ReceiveFragment( uint8_t *pBuffer, uint16_t  size );
 
 /* Response command */
 static uint8_t SNEP_SendRES( uint8_t CMD );
@@ -199,26 +207,48 @@ uint8_t SNEP_SendNDEF( uint8_t *pNdefMessage, uint16_t size )
     free(SNEP_Send_Buffer);
     SNEP_Send_Buffer = NULL;
   }
-  SNEP_Send_Buffer = malloc(size+SNEP_OFFSET_PUT_NDEF + 10);
+  SNEP_Send_Buffer = malloc(size + 10);
 
   if(SNEP_Send_Buffer == NULL)
     return SNEP_ERROR_CODE;
+#else
+  if(size > SNEP_MAX_SIZE_BUFFER)
+    return SNEP_ERROR_CODE;
 #endif
 
+	/* Keep a copy, the message is then sent from it fragment by fragment */
+	memcpy( SNEP_Send_Buffer, pNdefMessage, size);
+	
+	return SNEP_SendNDEFStream( &SNEP_BufferProducer, size );
+}
+
+uint8_t SNEP_SendNDEFStream( SNEP_NdefProducer Producer, uint32_t size )
+{
+	/* Can deal with only one message at a time */
+	if((SNEP_Message2SendState>SNEP_NO_MESSAGE) || (Producer == NULL))
+	{
+		return SNEP_ERROR_CODE;	
+	}
+	
 	/* Prepare Message */
-	SNEP_Send_Buffer[0] = 0x10; /* SNEP Version */
-	SNEP_Send_Buffer[1] = 0x02; /* SNEP Put command */
-	SNEP_Send_Buffer[2] = 0x00; /* Length */
-	SNEP_Send_Buffer[3] = 0x00; /* Length */
-	SNEP_Send_Buffer[4] = ((size & 0xFF00)>>8); /* Length */
-	SNEP_Send_Buffer[5] = (size & 0x00FF); /* Length */
+	SNEP_PutHeader[0] = SNEP_SERVER_VERSION; /* SNEP Version */
+	SNEP_PutHeader[1] = SNEP_CMD_PUT; /* SNEP Put command */
+	SNEP_PutHeader[2] = ((size & 0xFF000000)>>24); /* Length */
+	SNEP_PutHeader[3] = ((size & 0x00FF0000)>>16); /* Length */
+	SNEP_PutHeader[4] = ((size & 0x0000FF00)>>8); /* Length */
+	SNEP_PutHeader[5] = (size & 0x000000FF); /* Length */
 	
+	SNEP_Producer = Producer;
 	SNEPServer.MessLen = size+SNEP_OFFSET_PUT_NDEF;
+	SNEPServer.Offset = 0;
 	
-	memcpy( &SNEP_Send_Buffer[SNEP_OFFSET_PUT_NDEF] , pNdefMessage, SNEPServer.MessLen);
 	SNEP_Message2SendState = SNEP_MESSAGE2SEND;
 	return SNEP_SUCCESS_CODE;
+}
 
+void SNEP_SetNDEFConsumer( SNEP_NdefConsumer Consumer )
+{
+	SNEP_Consumer = Consumer;
 }
 
 uint8_t SNEP_RetrieveNDEF( uint8_t **pNdefMessage)
@@ -234,6 +264,8 @@ uint8_t SNEP_RetrieveNDEF( uint8_t **pNdefMessage)
 
 void Server_SNEP (void)
 {	
+	uint16_t Room;
+	
 	/* check if we have received a message */
   if(IS_IN_MESS_FLAG(SNEPServer.LLC->Flags))
   {
@@ -241,9 +273,8 @@ void Server_SNEP (void)
     
     if( NdefFileTransmissionOnGoing == true)
     {  
-      memcpy(&SNEP_Receive_Buffer[SNEPServer.Offset], &SNEPServer.LLC->InMessage[0], SNEPServer.LLC->InLength);
-			SNEPServer.Offset+=SNEPServer.LLC->InLength;
-      if(SNEPServer.Offset>=(SNEPServer.MessLen - SNEP_OFFSET_PUT_NDEF))
+      SNEP_ReceiveFragment(&SNEPServer.LLC->InMessage[0], SNEPServer.LLC->InLength);
+      if(SNEPServer.Offset>=SNEPServer.MessLen)
       {
         SNEP_SendRES(SNEP_RES_SUCCESS);		
         NdefFileTransmissionOnGoing = false;
@@ -264,8 +295,7 @@ void Server_SNEP (void)
           case SNEP_CMD_CONTINUE	:
             if(SNEPServer.Offset<SNEPServer.MessLen)
             {
-              memcpy(&SNEP_Receive_Buffer[SNEPServer.Offset], &SNEPServer.LLC->InMessage[0], SNEPServer.LLC->InLength);
-              SNEPServer.Offset+=SNEPServer.LLC->InLength;
+              SNEP_ReceiveFragment(&SNEPServer.LLC->InMessage[0], SNEPServer.LLC->InLength);
               if(SNEPServer.Offset>=SNEPServer.MessLen)
                 SNEP_SendRES(SNEP_RES_SUCCESS);		
             }
@@ -277,44 +307,38 @@ void Server_SNEP (void)
 						
           case SNEP_CMD_PUT	:		
             SNEPServer.MessLen=__REV(*((uint32_t*) &SNEPServer.LLC->InMessage[SNEP_OFFSET_LENGTH]));
+            SNEPServer.Offset=0;
 
-#ifndef SNEP_STATIC
-            if(SNEP_Receive_Buffer != NULL)
+            /* Without consumer the whole message is buffered */
+            if(SNEP_Consumer == NULL)
             {
-              free(SNEP_Receive_Buffer);
-              SNEP_Receive_Buffer = NULL;
-            }
-            SNEP_Receive_Buffer = malloc(SNEPServer.MessLen + 10);
+#ifndef SNEP_STATIC
+              if(SNEP_Receive_Buffer != NULL)
+              {
+                free(SNEP_Receive_Buffer);
+                SNEP_Receive_Buffer = NULL;
+              }
+              SNEP_Receive_Buffer = malloc(SNEPServer.MessLen + 10);
 
-            if(SNEP_Receive_Buffer == NULL)
-            {
+              if(SNEP_Receive_Buffer == NULL)
+#else
+              if(SNEPServer.MessLen>SNEP_MAX_SIZE_BUFFER)
+#endif
+              {
                 SNEP_SendRES(SNEP_RES_REJECT);
-                //while(1); /* For debug purpose */
+                break;
+              }
             }
-#endif
-            if(SNEPServer.MessLen < (SNEPServer.LLC->MIU))
+            
+            SNEP_ReceiveFragment(&SNEPServer.LLC->InMessage[SNEP_OFFSET_PUT_NDEF], SNEPServer.LLC->InLength-SNEP_OFFSET_PUT_NDEF);
+            if(SNEPServer.Offset>=SNEPServer.MessLen)
             {
               SNEP_SendRES(SNEP_RES_SUCCESS);		
-              memcpy(SNEP_Receive_Buffer, &SNEPServer.LLC->InMessage[SNEP_OFFSET_PUT_NDEF], SNEPServer.MessLen);
             }
             else
             {
-#ifdef SNEP_STATIC
-              if(SNEPServer.MessLen<=SNEP_MAX_SIZE_BUFFER)
-#endif
-              {	
-                SNEP_SendRES(SNEP_RES_CONTINUE);               
-                memcpy(SNEP_Receive_Buffer, &SNEPServer.LLC->InMessage[SNEP_OFFSET_PUT_NDEF], SNEPServer.LLC->InLength-SNEP_OFFSET_PUT_NDEF);
-                SNEPServer.Offset=SNEPServer.LLC->InLength-SNEP_OFFSET_PUT_NDEF;	
-                NdefFileTransmissionOnGoing = true;              
-              }
-#ifdef SNEP_STATIC
-              else
-              {
-                SNEP_SendRES(SNEP_RES_REJECT);
-                while(1); /* For debug purpose */
-              }	
-#endif
+              SNEP_SendRES(SNEP_RES_CONTINUE);               
+              NdefFileTransmissionOnGoing = true;              
             }
             break;
 						
@@ -355,17 +379,20 @@ void Server_SNEP (void)
 		}
 		else /* We are connected, we can send the message */
 		{
-			if( SNEPServer.MessLen <= SNEPServer.LLC->MIU) // we need to divide
+			/* First fragment, the remote server answers CONTINUE if more are needed */
+			if( SNEPServer.MessLen <= SNEPServer.LLC->MIU)
+				SNEP_SendPutCMD( SNEPServer.MessLen );
+			else
+				SNEP_SendPutCMD( SNEPServer.LLC->MIU );
+			
+			if( SNEPServer.Offset >= SNEPServer.MessLen)
 			{	
-				SNEP_SendPutCMD( SNEP_Send_Buffer, SNEPServer.MessLen);
 				SNEP_Message2SendState = SNEP_MESSAGE_SENT;
         free(SNEP_Send_Buffer);
         SNEP_Send_Buffer = NULL;
 			}
 			else
 			{
-				SNEP_SendPutCMD( SNEP_Send_Buffer, SNEPServer.LLC->MIU );
-				SNEPServer.Offset = SNEPServer.LLC->MIU;
 				SNEP_Message2SendState = SNEP_MESSAGE_SENDINGONGOING;
 				Continue = false;
 			}
@@ -373,23 +400,26 @@ void Server_SNEP (void)
 	}
 	else if( SNEP_Message2SendState == SNEP_MESSAGE_SENDINGONGOING) 
 	{
-		if( Continue )
+		/* LLCP splits the pending data in as many I PDUs as its send window allows, keep its buffer full */
+		if( IS_OUT_MESS_FLAG(SNEPServer.LLC->Flags))
+			Room = LLCP_MAX_LENGTH - SNEPServer.LLC->OutLength;
+		else
+			Room = LLCP_MAX_LENGTH;
+		
+		if( Continue && (Room > 0))
 		{	
-			if( (SNEPServer.MessLen-SNEPServer.Offset) <= SNEPServer.LLC->MIU) // this is the last
+			if( (SNEPServer.MessLen-SNEPServer.Offset) < Room)
+				Room = SNEPServer.MessLen-SNEPServer.Offset;
+			
+			SNEP_SendContinue( Room );
+			
+			if( SNEPServer.Offset >= SNEPServer.MessLen) // this is the last
 			{	
-				SNEP_SendContinue( &SNEP_Send_Buffer[SNEPServer.Offset], (SNEPServer.MessLen-SNEPServer.Offset));
 				SNEP_Message2SendState = SNEP_MESSAGE_SENT;
 				Continue = false;
         free(SNEP_Send_Buffer);
         SNEP_Send_Buffer = NULL;
 			}
-			else
-			{
-				SNEP_SendContinue( &SNEP_Send_Buffer[SNEPServer.Offset], SNEPServer.LLC->MIU );
-				SNEP_Message2SendState = SNEP_MESSAGE_SENDINGONGOING;
-				SNEPServer.Offset += SNEPServer.LLC->MIU;
-				Continue = true;
-			}
 		}			
 	}
 	else if( SNEP_Message2SendState == SNEP_MESSAGE_RECEIVED)  /* No message to send or receive check we are no more connected */ 
@@ -416,26 +446,78 @@ static uint8_t SNEP_SendGetCMD( void  )
 }
 #endif
 
-static uint8_t SNEP_SendPutCMD( uint8_t *pBuffer, uint16_t  size)
+static uint8_t SNEP_SendPutCMD( uint16_t  size)
 {	
-	SNEPServer.LLC->OutLength = size;
-	memcpy(SNEPServer.LLC->OutMessage, pBuffer, SNEPServer.LLC->OutLength );
+	SNEPServer.LLC->OutLength = SNEP_Produce( SNEPServer.LLC->OutMessage, size );
 	
 	SET_OUT_MESS_FLAG(SNEPServer.LLC->Flags);
 	
 	return LLCP_SUCCESS_CODE;
 }
 
-static uint8_t SNEP_SendContinue( uint8_t *pBuffer, uint16_t  size  )
+static uint8_t SNEP_SendContinue( uint16_t  size  )
 {
-	SNEPServer.LLC->OutLength = size;
-	memcpy(SNEPServer.LLC->OutMessage, pBuffer, SNEPServer.LLC->OutLength );
+	/* Append to the data not yet taken by LLCP */
+	if( !IS_OUT_MESS_FLAG(SNEPServer.LLC->Flags))
+		SNEPServer.LLC->OutLength = 0;
 	
-	SET_OUT_MESS_FLAG(SNEPServer.LLC->Flags);
+	SNEPServer.LLC->OutLength += SNEP_Produce( &SNEPServer.LLC->OutMessage[SNEPServer.LLC->OutLength], size );
+	
+	/* Producer may have nothing ready yet */
+	if( SNEPServer.LLC->OutLength > 0)
+		SET_OUT_MESS_FLAG(SNEPServer.LLC->Flags);
 	
 	return LLCP_SUCCESS_CODE;
 }
 
+/* Fill pBuffer with the next bytes of the PUT request: SNEP header then NDEF message from the producer */
+static uint16_t SNEP_Produce( uint8_t *pBuffer, uint16_t  size )
+{
+	uint16_t Length = 0;
+	uint16_t Produced;
+	
+	while((SNEPServer.Offset < SNEP_OFFSET_PUT_NDEF) && (Length < size))
+	{
+		pBuffer[Length++] = SNEP_PutHeader[SNEPServer.Offset++];
+	}
+	
+	if((Length < size) && (SNEPServer.Offset < SNEPServer.MessLen))
+	{
+		Produced = size - Length;
+		if((SNEPServer.MessLen - SNEPServer.Offset) < Produced)
+			Produced = SNEPServer.MessLen - SNEPServer.Offset;
+		
+		Produced = SNEP_Producer( SNEPServer.Offset - SNEP_OFFSET_PUT_NDEF, &pBuffer[Length], Produced );
+		Length += Produced;
+		SNEPServer.Offset += Produced;
+	}
+	
+	return Length;
+}
+
+/* Producer used by SNEP_SendNDEF, message has been copied in SNEP_Send_Buffer */
+static uint16_t SNEP_BufferProducer( uint32_t Offset, uint8_t *pBuffer, uint16_t size )
+{
+	memcpy( pBuffer, &SNEP_Send_Buffer[Offset], size );
+	
+	return size;
+}
+
+/* Give the received NDEF bytes to the consumer, or store them when there is none */
+static void SNEP_ReceiveFragment( uint8_t *pBuffer, uint16_t  size )
+{
+	/* Do not go beyond the length announced in the PUT request */
+	if((SNEPServer.MessLen - SNEPServer.Offset) < size)
+		size = SNEPServer.MessLen - SNEPServer.Offset;
+	
+	if(SNEP_Consumer != NULL)
+		SNEP_Consumer( SNEPServer.Offset, pBuffer, size, SNEPServer.MessLen );
+	else
+		memcpy( &SNEP_Receive_Buffer[SNEPServer.Offset], pBuffer, size );
+	
+	SNEPServer.Offset += size;
+}
+
 #if 0
 static uint8_t SNEP_SendRejectCMD( void  )
 {
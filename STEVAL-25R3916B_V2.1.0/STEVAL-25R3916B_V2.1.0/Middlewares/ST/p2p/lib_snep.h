@@ -32,6 +32,11 @@ typedef struct{
 	uint32_t Offset;
 }SNEP_Server;
 
+/* Copies up to size bytes of the NDEF message from Offset in pBuffer, returns the number of bytes copied (0 if not ready yet) */
+typedef uint16_t (*SNEP_NdefProducer)( uint32_t Offset, uint8_t *pBuffer, uint16_t size );
+/* Receives size bytes of the NDEF message at Offset, MessLen is the whole message length */
+typedef void (*SNEP_NdefConsumer)( uint32_t Offset, const uint8_t *pBuffer, uint16_t size, uint32_t MessLen );
+
 #define SERVER_SNEP_URI										"urn:nfc:sn:snep"
 #define SERVER_SNEP												0x04
 #define SNEP_SERVER_VERSION								0x10
@@ -99,6 +104,10 @@ bool SNEP_IsConnectionTerminated(void);
 /* SNEP Interface */
 uint8_t SNEP_SendNDEF( uint8_t *pNdefMessage, uint16_t size);
 uint8_t SNEP_RetrieveNDEF( uint8_t **pNdefMessage);
+
+/* Fragment interface, only LLCP_MAX_LENGTH bytes are buffered whatever the message size */
+uint8_t SNEP_SendNDEFStream( SNEP_NdefProducer Producer, uint32_t size );
+void SNEP_SetNDEFConsumer( SNEP_NdefConsumer Consumer );
 void Server_SNEP (void);
 void SNEP_Free(void);
 
@@ -51,8 +51,8 @@ typedef  void (*pFunction)(void);
 /* Define the address from where firmware will be stored. */
 #define FIRMWARE_ADDRESS        0x080A0000      /* Upgraded firmware base address */
 
-/* Last Page Address for firmware */
-#define FIRMWARE_FLASH_LAST_PAGE_ADDRESS  0x080DFFFF - 4      /* Upgraded firmware last address */
+/* Last Page Address for firmware, the two pages above hold the ST25R_PAC analog config log (0x080DF000 - 0x080DFFFF) */
+#define FIRMWARE_FLASH_LAST_PAGE_ADDRESS  0x080DEFFF - 4      /* Upgraded firmware last address */
 
 /* Define the user application size */
 #define FIRMWARE_FLASH_SIZE   (FIRMWARE_FLASH_LAST_PAGE_ADDRESS - FIRMWARE_ADDRESS + 1)     /* Upgraded firmware area size */
@@ -36,7 +36,33 @@
   */
 
 
-uint32_t jpeg_decode(const char* jpeg, uint8_t (*callback)(uint8_t* , uint32_t));
+/** @brief Number of decoded rows gathered before the output callback is called. */
+#ifndef JPEG_DECODE_STRIP_ROWS
+#define JPEG_DECODE_STRIP_ROWS    4
+#endif
+
+/** @brief IDCT used at full scale (reduced scales always use the integer scaled IDCTs). */
+#ifndef JPEG_DECODE_DCT_METHOD
+#define JPEG_DECODE_DCT_METHOD    JDCT_IFAST
+#endif
+
+/** @brief Output window of a picture, filled by the setup callback once the header has been read. */
+typedef struct
+{
+  uint32_t scale_num;       /*!< Picture is decoded at scale_num/8 of its size (1 to 8) */
+  uint32_t first_col;       /*!< First output column, in scaled pixels */
+  uint32_t first_row;       /*!< First output row, in scaled pixels */
+  uint32_t width;           /*!< Output width, in scaled pixels */
+  uint32_t height;          /*!< Output height, in scaled pixels */
+  const uint16_t *grey_lut; /*!< When not NULL, the luma is decoded only and mapped to RGB565 through this 256 entries table */
+} jpeg_window_t;
+
+/** @brief Size of a picture dimension once decoded at scale_num/8 (same rounding as the libJPEG). */
+#define JPEG_SCALED_SIZE(size, scale_num)   ((((size) * (scale_num)) + 7U) / 8U)
+
+uint32_t jpeg_decode(const char* jpeg,
+                     uint8_t (*setup)(uint32_t Width, uint32_t Height, jpeg_window_t *Window),
+                     uint8_t (*callback)(uint16_t *Pixels, uint32_t NbPixels));
 void jpeg_getsize(const char* jpeg, uint32_t* Width, uint32_t* Height);
 uint32_t jpeg_GetBufferSize( uint8_t *jpeg );
 
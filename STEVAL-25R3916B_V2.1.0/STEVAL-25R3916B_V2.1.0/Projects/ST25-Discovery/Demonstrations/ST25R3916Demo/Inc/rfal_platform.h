@@ -187,6 +187,11 @@ extern uint8_t globalCommProtectCnt;                      /* Global Protection C
   that are optimized differently for each board.
 */
 //#define RFAL_ANALOG_CONFIG_CUSTOM                         /*!< Use Custom Analog Configs when defined                                    */
+//#define RFAL_TRACE                                        /*!< Record RF transaction trace (states, IRQs, SPI, FIFO) when defined        */
+
+#ifdef RFAL_TRACE
+#define platformTrace( evt, val )                     timerTraceRecord( (evt), (val) )              /*!< Records a timestamped RF trace event        */
+#endif /* RFAL_TRACE */
 
 #ifndef platformProtectST25RIrqStatus
     #define platformProtectST25RIrqStatus()            /*!< Protect unique access to IRQ status var - IRQ disable on single thread environment (MCU) ; Mutex lock on a multi thread environment */
@@ -240,6 +245,10 @@ extern uint8_t globalCommProtectCnt;                      /* Global Protection C
     #define platformLog(...)                           /*!< Log method                                    */
 #endif /* platformLog */
 
+#ifndef platformTrace
+    #define platformTrace( evt, val )                  /*!< Records a timestamped RF trace event          */
+#endif /* platformTrace */
+
 #ifndef platformAssert
     #define platformAssert( exp )                      /*!< Asserts whether the given expression is true */
 #endif /* platformAssert */
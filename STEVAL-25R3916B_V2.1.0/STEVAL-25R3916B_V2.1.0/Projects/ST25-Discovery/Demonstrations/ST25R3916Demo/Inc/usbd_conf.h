@@ -44,7 +44,22 @@ extern "C" {
   * @{
   */
 
+/* Flash user data area exposed as a USB disk (usbd_storage.c), next to the
+   CUSTOM_HID interface of the demo in a composite device. 0: CUSTOM_HID only */
+#define USBD_MSC_DISK                               1U
+
+#if (USBD_MSC_DISK == 1U)
+#define USE_USBD_COMPOSITE
+#define USBD_MAX_SUPPORTED_CLASS                    2U
+#define USBD_MAX_NUM_INTERFACES                     2U
+#define USBD_CMPSIT_ACTIVATE_CUSTOMHID              1U
+#define USBD_CMPSIT_ACTIVATE_MSC                    1U
+#else
 #define USBD_MAX_NUM_INTERFACES                     1U
+#endif /* USBD_MSC_DISK */
+
+/* Class index of CUSTOM_HID: first class registered by MX_USB_DEVICE_Init() */
+#define USBD_CUSTOMHID_CLASS_ID                     0U
 #define USBD_MAX_NUM_CONFIGURATION                  1U
 #define USBD_MAX_STR_DESC_SIZ                       0x100U
 #define USBD_SELF_POWERED                           1U
@@ -69,6 +84,10 @@ extern "C" {
 /* #define USBD_CUSTOMHID_EP0_OUT_PREPARE_RECEIVE_DISABLED */
 /* #define USBD_CUSTOMHID_CTRL_REQ_COMPLETE_CALLBACK_ENABLED */
 
+/* MSC Class Config: endpoints 1 are used by CUSTOM_HID */
+#define MSC_EPIN_ADDR                               0x82U
+#define MSC_EPOUT_ADDR                              0x02U
+
 /* #define for FS and HS identification */
 #define DEVICE_FS 		0
 
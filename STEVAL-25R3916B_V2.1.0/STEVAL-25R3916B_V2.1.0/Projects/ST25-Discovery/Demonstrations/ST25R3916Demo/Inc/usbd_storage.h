@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @file    usbd_storage.h
+  * @author  MCD Application Team
+  * @brief   Header for usbd_storage.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2016 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_STORAGE_H
+#define __USBD_STORAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_msc.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/* MSC storage over the flash user data area, registered by usb_device.c when USBD_MSC_DISK is 1 */
+extern USBD_StorageTypeDef USBD_DISK_fops;
+
+/* Holds the MSC OUT transfer while a page waits to be written (USBD_LL_PrepareReceive) */
+uint8_t STORAGE_HoldReceive(uint8_t *pbuf, uint32_t size);
+
+/* Writes the page staged by the USB interrupt to flash: main loop */
+void STORAGE_Task(void);
+
+/* Writes the pending pages to flash, USB device stopped (e.g. before a reset) */
+int8_t STORAGE_Flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USBD_STORAGE_H */
+
+/************************ (C) COPYRIGHT 2016 STMicroelectronics *****END OF FILE****/
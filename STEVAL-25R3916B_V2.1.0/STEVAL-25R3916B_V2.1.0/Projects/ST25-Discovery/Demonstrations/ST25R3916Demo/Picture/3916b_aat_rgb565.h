@@ -0,0 +1,603 @@
+/* 227x115 RGB565 RLE picture converted from 3916b_aat_jpg.h by pict2rgb565, 19140 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char Gauge_light[] = {
+0x52, 0x35, 0x36, 0x35, 0x01, 0x00, 0xE3, 0x00, 0x73, 0x00, 0x00, 0x00, 0x5A, 0x25, 0x00, 0x00, 0x70, 0x80, 0xFF, 0xFF, 0x14, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xD4, 0x80, 0xFF, 0xFF, 0x0E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xCB, 0x80, 0xFF, 0xFF, 0x13, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xD1, 0x80, 0xFF, 0xFF, 0x12, 0x00, 0x7D, 0xEF, 0xD7, 0xBD, 0x51, 0x8C, 0xCF, 0x7B, 
+0x55, 0xAD, 0xFB, 0xDE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF7, 0xBD, 0x71, 0x8C, 0xCF, 0x7B, 0x14, 0xA5, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xCC, 0x80, 
+0xFF, 0xFF, 0x12, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xD3, 0x9C, 0xFB, 0xDE, 0x7D, 0xEF, 0x55, 0xAD, 0xB2, 0x94, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x38, 0xC6, 0xB2, 0x94, 
+0x9A, 0xD6, 0x7D, 0xEF, 0xF7, 0xBD, 0x51, 0x8C, 0x3C, 0xE7, 0xD0, 0x80, 0xFF, 0xFF, 0x12, 0x00, 0xDF, 0xFF, 0xDB, 0xDE, 0x71, 0x8C, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x92, 0x94, 
+0x79, 0xCE, 0xDF, 0xFF, 0xBE, 0xF7, 0x34, 0xA5, 0xD7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x9C, 0x38, 0xC6, 0xDF, 0xFF, 0xCF, 0x80, 0xFF, 0xFF, 0x14, 0x00, 0xDF, 0xFF, 0xFB, 0xDE, 
+0x51, 0x8C, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xB6, 0xB5, 0xB6, 0xB5, 0xFF, 0xFF, 0x5D, 0xEF, 0x92, 0x94, 0xFB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF7, 0xBD, 0x96, 0xB5, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xCE, 0x80, 0xFF, 0xFF, 0x11, 0x00, 0x1C, 0xE7, 0x51, 0x8C, 0xFB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBD, 0x96, 0xB5, 0xDF, 0xFF, 0x7D, 0xEF, 
+0x92, 0x94, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0x34, 0xA5, 0xDF, 0xFF, 0xD0, 0x80, 0xFF, 0xFF, 0x12, 0x00, 0xBE, 0xF7, 0x34, 0xA5, 0xB2, 0x94, 0xF7, 0xBD, 0xF7, 0xBD, 
+0x96, 0xB5, 0x51, 0x8C, 0xD7, 0xBD, 0xDF, 0xFF, 0x7D, 0xEF, 0x92, 0x94, 0x3C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0x55, 0xAD, 0xDF, 0xFF, 0xDF, 0xFF, 0xD0, 0x80, 0xFF, 0xFF, 
+0x10, 0x00, 0xDF, 0xFF, 0xD7, 0xBD, 0xD3, 0x9C, 0xF3, 0x9C, 0x59, 0xCE, 0x34, 0xA5, 0x38, 0xC6, 0xFF, 0xFF, 0x5D, 0xEF, 0xB2, 0x94, 0xFB, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC6, 
+0x75, 0xAD, 0xDF, 0xFF, 0xCF, 0x80, 0xFF, 0xFF, 0x13, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x71, 0x8C, 0x1C, 0xE7, 0xFF, 0xFF, 0x9E, 0xF7, 
+0x14, 0xA5, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x9C, 0xF7, 0xBD, 0xFF, 0xFF, 0xDF, 0xFF, 0xC8, 0x80, 0xFF, 0xFF, 0x19, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xDB, 0xDE, 0x14, 0xA5, 0xB6, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xBD, 0x71, 0x8C, 0x3C, 0xE7, 
+0xBE, 0xF7, 0x9A, 0xD6, 0x92, 0x94, 0xFB, 0xDE, 0xFF, 0xFF, 0xBE, 0xF7, 0xD0, 0x80, 0xFF, 0xFF, 0x1C, 0x00, 0xBA, 0xD6, 0x30, 0x84, 0x10, 0x84, 0xB2, 0x94, 0xF7, 0xBD, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x55, 0xAD, 0x71, 0x8C, 0xEF, 0x7B, 0x51, 0x8C, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xC5, 0x80, 0xFF, 0xFF, 0x1A, 0x00, 0xBE, 0xF7, 0xDB, 0xDE, 0x7D, 0xEF, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xEF, 0x3C, 0xE7, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBD, 0x80, 0xFF, 0xFF, 0x24, 0x00, 0x9E, 0xF7, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBA, 0x80, 0xFF, 0xFF, 0x27, 0x00, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFE, 0xFF, 0x9D, 0xF7, 0x1B, 0xE7, 0x9D, 0xF7, 0xFE, 0xFF, 0xDE, 0xFF, 0xB1, 0x80, 0xFF, 0xFF, 0x41, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0xFB, 0xDE, 0xFF, 0xFF, 0xBE, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0xBA, 0xD6, 
+0x1C, 0xE7, 0x7D, 0xEF, 0x1C, 0xE7, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x18, 0xC6, 0xD7, 0xBD, 0x59, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0x5D, 0xEF, 0x7D, 0xEF, 0x3C, 0xE7, 0x38, 0xC6, 
+0x9E, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xF7, 0xBD, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9B, 0x80, 0xFF, 0xFF, 0x42, 0x00, 0xBE, 0xF7, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 
+0xDB, 0xDE, 0x59, 0xCE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x9A, 0xD6, 0x38, 0xC6, 0x59, 0xCE, 0x18, 0xC6, 0xF7, 0xBD, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0x79, 0xCE, 
+0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0xD7, 0xBD, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xFB, 0xDE, 0xF7, 0xBD, 0xBE, 0xF7, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xA2, 0x80, 0xFF, 0xFF, 0x42, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x5D, 0xEF, 0xBE, 0xF7, 0xDF, 0xFF, 0x5D, 0xEF, 
+0xFB, 0xDE, 0xBA, 0xD6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0xF7, 0xBD, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0xD7, 0xBD, 0x59, 0xCE, 0x79, 0xCE, 0xBA, 0xD6, 0x3C, 0xE7, 0x7D, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0xBA, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x9C, 0x80, 0xFF, 0xFF, 0x42, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 
+0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0xBA, 0xD6, 0xF7, 0xBD, 0x7D, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xA0, 0x80, 0xFF, 0xFF, 
+0x42, 0x00, 0xBE, 0xF7, 0x9A, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0xF7, 0xBD, 0x59, 0xCE, 0x79, 0xCE, 0xDB, 0xDE, 0x5D, 0xEF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0xDB, 0xDE, 0xDF, 0xFF, 0x9F, 0x80, 0xFF, 0xFF, 0x45, 0x00, 0xBE, 0xF7, 0x38, 0xC6, 0x3C, 0xE7, 0xBA, 0xD6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x18, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x9A, 0xD6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x95, 0x80, 0xFF, 0xFF, 0x50, 0x00, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x5D, 0xEF, 0xDB, 0xDE, 0xB6, 0xB5, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 0xFB, 0xDE, 0x9E, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0x90, 0x80, 0xFF, 0xFF, 0x52, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x1C, 0xE7, 0x9A, 0xD6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 
+0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 
+0x9A, 0xD6, 0x3C, 0xE7, 0xBE, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x87, 0x80, 0xFF, 0xFF, 0x0E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 0xDB, 0xDE, 0x1C, 0xE7, 0xBA, 0xD6, 0x18, 0xC6, 0x38, 0xC6, 0x3F, 0x80, 0x59, 0xCE, 0x10, 0x00, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x9A, 0xD6, 0x3C, 0xE7, 0x79, 0xCE, 0xBE, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7C, 0x80, 0xFF, 0xFF, 0x14, 0x00, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0x9A, 0xD6, 
+0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x79, 0xCE, 0x3F, 0x80, 0x59, 0xCE, 0x16, 0x00, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x18, 0xC6, 0xF7, 0xBD, 0x5D, 0xEF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x78, 0x80, 
+0xFF, 0xFF, 0x12, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0x9E, 0xF7, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x5C, 0xEF, 0xBA, 0xD6, 0x9A, 0xD6, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x3F, 0x80, 0x59, 0xCE, 0x16, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x9A, 0xD6, 0xF7, 0xBD, 0xF7, 0xBD, 0x59, 0xCE, 0x1C, 0xE7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x78, 0x80, 
+0xFF, 0xFF, 0x0D, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x9D, 0xF7, 0xDA, 0xDE, 0xBE, 0xF7, 0x9D, 0xF7, 0x1B, 0xE7, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 
+0x44, 0x80, 0x59, 0xCE, 0x14, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x1C, 0xE7, 0xDF, 0xFF, 0xBE, 0xF7, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x7F, 0x80, 0xFF, 0xFF, 0x0D, 0x00, 0xDF, 0xFF, 0x9A, 0xD6, 0xDA, 0xDE, 0x58, 0xCE, 0x58, 0xCE, 
+0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x40, 0x80, 0x59, 0xCE, 0x14, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x18, 0xC6, 0x7D, 0xEF, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x7D, 0x80, 0xFF, 0xFF, 0x0E, 0x00, 0xDE, 0xFF, 0x5C, 0xEF, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x40, 0x80, 0x59, 0xCE, 0x12, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x18, 0xC6, 0x9A, 0xD6, 0x9E, 0xF7, 0xDF, 0xFF, 0x79, 0x80, 0xFF, 0xFF, 0x14, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBE, 0xF7, 0x7D, 0xEF, 0xFB, 0xDE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x99, 0xD6, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x79, 0xCE, 0x3F, 0x80, 0x59, 0xCE, 0x17, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 
+0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x3C, 0xE7, 0xBE, 0xF7, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x75, 0x80, 0xFF, 0xFF, 0x14, 0x00, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x5D, 0xEF, 0x79, 0xCE, 0x18, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x3F, 0x80, 0x59, 0xCE, 0x18, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x18, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x9A, 0xD6, 0x9E, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0x6E, 0x80, 0xFF, 0xFF, 0x0A, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDB, 0xDE, 0x3C, 0xE7, 0xDB, 0xDE, 0x18, 0xC6, 0x20, 0x80, 0x59, 0xCE, 
+0x4A, 0x00, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 
+0x57, 0xC6, 0x57, 0xC6, 0x57, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x59, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x58, 0xC6, 
+0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x9A, 0xD6, 0x9A, 0xD6, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x67, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0x1C, 0xE7, 0xF7, 0xBD, 0x21, 0x80, 0x59, 0xCE, 0x4E, 0x00, 0x58, 0xC6, 
+0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x19, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xCE, 
+0x39, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x37, 0xC6, 0x58, 0xCE, 0x79, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xCE, 0x39, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x64, 0x80, 0xFF, 0xFF, 
+0x0E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xDB, 0xDE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x1F, 0x80, 0x59, 0xCE, 0x4A, 0x00, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x58, 0xCE, 0x38, 0xC6, 0x37, 0xC6, 0x3A, 0xCE, 0x3A, 0xCE, 0x3A, 0xCE, 0x39, 0xCE, 0x39, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x19, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x38, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x9A, 0xD6, 0xDB, 0xDE, 0xDF, 0xFF, 0x6A, 0x80, 0xFF, 0xFF, 
+0x0C, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x79, 0xCE, 0x79, 0xCE, 0x18, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x1F, 0x80, 0x59, 0xCE, 
+0x4C, 0x00, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 
+0x79, 0xCE, 0x37, 0xC6, 0x37, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 
+0x58, 0xCE, 0x58, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x1C, 0xE7, 0x9E, 0xF7, 0xDF, 0xFF, 0x6A, 0x80, 0xFF, 0xFF, 
+0x09, 0x00, 0x5D, 0xEF, 0x9E, 0xF7, 0xFF, 0xFF, 0x1C, 0xE7, 0x79, 0xCE, 0x18, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x18, 0xC6, 0x18, 0xC6, 0x20, 0x80, 0x59, 0xCE, 0x4F, 0x00, 0x39, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 0x37, 0xC6, 0x57, 0xC6, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x57, 0xC6, 0x58, 0xC6, 
+0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xC6, 0x58, 0xCE, 0x58, 0xC6, 0x58, 0xC6, 0x59, 0xC6, 0x39, 0xC6, 0x59, 0xC6, 0x37, 0xC6, 0x37, 0xC6, 
+0x58, 0xC6, 0x58, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x9E, 0xF7, 0xBE, 0xF7, 0x1C, 0xE7, 0xDF, 0xFF, 0x63, 0x80, 0xFF, 0xFF, 
+0x0E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0x9A, 0xD6, 0xDB, 0xDE, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x20, 0x80, 0x59, 0xCE, 0x4E, 0x00, 0x58, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x58, 0xC6, 0x58, 0xC6, 0x79, 0xCE, 0x59, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x3A, 0xC6, 0x5A, 0xC6, 
+0x1A, 0xC6, 0xF9, 0xBD, 0xFC, 0xC5, 0xFC, 0xBD, 0xFC, 0xBD, 0xFB, 0xBD, 0xFB, 0xBD, 0x1B, 0xC6, 0x3B, 0xC6, 0x5B, 0xC6, 0x3B, 0xC6, 0x1B, 0xC6, 0x3B, 0xC6, 0x3A, 0xC6, 0x39, 0xC6, 0x59, 0xC6, 
+0x58, 0xC6, 0x78, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x59, 0xC6, 0x59, 0xCE, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xBA, 0xD6, 0xDF, 0xFF, 0x66, 0x80, 0xFF, 0xFF, 0x0A, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x20, 0x80, 0x59, 0xCE, 0x4E, 0x00, 0x59, 0xC6, 0x18, 0xC6, 0x19, 0xC6, 0x5A, 0xC6, 0x5B, 0xC6, 0x3B, 0xBE, 0xFA, 0xBD, 0xFA, 0xBD, 0x3A, 0xA5, 0x1A, 0xA5, 0xD9, 0x9C, 0xB8, 0x94, 0xB8, 0x9C, 
+0xF9, 0x9C, 0x1A, 0xA5, 0xFA, 0xA4, 0x99, 0x94, 0x99, 0x94, 0x99, 0x94, 0xB8, 0x94, 0xB8, 0x9C, 0xD8, 0x9C, 0xF9, 0xA4, 0x19, 0xA5, 0xB8, 0x94, 0xB8, 0x94, 0x19, 0xA5, 0x39, 0xA5, 0x99, 0xAD, 
+0xFA, 0xBD, 0x19, 0xBE, 0x5A, 0xC6, 0x1A, 0xBE, 0x3B, 0xC6, 0x5A, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 
+0x38, 0xC6, 0x1C, 0xE7, 0x66, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0xBE, 0xF7, 0xBE, 0xF7, 0xDB, 0xDE, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x38, 0xC6, 0x1F, 0x80, 0x59, 0xCE, 0x4F, 0x00, 0x3A, 0xC6, 0x1A, 0xC6, 0xFA, 0xBD, 0x9A, 0xB5, 0xD8, 0x94, 0x37, 0x84, 0x58, 0x8C, 0xDA, 0x9C, 0x39, 0xA5, 0x9A, 0xAD, 0xFB, 0xBD, 
+0xFB, 0xBD, 0x1B, 0xBE, 0x1B, 0xBE, 0x1B, 0xBE, 0x1A, 0xBE, 0x39, 0xBE, 0x3A, 0xBE, 0x3A, 0xBE, 0x3A, 0xBE, 0x3B, 0xBE, 0x1B, 0xBE, 0x1B, 0xBE, 0x1B, 0xBE, 0x1C, 0xC6, 0xDB, 0xBD, 0xDB, 0xBD, 
+0x5A, 0xAD, 0xFA, 0x9C, 0xB9, 0x9C, 0x38, 0x8C, 0x38, 0x8C, 0xF9, 0xA4, 0x9A, 0xB5, 0x1B, 0xBE, 0x3B, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0xDB, 0xDE, 0x62, 0x80, 0xFF, 0xFF, 0x86, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0x9A, 0xD6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x38, 0xC6, 0x58, 0xC6, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x5A, 0xCE, 0x39, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xCE, 
+0x38, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x5A, 0xC6, 0x1B, 0xC6, 0xBA, 0xB5, 0x7A, 0xAD, 0xFA, 0x9C, 0xD9, 0x94, 0xD8, 0x94, 0x18, 0x9D, 0x99, 0xB5, 0x1A, 0xC6, 0x3A, 0xC6, 0x39, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x58, 0xC6, 0x58, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x5A, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x9A, 0xAD, 0xF9, 0x9C, 0x98, 0x94, 0xB8, 0x94, 0x19, 0x9D, 0x79, 0xAD, 0xDA, 0xB5, 0x3B, 0xC6, 
+0x39, 0xBE, 0x79, 0xC6, 0x78, 0xC6, 0x57, 0xC6, 0x57, 0xC6, 0x78, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0xDB, 0xDE, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x56, 0x80, 
+0xFF, 0xFF, 0x8C, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xBA, 0xD6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x37, 0xC6, 0x58, 0xCE, 0x37, 0xC6, 0x38, 0xC6, 0x7A, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x58, 0xCE, 
+0x5A, 0xCE, 0x1B, 0xC6, 0x9B, 0xB5, 0xB9, 0x9C, 0x57, 0x8C, 0xD8, 0x9C, 0x9A, 0xAD, 0xD9, 0xB5, 0xFA, 0xBD, 0x3A, 0xBE, 0x5A, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xCE, 0x58, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xC6, 
+0x58, 0xC6, 0x58, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x39, 0xC6, 0x78, 0xC6, 0x59, 0xC6, 0x3A, 0xC6, 0x1B, 0xC6, 0xDB, 0xBD, 0x5A, 0xAD, 0xB8, 0x9C, 0x57, 0x8C, 0x5A, 0xA5, 
+0xBB, 0xB5, 0x3B, 0xC6, 0x7A, 0xC6, 0x59, 0xC6, 0x58, 0xC6, 0x38, 0xC6, 0x59, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 0x37, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0xBA, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x59, 0x80, 
+0xFF, 0xFF, 0x88, 0x00, 0xDF, 0xFF, 0x9E, 0xF7, 0x5D, 0xEF, 0xDB, 0xDE, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x78, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x78, 0xC6, 0x5A, 0xCE, 0x1A, 0xC6, 0xFB, 0xBD, 0x5A, 0xAD, 0xB9, 0x9C, 0xB9, 0x9C, 0x5B, 0xAD, 
+0x1C, 0xC6, 0x3B, 0xC6, 0x19, 0xBE, 0x58, 0xC6, 0x78, 0xC6, 0x79, 0xCE, 0x79, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 
+0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 
+0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x59, 0xC6, 0x5A, 0xC6, 0x3B, 0xC6, 0x1B, 0xC6, 0xFB, 0xBD, 0x19, 0xA5, 0xD8, 0x94, 0xB8, 0x94, 0x3A, 0xAD, 0xFC, 0xBD, 
+0x3B, 0xC6, 0x59, 0xC6, 0x58, 0xC6, 0x57, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x57, 0xC6, 0x78, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x1C, 0xE7, 0x9E, 0xF7, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x57, 0x80, 0xFF, 0xFF, 0x87, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0x3C, 0xE7, 0x9A, 0xD6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x58, 0xCE, 
+0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xC6, 0x79, 0xC6, 0x39, 0xC6, 0x3A, 0xC6, 0xBA, 0xB5, 0xB7, 0x94, 0xD9, 0x9C, 0x5A, 0xAD, 0xFB, 0xC5, 0x3A, 0xC6, 0x5A, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 
+0x58, 0xC6, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x59, 0xC6, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 
+0x58, 0xC6, 0x5A, 0xCE, 0x5A, 0xCE, 0x59, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xC6, 0x1A, 0xBE, 0xBB, 0xB5, 0x5A, 0xAD, 0xD9, 0x9C, 0xD8, 0x9C, 0x99, 0xAD, 
+0x3B, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x58, 0xC6, 0x58, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x19, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0xBA, 0xD6, 0x5D, 0xEF, 0x56, 0x80, 0xFF, 0xFF, 0x8D, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 
+0x9A, 0xD6, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x78, 0xCE, 0x58, 0xC6, 0x19, 0xBE, 0x9B, 0xAD, 0x99, 0x94, 0xD9, 0x9C, 0xFC, 0xBD, 0x5B, 0xCE, 0x3A, 0xC6, 0x38, 0xC6, 0x57, 0xC6, 0x56, 0xC6, 0x17, 0xC6, 0x18, 0xC6, 0x3A, 0xCE, 
+0x39, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 
+0x38, 0xC6, 0x58, 0xC6, 0x78, 0xCE, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xCE, 0x59, 0xC6, 0x39, 0xC6, 0x79, 0xC6, 0x58, 0xC6, 0x79, 0xC6, 0x59, 0xC6, 0x19, 0xBE, 0x79, 0xAD, 0xF9, 0x9C, 0x98, 0x94, 
+0x9C, 0xB5, 0x1A, 0xBE, 0x58, 0xC6, 0x58, 0xC6, 0x39, 0xC6, 0x19, 0xC6, 0x39, 0xC6, 0x99, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x1C, 0xE7, 0xBE, 0xF7, 0xDF, 0xFF, 0x55, 0x80, 0xFF, 0xFF, 0x8C, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xBA, 0xD6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xC6, 0x1A, 0xC6, 0x5A, 0xAD, 0xB9, 0x94, 0x19, 0xA5, 0xFB, 0xBD, 0x5B, 0xCE, 0x5A, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x79, 0xCE, 0x78, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x58, 0xCE, 0x78, 0xCE, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x58, 0xCE, 0x78, 0xCE, 0x79, 0xCE, 0x7A, 0xCE, 0x3B, 0xC6, 0xDB, 0xBD, 
+0xFA, 0xA4, 0xB8, 0x94, 0x9A, 0xB5, 0x5B, 0xC6, 0x18, 0xBE, 0x78, 0xCE, 0xB9, 0xD6, 0x17, 0xBE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0xFB, 0xDE, 0x9E, 0xF7, 0x54, 0x80, 0xFF, 0xFF, 0x92, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xBA, 0xD6, 
+0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x37, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x3A, 0xCE, 
+0xFA, 0xC5, 0x58, 0xAD, 0xB8, 0x94, 0x1B, 0xA5, 0xFD, 0xBD, 0x5A, 0xC6, 0x57, 0xC6, 0x57, 0xC6, 0x17, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x5A, 0xCE, 0x19, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 
+0x57, 0xC6, 0x58, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x78, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x19, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x38, 0xC6, 0x19, 0xBE, 0x1C, 0xBE, 0xB9, 0x9C, 0x77, 0x94, 0xD9, 0xBD, 0x38, 0xC6, 0xF7, 0xBD, 0x7A, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0xFB, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x4F, 0x80, 0xFF, 0xFF, 0x93, 0x00, 
+0x9E, 0xF7, 0x9E, 0xF7, 0xFF, 0xFF, 0x9E, 0xF7, 0xBA, 0xD6, 0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 
+0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x99, 0xB5, 0x18, 0xA5, 0xFA, 0xA4, 0xFA, 0xBD, 0x79, 0xC6, 0x57, 0xC6, 0x58, 0xC6, 0x3A, 0xC6, 0x3A, 0xC6, 0x39, 0xCE, 0x77, 0xCE, 
+0x57, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x5A, 0xCE, 0x59, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xC6, 0x58, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xCE, 0x39, 0xC6, 0x58, 0xCE, 
+0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 
+0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x59, 0xC6, 0x59, 0xC6, 0x59, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x59, 0xC6, 
+0x59, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x78, 0xC6, 0x58, 0xC6, 0x5A, 0xC6, 0xDC, 0xBD, 0xBA, 0x9C, 0xDA, 0x9C, 0xDA, 0xBD, 0x58, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x9A, 0xD6, 0x38, 0xC6, 0xF7, 0xBD, 0x1C, 0xE7, 0xDF, 0xFF, 
+0xBE, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0xDF, 0xFF, 0x4C, 0x80, 0xFF, 0xFF, 0x30, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xEF, 0x59, 0xCE, 0xDF, 0xFF, 0xBA, 0xD6, 0x38, 0xC6, 0x59, 0xCE, 0x18, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x5A, 0xCE, 0x38, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x3A, 0xC6, 0x1B, 0xC6, 0xD7, 0x9C, 0xD8, 0x9C, 0xDD, 0xBD, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x37, 0x80, 0x59, 0xCE, 0x2F, 0x00, 0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x3A, 0xC6, 
+0x9A, 0xBD, 0xF9, 0xA4, 0x99, 0x9C, 0xFA, 0xC5, 0x3A, 0xCE, 0x59, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xCE, 0x19, 0xC6, 0x3A, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x5D, 0xEF, 0x5D, 0xEF, 0x59, 0xCE, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x45, 0x80, 0xFF, 0xFF, 0x34, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xEF, 0xF7, 0xBD, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x36, 0xC6, 0x9A, 0xCE, 0x19, 0xC6, 0xF8, 0xBD, 0x78, 0xCE, 
+0x57, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xC6, 0x7B, 0xCE, 0x99, 0xB5, 0x97, 0x94, 0xBB, 0xB5, 0x5B, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 
+0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x37, 0x80, 0x59, 0xCE, 0x2C, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x1A, 0xC6, 0xDA, 0xBD, 0x9A, 0xB5, 0x79, 0x94, 0x5A, 0xAD, 
+0x5B, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x78, 0xCE, 0x16, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 
+0xBE, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0x4D, 0x80, 0xFF, 0xFF, 0x2F, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0x3C, 0xE7, 0xF7, 0xBD, 0x79, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x17, 0xC6, 
+0x59, 0xCE, 0x79, 0xCE, 0x18, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x78, 0xC6, 0x59, 0xC6, 0xFB, 0xBD, 0xB8, 0x94, 0x3A, 0xAD, 0x3B, 0xC6, 0x58, 0xC6, 0x36, 0xC6, 0x98, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x37, 0x80, 0x59, 0xCE, 0x2E, 0x00, 0x39, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 0x79, 0xCE, 0x5A, 0xCE, 
+0x39, 0xC6, 0xFB, 0xBD, 0x19, 0xA5, 0xD8, 0x9C, 0x1B, 0xC6, 0x39, 0xC6, 0x57, 0xC6, 0x38, 0xC6, 0x9A, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x39, 0xCE, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0xBE, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x4C, 0x80, 0xFF, 0xFF, 0x2E, 0x00, 0x3C, 0xE7, 0x59, 0xCE, 0x9A, 0xD6, 0x59, 0xCE, 0x18, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x37, 0xC6, 0x77, 0xCE, 0x57, 0xC6, 0x39, 0xC6, 0x5A, 0xCE, 0x3A, 0xC6, 0x39, 0xC6, 0xDB, 0xB5, 0xB7, 0x94, 0x9B, 0xB5, 0x3B, 0xC6, 0x58, 0xC6, 0x77, 0xC6, 
+0x78, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x37, 0x80, 0x59, 0xCE, 0x2E, 0x00, 0x39, 0xC6, 0x59, 0xCE, 0x58, 0xCE, 
+0x58, 0xC6, 0x58, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x3B, 0xC6, 0x5B, 0xAD, 0x98, 0x94, 0xFB, 0xBD, 0x3A, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x49, 0x80, 0xFF, 0xFF, 0x2D, 0x00, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0x38, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x17, 0xC6, 0x78, 0xCE, 0x58, 0xC6, 0x19, 0xC6, 0x5C, 0xCE, 
+0x19, 0xA5, 0x1A, 0xA5, 0x1A, 0xBE, 0x78, 0xC6, 0x77, 0xC6, 0x58, 0xC6, 0x19, 0xC6, 0x9A, 0xD6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x3C, 0x80, 0x59, 0xCE, 0x2C, 0x00, 
+0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x3A, 0xC6, 0x39, 0xC6, 0x3A, 0xC6, 0xFC, 0xBD, 0xB8, 0x94, 0x5A, 0xAD, 0x3A, 0xC6, 0x77, 0xC6, 0x58, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x38, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x78, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0xDB, 0xDE, 0xDF, 0xFF, 0xDF, 0xFF, 0x4B, 0x80, 0xFF, 0xFF, 0x2C, 0x00, 
+0xDF, 0xFF, 0x9A, 0xD6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x58, 0xC6, 0x99, 0xCE, 0x17, 0xBE, 0x7A, 0xCE, 0x1B, 0xC6, 0xB7, 0x94, 
+0xBB, 0xB5, 0x3B, 0xC6, 0x38, 0xC6, 0x78, 0xC6, 0x78, 0xC6, 0x39, 0xC6, 0x7B, 0xCE, 0x19, 0xC6, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x3B, 0x80, 0x59, 0xCE, 0x2F, 0x00, 
+0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x5A, 0xCE, 0x7A, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x59, 0xC6, 0x1B, 0xC6, 0xF8, 0x9C, 0x39, 0xA5, 0xFB, 0xBD, 
+0x7A, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x47, 0x80, 0xFF, 0xFF, 0x2E, 0x00, 0xDF, 0xFF, 0x7D, 0xEF, 0x3C, 0xE7, 0x38, 0xC6, 0x9A, 0xD6, 0xF7, 0xBD, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x99, 0xCE, 
+0x16, 0xBE, 0x59, 0xC6, 0xDB, 0xBD, 0xF8, 0x9C, 0xBA, 0xB5, 0x19, 0xC6, 0x57, 0xC6, 0x79, 0xCE, 0x39, 0xC6, 0x7A, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x19, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 
+0x58, 0xCE, 0x58, 0xCE, 0x3D, 0x80, 0x59, 0xCE, 0x2C, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x16, 0xBE, 0x78, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xC6, 
+0x7B, 0xCE, 0x5A, 0xAD, 0x79, 0x94, 0xD9, 0xB5, 0x3A, 0xC6, 0x5A, 0xCE, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 
+0xBE, 0xF7, 0x9E, 0xF7, 0x44, 0x80, 0xFF, 0xFF, 0x32, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x78, 0xCE, 0x38, 0xC6, 0x3A, 0xC6, 0x79, 0xAD, 0xF8, 0x9C, 0xBA, 0xB5, 0x5A, 0xC6, 0x58, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 
+0x79, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x3B, 0x80, 0x59, 0xCE, 0x2F, 0x00, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x58, 0xCE, 0x58, 0xCE, 0x37, 0xC6, 0x59, 0xCE, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xC6, 0x39, 0xC6, 0x3A, 0xC6, 0xDA, 0xBD, 0xB6, 0x94, 0xB9, 0xB5, 0x5A, 0xCE, 0x39, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x3A, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0xDF, 0xFF, 0x44, 0x80, 0xFF, 0xFF, 0x25, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0x9A, 0xD6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x39, 0xC6, 0x78, 0xCE, 0x78, 0xCE, 0x18, 0xC6, 0x58, 0xCE, 0x56, 0xCE, 0x59, 0xC6, 0x3A, 0xC6, 0x5A, 0xAD, 0x1A, 0xA5, 
+0xFB, 0xC5, 0x78, 0xCE, 0x37, 0xC6, 0x39, 0xCE, 0x57, 0x80, 0x59, 0xCE, 0x25, 0x00, 0xDC, 0xBD, 0xD8, 0x9C, 0x99, 0xAD, 0x5A, 0xC6, 0x59, 0xC6, 0x5A, 0xC6, 0x18, 0xC6, 0x57, 0xC6, 0x79, 0xC6, 
+0x59, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x5A, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3E, 0x80, 0xFF, 0xFF, 0x25, 0x00, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0xD7, 0xBD, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0xF7, 0xBD, 0x58, 0xCE, 0x58, 0xCE, 0x17, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x3A, 0xC6, 0x39, 0xA5, 
+0x39, 0xAD, 0x1A, 0xBE, 0x59, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x57, 0x80, 0x59, 0xCE, 0x26, 0x00, 0x39, 0xC6, 0xFB, 0xBD, 0x97, 0x94, 0x9B, 0xB5, 0x3A, 0xC6, 0x37, 0xBE, 0x99, 0xCE, 
+0x39, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x59, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x3E, 0x80, 0xFF, 0xFF, 0x24, 0x00, 0xDF, 0xFF, 0x7D, 0xEF, 0x59, 0xCE, 0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xC6, 0x37, 0xC6, 0x79, 0xCE, 0x39, 0xCE, 0x38, 0xCE, 0x37, 0xC6, 0x9A, 0xCE, 0xFB, 0xBD, 
+0x5A, 0xAD, 0x39, 0xA5, 0xFA, 0xBD, 0x99, 0xCE, 0x37, 0xC6, 0x38, 0xC6, 0x7A, 0xCE, 0x38, 0xC6, 0x57, 0x80, 0x59, 0xCE, 0x20, 0x00, 0x57, 0xC6, 0x59, 0xCE, 0xDC, 0xBD, 0x78, 0x94, 0x9A, 0xB5, 
+0x79, 0xCE, 0x37, 0xBE, 0x5A, 0xC6, 0x59, 0xCE, 0x39, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x9A, 0xD6, 0xBE, 0xF7, 0x42, 0x80, 0xFF, 0xFF, 0x26, 0x00, 0xDF, 0xFF, 
+0xDF, 0xFF, 0x9E, 0xF7, 0x9A, 0xD6, 0x18, 0xC6, 0x79, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x17, 0xBE, 0x79, 0xCE, 0x38, 0xCE, 0x39, 0xCE, 0x58, 0xCE, 0x58, 0xC6, 0x3A, 0xC6, 0x7A, 0xAD, 0x3A, 0xAD, 0x1A, 0xC6, 
+0x99, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x39, 0xC6, 0x57, 0x80, 0x59, 0xCE, 0x26, 0x00, 0x38, 0xC6, 0x58, 0xCE, 0x7A, 0xCE, 0xDB, 0xBD, 0x98, 0x94, 0xBA, 0xB5, 0x3A, 0xC6, 
+0x59, 0xC6, 0x39, 0xCE, 0x38, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0xFB, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x3B, 0x80, 0xFF, 0xFF, 0x26, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x78, 0xCE, 0x59, 0xCE, 0x19, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 
+0x7B, 0xCE, 0x38, 0xA5, 0x39, 0xA5, 0xFB, 0xC5, 0x79, 0xCE, 0x57, 0xC6, 0x17, 0xC6, 0x7A, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0x80, 0x59, 0xCE, 0x22, 0x00, 0x38, 0xC6, 0x37, 0xC6, 0x79, 0xCE, 
+0x1B, 0xC6, 0x78, 0x94, 0x9A, 0xB5, 0x7A, 0xC6, 0x39, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x3E, 0x80, 0xFF, 0xFF, 0x27, 0x00, 0x7D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x77, 0xCE, 0x39, 0xC6, 0x3A, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 
+0x79, 0xAD, 0x38, 0xAD, 0xD9, 0xBD, 0x58, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x1A, 0xC6, 0x39, 0xC6, 0x58, 0xCE, 0x57, 0x80, 0x59, 0xCE, 0x24, 0x00, 0x38, 0xC6, 0x59, 0xCE, 
+0x18, 0xC6, 0x57, 0xCE, 0x7A, 0xCE, 0xDA, 0xBD, 0x97, 0x94, 0x99, 0xAD, 0x5A, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x5A, 0xCE, 0x39, 0xC6, 0x39, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0xDB, 0xDE, 
+0x5D, 0xEF, 0x5D, 0xEF, 0xDF, 0xFF, 0x3D, 0x80, 0xFF, 0xFF, 0x27, 0x00, 0xBE, 0xF7, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x79, 0xCE, 0x19, 0xBE, 0xDA, 0xBD, 0xF7, 0x9C, 0x1B, 0xC6, 0x5A, 0xCE, 0x37, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x58, 0xCE, 0x18, 0xC6, 0x39, 0xC6, 0x5A, 0xCE, 0x58, 0xCE, 0x57, 0x80, 0x59, 0xCE, 
+0x24, 0x00, 0x57, 0xC6, 0x18, 0xC6, 0x7A, 0xCE, 0x38, 0xC6, 0x37, 0xC6, 0x59, 0xC6, 0xFB, 0xBD, 0x77, 0x94, 0xDA, 0xB5, 0x5B, 0xC6, 0x59, 0xC6, 0x37, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0xFB, 0xDE, 0xBE, 0xF7, 0x3E, 0x80, 0xFF, 0xFF, 0x26, 0x00, 0x7D, 0xEF, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x39, 0xCE, 0x57, 0xC6, 0x78, 0xC6, 0xFA, 0xBD, 0xD8, 0x94, 0xDB, 0xBD, 0x39, 0xC6, 0x38, 0xCE, 0x39, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x57, 0xCE, 0x58, 0xC6, 0x39, 0xC6, 
+0x57, 0x80, 0x59, 0xCE, 0x26, 0x00, 0x58, 0xC6, 0x58, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x3A, 0xC6, 0xBD, 0xBD, 0x77, 0x8C, 0xDA, 0xB5, 0x7A, 0xCE, 0x37, 0xC6, 0x58, 0xCE, 
+0x59, 0xCE, 0x18, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x9A, 0xD6, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x37, 0x80, 0xFF, 0xFF, 0x23, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xBE, 0xF7, 0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x58, 0xCE, 0x79, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xC6, 0x58, 0xCE, 0x39, 0xC6, 0x3C, 0xC6, 0x98, 0x94, 0xFA, 0xBD, 0x58, 0xC6, 0x57, 0xC6, 
+0x39, 0xC6, 0x5F, 0x80, 0x59, 0xCE, 0x26, 0x00, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x99, 0xB5, 0xB9, 0x9C, 0x1C, 0xC6, 0x78, 0xC6, 
+0x78, 0xC6, 0x59, 0xC6, 0x59, 0xCE, 0x38, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3B, 0x80, 0xFF, 0xFF, 0x1E, 0x00, 0x1C, 0xE7, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x79, 0xCE, 0x17, 0xC6, 0x58, 0xC6, 0x79, 0xCE, 0x39, 0xC6, 0x38, 0xC6, 0x5B, 0xCE, 0xB7, 0x9C, 0x9A, 0xB5, 0x3A, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x60, 0x80, 0x59, 0xCE, 0x24, 0x00, 
+0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x3A, 0xC6, 0xF8, 0xA4, 0x1A, 0xA5, 0x3A, 0xC6, 0x58, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x38, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x38, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x7D, 0xEF, 0x3A, 0x80, 0xFF, 0xFF, 0x22, 0x00, 0xBE, 0xF7, 0xDF, 0xFF, 0x9E, 0xF7, 0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x58, 0xCE, 0x79, 0xCE, 0x39, 0xC6, 0x5A, 0xC6, 0x7A, 0xAD, 0x19, 0xA5, 0x3A, 0xC6, 0x59, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x58, 0xCE, 0x5F, 0x80, 0x59, 0xCE, 0x27, 0x00, 0x58, 0xCE, 0x58, 0xCE, 
+0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x5A, 0xCE, 0x3A, 0xC6, 0x98, 0x94, 0x9B, 0xB5, 0x39, 0xC6, 0x78, 0xCE, 0x19, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x18, 0xC6, 0xDB, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x39, 0x80, 0xFF, 0xFF, 0x20, 0x00, 0x3C, 0xE7, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xC6, 0x59, 0xCE, 0x39, 0xC6, 0x18, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 
+0x59, 0xC6, 0x5A, 0xCE, 0xBA, 0xB5, 0xD8, 0x9C, 0x3C, 0xC6, 0x39, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x39, 0xCE, 0x38, 0xCE, 0x5F, 0x80, 0x59, 0xCE, 0x25, 0x00, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 
+0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0xFC, 0xC5, 0x77, 0x94, 0x1B, 0xBE, 0x39, 0xC6, 0x7A, 0xCE, 0x37, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x18, 0xC6, 0x79, 0xCE, 0x7D, 0xEF, 0x39, 0x80, 0xFF, 0xFF, 0x21, 0x00, 0xDF, 0xFF, 0x7D, 0xEF, 0x9A, 0xD6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x18, 0xBE, 0x5A, 0xCE, 
+0xFA, 0xBD, 0xD8, 0x9C, 0xDA, 0xBD, 0x3A, 0xC6, 0x39, 0xC6, 0x58, 0xCE, 0x57, 0xC6, 0x38, 0xC6, 0x64, 0x80, 0x59, 0xCE, 0x22, 0x00, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xC6, 
+0x19, 0xC6, 0x5A, 0xC6, 0xDA, 0xBD, 0x36, 0x84, 0x5D, 0xCE, 0x38, 0xC6, 0x57, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x1C, 0xE7, 0x7D, 0xEF, 0x37, 0x80, 0xFF, 0xFF, 
+0x22, 0x00, 0xDF, 0xFF, 0x3C, 0xE7, 0x79, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xC6, 0x5B, 0xC6, 0x18, 0xA5, 0x5A, 0xAD, 0x7B, 0xCE, 0x38, 0xC6, 
+0x59, 0xC6, 0x39, 0xC6, 0x37, 0xC6, 0x58, 0xCE, 0x38, 0x80, 0x59, 0xCE, 0x07, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x23, 0x80, 
+0x59, 0xCE, 0x23, 0x00, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x5A, 0xCE, 0x38, 0xC6, 0x7A, 0xCE, 0xF9, 0x9C, 0xD9, 0x9C, 0x5A, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x5D, 0xEF, 0x33, 0x80, 0xFF, 0xFF, 0x26, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0x59, 0xCE, 0x79, 0xCE, 
+0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x78, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x7B, 0xCE, 0x99, 0xB5, 0x18, 0x9D, 0x5B, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x78, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x63, 0x80, 0x59, 0xCE, 0x23, 0x00, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x37, 0xCE, 0x9A, 0xD6, 0x18, 0xC6, 0x38, 0xBE, 0x7C, 0xCE, 0x37, 0x8C, 0xDC, 0xBD, 0x5A, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x9A, 0xD6, 0xDF, 0xFF, 0x35, 0x80, 0xFF, 0xFF, 0x24, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x37, 0xC6, 
+0x78, 0xCE, 0x79, 0xCE, 0x38, 0xC6, 0x7A, 0xCE, 0x1A, 0xC6, 0x96, 0x94, 0xDD, 0xBD, 0x58, 0xC6, 0x59, 0xC6, 0x17, 0xC6, 0x78, 0xCE, 0x38, 0xC6, 0x5B, 0xCE, 0x19, 0xC6, 0x77, 0xC6, 0x63, 0x80, 
+0x59, 0xCE, 0x23, 0x00, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x57, 0xCE, 0x18, 0xC6, 0x5A, 0xCE, 0x79, 0xC6, 0x18, 0xBE, 0x9B, 0xB5, 0xBA, 0x9C, 0x1A, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0xBE, 0xF7, 0x33, 0x80, 0xFF, 0xFF, 0x1E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x59, 0xCE, 0x9A, 0xD6, 0x18, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x39, 0xCE, 0x57, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 0x5A, 0xCE, 0x19, 0xA5, 0x5A, 0xAD, 0x58, 0xC6, 0x6F, 0x80, 0x59, 0xCE, 0x26, 0x00, 0x37, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x17, 0xC6, 0x58, 0xCE, 
+0x5A, 0xC6, 0x76, 0x8C, 0x5C, 0xA5, 0x99, 0xCE, 0xF9, 0xBD, 0x7A, 0xCE, 0x58, 0xCE, 0xF8, 0xC5, 0x59, 0xCE, 0x78, 0xCE, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0xFB, 0xDE, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0x2B, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x38, 0xC6, 0x18, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xC6, 
+0x59, 0xC6, 0xFB, 0xBD, 0xF8, 0x9C, 0x3B, 0xC6, 0x38, 0xC6, 0x6F, 0x80, 0x59, 0xCE, 0x24, 0x00, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x37, 0xC6, 0x7A, 0xCE, 0x1B, 0xBE, 0x37, 0x84, 
+0xD9, 0xB5, 0x7A, 0xC6, 0x38, 0xC6, 0x39, 0xCE, 0x39, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x9A, 0xD6, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x2E, 0x80, 0xFF, 0xFF, 0x1E, 0x00, 
+0xBE, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0xDB, 0xDE, 0x9A, 0xD6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x37, 0xC6, 0x79, 0xCE, 0x37, 0xC6, 0x5A, 0xCE, 0x19, 0xA5, 0x79, 0xAD, 0x79, 0xCE, 0x39, 0xC6, 0x6F, 0x80, 
+0x59, 0xCE, 0x22, 0x00, 0x58, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x18, 0xBE, 0x9C, 0xCE, 0xF8, 0x9C, 0xD9, 0x9C, 0x7A, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0x78, 0xCE, 0x38, 0xC6, 
+0x39, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0xBE, 0xF7, 0xDE, 0xFF, 0x9D, 0xF7, 0x2F, 0x80, 0xFF, 0xFF, 0x1E, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xBE, 0xF7, 0x79, 0xCE, 0xF7, 0xBD, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x38, 0xC6, 0x38, 0xC6, 0x39, 0xC6, 0xBA, 0xB5, 0xD9, 0x9C, 0x3B, 0xC6, 0x37, 0xC6, 0x70, 0x80, 0x59, 0xCE, 0x23, 0x00, 0x38, 0xC6, 0x59, 0xCE, 0x58, 0xCE, 0x17, 0xC6, 0x79, 0xCE, 0x17, 0xBE, 
+0x3A, 0xC6, 0x5C, 0xC6, 0x58, 0x8C, 0xDA, 0xB5, 0x7A, 0xC6, 0x58, 0xCE, 0x57, 0xC6, 0x58, 0xCE, 0x39, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x99, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x2E, 0x80, 0xFF, 0xFF, 
+0x1F, 0x00, 0x9E, 0xF7, 0x18, 0xC6, 0x1C, 0xE7, 0x1C, 0xE7, 0x59, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x58, 0xC6, 0x37, 0xBE, 0x5B, 0xC6, 0xB8, 0x94, 0xBA, 0xB5, 0x5A, 0xC6, 0x17, 0xBE, 
+0x78, 0xCE, 0x70, 0x80, 0x59, 0xCE, 0x25, 0x00, 0x38, 0xC6, 0x79, 0xCE, 0x58, 0xC6, 0x58, 0xCE, 0x79, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x19, 0x9D, 0xB9, 0x94, 0x3C, 0xC6, 0x77, 0xCE, 0x37, 0xC6, 
+0x5A, 0xCE, 0x39, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x5C, 0xEF, 0x99, 0xD6, 0x58, 0xCE, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x2C, 0x80, 0xFF, 0xFF, 0x1E, 0x00, 0xDF, 0xFF, 0x9A, 0xD6, 0x96, 0xB5, 
+0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xC6, 0x59, 0xC6, 0x9A, 0xB5, 0xD9, 0x9C, 0x5B, 0xC6, 0x59, 0xC6, 0x38, 0xC6, 0x78, 0xCE, 0x71, 0x80, 0x59, 0xCE, 0x23, 0x00, 0x38, 0xC6, 
+0x78, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x3B, 0xBE, 0x59, 0x8C, 0x7B, 0xAD, 0x78, 0xC6, 0x37, 0xC6, 0x5A, 0xCE, 0x18, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0xD6, 0xBD, 0x1B, 0xE7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x2C, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x38, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x78, 0xC6, 0x5B, 0xC6, 
+0xD8, 0x9C, 0xBA, 0xB5, 0x5A, 0xC6, 0x79, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x6F, 0x80, 0x59, 0xCE, 0x27, 0x00, 0x38, 0xC6, 0x79, 0xCE, 0x18, 0xC6, 0x58, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x99, 0xCE, 0x9B, 0xCE, 0x1A, 0xA5, 0xB9, 0x94, 0x3A, 0xC6, 0x57, 0xC6, 0x59, 0xCE, 0x19, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x58, 0xCE, 0xBA, 0xD6, 0xBE, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 
+0xDF, 0xFF, 0x2C, 0x80, 0xFF, 0xFF, 0x1D, 0x00, 0x1C, 0xE7, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x78, 0xC6, 0xBB, 0xB5, 0xD8, 0x94, 0x3A, 0xC6, 0x59, 0xC6, 0x38, 0xC6, 
+0x78, 0xC6, 0x39, 0xC6, 0x70, 0x80, 0x59, 0xCE, 0x23, 0x00, 0x38, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x39, 0xC6, 0x79, 0xCE, 0x37, 0xC6, 0x37, 0xC6, 0x59, 0xC6, 0x1B, 0xBE, 0x58, 0x8C, 0xFC, 0xBD, 
+0x57, 0xC6, 0x78, 0xCE, 0x39, 0xC6, 0x39, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x2D, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x58, 0xCE, 0x9A, 0xC6, 0x97, 0x94, 0xBC, 0xB5, 0x59, 0xC6, 0x77, 0xCE, 0x38, 0xC6, 0x3A, 0xC6, 0x58, 0xC6, 0x4B, 0x80, 0x59, 0xCE, 0x03, 0x00, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x27, 0x80, 0x59, 0xCE, 0x1F, 0x00, 0x58, 0xCE, 0x57, 0xC6, 0xDA, 0x94, 0x1B, 0xA5, 0x59, 0xC6, 0x59, 0xCE, 0x39, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 
+0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x2B, 0x80, 0xFF, 0xFF, 0x1E, 0x00, 0x7D, 0xEF, 0x59, 0xCE, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 
+0xD9, 0xB5, 0xD8, 0x9C, 0xDB, 0xBD, 0x59, 0xC6, 0x57, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x58, 0xC6, 0x4B, 0x80, 0x59, 0xCE, 0x03, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x27, 0x80, 
+0x59, 0xCE, 0x1A, 0x00, 0x18, 0xC6, 0x78, 0xC6, 0xDC, 0xB5, 0xF6, 0x7B, 0x3B, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x2E, 0x80, 0xFF, 0xFF, 0x20, 0x00, 
+0xDF, 0xFF, 0xBE, 0xF7, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x38, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x58, 0xCE, 0x59, 0xCE, 0x39, 0xC6, 0x3A, 0xA5, 0x79, 0xAD, 0x3A, 0xC6, 0x59, 0xC6, 0x38, 0xC6, 0x59, 0xC6, 0x59, 0xCE, 
+0x38, 0xC6, 0x4B, 0x80, 0x59, 0xCE, 0x03, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x27, 0x80, 0x59, 0xCE, 0x1E, 0x00, 0x38, 0xC6, 0x59, 0xC6, 0x7B, 0xC6, 0x77, 0x8C, 0x19, 0xA5, 
+0x3A, 0xC6, 0x59, 0xCE, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0xDB, 0xDE, 0x1C, 0xE7, 0x38, 0xC6, 0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x2A, 0x80, 0xFF, 0xFF, 0x20, 0x00, 0xDF, 0xFF, 0xBE, 0xF7, 0x79, 0xCE, 
+0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x5D, 0xEF, 0x9A, 0xD6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x79, 0xC6, 0x58, 0xC6, 
+0x18, 0xC6, 0x58, 0xCE, 0x58, 0xCE, 0x37, 0xC6, 0x39, 0xC6, 0x3A, 0xC6, 0xDA, 0x9C, 0xFA, 0xBD, 0x79, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 0x4B, 0x80, 0x59, 0xCE, 
+0x03, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x27, 0x80, 0x59, 0xCE, 0x1C, 0x00, 0x58, 0xCE, 0x5A, 0xCE, 0x78, 0xC6, 0xDB, 0xB5, 0x18, 0x8C, 0x5B, 0xCE, 0x38, 0xC6, 0x58, 0xC6, 
+0x18, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0xDB, 0xDE, 0x5D, 0xEF, 0xBE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0xBA, 0xD6, 0xBE, 0xF7, 0x2C, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xDF, 0xFF, 0xBA, 0xD6, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xBE, 0xF7, 0x5D, 0xEF, 0xBA, 0xD6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x37, 0xC6, 0x38, 0xC6, 0x5A, 0xCE, 
+0xFA, 0xBD, 0xDA, 0x9C, 0x1A, 0xC6, 0x57, 0xC6, 0x58, 0xC6, 0x39, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 0x4C, 0x80, 0x59, 0xCE, 0x03, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x27, 0x80, 
+0x59, 0xCE, 0x1F, 0x00, 0x58, 0xC6, 0x5A, 0xCE, 0x77, 0xCE, 0x3B, 0xC6, 0x9A, 0x94, 0xBA, 0xB5, 0x39, 0xC6, 0x58, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x9A, 0xD6, 0x1C, 0xE7, 0x7D, 0xEF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xB6, 0xB5, 0x3C, 0xE7, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0x29, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xDF, 0xFF, 0x1C, 0xE7, 0x9A, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x1C, 0xE7, 0x9A, 0xD6, 0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x39, 0xC6, 0x18, 0xC6, 0x37, 0xC6, 0x79, 0xCE, 0x3A, 0xC6, 0xF8, 0x9C, 0x7A, 0xAD, 0x39, 0xC6, 
+0x57, 0xC6, 0x58, 0xC6, 0x39, 0xC6, 0x58, 0xCE, 0x37, 0xC6, 0x4C, 0x80, 0x59, 0xCE, 0x03, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x27, 0x80, 0x59, 0xCE, 0x1C, 0x00, 0x58, 0xCE, 
+0x19, 0xC6, 0x78, 0xCE, 0x59, 0xC6, 0x1A, 0x9D, 0xD9, 0x9C, 0x7B, 0xCE, 0x37, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x9A, 0xD6, 0xDB, 0xDE, 0x1C, 0xE7, 0x9E, 0xF7, 
+0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0x3C, 0xE7, 0x2D, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xBA, 0xD6, 
+0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0xFA, 0xDE, 
+0xBB, 0xD6, 0x7A, 0xCE, 0x59, 0xCE, 0x58, 0xCE, 0x79, 0xCE, 0xDA, 0xB5, 0x57, 0x8C, 0x1A, 0xC6, 0x59, 0xC6, 0x78, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 0x59, 0xC6, 0x4B, 0x80, 
+0x59, 0xCE, 0x03, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x27, 0x80, 0x59, 0xCE, 0x1E, 0x00, 0x58, 0xCE, 0x18, 0xC6, 0x39, 0xCE, 0x99, 0xCE, 0x79, 0xAD, 0x58, 0x84, 0x5C, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x9A, 0xD6, 0xDB, 0xDE, 0x1C, 0xE7, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0x1C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0x2B, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x18, 0xC6, 0x9E, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0x7E, 0xF7, 0x5D, 0xEF, 0xDA, 0xD6, 
+0x59, 0xC6, 0xFA, 0xB5, 0xFA, 0x9C, 0x59, 0xC6, 0x38, 0xC6, 0x58, 0xCE, 0x38, 0xC6, 0x37, 0xC6, 0x58, 0xCE, 0x58, 0xC6, 0x39, 0xC6, 0x4B, 0x80, 0x59, 0xCE, 0x03, 0x00, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x27, 0x80, 0x59, 0xCE, 0x1C, 0x00, 0x37, 0xC6, 0x58, 0xCE, 0x1A, 0xCE, 0x57, 0xC6, 0x5A, 0xC6, 0x18, 0x7C, 0x9A, 0xAD, 0x9A, 0xD6, 0x1C, 0xE7, 0x5D, 0xEF, 0xBE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x5D, 0xEF, 0xFB, 0xDE, 0x27, 0x80, 0xFF, 0xFF, 0x31, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xBD, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0x7E, 0xEF, 0x5A, 0xCE, 0x5A, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x23, 0x80, 0x59, 0xCE, 0x66, 0x00, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x79, 0xCE, 0x58, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x7A, 0xCE, 0x7A, 0xCE, 0x18, 0xC6, 0x9A, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0xDB, 0xDE, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x2A, 0x80, 0xFF, 0xFF, 0x30, 0x00, 0x3C, 0xE7, 0x9A, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0x7D, 0xEF, 0x1C, 0xE7, 
+0xBA, 0xD6, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x20, 0x80, 0x59, 0xCE, 0x63, 0x00, 0x38, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0x79, 0xCE, 
+0xDB, 0xDE, 0x3C, 0xE7, 0x9E, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBD, 0x27, 0x80, 0xFF, 0xFF, 0x35, 0x00, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xCE, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x9E, 0xF7, 0x1C, 0xE7, 0xBA, 0xD6, 0x79, 0xCE, 0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x1F, 0x80, 0x59, 0xCE, 0x66, 0x00, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x9A, 0xD6, 0xFB, 0xDE, 0x3C, 0xE7, 
+0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC6, 0xDF, 0xFF, 0xDF, 0xFF, 0x23, 0x80, 
+0xFF, 0xFF, 0x34, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x22, 0x80, 0x59, 0xCE, 0x67, 0x00, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x79, 0xCE, 0xBA, 0xD6, 0xFB, 0xDE, 0x3C, 0xE7, 0x9E, 0xF7, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xCE, 0x7D, 0xEF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0x24, 0x80, 0xFF, 0xFF, 0x35, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0x38, 0xC6, 0x96, 0xB5, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x5D, 0xEF, 0xDB, 0xDE, 
+0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x1F, 0x80, 0x59, 0xCE, 0x67, 0x00, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x9A, 0xD6, 0x1C, 0xE7, 0x5D, 0xEF, 
+0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBE, 0xF7, 0xFF, 0xFF, 0x7D, 0xEF, 0x55, 0xAD, 0x18, 0xC6, 0x9E, 0xF7, 0x22, 0x80, 0xFF, 0xFF, 0x37, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x1C, 0xE7, 
+0x59, 0xCE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0x79, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x1F, 0x80, 0x59, 0xCE, 0x14, 0x00, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0xB6, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x55, 0xAD, 0x55, 0xAD, 
+0x75, 0xAD, 0xB6, 0xB5, 0xF7, 0xBD, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x1F, 0x80, 0x59, 0xCE, 0x32, 0x00, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0xBA, 0xD6, 0x1C, 0xE7, 0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x96, 0xB5, 0xBE, 0xF7, 0x9E, 0xF7, 0x25, 0x80, 
+0xFF, 0xFF, 0x31, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x7D, 0xEF, 0x1C, 0xE7, 0xBA, 0xD6, 0x79, 0xCE, 0x24, 0x80, 0x59, 0xCE, 0x64, 0x00, 0x18, 0xC6, 0x96, 0xB5, 0x14, 0xA5, 0x92, 0x94, 0x30, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 
+0xCF, 0x7B, 0xEF, 0x7B, 0x51, 0x8C, 0x92, 0x94, 0xD3, 0x9C, 0xD7, 0xBD, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0xDB, 0xDE, 0x3C, 0xE7, 
+0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBD, 0xDF, 0xFF, 0x24, 0x80, 0xFF, 0xFF, 0x36, 0x00, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0xBA, 0xD6, 0x79, 0xCE, 0x20, 0x80, 0x59, 0xCE, 0x91, 0x00, 0xF7, 0xBD, 0x14, 0xA5, 0x51, 0x8C, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 
+0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0xEF, 0x7B, 0xD3, 0x9C, 0xB6, 0xB5, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x9A, 0xD6, 0xFB, 0xDE, 0x5D, 0xEF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBD, 0x9E, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x7D, 0xEF, 0x2D, 0x80, 0xFF, 0xFF, 0x57, 0x00, 0xDF, 0xFF, 0xBE, 0xF7, 
+0x5D, 0xEF, 0xFB, 0xDE, 0x9A, 0xD6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0x75, 0xAD, 0x92, 0x94, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 
+0xEF, 0x7B, 0x10, 0x84, 0x30, 0x84, 0x14, 0xA5, 0x38, 0xC6, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 
+0x38, 0xC6, 0x79, 0xCE, 0xBA, 0xD6, 0x1C, 0xE7, 0x7D, 0xEF, 0xBE, 0xF7, 0x2E, 0x80, 0xFF, 0xFF, 0x2D, 0x00, 0xBA, 0xD6, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDB, 0xDE, 0x7D, 0xEF, 0x2E, 0x80, 0xFF, 0xFF, 0x54, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0x1C, 0xE7, 
+0x9A, 0xD6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0x18, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x55, 0xAD, 0x51, 0x8C, 0x10, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 
+0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0x30, 0x84, 0xF3, 0x9C, 
+0xD7, 0xBD, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0x7D, 0xEF, 0x9E, 0xF7, 0xBE, 0xF7, 0xDF, 0xFF, 0x2B, 0x80, 
+0xFF, 0xFF, 0x32, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0x3C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0x9E, 0xF7, 0x31, 0x80, 0xFF, 0xFF, 0x4C, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0x3C, 0xE7, 0xBA, 0xD6, 0x9A, 0xD6, 
+0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 
+0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x75, 0xAD, 0x30, 0x84, 0xCF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 
+0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0xCF, 0x7B, 0x10, 0x84, 0x14, 0xA5, 0x18, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 
+0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 
+0x79, 0xCE, 0x9A, 0xD6, 0xDB, 0xDE, 0x3C, 0xE7, 0xBE, 0xF7, 0x35, 0x80, 0xFF, 0xFF, 0x09, 0x00, 0x5D, 0xEF, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0x1F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0x79, 0xCE, 0xDF, 0xFF, 0x38, 0x80, 0xFF, 0xFF, 0x42, 0x00, 0xBE, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0x79, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 
+0xB6, 0xB5, 0x51, 0x8C, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 
+0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0x30, 0x84, 0x34, 0xA5, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x9A, 0xD6, 0xFB, 0xDE, 0x7D, 0xEF, 0xDF, 0xFF, 0x38, 0x80, 
+0xFF, 0xFF, 0x2D, 0x00, 0x9E, 0xF7, 0xBA, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x5D, 0xEF, 0xB6, 0xB5, 0xDF, 0xFF, 
+0x3B, 0x80, 0xFF, 0xFF, 0x3B, 0x00, 0xBE, 0xF7, 0x5D, 0xEF, 0xDB, 0xDE, 0x9A, 0xD6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 
+0x59, 0xCE, 0x59, 0xCE, 0x18, 0xC6, 0x38, 0xC6, 0x92, 0x94, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 
+0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0xEF, 0x7B, 0xAE, 0x73, 0x51, 0x8C, 0xB6, 0xB5, 0x59, 0xCE, 
+0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0xBA, 0xD6, 0x3C, 0xE7, 0x7D, 0xEF, 0x3C, 0x80, 
+0xFF, 0xFF, 0x2D, 0x00, 0x9E, 0xF7, 0x18, 0xC6, 0x3C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 0x96, 0xB5, 0xDF, 0xFF, 
+0x31, 0x80, 0xFF, 0xFF, 0x46, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x7D, 0xEF, 0x1C, 0xE7, 0xBA, 0xD6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x34, 0xA5, 0x10, 0x84, 0x30, 0x84, 
+0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 
+0x10, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x30, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0xB2, 0x94, 0x38, 0xC6, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x18, 0xC6, 0x38, 0xC6, 
+0x59, 0xCE, 0x38, 0xC6, 0x79, 0xCE, 0xFB, 0xDE, 0x5D, 0xEF, 0x9E, 0xF7, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3A, 0x80, 0xFF, 0xFF, 0x2D, 0x00, 0xDF, 0xFF, 0x9E, 0xF7, 0x38, 0xC6, 
+0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x7D, 0xEF, 0x9E, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x38, 0xC6, 0x34, 0x80, 0xFF, 0xFF, 0x3E, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0x3C, 0xE7, 0xDB, 0xDE, 
+0x79, 0xCE, 0x38, 0xC6, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x51, 0x8C, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 
+0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x30, 0x84, 0x10, 0x84, 
+0xEF, 0x7B, 0x10, 0x84, 0x96, 0xB5, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x59, 0xCE, 0x59, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0x7D, 0xEF, 0x9E, 0xF7, 0xDF, 0xFF, 0x40, 0x80, 0xFF, 0xFF, 0x2D, 0x00, 
+0xDF, 0xFF, 0xBE, 0xF7, 0xBA, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x71, 0x8C, 0xFB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0xD7, 0xBD, 0x30, 0x84, 0xAE, 0x73, 0x92, 0x94, 0xB6, 0xB5, 0xBE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x38, 0xC6, 0x71, 0x8C, 0xEF, 0x7B, 0x71, 0x8C, 0x38, 0xC6, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x79, 0xCE, 0x37, 0x80, 0xFF, 0xFF, 
+0x37, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x9E, 0xF7, 0x5D, 0xEF, 0xDB, 0xDE, 0x79, 0xCE, 0x38, 0xC6, 0x75, 0xAD, 0x30, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0x30, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 
+0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 
+0x10, 0x84, 0x10, 0x84, 0xD3, 0x9C, 0x38, 0xC6, 0x79, 0xCE, 0x9A, 0xD6, 0x1C, 0xE7, 0x5D, 0xEF, 0xBE, 0xF7, 0x45, 0x80, 0xFF, 0xFF, 0x2C, 0x00, 0xDF, 0xFF, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFB, 0xDE, 0x59, 0xCE, 0xBA, 0xD6, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0x92, 0x94, 0x71, 0x8C, 0x30, 0x84, 0x3C, 0xE7, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0xB5, 0x92, 0x94, 0x1C, 0xE7, 0x9E, 0xF7, 0xDB, 0xDE, 0x51, 0x8C, 0xD7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0x51, 0x8C, 0x9A, 0xD6, 
+0x7D, 0xEF, 0xBA, 0xD6, 0x71, 0x8C, 0x9A, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x79, 0xCE, 0x48, 0x80, 0xFF, 0xFF, 0x24, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x38, 0xC6, 
+0xF3, 0x9C, 0x30, 0x84, 0xEF, 0x7B, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 
+0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0x30, 0x84, 0x71, 0x8C, 0xB6, 0xB5, 0xDB, 0xDE, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x47, 0x80, 0xFF, 0xFF, 0x2C, 0x00, 0xDF, 0xFF, 0x9A, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xD7, 0xBD, 0x51, 0x8C, 0x91, 0x94, 0x50, 0x8C, 0xD2, 0x9C, 0x7D, 0xEF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x38, 0xC6, 0xF7, 0xBD, 0x71, 0x8C, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x55, 0xAD, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xD7, 0xBD, 0x75, 0xAD, 0xDF, 0xFF, 0xDF, 0xFF, 0xF7, 0xBD, 0xB6, 0xB5, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xB6, 0xB5, 0x75, 0xAD, 0xFF, 0xFF, 0xBE, 0xF7, 0xBE, 0xF7, 0x5D, 0xEF, 
+0x59, 0xCE, 0x48, 0x80, 0xFF, 0xFF, 0x27, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x3C, 0xE7, 0x38, 0xC6, 0x75, 0xAD, 0x51, 0x8C, 0x10, 0x84, 0xCF, 0x7B, 0xCF, 0x7B, 
+0x10, 0x84, 0x30, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x51, 0x8C, 
+0xF3, 0x9C, 0xB6, 0xB5, 0xBA, 0xD6, 0x5D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x45, 0x80, 0xFF, 0xFF, 0x2B, 0x00, 0x59, 0xCE, 
+0xBE, 0xF7, 0xDF, 0xFF, 0xBE, 0xF7, 0x1B, 0xE7, 0x71, 0x8C, 0xDA, 0xDE, 0xDF, 0xFF, 0xBE, 0xF7, 0x34, 0xA5, 0xB6, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 
+0xB2, 0x94, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x18, 0xC6, 0xB2, 0x94, 0x3C, 0xE7, 0xDF, 0xFF, 0xBE, 0xF7, 0xF3, 0x9C, 0xBA, 0xD6, 0xFF, 0xFF, 0xBE, 0xF7, 0x14, 0xA5, 
+0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0x91, 0x94, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x59, 0xCE, 0x4C, 0x80, 0xFF, 0xFF, 0x1E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xDB, 0xDE, 0xB6, 0xB5, 0x92, 0x94, 0xEF, 0x7B, 0xCF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 
+0x10, 0x84, 0x30, 0x84, 0x51, 0x8C, 0x14, 0xA5, 0x38, 0xC6, 0x1C, 0xE7, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x49, 0x80, 0xFF, 0xFF, 0x2C, 0x00, 
+0xDF, 0xFF, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x79, 0xCE, 0x34, 0xA5, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDA, 0xDE, 0x71, 0x8C, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0x92, 0x94, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xB6, 0xB5, 0x92, 0x94, 0x34, 0xA5, 0x55, 0xAD, 0xF7, 0xBD, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xD3, 0x9C, 0xDB, 0xDE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDA, 0xDE, 0xB2, 0x94, 0x7D, 0xEF, 0xDE, 0xFF, 0xDE, 0xFF, 0x1C, 0xE7, 0x58, 0xCE, 0x48, 0x80, 0xFF, 0xFF, 0x25, 0x00, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFB, 0xDE, 0xF7, 0xBD, 0xF3, 0x9C, 0x51, 0x8C, 
+0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0x10, 0x84, 0x30, 0x84, 0x92, 0x94, 0x55, 0xAD, 0x18, 0xC6, 0x7D, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x45, 0x80, 0xFF, 0xFF, 0x2D, 0x00, 0xDF, 0xFF, 0xBE, 0xF7, 0x18, 0xC6, 0x9E, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 
+0x17, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x71, 0x8C, 0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x92, 0x94, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0x55, 0xAD, 0x5D, 0xEF, 0xFB, 0xDE, 0xB6, 0xB5, 0xF3, 0x9C, 0xDB, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0xF3, 0x9C, 0xDB, 0xDE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xBA, 0xD6, 0xD2, 0x9C, 0x7D, 0xEF, 0xFB, 0xDE, 0x79, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x4B, 0x80, 0xFF, 0xFF, 0x15, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0x18, 0xC6, 0x34, 0xA5, 0xB2, 0x94, 0x55, 0xAD, 0xBA, 0xD6, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x54, 0x80, 0xFF, 0xFF, 0x2B, 0x00, 0x18, 0xC6, 0x9A, 0xD6, 0x99, 0xD6, 0x7D, 0xEF, 0x55, 0xAD, 0x58, 0xCE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0xB2, 0x94, 0x3C, 0xE7, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xB2, 0x94, 0x3C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0xF3, 0x9C, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC6, 
+0x34, 0xA5, 0x9E, 0xF7, 0xDF, 0xFF, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0x71, 0x8C, 0xBE, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0x58, 0xCE, 0x79, 0xCE, 0x48, 0x80, 
+0xFF, 0xFF, 0x23, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x49, 0x80, 0xFF, 0xFF, 0x2B, 0x00, 0xFB, 0xDE, 0x1C, 0xE7, 0x1C, 0xE7, 0x5D, 0xEF, 0x55, 0xAD, 0x58, 0xCE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x92, 0x94, 0x3C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xB2, 0x94, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 
+0x92, 0x94, 0x1C, 0xE7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0xB2, 0x94, 0xBE, 0xF7, 0xDF, 0xFF, 0xD7, 0xBD, 0x75, 0xAD, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xD7, 0xBD, 0x14, 0xA5, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x3C, 0xE7, 0x50, 0x80, 0xFF, 0xFF, 0x0D, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x59, 0x80, 0xFF, 0xFF, 0x29, 0x00, 0xDE, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0xB6, 0xB5, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x1C, 0xE7, 0x71, 0x8C, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0x71, 0x8C, 0xDB, 0xDE, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x34, 0xA5, 0x92, 0x94, 
+0x1C, 0xE7, 0x9E, 0xF7, 0xFB, 0xDE, 0xB2, 0x94, 0x75, 0xAD, 0xDF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0x71, 0x8C, 0xBA, 0xD6, 0x9E, 0xF7, 0xDB, 0xDE, 0x71, 0x8C, 0x99, 0xD6, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x6A, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0xDF, 0xFF, 0x4B, 0x80, 0xFF, 0xFF, 0x25, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0x91, 0x94, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xBE, 0xF7, 0x58, 0xCE, 0xB2, 0x94, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0xEF, 0x7B, 0xAE, 0x73, 0xAE, 0x73, 0xEF, 0x7B, 0xCF, 0x7B, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x3C, 0xE7, 0x96, 0xB5, 0x10, 0x84, 0xAE, 0x73, 0x92, 0x94, 0x96, 0xB5, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x18, 0xC6, 0x51, 0x8C, 0xEF, 0x7B, 0x51, 0x8C, 0x18, 0xC6, 0xBE, 0xF7, 
+0xBE, 0x80, 0xFF, 0xFF, 0x28, 0x00, 0xDF, 0xFF, 0x9E, 0xF7, 0xB2, 0x94, 0x55, 0xAD, 0x79, 0xCE, 0x38, 0xC6, 0x71, 0x8C, 0xFB, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 
+0x5D, 0xEF, 0x7D, 0xEF, 0x9E, 0xF7, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0x7D, 0xEF, 0x9E, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x7D, 0xEF, 0xBE, 0xF7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xB9, 0x80, 0xFF, 0xFF, 0x28, 0x00, 0xBE, 0xF7, 
+0xFF, 0xFF, 0x3C, 0xE7, 0x75, 0xAD, 0x71, 0x8C, 0xD3, 0x9C, 0x9A, 0xD6, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBC, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 
+};
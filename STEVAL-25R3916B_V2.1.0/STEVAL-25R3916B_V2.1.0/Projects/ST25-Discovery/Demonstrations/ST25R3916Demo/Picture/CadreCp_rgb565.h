@@ -0,0 +1,68 @@
+/* 52x39 RGB565 RLE picture converted from CadreCp_jpg.h by pict2rgb565, 2044 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char CadreCp[] = {
+0x52, 0x35, 0x36, 0x35, 0x01, 0x00, 0x34, 0x00, 0x27, 0x00, 0x00, 0x00, 0xF6, 0x03, 0x00, 0x00, 0x41, 0x03, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0x14, 0xA5, 0x14, 0xA5, 0x34, 0xA5, 
+0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x55, 0xAD, 0xF3, 0x9C, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 
+0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x55, 0xAD, 0x14, 0xA5, 0x14, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0x55, 0xAD, 
+0xF3, 0x9C, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0x34, 0xA5, 0x55, 0xAD, 0x34, 0xA5, 0x34, 0xA5, 0x18, 0xC6, 0xBA, 0xD6, 
+0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0xBA, 0xD6, 0xBA, 0xD6, 
+0xBA, 0xD6, 0x9A, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 0x79, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0x79, 0xCE, 0x9A, 0xD6, 
+0xBA, 0xD6, 0x9A, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0x18, 0xC6, 
+0x55, 0xAD, 0x14, 0xA5, 0x9A, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x79, 0xCE, 0x34, 0xA5, 0xF3, 0x9C, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0x96, 0xB5, 0x55, 0xAD, 0x55, 0xAD, 0xD7, 0xBD, 0x79, 0xCE, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xCE, 0xF3, 0x9C, 0x34, 0xA5, 0x59, 0xCE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0xB5, 0x38, 0xC6, 0x3C, 0xE7, 0xFF, 0xFF, 
+0xBE, 0xF7, 0x1C, 0xE7, 0xB6, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x14, 0xA5, 0x34, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 
+0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0x1C, 0xE7, 0x18, 0xC6, 0x34, 0xA5, 0x96, 0xB5, 0x1C, 0xE7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 
+0x34, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0xB5, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x18, 0xC6, 0x7D, 0xEF, 
+0x9E, 0xF7, 0xBE, 0xF7, 0x75, 0xAD, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x34, 0xA5, 0x14, 0xA5, 0x38, 0xC6, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0x96, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x75, 0xAD, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 
+0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xD3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x34, 0xA5, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 
+0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0x18, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0xFF, 0xFF, 0xDF, 0xFF, 0x55, 0xAD, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0xD7, 0xBD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xAD, 0x38, 0xC6, 0x1C, 0xE7, 0xFF, 0xFF, 0x9E, 0xF7, 0x59, 0xCE, 0xF3, 0x9C, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x14, 0xA5, 0x3C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0x34, 0xA5, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0xB6, 0xB5, 0x14, 0xA5, 
+0x55, 0xAD, 0x59, 0xCE, 0x5D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF3, 0x9C, 0xF7, 0xBD, 0x55, 0xAD, 0x14, 0xA5, 0xB6, 0xB5, 0x9E, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 
+0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 
+0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 
+0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 
+0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 
+0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 
+0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 
+0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x03, 0x00, 
+0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0x59, 0xCE, 0x14, 0xA5, 0x34, 0xA5, 0x38, 0xC6, 0xFF, 0xFF, 0xDF, 0xFF, 0x2D, 0x80, 0xFF, 0xFF, 0x03, 0x00, 
+0x59, 0xCE, 0x34, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2F, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0x38, 0xC6, 0x14, 0xA5, 0x34, 0xA5, 0x59, 0xCE, 0xFF, 0xFF, 0xDF, 0xFF, 0x2D, 0x80, 0xFF, 0xFF, 0x03, 0x00, 
+0x59, 0xCE, 0x14, 0xA5, 0x14, 0xA5, 0x59, 0xCE, 0x2D, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x14, 0xA5, 0x34, 0xA5, 0x79, 0xCE, 0xDF, 0xFF, 0x2C, 0x80, 0xFF, 0xFF, 
+0x09, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0x79, 0xCE, 0x34, 0xA5, 0x34, 0xA5, 0xF7, 0xBD, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x2A, 0x80, 0xBA, 0xD6, 0x08, 0x00, 0xDB, 0xDE, 0x18, 0xC6, 
+0x34, 0xA5, 0xF3, 0x9C, 0x34, 0xA5, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0x14, 0xA5, 0x29, 0x80, 0x34, 0xA5, 0x03, 0x00, 0xF3, 0x9C, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 
+};
@@ -0,0 +1,261 @@
+/* 64x64 RGB565 raw picture converted from Contact_jpg.h by pict2rgb565, 8208 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char Contact[] = {
+0x52, 0x35, 0x36, 0x35, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 
+0xDF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xEF, 0x7D, 0xE7, 0x5D, 0xE7, 0x5D, 0xE7, 0x5D, 0xE7, 0x5D, 0xE7, 0x5C, 0xE7, 0x5C, 0xE7, 0x5C, 0xE7, 0x5C, 0xE7, 
+0x1D, 0xEF, 0x5E, 0xEF, 0x3C, 0xE7, 0x3E, 0xF7, 0x5E, 0xE7, 0x5D, 0xEF, 0x5D, 0xE7, 0x3C, 0xEF, 0x7C, 0xDF, 0x5D, 0xEF, 0x5D, 0xDF, 0x3D, 0xEF, 0xDC, 0xEE, 0x9E, 0xE7, 0x3D, 0xDF, 0x7C, 0xE7, 
+0x5D, 0xEF, 0x3C, 0xE7, 0x7B, 0xE7, 0x9C, 0xE7, 0x7C, 0xE7, 0x3C, 0xE7, 0x5D, 0xEF, 0x1C, 0xE7, 0x7E, 0xE7, 0x7D, 0xEF, 0x9D, 0xF7, 0xDE, 0xFF, 0xFE, 0xFF, 0xDF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 
+0xDE, 0xF7, 0xFF, 0xF7, 0xDF, 0xEF, 0x7E, 0xE7, 0xFC, 0xDE, 0x9A, 0xD6, 0x17, 0xC6, 0xB6, 0xB5, 0x75, 0xB5, 0x75, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 
+0x96, 0xAD, 0x72, 0xB5, 0x74, 0xB5, 0xB4, 0xB5, 0x53, 0xBD, 0x95, 0x9D, 0x74, 0xAD, 0xF6, 0xB5, 0x76, 0xB5, 0x96, 0xB5, 0x14, 0xAD, 0xB5, 0xB5, 0xD5, 0xB5, 0x73, 0xAD, 0x74, 0xB5, 0x56, 0xB5, 
+0x95, 0xAD, 0x95, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x35, 0xAD, 0x96, 0xB5, 0x75, 0xAD, 0xD5, 0xB5, 0xB7, 0xB5, 0x38, 0xC6, 0xBA, 0xD6, 0xDB, 0xDE, 0x3D, 0xE7, 0xBE, 0xF7, 0xFE, 0xFF, 0xBD, 0xFF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 
+0xFD, 0xF7, 0x1A, 0xDF, 0x79, 0xD6, 0xD7, 0xBD, 0x53, 0x7C, 0x52, 0x3B, 0x34, 0x13, 0x56, 0x03, 0x55, 0x03, 0x55, 0x03, 0x55, 0x03, 0x55, 0x03, 0x55, 0x03, 0x56, 0x03, 0x56, 0x03, 0x56, 0x03, 
+0x75, 0x03, 0x98, 0x03, 0x55, 0x03, 0x76, 0x03, 0x97, 0x03, 0x55, 0x13, 0x77, 0x03, 0x35, 0x03, 0x97, 0x0B, 0xB6, 0x03, 0x99, 0x13, 0x9A, 0x03, 0x18, 0x04, 0xD7, 0x03, 0x1A, 0x04, 0x1B, 0x04, 
+0x3B, 0x04, 0xFB, 0x0B, 0x1C, 0x0C, 0x5D, 0x0C, 0x1D, 0x0C, 0x1C, 0x04, 0x7D, 0x04, 0x1B, 0x04, 0x3A, 0x04, 0xF8, 0x13, 0x16, 0x44, 0xF6, 0x7C, 0xD7, 0xB5, 0x9B, 0xD6, 0x3C, 0xE7, 0xDD, 0xF7, 
+0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0x9D, 0xF7, 
+0x98, 0xDE, 0x97, 0xA5, 0x15, 0x4C, 0x14, 0x13, 0x57, 0x03, 0xB8, 0x03, 0xD7, 0x03, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x39, 0x04, 0x39, 0x04, 0x19, 0x04, 0x19, 0x04, 0x19, 0x04, 0x19, 0x04, 
+0x58, 0x04, 0x39, 0x04, 0x39, 0x04, 0x18, 0x04, 0x7A, 0x04, 0x3A, 0x0C, 0x38, 0x14, 0x38, 0x0C, 0x57, 0x04, 0xBB, 0x04, 0x99, 0x04, 0xF9, 0x04, 0xDB, 0x04, 0x1D, 0x05, 0xFC, 0x04, 0xFF, 0x14, 
+0x1B, 0x0D, 0x1B, 0x05, 0x5D, 0x0D, 0x3D, 0x0D, 0x9D, 0x05, 0xBE, 0x05, 0x3D, 0x05, 0x5E, 0x05, 0x3E, 0x05, 0x1D, 0x05, 0xBD, 0x04, 0x1C, 0x04, 0xFA, 0x0B, 0x97, 0x4C, 0xB8, 0x9D, 0x9B, 0xDE, 
+0x7B, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBE, 0xFF, 0xDF, 0xFF, 0x3D, 0xE7, 0x59, 0xBE, 
+0x78, 0x54, 0x34, 0x1B, 0x15, 0x03, 0xD8, 0x03, 0x19, 0x04, 0x18, 0x04, 0x58, 0x04, 0x38, 0x04, 0x58, 0x04, 0x58, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 
+0xF9, 0x03, 0x38, 0x04, 0x1B, 0x04, 0x54, 0x0B, 0xFF, 0xFF, 0xFE, 0xFF, 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0x79, 0x14, 0x3F, 0x05, 0xFB, 0x04, 
+0x3D, 0x05, 0x7F, 0x15, 0xFC, 0x04, 0x5D, 0x05, 0x1C, 0x05, 0x3C, 0x05, 0x1D, 0x05, 0x3F, 0x0D, 0x5C, 0x05, 0xFD, 0x04, 0x1E, 0x05, 0x3D, 0x05, 0xBB, 0x04, 0xD9, 0x03, 0xF8, 0x2B, 0xB8, 0x54, 
+0x59, 0xC6, 0x5D, 0xE7, 0xDF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x5C, 0xE7, 0x1A, 0xAE, 0xD3, 0x53, 
+0x14, 0x03, 0x96, 0x03, 0xF7, 0x03, 0x18, 0x04, 0x59, 0x04, 0x59, 0x04, 0x39, 0x04, 0x3A, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 
+0x58, 0x04, 0xB7, 0x0B, 0xFF, 0xEF, 0xFE, 0xF7, 0xFF, 0xE7, 0x9D, 0xF7, 0xFE, 0xFF, 0xFE, 0xEF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFE, 0xF7, 0xBF, 0xFF, 0xBF, 0xFF, 0xDC, 0xFF, 0xDF, 0xF7, 0x98, 0x04, 
+0x5E, 0x05, 0xDD, 0x04, 0x7F, 0x05, 0xBF, 0x05, 0x3E, 0x15, 0x1C, 0x05, 0xBE, 0x05, 0x5E, 0x05, 0x3F, 0x05, 0x5E, 0x05, 0x5D, 0x05, 0x3D, 0x05, 0x1D, 0x05, 0x1C, 0x0D, 0x79, 0x0C, 0xB7, 0x03, 
+0x56, 0x4C, 0xF9, 0xAD, 0x3C, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0x9E, 0xFF, 0x3C, 0xE7, 0x19, 0xAE, 0xF4, 0x3B, 0x14, 0x03, 
+0x39, 0x0C, 0xF8, 0x03, 0x38, 0x04, 0x59, 0x04, 0x38, 0x04, 0x17, 0x04, 0x18, 0x0C, 0x18, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 
+0xF5, 0x0B, 0xDF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFD, 0xF7, 0xBF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xDF, 0xF7, 0xDE, 0xFF, 
+0x9B, 0x65, 0xD8, 0x0C, 0x5D, 0x0D, 0x1E, 0x05, 0x5E, 0x05, 0x9F, 0x0D, 0x1D, 0x0D, 0x9D, 0x05, 0x3D, 0x05, 0x1E, 0x05, 0x1D, 0x05, 0x3C, 0x05, 0x3C, 0x05, 0xFD, 0x04, 0xDD, 0x04, 0xDC, 0x04, 
+0xB7, 0x03, 0x76, 0x4C, 0xF8, 0xAD, 0x5D, 0xE7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 0x7D, 0xEF, 0x5A, 0xC6, 0xD3, 0x4B, 0x13, 0x03, 0x19, 0x04, 
+0x18, 0x04, 0x59, 0x04, 0x5A, 0x04, 0x39, 0x04, 0x19, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x58, 0x04, 0x58, 0x04, 0x38, 0x04, 0x58, 0x04, 0x58, 0x04, 
+0xFF, 0xF7, 0xFF, 0xF7, 0xDE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xF7, 0x7D, 0xF7, 
+0x1C, 0xFF, 0xBF, 0xDF, 0x76, 0x0C, 0x9E, 0x05, 0x7F, 0x0D, 0x3E, 0x0D, 0x3D, 0x05, 0x7E, 0x0D, 0x5D, 0x05, 0x5C, 0x05, 0x3C, 0x05, 0x1D, 0x0D, 0x1D, 0x0D, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x0C, 
+0x9C, 0x0C, 0x97, 0x03, 0x56, 0x4C, 0x38, 0xC6, 0x5B, 0xF7, 0xDE, 0xF7, 0xFF, 0xF7, 0xDE, 0xFF, 0xDF, 0xFF, 0xDE, 0xF7, 0xDE, 0xF7, 0x99, 0xE6, 0x78, 0x54, 0x34, 0x0B, 0x38, 0x04, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x39, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x39, 0x04, 0x19, 0x0C, 0x18, 0x0C, 0x18, 0x04, 0xBA, 0x04, 0x18, 0x04, 0x38, 0x0C, 0x37, 0x04, 0x58, 0xD6, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 
+0x5E, 0xEF, 0x7C, 0xDF, 0x3D, 0xDF, 0x5C, 0x0D, 0x9F, 0x05, 0x1F, 0x05, 0x5D, 0x05, 0x7E, 0x05, 0x5D, 0x05, 0x3D, 0x05, 0x1D, 0x05, 0x1D, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x04, 
+0xBB, 0x04, 0xBB, 0x04, 0xB6, 0x0B, 0x98, 0x54, 0xB9, 0xEE, 0xDD, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x1B, 0xE7, 0xB8, 0xAD, 0x74, 0x23, 0xD5, 0x0B, 0xF7, 0x03, 0x39, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x39, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x39, 0x04, 0x59, 0x04, 0x37, 0x04, 0x9A, 0x04, 0xB7, 0x03, 0x59, 0x04, 0x57, 0x04, 0xBF, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 
+0x5C, 0xEF, 0xF9, 0xDE, 0x1D, 0xF7, 0xFB, 0x04, 0x3E, 0x05, 0x7C, 0x05, 0x5D, 0x0D, 0x1E, 0x05, 0x3D, 0x05, 0x3D, 0x05, 0x1D, 0x05, 0xFD, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x04, 0xDB, 0x04, 
+0xBB, 0x04, 0x9A, 0x04, 0x18, 0x04, 0xD6, 0x2B, 0x97, 0xA5, 0x3B, 0xE7, 0xFF, 0xF7, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xEF, 0x99, 0xD6, 0x14, 0x4C, 0x34, 0x03, 0x16, 0x04, 0x18, 0x04, 0x19, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x39, 0x04, 0x19, 0x04, 0x9C, 0x04, 0x36, 0x04, 0x38, 0x04, 0x19, 0x0C, 0xFA, 0xCE, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 
+0x5C, 0xDF, 0x5D, 0xE7, 0xBB, 0xDE, 0x1C, 0xD7, 0x5F, 0x05, 0x5C, 0x05, 0x9E, 0x05, 0x1E, 0x05, 0x3D, 0x05, 0x1D, 0x05, 0x1D, 0x05, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x04, 0xDB, 0x04, 0xBB, 0x04, 
+0xBC, 0x04, 0x9A, 0x04, 0x79, 0x04, 0x97, 0x03, 0x56, 0x54, 0x79, 0xD6, 0xDF, 0xEF, 0xDF, 0xFF, 0xDE, 0xF7, 0x7E, 0xE7, 0xB7, 0xBD, 0x34, 0x0B, 0xD7, 0x03, 0x17, 0x04, 0x38, 0x04, 0xF9, 0x03, 
+0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x13, 0x59, 0x04, 0xB7, 0x03, 0x5C, 0x04, 0xD5, 0x0B, 0xDC, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 
+0x1B, 0xDF, 0xFA, 0xE6, 0xDA, 0xE6, 0xBA, 0xD6, 0xBE, 0x14, 0x7D, 0x05, 0x1B, 0x15, 0x3E, 0x05, 0x1D, 0x05, 0x1D, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x04, 
+0x9B, 0x04, 0xBA, 0x04, 0xBA, 0x04, 0x39, 0x04, 0x96, 0x13, 0xB7, 0xB5, 0x7E, 0xE7, 0xDE, 0xF7, 0xBE, 0xF7, 0xFC, 0xDE, 0x53, 0x7C, 0x76, 0x03, 0x38, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF9, 0x03, 
+0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF9, 0x03, 0x38, 0x04, 0x18, 0x14, 0xD8, 0x03, 0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 
+0xDA, 0xDE, 0xDB, 0xD6, 0xDB, 0xCE, 0x9A, 0xCE, 0x79, 0xD6, 0x9F, 0x05, 0x3E, 0x05, 0x5E, 0x05, 0x1D, 0x05, 0x1C, 0x05, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x04, 
+0x7A, 0x04, 0x9A, 0x04, 0x9A, 0x04, 0xBB, 0x04, 0x98, 0x03, 0x94, 0x84, 0xFC, 0xDE, 0xBD, 0xF7, 0xBE, 0xF7, 0x7A, 0xCE, 0x72, 0x43, 0xB7, 0x03, 0x39, 0x04, 0x18, 0x04, 0xF7, 0x03, 0x19, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x18, 0x04, 0x56, 0x0C, 0xF9, 0x03, 0x57, 0x04, 0xB5, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xFB, 0xDE, 
+0xFA, 0xCE, 0xBA, 0xE6, 0xBB, 0xD6, 0x3B, 0xC6, 0xB9, 0xCE, 0xFC, 0x04, 0xDB, 0x0C, 0x1D, 0x0D, 0x1C, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0x9B, 0x04, 0x9B, 0x04, 
+0x9A, 0x04, 0x79, 0x04, 0x7A, 0x04, 0x9A, 0x04, 0xF9, 0x03, 0xB3, 0x43, 0x7A, 0xCE, 0x9D, 0xF7, 0x9D, 0xEF, 0xF7, 0xBD, 0x54, 0x1B, 0xD7, 0x03, 0x38, 0x04, 0xF9, 0x03, 0x18, 0x04, 0x38, 0x04, 
+0x18, 0x04, 0x38, 0x04, 0x38, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x18, 0x04, 0x59, 0x04, 0x59, 0x04, 0x7A, 0x0C, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xEF, 0x9F, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xFB, 0xCE, 0xBA, 0xCE, 0xF8, 0xD5, 0x96, 0xDE, 0x59, 0xCE, 0x14, 0x14, 0xFE, 0x14, 0xFB, 0x04, 0xFC, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xBC, 0x04, 0xBB, 0x04, 0x9B, 0x04, 0x9B, 0x04, 0x9A, 0x04, 
+0x9A, 0x04, 0x59, 0x0C, 0x7A, 0x04, 0x79, 0x04, 0x59, 0x04, 0x75, 0x13, 0x18, 0xC6, 0x9D, 0xEF, 0x7D, 0xE7, 0xB6, 0xB5, 0x75, 0x03, 0x17, 0x04, 0xF7, 0x03, 0x1A, 0x04, 0x18, 0x04, 0x58, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF9, 0x03, 0x36, 0x04, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 
+0x79, 0xD6, 0x38, 0xCE, 0xBA, 0xD6, 0x79, 0xB6, 0x38, 0xBE, 0x38, 0xBE, 0xFD, 0x14, 0x1B, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0x9B, 0x04, 0x9A, 0x04, 0x7A, 0x04, 
+0x7A, 0x04, 0x5A, 0x0C, 0x5B, 0x04, 0x9A, 0x04, 0x79, 0x04, 0x97, 0x03, 0x96, 0xB5, 0x5D, 0xEF, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x38, 0x04, 0xF9, 0x03, 0x36, 0x0C, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 
+0x98, 0xCE, 0x3A, 0xCE, 0x7A, 0xC6, 0x16, 0xC6, 0x1A, 0xC6, 0x18, 0xBE, 0xDA, 0x04, 0xFC, 0x0C, 0xDC, 0x04, 0xDC, 0x04, 0xDB, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0x9A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 
+0x79, 0x04, 0x5A, 0x04, 0x7A, 0x04, 0x79, 0x04, 0x7A, 0x04, 0x76, 0x03, 0x75, 0xAD, 0x3D, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x58, 0x04, 0x19, 0x0C, 0x58, 0x04, 0xDF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 
+0x78, 0xCE, 0x39, 0xCE, 0x18, 0xBE, 0x36, 0xC6, 0xB8, 0xBD, 0xD6, 0xB5, 0x3C, 0x0D, 0xBC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0x9B, 0x04, 0x7A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 
+0x79, 0x04, 0x5A, 0x04, 0x5A, 0x04, 0x79, 0x04, 0x7A, 0x04, 0x56, 0x03, 0x75, 0xAD, 0x3D, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x38, 0x04, 0x17, 0x04, 0xF9, 0x0B, 0xF9, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 
+0x59, 0xC6, 0x17, 0xC6, 0xD7, 0xC5, 0x17, 0xBE, 0xB7, 0xBD, 0x96, 0xB5, 0xDB, 0x04, 0xBC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0x9B, 0x04, 0x9B, 0x04, 0x9A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 
+0x59, 0x04, 0x5A, 0x04, 0x5A, 0x04, 0x79, 0x04, 0x7A, 0x04, 0x56, 0x03, 0x75, 0xAD, 0x3D, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x38, 0x0C, 0xF8, 0x03, 0x7B, 0x04, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xBE, 0xF7, 
+0xBE, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 
+0x39, 0xC6, 0xF6, 0xC5, 0xD7, 0xC5, 0xF6, 0xB5, 0xD7, 0xC5, 0x76, 0xB5, 0x37, 0x04, 0xBC, 0x04, 0x9B, 0x04, 0x9B, 0x04, 0x9A, 0x04, 0x9A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 0x59, 0x04, 
+0x59, 0x04, 0x39, 0x04, 0x5A, 0x04, 0x59, 0x04, 0x7A, 0x04, 0x55, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x58, 0x04, 0x39, 0x0C, 0xD7, 0x03, 0xFF, 0xFF, 0xDE, 0xF7, 0xDE, 0xF7, 0xBF, 0xF7, 0xFF, 0xFF, 
+0x9E, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 
+0x18, 0xBE, 0xF6, 0xBD, 0xD6, 0xBD, 0xB6, 0xAD, 0xB6, 0xB5, 0x96, 0xAD, 0x77, 0x1C, 0xBB, 0x04, 0x9A, 0x04, 0x9A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 0x79, 0x04, 0x59, 0x04, 0x59, 0x04, 
+0x59, 0x04, 0x39, 0x04, 0x5A, 0x04, 0x59, 0x04, 0x7A, 0x04, 0x55, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x58, 0x04, 0xF7, 0x03, 0xD4, 0x2B, 0xFF, 0xFF, 0xDF, 0xF7, 0xFE, 0xF7, 0xBE, 0xEF, 0x7D, 0xEF, 
+0x7D, 0xEF, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 
+0xF7, 0xB5, 0xF7, 0xBD, 0xD6, 0xB5, 0xB6, 0xAD, 0x55, 0xAD, 0x75, 0xA5, 0x99, 0x6D, 0x7A, 0x0C, 0x9A, 0x04, 0x9A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 0x79, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 
+0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x7A, 0x04, 0x55, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x59, 0x04, 0x38, 0x0C, 0xFF, 0xEF, 0xDF, 0xF7, 0xDE, 0xFF, 0xDE, 0xFF, 0xBF, 0xEF, 0x9E, 0xF7, 
+0x5D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 
+0xD6, 0xB5, 0xB7, 0xB5, 0xB5, 0xAD, 0x75, 0xB5, 0x55, 0xAD, 0x54, 0xA5, 0xB8, 0xA5, 0x38, 0x14, 0x7A, 0x04, 0x7A, 0x04, 0x7A, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 
+0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x7A, 0x04, 0x76, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x0C, 0xBD, 0xFF, 0xBF, 0xF7, 0x9E, 0xF7, 0x5C, 0xF7, 0x9E, 0xEF, 0x3D, 0xEF, 
+0x5D, 0xEF, 0x3C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 
+0xB6, 0xBD, 0x56, 0xB5, 0xB5, 0xA5, 0x34, 0xB5, 0x56, 0xAD, 0x33, 0x9D, 0xF4, 0xAC, 0x17, 0x14, 0x79, 0x04, 0x79, 0x04, 0x79, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 
+0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x79, 0x04, 0x76, 0x03, 0x75, 0xAD, 0x5C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x35, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF9, 0x03, 0x58, 0x04, 0x7E, 0xFF, 0xDC, 0xEF, 0xBD, 0xF7, 0x3D, 0xF7, 0x7C, 0xF7, 0x5E, 0xDF, 
+0x1C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0xB6, 0xB5, 
+0xB7, 0xA5, 0x95, 0xAD, 0x74, 0xBD, 0x55, 0x95, 0x14, 0xB5, 0x14, 0x9D, 0xD3, 0x9C, 0x18, 0x04, 0x79, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x39, 0x04, 0x39, 0x04, 
+0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x59, 0x04, 0x55, 0x03, 0x75, 0xB5, 0x5C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x35, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x19, 0x04, 0x16, 0x04, 0x7F, 0xF7, 0xDE, 0xEF, 0x9B, 0xE7, 0x3E, 0xE7, 0x1D, 0xFF, 0x39, 0xE7, 
+0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0xB6, 0xB5, 0x96, 0xB5, 
+0x54, 0xAD, 0x53, 0xAD, 0x33, 0xA5, 0x34, 0x9D, 0xD2, 0xAC, 0xF3, 0xA4, 0xF1, 0x9C, 0x59, 0x0C, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 
+0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x59, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x35, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x79, 0x0C, 0x17, 0x04, 0xB6, 0x1B, 0x7E, 0xD7, 0x3C, 0xE7, 0x5E, 0xDF, 0x3E, 0xDF, 0x1B, 0xDF, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 
+0x34, 0xAD, 0x74, 0xB5, 0x54, 0xA5, 0xF4, 0xA4, 0x13, 0xA5, 0x93, 0x94, 0x13, 0x8D, 0x18, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 
+0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x35, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xD5, 0x03, 0x39, 0x04, 0x3A, 0x04, 0x1B, 0xEF, 0x3C, 0xEF, 0x5B, 0xEF, 0xFB, 0xDE, 0x1B, 0xDF, 
+0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 
+0x97, 0xA5, 0xB2, 0x94, 0x33, 0xA5, 0xD4, 0x9C, 0xF3, 0x94, 0xD4, 0x8C, 0xD3, 0x2B, 0x39, 0x0C, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 
+0x38, 0x04, 0x39, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x34, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF8, 0x03, 
+0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x58, 0x04, 0x19, 0x04, 0xF8, 0x03, 0x96, 0xBD, 0x7C, 0xE7, 0xDA, 0xD6, 0x7B, 0xEE, 0xFA, 0xCE, 
+0xBA, 0xD6, 0x9A, 0xD6, 0x79, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 
+0x15, 0x95, 0x35, 0xA5, 0x91, 0x94, 0xD4, 0x9C, 0x90, 0x94, 0xB2, 0x94, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 
+0x38, 0x04, 0x19, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x34, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF7, 0x03, 
+0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0x19, 0x04, 0xF9, 0x03, 0x18, 0x04, 0x34, 0x2B, 0xB9, 0xDE, 0x1C, 0xD7, 0x9B, 0xD6, 0x1C, 0xD7, 
+0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 
+0xD1, 0xA4, 0x14, 0xA5, 0x13, 0xA5, 0x92, 0x8C, 0xB0, 0x9C, 0x90, 0x8C, 0x7B, 0x04, 0x39, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 
+0x38, 0x04, 0x19, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x34, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF7, 0x03, 
+0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF7, 0x0B, 0x38, 0x0C, 0x37, 0x04, 0x98, 0x0B, 0x1C, 0xDF, 0xB8, 0xD6, 0xFA, 0xD6, 0x5A, 0xD6, 
+0x79, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 
+0xD1, 0xA4, 0x91, 0x94, 0x92, 0x94, 0xB1, 0x94, 0xB4, 0x7C, 0x71, 0x2B, 0x19, 0x04, 0x18, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 
+0x38, 0x04, 0x19, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x34, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF7, 0x03, 
+0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x19, 0x04, 0x17, 0x04, 0x38, 0x04, 0xB8, 0x0B, 0xF6, 0x0B, 0x99, 0xCE, 0x7A, 0xCE, 0x9A, 0xD6, 
+0x59, 0xCE, 0x59, 0xCE, 0x38, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 
+0xF3, 0x94, 0xB1, 0x94, 0xB3, 0x94, 0x4F, 0x84, 0x53, 0x23, 0x3A, 0x04, 0xF9, 0x03, 0x37, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 0x38, 0x04, 
+0x38, 0x04, 0x19, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x5C, 0xE7, 0x5C, 0xDF, 0x75, 0xAD, 0x34, 0x03, 0x17, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF7, 0x03, 
+0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0x16, 0x04, 0x17, 0x04, 0x1A, 0x04, 0x16, 0x04, 0x19, 0x04, 0xD6, 0x0B, 0x97, 0xCE, 0x39, 0xC6, 
+0x38, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 
+0xB1, 0x8C, 0x74, 0x8C, 0xAF, 0x84, 0x31, 0x94, 0x59, 0x04, 0x19, 0x04, 0x37, 0x04, 0x3A, 0x04, 0x39, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF8, 0x03, 0x18, 0x04, 0x38, 0x04, 0x38, 0x04, 
+0x18, 0x04, 0x38, 0x04, 0x59, 0x04, 0x38, 0x0C, 0xF8, 0x03, 0x76, 0x03, 0x75, 0xAD, 0x1C, 0xE7, 0x3C, 0xE7, 0x54, 0xAD, 0x14, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF7, 0x03, 0xF7, 0x03, 
+0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0x18, 0x04, 0xD8, 0x03, 0x17, 0x0C, 0xF9, 0x03, 0x37, 0x0C, 0x39, 0xC6, 0x58, 0xC6, 
+0x18, 0xC6, 0x18, 0xC6, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0xB2, 0x94, 
+0x90, 0x94, 0x52, 0x94, 0x52, 0x8C, 0xF0, 0x8B, 0x38, 0x04, 0x19, 0x04, 0x18, 0x04, 0xD9, 0x0B, 0xF8, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 
+0x38, 0x04, 0x18, 0x04, 0x18, 0x04, 0xD7, 0x03, 0x97, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3D, 0xE7, 0x3D, 0xE7, 0x55, 0xB5, 0x14, 0x03, 0xF8, 0x03, 0x17, 0x04, 0xF8, 0x03, 0xD7, 0x03, 0xF8, 0x03, 
+0xF7, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0x19, 0x04, 0xF8, 0x03, 0xF7, 0x0B, 0xF8, 0x03, 0xD7, 0x03, 0xF4, 0x5B, 0xF6, 0xBD, 
+0xF7, 0xBD, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x92, 0x94, 
+0x70, 0x8C, 0x70, 0x84, 0x31, 0x84, 0xF2, 0x4B, 0x18, 0x04, 0x19, 0x04, 0x18, 0x04, 0x17, 0x0C, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 
+0x18, 0x04, 0xD7, 0x03, 0xB7, 0x03, 0x75, 0x03, 0x56, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x5D, 0xE7, 0x55, 0xAD, 0xF4, 0x02, 0xF8, 0x03, 0x17, 0x04, 0xF8, 0x03, 0xD8, 0x03, 0x18, 0x04, 
+0xF7, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF8, 0x03, 0x18, 0x04, 0xF9, 0x03, 0xD7, 0x0B, 0xF7, 0x03, 0xF8, 0x03, 0x19, 0x0C, 0xF6, 0x13, 0x18, 0xBE, 
+0xD7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x71, 0x8C, 
+0x72, 0x84, 0x50, 0x7C, 0x0C, 0x8C, 0x18, 0x0C, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x37, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF8, 0x03, 
+0xB6, 0x03, 0x76, 0x03, 0x56, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x5D, 0xE7, 0x55, 0xAD, 0x14, 0x03, 0xF8, 0x03, 0x17, 0x04, 0xF8, 0x03, 0xD8, 0x03, 0xF7, 0x03, 
+0xF7, 0x03, 0xF7, 0x03, 0xF8, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF7, 0x03, 0xD7, 0x03, 0xF8, 0x03, 0xD6, 0x0B, 0x58, 0x04, 0x18, 0x04, 0xD9, 0x03, 0xF8, 0x03, 0x50, 0x43, 
+0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 
+0x51, 0x7C, 0xF0, 0x83, 0xCF, 0x6B, 0xBB, 0x03, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF8, 0x0B, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xB7, 0x03, 0x97, 0x03, 
+0x55, 0x03, 0x35, 0x03, 0x55, 0x03, 0x35, 0x0B, 0x36, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xDF, 0x75, 0xAD, 0x15, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF7, 0x03, 0xF7, 0x03, 
+0xF7, 0x03, 0xF7, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0x17, 0x04, 0xF8, 0x03, 0xF6, 0x03, 0xD7, 0x03, 0x18, 0x04, 0x18, 0x04, 0xFA, 0x03, 0x92, 0x1B, 
+0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x30, 0x84, 
+0x0E, 0x84, 0xCF, 0x83, 0x37, 0x14, 0xD9, 0x03, 0xF7, 0x03, 0x18, 0x04, 0xF8, 0x03, 0x19, 0x04, 0x38, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF7, 0x03, 0xD7, 0x03, 0x96, 0x03, 0x55, 0x03, 0x35, 0x03, 
+0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x14, 0x03, 0xD7, 0x03, 0xD6, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xD7, 0x03, 
+0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xB7, 0x03, 0x58, 0x04, 0xB7, 0x03, 0x58, 0x04, 0x18, 0x04, 0x97, 0x03, 0x17, 0x14, 
+0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x30, 0x84, 0x10, 0x84, 
+0xCE, 0x83, 0xEE, 0x73, 0x18, 0x04, 0x17, 0x04, 0xF7, 0x03, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF7, 0x03, 0xB7, 0x03, 0x76, 0x03, 0x55, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 
+0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x55, 0xB5, 0xD4, 0x02, 0x76, 0x03, 0x75, 0x03, 0xB7, 0x03, 0xD7, 0x03, 0xD7, 0x03, 
+0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF8, 0x03, 0xD7, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0xB6, 0x0B, 0x78, 0x04, 0x96, 0x03, 
+0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 
+0xD0, 0x73, 0xEE, 0x6B, 0x33, 0x2B, 0x38, 0x04, 0xF8, 0x03, 0x3A, 0x04, 0x17, 0x04, 0xB6, 0x0B, 0x76, 0x03, 0x55, 0x03, 0x55, 0x03, 0x35, 0x03, 0x15, 0x03, 0x35, 0x03, 0x35, 0x03, 0x55, 0x03, 
+0x15, 0x03, 0x15, 0x03, 0x35, 0x03, 0x35, 0x03, 0x56, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x1D, 0xE7, 0x3C, 0xE7, 0x76, 0xAD, 0x14, 0x03, 0x34, 0x03, 0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 0x14, 0x03, 
+0x96, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0x39, 0x04, 0xF6, 0x03, 0xF7, 0x03, 0x58, 0x04, 0xF8, 0x03, 0xD5, 0x0B, 0x37, 0x04, 0xD7, 0x03, 0x58, 0x04, 0xB7, 0x03, 0x18, 0x04, 0xF8, 0x03, 0x73, 0x03, 
+0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 
+0xCF, 0x73, 0x8E, 0x73, 0x90, 0x63, 0x15, 0x0C, 0xB6, 0x03, 0x56, 0x03, 0x14, 0x0B, 0x54, 0x03, 0x55, 0x03, 0x34, 0x03, 0x14, 0x03, 0x35, 0x03, 0x56, 0x03, 0x57, 0x03, 0x55, 0x03, 0x53, 0x0B, 
+0x54, 0x03, 0x37, 0x03, 0x16, 0x03, 0x35, 0x03, 0x36, 0x03, 0x54, 0x03, 0x95, 0xAD, 0x3D, 0xE7, 0x3C, 0xE7, 0x56, 0xAD, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 0x14, 0x03, 
+0xF4, 0x02, 0xF2, 0x02, 0x36, 0x03, 0x13, 0x03, 0x57, 0x03, 0xB7, 0x0B, 0xD7, 0x03, 0x17, 0x04, 0xF8, 0x03, 0xD8, 0x03, 0x17, 0x04, 0xD7, 0x03, 0x17, 0x0C, 0xF7, 0x03, 0xDA, 0x03, 0x74, 0xA5, 
+0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 
+0xAD, 0x6B, 0x6B, 0x83, 0x8E, 0x6B, 0x30, 0x53, 0x14, 0x13, 0xB2, 0x12, 0x14, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x34, 0x03, 0x54, 0x03, 0x54, 0x03, 0x13, 0x03, 0x15, 0x03, 0x15, 0x03, 
+0x14, 0x03, 0x33, 0x03, 0x13, 0x03, 0x93, 0x03, 0x14, 0x1B, 0x17, 0x03, 0x74, 0xAD, 0x3E, 0xE7, 0x5C, 0xE7, 0x56, 0xAD, 0xF3, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 0xF4, 0x02, 
+0x54, 0x03, 0xF4, 0x02, 0xD2, 0x0A, 0xD6, 0x02, 0x34, 0x03, 0xF3, 0x02, 0xD2, 0x02, 0x35, 0x03, 0x16, 0x03, 0x34, 0x03, 0x56, 0x03, 0x76, 0x03, 0xB6, 0x03, 0xF5, 0x02, 0x32, 0xA5, 0x13, 0xBD, 
+0x14, 0xA5, 0xF3, 0x9C, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 
+0x8F, 0x63, 0x6C, 0x63, 0x6B, 0x6B, 0xEB, 0x7A, 0xCB, 0x62, 0xCB, 0x5A, 0xEA, 0x5A, 0xAB, 0x62, 0x88, 0x5A, 0xAB, 0x42, 0xF2, 0x12, 0x14, 0x03, 0x14, 0x03, 0x15, 0x03, 0x14, 0x03, 0x56, 0x03, 
+0x15, 0x03, 0x15, 0x03, 0x54, 0x03, 0x54, 0x03, 0x16, 0x03, 0x54, 0x0B, 0x75, 0xB5, 0x1A, 0xEF, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0xF3, 0x02, 0xF4, 0x02, 
+0xB1, 0x0A, 0x36, 0x03, 0x34, 0x03, 0x33, 0x03, 0x14, 0x03, 0x33, 0x03, 0x16, 0x03, 0xD1, 0x02, 0x14, 0x03, 0xD2, 0x0A, 0xB1, 0x02, 0x73, 0x02, 0x34, 0xA5, 0x75, 0xB5, 0x56, 0x9D, 0x35, 0xA5, 
+0xF3, 0x9C, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 
+0x4E, 0x73, 0x6D, 0x5B, 0x4B, 0x63, 0x4C, 0x53, 0x0B, 0x63, 0x4D, 0x43, 0xEC, 0x52, 0x8C, 0x5A, 0xCA, 0x4A, 0xAB, 0x3A, 0x49, 0x4A, 0x29, 0x4A, 0x28, 0x4A, 0x4A, 0x3A, 0xD2, 0x0A, 0x36, 0x03, 
+0x74, 0x03, 0x32, 0x03, 0x99, 0x03, 0x16, 0x03, 0x39, 0x03, 0x14, 0x13, 0xB6, 0xAD, 0x5D, 0xDF, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0xF4, 0x02, 0xF4, 0x02, 0xF3, 0x02, 0xF4, 0x02, 
+0x35, 0x03, 0x13, 0x03, 0xD3, 0x02, 0x54, 0x0B, 0xD2, 0x02, 0xF1, 0x02, 0x34, 0x0B, 0xB4, 0x02, 0xD3, 0x02, 0x75, 0xAD, 0xB8, 0xAD, 0x34, 0xAD, 0x58, 0x9D, 0x13, 0xA5, 0xD1, 0xB4, 0x15, 0x8D, 
+0xD3, 0x9C, 0xB2, 0x94, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x6D, 0x6B, 
+0x2C, 0x6B, 0x2B, 0x63, 0x2C, 0x63, 0x0A, 0x63, 0xAB, 0x5A, 0xA9, 0x52, 0xA9, 0x52, 0x88, 0x5A, 0x69, 0x52, 0x48, 0x52, 0x6A, 0x3A, 0x49, 0x3A, 0x27, 0x42, 0x08, 0x3A, 0xC6, 0x41, 0xC8, 0x39, 
+0x55, 0x43, 0xF3, 0x0A, 0xF6, 0x02, 0x53, 0x03, 0x33, 0x03, 0x34, 0x03, 0x96, 0x9D, 0x5C, 0xEF, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x34, 0x03, 0xF4, 0x02, 0xF4, 0x02, 0xF3, 0x02, 0x14, 0x03, 
+0x16, 0x03, 0x32, 0x13, 0xB2, 0x0A, 0xD4, 0x02, 0xF4, 0x02, 0x54, 0x12, 0xD6, 0xA5, 0x96, 0xB5, 0x76, 0xB5, 0xB5, 0xB5, 0xF6, 0x9C, 0x73, 0xA5, 0x35, 0xA5, 0x34, 0xA5, 0x15, 0x9D, 0x91, 0xAC, 
+0xB2, 0x94, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 
+0x0B, 0x63, 0xCC, 0x62, 0xED, 0x5A, 0xCC, 0x62, 0xCC, 0x52, 0x8B, 0x5A, 0xCB, 0x52, 0xA9, 0x4A, 0x69, 0x4A, 0x49, 0x42, 0x06, 0x4A, 0x07, 0x42, 0x07, 0x3A, 0xC6, 0x41, 0xA7, 0x31, 0x86, 0x31, 
+0xA6, 0x21, 0x65, 0x29, 0x45, 0x29, 0x15, 0x03, 0x14, 0x0B, 0xB6, 0x03, 0x76, 0xBD, 0x3C, 0xE7, 0x5C, 0xE7, 0x75, 0xAD, 0x13, 0x03, 0x13, 0x03, 0xF4, 0x02, 0x14, 0x03, 0xF3, 0x02, 0xF4, 0x02, 
+0xF4, 0x02, 0x14, 0x03, 0x75, 0x02, 0x3A, 0xB6, 0x18, 0xCE, 0x75, 0xAD, 0xB7, 0xAD, 0x96, 0xB5, 0x96, 0xAD, 0xF3, 0xAC, 0x73, 0xBD, 0x35, 0x95, 0xF1, 0xAC, 0xF2, 0x94, 0xF5, 0x9C, 0x92, 0x94, 
+0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x2C, 0x63, 
+0x2C, 0x6B, 0xED, 0x5A, 0xCB, 0x52, 0xAC, 0x52, 0xA9, 0x52, 0x8B, 0x52, 0x69, 0x52, 0x27, 0x4A, 0x69, 0x42, 0x28, 0x42, 0x09, 0x3A, 0xC8, 0x39, 0xC8, 0x39, 0xC8, 0x31, 0xA5, 0x39, 0xC5, 0x31, 
+0x87, 0x29, 0xA5, 0x29, 0xA4, 0x30, 0x24, 0x31, 0x23, 0x21, 0x70, 0x02, 0xB6, 0xAD, 0x1C, 0xE7, 0x5C, 0xE7, 0x75, 0xAD, 0xF3, 0x02, 0x13, 0x03, 0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 0xF4, 0x02, 
+0xB3, 0x02, 0x94, 0x4B, 0x35, 0xBE, 0xB6, 0xB5, 0xD7, 0xAD, 0xD5, 0xB5, 0x56, 0xAD, 0x74, 0xAD, 0x54, 0xA5, 0x55, 0xA5, 0x13, 0xA5, 0xD5, 0x94, 0x34, 0xA5, 0x91, 0xAC, 0xB2, 0x84, 0xD2, 0x94, 
+0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x0C, 0x63, 
+0xE9, 0x5A, 0xEA, 0x52, 0xCB, 0x52, 0xC8, 0x5A, 0x68, 0x52, 0x68, 0x4A, 0x6A, 0x42, 0x48, 0x42, 0x07, 0x42, 0x08, 0x3A, 0xE7, 0x39, 0xE6, 0x39, 0xC6, 0x31, 0xA6, 0x31, 0x86, 0x29, 0x66, 0x29, 
+0x26, 0x29, 0x42, 0x31, 0x65, 0x19, 0x03, 0x21, 0x05, 0x19, 0xE4, 0x18, 0x36, 0xC5, 0x5D, 0xE7, 0x3C, 0xEF, 0xD7, 0xB5, 0xF1, 0x0A, 0x34, 0x03, 0x33, 0x03, 0xD5, 0x0A, 0x72, 0x02, 0x17, 0xC6, 
+0xF7, 0xBD, 0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x92, 0x94, 
+0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xEB, 0x5A, 
+0xCB, 0x5A, 0xAA, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x08, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 
+0x45, 0x21, 0x04, 0x21, 0xE3, 0x18, 0x04, 0x21, 0xC3, 0x18, 0xE3, 0x18, 0xD6, 0xB5, 0x5C, 0xE7, 0x9C, 0xEF, 0x19, 0xB6, 0x31, 0x1B, 0xB4, 0x02, 0x91, 0x02, 0x74, 0x84, 0x37, 0xB6, 0x19, 0xB6, 
+0xF7, 0xBD, 0xD7, 0xBD, 0xB6, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x71, 0x8C, 
+0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x6D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 
+0xAA, 0x52, 0x8A, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x08, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x21, 
+0x04, 0x21, 0xE3, 0x18, 0xE3, 0x18, 0xE3, 0x18, 0xA2, 0x10, 0xA2, 0x10, 0x58, 0xC6, 0x7D, 0xEF, 0xBD, 0xF7, 0x79, 0xD6, 0x71, 0x2B, 0x95, 0x12, 0x79, 0xBE, 0x17, 0xD6, 0x36, 0xB6, 0xD6, 0xC5, 
+0xB6, 0xB5, 0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 
+0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xEB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 
+0x8A, 0x52, 0x69, 0x4A, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xE7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0x86, 0x31, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 
+0x04, 0x21, 0xE3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC2, 0x10, 0x41, 0x08, 0xBA, 0xD6, 0x9E, 0xF7, 0x7D, 0xFF, 0x5C, 0xDF, 0x34, 0x6C, 0x58, 0xC6, 0xF7, 0xC5, 0x14, 0xB6, 0xF9, 0xB5, 0x96, 0xC5, 
+0xB6, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 
+0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x8A, 0x52, 
+0x69, 0x4A, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0xE3, 0x18, 
+0xA2, 0x10, 0xE3, 0x18, 0xC3, 0x10, 0x81, 0x08, 0xA2, 0x10, 0x9A, 0xD6, 0xFB, 0xDE, 0x9E, 0xF7, 0xFF, 0xF7, 0x5D, 0xEF, 0xD7, 0xC5, 0x38, 0xC6, 0xF5, 0xBD, 0x38, 0xBE, 0xB8, 0xB5, 0x96, 0xB5, 
+0x96, 0xB5, 0x75, 0xAD, 0x55, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x30, 0x84, 0x10, 0x84, 
+0xEF, 0x7B, 0xCF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x8A, 0x52, 0x69, 0x4A, 
+0x49, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0xE3, 0x18, 0xE3, 0x18, 
+0xC2, 0x10, 0xA2, 0x10, 0x81, 0x08, 0x82, 0x10, 0x62, 0x08, 0xB7, 0xB5, 0x5D, 0xE7, 0xBE, 0xF7, 0xFD, 0xE7, 0xBF, 0xFF, 0x7B, 0xD6, 0x38, 0xB6, 0xF9, 0xCD, 0x75, 0xB5, 0xB4, 0xB5, 0x96, 0xB5, 
+0x75, 0xAD, 0x55, 0xAD, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 
+0xCF, 0x7B, 0xAE, 0x73, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x2C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0xAA, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x49, 0x4A, 
+0x28, 0x42, 0x28, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0xE3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 
+0xA2, 0x10, 0xA2, 0x10, 0x61, 0x08, 0xA3, 0x10, 0xAB, 0x52, 0xBB, 0xD6, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xDF, 0x7E, 0xEF, 0x1C, 0xC6, 0xB4, 0xB5, 0x97, 0xAD, 0x56, 0xBD, 0x72, 0xA5, 
+0x55, 0xAD, 0x34, 0xA5, 0x14, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0xB2, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 
+0xAE, 0x73, 0x8E, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x8A, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 
+0x08, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0xA6, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0xE3, 0x18, 0xC3, 0x18, 0xA2, 0x10, 0xA2, 0x10, 
+0xA2, 0x10, 0x20, 0x00, 0x82, 0x10, 0x41, 0x08, 0xBB, 0xD6, 0x1C, 0xE7, 0xBE, 0xF7, 0xDE, 0xF7, 0xBF, 0xFF, 0xDE, 0xFF, 0x9D, 0xF7, 0x3A, 0xD7, 0xDB, 0xC5, 0xB6, 0xA5, 0x75, 0xAD, 0x55, 0xAD, 
+0x34, 0xA5, 0x14, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 
+0x8E, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x2C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0xAA, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x28, 0x42, 
+0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0xA6, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0xE3, 0x18, 0xC3, 0x18, 0xA2, 0x10, 0x82, 0x10, 0x82, 0x10, 
+0x41, 0x00, 0x82, 0x10, 0x21, 0x00, 0x39, 0xC6, 0xDB, 0xDE, 0xDF, 0xFF, 0xDE, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0x79, 0xCE, 0x75, 0xAD, 0x14, 0xA5, 0x75, 0xAD, 
+0x34, 0xA5, 0xF3, 0x9C, 0x13, 0x9D, 0xB1, 0x94, 0xF2, 0x9C, 0x92, 0x8C, 0x92, 0x94, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0xAE, 0x73, 
+0x6D, 0x6B, 0x6D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x2C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xEB, 0x5A, 0xAA, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x69, 0x4A, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x08, 0x42, 
+0xE7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0xA6, 0x31, 0x86, 0x31, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x04, 0x21, 0x24, 0x21, 0x04, 0x21, 0xA2, 0x10, 0xC2, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 
+0x41, 0x08, 0x61, 0x08, 0xC3, 0x18, 0x59, 0xCE, 0x5D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x1C, 0xE7, 0x38, 0xC6, 0x55, 0xAD, 0xD3, 0x9C, 
+0xF4, 0x9C, 0xF3, 0x9C, 0xF3, 0x9C, 0xB2, 0x94, 0x92, 0x94, 0x91, 0x8C, 0x71, 0x8C, 0x51, 0x8C, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x8E, 0x73, 
+0x6D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x2C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0xAA, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x28, 0x42, 0xE7, 0x39, 0xC7, 0x39, 
+0xC7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0x44, 0x21, 0xE3, 0x18, 0xC2, 0x10, 0xE3, 0x18, 0xA2, 0x10, 0xC3, 0x18, 0x41, 0x08, 0x61, 0x08, 
+0x20, 0x00, 0x20, 0x00, 0xD7, 0xBD, 0x5D, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 0x18, 0xC6, 0x14, 0xA5, 
+0xD3, 0x9C, 0xD4, 0x9C, 0x93, 0x94, 0x91, 0x8C, 0x70, 0x8C, 0x72, 0x8C, 0x51, 0x84, 0x30, 0x84, 0x10, 0x84, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 
+0x2C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x8A, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x28, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 
+0x86, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0xE3, 0x18, 0x81, 0x10, 0xE3, 0x18, 0xC2, 0x10, 0x81, 0x08, 0x81, 0x08, 0x40, 0x00, 0x41, 0x08, 0x20, 0x00, 
+0xE3, 0x18, 0x18, 0xC6, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x1C, 0xE7, 0x59, 0xCE, 
+0xB5, 0x9C, 0x92, 0x94, 0x51, 0x8C, 0x73, 0x8C, 0x93, 0x94, 0x71, 0x8C, 0x2F, 0x84, 0xF0, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 
+0x0C, 0x63, 0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0xAA, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x49, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xE7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 
+0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0xE3, 0x18, 0xE3, 0x18, 0x03, 0x21, 0xA2, 0x10, 0x82, 0x10, 0x61, 0x08, 0x41, 0x00, 0x41, 0x00, 0x00, 0x00, 0x39, 0xC6, 
+0x59, 0xCE, 0x1C, 0xE7, 0xBE, 0xF7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 
+0xBB, 0xD6, 0xB8, 0xB5, 0xD5, 0x9C, 0x50, 0x84, 0x50, 0x84, 0xD0, 0x7B, 0xF0, 0x7B, 0x0E, 0x7C, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x0C, 0x63, 
+0x0C, 0x63, 0xEB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x49, 0x4A, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0x86, 0x31, 0x65, 0x29, 
+0x65, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0xE3, 0x18, 0xC3, 0x18, 0xA2, 0x10, 0xA2, 0x10, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x62, 0x08, 0x21, 0x00, 0x49, 0x4A, 0x39, 0xC6, 0x9B, 0xD6, 
+0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBF, 0xF7, 0x1C, 0xE7, 0xBA, 0xD6, 0xF8, 0xBD, 0x97, 0xB5, 0x70, 0x8C, 0x2F, 0x84, 0xCF, 0x7B, 0xAE, 0x73, 0x8E, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0x4D, 0x6B, 0x4D, 0x6B, 0x2C, 0x63, 0x2C, 0x63, 
+0xEB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0xAA, 0x52, 0x8A, 0x52, 0x69, 0x4A, 0x69, 0x4A, 0x49, 0x4A, 0x08, 0x42, 0x08, 0x42, 0xE7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xA6, 0x31, 0x86, 0x31, 0x86, 0x31, 
+0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0xE3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xA2, 0x10, 0x61, 0x08, 0x82, 0x10, 0x41, 0x08, 0x31, 0x84, 0x39, 0xC6, 0x7A, 0xCE, 0x3D, 0xE7, 0x9F, 0xF7, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBF, 0xF7, 0xBF, 0xF7, 0x5C, 0xE7, 0x1B, 0xDF, 0x39, 0xC6, 0xF8, 0xBD, 0xD6, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x55, 0xAD, 
+0x96, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 
+0x75, 0xAD, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0xD7, 0xB5, 0x17, 0xBE, 0x7A, 0xCE, 0xFC, 0xDE, 0x9E, 0xEF, 0x9E, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0xF7, 0xDE, 0xF7, 0x9E, 0xF7, 0x7D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x3C, 0xE7, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 
+0x5D, 0xEF, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 
+0x3C, 0xE7, 0x3C, 0xE7, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x9D, 0xF7, 0x5D, 0xEF, 0xDF, 0xF7, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+};
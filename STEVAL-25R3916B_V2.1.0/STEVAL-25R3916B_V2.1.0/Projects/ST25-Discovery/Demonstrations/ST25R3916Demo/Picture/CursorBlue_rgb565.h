@@ -0,0 +1,20 @@
+/* 19x13 RGB565 raw picture converted from CursorBlue_jpg.h by pict2rgb565, 510 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char CursorBlue[] = {
+0x52, 0x35, 0x36, 0x35, 0x00, 0x00, 0x13, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFE, 0xAE, 0x3C, 0x4E, 0x3A, 0x25, 0x5B, 0x25, 0x9D, 0x2D, 0x9C, 0x15, 0x3C, 0x2D, 
+0x7C, 0x25, 0x5C, 0x25, 0x5B, 0x2D, 0x5B, 0x25, 0x5C, 0x25, 0x5C, 0x25, 0x5C, 0x25, 0x5C, 0x2D, 0x5D, 0x2D, 0xFB, 0x4D, 0xFF, 0xA6, 0xFF, 0xE7, 0xBA, 0x5D, 0x3F, 0xBF, 0xFF, 0xEF, 0xDF, 0xEF, 
+0x5E, 0xF7, 0xFF, 0xEF, 0xBF, 0xF7, 0xFF, 0xEF, 0xDF, 0xEF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xEF, 0x9F, 0xC7, 0x1C, 0x66, 0x5F, 0xCF, 0x7B, 0x1D, 
+0x9F, 0xE7, 0x3F, 0xC7, 0x5D, 0xB7, 0x3C, 0xC7, 0x9F, 0xBF, 0x3F, 0xB7, 0x5F, 0xC7, 0x5F, 0xCF, 0x9F, 0xDF, 0x9F, 0xDF, 0xBF, 0xE7, 0xBF, 0xE7, 0x9F, 0xE7, 0xBF, 0xE7, 0xBD, 0xFF, 0xFF, 0xEF, 
+0x5C, 0x2D, 0x5D, 0xD7, 0x9B, 0x1D, 0xDF, 0xF7, 0xDD, 0xAE, 0x7E, 0xB7, 0x3B, 0xBF, 0x1E, 0xBF, 0x5E, 0xD7, 0x3E, 0xC7, 0x5D, 0xCF, 0xBE, 0xDF, 0xBE, 0xE7, 0xBE, 0xE7, 0xDF, 0xE7, 0xBE, 0xE7, 
+0xDE, 0xEF, 0xBE, 0xDF, 0xFF, 0xF7, 0x1C, 0x1D, 0x7F, 0xD7, 0x1C, 0x25, 0x9F, 0xFF, 0x1F, 0xBF, 0x3F, 0xBF, 0x5D, 0xB7, 0x3E, 0xB7, 0x7D, 0xBF, 0x3E, 0xC7, 0x5E, 0xCF, 0x9F, 0xDF, 0xBF, 0xE7, 
+0xBF, 0xE7, 0xBF, 0xEF, 0xBE, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xDF, 0xFF, 0x5B, 0x25, 0xBE, 0xC7, 0x5C, 0x25, 0xDD, 0xE7, 0x1F, 0xB7, 0xDD, 0xBE, 0x5E, 0xBF, 0x7F, 0xCF, 0x1E, 0xC7, 0x5F, 0xC7, 
+0x7F, 0xCF, 0xBF, 0xDF, 0xBF, 0xE7, 0xBF, 0xE7, 0xBF, 0xE7, 0xBF, 0xE7, 0xDF, 0xEF, 0x9E, 0xE7, 0x9D, 0xFF, 0x9B, 0x25, 0x7F, 0xD7, 0x5E, 0x2D, 0xDD, 0xE7, 0x3F, 0xB7, 0x5E, 0xBF, 0x1E, 0xBF, 
+0x1D, 0xBF, 0x1F, 0xC7, 0x5F, 0xC7, 0x5E, 0xCF, 0x9E, 0xDF, 0x9E, 0xDF, 0x9E, 0xE7, 0xBF, 0xE7, 0xBF, 0xE7, 0xBF, 0xE7, 0xFF, 0xEF, 0xFE, 0xF7, 0x5D, 0x1D, 0x5E, 0xD7, 0x5C, 0x25, 0xFE, 0xEF, 
+0xFE, 0xBE, 0x3E, 0xB7, 0x1F, 0xC7, 0x9D, 0xB7, 0x5F, 0xB7, 0x3F, 0xC7, 0x5E, 0xCF, 0x9F, 0xDF, 0x9E, 0xE7, 0xBE, 0xE7, 0xBF, 0xEF, 0xBF, 0xE7, 0xBF, 0xEF, 0x9F, 0xEF, 0xFE, 0xFF, 0x3D, 0x25, 
+0x5E, 0xD7, 0x7D, 0x15, 0xBF, 0xFF, 0xDE, 0xB6, 0x3E, 0xBF, 0x3F, 0xC7, 0x1F, 0xBF, 0x3F, 0xCF, 0x5E, 0xBF, 0x5E, 0xC7, 0x9E, 0xDF, 0xBE, 0xEF, 0xDF, 0xE7, 0xBE, 0xEF, 0xDF, 0xE7, 0xBE, 0xEF, 
+0xBF, 0xDF, 0xDF, 0xFF, 0x3D, 0x1D, 0x7D, 0xDF, 0x9B, 0x25, 0xBF, 0xDF, 0x7E, 0xB7, 0x9C, 0xAF, 0x3E, 0xB7, 0x3E, 0xB7, 0x3E, 0xBF, 0x5F, 0xCF, 0x7F, 0xCF, 0x7F, 0xE7, 0xBF, 0xE7, 0x9F, 0xDF, 
+0x9F, 0xE7, 0xDF, 0xE7, 0xDF, 0xEF, 0xFD, 0xEF, 0xBD, 0xEF, 0x9C, 0x2D, 0x1F, 0xB7, 0x7C, 0x2D, 0x1F, 0xC7, 0xBF, 0xEF, 0xDE, 0xEF, 0xBF, 0xF7, 0xFF, 0xF7, 0xFF, 0xE7, 0xBF, 0xEF, 0xDF, 0xEF, 
+0xDF, 0xFF, 0xFF, 0xF7, 0xDE, 0xF7, 0xFF, 0xFF, 0xDE, 0xEF, 0xFE, 0xF7, 0xFF, 0xF7, 0x3D, 0xCF, 0x3C, 0x5E, 0xBF, 0xCF, 0xDC, 0x45, 0x5B, 0x35, 0x5D, 0x2D, 0x7C, 0x1D, 0x3E, 0x2D, 0x3B, 0x2D, 
+0xF9, 0x1C, 0x5C, 0x2D, 0x7C, 0x25, 0x7D, 0x2D, 0x3C, 0x15, 0x7C, 0x2D, 0x7D, 0x35, 0x7C, 0x25, 0x7C, 0x2D, 0x5D, 0x1D, 0xDD, 0x55, 0xDF, 0xA6, 0xBE, 0xFF, 0x7E, 0xCF, 0x3E, 0xAF, 0x1E, 0xBF, 
+0x3D, 0xAF, 0xFF, 0xB6, 0x3E, 0xB7, 0x7F, 0xAF, 0x1E, 0xAF, 0xBC, 0x96, 0xBD, 0x9E, 0xFC, 0x6D, 0xFD, 0xB6, 0xFF, 0xB6, 0x1E, 0xB7, 0x1E, 0xBF, 0x5D, 0xD7, 0xFE, 0xE7, 0xFF, 0xFF, 
+};
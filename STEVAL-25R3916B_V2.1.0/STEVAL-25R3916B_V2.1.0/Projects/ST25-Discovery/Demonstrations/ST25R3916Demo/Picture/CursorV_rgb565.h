@@ -0,0 +1,20 @@
+/* 19x13 RGB565 raw picture converted from CursorV_jpg.h by pict2rgb565, 510 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char CursorV[] = {
+0x52, 0x35, 0x36, 0x35, 0x00, 0x00, 0x13, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x38, 0xC6, 0x92, 0x94, 0x8E, 0x73, 0x4D, 0x6B, 0x8E, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 
+0x8E, 0x73, 0x4D, 0x6B, 0x8E, 0x73, 0x6D, 0x6B, 0x6D, 0x6B, 0x6D, 0x6B, 0x8E, 0x73, 0x6D, 0x6B, 0x6D, 0x6B, 0x92, 0x94, 0x38, 0xC6, 0xBE, 0xF7, 0x51, 0x8C, 0xDB, 0xDE, 0xBE, 0xF7, 0x7D, 0xEF, 
+0x9E, 0xF7, 0xBE, 0xF7, 0xBE, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFB, 0xDE, 0xB2, 0x94, 0x1C, 0xE7, 0x6D, 0x6B, 
+0x7D, 0xEF, 0xDB, 0xDE, 0x9A, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0x9A, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0x5D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0xBE, 0xF7, 0xDF, 0xFF, 
+0x8E, 0x73, 0xDB, 0xDE, 0xAE, 0x73, 0x7D, 0xEF, 0x38, 0xC6, 0x9A, 0xD6, 0x79, 0xCE, 0x9A, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x5D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x9E, 0xF7, 
+0x9E, 0xF7, 0x1C, 0xE7, 0xFF, 0xFF, 0x6D, 0x6B, 0x1C, 0xE7, 0x8E, 0x73, 0x9E, 0xF7, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x7D, 0xEF, 0x7D, 0xEF, 
+0x9E, 0xF7, 0x7D, 0xEF, 0x9E, 0xF7, 0xBE, 0xF7, 0xBE, 0xF7, 0xFF, 0xFF, 0x6D, 0x6B, 0x3C, 0xE7, 0x6D, 0x6B, 0xBE, 0xF7, 0x79, 0xCE, 0x59, 0xCE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xDB, 0xDE, 0x5D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x5D, 0xEF, 0x9E, 0xF7, 0x6D, 0x6B, 0x1C, 0xE7, 0x4D, 0x6B, 0xBE, 0xF7, 0x79, 0xCE, 0xBA, 0xD6, 0xDB, 0xDE, 
+0x79, 0xCE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x5D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x9E, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0xFF, 0xFF, 0x8E, 0x73, 0xFB, 0xDE, 0x8E, 0x73, 0xBE, 0xF7, 
+0x79, 0xCE, 0x79, 0xCE, 0x9A, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0x5D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x9E, 0xF7, 0x7D, 0xEF, 0x7D, 0xEF, 0xFF, 0xFF, 0x6D, 0x6B, 
+0xFB, 0xDE, 0xAE, 0x73, 0x9E, 0xF7, 0x59, 0xCE, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0xDB, 0xDE, 0x9A, 0xD6, 0xFB, 0xDE, 0x5D, 0xEF, 0x7D, 0xEF, 0x9E, 0xF7, 0x7D, 0xEF, 0x7D, 0xEF, 0x9E, 0xF7, 
+0x7D, 0xEF, 0xFF, 0xFF, 0x6D, 0x6B, 0xFB, 0xDE, 0x6D, 0x6B, 0x9E, 0xF7, 0xDB, 0xDE, 0x79, 0xCE, 0xFB, 0xDE, 0xDB, 0xDE, 0x9A, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0x5D, 0xEF, 0x3C, 0xE7, 0x9E, 0xF7, 
+0x7D, 0xEF, 0xBE, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0xBE, 0xF7, 0x8E, 0x73, 0x9A, 0xD6, 0x8E, 0x73, 0xDB, 0xDE, 0x9E, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xBA, 0xD6, 0xB2, 0x94, 0x3C, 0xE7, 0x51, 0x8C, 0x6D, 0x6B, 0x6D, 0x6B, 0xAE, 0x73, 0x6D, 0x6B, 0x6D, 0x6B, 
+0x8E, 0x73, 0x8E, 0x73, 0x6D, 0x6B, 0xAE, 0x73, 0x4D, 0x6B, 0x6D, 0x6B, 0xAE, 0x73, 0x6D, 0x6B, 0x8E, 0x73, 0x6D, 0x6B, 0x71, 0x8C, 0x38, 0xC6, 0x7D, 0xEF, 0x3C, 0xE7, 0x79, 0xCE, 0x79, 0xCE, 
+0x9A, 0xD6, 0x79, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x59, 0xCE, 0xB6, 0xB5, 0xD7, 0xBD, 0x92, 0x94, 0x79, 0xCE, 0x59, 0xCE, 0x9A, 0xD6, 0x79, 0xCE, 0xDB, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 
+};
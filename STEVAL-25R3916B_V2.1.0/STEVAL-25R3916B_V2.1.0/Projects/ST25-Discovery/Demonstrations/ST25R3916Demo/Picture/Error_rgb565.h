@@ -0,0 +1,61 @@
+/* 30x30 RGB565 raw picture converted from Error_jpg.h by pict2rgb565, 1816 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char Error[] = {
+0x52, 0x35, 0x36, 0x35, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xDE, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xEF, 0x9F, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x9E, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xFF, 0x39, 0xFE, 0x9A, 0xF6, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDE, 0xEF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0x52, 0xF4, 0x14, 0xFD, 0xB3, 0xFC, 0x93, 0xF4, 0xFE, 0xF7, 0xBF, 0xFF, 0xBE, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x17, 0xF6, 0x11, 0xFC, 
+0x6E, 0xFB, 0x4D, 0xFB, 0xAF, 0xFB, 0x37, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFE, 0xFF, 0xDE, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xF7, 0xBF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xF1, 0xF3, 0xEF, 0xFB, 0xEC, 0xFA, 0xEB, 0xFA, 
+0xAD, 0xFB, 0xD0, 0xFB, 0xDD, 0xEF, 0xDF, 0xFF, 0xFF, 0xF7, 0xDE, 0xF7, 0xDF, 0xFF, 0xDF, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xF7, 0x55, 0xE5, 0x11, 0xFC, 0x2D, 0xFB, 0x6D, 0xFB, 0x6A, 0xFA, 0x89, 0xF2, 0x2D, 0xFB, 
+0x96, 0xFD, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xF7, 0xBF, 0xFF, 0x5C, 0xFF, 0xD1, 0xFB, 0x8E, 0xFB, 0xEB, 0xFA, 0x8A, 0xF2, 0xAB, 0xFA, 0x49, 0xFA, 0x89, 0xEA, 0x6F, 0xFB, 0x9C, 0xFF, 
+0xBE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0x93, 0xFC, 0xAF, 0xFB, 0x2C, 0xFB, 0xEA, 0xFA, 0x8A, 0xFA, 0x29, 0xFA, 0x08, 0xFA, 0xE9, 0xF9, 0xCA, 0xE2, 0x92, 0xF4, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xBF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xDE, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xF7, 0x57, 0xF6, 0xEF, 0xFB, 0x6C, 0xFB, 0x0C, 0xF3, 0x27, 0xFA, 0x8D, 0xFA, 0x69, 0xF2, 0x85, 0xF9, 0xC5, 0xF9, 0x88, 0xF9, 0xEC, 0xFA, 0x98, 0xFE, 0xFF, 0xF7, 0xBE, 0xFF, 0xDF, 0xF7, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0x9D, 0xF7, 0xB3, 0xFC, 
+0x6E, 0xFB, 0xCB, 0xFA, 0x6A, 0xFA, 0x70, 0xFC, 0xDB, 0xFE, 0xD8, 0xFE, 0xAE, 0xF3, 0x44, 0xF9, 0x86, 0xF1, 0xC7, 0xF9, 0x30, 0xF4, 0xBE, 0xFF, 0xDF, 0xFF, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xF6, 0xED, 0x8E, 0xFB, 0xEC, 0xF2, 0x0B, 0xFB, 
+0x28, 0xFA, 0xDB, 0xFE, 0xFF, 0xF7, 0xFE, 0xFF, 0xBA, 0xFE, 0x03, 0xF9, 0x43, 0xF1, 0x04, 0xF9, 0x49, 0xFA, 0xD8, 0xFD, 0xDE, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0x5D, 0xF7, 0x2F, 0xFC, 0x4C, 0xFB, 0xAA, 0xEA, 0xAA, 0xFA, 0x26, 0xF2, 0xFF, 0xFF, 
+0xBF, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xE3, 0xF0, 0xE2, 0xF8, 0xE2, 0xF8, 0x64, 0xF9, 0x2E, 0xFB, 0x5C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0x76, 0xF5, 0x0B, 0xFB, 0xEB, 0xFA, 0xAB, 0xFA, 0xC7, 0xF9, 0x05, 0xFA, 0x7E, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 
+0xFB, 0xFE, 0x81, 0xF0, 0xE3, 0xF8, 0xA2, 0xF8, 0xC0, 0xF8, 0x65, 0xF9, 0x95, 0xF5, 0x9E, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x1A, 0xFF, 0xAF, 0xF3, 0xEB, 0xFA, 0xA9, 0xFA, 0xA9, 0xFA, 0x48, 0xFA, 0xA5, 0xF9, 0x37, 0xF6, 0xDE, 0xFF, 0xFE, 0xEF, 0x95, 0xFD, 0x41, 0xF8, 
+0xE3, 0xF8, 0xA2, 0xF8, 0x40, 0xE8, 0xA1, 0xF0, 0xCB, 0xF2, 0xBA, 0xFE, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0x9D, 0xFF, 0x33, 0xF5, 0xEB, 0xFA, 0xEB, 0xFA, 0x88, 0xFA, 0x47, 0xEA, 0x88, 0xFA, 0x65, 0xF1, 0xD1, 0xFC, 0xFF, 0xFF, 0xDE, 0xFF, 0x10, 0xFC, 0x80, 0xF0, 0xA1, 0xF0, 0x82, 0xF8, 
+0x00, 0xE8, 0x40, 0xF0, 0xE3, 0xF0, 0xB1, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xE7, 0xFF, 0xFF, 0xBF, 0xFF, 0xDF, 0xF7, 0xBA, 0xFE, 
+0x6D, 0xEB, 0x0A, 0xFB, 0x6A, 0xFA, 0x47, 0xFA, 0x07, 0xFA, 0xE6, 0xF9, 0x67, 0xF9, 0x0A, 0xF3, 0xDF, 0xFF, 0xFF, 0xF7, 0xAA, 0xEA, 0xE0, 0xE8, 0x40, 0xF8, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0xE8, 
+0x80, 0xE8, 0x68, 0xE2, 0xDB, 0xE6, 0x9E, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBF, 0xFF, 0xBE, 0xFF, 0xFF, 0xF7, 0x9F, 0xFF, 0xF2, 0xEC, 0x88, 0xFA, 0xCA, 0xFA, 
+0x46, 0xFA, 0x46, 0xF2, 0x27, 0xF2, 0x65, 0xF9, 0xA5, 0xF1, 0x85, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x23, 0xE9, 0x20, 0xE0, 0x20, 0xE8, 0x40, 0xE8, 0x40, 0xE0, 0x20, 0xE8, 0x00, 0xE8, 0xA1, 0xF0, 
+0x10, 0xF4, 0x7D, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 0xFF, 0xF7, 0xBF, 0xFF, 0xBE, 0xF7, 0xDE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x78, 0xEE, 0xAA, 0xE2, 0x4B, 0xFB, 0x27, 0xF2, 0x08, 0xFA, 0xE6, 0xF1, 
+0xC5, 0xE1, 0x84, 0xF9, 0x63, 0xE9, 0xE2, 0xE8, 0x5C, 0xFF, 0x5D, 0xFF, 0x40, 0xD8, 0x20, 0xE0, 0x40, 0xE8, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xE0, 0x60, 0xE8, 0x85, 0xD1, 0x78, 0xF6, 
+0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x5C, 0xF7, 0x0D, 0xE4, 0xAA, 0xFA, 0x49, 0xEA, 0x46, 0xEA, 0x08, 0xF2, 0xC6, 0xF1, 0xA5, 0xE9, 0xA4, 0xF9, 
+0x01, 0xE1, 0x40, 0xD8, 0xB6, 0xF5, 0x75, 0xE5, 0x00, 0xD8, 0x20, 0xD8, 0x40, 0xD8, 0x20, 0xD8, 0x00, 0xE0, 0x20, 0xE0, 0x20, 0xD8, 0x40, 0xD8, 0xC1, 0xE0, 0x4B, 0xD3, 0x9D, 0xFF, 0xBF, 0xF7, 
+0xDD, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xDF, 0xF7, 0xB5, 0xED, 0x67, 0xE2, 0xE9, 0xFA, 0x49, 0xFA, 0x26, 0xEA, 0xE4, 0xE1, 0x62, 0xE9, 0x02, 0xE1, 0xA0, 0xE0, 0x60, 0xD0, 0x00, 0xE0, 
+0x92, 0xE4, 0x91, 0xD4, 0x00, 0xE8, 0x40, 0xD8, 0x40, 0xD0, 0x20, 0xD8, 0x20, 0xE0, 0x20, 0xD8, 0x40, 0xD0, 0x40, 0xD8, 0x60, 0xE0, 0x02, 0xD9, 0xB5, 0xED, 0x9E, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 
+0xBE, 0xF7, 0xFF, 0xF7, 0x5C, 0xEF, 0xEA, 0xDA, 0x0A, 0xFB, 0x68, 0xEA, 0x26, 0xE2, 0xC6, 0xE9, 0x62, 0xE1, 0xC0, 0xE0, 0x80, 0xD8, 0x40, 0xD0, 0x40, 0xD8, 0x20, 0xE8, 0x2C, 0xE3, 0x4A, 0xDB, 
+0x00, 0xE0, 0x40, 0xD8, 0x40, 0xD0, 0x20, 0xE0, 0x20, 0xE0, 0x20, 0xD0, 0x40, 0xD0, 0x40, 0xD8, 0x00, 0xD8, 0xC0, 0xE0, 0x47, 0xD2, 0x7D, 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xF2, 0xE4, 0xA9, 0xEA, 0x68, 0xEA, 0x26, 0xE2, 0xC4, 0xD9, 0xA2, 0xD8, 0x40, 0xD0, 0x00, 0xD0, 0x40, 0xD0, 0x61, 0xD0, 0x41, 0xD8, 0x00, 0xD0, 0xA6, 0xC1, 0x83, 0xC1, 0x20, 0xC8, 0x20, 0xC8, 
+0x40, 0xD0, 0x40, 0xD8, 0x20, 0xD0, 0x40, 0xD0, 0x60, 0xD0, 0x20, 0xD8, 0x62, 0xE0, 0x60, 0xD0, 0xA0, 0xD0, 0xD2, 0xEC, 0xBE, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0xF9, 0xFE, 0x68, 0xCA, 0xE9, 0xEA, 
+0xA5, 0xE9, 0x43, 0xD1, 0xE1, 0xD0, 0x20, 0xC8, 0x41, 0xC8, 0x20, 0xD8, 0x40, 0xD0, 0x80, 0xD0, 0x61, 0xD0, 0x42, 0xC9, 0x51, 0xE4, 0x2E, 0xDC, 0x43, 0xC9, 0x40, 0xC0, 0x40, 0xD8, 0x60, 0xD0, 
+0x40, 0xC8, 0x60, 0xC8, 0x40, 0xD0, 0x40, 0xD0, 0x60, 0xD0, 0x40, 0xC8, 0xA1, 0xD8, 0x84, 0xC9, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0xD3, 0xC7, 0xDA, 0x27, 0xE2, 0x22, 0xD1, 0x60, 0xD0, 
+0x40, 0xD0, 0x60, 0xD0, 0x40, 0xB8, 0x80, 0xD0, 0x40, 0xC8, 0x60, 0xD0, 0x40, 0xC0, 0xE9, 0xCA, 0xDF, 0xFF, 0xFF, 0xF7, 0xA8, 0xDA, 0x80, 0xC0, 0x20, 0xD0, 0x60, 0xD0, 0x60, 0xC0, 0x80, 0xC8, 
+0x40, 0xC8, 0x60, 0xD0, 0x80, 0xD0, 0x62, 0xD0, 0x20, 0xC8, 0xC0, 0xC8, 0xAC, 0xCB, 0xFE, 0xEF, 0x56, 0xEE, 0x47, 0xBA, 0x47, 0xEA, 0x22, 0xD1, 0x80, 0xC0, 0x60, 0xC8, 0x60, 0xC8, 0x60, 0xC0, 
+0x60, 0xC0, 0x80, 0xC8, 0x40, 0xC8, 0x40, 0xC8, 0x80, 0xC0, 0xC6, 0xB9, 0x94, 0xF5, 0x56, 0xDE, 0x43, 0xD1, 0xC1, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x80, 0xC8, 0x60, 0xC0, 0x60, 0xC0, 0x80, 0xC0, 
+0x20, 0xC8, 0x80, 0xC8, 0xA0, 0xC8, 0x40, 0xC0, 0xA4, 0xC0, 0x77, 0xEE, 0xAA, 0xD2, 0xC9, 0xDA, 0xA3, 0xD1, 0x60, 0xC8, 0x40, 0xB8, 0x80, 0xC8, 0x40, 0xC8, 0xA0, 0xC0, 0x60, 0xC8, 0x80, 0xC0, 
+0x80, 0xC0, 0x40, 0xC0, 0x40, 0xC0, 0x40, 0xB8, 0x85, 0xD1, 0x65, 0xB9, 0xA0, 0xC8, 0x60, 0xC0, 0x40, 0xC0, 0x60, 0xC8, 0x60, 0xC8, 0x40, 0xC8, 0x60, 0xC8, 0x80, 0xC8, 0xA1, 0xC0, 0x60, 0xC0, 
+0x40, 0xB8, 0xC0, 0xC0, 0x80, 0xC0, 0x86, 0xB2, 0x65, 0xC1, 0xE5, 0xC9, 0x80, 0xB8, 0x80, 0xC8, 0x80, 0xB8, 0xA0, 0xC0, 0x60, 0xC0, 0x80, 0xB8, 0x60, 0xC0, 0x80, 0xB8, 0xC0, 0xB8, 0xA0, 0xB8, 
+0xC0, 0xC0, 0xA0, 0xC0, 0x40, 0xB8, 0x40, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0xA0, 0xC0, 0x80, 0xC0, 0x80, 0xB8, 0x80, 0xB8, 0xA0, 0xB8, 0xA0, 0xB8, 0x80, 0xC0, 0x60, 0xC0, 0xA0, 0xC8, 
+0x40, 0xC8, 0xE0, 0xA0, 0xAB, 0xCB, 0x63, 0xC1, 0x40, 0xB8, 0xC0, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0x80, 0xB0, 0xA0, 0xB0, 0x40, 0xB8, 0x60, 0xB8, 0x60, 0xB0, 0x60, 0xB0, 0x60, 0xB8, 0xA0, 0xB8, 
+0x60, 0xA8, 0xC0, 0xB0, 0x80, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0x60, 0xB8, 0x60, 0xB8, 0x60, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0x60, 0xB8, 0xA0, 0xB0, 0xA0, 0xB8, 0x60, 0xB8, 0x81, 0xB8, 0x4A, 0xBB, 
+0xFD, 0xDF, 0x18, 0xDE, 0x75, 0xDD, 0x54, 0xC5, 0x95, 0xD5, 0x55, 0xD5, 0x55, 0xCD, 0x96, 0xD5, 0xB6, 0xD5, 0xB6, 0xD5, 0x75, 0xD5, 0x96, 0xDD, 0x35, 0xD5, 0x55, 0xD5, 0x75, 0xCD, 0xB5, 0xD5, 
+0x55, 0xD5, 0x75, 0xD5, 0x75, 0xD5, 0x55, 0xD5, 0x55, 0xD5, 0x75, 0xD5, 0x75, 0xD5, 0x75, 0xD5, 0x96, 0xD5, 0x75, 0xC5, 0x75, 0xCD, 0x56, 0xDD, 0x77, 0xE5, 0xDF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xBE, 0xFF, 0xDE, 0xF7, 0xDE, 0xF7, 0xBE, 0xF7, 0xFF, 0xFF, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xF7, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xDE, 0xFF, 0xBE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+};
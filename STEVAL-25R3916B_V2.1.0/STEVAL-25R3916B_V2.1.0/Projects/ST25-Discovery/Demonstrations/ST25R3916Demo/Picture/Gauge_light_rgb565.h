@@ -0,0 +1,344 @@
+/* 227x115 RGB565 RLE picture converted from Gauge_light_jpg.h by pict2rgb565, 10874 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char Gauge_light[] = {
+0x52, 0x35, 0x36, 0x35, 0x01, 0x00, 0xE3, 0x00, 0x73, 0x00, 0x00, 0x00, 0x35, 0x15, 0x00, 0x00, 0x71, 0x80, 0xFF, 0xFF, 0x14, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xCC, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 
+0xD9, 0x80, 0xFF, 0xFF, 0x0A, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xD2, 0x80, 0xFF, 0xFF, 
+0x10, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 0xB6, 0xB5, 0x14, 0xA5, 0xB6, 0xB5, 0x3C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0x55, 0xAD, 0x55, 0xAD, 0x96, 0xB5, 
+0xDB, 0xDE, 0xDF, 0xFF, 0xD2, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x7D, 0xEF, 0x18, 0xC6, 0x5D, 0xEF, 0xBE, 0xF7, 0x7D, 0xEF, 0x75, 0xAD, 0x1C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0x5D, 0xEF, 0x75, 0xAD, 
+0x5D, 0xEF, 0xBE, 0xF7, 0x7D, 0xEF, 0x75, 0xAD, 0x1C, 0xE7, 0xD2, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x96, 0xB5, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x5D, 0xEF, 0xF7, 0xBD, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xD7, 0xBD, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x18, 0xC6, 0xD1, 0x80, 0xFF, 0xFF, 0x10, 0x00, 0xDF, 0xFF, 0x75, 0xAD, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xDF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x75, 0xAD, 0xD2, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x5D, 0xEF, 
+0xBA, 0xD6, 0x7D, 0xEF, 0xFF, 0xFF, 0xBE, 0xF7, 0xDB, 0xDE, 0x55, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xD3, 0x80, 
+0xFF, 0xFF, 0x0E, 0x00, 0x5D, 0xEF, 0x96, 0xB5, 0xF3, 0x9C, 0x96, 0xB5, 0x59, 0xCE, 0x55, 0xAD, 0xFF, 0xFF, 0xDF, 0xFF, 0x55, 0xAD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x34, 0xA5, 0xD1, 0x80, 0xFF, 0xFF, 0x10, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0x18, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0xBE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x75, 0xAD, 0xD2, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xBD, 0xDB, 0xDE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x18, 0xC6, 0x1C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x18, 0xC6, 0xD1, 0x80, 0xFF, 0xFF, 0x10, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 
+0xD7, 0xBD, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0x75, 0xAD, 0x5D, 0xEF, 0xFF, 0xFF, 0x7D, 0xEF, 0x55, 0xAD, 0x1C, 0xE7, 0xD3, 0x80, 0xFF, 0xFF, 0x0E, 0x00, 0xF3, 0x9C, 
+0x55, 0xAD, 0x96, 0xB5, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0xDB, 0xDE, 0xDF, 0xFF, 0xD8, 0x80, 0xFF, 0xFF, 
+0x06, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xCD, 0x80, 0xFF, 0xFF, 0x21, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xBD, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xC0, 0x80, 0xFF, 0xFF, 0x22, 0x00, 
+0x9E, 0xF7, 0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xD3, 0x9C, 0x79, 0xCE, 0xFF, 0xFF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x9E, 0xF7, 0x9E, 0xF7, 0xDF, 0xFF, 0xAA, 0x80, 0xFF, 0xFF, 0x48, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0xBA, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x9E, 0xF7, 0xBA, 0xD6, 0xDF, 0xFF, 0xBE, 0xF7, 0x38, 0xC6, 0xBE, 0xF7, 0xDF, 0xFF, 0x96, 0xB5, 0x3C, 0xE7, 0xFF, 0xFF, 0xD3, 0x9C, 0x18, 0xC6, 0xFF, 0xFF, 0x38, 0xC6, 0x59, 0xCE, 
+0xFF, 0xFF, 0x1C, 0xE7, 0x38, 0xC6, 0xDF, 0xFF, 0xFF, 0xFF, 0x79, 0xCE, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xA0, 0x80, 
+0xFF, 0xFF, 0x3F, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDB, 0xDE, 0xBA, 0xD6, 0xFF, 0xFF, 0x3C, 0xE7, 0xBA, 0xD6, 0xDF, 0xFF, 0xFB, 0xDE, 0xF7, 0xBD, 0xDB, 0xDE, 0xDB, 0xDE, 0xF7, 0xBD, 0xFB, 0xDE, 0x1C, 0xE7, 0xB6, 0xB5, 0xBA, 0xD6, 0x3C, 0xE7, 
+0x96, 0xB5, 0x59, 0xCE, 0x3C, 0xE7, 0x18, 0xC6, 0x59, 0xCE, 0x5D, 0xEF, 0xBA, 0xD6, 0xF7, 0xBD, 0x1C, 0xE7, 0x9A, 0xD6, 0x96, 0xB5, 0xBE, 0xF7, 0x9E, 0xF7, 0x79, 0xCE, 0x7D, 0xEF, 0xFF, 0xFF, 
+0x59, 0xCE, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xA2, 0x80, 0xFF, 0xFF, 0x42, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 
+0x1C, 0xE7, 0xFB, 0xDE, 0x9E, 0xF7, 0xFB, 0xDE, 0x9A, 0xD6, 0x7D, 0xEF, 0xBA, 0xD6, 0x18, 0xC6, 0x5D, 0xEF, 0xBA, 0xD6, 0x38, 0xC6, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 
+0x9A, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0x9A, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0x9A, 0xD6, 0x38, 0xC6, 0x3C, 0xE7, 0xDB, 0xDE, 
+0x18, 0xC6, 0xFB, 0xDE, 0x5D, 0xEF, 0x59, 0xCE, 0x5D, 0xEF, 0xBE, 0xF7, 0xFB, 0xDE, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0x80, 0xFF, 0xFF, 0x3F, 0x00, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x7D, 0xEF, 0x9E, 0xF7, 0xDF, 0xFF, 0xFB, 0xDE, 0xFB, 0xDE, 0x5D, 0xEF, 0x9A, 0xD6, 0x79, 0xCE, 0x1C, 0xE7, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0x9A, 0xD6, 0xBA, 0xD6, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 
+0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0x79, 0xCE, 0xFB, 0xDE, 0xDB, 0xDE, 0x59, 0xCE, 0xDB, 0xDE, 0x5D, 0xEF, 
+0xFB, 0xDE, 0xFB, 0xDE, 0xFF, 0xFF, 0x9E, 0xF7, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xA1, 0x80, 0xFF, 0xFF, 0x41, 0x00, 0x7D, 0xEF, 0x38, 0xC6, 
+0xDF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x1C, 0xE7, 0xFF, 0xFF, 0x9A, 0xD6, 0xBA, 0xD6, 0x5D, 0xEF, 0xBA, 0xD6, 0x59, 0xCE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0x9A, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 
+0xBA, 0xD6, 0x9A, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 0x79, 0xCE, 0x1C, 0xE7, 0x1C, 0xE7, 0x59, 0xCE, 0xDB, 0xDE, 0xDF, 0xFF, 0x3C, 0xE7, 0x3C, 0xE7, 0xFF, 0xFF, 0xBE, 0xF7, 0x79, 0xCE, 0xBE, 0xF7, 
+0xA0, 0x80, 0xFF, 0xFF, 0x45, 0x00, 0xDF, 0xFF, 0xF7, 0xBD, 0xBA, 0xD6, 0xFF, 0xFF, 0x59, 0xCE, 0x38, 0xC6, 0x3C, 0xE7, 0xBA, 0xD6, 0x59, 0xCE, 0xDB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 
+0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x1C, 0xE7, 0xDB, 0xDE, 0xFB, 0xDE, 0x1C, 0xE7, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 
+0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0x9A, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0x9A, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xF7, 0xBD, 
+0x59, 0xCE, 0xFF, 0xFF, 0x9A, 0xD6, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9A, 0x80, 0xFF, 0xFF, 0x45, 0x00, 0x9E, 0xF7, 0x9E, 0xF7, 0xFF, 0xFF, 0xDB, 0xDE, 
+0x59, 0xCE, 0x7D, 0xEF, 0xBA, 0xD6, 0x59, 0xCE, 0xBA, 0xD6, 0x1C, 0xE7, 0x9A, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x1C, 0xE7, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0x1C, 0xE7, 0xDB, 0xDE, 0x9A, 0xD6, 
+0xBA, 0xD6, 0x1C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x1C, 0xE7, 0xDB, 0xDE, 0x9A, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0x1C, 0xE7, 0x38, 0xC6, 0xFB, 0xDE, 0xFF, 0xFF, 
+0x9E, 0xF7, 0xBE, 0xF7, 0x9B, 0x80, 0xFF, 0xFF, 0x47, 0x00, 0xBE, 0xF7, 0x3C, 0xE7, 0x79, 0xCE, 0x5D, 0xEF, 0x3C, 0xE7, 0x9A, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 
+0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 
+0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xBA, 0xD6, 0x1C, 0xE7, 0xFB, 0xDE, 0x9A, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x3C, 0xE7, 0x3C, 0xE7, 0x79, 0xCE, 0x5D, 0xEF, 0xBE, 0xF7, 0x91, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0x79, 0xCE, 0x9E, 0xF7, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0x3D, 0x80, 0xDB, 0xDE, 0x07, 0x00, 
+0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x79, 0xCE, 0xFB, 0xDE, 0x3C, 0xE7, 0xBA, 0xD6, 0x9E, 0xF7, 0x8A, 0x80, 0xFF, 0xFF, 0x10, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xBA, 0xD6, 0xDF, 0xFF, 0x3C, 0xE7, 0x79, 0xCE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x40, 0x80, 0xDB, 0xDE, 0x08, 0x00, 0xFB, 0xDE, 
+0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0x9A, 0xD6, 0x5D, 0xEF, 0xDF, 0xFF, 0xFB, 0xDE, 0x9E, 0xF7, 0x8A, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0x1C, 0xE7, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDB, 0xDE, 
+0xDF, 0xFF, 0x9E, 0xF7, 0x18, 0xC6, 0xFB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0x41, 0x80, 0xDB, 0xDE, 0x10, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 
+0x1C, 0xE7, 0x9A, 0xD6, 0x79, 0xCE, 0xDF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x5D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x82, 0x80, 0xFF, 0xFF, 0x0D, 0x00, 0x59, 0xCE, 
+0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0xFB, 0xDE, 0x5D, 0xEF, 0x9A, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0x3E, 0x80, 0xDB, 0xDE, 0x10, 0x00, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0x5D, 0xEF, 0xBA, 0xD6, 0x59, 0xCE, 0xFF, 0xFF, 0xDF, 0xFF, 0x79, 0xCE, 
+0xFB, 0xDE, 0x81, 0x80, 0xFF, 0xFF, 0x0E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x38, 0xC6, 0x7D, 0xEF, 0x5D, 0xEF, 0x9A, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x40, 0x80, 0xDB, 0xDE, 0x15, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 
+0xDB, 0xDE, 0x9A, 0xD6, 0xFB, 0xDE, 0xDF, 0xFF, 0xBA, 0xD6, 0x38, 0xC6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0x80, 0xFF, 0xFF, 0x0E, 0x00, 0xBE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0x9A, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0x9A, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x42, 0x80, 0xDB, 0xDE, 
+0x0F, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0x9A, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 0x59, 0xCE, 0x5D, 0xEF, 0xFF, 0xFF, 0xBE, 0xF7, 
+0xBE, 0xF7, 0x80, 0x80, 0xFF, 0xFF, 0x0E, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0x7D, 0xEF, 0x1C, 0xE7, 0x9A, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x1C, 0xE7, 0xDB, 0xDE, 
+0x1C, 0xE7, 0xDB, 0xDE, 0xBA, 0xD6, 0x41, 0x80, 0xDB, 0xDE, 0x12, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 
+0x1C, 0xE7, 0xDB, 0xDE, 0x9A, 0xD6, 0x1C, 0xE7, 0x7D, 0xEF, 0xBA, 0xD6, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7B, 0x80, 0xFF, 0xFF, 0x11, 0x00, 0xBE, 0xF7, 0x7D, 0xEF, 0xFF, 0xFF, 0x5D, 0xEF, 
+0x79, 0xCE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x1C, 0xE7, 0x41, 0x80, 0xDB, 0xDE, 
+0x12, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0x59, 0xCE, 0x9E, 0xF7, 0xFF, 0xFF, 0x5D, 0xEF, 0x75, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x18, 0xC6, 0x62, 0x80, 
+0xDB, 0xDE, 0x08, 0x00, 0x9A, 0xD6, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x6B, 0x80, 0xFF, 0xFF, 0x0A, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9A, 0xD6, 0x60, 0x80, 0xDB, 0xDE, 0x06, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 
+0xFF, 0xFF, 0x7D, 0xEF, 0x9E, 0xF7, 0x71, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0x9A, 0xD6, 0x61, 0x80, 0xDB, 0xDE, 0x0D, 0x00, 
+0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0x59, 0xCE, 0xFB, 0xDE, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x6A, 0x80, 0xFF, 0xFF, 
+0x09, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 0x3C, 0xE7, 0xFF, 0xFF, 0x1C, 0xE7, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0x60, 0x80, 0xDB, 0xDE, 0x0E, 0x00, 0x1C, 0xE7, 0xFB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x9A, 0xD6, 0x7D, 0xEF, 0xFF, 0xFF, 0x3C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x63, 0x80, 0xFF, 0xFF, 0x0D, 0x00, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xBA, 0xD6, 0xBE, 0xF7, 0xFF, 0xFF, 0x3C, 0xE7, 0x38, 0xC6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x61, 0x80, 0xDB, 0xDE, 
+0x0C, 0x00, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0x79, 0xCE, 0xF7, 0xBD, 0xFF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0xDB, 0xDE, 0x69, 0x80, 0xFF, 0xFF, 
+0x0A, 0x00, 0xBE, 0xF7, 0xBA, 0xD6, 0xBA, 0xD6, 0xBE, 0xF7, 0xDF, 0xFF, 0x9A, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0x5F, 0x80, 0xDB, 0xDE, 0x0E, 0x00, 0xFB, 0xDE, 
+0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0xFB, 0xDE, 0xBE, 0xF7, 0xDF, 0xFF, 0x59, 0xCE, 0x5D, 0xEF, 0xBE, 0xF7, 0x63, 0x80, 0xFF, 0xFF, 
+0x0F, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0x79, 0xCE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x1C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 
+0xBA, 0xD6, 0x65, 0x80, 0xDB, 0xDE, 0x09, 0x00, 0xFB, 0xDE, 0x1C, 0xE7, 0xFB, 0xDE, 0x9A, 0xD6, 0xDB, 0xDE, 0x59, 0xCE, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x66, 0x80, 0xFF, 0xFF, 
+0x0B, 0x00, 0x5D, 0xEF, 0x5D, 0xEF, 0xFF, 0xFF, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0x60, 0x80, 0xDB, 0xDE, 0x0E, 0x00, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x1C, 0xE7, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x7D, 0xEF, 0xDF, 0xFF, 0x3C, 0xE7, 0xBE, 0xF7, 0x66, 0x80, 
+0xFF, 0xFF, 0x00, 0x00, 0xBE, 0xF7, 0x76, 0x80, 0xDB, 0xDE, 0x0B, 0x00, 0xBA, 0xD6, 0x9A, 0xD6, 0x1C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0x52, 0x80, 0xFF, 0xFF, 0x0E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0xBA, 0xD6, 0x75, 0x80, 0xDB, 0xDE, 0x08, 0x00, 0xFB, 0xDE, 0x5D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x5C, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x79, 0xCE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x70, 0x80, 0xDB, 0xDE, 0x0D, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0x59, 0xCE, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x5B, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x9E, 0xF7, 
+0xFF, 0xFF, 0x9E, 0xF7, 0x79, 0xCE, 0x9A, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0x70, 0x80, 0xDB, 0xDE, 0x0A, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 
+0xBA, 0xD6, 0x9A, 0xD6, 0xBE, 0xF7, 0xDF, 0xFF, 0x7D, 0xEF, 0x5E, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0x9A, 0xD6, 0x79, 0xCE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x71, 0x80, 
+0xDB, 0xDE, 0x0E, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x9A, 0xD6, 0xDB, 0xDE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x58, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x9A, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0x72, 0x80, 0xDB, 0xDE, 0x0A, 0x00, 0xFB, 0xDE, 
+0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x79, 0xCE, 0x9E, 0xF7, 0x58, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x5D, 0xEF, 0x5D, 0xEF, 0x3C, 0xE7, 0xBA, 0xD6, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x70, 0x80, 0xDB, 0xDE, 0x10, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xFB, 0xDE, 0x1C, 0xE7, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x1C, 0xE7, 0xDB, 0xDE, 0xFB, 0xDE, 0x3C, 0xE7, 0x7D, 0xEF, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x51, 0x80, 0xFF, 0xFF, 
+0x0F, 0x00, 0xDF, 0xFF, 0xBE, 0xF7, 0x3C, 0xE7, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 
+0xFB, 0xDE, 0x6F, 0x80, 0xDB, 0xDE, 0x12, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 
+0xBA, 0xD6, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x7D, 0xEF, 0xDF, 0xFF, 0x51, 0x80, 0xFF, 0xFF, 0x04, 0x00, 0x7D, 0xEF, 0xDB, 0xDE, 0xDB, 0xDE, 0xBE, 0xF7, 0x5D, 0xEF, 0x81, 0x80, 
+0xDB, 0xDE, 0x08, 0x00, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x9E, 0xF7, 0xBE, 0xF7, 0xDB, 0xDE, 0x9A, 0xD6, 0xDF, 0xFF, 0x50, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x9E, 0xF7, 0x9A, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0x80, 0x80, 0xDB, 0xDE, 0x0F, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x4E, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x1C, 0xE7, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0x7F, 0x80, 
+0xDB, 0xDE, 0x09, 0x00, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0x9A, 0xD6, 0x3C, 0xE7, 0xFF, 0xFF, 0x9E, 0xF7, 0x51, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0x9E, 0xF7, 
+0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0x7F, 0x80, 0xDB, 0xDE, 0x0D, 0x00, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 
+0x1C, 0xE7, 0x1C, 0xE7, 0xFB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x4E, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0x1C, 0xE7, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 
+0x7F, 0x80, 0xDB, 0xDE, 0x0B, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0x9A, 0xD6, 0xBA, 0xD6, 0x3C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0x4E, 0x80, 
+0xFF, 0xFF, 0x07, 0x00, 0x1C, 0xE7, 0x7D, 0xEF, 0x3C, 0xE7, 0xBA, 0xD6, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0x80, 0x80, 0xDB, 0xDE, 0x0A, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 
+0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x3C, 0xE7, 0x7D, 0xEF, 0x1C, 0xE7, 0x4E, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0xBA, 0xD6, 0x9A, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0x1C, 0xE7, 
+0xFB, 0xDE, 0x82, 0x80, 0xDB, 0xDE, 0x0B, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xDF, 0xFF, 
+0x4D, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0x9E, 0xF7, 0x9A, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x81, 0x80, 0xDB, 0xDE, 0x0A, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0x7D, 0xEF, 0x4A, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0xBA, 0xD6, 0x8F, 0x80, 
+0xDB, 0xDE, 0x0C, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x43, 0x80, 
+0xFF, 0xFF, 0x00, 0x00, 0x5D, 0xEF, 0x90, 0x80, 0xDB, 0xDE, 0x0E, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3E, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0xDF, 0xFF, 0x5D, 0xEF, 0x9E, 0xF7, 0x5D, 0xEF, 0x90, 0x80, 0xDB, 0xDE, 0x08, 0x00, 0xFB, 0xDE, 
+0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0xDF, 0xFF, 0x45, 0x80, 0xFF, 0xFF, 0x02, 0x00, 0x1C, 0xE7, 0x79, 0xCE, 0xBA, 0xD6, 0x90, 0x80, 0xDB, 0xDE, 
+0x07, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x9A, 0xD6, 0x79, 0xCE, 0x5D, 0xEF, 0x43, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0x3C, 0xE7, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0x90, 0x80, 0xDB, 0xDE, 0x09, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0x1C, 0xE7, 
+0x3F, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0xDF, 0xFF, 0xDB, 0xDE, 0x9A, 0xD6, 0xBA, 0xD6, 0x3C, 0xE7, 0x1C, 0xE7, 0xBA, 0xD6, 0xBA, 0xD6, 0x8F, 0x80, 0xDB, 0xDE, 0x0B, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x3C, 0xE7, 0xBA, 0xD6, 0xBA, 0xD6, 0x3C, 0xE7, 0xDF, 0xFF, 0x40, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0xDF, 0xFF, 0x59, 0xCE, 0x59, 0xCE, 
+0xFB, 0xDE, 0x95, 0x80, 0xDB, 0xDE, 0x05, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0x38, 0xC6, 0x9A, 0xD6, 0xBE, 0xF7, 0x43, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x9A, 0xD6, 0x1C, 0xE7, 0xDF, 0xFF, 
+0x1C, 0xE7, 0x93, 0x80, 0xDB, 0xDE, 0x08, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0x5D, 0xEF, 0xBE, 0xF7, 0xFB, 0xDE, 0x9A, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3F, 0x80, 0xFF, 0xFF, 0x07, 0x00, 
+0xFB, 0xDE, 0xF7, 0xBD, 0x79, 0xCE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFB, 0xDE, 0x82, 0x80, 0xDB, 0xDE, 0x1B, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x5D, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF7, 0xBD, 
+0x38, 0xC6, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x32, 0x80, 0xFF, 0xFF, 0x1D, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0x96, 0xB5, 0x3C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x7D, 0x80, 0xDB, 0xDE, 0x0E, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 
+0x3C, 0xE7, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0xB6, 0xB5, 0x9E, 0xF7, 0x3A, 0x80, 0xFF, 0xFF, 0x16, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0x79, 0xCE, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 0xFB, 0xDE, 0xBA, 0xD6, 
+0xBA, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x77, 0x80, 0xDB, 0xDE, 0x19, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 
+0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0x3C, 0xE7, 
+0xBE, 0xF7, 0x3C, 0x80, 0xFF, 0xFF, 0x15, 0x00, 0xBE, 0xF7, 0x9E, 0xF7, 0x18, 0xC6, 0x75, 0xAD, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x3C, 0xE7, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x7E, 0x80, 0xDB, 0xDE, 0x11, 0x00, 0xBA, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 
+0x5D, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0x75, 0xAD, 0x79, 0xCE, 0xBE, 0xF7, 0x3D, 0x80, 
+0xFF, 0xFF, 0x15, 0x00, 0x79, 0xCE, 0xB6, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9E, 0xF7, 0x3C, 0xE7, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x75, 0x80, 0xDB, 0xDE, 0x17, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xBA, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0x3C, 0xE7, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9E, 0xF7, 0xB6, 0xB5, 0x9A, 0xD6, 0x38, 0x80, 0xFF, 0xFF, 0x1C, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0x9A, 0xD6, 0x5D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x1C, 0xE7, 0xDB, 0xDE, 0xBA, 0xD6, 
+0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x70, 0x80, 0xDB, 0xDE, 0x1D, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 
+0x3C, 0xE7, 0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x5D, 0xEF, 0x9A, 0xD6, 0x3C, 0xE7, 0xDF, 0xFF, 0x39, 0x80, 0xFF, 0xFF, 0x16, 0x00, 0xDF, 0xFF, 0x1C, 0xE7, 0x55, 0xAD, 0xD7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x5D, 0xEF, 0xFB, 0xDE, 0x75, 0x80, 0xDB, 0xDE, 
+0x1B, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x1C, 0xE7, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x96, 0xB5, 0x96, 0xB5, 0x7D, 0xEF, 0x38, 0x80, 0xFF, 0xFF, 0x1A, 0x00, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xD7, 0xBD, 0xBA, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0xBA, 0xD6, 0x70, 0x80, 0xDB, 0xDE, 0x1C, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0x1C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x79, 0xCE, 0xF7, 0xBD, 0x3A, 0x80, 0xFF, 0xFF, 0x2A, 0x00, 0x5D, 0xEF, 0x9A, 0xD6, 
+0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x1C, 0xE7, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x57, 0x80, 0xDB, 0xDE, 0x26, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x3C, 0xE7, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0x59, 0xCE, 0x79, 0xCE, 0x9E, 0xF7, 0x36, 0x80, 0xFF, 0xFF, 0x29, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x55, 0xAD, 0x9A, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0x9E, 0xF7, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 
+0x5C, 0x80, 0xDB, 0xDE, 0x25, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x1C, 0xE7, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x96, 0xB5, 0x9E, 0xF7, 0xDF, 0xFF, 0x33, 0x80, 0xFF, 0xFF, 0x2C, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBE, 0xF7, 0x96, 0xB5, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x5D, 0xEF, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x5D, 0x80, 0xDB, 0xDE, 0x29, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 
+0xDB, 0xDE, 0x1C, 0xE7, 0x7D, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x96, 0xB5, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x2D, 0x80, 0xFF, 0xFF, 0x26, 0x00, 0xDF, 0xFF, 0x9A, 0xD6, 0xD7, 0xBD, 0xDB, 0xDE, 0xDB, 0xDE, 0xF7, 0xBD, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 
+0x67, 0x80, 0xDB, 0xDE, 0x27, 0x00, 0x5D, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 
+0xD7, 0xBD, 0x9A, 0xD6, 0xFB, 0xDE, 0xF7, 0xBD, 0xDB, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x2D, 0x80, 0xFF, 0xFF, 0x28, 0x00, 0x3C, 0xE7, 0x79, 0xCE, 
+0x34, 0xA5, 0x9A, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xEF, 
+0x1C, 0xE7, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x5D, 0x80, 0xDB, 0xDE, 0x2A, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x3C, 0xE7, 0x9E, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x75, 0xAD, 0x9A, 0xD6, 
+0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x2D, 0x80, 0xFF, 0xFF, 0x28, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x59, 0xCE, 0xBE, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0xDB, 0xDE, 
+0xBA, 0xD6, 0x60, 0x80, 0xDB, 0xDE, 0x2C, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 0x1C, 0xE7, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x38, 0xC6, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x2E, 0x80, 0xFF, 0xFF, 0x2A, 0x00, 0xDF, 0xFF, 0xBA, 0xD6, 0xBA, 0xD6, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x59, 0x80, 
+0xDB, 0xDE, 0x04, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x3C, 0xE7, 0xBE, 0xF7, 0x20, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0xBA, 0xD6, 0x1C, 0xE7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x30, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0xBE, 0xF7, 0x79, 0xCE, 0xF3, 0x9C, 0x9A, 0xD6, 0x22, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0x9E, 0xF7, 0x1C, 0xE7, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 
+0x59, 0x80, 0xDB, 0xDE, 0x28, 0x00, 0x3C, 0xE7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0xF3, 0x9C, 0xDB, 0xDE, 0xDF, 0xFF, 0x31, 0x80, 0xFF, 0xFF, 0x04, 0x00, 0xDF, 0xFF, 
+0xFF, 0xFF, 0x3C, 0xE7, 0xD7, 0xBD, 0xBE, 0xF7, 0x24, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0x7D, 0xEF, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x3F, 0x80, 0xDB, 0xDE, 0x11, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xBE, 0xF7, 0xDF, 0xFF, 0x23, 0x80, 0xFF, 0xFF, 0x04, 0x00, 0x9E, 0xF7, 0xD7, 0xBD, 0x9E, 0xF7, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x31, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x3C, 0xE7, 0x79, 0xCE, 0x9A, 0xD6, 0xDF, 0xFF, 0x25, 0x80, 0xFF, 0xFF, 0x09, 0x00, 0xBE, 0xF7, 0x7D, 0xEF, 0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 
+0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x41, 0x80, 0xDB, 0xDE, 0x10, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x24, 0x80, 0xFF, 0xFF, 0x08, 0x00, 0xBE, 0xF7, 0x59, 0xCE, 0x79, 0xCE, 0x7D, 0xEF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x2B, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0xF3, 0x9C, 0x1C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0x26, 0x80, 
+0xFF, 0xFF, 0x09, 0x00, 0x9E, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0x46, 0x80, 0xDB, 0xDE, 0x06, 0x00, 0xFB, 0xDE, 
+0xFB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0x5D, 0xEF, 0xBE, 0xF7, 0x28, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0xDB, 0xDE, 0x34, 0xA5, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x2F, 0x80, 
+0xFF, 0xFF, 0x05, 0x00, 0xBE, 0xF7, 0x59, 0xCE, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x27, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0x7D, 0xEF, 0x3C, 0xE7, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xFB, 0xDE, 0xFB, 0xDE, 0x40, 0x80, 0xDB, 0xDE, 0x0B, 0x00, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x3C, 0xE7, 
+0x9E, 0xF7, 0x2A, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x3C, 0xE7, 0x38, 0xC6, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x2D, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x1C, 0xE7, 
+0x18, 0xC6, 0xBE, 0xF7, 0xDF, 0xFF, 0x2A, 0x80, 0xFF, 0xFF, 0x04, 0x00, 0xBE, 0xF7, 0x5D, 0xEF, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0x44, 0x80, 0xDB, 0xDE, 0x07, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x3C, 0xE7, 0x7D, 0xEF, 0xDF, 0xFF, 0x2B, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0x9E, 0xF7, 0xF7, 0xBD, 0x5D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x2C, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0xBE, 0xF7, 0x18, 0xC6, 0x71, 0x8C, 0x38, 0xC6, 0xFF, 0xFF, 0xDF, 0xFF, 0x2C, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0xBE, 0xF7, 0x3C, 0xE7, 0x46, 0x80, 0xDB, 0xDE, 
+0x03, 0x00, 0xBA, 0xD6, 0xDB, 0xDE, 0x1C, 0xE7, 0x5D, 0xEF, 0x2E, 0x80, 0xFF, 0xFF, 0x08, 0x00, 0xDF, 0xFF, 0xD7, 0xBD, 0x10, 0x84, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBE, 0xF7, 0x2C, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0x96, 0xB5, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x2C, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0xBE, 0xF7, 0x3C, 0xE7, 0x40, 0x80, 
+0xDB, 0xDE, 0x06, 0x00, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x3C, 0xE7, 0x9E, 0xF7, 0x30, 0x80, 0xFF, 0xFF, 0x04, 0x00, 0x79, 0xCE, 0xD7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x2E, 0x80, 0xFF, 0xFF, 0x02, 0x00, 0x3C, 0xE7, 0x18, 0xC6, 0x9E, 0xF7, 0x31, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0xDF, 0xFF, 0x9E, 0xF7, 0x42, 0x80, 0xDB, 0xDE, 0x01, 0x00, 0x1C, 0xE7, 
+0x9E, 0xF7, 0x32, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x3C, 0xE7, 0x38, 0xC6, 0x9E, 0xF7, 0xDF, 0xFF, 0x2E, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0xBA, 0xD6, 0xF3, 0x9C, 0x34, 0xA5, 0xDF, 0xFF, 0x34, 0x80, 
+0xFF, 0xFF, 0x42, 0x00, 0x5D, 0xEF, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xFB, 0xDE, 0x3B, 0xD7, 0xDB, 0xDE, 0xDA, 0xDE, 0xFB, 0xD6, 0xDA, 0xDE, 0xBA, 0xE6, 0xDA, 0xDE, 0x1B, 0xD7, 0xBA, 0xE6, 0xDA, 0xDE, 0xFB, 0xDE, 0xFC, 0xDE, 0xFC, 0xD6, 0xDB, 0xD6, 0xDA, 0xD6, 
+0xF9, 0xD6, 0xDA, 0xDE, 0xFA, 0xD6, 0xFB, 0xD6, 0xFB, 0xD6, 0xDB, 0xD6, 0xDB, 0xDE, 0xDA, 0xDE, 0xDA, 0xD6, 0xDA, 0xD6, 0xDB, 0xD6, 0xDB, 0xD6, 0xFB, 0xDE, 0xDB, 0xD6, 0xDA, 0xDE, 0xDA, 0xDE, 
+0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xFB, 0xDE, 0xBA, 0xD6, 0x1C, 0xE7, 0x9E, 0xF7, 0xDF, 0xFF, 0x33, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0xDF, 0xFF, 0xF3, 0x9C, 0xD3, 0x9C, 0x5D, 0xEF, 0x2A, 0x80, 0xFF, 0xFF, 0x0B, 0x00, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0x9A, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x30, 0x80, 0xFF, 0xFF, 0x40, 0x00, 0xDF, 0xFF, 0xBE, 0xF7, 
+0x5D, 0xEF, 0xFB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDA, 0xD6, 0xBB, 0xE6, 0xDB, 0xE6, 
+0xFB, 0xDE, 0xFB, 0xD6, 0xDB, 0xDE, 0xDA, 0xDE, 0xFA, 0xD6, 0xFC, 0xDE, 0xDB, 0xDE, 0xB9, 0xD6, 0xB9, 0xDE, 0xBA, 0xE6, 0xBC, 0xE6, 0xBC, 0xE6, 0xBC, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDA, 0xDE, 
+0xDA, 0xDE, 0xDA, 0xDE, 0xDA, 0xDE, 0xDA, 0xDE, 0xF9, 0xDE, 0xFA, 0xD6, 0xFB, 0xE6, 0xBB, 0xE6, 0xBA, 0xDE, 0xDB, 0xD6, 0xFB, 0xDE, 0xFB, 0xDE, 0xDA, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 
+0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0xFB, 0xDE, 0x7D, 0xEF, 0xBE, 0xF7, 0x35, 0x80, 
+0xFF, 0xFF, 0x04, 0x00, 0xDF, 0xFF, 0x79, 0xCE, 0x3C, 0xE7, 0xFF, 0xFF, 0xBE, 0xF7, 0x2C, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xBA, 0xD6, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x34, 0x80, 0xFF, 0xFF, 0x3C, 0x00, 0xDF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0xFB, 0xDE, 0xBA, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDA, 0xDE, 0xDB, 0xE6, 0xBB, 0xE6, 0xDB, 0xD6, 0xFB, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBB, 0xCE, 0xDB, 0xDE, 0xFB, 0xE6, 0xFA, 0xDE, 0x1A, 0xCF, 0x1B, 0xCF, 0xDB, 0xD6, 
+0xBB, 0xDE, 0xBB, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 0xDB, 0xE6, 0xDB, 0xDE, 0xDB, 0xD6, 0xDB, 0xD6, 0xBA, 0xDE, 0xDB, 0xE6, 0xFB, 0xDE, 0xFB, 0xD6, 0xDA, 0xD6, 0xBB, 0xE6, 0xDB, 0xE6, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x5D, 0xEF, 
+0x9E, 0xF7, 0x38, 0x80, 0xFF, 0xFF, 0x04, 0x00, 0xBA, 0xD6, 0x1C, 0xE7, 0xDF, 0xFF, 0xBE, 0xF7, 0xDF, 0xFF, 0x29, 0x80, 0xFF, 0xFF, 0x08, 0x00, 0xBE, 0xF7, 0xFB, 0xDE, 0x38, 0xC6, 0x96, 0xB5, 
+0x34, 0xA5, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x36, 0x80, 0xFF, 0xFF, 0x39, 0x00, 0xDF, 0xFF, 0x7D, 0xEF, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xD6, 0xDB, 0xD6, 0xDB, 0xDE, 0xDB, 0xE6, 0xDB, 0xDE, 0xDB, 0xDE, 0x1C, 0xD7, 0x1B, 0xD7, 0xDB, 0xDE, 0xBA, 0xDE, 0x99, 0xDE, 
+0x78, 0xDE, 0x17, 0xE6, 0xD5, 0xE5, 0x14, 0xF5, 0x33, 0xE5, 0x74, 0xDD, 0xF5, 0xD5, 0x37, 0xD6, 0x59, 0xD6, 0xBB, 0xDE, 0xFD, 0xDE, 0xDB, 0xE6, 0xFB, 0xD6, 0xFB, 0xCE, 0xFB, 0xD6, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x3C, 0xE7, 
+0x9E, 0xF7, 0xDF, 0xFF, 0x39, 0x80, 0xFF, 0xFF, 0x04, 0x00, 0x59, 0xCE, 0xF3, 0x9C, 0xD7, 0xBD, 0x59, 0xCE, 0x3C, 0xE7, 0x27, 0x80, 0xFF, 0xFF, 0x09, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0x34, 0xA5, 0x5D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x39, 0x80, 0xFF, 0xFF, 0x35, 0x00, 0xDF, 0xFF, 0x3C, 0xE7, 0xFB, 0xDE, 0xBA, 0xD6, 0xBA, 0xD6, 0xDB, 0xDE, 
+0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xD6, 0xFB, 0xD6, 0xFB, 0xDE, 0xDB, 0xE6, 0xBB, 0xE6, 0xDA, 0xD6, 0xFA, 0xD6, 0x9B, 0xE6, 0xBA, 0xDE, 0x99, 0xDE, 0xD6, 0xE5, 0x92, 0xEC, 
+0x4D, 0xFB, 0x49, 0xFA, 0xC6, 0xF9, 0x44, 0xF9, 0x24, 0xF9, 0x25, 0xF9, 0xA6, 0xF9, 0x49, 0xFA, 0x6D, 0xF3, 0xD1, 0xE4, 0xB4, 0xE5, 0x9A, 0xDE, 0xFB, 0xD6, 0xFB, 0xD6, 0xBB, 0xE6, 0xBB, 0xE6, 
+0xFB, 0xD6, 0x1B, 0xCF, 0xDA, 0xD6, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xD6, 0xDB, 0xDE, 0x1C, 0xE7, 0x7D, 0xEF, 0xDF, 0xFF, 
+0x3B, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0xDB, 0xDE, 0x55, 0xAD, 0x1C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x22, 0x80, 0xFF, 0xFF, 0x0A, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xB6, 0xB5, 0x9E, 0xF7, 0x3D, 0x80, 0xFF, 0xFF, 0x31, 0x00, 0x9E, 0xF7, 0x3C, 0xE7, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0xE6, 0xDA, 0xDE, 0xFB, 0xDE, 0xDB, 0xE6, 0xBB, 0xDE, 0xDA, 0xDE, 0x1B, 0xD7, 0x3B, 0xD7, 0xFB, 0xDE, 0x96, 0xE5, 0xAE, 0xFB, 0x08, 0xFA, 0xE4, 0xF8, 0x62, 0xF0, 
+0x41, 0xF8, 0x41, 0xF8, 0xC2, 0xF0, 0xA1, 0xF0, 0x81, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0xC2, 0xF8, 0x44, 0xF9, 0xC6, 0xF9, 0xD1, 0xF3, 0x95, 0xE5, 0xFA, 0xDE, 0x1B, 0xDF, 0xBB, 0xDE, 0xDB, 0xDE, 
+0xFB, 0xD6, 0xFA, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x5D, 0xEF, 0xBE, 0xF7, 0x3D, 0x80, 0xFF, 0xFF, 0x05, 0x00, 
+0x3C, 0xE7, 0xD7, 0xBD, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x26, 0x80, 0xFF, 0xFF, 0x09, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x5D, 0xEF, 0x96, 0xB5, 0x96, 0xB5, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x39, 0x80, 0xFF, 0xFF, 0x32, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDA, 0xDE, 
+0xDA, 0xDE, 0xFB, 0xE6, 0xDB, 0xDE, 0xBA, 0xD6, 0x1B, 0xD7, 0xFA, 0xE6, 0x18, 0xE6, 0x91, 0xEC, 0xAB, 0xEA, 0xC3, 0xF8, 0x20, 0xF8, 0x61, 0xF8, 0xC1, 0xF8, 0xA2, 0xF8, 0x61, 0xF8, 0x42, 0xF8, 
+0x62, 0xF8, 0x62, 0xF8, 0x62, 0xF8, 0x62, 0xF8, 0x61, 0xF8, 0x82, 0xF8, 0xA2, 0xF8, 0x05, 0xF9, 0xAB, 0xFA, 0xF2, 0xEC, 0x58, 0xDE, 0xDA, 0xD6, 0xDB, 0xDE, 0xDB, 0xE6, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0x3C, 0xE7, 0xBE, 0xF7, 0xDF, 0xFF, 0x3D, 0x80, 0xFF, 0xFF, 0x06, 0x00, 0xDF, 0xFF, 0x9E, 0xF7, 0xB6, 0xB5, 0xD7, 0xBD, 
+0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x2A, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0xBE, 0xF7, 0x96, 0xB5, 0x18, 0xC6, 0xDF, 0xFF, 0x40, 0x80, 0xFF, 0xFF, 0x2A, 0x00, 0xDF, 0xFF, 0x7D, 0xEF, 0x1C, 0xE7, 
+0xDB, 0xDE, 0x1A, 0xD7, 0xDA, 0xD6, 0xFB, 0xE6, 0xFB, 0xE6, 0xFA, 0xCE, 0x3B, 0xD7, 0x38, 0xE6, 0x12, 0xE4, 0x04, 0xF9, 0xA2, 0xF8, 0x61, 0xF0, 0x81, 0xF8, 0x82, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 
+0xA1, 0xF8, 0x60, 0xF8, 0x81, 0xF8, 0x81, 0xF8, 0x81, 0xF0, 0x81, 0xF8, 0x82, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x80, 0xF8, 0x62, 0xF8, 0xA8, 0xF9, 0x72, 0xEC, 0x99, 0xDE, 0x1B, 0xD7, 0xDB, 0xDE, 
+0xBB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x1C, 0xE7, 0x9E, 0xF7, 0x42, 0x80, 0xFF, 0xFF, 0x32, 0x00, 0xB6, 0xB5, 0xD7, 0xBD, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x79, 0xCE, 0x43, 0x80, 0xFF, 0xFF, 
+0x27, 0x00, 0x9E, 0xF7, 0x5D, 0xEF, 0x1B, 0xD7, 0xDA, 0xD6, 0xDB, 0xDE, 0xFB, 0xD6, 0xFC, 0xD6, 0x39, 0xEE, 0xCF, 0xFB, 0x25, 0xF9, 0x81, 0xF0, 0x81, 0xF8, 0x81, 0xF8, 0x81, 0xF8, 0x81, 0xF8, 
+0x81, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x41, 0xF8, 0x41, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x61, 0xF0, 0x81, 0xF8, 0x81, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x60, 0xF8, 0x62, 0xF8, 0x87, 0xF9, 0x30, 0xE4, 
+0x99, 0xDE, 0x1B, 0xDF, 0xDB, 0xD6, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0x1C, 0xE7, 0x7D, 0xEF, 0xDF, 0xFF, 0x42, 0x80, 0xFF, 0xFF, 0x36, 0x00, 0xDF, 0xFF, 0x38, 0xC6, 0x79, 0xCE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFB, 0xDE, 0x55, 0xAD, 0x79, 0xCE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x41, 0x80, 0xFF, 0xFF, 0x24, 0x00, 0xDF, 0xFF, 0xDE, 0xF7, 0xFC, 0xEE, 0xBB, 0xDE, 0x1C, 0xD7, 0x98, 0xD6, 0x50, 0xE4, 0xA6, 0xF1, 0x61, 0xF8, 0x62, 0xF8, 
+0x41, 0xF8, 0x41, 0xF0, 0x61, 0xF8, 0x82, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x61, 0xF0, 0xA2, 0xF8, 0x81, 0xF8, 0x61, 0xF8, 0x41, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x41, 0xF8, 0x41, 0xF8, 0x41, 0xF8, 
+0xE2, 0xF0, 0x82, 0xE8, 0x42, 0xF8, 0xC7, 0xF9, 0xB0, 0xE4, 0xD9, 0xDE, 0xFC, 0xD6, 0xBA, 0xD6, 0xFB, 0xDE, 0x5D, 0xEF, 0xBE, 0xF7, 0x45, 0x80, 0xFF, 0xFF, 0x32, 0x00, 0x59, 0xCE, 0x96, 0xB5, 
+0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0xD7, 0xBD, 
+0xFB, 0xDE, 0x45, 0x80, 0xFF, 0xFF, 0x22, 0x00, 0xFE, 0xF7, 0xFF, 0xFF, 0x7E, 0xF7, 0x1B, 0xE7, 0x33, 0xED, 0xE8, 0xF9, 0x62, 0xF8, 0xA0, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x62, 0xF8, 0x62, 0xF8, 
+0x62, 0xF8, 0x41, 0xF8, 0x61, 0xF0, 0x81, 0xF0, 0x81, 0xF0, 0x61, 0xF0, 0x61, 0xF8, 0x81, 0xF8, 0x82, 0xF8, 0x81, 0xF8, 0x81, 0xF8, 0x81, 0xF8, 0xA1, 0xF0, 0x82, 0xF8, 0x21, 0xF8, 0x40, 0xF8, 
+0x81, 0xF8, 0x27, 0xF2, 0x54, 0xED, 0xFB, 0xD6, 0x3C, 0xE7, 0x7D, 0xEF, 0xDF, 0xFF, 0x46, 0x80, 0xFF, 0xFF, 0x02, 0x00, 0xBA, 0xD6, 0xD7, 0xBD, 0x3C, 0xE7, 0x29, 0x80, 0xFF, 0xFF, 0x06, 0x00, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x59, 0xCE, 0x9E, 0xF7, 0xDF, 0xFF, 0x44, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x9D, 0xFF, 0x55, 0xFD, 0xA8, 0xF9, 
+0x42, 0xF8, 0x80, 0xF8, 0x81, 0xF8, 0x81, 0xF8, 0x81, 0xF8, 0x61, 0xF0, 0x61, 0xF8, 0x61, 0xF8, 0x81, 0xF8, 0x61, 0xF8, 0x41, 0xF8, 0x61, 0xF8, 0x81, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x60, 0xF8, 
+0x61, 0xF8, 0x81, 0xF0, 0x60, 0xF0, 0x61, 0xF8, 0x61, 0xF8, 0xA1, 0xF8, 0x61, 0xF8, 0xC7, 0xF1, 0x54, 0xED, 0x7D, 0xEF, 0x48, 0x80, 0xFF, 0xFF, 0x35, 0x00, 0xDF, 0xFF, 0x5D, 0xEF, 0xBA, 0xD6, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0xB6, 0xB5, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x45, 0x80, 0xFF, 0xFF, 0x1C, 0x00, 0xBE, 0xFF, 0xFE, 0xFF, 0x5C, 0xFF, 0x14, 0xFD, 0x0C, 0xFB, 0x25, 0xF1, 0x40, 0xF8, 0x40, 0xF8, 0x80, 0xF8, 0xA1, 0xF8, 
+0xA1, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x41, 0xF8, 0x82, 0xF8, 0x81, 0xF8, 0x60, 0xF0, 0x60, 0xF8, 0x61, 0xF8, 0x81, 0xF8, 0x61, 0xF8, 0x81, 0xF8, 0x40, 0xF8, 0x81, 0xF8, 0x45, 0xF9, 
+0xCC, 0xFA, 0x55, 0xF5, 0x5C, 0xF7, 0x4A, 0x80, 0xFF, 0xFF, 0x36, 0x00, 0x7D, 0xEF, 0xF7, 0xBD, 0x1C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9A, 0xD6, 0xD7, 0xBD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x41, 0x80, 0xFF, 0xFF, 0x1C, 0x00, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFE, 0xF2, 0xFC, 0x48, 0xF2, 0x04, 0xF9, 0x21, 0xF8, 0x41, 0xF8, 0x61, 0xF8, 0x80, 0xF0, 0x60, 0xF0, 0x61, 0xF8, 
+0x61, 0xF8, 0x81, 0xF8, 0x81, 0xF0, 0x81, 0xF0, 0x81, 0xF8, 0x62, 0xF8, 0x42, 0xF8, 0x21, 0xF8, 0x41, 0xF8, 0xC3, 0xF8, 0x89, 0xFA, 0xB2, 0xF4, 0xDA, 0xFE, 0x4C, 0x80, 0xFF, 0xFF, 0x31, 0x00, 
+0x7D, 0xEF, 0xB6, 0xB5, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0x9E, 0xF7, 0x79, 0xCE, 0x48, 0x80, 0xFF, 0xFF, 0x1C, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFE, 0xFF, 0x78, 0xFE, 0x51, 0xFC, 0xC8, 0xF9, 0x83, 0xF8, 0x81, 0xF8, 
+0xA1, 0xF0, 0xA1, 0xF8, 0x81, 0xF8, 0x81, 0xF8, 0x61, 0xF0, 0x81, 0xF0, 0x81, 0xF8, 0x41, 0xF8, 0x21, 0xF8, 0x82, 0xF0, 0xE3, 0xE8, 0xC9, 0xF9, 0x30, 0xF4, 0x98, 0xF6, 0xDE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xF7, 0x48, 0x80, 0xFF, 0xFF, 0x36, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x34, 0xA5, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x9A, 0xD6, 0x96, 0xB5, 0x34, 0xA5, 0x96, 0xB5, 0x38, 0xC6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0x96, 0xB5, 0x34, 0xA5, 0x75, 0xAD, 
+0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x43, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xFF, 0xF6, 0xFD, 0x8C, 0xFB, 0x64, 0xF9, 0x81, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 
+0x61, 0xF8, 0x61, 0xF8, 0x61, 0xF8, 0x41, 0xF8, 0x82, 0xF0, 0xC6, 0xF9, 0x2B, 0xFB, 0x16, 0xF6, 0xDD, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0x49, 0x80, 
+0xFF, 0xFF, 0x37, 0x00, 0x9E, 0xF7, 0x38, 0xC6, 0x3C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xDB, 0xDE, 0xB6, 0xB5, 0x14, 0xA5, 0x96, 0xB5, 0xDB, 0xDE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0x14, 0xA5, 0x14, 0xA5, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC6, 0xBA, 0xD6, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0xBA, 0xD6, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x96, 0xB5, 0x9E, 0xF7, 0xFF, 0xFF, 0x3C, 0xE7, 0x75, 0xAD, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0x38, 0xC6, 0x96, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x4B, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0x3D, 0xFF, 0x35, 0xFD, 0xCB, 0xF2, 
+0x24, 0xF1, 0x81, 0xF8, 0x61, 0xF8, 0x81, 0xF8, 0x60, 0xF8, 0x40, 0xF8, 0x24, 0xF9, 0xEB, 0xF2, 0x34, 0xED, 0x7C, 0xFF, 0x51, 0x80, 0xFF, 0xFF, 0x37, 0x00, 0x7D, 0xEF, 0xD7, 0xBD, 0x79, 0xCE, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x96, 0xB5, 0x5D, 0xEF, 0xDF, 0xFF, 0x7D, 0xEF, 0x96, 0xB5, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x55, 0xAD, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x18, 0xC6, 0xFB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x59, 0xCE, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x49, 0x80, 0xFF, 0xFF, 0x0E, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF9, 0xFE, 0x71, 0xFC, 0x4A, 0xFA, 0xC2, 0xF8, 
+0xA2, 0xF8, 0xE4, 0xF8, 0x29, 0xFA, 0xB1, 0xF4, 0x3A, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x51, 0x80, 0xFF, 0xFF, 0x33, 0x00, 0xDF, 0xFF, 0x79, 0xCE, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xD7, 0xBD, 0xFB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x59, 0xCE, 0x9A, 0xD6, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0xD7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xEF, 0x38, 0xC6, 0xFF, 0xFF, 0xDF, 0xFF, 0x4C, 0x80, 0xFF, 0xFF, 
+0x0F, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0x9D, 0xFF, 0x9A, 0xFE, 0x2E, 0xFC, 0xAB, 0xF2, 0xB0, 0xFB, 0x79, 0xFE, 0xFE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xF7, 0x50, 0x80, 0xFF, 0xFF, 0x33, 0x00, 0xDF, 0xFF, 0xBE, 0xF7, 0x79, 0xCE, 0x5D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xAD, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0x75, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x34, 0xA5, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBE, 0xF7, 0xF7, 0xBD, 0x14, 0xA5, 0x18, 0xC6, 0x75, 0xAD, 0x55, 0xAD, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xBA, 0xD6, 0x9A, 0xD6, 0xD7, 0xBD, 0xF7, 0xBD, 0xBE, 0xF7, 0x4F, 0x80, 0xFF, 0xFF, 0x08, 0x00, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x7D, 0xFF, 0xDB, 0xF6, 0x7D, 0xFF, 0x57, 0x80, 0xFF, 0xFF, 0x34, 0x00, 0xDB, 0xDE, 0x59, 0xCE, 0x59, 0xCE, 0xDB, 0xDE, 0xDF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0x1C, 0xE7, 0x1C, 0xE7, 0xBE, 0xF7, 0x3C, 0xE7, 0x1C, 0xE7, 0x59, 0xCE, 0xDB, 0xDE, 0xDF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x9E, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x4A, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 0x9E, 0xFF, 0x55, 0x80, 0xFF, 0xFF, 0x32, 0x00, 0xBE, 0xF7, 
+0xBE, 0xF7, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xAD, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x55, 0xAD, 
+0xDF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0x4F, 0x80, 0xFF, 0xFF, 0x0C, 0x00, 0xDF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xF7, 0xFF, 0xF7, 0x4F, 0x80, 0xFF, 0xFF, 0x35, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0xBE, 0xF7, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x75, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x55, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC6, 0xFB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFB, 0xDE, 0x18, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x53, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0xFE, 0xF7, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xBF, 0xFF, 0x5B, 0x80, 0xFF, 0xFF, 0x23, 0x00, 0xD7, 0xBD, 0xFB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x79, 0xCE, 0xBE, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xDB, 0xDE, 0x59, 0xCE, 0xFF, 0xFF, 0xDF, 0xFF, 0x1C, 0xE7, 0x96, 0xB5, 0x7D, 0xEF, 0xFF, 0xFF, 0x7D, 0xEF, 0xB6, 0xB5, 0x1C, 0xE7, 0x5A, 0x80, 0xFF, 0xFF, 0x0A, 0x00, 0xDF, 0xF7, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xF7, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x58, 0x80, 0xFF, 0xFF, 0x29, 0x00, 0x1C, 0xE7, 0x96, 0xB5, 0x5D, 0xEF, 0xFF, 0xFF, 
+0x7D, 0xEF, 0x75, 0xAD, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xF3, 0x9C, 0x14, 0xA5, 0x34, 0xA5, 0xF3, 0x9C, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xBE, 0xF7, 0xBA, 0xD6, 0x75, 0xAD, 0x14, 0xA5, 0xB6, 0xB5, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBA, 0xD6, 0x75, 0xAD, 0x14, 0xA5, 0x75, 0xAD, 0x1C, 0xE7, 0xBE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xB8, 0x80, 0xFF, 0xFF, 0x22, 0x00, 0xBE, 0xF7, 0xDB, 0xDE, 0xB6, 0xB5, 0x14, 0xA5, 0x96, 0xB5, 0xDB, 0xDE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xC1, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0x80, 
+0xFF, 0xFF, 0x0A, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+};
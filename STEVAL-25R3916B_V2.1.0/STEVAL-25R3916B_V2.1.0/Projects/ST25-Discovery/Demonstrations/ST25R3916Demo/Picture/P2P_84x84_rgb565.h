@@ -0,0 +1,433 @@
+/* 84x84 RGB565 RLE picture converted from P2P_84x84_jpg.h by pict2rgb565, 13722 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char P2P_84x84[] = {
+0x52, 0x35, 0x36, 0x35, 0x01, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0xC5, 0x1A, 0x00, 0x00, 0x57, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xDE, 0xF7, 0xBD, 0xF7, 0x9E, 0xEF, 0x9E, 0xEF, 
+0x9F, 0xEF, 0x5C, 0xFF, 0x7C, 0xEF, 0xBE, 0xEF, 0x7D, 0xEF, 0x7C, 0xF7, 0xBC, 0xFF, 0x7D, 0xEF, 0x7F, 0xE7, 0x9E, 0xF7, 0x9D, 0xEF, 0x9D, 0xEF, 0x9D, 0xF7, 0x9D, 0xEF, 0x7D, 0xEF, 0x9D, 0xEF, 
+0x9E, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x7E, 0xF7, 0x7E, 0xF7, 0x7E, 0xF7, 0x7D, 0xF7, 0x7D, 0xF7, 0x3C, 0xFF, 0x7D, 0xF7, 0x9E, 0xEF, 0x9E, 0xEF, 0x7E, 0xF7, 0x7E, 0xF7, 0x7E, 0xF7, 
+0x7E, 0xEF, 0xBD, 0xF7, 0x7D, 0xEF, 0x7E, 0xEF, 0x7E, 0xF7, 0x7D, 0xEF, 0x7D, 0xF7, 0x9F, 0xF7, 0xBF, 0xEF, 0xBF, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0x9F, 0xFF, 0x9F, 0xFF, 0x5E, 0xEF, 0xDC, 0xDE, 
+0x7A, 0xCE, 0x39, 0xC6, 0x18, 0xBE, 0x17, 0xBE, 0x17, 0xBE, 0x19, 0xAE, 0xF8, 0xBD, 0x18, 0xC6, 0xF8, 0xB5, 0xF9, 0xAD, 0xF9, 0xB5, 0xD8, 0xB5, 0xF7, 0xBD, 0x18, 0xBE, 0xF8, 0xB5, 0xF7, 0xB5, 
+0xF7, 0xB5, 0xF7, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xB5, 0x19, 0xB6, 0xF9, 0xB5, 0xF8, 0xBD, 
+0xF7, 0xBD, 0xF6, 0xBD, 0xD6, 0xBD, 0xF7, 0xBD, 0x18, 0xB6, 0xF8, 0xB5, 0xF8, 0xB5, 0xF8, 0xBD, 0xF8, 0xB5, 0xF8, 0xB5, 0x18, 0xBE, 0x58, 0xC6, 0x58, 0xCE, 0xB9, 0xCE, 0xFB, 0xDE, 0x5D, 0xEF, 
+0xDE, 0xF7, 0xFE, 0xF7, 0xDD, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xBE, 0xFF, 0x5C, 0xEF, 
+0xFC, 0xDE, 0x99, 0xC6, 0xD7, 0xA5, 0xD6, 0x7C, 0xF5, 0x4B, 0x95, 0x3B, 0x95, 0x2B, 0x94, 0x2B, 0x94, 0x23, 0xB3, 0x23, 0x73, 0x2B, 0x53, 0x2B, 0x94, 0x2B, 0xB4, 0x23, 0x74, 0x23, 0x94, 0x2B, 
+0xD3, 0x2B, 0x73, 0x23, 0x93, 0x23, 0x94, 0x2B, 0x93, 0x2B, 0x94, 0x2B, 0xB4, 0x2B, 0xB4, 0x2B, 0xB4, 0x2B, 0xB4, 0x2B, 0xB4, 0x2B, 0xB4, 0x2B, 0xD4, 0x2B, 0xD4, 0x2B, 0xD4, 0x2B, 0xD5, 0x2B, 
+0xD5, 0x2B, 0xD6, 0x2B, 0xD7, 0x2B, 0xD8, 0x2B, 0xF9, 0x33, 0x18, 0x2C, 0x37, 0x1C, 0x17, 0x1C, 0xD7, 0x2B, 0x18, 0x24, 0x38, 0x24, 0x58, 0x2C, 0x38, 0x24, 0x38, 0x24, 0x38, 0x24, 0x57, 0x2C, 
+0x36, 0x34, 0x77, 0x44, 0x17, 0x6D, 0xF7, 0xA5, 0x99, 0xC6, 0xFB, 0xDE, 0x7E, 0xEF, 0xDE, 0xF7, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 
+0xDF, 0xFF, 0x5D, 0xF7, 0xDA, 0xDE, 0xF8, 0xAD, 0xB4, 0x6C, 0xB3, 0x2B, 0x94, 0x1B, 0x95, 0x0B, 0xD8, 0x03, 0x3A, 0x04, 0x9B, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0x7A, 0x0C, 0xBA, 0x04, 0x9A, 0x04, 
+0xBB, 0x0C, 0x7B, 0x0C, 0x7A, 0x04, 0x9B, 0x04, 0x7B, 0x0C, 0x9B, 0x04, 0xBB, 0x0C, 0xDC, 0x0C, 0xDC, 0x14, 0xDC, 0x0C, 0xDC, 0x0C, 0xDC, 0x0C, 0xDC, 0x14, 0xDC, 0x14, 0xFC, 0x0C, 0xFC, 0x14, 
+0xFC, 0x14, 0x1C, 0x15, 0x1D, 0x15, 0x1D, 0x15, 0x1D, 0x15, 0x5C, 0x0D, 0x3D, 0x1D, 0x3E, 0x1D, 0x5E, 0x0D, 0x7D, 0x05, 0x5D, 0x0D, 0x7E, 0x05, 0xBE, 0x05, 0x5F, 0x0D, 0x5F, 0x0D, 0x5E, 0x0D, 
+0x7F, 0x0D, 0x7F, 0x0D, 0x7F, 0x05, 0x5F, 0x05, 0x3F, 0x0D, 0xFD, 0x04, 0xBB, 0x14, 0x39, 0x24, 0x17, 0x44, 0xD7, 0x74, 0x1A, 0xB6, 0xFB, 0xDE, 0x5C, 0xEF, 0xFE, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0x9E, 0xF7, 0xFB, 0xDE, 0x18, 0xB6, 0xD6, 0x74, 0xD4, 0x33, 0x96, 0x13, 0x5A, 0x0C, 0x7B, 0x0C, 0xBB, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x0D, 0xFB, 0x0C, 
+0xDA, 0x0C, 0xFD, 0x0C, 0x3C, 0x0D, 0xDA, 0x04, 0xDB, 0x04, 0x3D, 0x05, 0x3D, 0x15, 0xD9, 0x24, 0xB3, 0x2B, 0xEA, 0x21, 0xC9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 
+0xA9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0x88, 0x19, 0x09, 0x1A, 0xE8, 0x11, 0xA8, 0x11, 0x8D, 0x22, 0x77, 0x2C, 0xBF, 0x25, 
+0xDF, 0x15, 0xFF, 0x15, 0x1F, 0x0E, 0xFE, 0x05, 0xDE, 0x15, 0x1F, 0x16, 0x1F, 0x0E, 0xFF, 0x0D, 0xDF, 0x15, 0xBF, 0x0D, 0x7F, 0x05, 0x5F, 0x05, 0xDF, 0x04, 0x3A, 0x0C, 0xF6, 0x2B, 0xD6, 0x7C, 
+0x19, 0xBE, 0x3C, 0xE7, 0xBD, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xF7, 0xB9, 0xDE, 0x56, 0x95, 0xD4, 0x33, 0xB6, 0x03, 0x3A, 0x04, 0x5A, 0x04, 0xBB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 
+0xFB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xFC, 0x14, 0xFD, 0x1C, 0xDB, 0x0C, 0xDC, 0x0C, 0x1D, 0x0D, 0x5D, 0x15, 0xD9, 0x1C, 0x10, 0x1B, 0x26, 0x09, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0xA9, 0x09, 0xD2, 0x23, 0x7E, 0x15, 0x3F, 0x06, 0x5F, 0x06, 0xFF, 0x05, 0xFF, 0x0D, 0xFE, 0x05, 0xFE, 0x05, 0xDF, 0x15, 0xDF, 0x15, 0xDF, 0x0D, 0x1F, 0x0E, 
+0x3F, 0x06, 0x9F, 0x05, 0xDD, 0x04, 0x5A, 0x1C, 0x38, 0x2C, 0x38, 0xA5, 0x9B, 0xCE, 0x9E, 0xFF, 0xDE, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x7C, 0xEF, 0x79, 0xBE, 0xB5, 0x6C, 0x95, 0x23, 0xD8, 0x03, 0x9C, 0x04, 0x1D, 0x0D, 
+0x1C, 0x0D, 0xDD, 0x0C, 0xFD, 0x14, 0x1D, 0x15, 0x1D, 0x15, 0x1D, 0x0D, 0x1C, 0x0D, 0x1C, 0x05, 0xFC, 0x04, 0x1B, 0x0D, 0xFD, 0x0C, 0xFD, 0x0C, 0x17, 0x0C, 0x0B, 0x02, 0x20, 0x00, 0x00, 0x08, 
+0x20, 0x00, 0x00, 0x00, 0xC3, 0x10, 0x65, 0x29, 0xA6, 0x31, 0xC6, 0x31, 0xC7, 0x31, 0xC7, 0x31, 0xA6, 0x31, 0xC6, 0x31, 0xC6, 0x31, 0xC6, 0x31, 0xC6, 0x31, 0xC6, 0x31, 0xC6, 0x31, 0xC6, 0x31, 
+0xC6, 0x31, 0x85, 0x39, 0xC6, 0x31, 0x65, 0x21, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x60, 0x00, 0x30, 0x13, 0x39, 0x15, 0x5F, 0x0E, 0x3F, 0x0E, 0xFF, 0x15, 0x1E, 0x0E, 0x1E, 0x0E, 
+0xFF, 0x15, 0xFE, 0x0D, 0xFF, 0x15, 0xFF, 0x15, 0xBE, 0x0D, 0xBE, 0x05, 0xBE, 0x0D, 0x5F, 0x0D, 0xBF, 0x04, 0xF7, 0x33, 0xF9, 0x6C, 0x7B, 0xBE, 0x7D, 0xEF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x7D, 0xEF, 0x19, 0xBE, 0x75, 0x64, 0x96, 0x0B, 
+0x3A, 0x04, 0xDB, 0x0C, 0xFA, 0x14, 0xDB, 0x14, 0xFC, 0x0C, 0x3B, 0x05, 0x1B, 0x0D, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x3C, 0x05, 0x3B, 0x0D, 0x57, 0x14, 
+0x0B, 0x0A, 0x21, 0x00, 0x00, 0x00, 0x40, 0x08, 0x05, 0x19, 0xEC, 0x62, 0xB2, 0x9C, 0x79, 0xCE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 
+0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xFC, 0xDE, 0x9B, 0xDE, 0xF8, 0xC5, 0x92, 0x94, 0xAA, 0x52, 0xE3, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x13, 0xBC, 0x15, 
+0xFF, 0x15, 0xFF, 0x15, 0x3F, 0x0E, 0x3F, 0x06, 0xFF, 0x15, 0xFF, 0x05, 0xFF, 0x0D, 0xDF, 0x15, 0xDF, 0x15, 0xBF, 0x15, 0xBF, 0x15, 0x9F, 0x15, 0x7C, 0x0D, 0xDD, 0x04, 0x38, 0x14, 0xB6, 0x5C, 
+0x39, 0xBE, 0x7D, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x7D, 0xEF, 
+0x5A, 0xC6, 0x57, 0x44, 0xD6, 0x1B, 0x19, 0x04, 0xBC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x04, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xFC, 0x0C, 0xFB, 0x0C, 0xFD, 0x14, 0x8C, 0x1A, 0x60, 0x00, 0x21, 0x00, 0x00, 0x00, 0x08, 0x3A, 0xB5, 0xAD, 0x7D, 0xEF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFB, 0xDE, 0x14, 0xA5, 0xA6, 0x31, 
+0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0xB1, 0x2B, 0x1F, 0x0E, 0x3E, 0x06, 0xFF, 0x15, 0x3F, 0x0E, 0xDF, 0x05, 0xFF, 0x0D, 0xFF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 
+0xBF, 0x0D, 0x7F, 0x0D, 0xFD, 0x0C, 0x39, 0x14, 0x78, 0x4C, 0x7B, 0xBE, 0x7C, 0xF7, 0xDE, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0x9D, 0xF7, 0xDB, 0xD6, 0x95, 0x6C, 0xB6, 0x13, 0x39, 0x14, 0xDC, 0x14, 0x1D, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xBA, 0x04, 0x58, 0x1C, 0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x42, 0x39, 0xC6, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xAD, 0x86, 0x31, 0x00, 0x00, 0x20, 0x00, 0xC9, 0x09, 0x7D, 0x1D, 0x3E, 0x06, 0xDF, 0x0D, 0x1F, 0x0E, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xDF, 0x0D, 
+0xDF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0x9F, 0x0D, 0x9E, 0x0D, 0x9F, 0x0D, 0x5C, 0x15, 0x9B, 0x0C, 0x3A, 0x24, 0xB5, 0x64, 0x99, 0xCE, 0x7E, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFB, 0xE6, 0x77, 0x8D, 0x74, 0x13, 0x19, 0x04, 0xDC, 0x0C, 0x1D, 0x0D, 0x1C, 0x05, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 
+0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x14, 0x10, 0x1B, 0x21, 0x00, 0x00, 0x00, 0x64, 0x29, 0x16, 0xCE, 0xFF, 0xFF, 
+0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0xC2, 0x08, 0x00, 0x00, 0x42, 0x00, 0x35, 0x24, 0x5F, 0x0E, 0xFF, 0x05, 0x1E, 0x0E, 
+0xDF, 0x15, 0xFF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0x9E, 0x0D, 0x9E, 0x0D, 0x9E, 0x05, 0x9D, 0x15, 0x3E, 0x0D, 0x9D, 0x04, 0xF6, 0x1B, 0x56, 0x85, 0xFC, 0xDE, 
+0xBF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xF7, 0x5D, 0xF7, 0xD9, 0xB5, 0xD4, 0x33, 0xF8, 0x03, 0xFC, 0x0C, 0x1D, 0x0D, 0xFC, 0x04, 
+0xFC, 0x04, 0x1B, 0x0D, 0xFB, 0x0C, 0xDB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDA, 0x0C, 0xC9, 0x11, 0x00, 0x08, 
+0x41, 0x00, 0xCD, 0x73, 0xFE, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0x5D, 0xEF, 0xA9, 0x4A, 0x00, 0x00, 0x00, 0x08, 
+0xCD, 0x12, 0x3F, 0x0E, 0xFF, 0x0D, 0xFD, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0x9F, 0x0D, 0x9E, 0x0D, 0x9E, 0x0D, 0x9C, 0x05, 0x7F, 0x15, 0x9F, 0x0D, 
+0x5D, 0x05, 0x7C, 0x04, 0x15, 0x34, 0x17, 0xAE, 0x3E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0x9E, 0xEF, 0xDA, 0xE6, 0x55, 0x64, 0x97, 0x03, 
+0xDB, 0x0C, 0xDC, 0x04, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x15, 0xFC, 0x0C, 0xDC, 0x04, 0xFD, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xFC, 0x0C, 0x9A, 0x04, 0x66, 0x19, 0x00, 0x10, 0xE4, 0x18, 0x37, 0xC6, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xD3, 0x94, 0x41, 0x00, 0x20, 0x08, 0x29, 0x0A, 0xFF, 0x15, 0xDF, 0x15, 0xFE, 0x0D, 0xFF, 0x05, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0x9F, 0x0D, 0x9E, 0x0D, 
+0x9E, 0x0D, 0x9D, 0x15, 0x5F, 0x0D, 0x7D, 0x15, 0x5C, 0x0D, 0x1F, 0x0D, 0xF9, 0x03, 0x95, 0x5C, 0xBB, 0xE6, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0x3D, 0xE7, 0xD8, 0xAD, 0x74, 0x1B, 0x9C, 0x04, 0xDB, 0x0C, 0xDB, 0x04, 0xFC, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFD, 0x0C, 0xFD, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDA, 0x0C, 0x86, 0x19, 0x00, 0x08, 0x6A, 0x42, 0x7C, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xD6, 0x25, 0x21, 0x00, 0x00, 0x49, 0x1A, 0xDF, 0x15, 0xBF, 0x15, 0x1F, 0x0E, 0x1F, 0x06, 0xDF, 0x0D, 0xDF, 0x0D, 0xBF, 0x0D, 
+0xBF, 0x0D, 0xBF, 0x0D, 0x9F, 0x0D, 0x9E, 0x0D, 0x7E, 0x0D, 0x7E, 0x15, 0x3D, 0x0D, 0x5D, 0x15, 0x3D, 0x15, 0x3E, 0x0D, 0xBD, 0x04, 0xB6, 0x23, 0xD8, 0xAD, 0x5D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xDB, 0xD6, 0x76, 0x5C, 0xB7, 0x03, 0xFD, 0x0C, 0xDB, 0x0C, 0x1C, 0x0D, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x04, 0x1C, 0x0D, 0x1C, 0x0D, 
+0xDB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xBA, 0x14, 0x87, 0x11, 0x20, 0x00, 0x4C, 0x63, 0x5C, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0xEF, 0xC7, 0x39, 0x00, 0x00, 0x6A, 0x1A, 0xDE, 0x15, 0xBF, 0x15, 0x1F, 0x06, 
+0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0x9F, 0x0D, 0x9E, 0x0D, 0x7E, 0x0D, 0x7E, 0x0D, 0x5E, 0x0D, 0x3C, 0x0D, 0x7E, 0x15, 0x3D, 0x15, 0x5D, 0x0D, 0x3E, 0x0D, 0xF9, 0x0B, 
+0xB7, 0x54, 0xDB, 0xDE, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x5C, 0xFF, 0x7A, 0xCE, 0x74, 0x13, 0x7A, 0x0C, 0x99, 0x14, 0x1D, 0x15, 0xFB, 0x04, 0xDB, 0x04, 0x1B, 0x0D, 
+0x1C, 0x0D, 0xFC, 0x0C, 0xFB, 0x04, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0x99, 0x1C, 0x87, 0x09, 0x40, 0x00, 
+0x4B, 0x6B, 0xDE, 0xFF, 0xDF, 0xF7, 0xDE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0xE7, 0xC6, 0x39, 0x01, 0x00, 
+0x09, 0x12, 0xDD, 0x0D, 0xFF, 0x15, 0xFF, 0x05, 0xBF, 0x1D, 0xDF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0x9F, 0x0D, 0x9E, 0x0D, 0x7E, 0x0D, 0x7E, 0x0D, 0x7D, 0x0D, 0x5E, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 
+0x3D, 0x0D, 0x5D, 0x0D, 0xFC, 0x0C, 0xBB, 0x14, 0xF7, 0x0B, 0x79, 0xCE, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0x5C, 0xEF, 0x58, 0x8D, 0xD7, 0x03, 0x9B, 0x1C, 0xFC, 0x0C, 
+0xBB, 0x0C, 0x1C, 0x05, 0x1C, 0x05, 0xFB, 0x0C, 0xFA, 0x0C, 0xFB, 0x04, 0xFC, 0x0C, 0xFD, 0x0C, 0xDC, 0x0C, 0xBC, 0x0C, 0x1C, 0x15, 0xFB, 0x0C, 0xFB, 0x0C, 0x1C, 0x15, 0xFD, 0x04, 0xFD, 0x04, 
+0xFB, 0x14, 0xDA, 0x14, 0xA8, 0x19, 0x00, 0x00, 0x0D, 0x5B, 0xDD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 
+0xFF, 0xF7, 0x3D, 0xE7, 0xC6, 0x39, 0x00, 0x00, 0x4B, 0x1A, 0xDE, 0x15, 0xFF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0x7F, 0x0D, 0xDF, 0x05, 0xDE, 0x15, 0x3D, 0x15, 0x9F, 0x0D, 0x9D, 0x05, 0x7E, 0x0D, 
+0x5F, 0x0D, 0x5D, 0x0D, 0x3D, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 0x3D, 0x0D, 0x3D, 0x15, 0xBC, 0x0C, 0x1A, 0x04, 0x78, 0x95, 0x5B, 0xEF, 0xFE, 0xF7, 0xDF, 0xFF, 0xFE, 0xFF, 0xBF, 0xF7, 0xDA, 0xD6, 
+0x75, 0x64, 0x18, 0x04, 0x9B, 0x14, 0xDB, 0x04, 0xDB, 0x0C, 0xFB, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0xFC, 0x04, 0xFB, 0x04, 0xDB, 0x04, 0xFB, 0x0C, 0x1C, 0x15, 0xBB, 0x04, 
+0xDC, 0x04, 0xFC, 0x14, 0xDB, 0x0C, 0x1C, 0x15, 0xFB, 0x04, 0xFA, 0x14, 0xA8, 0x19, 0x00, 0x00, 0x0D, 0x5B, 0x9D, 0xF7, 0xFE, 0xF7, 0xDF, 0xF7, 0xFF, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 
+0xFE, 0xFF, 0x9D, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0x3D, 0xE7, 0xC6, 0x39, 0x00, 0x00, 0x4B, 0x1A, 0xDE, 0x1D, 0xFF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xDF, 0x15, 0xBF, 0x1D, 0x7E, 0x0D, 
+0x9E, 0x0D, 0x9F, 0x0D, 0x9F, 0x05, 0x5D, 0x05, 0x5D, 0x1D, 0x5D, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0xDC, 0x0C, 0x5A, 0x04, 0x96, 0x64, 0xDA, 0xD6, 0xDE, 0xF7, 
+0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0xEF, 0x59, 0xBE, 0xB4, 0x33, 0x7A, 0x04, 0xDC, 0x0C, 0xFB, 0x04, 0x1B, 0x0D, 0xDA, 0x14, 0xFB, 0x14, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 
+0x1B, 0x0D, 0xFB, 0x04, 0xFB, 0x04, 0xFB, 0x0C, 0x1D, 0x15, 0x1D, 0x0D, 0xFC, 0x0C, 0x1C, 0x0D, 0x1B, 0x05, 0xBA, 0x0C, 0x87, 0x11, 0x00, 0x00, 0x0D, 0x63, 0xDE, 0xFF, 0xFF, 0xFF, 0x9C, 0xC6, 
+0xD8, 0x9D, 0x76, 0x9D, 0xD5, 0x84, 0x36, 0x8D, 0x15, 0x8D, 0xF4, 0x8C, 0x17, 0x8D, 0x57, 0x8D, 0x36, 0x85, 0xF5, 0x84, 0x16, 0x8D, 0x77, 0x95, 0x19, 0xAE, 0x1D, 0xD7, 0xFF, 0xF7, 0xDF, 0xF7, 
+0xBA, 0xD6, 0x76, 0x9D, 0x15, 0x8D, 0x76, 0x95, 0xB8, 0x9D, 0xB8, 0xA5, 0xD8, 0xAD, 0xDC, 0xDE, 0xFF, 0xFF, 0x3D, 0xE7, 0xC6, 0x39, 0x00, 0x00, 0x4B, 0x1A, 0xBE, 0x15, 0xFF, 0x0D, 0xBF, 0x0D, 
+0xBF, 0x0D, 0xDF, 0x0D, 0x7E, 0x05, 0x9E, 0x05, 0x9F, 0x0D, 0x3D, 0x1D, 0x7E, 0x15, 0x9E, 0x15, 0xFD, 0x14, 0x3D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x3C, 0x05, 0x3D, 0x0D, 0xFC, 0x0C, 
+0x9B, 0x0C, 0xF5, 0x33, 0x39, 0xBE, 0x9E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0x7E, 0xEF, 0xF8, 0xAD, 0x95, 0x1B, 0xDC, 0x0C, 0xFD, 0x14, 0xFB, 0x04, 0xFB, 0x0C, 0xDA, 0x04, 0x3C, 0x0D, 0x1D, 0x05, 
+0xDC, 0x04, 0xDB, 0x0C, 0xDB, 0x14, 0xFB, 0x0C, 0xFC, 0x0C, 0x1B, 0x15, 0xDC, 0x04, 0x1C, 0x0D, 0xBA, 0x0C, 0xDB, 0x04, 0x1D, 0x05, 0xFC, 0x04, 0xFB, 0x0C, 0xDA, 0x14, 0xA8, 0x19, 0x00, 0x00, 
+0x0C, 0x5B, 0x9D, 0xF7, 0x1C, 0xD7, 0x30, 0x4B, 0xEA, 0x09, 0xAA, 0x01, 0xEC, 0x09, 0xCB, 0x01, 0x4C, 0x12, 0xAA, 0x09, 0xEC, 0x09, 0x6B, 0x01, 0x0D, 0x02, 0xCA, 0x09, 0xA9, 0x09, 0xCA, 0x09, 
+0x4C, 0x1A, 0x0F, 0x3B, 0x97, 0x9D, 0xFF, 0xF7, 0x7C, 0xEF, 0xD1, 0x5B, 0x89, 0x09, 0x0C, 0x0A, 0x0C, 0x0A, 0xEB, 0x11, 0x4C, 0x1A, 0x50, 0x4B, 0xDC, 0xCE, 0x5D, 0xE7, 0xE6, 0x39, 0x00, 0x00, 
+0x2B, 0x1A, 0xBE, 0x15, 0xFF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBD, 0x05, 0xBE, 0x0D, 0x7F, 0x0D, 0x5E, 0x0D, 0x3C, 0x05, 0x5D, 0x0D, 0x5D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 
+0x3D, 0x0D, 0x3C, 0x05, 0x3D, 0x0D, 0x1C, 0x0D, 0xBB, 0x0C, 0xD6, 0x1B, 0xF9, 0xA5, 0x7E, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0x3D, 0xEF, 0xB7, 0xA5, 0xD8, 0x13, 0xBB, 0x04, 0xFD, 0x14, 0xDB, 0x04, 
+0xDB, 0x0C, 0x1B, 0x05, 0x1C, 0x05, 0xFB, 0x04, 0xFB, 0x0C, 0xFB, 0x14, 0xFB, 0x14, 0xFC, 0x0C, 0xDC, 0x04, 0xBA, 0x14, 0x1C, 0x0D, 0x1B, 0x15, 0xFA, 0x14, 0xFB, 0x04, 0xFB, 0x04, 0xFB, 0x0C, 
+0xFD, 0x0C, 0xBA, 0x0C, 0x88, 0x11, 0x00, 0x00, 0x4D, 0x63, 0xFE, 0xFF, 0x7A, 0xBE, 0xCB, 0x19, 0xCB, 0x01, 0xEB, 0x01, 0xAB, 0x01, 0xAB, 0x01, 0xF6, 0x74, 0x70, 0x4B, 0x69, 0x09, 0xCC, 0x01, 
+0x0C, 0x02, 0xCB, 0x01, 0xCB, 0x01, 0xEB, 0x01, 0xEB, 0x09, 0x8A, 0x01, 0x6C, 0x2A, 0x5A, 0xB6, 0xFF, 0xFF, 0x3A, 0xB6, 0x4C, 0x1A, 0xCC, 0x01, 0xAB, 0x01, 0xCB, 0x01, 0xCC, 0x01, 0x0B, 0x12, 
+0x19, 0xAE, 0x5D, 0xE7, 0xE6, 0x39, 0x00, 0x00, 0x2B, 0x1A, 0xBE, 0x15, 0xDF, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0x7D, 0x1D, 0x3D, 0x15, 0x7E, 0x0D, 0xBE, 0x0D, 0x7F, 0x0D, 0x3D, 0x0D, 
+0x9B, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x1C, 0x05, 0x3C, 0x0D, 0x1C, 0x0D, 0xDC, 0x0C, 0xF8, 0x0B, 0xB9, 0x9D, 0x5D, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0x3C, 0xEF, 0x96, 0x9D, 
+0xF9, 0x13, 0x9B, 0x04, 0xDC, 0x14, 0xFB, 0x0C, 0xBB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x14, 0xDB, 0x0C, 0xDB, 0x04, 0x1C, 0x0D, 0x3C, 0x0D, 0xDD, 0x04, 0x99, 0x14, 0x30, 0x13, 
+0x14, 0x1C, 0x5D, 0x0D, 0xFC, 0x04, 0xFA, 0x14, 0xDC, 0x0C, 0xBA, 0x14, 0xA8, 0x19, 0x00, 0x00, 0x2D, 0x63, 0xDE, 0xFF, 0x18, 0xAE, 0x8A, 0x09, 0x2C, 0x02, 0xEB, 0x09, 0xCB, 0x01, 0xAA, 0x01, 
+0xF8, 0x9D, 0x5D, 0xD7, 0x6F, 0x53, 0x89, 0x09, 0xAA, 0x01, 0xEC, 0x01, 0x0C, 0x0A, 0xAA, 0x01, 0xCB, 0x01, 0xCB, 0x01, 0x89, 0x01, 0x73, 0x74, 0xDF, 0xF7, 0x5D, 0xEF, 0x50, 0x4B, 0xAB, 0x01, 
+0xCB, 0x09, 0x0C, 0x0A, 0xEC, 0x01, 0x0A, 0x12, 0xB7, 0x9D, 0x5D, 0xE7, 0xE6, 0x39, 0x00, 0x00, 0x2B, 0x1A, 0xBE, 0x15, 0xDF, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0x9E, 0x05, 0x5E, 0x15, 0x9F, 0x05, 
+0x5C, 0x15, 0x50, 0x13, 0x36, 0x2C, 0x5E, 0x15, 0x3D, 0x05, 0x3D, 0x0D, 0x3C, 0x0D, 0x3D, 0x0D, 0x3C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xDB, 0x04, 0xF9, 0x0B, 0x98, 0x95, 0x3C, 0xEF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0x3C, 0xEF, 0x95, 0x9D, 0xFA, 0x03, 0xBA, 0x0C, 0xDC, 0x14, 0xFB, 0x0C, 0xDC, 0x0C, 0xDC, 0x0C, 0xBA, 0x0C, 0xDA, 0x14, 0xFB, 0x0C, 0xBB, 0x04, 0xBB, 0x04, 0x99, 0x1C, 
+0x15, 0x1C, 0xFC, 0x0C, 0x38, 0x0C, 0x89, 0x01, 0x66, 0x09, 0xD5, 0x0B, 0xFD, 0x04, 0xFB, 0x0C, 0xBA, 0x0C, 0x99, 0x14, 0xA8, 0x19, 0x00, 0x00, 0x2D, 0x5B, 0xDE, 0xFF, 0x39, 0xB6, 0xCB, 0x11, 
+0x0B, 0x02, 0xAB, 0x01, 0xEC, 0x01, 0xAA, 0x01, 0xD8, 0x9D, 0xFF, 0xF7, 0xFD, 0xD6, 0xB1, 0x5B, 0xCA, 0x01, 0xAB, 0x01, 0x0C, 0x0A, 0xEB, 0x01, 0xEC, 0x01, 0x0C, 0x0A, 0xAA, 0x01, 0xCD, 0x3A, 
+0x1D, 0xD7, 0x9D, 0xF7, 0x33, 0x6C, 0xCA, 0x01, 0xCA, 0x09, 0xEB, 0x09, 0xCB, 0x01, 0x2C, 0x12, 0x97, 0xA5, 0x5D, 0xE7, 0xE6, 0x39, 0x00, 0x00, 0x2B, 0x1A, 0xBE, 0x15, 0xDF, 0x0D, 0x9E, 0x0D, 
+0x9E, 0x0D, 0x5B, 0x15, 0x97, 0x0C, 0xBE, 0x0D, 0x1B, 0x15, 0x67, 0x01, 0x46, 0x11, 0x16, 0x1C, 0x1F, 0x15, 0x5D, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 
+0xDC, 0x0C, 0xD9, 0x13, 0x77, 0x9D, 0x5C, 0xEF, 0xDF, 0xF7, 0xFF, 0xF7, 0x3B, 0xEF, 0x75, 0x9D, 0xD9, 0x03, 0xDB, 0x14, 0xDB, 0x14, 0xDB, 0x0C, 0xDC, 0x04, 0xFC, 0x0C, 0xBA, 0x0C, 0xDA, 0x0C, 
+0xFC, 0x04, 0xDC, 0x04, 0xFC, 0x1C, 0xB4, 0x23, 0xA9, 0x09, 0x70, 0x0B, 0xFD, 0x0C, 0x75, 0x1B, 0x82, 0x10, 0xE9, 0x19, 0xB9, 0x1C, 0xFC, 0x04, 0x1C, 0x05, 0x99, 0x14, 0x87, 0x11, 0x00, 0x00, 
+0x6D, 0x63, 0xDF, 0xFF, 0xF8, 0xAD, 0xCB, 0x19, 0xEB, 0x01, 0x0C, 0x0A, 0xCC, 0x01, 0xCA, 0x09, 0xB6, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xCE, 0xD1, 0x53, 0x0C, 0x02, 0xEB, 0x01, 0xCA, 0x09, 
+0x0C, 0x0A, 0xCB, 0x01, 0xAB, 0x01, 0xEA, 0x19, 0xBC, 0xC6, 0xFF, 0xF7, 0xD5, 0x74, 0x0C, 0x0A, 0xEB, 0x09, 0xEB, 0x09, 0xED, 0x01, 0x0D, 0x0A, 0x98, 0x9D, 0x5D, 0xE7, 0xE6, 0x39, 0x00, 0x00, 
+0x2B, 0x1A, 0xBE, 0x15, 0xDF, 0x0D, 0x7E, 0x0D, 0x7E, 0x0D, 0x36, 0x1C, 0x0A, 0x0A, 0x94, 0x1B, 0x1F, 0x0D, 0xD4, 0x13, 0xA3, 0x00, 0x4B, 0x12, 0xF8, 0x0C, 0x5D, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 
+0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x0D, 0xDC, 0x0C, 0xD8, 0x1B, 0x96, 0x9D, 0x7C, 0xEF, 0xDF, 0xF7, 0xDF, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 0xB7, 0x13, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 
+0xDB, 0x0C, 0xF8, 0x04, 0x1B, 0x1D, 0x9C, 0x0C, 0xB9, 0x0C, 0xB4, 0x2B, 0x1B, 0x05, 0x9A, 0x14, 0xE9, 0x21, 0x43, 0x01, 0xF5, 0x1B, 0xFC, 0x0C, 0xCE, 0x0A, 0x83, 0x08, 0x70, 0x23, 0x1A, 0x05, 
+0xFC, 0x0C, 0xDA, 0x14, 0xA8, 0x19, 0x00, 0x00, 0x2D, 0x63, 0xDE, 0xFF, 0xF8, 0xAD, 0xCB, 0x11, 0x0C, 0x02, 0xEB, 0x11, 0xCB, 0x01, 0xAB, 0x01, 0xD9, 0xA5, 0xBD, 0xFF, 0x9E, 0xEF, 0xFF, 0xF7, 
+0xB9, 0xDE, 0xB1, 0x4B, 0x8A, 0x01, 0xCB, 0x01, 0xCA, 0x09, 0xCA, 0x09, 0xCC, 0x01, 0xCC, 0x01, 0xD7, 0xB5, 0xFF, 0xF7, 0x35, 0x8D, 0x0B, 0x0A, 0x0C, 0x02, 0xEB, 0x09, 0xEB, 0x01, 0xEB, 0x09, 
+0x98, 0x9D, 0x5B, 0xE7, 0xA8, 0x41, 0x20, 0x00, 0x0A, 0x1A, 0x9F, 0x1D, 0x5C, 0x0D, 0xF6, 0x23, 0x5D, 0x15, 0xBC, 0x14, 0x6A, 0x1A, 0x26, 0x09, 0x98, 0x14, 0x5D, 0x15, 0xEE, 0x1A, 0xA3, 0x10, 
+0xD4, 0x13, 0xFC, 0x0C, 0x1C, 0x0D, 0x3B, 0x05, 0xFD, 0x0C, 0xFD, 0x14, 0x1B, 0x0D, 0xFD, 0x0C, 0xDB, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x77, 0x9D, 
+0xB7, 0x13, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0x3C, 0x05, 0xDD, 0x14, 0xBA, 0x04, 0xB8, 0x0C, 0x2C, 0x1A, 0xED, 0x12, 0xDB, 0x14, 0x78, 0x1C, 0x89, 0x19, 0x4D, 0x12, 0xFA, 0x0C, 
+0x36, 0x14, 0x07, 0x19, 0x68, 0x19, 0x78, 0x14, 0xFC, 0x0C, 0xDA, 0x14, 0xA8, 0x19, 0x00, 0x00, 0x2D, 0x63, 0xDE, 0xFF, 0xF8, 0xAD, 0xCB, 0x11, 0x0C, 0x02, 0xEB, 0x09, 0xEC, 0x01, 0xAB, 0x01, 
+0xD8, 0xA5, 0xFE, 0xFF, 0x7A, 0xC6, 0xF9, 0xAD, 0xFF, 0xFF, 0x1D, 0xCF, 0x6F, 0x4B, 0x8A, 0x01, 0xAB, 0x01, 0xEB, 0x09, 0x8B, 0x01, 0xCC, 0x09, 0x56, 0x9D, 0xFF, 0xFF, 0x56, 0x95, 0x2C, 0x12, 
+0x0C, 0x02, 0xEB, 0x09, 0xEB, 0x01, 0xEB, 0x09, 0x97, 0x9D, 0x3C, 0xE7, 0xE7, 0x29, 0x60, 0x00, 0xE9, 0x21, 0x9E, 0x15, 0x1A, 0x0D, 0x6E, 0x1A, 0x0F, 0x2B, 0x9F, 0x0D, 0x14, 0x1C, 0x86, 0x11, 
+0xAD, 0x12, 0x1D, 0x0D, 0x79, 0x14, 0x88, 0x11, 0xC8, 0x19, 0xDA, 0x14, 0xFC, 0x0C, 0x1B, 0x05, 0xFD, 0x04, 0xFC, 0x0C, 0x1B, 0x0D, 0xFD, 0x0C, 0xDB, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 
+0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDC, 0x14, 0x7B, 0x04, 0x3B, 0x0D, 0xFC, 0x04, 0x52, 0x23, 0xA7, 0x19, 0xF5, 0x1B, 
+0x1C, 0x05, 0xF2, 0x22, 0x26, 0x11, 0x36, 0x14, 0x3C, 0x0D, 0xAF, 0x1A, 0x82, 0x10, 0xB4, 0x1B, 0xBB, 0x14, 0xDA, 0x14, 0xA8, 0x19, 0x00, 0x00, 0x2D, 0x63, 0xDE, 0xFF, 0xF8, 0xAD, 0xCB, 0x11, 
+0x0C, 0x02, 0x0B, 0x0A, 0xEB, 0x01, 0xCB, 0x01, 0xB7, 0x9D, 0xDE, 0xFF, 0x36, 0x95, 0xCE, 0x32, 0xDC, 0xC6, 0xFF, 0xFF, 0x3C, 0xDF, 0x91, 0x4B, 0xCB, 0x01, 0xAA, 0x01, 0xEC, 0x09, 0x8A, 0x01, 
+0x36, 0x8D, 0xFF, 0xFF, 0x77, 0x9D, 0x4C, 0x12, 0x0C, 0x02, 0xEB, 0x09, 0xEB, 0x01, 0xEB, 0x09, 0x77, 0x95, 0x3D, 0xEF, 0xC6, 0x31, 0x40, 0x00, 0x29, 0x22, 0x5D, 0x15, 0x5C, 0x0D, 0xB2, 0x23, 
+0x44, 0x19, 0x97, 0x14, 0x7D, 0x0D, 0x0F, 0x13, 0x27, 0x11, 0x59, 0x14, 0x5E, 0x15, 0x0F, 0x13, 0xC3, 0x18, 0x57, 0x14, 0x1C, 0x0D, 0x1B, 0x05, 0xFC, 0x0C, 0xFC, 0x0C, 0x1B, 0x0D, 0xFD, 0x0C, 
+0xDB, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBC, 0x1C, 0xBA, 0x04, 0x1A, 0x0D, 
+0xBD, 0x04, 0xFC, 0x14, 0x6C, 0x12, 0x6D, 0x1A, 0xB8, 0x04, 0x58, 0x14, 0xA7, 0x19, 0x52, 0x13, 0x1C, 0x05, 0x56, 0x1C, 0x03, 0x11, 0x0F, 0x13, 0xDB, 0x14, 0xDA, 0x14, 0x87, 0x11, 0x00, 0x00, 
+0x2D, 0x63, 0xDE, 0xFF, 0xF8, 0xAD, 0xCB, 0x11, 0x0C, 0x02, 0xEB, 0x09, 0xCB, 0x01, 0xCB, 0x01, 0xB7, 0xA5, 0xDE, 0xFF, 0x56, 0x95, 0x69, 0x01, 0x70, 0x4B, 0xBB, 0xCE, 0xFF, 0xFF, 0x5E, 0xDF, 
+0x50, 0x43, 0xEB, 0x11, 0xCB, 0x01, 0x49, 0x01, 0xF5, 0x7C, 0xFF, 0xFF, 0xB7, 0xA5, 0x4D, 0x1A, 0x0C, 0x02, 0xEB, 0x09, 0xEC, 0x09, 0xEC, 0x09, 0x77, 0x95, 0x5C, 0xEF, 0xC6, 0x39, 0x00, 0x00, 
+0x2A, 0x1A, 0x3E, 0x1D, 0xBF, 0x0D, 0x9C, 0x15, 0x6B, 0x0A, 0x6B, 0x1A, 0x7F, 0x0D, 0xB9, 0x0C, 0x69, 0x19, 0x52, 0x1B, 0x3C, 0x0D, 0x55, 0x0C, 0x45, 0x11, 0x92, 0x13, 0x1B, 0x15, 0x1C, 0x0D, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x04, 0xDC, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBA, 0x0C, 0xBD, 0x0C, 0x3B, 0x05, 0x99, 0x0C, 0xBB, 0x14, 0xBC, 0x14, 0xF4, 0x0B, 0x8A, 0x19, 0x77, 0x14, 0xD9, 0x0C, 0xAD, 0x1A, 0xAE, 0x0A, 0xB9, 0x04, 0xDB, 0x1C, 0xA8, 0x19, 0x2A, 0x0A, 
+0x1A, 0x0D, 0xBA, 0x14, 0x87, 0x11, 0x00, 0x00, 0x2D, 0x63, 0xDE, 0xFF, 0xF8, 0xAD, 0xAB, 0x11, 0x0C, 0x02, 0xEB, 0x09, 0xAB, 0x01, 0xEB, 0x09, 0xB7, 0xA5, 0xDE, 0xFF, 0x77, 0x95, 0x6A, 0x01, 
+0x68, 0x01, 0x50, 0x43, 0xFB, 0xD6, 0xFF, 0xFF, 0x1D, 0xCF, 0xB0, 0x53, 0x69, 0x01, 0xCA, 0x09, 0x94, 0x74, 0xFF, 0xFF, 0xD8, 0xA5, 0x6D, 0x1A, 0xEC, 0x01, 0xEB, 0x09, 0xEC, 0x09, 0x0C, 0x12, 
+0x77, 0x95, 0x7C, 0xE7, 0x06, 0x2A, 0x01, 0x00, 0x09, 0x12, 0x7D, 0x1D, 0x3F, 0x0D, 0x1E, 0x05, 0x98, 0x1C, 0x89, 0x21, 0xB9, 0x14, 0x5B, 0x05, 0x4C, 0x22, 0x8D, 0x1A, 0xFB, 0x0C, 0xF9, 0x04, 
+0x87, 0x19, 0xAE, 0x12, 0xFB, 0x0C, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x04, 0xDC, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x77, 0x9D, 
+0xB7, 0x0B, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xDB, 0x04, 0xB9, 0x0C, 0xBC, 0x0C, 0x1B, 0x0D, 0x7A, 0x14, 0xD9, 0x0C, 0xEB, 0x19, 0xB4, 0x1B, 0xFA, 0x0C, 0x31, 0x1B, 0xEB, 0x19, 
+0x58, 0x24, 0xBB, 0x14, 0x6D, 0x12, 0xA7, 0x11, 0xBA, 0x14, 0xBA, 0x14, 0x87, 0x11, 0x00, 0x00, 0x2D, 0x63, 0xDE, 0xFF, 0xF8, 0xAD, 0xAB, 0x11, 0x0C, 0x02, 0xEB, 0x01, 0xEB, 0x01, 0xCB, 0x09, 
+0xD8, 0xA5, 0xDE, 0xFF, 0x16, 0x85, 0xCB, 0x01, 0xAD, 0x32, 0xAA, 0x01, 0xED, 0x4A, 0xFB, 0xD6, 0xFF, 0xF7, 0xFC, 0xCE, 0x90, 0x4B, 0x8A, 0x01, 0x73, 0x74, 0xDF, 0xFF, 0xD8, 0xAD, 0x6D, 0x1A, 
+0xEC, 0x01, 0xEB, 0x09, 0xEB, 0x09, 0x0C, 0x12, 0x77, 0x9D, 0x3B, 0xEF, 0xE7, 0x39, 0x00, 0x00, 0x49, 0x0A, 0x5B, 0x1D, 0xFC, 0x14, 0x3D, 0x0D, 0xFC, 0x1C, 0x0B, 0x22, 0x14, 0x1C, 0x5C, 0x05, 
+0x30, 0x1B, 0xE9, 0x19, 0xBB, 0x14, 0x1C, 0x0D, 0xEB, 0x21, 0x09, 0x12, 0xDB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x04, 0xFB, 0x0C, 0xFB, 0x04, 0xDC, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xFB, 0x0C, 0x99, 0x0C, 0xFD, 0x04, 0xDB, 0x04, 0x9C, 0x0C, 0xDA, 0x0C, 0xCF, 0x1A, 
+0x10, 0x1B, 0x1C, 0x0D, 0x74, 0x1B, 0xC9, 0x29, 0x17, 0x1C, 0xDB, 0x0C, 0x31, 0x13, 0x86, 0x19, 0x39, 0x14, 0xBA, 0x14, 0x87, 0x11, 0x00, 0x00, 0x2D, 0x63, 0xDE, 0xFF, 0xF8, 0xAD, 0xAB, 0x11, 
+0x0C, 0x02, 0xEB, 0x01, 0xCB, 0x01, 0xCB, 0x09, 0xD8, 0xA5, 0xFF, 0xFF, 0x36, 0x95, 0x0B, 0x12, 0x37, 0x8D, 0x94, 0x74, 0xA9, 0x11, 0x2F, 0x43, 0xBB, 0xC6, 0xFF, 0xFF, 0xB8, 0x9D, 0xAA, 0x09, 
+0x33, 0x6C, 0xDF, 0xFF, 0xF8, 0xAD, 0x4D, 0x1A, 0xEC, 0x01, 0xEB, 0x09, 0xCB, 0x01, 0x0C, 0x0A, 0x77, 0x9D, 0x3B, 0xEF, 0xA8, 0x49, 0x00, 0x00, 0x69, 0x12, 0xFC, 0x1C, 0x3C, 0x0D, 0xDC, 0x15, 
+0xBB, 0x0C, 0xCE, 0x22, 0x91, 0x1B, 0x1E, 0x05, 0xD3, 0x1B, 0xC7, 0x21, 0x9A, 0x0C, 0xFC, 0x14, 0xCF, 0x1A, 0xA7, 0x19, 0xFB, 0x0C, 0xFD, 0x0C, 0xDB, 0x0C, 0xFC, 0x04, 0xFB, 0x14, 0xFB, 0x04, 
+0xDC, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xBC, 0x0C, 0xBA, 0x14, 0xDA, 0x0C, 
+0xDC, 0x14, 0xDC, 0x04, 0xDA, 0x14, 0x32, 0x13, 0x2F, 0x13, 0xBC, 0x14, 0xF5, 0x1B, 0x89, 0x22, 0x58, 0x04, 0xDB, 0x0C, 0x73, 0x1B, 0x86, 0x19, 0x9A, 0x14, 0xBA, 0x14, 0x87, 0x11, 0x00, 0x00, 
+0x2D, 0x63, 0xDE, 0xFF, 0xF8, 0xAD, 0xAB, 0x11, 0x0C, 0x02, 0x0C, 0x0A, 0xAA, 0x01, 0xCB, 0x01, 0xD8, 0xA5, 0xDE, 0xFF, 0x56, 0x95, 0xA9, 0x09, 0xF9, 0xA5, 0xBE, 0xEF, 0x74, 0x64, 0xEC, 0x01, 
+0x0E, 0x43, 0xFA, 0xDE, 0xF9, 0xAD, 0x69, 0x01, 0x75, 0x74, 0xDF, 0xFF, 0xF8, 0xAD, 0x4D, 0x1A, 0xEC, 0x01, 0xEB, 0x09, 0xCB, 0x01, 0xEC, 0x09, 0x77, 0x9D, 0x5B, 0xE7, 0xE7, 0x29, 0x20, 0x00, 
+0x0A, 0x1A, 0xFE, 0x14, 0x5E, 0x0D, 0xF9, 0x04, 0x1E, 0x0D, 0x51, 0x1B, 0x11, 0x1B, 0xBE, 0x14, 0x14, 0x34, 0x09, 0x32, 0xDC, 0x04, 0xFB, 0x0C, 0x51, 0x13, 0xA7, 0x21, 0x1C, 0x15, 0xFD, 0x0C, 
+0xDB, 0x0C, 0xFD, 0x04, 0xFC, 0x14, 0xFB, 0x04, 0xBB, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x77, 0x9D, 0xB7, 0x13, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBA, 0x0C, 0xBC, 0x04, 0xFC, 0x04, 0x99, 0x04, 0xDA, 0x0C, 0xDA, 0x14, 0xFA, 0x0C, 0x33, 0x1B, 0x10, 0x13, 0xDB, 0x04, 0xD5, 0x23, 0x29, 0x2A, 0x38, 0x14, 0xF9, 0x04, 0x54, 0x1B, 0xA9, 0x19, 
+0x98, 0x0C, 0x9A, 0x14, 0xA7, 0x11, 0x00, 0x00, 0x0D, 0x63, 0xDE, 0xFF, 0xF8, 0xA5, 0xCB, 0x09, 0xEC, 0x09, 0x0B, 0x0A, 0xCC, 0x09, 0xAB, 0x09, 0xD8, 0xA5, 0xBE, 0xF7, 0x16, 0x95, 0xCB, 0x11, 
+0x36, 0x7D, 0xBE, 0xEF, 0x5D, 0xEF, 0x93, 0x7C, 0xCA, 0x09, 0x92, 0x43, 0xF6, 0x7C, 0xA9, 0x11, 0x54, 0x6C, 0xFF, 0xFF, 0xD8, 0xAD, 0x4D, 0x1A, 0xEC, 0x01, 0xEB, 0x09, 0xEB, 0x01, 0x0C, 0x0A, 
+0x77, 0x9D, 0x3D, 0xE7, 0xC6, 0x41, 0x00, 0x00, 0xEA, 0x29, 0x1D, 0x1D, 0x1D, 0x05, 0xFC, 0x14, 0x19, 0x05, 0x72, 0x1B, 0x31, 0x1B, 0x1D, 0x05, 0x15, 0x24, 0x09, 0x3A, 0xB8, 0x04, 0xDC, 0x0C, 
+0x10, 0x1B, 0xA7, 0x19, 0x1C, 0x0D, 0xFD, 0x0C, 0xDB, 0x0C, 0xFC, 0x04, 0xFB, 0x14, 0x1B, 0x05, 0xDC, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x77, 0x9D, 
+0xB7, 0x0B, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xD9, 0x14, 0x1C, 0x05, 0x9C, 0x0C, 0xDC, 0x0C, 0xBC, 0x0C, 0xB9, 0x04, 0xF0, 0x22, 0x50, 0x1B, 0x1B, 0x05, 0x74, 0x1B, 0xEA, 0x31, 
+0x58, 0x1C, 0x1B, 0x0D, 0x51, 0x0B, 0xA8, 0x19, 0x58, 0x14, 0x9A, 0x14, 0xA7, 0x11, 0x00, 0x00, 0x0D, 0x63, 0xDE, 0xFF, 0xF8, 0xA5, 0xCB, 0x09, 0xEC, 0x09, 0xEB, 0x01, 0xCB, 0x09, 0xAB, 0x09, 
+0xB8, 0x9D, 0xFE, 0xFF, 0x77, 0x9D, 0x8A, 0x01, 0xAD, 0x2A, 0xF9, 0xAD, 0xBF, 0xF7, 0x9E, 0xE7, 0xB4, 0x74, 0xEB, 0x11, 0x2C, 0x12, 0x89, 0x01, 0x74, 0x6C, 0xFF, 0xFF, 0xD8, 0xAD, 0x4D, 0x1A, 
+0xEC, 0x01, 0xEB, 0x09, 0xEB, 0x01, 0x0C, 0x0A, 0x77, 0x9D, 0x5C, 0xE7, 0xE7, 0x39, 0x00, 0x00, 0xC9, 0x19, 0x5C, 0x15, 0x5D, 0x05, 0xFC, 0x1C, 0xFD, 0x14, 0xF0, 0x1A, 0x30, 0x1B, 0x1C, 0x05, 
+0xD3, 0x13, 0xC8, 0x29, 0x9A, 0x14, 0xFD, 0x0C, 0x0F, 0x1B, 0xA8, 0x19, 0xFB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x04, 0xFB, 0x14, 0xFB, 0x04, 0xDC, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 
+0xDF, 0xFF, 0xDE, 0xFF, 0x5C, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBA, 0x14, 0xFB, 0x04, 0xBC, 0x0C, 0xFA, 0x04, 0xBD, 0x14, 0xD9, 0x0C, 0x4C, 0x2A, 
+0x72, 0x03, 0xB9, 0x0C, 0x11, 0x1B, 0x0B, 0x1A, 0x77, 0x04, 0xBC, 0x14, 0x6C, 0x12, 0x66, 0x19, 0x9A, 0x0C, 0x9A, 0x14, 0xA7, 0x11, 0x00, 0x00, 0x0D, 0x63, 0xDE, 0xFF, 0xF8, 0xA5, 0xCB, 0x09, 
+0xEC, 0x09, 0x0C, 0x0A, 0x8B, 0x01, 0xAB, 0x09, 0xD8, 0x9D, 0xFE, 0xFF, 0x77, 0x9D, 0x8A, 0x01, 0x89, 0x01, 0x8C, 0x2A, 0x1A, 0xB6, 0xFF, 0xF7, 0xBE, 0xE7, 0x54, 0x74, 0xEC, 0x11, 0x69, 0x01, 
+0x74, 0x74, 0xFF, 0xFF, 0xD8, 0xAD, 0x4D, 0x1A, 0xEC, 0x01, 0xEB, 0x09, 0xEB, 0x01, 0x0C, 0x0A, 0x77, 0x9D, 0x5D, 0xE7, 0xE7, 0x29, 0x01, 0x00, 0xE9, 0x11, 0x5C, 0x15, 0x1B, 0x05, 0xDC, 0x0C, 
+0xDE, 0x0C, 0x8C, 0x12, 0x51, 0x1B, 0xFC, 0x14, 0x10, 0x13, 0x08, 0x12, 0x9B, 0x14, 0xDB, 0x04, 0x2B, 0x12, 0xEA, 0x19, 0xDB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x04, 0xFB, 0x14, 0xFB, 0x04, 
+0xBC, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0xBA, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0x9C, 0x14, 0xDC, 0x04, 0x1B, 0x0D, 
+0xF9, 0x04, 0x9C, 0x04, 0x97, 0x14, 0xC8, 0x21, 0x17, 0x0C, 0xBA, 0x14, 0xCE, 0x2A, 0x8D, 0x12, 0xB9, 0x04, 0x7C, 0x14, 0xA8, 0x21, 0xE8, 0x11, 0xFB, 0x14, 0x9A, 0x14, 0xA7, 0x11, 0x00, 0x00, 
+0x0D, 0x63, 0xDE, 0xFF, 0xF8, 0xA5, 0xCB, 0x09, 0xEC, 0x09, 0xEC, 0x09, 0xAB, 0x01, 0xAA, 0x01, 0xB8, 0x9D, 0xDE, 0xFF, 0x77, 0x9D, 0xEC, 0x09, 0xEC, 0x09, 0xAA, 0x01, 0x4C, 0x2A, 0x3A, 0xB6, 
+0xDF, 0xF7, 0x7F, 0xEF, 0x54, 0x6C, 0xEA, 0x09, 0x73, 0x74, 0xFF, 0xFF, 0xD8, 0xAD, 0x4D, 0x1A, 0xEC, 0x01, 0xEB, 0x09, 0xEB, 0x01, 0x0C, 0x0A, 0x77, 0x9D, 0x3C, 0xF7, 0xC6, 0x29, 0x01, 0x00, 
+0x0A, 0x1A, 0xFA, 0x1C, 0xBB, 0x0C, 0x3D, 0x05, 0xB9, 0x04, 0xE8, 0x19, 0x37, 0x14, 0xFD, 0x14, 0x6C, 0x22, 0x8B, 0x12, 0xDC, 0x14, 0xB9, 0x0C, 0x68, 0x19, 0x8D, 0x1A, 0xBB, 0x14, 0xFB, 0x0C, 
+0xFB, 0x0C, 0xFC, 0x04, 0xFB, 0x0C, 0xFB, 0x04, 0xBB, 0x14, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDE, 0xFF, 0x5C, 0xE7, 0x77, 0x9D, 0xB7, 0x13, 0xBA, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBA, 0x0C, 0xDC, 0x0C, 0xBB, 0x14, 0xDB, 0x0C, 0xDB, 0x04, 0xFC, 0x04, 0xB1, 0x1B, 0xE8, 0x19, 0x3A, 0x14, 0xB8, 0x0C, 0xA8, 0x29, 0x10, 0x13, 0xDB, 0x0C, 0x58, 0x1C, 0x24, 0x21, 0xED, 0x12, 
+0xBC, 0x14, 0x9A, 0x14, 0xA7, 0x11, 0x00, 0x00, 0x0D, 0x63, 0xDE, 0xFF, 0xF8, 0xA5, 0xCB, 0x09, 0xEC, 0x09, 0xCC, 0x01, 0xEC, 0x09, 0x8A, 0x01, 0x77, 0x95, 0xDE, 0xFF, 0x18, 0xAE, 0x0C, 0x12, 
+0xAB, 0x01, 0x4C, 0x0A, 0xAB, 0x01, 0x2C, 0x1A, 0xD7, 0xA5, 0xDF, 0xFF, 0x9F, 0xEF, 0x31, 0x64, 0x72, 0x7C, 0xDF, 0xF7, 0xD8, 0xAD, 0x4D, 0x1A, 0xEC, 0x01, 0xEB, 0x09, 0xEB, 0x01, 0x0C, 0x0A, 
+0x77, 0x9D, 0x3D, 0xF7, 0xC5, 0x31, 0x01, 0x00, 0x0A, 0x1A, 0xD9, 0x1C, 0xFD, 0x0C, 0x5D, 0x15, 0xAF, 0x23, 0xA9, 0x19, 0xFC, 0x04, 0x99, 0x0C, 0x87, 0x21, 0x30, 0x13, 0xDD, 0x14, 0x55, 0x1C, 
+0x25, 0x19, 0x32, 0x1B, 0xDB, 0x14, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x04, 0xFB, 0x0C, 0xDC, 0x0C, 0xBB, 0x14, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0x5C, 0xE7, 0x77, 0x9D, 
+0xB7, 0x13, 0xBA, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xDB, 0x04, 0xBC, 0x14, 0xDB, 0x04, 0xBB, 0x14, 0x57, 0x2C, 0x09, 0x1A, 0x0E, 0x1B, 0xBC, 0x04, 0x51, 0x0B, 0x05, 0x11, 0xF5, 0x13, 
+0xFB, 0x14, 0x11, 0x1B, 0x82, 0x10, 0xF4, 0x13, 0x9B, 0x0C, 0x9A, 0x14, 0xA7, 0x11, 0x00, 0x00, 0x0D, 0x63, 0xDE, 0xFF, 0xF8, 0xA5, 0xCB, 0x09, 0xEC, 0x09, 0xCB, 0x01, 0xEB, 0x09, 0x8A, 0x01, 
+0x37, 0x8D, 0xFF, 0xFF, 0x59, 0xBE, 0x0B, 0x12, 0xAB, 0x01, 0xCA, 0x01, 0xAB, 0x01, 0x0C, 0x0A, 0x8C, 0x2A, 0xD7, 0xB5, 0xFF, 0xFF, 0x3C, 0xD7, 0xBB, 0xCE, 0xDF, 0xF7, 0xD8, 0xA5, 0x4C, 0x1A, 
+0xEC, 0x01, 0xEB, 0x09, 0xEB, 0x01, 0x0C, 0x0A, 0x77, 0x9D, 0x3C, 0xE7, 0xE5, 0x39, 0x00, 0x00, 0x2A, 0x12, 0xFA, 0x0C, 0x1D, 0x05, 0x38, 0x14, 0xA7, 0x29, 0x31, 0x1B, 0x1C, 0x0D, 0x0F, 0x13, 
+0x25, 0x19, 0xD6, 0x0B, 0x1E, 0x0D, 0x2F, 0x1B, 0xC2, 0x18, 0xF6, 0x13, 0xDB, 0x14, 0xFA, 0x04, 0xDB, 0x04, 0xDC, 0x0C, 0xDA, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 
+0xDF, 0xFF, 0xDE, 0xFF, 0x5C, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0xBA, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xDB, 0x04, 0xDD, 0x0C, 0x1B, 0x05, 0x79, 0x14, 0xAF, 0x22, 0xC9, 0x11, 0x57, 0x1C, 
+0xB8, 0x14, 0xA9, 0x11, 0x4D, 0x1A, 0xDB, 0x14, 0x77, 0x14, 0x88, 0x19, 0x27, 0x11, 0x99, 0x14, 0xDB, 0x04, 0x9A, 0x14, 0xA7, 0x11, 0x00, 0x00, 0x0D, 0x63, 0xDE, 0xFF, 0xF8, 0xA5, 0xCB, 0x09, 
+0xEC, 0x09, 0xEB, 0x09, 0xCA, 0x01, 0x8A, 0x01, 0xD6, 0x7C, 0xDF, 0xFF, 0x9A, 0xC6, 0x8C, 0x22, 0xEC, 0x01, 0x0C, 0x0A, 0xEC, 0x09, 0xCB, 0x01, 0xCB, 0x01, 0xAE, 0x32, 0x76, 0x9D, 0xFF, 0xF7, 
+0xBF, 0xF7, 0xDE, 0xF7, 0xB8, 0xA5, 0x4C, 0x1A, 0xEC, 0x01, 0xEB, 0x09, 0xEB, 0x01, 0x0C, 0x0A, 0x77, 0x9D, 0x5C, 0xDF, 0xC6, 0x39, 0x20, 0x00, 0x2A, 0x1A, 0xFB, 0x0C, 0xDA, 0x0C, 0xD1, 0x12, 
+0xA9, 0x19, 0xD9, 0x1C, 0xF5, 0x1B, 0xA8, 0x19, 0x6C, 0x1A, 0xBB, 0x04, 0xB9, 0x0C, 0xA9, 0x11, 0xA8, 0x19, 0x79, 0x14, 0xDB, 0x0C, 0xFA, 0x04, 0xDC, 0x0C, 0xDC, 0x0C, 0xFA, 0x0C, 0xDC, 0x0C, 
+0xBB, 0x0C, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDE, 0xFF, 0x5C, 0xE7, 0x76, 0x9D, 0xB7, 0x0B, 0xBA, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xFA, 0x14, 0x9B, 0x0C, 0xB9, 0x14, 
+0xBA, 0x0C, 0x8F, 0x0A, 0xD4, 0x1B, 0x9B, 0x0C, 0x4A, 0x1A, 0xE3, 0x10, 0xF6, 0x2B, 0x9C, 0x0C, 0x71, 0x0B, 0x82, 0x10, 0xCE, 0x1A, 0xBC, 0x0C, 0xDA, 0x0C, 0x9A, 0x14, 0xA7, 0x11, 0x00, 0x00, 
+0x0D, 0x63, 0xDE, 0xFF, 0xF8, 0xA5, 0xCB, 0x09, 0xEC, 0x09, 0xEB, 0x09, 0xCA, 0x01, 0xAA, 0x01, 0x14, 0x6C, 0x9E, 0xFF, 0x3C, 0xDF, 0x2E, 0x3B, 0xAA, 0x01, 0x0C, 0x02, 0x8A, 0x09, 0x0B, 0x0A, 
+0x2D, 0x02, 0xAB, 0x01, 0xCD, 0x3A, 0x96, 0xA5, 0xDF, 0xFF, 0xBE, 0xF7, 0xB8, 0xA5, 0x2C, 0x1A, 0xEC, 0x01, 0xEB, 0x09, 0xEB, 0x01, 0x0C, 0x0A, 0x77, 0x9D, 0x5D, 0xEF, 0xA6, 0x31, 0x00, 0x00, 
+0xE9, 0x21, 0xFD, 0x14, 0x98, 0x1C, 0x8D, 0x1A, 0xD4, 0x13, 0x99, 0x0C, 0x4C, 0x0A, 0x05, 0x09, 0x15, 0x1C, 0xFC, 0x0C, 0x50, 0x1B, 0x43, 0x08, 0x50, 0x13, 0xDB, 0x0C, 0xDB, 0x0C, 0xFA, 0x04, 
+0xDC, 0x0C, 0xDC, 0x14, 0xFA, 0x0C, 0xDC, 0x0C, 0xBB, 0x04, 0xF8, 0x0B, 0x77, 0xA5, 0x5D, 0xEF, 0xDF, 0xFF, 0xDE, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBA, 0x0C, 0xDC, 0x0C, 0xBA, 0x04, 0xBA, 0x0C, 0x9B, 0x0C, 0x9C, 0x04, 0xDB, 0x0C, 0x93, 0x1B, 0x47, 0x11, 0x2F, 0x1B, 0xDC, 0x1C, 0xB5, 0x23, 0xC1, 0x08, 0xC7, 0x09, 0x98, 0x1C, 0xBB, 0x0C, 
+0xBB, 0x14, 0x99, 0x14, 0x48, 0x11, 0x00, 0x00, 0x4D, 0x63, 0xBE, 0xFF, 0xF7, 0xAD, 0x0B, 0x1A, 0xEC, 0x01, 0xEA, 0x11, 0x0C, 0x0A, 0x8A, 0x01, 0x2F, 0x4B, 0xDF, 0xFF, 0x7E, 0xEF, 0xD1, 0x5B, 
+0x8A, 0x01, 0xCB, 0x01, 0xEB, 0x09, 0x0B, 0x0A, 0xCB, 0x01, 0xEB, 0x09, 0x89, 0x01, 0xAD, 0x2A, 0x1B, 0xA6, 0xDF, 0xFF, 0xD8, 0xAD, 0xEA, 0x19, 0x0B, 0x02, 0x0C, 0x02, 0xCB, 0x01, 0xEB, 0x11, 
+0xB9, 0x9D, 0x3D, 0xE7, 0xA5, 0x31, 0x20, 0x00, 0x0A, 0x1A, 0xDB, 0x14, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xF3, 0x23, 0x86, 0x19, 0x51, 0x23, 0x1D, 0x0D, 0xF4, 0x1B, 0xC3, 0x08, 0xCA, 0x09, 
+0x57, 0x0C, 0xFC, 0x0C, 0xDB, 0x04, 0xDB, 0x04, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xD7, 0x0B, 0x76, 0xA5, 0x5C, 0xEF, 0xFF, 0xF7, 0xDE, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 
+0xB7, 0x0B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0x9C, 0x14, 0x9A, 0x04, 0xDA, 0x0C, 0xDB, 0x14, 0x9B, 0x0C, 0xDB, 0x0C, 0xD9, 0x24, 0x35, 0x2C, 0x1B, 0x05, 0x37, 0x04, 0x68, 0x01, 
+0xE5, 0x10, 0x33, 0x13, 0xBB, 0x0C, 0xFB, 0x0C, 0xDA, 0x04, 0x98, 0x14, 0xA9, 0x19, 0x00, 0x00, 0x4D, 0x63, 0xFF, 0xFF, 0x18, 0xAE, 0x8A, 0x09, 0x0D, 0x02, 0xCB, 0x09, 0xCB, 0x01, 0xCB, 0x01, 
+0x6C, 0x22, 0x3D, 0xDF, 0xBE, 0xEF, 0x77, 0x95, 0x2C, 0x12, 0xCB, 0x01, 0xCB, 0x01, 0x0C, 0x02, 0xEC, 0x01, 0x0C, 0x0A, 0xEB, 0x09, 0xAA, 0x01, 0x6D, 0x22, 0xB8, 0xAD, 0xB8, 0x9D, 0x4B, 0x22, 
+0xCB, 0x01, 0xEC, 0x01, 0x0C, 0x12, 0xC9, 0x19, 0xB7, 0xA5, 0x5D, 0xE7, 0xC6, 0x39, 0x00, 0x00, 0xC9, 0x11, 0xDA, 0x14, 0xFB, 0x0C, 0xDB, 0x14, 0xDB, 0x0C, 0xB9, 0x0C, 0x37, 0x1C, 0xDC, 0x14, 
+0x99, 0x0C, 0x66, 0x01, 0xE3, 0x10, 0x12, 0x1B, 0xFD, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x04, 0xD7, 0x0B, 0x76, 0xA5, 0x5C, 0xEF, 
+0xFF, 0xF7, 0xDE, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBC, 0x14, 0xBB, 0x04, 0xDA, 0x04, 0xDA, 0x0C, 0x9A, 0x0C, 0x9A, 0x04, 0xDB, 0x04, 
+0xFB, 0x0C, 0xDC, 0x04, 0x58, 0x14, 0xCF, 0x12, 0x72, 0x23, 0xDB, 0x14, 0xBB, 0x04, 0xDA, 0x14, 0xFC, 0x0C, 0x77, 0x0C, 0x88, 0x19, 0x00, 0x00, 0x4D, 0x63, 0xFF, 0xFF, 0xDB, 0xC6, 0x0B, 0x1A, 
+0xCB, 0x01, 0xAB, 0x01, 0xEC, 0x01, 0xCC, 0x01, 0xEA, 0x09, 0x56, 0x95, 0xFF, 0xFF, 0x1D, 0xD7, 0x6F, 0x53, 0x0C, 0x12, 0x8A, 0x01, 0xCB, 0x01, 0xEC, 0x01, 0xCB, 0x01, 0xCB, 0x01, 0xAB, 0x01, 
+0xAA, 0x01, 0xAD, 0x2A, 0xD2, 0x4B, 0x0C, 0x0A, 0xEC, 0x01, 0xCC, 0x01, 0xAA, 0x01, 0x2B, 0x22, 0x1A, 0xAE, 0x5D, 0xE7, 0xC6, 0x39, 0x20, 0x00, 0xC9, 0x11, 0xBA, 0x14, 0xFB, 0x0C, 0xBB, 0x14, 
+0xBB, 0x0C, 0xBC, 0x04, 0xFD, 0x0C, 0xBD, 0x04, 0x79, 0x1C, 0xAD, 0x12, 0x72, 0x1B, 0xBA, 0x1C, 0xBA, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBA, 0x04, 0xD7, 0x0B, 0x76, 0xA5, 0x5C, 0xEF, 0xFF, 0xF7, 0xDE, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xDA, 0x0C, 0xFB, 0x04, 0xDB, 0x04, 
+0xBB, 0x0C, 0xBB, 0x14, 0xBB, 0x14, 0xBB, 0x04, 0xBC, 0x04, 0x79, 0x14, 0xDC, 0x14, 0xDB, 0x14, 0xB9, 0x0C, 0xFB, 0x04, 0xFB, 0x0C, 0x9A, 0x0C, 0xBD, 0x14, 0xB9, 0x14, 0x88, 0x19, 0x00, 0x00, 
+0x4C, 0x63, 0x7E, 0xF7, 0x9E, 0xE7, 0x33, 0x74, 0x8D, 0x2A, 0x2B, 0x22, 0xAD, 0x2A, 0x2C, 0x12, 0x2A, 0x1A, 0x0D, 0x4B, 0xBB, 0xCE, 0xFF, 0xF7, 0xBB, 0xCE, 0x33, 0x6C, 0xAD, 0x32, 0x4C, 0x22, 
+0x4C, 0x22, 0x2B, 0x1A, 0x4C, 0x1A, 0x4C, 0x1A, 0x4C, 0x1A, 0x0B, 0x12, 0x6D, 0x22, 0x6D, 0x1A, 0x6D, 0x1A, 0x6D, 0x1A, 0x4C, 0x22, 0x12, 0x64, 0x3D, 0xCF, 0x3D, 0xE7, 0xC6, 0x39, 0x20, 0x00, 
+0xEA, 0x19, 0xDB, 0x14, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x04, 0xDD, 0x0C, 0xDA, 0x14, 0x99, 0x0C, 0xBC, 0x14, 0xDC, 0x1C, 0xFC, 0x04, 0xFC, 0x04, 0xB9, 0x14, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xBA, 0x04, 0xD7, 0x0B, 0x76, 0xA5, 0x5C, 0xEF, 0xFF, 0xF7, 0xDE, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBA, 0x0C, 0xB9, 0x04, 0xDB, 0x0C, 0xDC, 0x0C, 0x9B, 0x04, 0xBB, 0x0C, 0xDB, 0x14, 0xDB, 0x14, 0xDC, 0x0C, 0xDA, 0x14, 0x9C, 0x04, 0xDC, 0x0C, 0x99, 0x0C, 0xBB, 0x04, 0x1C, 0x05, 0x9A, 0x04, 
+0xBA, 0x14, 0xB9, 0x14, 0x68, 0x11, 0x20, 0x00, 0x4C, 0x63, 0x9E, 0xFF, 0xFF, 0xFF, 0x9F, 0xEF, 0x9B, 0xC6, 0x39, 0xBE, 0x39, 0xB6, 0x7B, 0xB6, 0x7A, 0xB6, 0x18, 0xB6, 0xFB, 0xDE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBF, 0xEF, 0xDC, 0xD6, 0x59, 0xBE, 0x19, 0xB6, 0x39, 0xAE, 0x5A, 0xB6, 0x19, 0xAE, 0xD8, 0xA5, 0xF8, 0xAD, 0xF7, 0xAD, 0x19, 0xB6, 0x18, 0xB6, 0x19, 0xB6, 0x39, 0xBE, 0x5D, 0xE7, 
+0xFF, 0xFF, 0x5D, 0xE7, 0xC6, 0x31, 0x00, 0x00, 0x0A, 0x1A, 0xDB, 0x14, 0xFB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x04, 0xF9, 0x0C, 0x1B, 0x0D, 0xBC, 0x0C, 0xDC, 0x14, 0xBB, 0x0C, 0xBB, 0x04, 
+0xDD, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0x9A, 0x04, 0xD7, 0x0B, 0x76, 0xA5, 0x5C, 0xEF, 0xFF, 0xF7, 0xDE, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 
+0xB7, 0x0B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0x9B, 0x1C, 0x9C, 0x14, 0x9C, 0x04, 0xBB, 0x04, 0xBA, 0x04, 0x9A, 0x0C, 0xBA, 0x0C, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x0C, 
+0xDC, 0x14, 0xDC, 0x14, 0xBB, 0x0C, 0xBA, 0x0C, 0xDA, 0x0C, 0xB9, 0x0C, 0x68, 0x11, 0x00, 0x00, 0xCA, 0x52, 0x7D, 0xF7, 0xBD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBE, 0xF7, 0x3D, 0xE7, 0xA5, 0x31, 0x00, 0x00, 0xE9, 0x19, 0xDB, 0x14, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x9A, 0x04, 0xFC, 0x04, 
+0xDB, 0x0C, 0x9A, 0x14, 0xFB, 0x14, 0xDB, 0x04, 0xBB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x7A, 0x0C, 0x19, 0x04, 0xD7, 0x0B, 0x76, 0xA5, 0x5C, 0xEF, 
+0xFF, 0xF7, 0xDE, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 0xB7, 0x0B, 0x9A, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0xBB, 0x0C, 0x7A, 0x14, 0x7A, 0x14, 0xDB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xDA, 0x0C, 0xBB, 0x14, 0xDB, 0x0C, 0x9A, 0x04, 0xBB, 0x04, 0xBB, 0x0C, 0x9A, 0x0C, 0xBB, 0x14, 0xBB, 0x0C, 0x99, 0x14, 0x88, 0x19, 0x00, 0x00, 0xE7, 0x39, 0x1C, 0xE7, 0xFE, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xF8, 0xBD, 0x23, 0x21, 0x00, 0x00, 0xEA, 0x19, 0xBA, 0x14, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x04, 0xDC, 0x1C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x14, 0x9B, 0x04, 0xDB, 0x04, 0xFB, 0x0C, 0xD9, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0x3A, 0x0C, 0xF9, 0x03, 
+0xD8, 0x03, 0xD7, 0x0B, 0x76, 0xA5, 0x5C, 0xEF, 0xFF, 0xF7, 0xDE, 0xFF, 0x7D, 0xE7, 0x77, 0x9D, 0x97, 0x0B, 0x9A, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0xDB, 0x04, 0xBB, 0x0C, 0xDA, 0x0C, 
+0xDA, 0x04, 0x9A, 0x04, 0x9B, 0x14, 0x9B, 0x14, 0xBB, 0x04, 0x9B, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x14, 0xBA, 0x14, 0xBC, 0x04, 0x9B, 0x04, 0xBA, 0x14, 0x99, 0x14, 0x89, 0x19, 0x00, 0x00, 
+0xA2, 0x08, 0xB7, 0xB5, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0x51, 0x84, 0x40, 0x08, 0x00, 0x00, 
+0x0A, 0x1A, 0xBA, 0x0C, 0xDB, 0x0C, 0xBB, 0x14, 0xDB, 0x0C, 0x9B, 0x04, 0xFB, 0x0C, 0xDA, 0x0C, 0xBA, 0x04, 0x1C, 0x0D, 0xBA, 0x0C, 0xDB, 0x14, 0xBC, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0x9A, 0x0C, 0x39, 0x04, 0xD8, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xD7, 0x0B, 0x76, 0xA5, 0x5C, 0xEF, 0xFF, 0xF7, 0xDF, 0xF7, 0x3D, 0xEF, 0x56, 0x9D, 0xF7, 0x0B, 0x79, 0x0C, 0xBA, 0x14, 0xBB, 0x0C, 
+0xBA, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0x9A, 0x1C, 0x0A, 0x12, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x63, 0x7D, 0xEF, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xBA, 0xD6, 0xE7, 0x39, 0x00, 0x00, 0x20, 0x00, 0x8D, 0x0A, 0xDB, 0x14, 0xBB, 0x0C, 0x9B, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xDC, 0x14, 0x7B, 0x0C, 0x3A, 0x0C, 0xF9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xB7, 0x13, 0x76, 0x9D, 0x5D, 0xEF, 0xDF, 0xF7, 0xDF, 0xF7, 0x3D, 0xEF, 0x56, 0x9D, 
+0xD7, 0x0B, 0x39, 0x0C, 0x7A, 0x14, 0x9B, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x7A, 0x14, 0xAD, 0x22, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0x71, 0x8C, 0xDF, 0xF7, 0xDE, 0xF7, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0x5D, 0xEF, 0xEF, 0x7B, 0xA1, 0x10, 0x00, 0x00, 0x40, 0x08, 0xEE, 0x12, 0xBA, 0x14, 0xBB, 0x0C, 0xBB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x5A, 0x0C, 0x1A, 0x0C, 0xF9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x0B, 0xD9, 0x0B, 0xD9, 0x03, 0xB7, 0x13, 0x76, 0x9D, 0x5D, 0xEF, 
+0xDF, 0xF7, 0xFF, 0xF7, 0x5D, 0xEF, 0x56, 0x9D, 0xB6, 0x0B, 0xF8, 0x03, 0xF8, 0x0B, 0x19, 0x0C, 0x59, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x14, 0x4B, 0x1A, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xE3, 0x18, 0x92, 0x8C, 
+0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xE7, 0x30, 0x84, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x0F, 0x1B, 0xDA, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xDB, 0x04, 0xDB, 0x04, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x9B, 0x0C, 0x5A, 0x04, 0x39, 0x04, 0xD9, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 
+0xD8, 0x03, 0xB7, 0x13, 0x76, 0x9D, 0x5D, 0xEF, 0xDF, 0xF7, 0xDF, 0xF7, 0x5D, 0xEF, 0x77, 0xA5, 0xB6, 0x0B, 0xD7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xD7, 0x03, 0x59, 0x04, 0x59, 0x0C, 0x7A, 0x0C, 
+0x9A, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x14, 0x2B, 0x12, 0x20, 0x00, 
+0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x82, 0x08, 0x4C, 0x6B, 0x79, 0xCE, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xBE, 0xF7, 0xF7, 0xBD, 0xEB, 0x5A, 0x82, 0x10, 0x00, 0x00, 0x20, 0x00, 0x21, 0x00, 0x00, 0x00, 
+0xEF, 0x12, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0x7A, 0x0C, 0x3A, 0x0C, 0xF9, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x03, 0xB7, 0x13, 0x76, 0x9D, 0x5D, 0xEF, 0xDF, 0xF7, 0xDF, 0xF7, 0x5D, 0xEF, 0x56, 0x9D, 0xB7, 0x0B, 0xD8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 
+0xB7, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0x19, 0x0C, 0x59, 0x0C, 0x7A, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0x9B, 0x0C, 0x6C, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x2C, 0x63, 0xF3, 0x9C, 0x96, 0xB5, 0xB6, 0xB5, 0xD7, 0xBD, 0xD7, 0xBD, 
+0xB6, 0xB5, 0xB6, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x75, 0xAD, 0x96, 0xB5, 0xD7, 0xBD, 0x96, 0xB5, 0xD7, 0xBD, 0x96, 0xB5, 0x96, 0xB5, 0xB2, 0x94, 0xEB, 0x5A, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x12, 0xDB, 0x0C, 0x7A, 0x04, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x7A, 0x0C, 0x5A, 0x0C, 0x19, 0x04, 0xF9, 0x03, 0xD8, 0x03, 0xD8, 0x03, 
+0xB8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB7, 0x13, 0x76, 0x9D, 0x5D, 0xEF, 0xDF, 0xF7, 0xFF, 0xF7, 0x5D, 0xEF, 0x56, 0x9D, 
+0xB6, 0x0B, 0xD8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0x18, 0x04, 0x39, 0x04, 0x59, 0x04, 0x7A, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 
+0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0x4C, 0x12, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 
+0x41, 0x08, 0x61, 0x08, 0x41, 0x08, 0x20, 0x00, 0x20, 0x00, 0x41, 0x08, 0x20, 0x00, 0xA2, 0x10, 0xA2, 0x10, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x20, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x1A, 0xBB, 0x14, 0x5A, 0x0C, 0x7A, 0x0C, 0x59, 0x0C, 0x3A, 0x0C, 0x19, 0x04, 0xD9, 0x03, 
+0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xD8, 0x0B, 0xD9, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB7, 0x13, 0x76, 0x9D, 0x5D, 0xEF, 
+0xDF, 0xF7, 0xFF, 0xF7, 0x5D, 0xEF, 0x56, 0x9D, 0x96, 0x0B, 0xD7, 0x03, 0xB7, 0x0B, 0x98, 0x03, 0x97, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xD8, 0x03, 
+0xF8, 0x03, 0x39, 0x0C, 0x59, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0x7B, 0x04, 0x8C, 0x12, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x08, 0x00, 0x00, 
+0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xE3, 0x18, 0x4D, 0x6B, 0x92, 0x94, 0xAE, 0x73, 0x65, 0x29, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1A, 0x7A, 0x0C, 0x3A, 0x0C, 0xF9, 0x0B, 
+0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 
+0xD8, 0x03, 0xB7, 0x13, 0x76, 0x9D, 0x5D, 0xEF, 0xDF, 0xF7, 0xDE, 0xF7, 0x5D, 0xEF, 0x76, 0x9D, 0xB6, 0x0B, 0xF8, 0x03, 0xB7, 0x0B, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0x39, 0x0C, 0x59, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x9B, 0x04, 0x0F, 0x2B, 0x40, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xA2, 0x10, 0x14, 0xA5, 0x9E, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xF7, 0xBD, 0xA6, 0x31, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 
+0x10, 0x23, 0xD8, 0x03, 0xD8, 0x03, 0x98, 0x03, 0xD8, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 
+0xD8, 0x0B, 0xD8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0xB7, 0x13, 0x76, 0x9D, 0x5D, 0xEF, 0xDF, 0xF7, 0xDE, 0xF7, 0x5C, 0xE7, 0x97, 0x9D, 0x76, 0x0B, 0xB7, 0x0B, 0xD7, 0x0B, 0xB8, 0x03, 
+0x77, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 
+0xD8, 0x0B, 0x1A, 0x04, 0xF4, 0x2B, 0x46, 0x11, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
+0xEB, 0x5A, 0x7D, 0xEF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x7C, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x11, 0xB5, 0x1B, 0xD9, 0x03, 0xB8, 0x0B, 0x97, 0x0B, 0x99, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x13, 0x76, 0x9D, 0x5C, 0xEF, 0xFF, 0xFF, 0xDE, 0xF7, 0x5C, 0xE7, 0x97, 0x9D, 
+0x76, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0x97, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD7, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB6, 0x13, 0x0C, 0x0A, 0x41, 0x00, 0x00, 0x00, 0x20, 0x00, 0x21, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x0C, 0x63, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0x71, 0x8C, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 
+0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x62, 0x00, 0xAF, 0x22, 0xB7, 0x0B, 0xD9, 0x03, 0xB7, 0x0B, 0x97, 0x0B, 0xD9, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x13, 0x76, 0x9D, 0x3C, 0xE7, 
+0xDF, 0xF7, 0xDE, 0xFF, 0x5C, 0xE7, 0x97, 0x9D, 0x76, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0x97, 0x03, 0x54, 0x13, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x31, 0x58, 0xCE, 0xFE, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0x1B, 0xDF, 0x89, 0x4A, 0x00, 0x00, 
+0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x69, 0x09, 0xD7, 0x1B, 0xB9, 0x03, 0xB8, 0x03, 0x96, 0x03, 0xB7, 0x0B, 
+0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB7, 0x0B, 0x97, 0x9D, 0x3C, 0xE7, 0xDF, 0xF7, 0xDF, 0xFF, 0x5C, 0xE7, 0x77, 0x9D, 0x76, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0x97, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD9, 0x03, 0x77, 0x03, 0xF7, 0x1B, 
+0xD0, 0x0A, 0x05, 0x01, 0x40, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0x35, 0xAD, 0x7A, 0xCE, 
+0xF8, 0xBD, 0x4D, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x68, 0x11, 0xF3, 0x12, 0xD9, 0x03, 
+0xD9, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xD8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0x97, 0x0B, 0x97, 0xA5, 0x5C, 0xEF, 0xDF, 0xF7, 0xDF, 0xFF, 0x5C, 0xE7, 0x77, 0x9D, 0x76, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 
+0x97, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB8, 0x03, 0x76, 0x03, 0xB7, 0x0B, 0xB6, 0x0B, 0xF1, 0x0A, 0xC9, 0x11, 0xC4, 0x08, 0x62, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x81, 0x08, 0x65, 0x21, 0xC2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x05, 0x09, 
+0xA8, 0x11, 0x12, 0x13, 0xD8, 0x0B, 0x98, 0x03, 0xD8, 0x0B, 0x96, 0x0B, 0xB8, 0x0B, 0xD9, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0x96, 0x0B, 0x97, 0xA5, 0x5C, 0xEF, 0xDF, 0xF7, 0xDE, 0xFF, 0x5C, 0xEF, 0x97, 0xA5, 
+0x76, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0x97, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 
+0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x96, 0x0B, 0xB8, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xD8, 0x0B, 0x56, 0x03, 0xD2, 0x0A, 0x4D, 0x12, 0x67, 0x19, 0x47, 0x11, 0x47, 0x11, 
+0x47, 0x11, 0x47, 0x11, 0x46, 0x11, 0x47, 0x11, 0x67, 0x11, 0x67, 0x19, 0x26, 0x11, 0x47, 0x11, 0x47, 0x11, 0x26, 0x11, 0x47, 0x11, 0x47, 0x11, 0x47, 0x19, 0x47, 0x11, 0x47, 0x19, 0x66, 0x19, 
+0x67, 0x19, 0xAA, 0x11, 0x2E, 0x12, 0xF3, 0x0A, 0x97, 0x0B, 0xD8, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0x96, 0x0B, 0xB6, 0x13, 0xB8, 0x03, 0x98, 0x03, 0xB8, 0x13, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0x96, 0x0B, 0xB7, 0xA5, 0x7C, 0xEF, 
+0xDF, 0xF7, 0xDE, 0xFF, 0x7D, 0xEF, 0xD8, 0xAD, 0x96, 0x13, 0xB7, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0x97, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x96, 0x0B, 0xD8, 0x0B, 0x98, 0x03, 0x97, 0x03, 0xB8, 0x03, 0xB9, 0x03, 0xB8, 0x0B, 
+0x96, 0x1B, 0xB6, 0x1B, 0x75, 0x13, 0x95, 0x13, 0x96, 0x13, 0x96, 0x13, 0xB6, 0x13, 0x75, 0x0B, 0x95, 0x13, 0x95, 0x13, 0xF7, 0x1B, 0x75, 0x0B, 0x75, 0x0B, 0x96, 0x13, 0xB6, 0x13, 0xD6, 0x1B, 
+0x75, 0x13, 0x96, 0x13, 0xB5, 0x13, 0xD5, 0x13, 0xB5, 0x13, 0x95, 0x13, 0xB6, 0x0B, 0xD8, 0x03, 0x19, 0x04, 0xD8, 0x0B, 0x97, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0x97, 0x03, 0xB8, 0x03, 
+0xB7, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB7, 0x13, 0xD8, 0xAD, 0x7D, 0xEF, 0xDF, 0xF7, 0xDE, 0xFF, 0xBE, 0xF7, 0x19, 0xAE, 0xB7, 0x13, 0xB7, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0x97, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB8, 0x03, 0x97, 0x03, 0x96, 0x0B, 
+0x97, 0x0B, 0x97, 0x0B, 0x76, 0x0B, 0x55, 0x0B, 0x56, 0x03, 0x56, 0x03, 0x56, 0x03, 0x97, 0x0B, 0x56, 0x03, 0x56, 0x03, 0xB7, 0x0B, 0x76, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0x76, 0x03, 0x76, 0x03, 
+0x76, 0x03, 0x76, 0x03, 0x76, 0x03, 0x76, 0x03, 0x97, 0x0B, 0x76, 0x03, 0x76, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x76, 0x0B, 0x96, 0x0B, 0x96, 0x0B, 0x96, 0x0B, 0xD8, 0x0B, 0x98, 0x03, 
+0xD9, 0x03, 0xD8, 0x0B, 0x96, 0x03, 0x18, 0x0C, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xF8, 0x13, 0x19, 0xB6, 0x9D, 0xF7, 0xDF, 0xF7, 0xFF, 0xF7, 0xDE, 0xFF, 0x79, 0xCE, 0xD6, 0x23, 0xB7, 0x0B, 0xB7, 0x0B, 0xB8, 0x03, 
+0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x98, 0x03, 0x97, 0x0B, 0x77, 0x03, 0xF9, 0x13, 0x97, 0x03, 0x27, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x03, 0xD8, 0x03, 
+0x35, 0x0B, 0x82, 0x08, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 
+0x96, 0x13, 0x96, 0x0B, 0xD8, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xB7, 0x03, 0xD7, 0x0B, 0xB7, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xD6, 0x0B, 0x79, 0x03, 0xD9, 0x0B, 0xD6, 0x13, 0x97, 0x03, 0xDA, 0x03, 0xD8, 0x0B, 0x75, 0x0B, 0xF4, 0x33, 0xDC, 0xBE, 0x9E, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFB, 0xDE, 
+0x96, 0x5C, 0x97, 0x03, 0x97, 0x0B, 0x96, 0x0B, 0xB8, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x98, 0x03, 0x97, 0x0B, 0xD8, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x48, 0x01, 0xEB, 0x5A, 0x1C, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0x5C, 0xDF, 
+0xB0, 0x5B, 0x62, 0x10, 0x00, 0x00, 0x2C, 0x0A, 0xE5, 0x00, 0x00, 0x00, 0x69, 0x4A, 0xBA, 0xD6, 0xBE, 0xF7, 0xFB, 0xDE, 0x6D, 0x6B, 0xC2, 0x18, 0x20, 0x00, 0xB2, 0x8C, 0xFF, 0xFF, 0xBF, 0xF7, 
+0xFF, 0xF7, 0x17, 0xBE, 0x07, 0x4A, 0x42, 0x00, 0xE6, 0x00, 0x55, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xD7, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0xB8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x96, 0x03, 0x98, 0x03, 0xB7, 0x03, 0xB6, 0x03, 0xB8, 0x0B, 0x98, 0x03, 0xB7, 0x03, 0xD7, 0x03, 0xB6, 0x64, 0x1D, 0xCF, 0xBE, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBF, 0xF7, 0xD7, 0xAD, 0x77, 0x0B, 0xB8, 0x03, 0xB6, 0x13, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x77, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xD8, 0x0B, 0xB7, 0x0B, 0x48, 0x01, 0xBA, 0xD6, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xFF, 0xFF, 0xF7, 0x7A, 0xBE, 0xC1, 0x18, 0x20, 0x00, 0x01, 0x00, 0x71, 0x94, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x8C, 
+0x41, 0x00, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x83, 0x40, 0x08, 0x14, 0x03, 0x96, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xD8, 0x0B, 
+0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x99, 0x0B, 0xF7, 0x0B, 0xF7, 0x03, 0xB8, 0x03, 0xD9, 0x0B, 0x98, 0x0B, 0xB8, 0x03, 
+0xD7, 0x03, 0xD9, 0xA5, 0x7E, 0xEF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xB9, 0xDE, 0x95, 0x23, 0xB9, 0x03, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 
+0xB8, 0x0B, 0xD8, 0x0B, 0x68, 0x01, 0xFB, 0xDE, 0xBE, 0xF7, 0x5D, 0xE7, 0x8F, 0x6B, 0x54, 0xAD, 0x7B, 0xF7, 0xFF, 0xFF, 0x35, 0xA5, 0x00, 0x00, 0x6E, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9C, 
+0xCF, 0x7B, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xA4, 0xAC, 0x7B, 0x78, 0xD6, 0xFF, 0xFF, 0xDF, 0xF7, 0x48, 0x4A, 0xF4, 0x02, 0x96, 0x0B, 0xB7, 0x0B, 
+0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x98, 0x0B, 0xD6, 0x03, 0xF7, 0x03, 
+0xB8, 0x0B, 0xB7, 0x0B, 0xD8, 0x03, 0x97, 0x03, 0xD5, 0x1B, 0xBC, 0xDE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x5D, 0xE7, 0xB6, 0x6C, 0x98, 0x03, 0x97, 0x0B, 
+0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0xB8, 0x0B, 0x96, 0x0B, 0xD8, 0x0B, 0x77, 0x03, 0xB8, 0x0B, 0x68, 0x09, 0x99, 0xCE, 0xFF, 0xFF, 0xDB, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x99, 0xCE, 0xDF, 0xFF, 0xDA, 0xE6, 0x00, 0x00, 
+0x4C, 0x73, 0xDF, 0xF7, 0xAB, 0x52, 0x21, 0x00, 0x00, 0x00, 0x50, 0x8C, 0xFF, 0xFF, 0xDE, 0xFF, 0x20, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0x5A, 0x20, 0x08, 0xE3, 0x18, 0xFF, 0xF7, 0xDF, 0xF7, 
+0x4C, 0x6B, 0xF3, 0x02, 0x96, 0x0B, 0xB8, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB8, 0x0B, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0x97, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0x98, 0x13, 0xB6, 0x0B, 0x19, 0x04, 0x76, 0x03, 0xD7, 0x6C, 0x3C, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xBF, 0xEF, 0x59, 0xBE, 0xB6, 0x23, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 0x77, 0x03, 0x48, 0x01, 0x1C, 0xE7, 0x9E, 0xEF, 0x3C, 0xD7, 0x00, 0x08, 0x8E, 0x73, 
+0xDF, 0xF7, 0xFF, 0xFF, 0xD5, 0xB5, 0x20, 0x00, 0x09, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x39, 0x5D, 0xEF, 0xDF, 0xFF, 0x51, 0x8C, 0x41, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xCB, 0x5A, 
+0xA2, 0x08, 0x96, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x5A, 0xF3, 0x02, 0x96, 0x0B, 0xB7, 0x0B, 0xB8, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB8, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xD8, 0x03, 0x98, 0x0B, 0x97, 0x13, 0xD7, 0x0B, 0xD7, 0x03, 0xB5, 0x23, 0x5B, 0xBE, 0x9D, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x5C, 0xEF, 0xD6, 0x6C, 0xB7, 0x0B, 0x76, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB6, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 0xB8, 0x0B, 0x47, 0x01, 0xDA, 0xD6, 
+0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xF7, 0x9E, 0xFF, 0x4A, 0x42, 0x06, 0x01, 0xB7, 0x13, 0x82, 0x08, 0x82, 0x08, 0x2C, 0x63, 0xBE, 0xF7, 0xFF, 0xFF, 0xB7, 0xB5, 0x62, 0x00, 
+0x62, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xB6, 0xC5, 0xA2, 0x10, 0x34, 0x03, 0x96, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x98, 0x0B, 0x77, 0x0B, 0x96, 0x03, 0xB7, 0x03, 0x96, 0x13, 0xD6, 0x6C, 
+0x3C, 0xEF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7A, 0xC6, 0x59, 0x24, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xD7, 0x0B, 0x97, 0x03, 
+0x97, 0x03, 0xB8, 0x0B, 0x47, 0x01, 0xDA, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xBB, 0xC6, 0xCA, 0x62, 0x00, 0x00, 0x2D, 0x0A, 0x42, 0x00, 0x24, 0x21, 0x75, 0xB5, 0xFF, 0xFF, 
+0x7D, 0xEF, 0x10, 0x7C, 0x62, 0x00, 0xC8, 0x29, 0x63, 0x00, 0xFF, 0xF7, 0xDE, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0x7C, 0xEF, 0x74, 0xBD, 0x25, 0x21, 0x68, 0x01, 0x54, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD7, 0x03, 0x58, 0x0B, 0xB7, 0x0B, 
+0xF7, 0x03, 0xB9, 0x03, 0xF7, 0x3B, 0x9B, 0xBE, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x7F, 0xEF, 0xFB, 0x95, 
+0x93, 0x2B, 0xB8, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0x97, 0x03, 0xB6, 0x13, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x96, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x0B, 0x98, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0x96, 0x0B, 0xB7, 0x0B, 0x47, 0x09, 0xDA, 0xD6, 0xDF, 0xF7, 0x5E, 0xE7, 0x69, 0x4A, 0x68, 0x52, 0x04, 0x11, 0x20, 0x00, 0x55, 0x0B, 0x70, 0x02, 
+0xC3, 0x10, 0xD6, 0xBD, 0xFF, 0xFF, 0x1D, 0xD7, 0xA5, 0x39, 0x00, 0x00, 0x50, 0x02, 0x97, 0x0B, 0x62, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0x91, 0x8C, 0xAC, 0x52, 0x27, 0x42, 0x62, 0x10, 0x07, 0x01, 
+0x97, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x13, 0x97, 0x13, 0xB7, 0x0B, 
+0xD8, 0x03, 0xB7, 0x0B, 0xB6, 0x0B, 0xF8, 0x0B, 0xB8, 0x03, 0xD6, 0x23, 0xBA, 0x95, 0x9E, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0xCF, 0x78, 0x7D, 0x76, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0x76, 0x03, 0xB6, 0x0B, 0xD7, 0x13, 0x76, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x0B, 
+0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x03, 0x97, 0x03, 0xB8, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0x06, 0x01, 0xFB, 0xDE, 0xFF, 0xFF, 0xBB, 0xCE, 0x48, 0x01, 0x95, 0x1B, 
+0x97, 0x03, 0x96, 0x13, 0xB9, 0x03, 0x91, 0x02, 0xEB, 0x5A, 0x7C, 0xF7, 0xFF, 0xF7, 0xC3, 0x10, 0x00, 0x08, 0x00, 0x08, 0x20, 0x08, 0x00, 0x00, 0x20, 0x08, 0xFF, 0xEF, 0xFE, 0xFF, 0xA9, 0x52, 
+0xF2, 0x12, 0x97, 0x03, 0xB8, 0x03, 0xD7, 0x13, 0xB6, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0x97, 0x0B, 
+0x77, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB7, 0x0B, 0x1A, 0x0C, 0x98, 0x03, 0x95, 0x13, 0x79, 0x85, 0x1D, 0xDF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFD, 0xD6, 0xF9, 0x5C, 0x75, 0x1B, 0x76, 0x03, 0xD8, 0x0B, 0x76, 0x03, 0x75, 0x0B, 0xD8, 0x13, 
+0xD8, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x03, 0x76, 0x0B, 0x75, 0x13, 0x96, 0x03, 0xB7, 0x0B, 0xB8, 0x0B, 0x27, 0x01, 0x1B, 0xDF, 
+0xBE, 0xF7, 0x1B, 0xE7, 0x08, 0x01, 0x98, 0x03, 0x99, 0x03, 0xB8, 0x03, 0x76, 0x03, 0x90, 0x02, 0x2F, 0x8C, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xE7, 0x6F, 0x5B, 
+0x00, 0x08, 0xFF, 0xFF, 0xBE, 0xFF, 0x89, 0x62, 0x55, 0x0B, 0xDB, 0x03, 0x99, 0x03, 0x97, 0x13, 0x56, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x0B, 0x78, 0x03, 0xB9, 0x03, 0xF9, 0x03, 0xD8, 0x03, 0x97, 0x03, 0x96, 0x13, 0xD8, 0x0B, 0x98, 0x03, 0xB7, 0x0B, 0xF7, 0x6C, 0xFB, 0xD6, 0xDF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xDD, 0xC6, 0xF7, 0x6C, 0x95, 0x1B, 
+0x77, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0x76, 0x03, 0x76, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0xB7, 0x0B, 0x77, 0x03, 0xB8, 0x03, 0xB9, 0x03, 
+0x98, 0x03, 0x98, 0x03, 0x8A, 0x01, 0xBB, 0xCE, 0xFF, 0xFF, 0xDA, 0xDE, 0x27, 0x01, 0x96, 0x13, 0xD7, 0x13, 0xB8, 0x03, 0x76, 0x0B, 0xB1, 0x02, 0xAE, 0x6B, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0x00, 0xDF, 0xF7, 0xFF, 0xF7, 0xEB, 0x5A, 0x34, 0x03, 0xB9, 0x03, 0xB6, 0x0B, 0xD8, 0x0B, 0xDA, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 
+0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x76, 0x0B, 0x96, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x57, 0x03, 0x77, 0x03, 0xD7, 0x0B, 0x98, 0x03, 0xB6, 0x1B, 0x18, 0x75, 
+0xFB, 0xCE, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xBE, 0xF7, 0x1D, 0xD7, 0x79, 0x7D, 0xD6, 0x2B, 0x77, 0x03, 0x98, 0x03, 0xB8, 0x03, 0xB7, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x0B, 0x76, 0x0B, 0x96, 0x0B, 0x97, 0x03, 0xB6, 0x13, 0x75, 0x0B, 0x88, 0x01, 0xB2, 0x94, 0xB9, 0xDE, 0x92, 0x8C, 0x48, 0x01, 0xB7, 0x0B, 0x55, 0x03, 0xD8, 0x0B, 0x74, 0x13, 0x4E, 0x0A, 
+0x45, 0x21, 0xEF, 0x73, 0xB0, 0xA4, 0x50, 0x8C, 0xD3, 0x8C, 0xD3, 0x94, 0xD3, 0x94, 0xEB, 0x5A, 0x00, 0x08, 0x18, 0xC6, 0xDB, 0xCE, 0xA5, 0x39, 0x74, 0x03, 0x98, 0x03, 0x95, 0x0B, 0xB7, 0x13, 
+0x76, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x98, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0x96, 0x0B, 0x97, 0x13, 0x97, 0x13, 0x77, 0x03, 
+0x77, 0x03, 0xF7, 0x2B, 0x99, 0x85, 0xFB, 0xDE, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0xE7, 0x1B, 0xA6, 0x77, 0x4C, 0x75, 0x13, 0x97, 0x0B, 0xB7, 0x0B, 0x76, 0x03, 0x76, 0x0B, 0x97, 0x0B, 
+0xB7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x98, 0x03, 0xB9, 0x03, 0xB9, 0x03, 0xB6, 0x1B, 0x54, 0x0B, 0x06, 0x01, 0x82, 0x08, 0x23, 0x29, 0x20, 0x08, 0x27, 0x01, 0x96, 0x13, 
+0x97, 0x03, 0x97, 0x03, 0xD7, 0x0B, 0x56, 0x03, 0xD3, 0x02, 0x36, 0x03, 0x12, 0x13, 0xF3, 0x0A, 0xB1, 0x02, 0xAF, 0x1A, 0xD3, 0x02, 0x34, 0x0B, 0x40, 0x00, 0x60, 0x18, 0x24, 0x21, 0x20, 0x08, 
+0x13, 0x13, 0x98, 0x13, 0x97, 0x03, 0xB9, 0x03, 0xB9, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xD7, 0x03, 0xB8, 0x03, 0x98, 0x03, 
+0xB9, 0x03, 0xB8, 0x03, 0x96, 0x03, 0xD7, 0x23, 0x78, 0x44, 0x1B, 0x9E, 0x5D, 0xDF, 0xFE, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xBE, 0xF7, 0x1D, 0xD7, 0x58, 0x85, 0xF5, 0x3B, 
+0x95, 0x1B, 0x96, 0x13, 0x96, 0x0B, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x75, 0x13, 0x97, 0x03, 0x77, 0x03, 0x76, 0x03, 0xFA, 0x03, 0xD8, 0x0B, 0x77, 0x03, 
+0x97, 0x03, 0x56, 0x0B, 0xB9, 0x03, 0xB9, 0x03, 0xD9, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0x56, 0x03, 0x98, 0x03, 0xB7, 0x13, 0x35, 0x03, 0x96, 0x0B, 0xB8, 0x0B, 0x77, 0x03, 0xB7, 0x0B, 0x56, 0x03, 
+0x97, 0x03, 0xB6, 0x0B, 0x76, 0x03, 0xB6, 0x0B, 0x98, 0x03, 0x96, 0x03, 0xB7, 0x0B, 0x96, 0x03, 0x76, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0xB6, 0x0B, 0x97, 0x0B, 0xB8, 0x0B, 0xB9, 0x0B, 0xB7, 0x13, 0x16, 0x34, 0x78, 0x85, 0xDD, 0xCE, 0xBF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xFF, 0xBF, 0xEF, 0x5F, 0xC7, 0x7A, 0x7D, 0x59, 0x2C, 0xF8, 0x1B, 0xB7, 0x13, 0x96, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x76, 0x03, 0x97, 0x03, 0xB8, 0x03, 
+0x95, 0x13, 0x98, 0x03, 0x97, 0x0B, 0x76, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x77, 0x03, 0x95, 0x13, 0x96, 0x0B, 0x95, 0x13, 0x77, 0x03, 0xB7, 0x0B, 0x76, 0x0B, 0x97, 0x03, 0x97, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0x97, 0x0B, 0x77, 0x03, 0x97, 0x03, 0x55, 0x03, 0x97, 0x03, 0x98, 0x03, 0x97, 0x03, 0x98, 0x13, 0x97, 0x0B, 0x99, 0x03, 0x55, 0x03, 0x96, 0x13, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xD7, 0x13, 0xF6, 0x1B, 0x35, 0x3C, 0x79, 0x85, 0xFD, 0xCE, 0xBF, 0xF7, 0xDE, 0xF7, 0xDE, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x5E, 0xE7, 0x9C, 0xC6, 0x99, 0x8D, 0xB7, 0x5C, 0x37, 0x3C, 0x17, 0x34, 0x17, 0x2C, 
+0xF6, 0x2B, 0x23, 0x80, 0x17, 0x2C, 0x2F, 0x00, 0x16, 0x2C, 0x17, 0x2C, 0x37, 0x34, 0x57, 0x34, 0x96, 0x64, 0x78, 0x8D, 0x9C, 0xBE, 0x7E, 0xE7, 0xBE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xF7, 0x9D, 0xE7, 0x5D, 0xDF, 
+0x3E, 0xDF, 0x3D, 0xDF, 0x1D, 0xDF, 0xFC, 0xDE, 0x1F, 0x80, 0x1D, 0xDF, 0x0D, 0x00, 0xFC, 0xDE, 0xFC, 0xDE, 0x1D, 0xDF, 0xFC, 0xDE, 0xFC, 0xD6, 0xFC, 0xDE, 0x1D, 0xDF, 0x3D, 0xDF, 0x7F, 0xD7, 
+0xBF, 0xE7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0x24, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0xDE, 0xFF, 0x1F, 0x80, 0xFF, 0xFF, 0x05, 0x00, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xDE, 0xFF, 0xFE, 0xFF, 0x2C, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xF7, 0x27, 0x80, 0xFF, 0xFF, 0x13, 0x00, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+};
@@ -0,0 +1,61 @@
+/* 30x30 RGB565 raw picture converted from Success_jpg.h by pict2rgb565, 1816 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char Success[] = {
+0x52, 0x35, 0x36, 0x35, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFD, 0xF7, 0xB7, 0xE7, 0x30, 0xCF, 0x8A, 0xAE, 0x26, 0x9E, 0x04, 0x96, 0x24, 0x96, 0x65, 0xA6, 0x8A, 0xAE, 0xF1, 0xC6, 0x78, 0xE7, 0xFC, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xF8, 0xF7, 0x4F, 0xCF, 0x6A, 0xB6, 
+0xC6, 0x9D, 0xE4, 0x95, 0x24, 0x9E, 0x04, 0x9E, 0x04, 0x96, 0x05, 0x96, 0xE3, 0x8D, 0x04, 0x96, 0x04, 0x9E, 0x05, 0x9E, 0x48, 0xAE, 0xF1, 0xCE, 0xBB, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xD7, 0x49, 0xAE, 0xE4, 0x95, 0xE3, 0x95, 0x03, 0x96, 0x03, 0x96, 
+0x03, 0x9E, 0x03, 0x96, 0x03, 0x96, 0x04, 0x96, 0x42, 0x96, 0x02, 0x8E, 0x02, 0x8E, 0x23, 0x96, 0x03, 0x96, 0xE5, 0x95, 0x6A, 0xAE, 0x50, 0xCF, 0xFC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0x6F, 0xB6, 0x26, 0x9E, 0x04, 0x96, 0xE4, 0x95, 0x05, 0x9E, 0x25, 0x9E, 0x04, 0x96, 0x04, 0x96, 0x24, 0x96, 
+0x03, 0x96, 0x03, 0x96, 0x04, 0x96, 0x25, 0x96, 0x25, 0x9E, 0x24, 0x96, 0x02, 0x96, 0x02, 0x96, 0x02, 0x96, 0x23, 0x96, 0xEE, 0xC6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x2C, 0xB6, 0x04, 0x9E, 0x03, 0x96, 0x23, 0x96, 0x43, 0x9E, 0x02, 0x96, 0xE2, 0x8D, 0x03, 0x96, 0x24, 0x96, 0x03, 0x96, 0x03, 0x96, 0x24, 0x96, 
+0xE4, 0x95, 0x04, 0x96, 0x04, 0x96, 0xE3, 0x95, 0x03, 0x96, 0x24, 0x96, 0x24, 0x96, 0x05, 0x96, 0xE5, 0x9D, 0xAD, 0xBE, 0xFE, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x4F, 0xB6, 0xE4, 0x9D, 0x62, 0x9E, 0x23, 0x96, 0x24, 0x96, 0x02, 0x96, 0x03, 0x96, 0x24, 0x96, 0x24, 0x9E, 0x24, 0x96, 0x04, 0x96, 0x04, 0x96, 0x24, 0x96, 0x22, 0x9E, 0x02, 0x96, 
+0x03, 0x96, 0x25, 0x9E, 0x25, 0x9E, 0xE4, 0x95, 0xE4, 0x95, 0x04, 0x96, 0x04, 0x96, 0xE2, 0x95, 0xCF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x54, 0xD7, 0x26, 0x9E, 
+0x23, 0x96, 0x23, 0x96, 0xE2, 0x8D, 0x26, 0x9E, 0x05, 0x9E, 0x25, 0x9E, 0x05, 0x96, 0xC4, 0x8D, 0xE4, 0x95, 0x24, 0x96, 0x24, 0x96, 0xE3, 0x95, 0xE4, 0x95, 0x24, 0x96, 0x23, 0x96, 0xE3, 0x95, 
+0xE2, 0x8D, 0x24, 0x96, 0x24, 0x9E, 0x03, 0x96, 0x45, 0x9E, 0x02, 0x96, 0xC2, 0x95, 0x75, 0xDF, 0xDE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xF8, 0xF7, 0x49, 0xAE, 0x04, 0x96, 0x44, 0x96, 0x24, 0x96, 
+0x05, 0x96, 0x05, 0x9E, 0x03, 0x96, 0x03, 0x96, 0x03, 0x96, 0x23, 0x9E, 0x24, 0x9E, 0x03, 0x96, 0x03, 0x96, 0x24, 0x96, 0x25, 0x96, 0x03, 0x96, 0x03, 0x96, 0x45, 0x9E, 0x45, 0x9E, 0x04, 0x96, 
+0x03, 0x96, 0x23, 0x96, 0x04, 0x8E, 0x23, 0x96, 0x24, 0x9E, 0x08, 0xA6, 0xBA, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0xCF, 0x05, 0x96, 0x24, 0x9E, 0x02, 0x96, 0x03, 0x96, 0x23, 0x96, 0x04, 0x96, 
+0x23, 0x96, 0x23, 0x96, 0x04, 0x96, 0x24, 0x9E, 0x24, 0x96, 0x04, 0x96, 0x25, 0x9E, 0x05, 0x96, 0x03, 0x96, 0x25, 0x9E, 0x04, 0x9E, 0x48, 0xA6, 0x76, 0xDF, 0xF1, 0xC6, 0xC4, 0x95, 0x22, 0x9E, 
+0x24, 0x9E, 0x03, 0x96, 0x26, 0x9E, 0x04, 0x96, 0x0D, 0xC7, 0xFF, 0xFF, 0xDD, 0xF7, 0x28, 0xA6, 0xE4, 0x95, 0x04, 0x96, 0x22, 0x9E, 0x24, 0x9E, 0xE4, 0x95, 0x03, 0x96, 0x05, 0x96, 0xE3, 0x95, 
+0x44, 0x9E, 0x24, 0x96, 0x03, 0x96, 0x04, 0x96, 0x04, 0x96, 0x23, 0x96, 0x04, 0x96, 0x03, 0x96, 0x48, 0xAE, 0x78, 0xE7, 0xFD, 0xFF, 0xFE, 0xF7, 0xB0, 0xBE, 0x05, 0x9E, 0x04, 0x96, 0x23, 0x96, 
+0x05, 0x96, 0x04, 0x96, 0x8A, 0xAE, 0xDC, 0xEF, 0xB8, 0xE7, 0xE3, 0x95, 0x24, 0x96, 0x26, 0x96, 0x02, 0x96, 0x04, 0x96, 0xE4, 0x95, 0x23, 0x96, 0x03, 0x96, 0x45, 0x9E, 0xE3, 0x95, 0x04, 0x96, 
+0x45, 0x9E, 0x03, 0x96, 0x23, 0x96, 0x23, 0x96, 0x44, 0x9E, 0x47, 0xA6, 0x78, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xBE, 0xE4, 0x95, 0x24, 0x9E, 0x04, 0x96, 0x03, 0x96, 
+0xE6, 0x9D, 0x77, 0xDF, 0xF0, 0xC6, 0x02, 0x96, 0x23, 0x96, 0x25, 0x96, 0x03, 0x96, 0x04, 0x96, 0x44, 0x9E, 0x03, 0x96, 0x25, 0x9E, 0xE3, 0x95, 0x46, 0x9E, 0x05, 0x96, 0xE2, 0x8D, 0x24, 0x96, 
+0xE4, 0x95, 0x03, 0x96, 0x47, 0xA6, 0x97, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDB, 0xEF, 0x31, 0xCF, 0x04, 0x96, 0x24, 0x9E, 0x23, 0x96, 0x23, 0x96, 0xC3, 0x95, 0x31, 0xCF, 
+0x6A, 0xA6, 0x03, 0x96, 0x02, 0x96, 0x23, 0x96, 0x04, 0x96, 0x44, 0x9E, 0xE1, 0x95, 0xC5, 0x95, 0xCF, 0xBE, 0x32, 0xCF, 0x47, 0xA6, 0x01, 0x96, 0x45, 0x9E, 0x03, 0x96, 0x23, 0x9E, 0x4A, 0xA6, 
+0x96, 0xDF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 0x30, 0xCF, 0xE5, 0x9D, 0x05, 0x96, 0xE4, 0x95, 0x23, 0x9E, 0x23, 0x96, 0x03, 0x96, 0xAC, 0xB6, 0x67, 0xA6, 0x03, 0x96, 
+0x24, 0x9E, 0x23, 0x96, 0x03, 0x96, 0x44, 0x9E, 0xC3, 0x95, 0xAF, 0xC6, 0xFB, 0xF7, 0xFF, 0xFF, 0x75, 0xDF, 0x26, 0xA6, 0x03, 0x9E, 0x22, 0x9E, 0x46, 0xA6, 0x98, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xCF, 0xC6, 0x26, 0x9E, 0x02, 0x96, 0x24, 0x9E, 0xE3, 0x95, 0x23, 0x9E, 0x04, 0x96, 0x23, 0x9E, 0x47, 0xA6, 0x24, 0x96, 0xE2, 0x95, 0x04, 0x9E, 0x04, 0x96, 
+0x03, 0x96, 0x25, 0x9E, 0xAB, 0xB6, 0xFC, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0xDF, 0xE6, 0x9D, 0x07, 0xA6, 0x98, 0xE7, 0xFE, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xAD, 0xBE, 0x25, 0x9E, 0x02, 0x96, 0x25, 0x9E, 0x24, 0x96, 0xE4, 0x95, 0x23, 0x96, 0xE5, 0x95, 0x24, 0x96, 0x05, 0x96, 0x24, 0x96, 0x22, 0x96, 0xE5, 0x9D, 0x05, 0x9E, 0x43, 0x9E, 0xE5, 0x95, 
+0xF1, 0xC6, 0xDF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xBB, 0xEF, 0xDC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xCF, 0xBE, 0x04, 0x96, 0x22, 0x96, 
+0x24, 0x96, 0x04, 0x96, 0x24, 0x96, 0x04, 0x96, 0x23, 0x96, 0xE5, 0x95, 0x24, 0x96, 0x24, 0x96, 0x47, 0x9E, 0x23, 0x96, 0x05, 0x96, 0x23, 0x96, 0x03, 0x96, 0x24, 0x9E, 0x23, 0x9E, 0x11, 0xC7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF7, 0xF1, 0xC6, 0x04, 0x9E, 0x22, 0x96, 0x24, 0x9E, 0xE5, 0x95, 0x03, 0x96, 
+0x03, 0x96, 0x24, 0x96, 0x24, 0x96, 0x05, 0x96, 0x02, 0x96, 0x47, 0xA6, 0x89, 0xAE, 0x25, 0x9E, 0x03, 0x96, 0x44, 0x9E, 0x25, 0x9E, 0xE3, 0x95, 0x04, 0x96, 0x08, 0x9E, 0x13, 0xCF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFC, 0xF7, 0xF0, 0xC6, 0x06, 0x9E, 0xE3, 0x95, 0x24, 0x96, 0x03, 0x96, 0x03, 0x96, 0x24, 0x9E, 0x04, 0x9E, 0x04, 0x96, 
+0x04, 0x96, 0x04, 0x96, 0x23, 0x9E, 0xAC, 0xB6, 0x0F, 0xC7, 0x06, 0x9E, 0x03, 0x96, 0x24, 0x96, 0x25, 0x9E, 0xE4, 0x95, 0x24, 0x96, 0xE1, 0x95, 0x05, 0x9E, 0x72, 0xD7, 0xDE, 0xF7, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD0, 0xC6, 0x06, 0xA6, 0xE1, 0x95, 0x23, 0x96, 0x04, 0x96, 0x03, 0x96, 0x23, 0x9E, 0x04, 0x96, 0x04, 0x9E, 0x03, 0x96, 0x05, 0x96, 0x23, 0x96, 
+0x23, 0x9E, 0x12, 0xCF, 0x97, 0xE7, 0xE5, 0x9D, 0x23, 0x9E, 0x03, 0x96, 0xE3, 0x95, 0x26, 0x9E, 0x03, 0x96, 0x42, 0x9E, 0x22, 0x96, 0x03, 0x96, 0xF2, 0xCE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFD, 0xF7, 0xEF, 0xC6, 0x04, 0x96, 0xE3, 0x95, 0x24, 0x9E, 0x43, 0x9E, 0x02, 0x96, 0x03, 0x96, 0x44, 0x9E, 0xE3, 0x95, 0xE4, 0x95, 0x23, 0x96, 0x04, 0x96, 0x43, 0x9E, 0xE4, 0x9D, 0x78, 0xDF, 
+0xFD, 0xF7, 0x28, 0xA6, 0x02, 0x96, 0x23, 0x9E, 0x03, 0x96, 0x45, 0x9E, 0xC2, 0x8D, 0x04, 0x9E, 0x05, 0x96, 0x23, 0x96, 0x23, 0x9E, 0xF0, 0xC6, 0xFF, 0xFF, 0xFE, 0xF7, 0xAE, 0xBE, 0x23, 0x9E, 
+0x22, 0x96, 0x04, 0x96, 0x04, 0x96, 0x23, 0x96, 0x23, 0x96, 0x04, 0x96, 0x05, 0x96, 0x23, 0x9E, 0x04, 0x96, 0x23, 0x96, 0x24, 0x96, 0x23, 0x96, 0x69, 0xAE, 0xBC, 0xEF, 0xFF, 0xFF, 0xD2, 0xCE, 
+0xE2, 0x95, 0x24, 0x9E, 0x04, 0x96, 0x22, 0x96, 0xE5, 0x95, 0xE4, 0x95, 0x26, 0x96, 0x05, 0x96, 0x00, 0x96, 0x25, 0xA6, 0xD2, 0xC6, 0xF0, 0xC6, 0x45, 0x9E, 0xE3, 0x95, 0x24, 0x96, 0x24, 0x96, 
+0x03, 0x96, 0x03, 0x96, 0x25, 0x9E, 0x05, 0x96, 0xE4, 0x95, 0x23, 0x9E, 0x24, 0x9E, 0x02, 0x96, 0x03, 0x96, 0xE5, 0x95, 0x11, 0xCF, 0xDE, 0xF7, 0xFF, 0xFF, 0xBC, 0xEF, 0x6A, 0xB6, 0x04, 0x96, 
+0x24, 0x96, 0x22, 0x96, 0x26, 0x9E, 0x03, 0x96, 0x04, 0x96, 0x24, 0x96, 0x24, 0x9E, 0xC3, 0x8D, 0x04, 0x96, 0x24, 0x9E, 0x04, 0x96, 0x46, 0x9E, 0xC4, 0x8D, 0x24, 0x9E, 0x43, 0x9E, 0x04, 0x96, 
+0x05, 0x96, 0x04, 0x96, 0x03, 0x96, 0x03, 0x96, 0x24, 0x9E, 0x03, 0x96, 0x03, 0x96, 0x6B, 0xAE, 0xD9, 0xEF, 0xDF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0x54, 0xD7, 0xE4, 0x95, 0x23, 0x96, 0x24, 0x96, 
+0x04, 0x96, 0x02, 0x96, 0x43, 0x9E, 0xE2, 0x95, 0x26, 0x9E, 0x45, 0x9E, 0x02, 0x96, 0x24, 0x96, 0x05, 0x96, 0x22, 0x96, 0x23, 0x96, 0x04, 0x96, 0x04, 0x96, 0x04, 0x96, 0x23, 0x96, 0x23, 0x9E, 
+0x24, 0x96, 0x04, 0x96, 0x04, 0x96, 0x24, 0x9E, 0x23, 0x96, 0x52, 0xCF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFC, 0xF7, 0xCE, 0xC6, 0x05, 0x9E, 0x04, 0x96, 0x25, 0x96, 0x24, 0x96, 
+0x24, 0x9E, 0x24, 0x96, 0x04, 0x96, 0x04, 0x96, 0x04, 0x96, 0x04, 0x96, 0x04, 0x96, 0x24, 0x96, 0xE3, 0x95, 0x24, 0x9E, 0x04, 0x9E, 0xE4, 0x95, 0xE4, 0x95, 0x04, 0x96, 0x04, 0x9E, 0x04, 0x9E, 
+0x04, 0x96, 0x03, 0x96, 0xEF, 0xC6, 0xFE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFD, 0xF7, 0xCD, 0xBE, 0xE2, 0x95, 0x02, 0x96, 0x44, 0x9E, 0x03, 0x96, 0x03, 0x96, 
+0x03, 0x96, 0x03, 0x96, 0x24, 0x9E, 0x04, 0x96, 0x04, 0x96, 0x04, 0x96, 0x24, 0x9E, 0x04, 0x96, 0x03, 0x96, 0x23, 0x96, 0x64, 0x9E, 0x43, 0x9E, 0x03, 0x96, 0x04, 0x96, 0xE2, 0x95, 0xF0, 0xC6, 
+0xFD, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xEF, 0xC6, 0x03, 0x9E, 0xE3, 0x95, 0x25, 0x9E, 0x25, 0x9E, 0x24, 0x96, 0x24, 0x96, 
+0x03, 0x96, 0x02, 0x96, 0x02, 0x96, 0x23, 0x9E, 0x23, 0x96, 0x04, 0x96, 0x04, 0x96, 0x25, 0x96, 0x24, 0x96, 0xE2, 0x8D, 0x02, 0x96, 0x64, 0x9E, 0xEF, 0xC6, 0xDD, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x54, 0xD7, 0x28, 0xAE, 0xE4, 0x95, 0xE3, 0x95, 0x03, 0x96, 0x24, 0x9E, 0x44, 0x9E, 0x24, 0x9E, 
+0x04, 0x96, 0x05, 0x96, 0xE5, 0x95, 0x04, 0x96, 0x23, 0x96, 0x22, 0x96, 0x03, 0x96, 0xE5, 0x95, 0x6B, 0xAE, 0x11, 0xC7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xEF, 0x4D, 0xC7, 0x8A, 0xB6, 0xE6, 0x9D, 0xC4, 0x95, 0x04, 0x96, 0x23, 0x96, 0x23, 0x96, 0x23, 0x96, 
+0x22, 0x96, 0x02, 0x96, 0xE2, 0x95, 0xE4, 0x95, 0x69, 0xAE, 0x11, 0xCF, 0xB9, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBC, 0xEF, 0x57, 0xDF, 0x12, 0xCF, 0xCD, 0xBE, 0x68, 0xA6, 0x25, 0x96, 0x04, 0x96, 0x47, 0xA6, 0xAC, 0xBE, 
+0x12, 0xCF, 0x77, 0xDF, 0xDC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xDF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+};
@@ -0,0 +1,436 @@
+/* 84x84 RGB565 RLE picture converted from aat_84x84_jpg.h by pict2rgb565, 13804 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char aat_84x84[] = {
+0x52, 0x35, 0x36, 0x35, 0x01, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0xEE, 0x1A, 0x00, 0x00, 0x57, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 
+0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xF7, 
+0xBE, 0xEF, 0x9D, 0xEF, 0x9D, 0xE7, 0x9C, 0xDF, 0x9C, 0xDF, 0x7B, 0xDF, 0x7C, 0xEF, 0x7C, 0xF7, 0x3C, 0xEF, 0x3C, 0xE7, 0x5C, 0xDF, 0x7D, 0xE7, 0x9D, 0xE7, 0x7E, 0xE7, 0x5D, 0xE7, 0x3B, 0xE7, 
+0x5B, 0xE7, 0x7C, 0xEF, 0x7D, 0xEF, 0x7E, 0xEF, 0x3E, 0xE7, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x9B, 0xEF, 0x7B, 0xE7, 0x7C, 0xE7, 
+0x5D, 0xEF, 0x5E, 0xF7, 0x5D, 0xEF, 0x5C, 0xE7, 0x7C, 0xDF, 0xBD, 0xE7, 0x9C, 0xDF, 0x7C, 0xDF, 0x5C, 0xE7, 0x5C, 0xE7, 0x5D, 0xE7, 0x7D, 0xEF, 0x9D, 0xE7, 0x5D, 0xF7, 0xBD, 0xF7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xF7, 
+0xDE, 0xF7, 0xBD, 0xEF, 0x5C, 0xDF, 0xBB, 0xCE, 0x5A, 0xC6, 0x19, 0xBE, 0xB8, 0xB5, 0x77, 0xB5, 0x56, 0xB5, 0x96, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0xB6, 0xA5, 0xD7, 0xA5, 0xB7, 0xA5, 
+0x77, 0xAD, 0x96, 0xAD, 0xB7, 0xAD, 0xB7, 0xAD, 0xB7, 0xAD, 0x97, 0xA5, 0x77, 0xA5, 0x77, 0xA5, 0x97, 0xAD, 0xB7, 0xA5, 0xB7, 0xA5, 0x96, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x77, 0xAD, 
+0x97, 0xAD, 0x96, 0xAD, 0x96, 0xA5, 0x96, 0xA5, 0x97, 0xAD, 0x97, 0xAD, 0xB7, 0xAD, 0xB7, 0xAD, 0xD7, 0xA5, 0xB7, 0xA5, 0x97, 0xAD, 0xB7, 0xAD, 0xB8, 0xAD, 0xB8, 0xAD, 0xB8, 0xAD, 0xB9, 0xB5, 
+0xFA, 0xC5, 0x79, 0xCE, 0xDB, 0xDE, 0x3C, 0xE7, 0x5D, 0xEF, 0x7E, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0x1A, 0xDF, 0x59, 0xBE, 0x76, 0x9D, 0x75, 0x64, 0xF4, 0x43, 0xD6, 0x2B, 0xD7, 0x1B, 0xD8, 0x1B, 0xF8, 0x1B, 0x98, 0x23, 0xB8, 0x1B, 0xD7, 0x13, 
+0xD7, 0x13, 0xB7, 0x13, 0xB7, 0x1B, 0xB7, 0x23, 0xD8, 0x23, 0xB7, 0x23, 0xB6, 0x23, 0xB6, 0x1B, 0xF7, 0x1B, 0x17, 0x1C, 0x17, 0x1C, 0x18, 0x1C, 0x18, 0x24, 0x18, 0x14, 0x18, 0x1C, 0x18, 0x1C, 
+0x18, 0x24, 0x39, 0x24, 0x5A, 0x24, 0x5A, 0x1C, 0x5A, 0x14, 0x5B, 0x1C, 0x5B, 0x1C, 0x5B, 0x24, 0x7B, 0x24, 0x7A, 0x1C, 0x59, 0x14, 0x7A, 0x1C, 0x9A, 0x1C, 0x7A, 0x24, 0x7B, 0x24, 0xBB, 0x24, 
+0xDB, 0x1C, 0xDA, 0x14, 0xBA, 0x14, 0xBB, 0x1C, 0x9C, 0x2C, 0x79, 0x34, 0xF9, 0x64, 0xB8, 0x9D, 0x59, 0xBE, 0xFB, 0xCE, 0x7E, 0xDF, 0x9E, 0xEF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xF7, 0x5C, 0xE7, 0xFB, 0xCE, 0xB8, 0x9D, 0x55, 0x6C, 0xF8, 0x23, 0xD7, 0x1B, 0xF8, 0x0B, 0x7A, 0x0C, 0xDC, 0x0C, 0xDB, 0x04, 0xDA, 0x04, 
+0xDA, 0x04, 0xDC, 0x0C, 0xDB, 0x04, 0xDC, 0x0C, 0x1C, 0x15, 0xFC, 0x1C, 0xBC, 0x14, 0xBB, 0x0C, 0xDB, 0x04, 0xDC, 0x0C, 0xDC, 0x0C, 0x1D, 0x1D, 0x9E, 0x3D, 0x1E, 0x66, 0x9D, 0x8E, 0x1D, 0xB7, 
+0x7D, 0xCF, 0x9F, 0xEF, 0x9F, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xDF, 0x9E, 0xCF, 0x3D, 0xBF, 0xFC, 0xAE, 0x5F, 0x7E, 0x1E, 0x4E, 0xDE, 0x25, 0xBF, 0x0D, 0xBF, 0x15, 0x9F, 0x1D, 0xBF, 0x15, 
+0xDF, 0x05, 0xFF, 0x0D, 0xDF, 0x15, 0xBF, 0x0D, 0xBF, 0x0D, 0xDE, 0x05, 0xFE, 0x0D, 0xDE, 0x0D, 0x7E, 0x0D, 0x5D, 0x15, 0xFE, 0x04, 0x9D, 0x0C, 0x9B, 0x34, 0xF7, 0x6C, 0xD7, 0xAD, 0xBA, 0xD6, 
+0x7D, 0xEF, 0xBE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0x7C, 0xF7, 0x1C, 0xE7, 0xF9, 0xAD, 0x96, 0x5C, 0xD6, 0x23, 0xF8, 0x13, 0x79, 0x14, 0x7A, 0x0C, 0xBB, 0x0C, 
+0xDC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x3D, 0x15, 0x1B, 0x05, 0xFB, 0x04, 0x1C, 0x05, 0x3C, 0x05, 0x1C, 0x05, 0x1B, 0x05, 0x3C, 0x15, 0x7D, 0x2D, 0x1C, 0x56, 0xBE, 0x7E, 0x7F, 0xC7, 
+0xDF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBF, 0xDF, 
+0x3F, 0x9F, 0xBE, 0x56, 0x3E, 0x26, 0xFF, 0x15, 0xDF, 0x15, 0xFE, 0x05, 0x1F, 0x06, 0x1F, 0x0E, 0xFF, 0x15, 0xFF, 0x15, 0xFF, 0x15, 0x1F, 0x16, 0xFF, 0x05, 0xDF, 0x05, 0xDF, 0x0D, 0xBF, 0x15, 
+0x3F, 0x15, 0x9E, 0x0C, 0x5A, 0x24, 0x18, 0x6D, 0xF7, 0xA5, 0x1B, 0xDF, 0x7D, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x9D, 0xEF, 0xBA, 0xC6, 0xF6, 0x7C, 0xF5, 0x3B, 0xF8, 0x1B, 0x9B, 0x0C, 
+0xDC, 0x04, 0xDD, 0x0C, 0xFD, 0x0C, 0x1D, 0x0D, 0x1D, 0x0D, 0xFD, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 0x1C, 0x15, 0x3D, 0x15, 0x3D, 0x15, 0x1B, 0x0D, 0x1B, 0x15, 0x9B, 0x45, 0x7E, 0x86, 
+0x1F, 0xB7, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xF7, 0x5F, 0xE7, 0xBE, 0xCF, 0xBE, 0xCF, 0x9F, 0xCF, 0x7F, 0xCF, 0x5F, 0xD7, 0x7F, 0xDF, 0xBF, 0xEF, 
+0xDF, 0xF7, 0xBF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xBF, 0xD7, 0x3F, 0x87, 0xDE, 0x3E, 0x1E, 0x26, 0x1F, 0x16, 0x1F, 0x06, 0x1F, 0x06, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 
+0x3F, 0x06, 0xDF, 0x15, 0xBF, 0x15, 0xBD, 0x15, 0xDE, 0x0D, 0xBF, 0x05, 0x3F, 0x0D, 0xBD, 0x1C, 0x5A, 0x2C, 0xB9, 0x8D, 0x5B, 0xB6, 0x3D, 0xE7, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x5B, 0xF7, 0xF9, 0xB5, 0x97, 0x64, 
+0xF7, 0x2B, 0x59, 0x14, 0xBB, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1B, 0x0D, 0x1B, 0x0D, 0x1B, 0x0D, 0xFB, 0x0C, 0x1B, 0x0D, 0x3C, 0x15, 0x1C, 0x0D, 0x1C, 0x0D, 0x1D, 0x0D, 0xFD, 0x04, 0xFC, 0x0C, 
+0x7D, 0x3D, 0x9F, 0x86, 0xBF, 0xD7, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7E, 0xCF, 0xFE, 0xAE, 0xDE, 0x96, 0x9E, 0x7E, 0x7E, 0x76, 0x5E, 0x86, 0x7E, 0x86, 0x9F, 0x7E, 
+0x7F, 0x76, 0x7F, 0x76, 0x7E, 0x6E, 0xBE, 0x76, 0xFE, 0x7E, 0x3F, 0x9F, 0x9F, 0xBF, 0xDF, 0xDF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0x3F, 0x97, 0x7F, 0x56, 0xFE, 0x15, 
+0x1F, 0x06, 0x5F, 0x0E, 0x1E, 0x16, 0xFE, 0x15, 0xFF, 0x0D, 0x1E, 0x0E, 0xFF, 0x0D, 0xFF, 0x15, 0xDF, 0x15, 0xBF, 0x0D, 0x9F, 0x0D, 0x5E, 0x15, 0xFE, 0x14, 0x17, 0x24, 0x19, 0x6D, 0x3A, 0xBE, 
+0x3C, 0xEF, 0xBD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 
+0x5B, 0xEF, 0x19, 0xAE, 0x75, 0x54, 0xF7, 0x13, 0x7B, 0x04, 0xBC, 0x04, 0xDC, 0x0C, 0x1C, 0x15, 0xFB, 0x0C, 0xFD, 0x04, 0x1C, 0x15, 0xDA, 0x0C, 0x1C, 0x0D, 0x1D, 0x0D, 0xDB, 0x04, 0x3C, 0x0D, 
+0x1C, 0x0D, 0x1C, 0x0D, 0x5A, 0x15, 0x3C, 0x66, 0x3F, 0xD7, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBF, 0xFF, 0x7E, 0xC7, 0xFD, 0xA6, 0x5D, 0x8E, 0x3E, 0x76, 0x3F, 0x66, 0x3F, 0x66, 0x3E, 0x66, 
+0x5E, 0x66, 0x5D, 0x5E, 0x5E, 0x66, 0x7E, 0x66, 0x5F, 0x5E, 0x5F, 0x5E, 0x5F, 0x66, 0x7F, 0x66, 0x7F, 0x6E, 0xBE, 0x6E, 0x7F, 0x5E, 0xDF, 0x76, 0xFF, 0x8E, 0x7F, 0xBF, 0xFF, 0xEF, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xEF, 0xBE, 0xDF, 0xFE, 0x7E, 0x5F, 0x26, 0x3F, 0x16, 0x3F, 0x06, 0x1F, 0x0E, 0xDF, 0x25, 0xFF, 0x0D, 0xFF, 0x05, 0xDF, 0x0D, 0x9F, 0x0D, 0xDF, 0x0D, 0x1F, 0x06, 0x7D, 0x05, 
+0x5E, 0x1D, 0x1E, 0x0D, 0x9B, 0x14, 0xB9, 0x4C, 0xFB, 0xAD, 0x3C, 0xEF, 0xBD, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0x7D, 0xEF, 0x19, 0xB6, 0x76, 0x54, 0xF6, 0x23, 0x59, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x04, 0xFB, 0x14, 0x3C, 0x05, 0x1C, 0x0D, 
+0xBB, 0x0C, 0xFB, 0x04, 0x3C, 0x0D, 0xBC, 0x0C, 0xDC, 0x04, 0x5B, 0x35, 0x9F, 0x9E, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xF7, 0x5F, 0xCF, 0xDD, 0x96, 0x3F, 0x6E, 0x3F, 0x66, 0x1D, 0x66, 
+0x3C, 0x66, 0x1C, 0x66, 0xFC, 0x65, 0x1D, 0x66, 0x3E, 0x6E, 0x3E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x9E, 0x66, 0x9E, 0x66, 0x9E, 0x5E, 0x7F, 0x5E, 0x7E, 0x5E, 0xDF, 0x6E, 
+0x9F, 0x66, 0x9F, 0x66, 0xFF, 0x86, 0x5F, 0xB7, 0xFF, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xB7, 0x3F, 0x4E, 0x3F, 0x16, 0x5F, 0x06, 0xFF, 0x05, 0xBF, 0x15, 0x3F, 0x06, 0x1F, 0x06, 
+0xBF, 0x15, 0x7E, 0x0D, 0xBF, 0x0D, 0xDF, 0x15, 0x7E, 0x0D, 0x5D, 0x15, 0x1E, 0x15, 0x7A, 0x24, 0xD7, 0x5C, 0x59, 0xBE, 0x7D, 0xEF, 0xBF, 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xF7, 0x99, 0xBE, 0xB7, 0x64, 0xF8, 0x13, 0x39, 0x0C, 0xDB, 0x04, 0x1C, 0x0D, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 
+0xFD, 0x04, 0xFA, 0x14, 0xFC, 0x0C, 0x1D, 0x0D, 0xDB, 0x04, 0x1C, 0x0D, 0xFC, 0x04, 0xDB, 0x14, 0xDE, 0x5D, 0x3F, 0xC7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0x9F, 0xDF, 0xDE, 0x9E, 0x3D, 0x76, 
+0x1C, 0x66, 0xDD, 0x65, 0xFD, 0x65, 0x1D, 0x5E, 0x3D, 0x5E, 0x7E, 0x5E, 0x7E, 0x66, 0x5E, 0x5E, 0x3F, 0x5E, 0x1F, 0x66, 0x3F, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x5E, 0x66, 0x7F, 0x66, 0x7F, 0x5E, 
+0x7F, 0x5E, 0x9F, 0x5E, 0x9F, 0x5E, 0x9E, 0x5E, 0x9E, 0x5E, 0xBF, 0x66, 0xDF, 0x66, 0xDF, 0x6E, 0xDF, 0x76, 0x7F, 0xC7, 0xBF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xBF, 0xE7, 0x9F, 0x56, 0xFF, 0x0D, 
+0x1F, 0x0E, 0xDF, 0x0D, 0x1F, 0x0E, 0xDF, 0x05, 0xDF, 0x0D, 0x9F, 0x1D, 0x7E, 0x15, 0xDF, 0x15, 0x7F, 0x0D, 0x7D, 0x15, 0x9F, 0x15, 0xDD, 0x04, 0x58, 0x14, 0x17, 0x65, 0x7B, 0xC6, 0x7D, 0xEF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7E, 0xF7, 0x3C, 0xE7, 0x16, 0x75, 0x17, 0x24, 0x9B, 0x04, 0xDD, 0x0C, 0x1D, 0x0D, 
+0xFC, 0x04, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0x1C, 0x05, 0x1B, 0x05, 0xDC, 0x14, 0xFC, 0x0C, 0x3C, 0x0D, 0xFC, 0x04, 0xFC, 0x14, 0x3D, 0x66, 0x7F, 0xD7, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xE7, 
+0xFD, 0xAE, 0x7D, 0x86, 0x1D, 0x66, 0xFD, 0x5D, 0x1D, 0x66, 0x3D, 0x6E, 0x1D, 0x66, 0xFD, 0x5D, 0xFD, 0x5D, 0x1D, 0x5E, 0x3E, 0x5E, 0x3D, 0x5E, 0x1D, 0x5E, 0x1E, 0x66, 0x3E, 0x66, 0x7E, 0x66, 
+0x7D, 0x66, 0x9E, 0x66, 0x9F, 0x66, 0x7F, 0x6E, 0x5F, 0x6E, 0x3E, 0x6E, 0x9F, 0x6E, 0xDF, 0x5E, 0xDF, 0x5E, 0x9F, 0x66, 0x7F, 0x66, 0x9F, 0x5E, 0xBF, 0x5E, 0x1C, 0x5F, 0x1F, 0x97, 0xBF, 0xEF, 
+0xFE, 0xEF, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0x8E, 0xFE, 0x1D, 0xFE, 0x05, 0xDF, 0x15, 0x9F, 0x0D, 0xDF, 0x05, 0xDF, 0x1D, 0x9E, 0x15, 0x9E, 0x05, 0x7F, 0x0D, 0x7F, 0x0D, 0x9E, 0x0D, 0x9F, 0x0D, 
+0xDD, 0x04, 0x39, 0x24, 0x37, 0x85, 0xDA, 0xD6, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0x5C, 0xE7, 0xF9, 0xA5, 0x16, 0x3C, 
+0x18, 0x0C, 0xDB, 0x04, 0xFC, 0x0C, 0xFD, 0x0C, 0xDC, 0x0C, 0xFC, 0x14, 0xFC, 0x14, 0xFB, 0x0C, 0xFB, 0x04, 0x1C, 0x0D, 0x1B, 0x0D, 0xFC, 0x14, 0xFD, 0x14, 0xFB, 0x0C, 0x1D, 0x66, 0xBF, 0xDF, 
+0xFE, 0xFF, 0xFD, 0xFF, 0xDF, 0xDF, 0x1F, 0xA7, 0x5E, 0x66, 0x1D, 0x56, 0x1E, 0x66, 0x3E, 0x6E, 0x1D, 0x66, 0xDD, 0x55, 0x1D, 0x5E, 0x3E, 0x66, 0x3D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x3E, 0x66, 
+0x5E, 0x66, 0x5D, 0x5E, 0x7D, 0x66, 0x5D, 0x66, 0x5D, 0x5E, 0x5D, 0x5E, 0x5E, 0x5E, 0x7F, 0x5E, 0x9F, 0x5E, 0x7F, 0x5E, 0x9F, 0x5E, 0x9E, 0x5E, 0x9F, 0x5E, 0xBF, 0x66, 0xBF, 0x66, 0xFF, 0x66, 
+0xFE, 0x5E, 0xFF, 0x5E, 0xDF, 0x5E, 0xFF, 0x6E, 0x7F, 0xCF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xE7, 0x1F, 0x97, 0xFF, 0x1D, 0xDF, 0x0D, 0xFF, 0x0D, 0xDF, 0x0D, 0x9F, 0x0D, 0xBE, 0x0D, 0x9E, 0x0D, 
+0x9F, 0x15, 0x7F, 0x0D, 0x5C, 0x0D, 0x9D, 0x0D, 0x3F, 0x05, 0x7C, 0x0C, 0x77, 0x44, 0xB7, 0xA5, 0x3C, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 
+0x9F, 0xF7, 0xFC, 0xCE, 0x55, 0x5C, 0x18, 0x1C, 0xBA, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDC, 0x14, 0xDC, 0x0C, 0xDB, 0x0C, 0x1B, 0x0D, 0xFC, 0x0C, 0x1C, 0x0D, 0xDC, 0x04, 
+0xDC, 0x14, 0x3D, 0x6E, 0xBF, 0xD7, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xEF, 0xBD, 0x96, 0xFD, 0x5D, 0xDE, 0x65, 0xFE, 0x6D, 0x1D, 0x5E, 0x3D, 0x5E, 0xFE, 0x65, 0x1E, 0x6E, 0x1E, 0x66, 0x1E, 0x5E, 
+0x1D, 0x5E, 0x1D, 0x5E, 0x1D, 0x6E, 0x5D, 0x7E, 0x5E, 0x8E, 0xDD, 0x9E, 0x1F, 0xAF, 0x5F, 0xBF, 0x5F, 0xC7, 0x5F, 0xBF, 0x1F, 0xA7, 0xDE, 0x8E, 0xBE, 0x76, 0xDF, 0x66, 0xBF, 0x5E, 0xBF, 0x66, 
+0xBF, 0x66, 0xBF, 0x66, 0xBF, 0x66, 0xDF, 0x5E, 0xFF, 0x56, 0xFF, 0x66, 0xBF, 0x66, 0x9F, 0x6E, 0xDF, 0x66, 0x9F, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBF, 0x8E, 0xFC, 0x15, 0xDE, 0x05, 
+0x9F, 0x1D, 0x7F, 0x0D, 0xBE, 0x05, 0x9E, 0x15, 0x9E, 0x0D, 0x9E, 0x0D, 0x3D, 0x15, 0x5D, 0x15, 0x5E, 0x0D, 0x1E, 0x0D, 0x39, 0x1C, 0x96, 0x64, 0xDA, 0xD6, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xF7, 0x5C, 0xEF, 0xB9, 0x9D, 0xB5, 0x23, 0x7B, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 
+0x1C, 0x0D, 0xFB, 0x0C, 0xFC, 0x14, 0xFB, 0x0C, 0xFC, 0x55, 0x7F, 0xDF, 0xFF, 0xFF, 0xDE, 0xEF, 0x5E, 0xCF, 0x3D, 0x86, 0xFC, 0x6D, 0xFD, 0x65, 0x1D, 0x66, 0xFD, 0x65, 0x1C, 0x66, 0x3D, 0x66, 
+0x3E, 0x66, 0x1F, 0x66, 0xFE, 0x5D, 0x1D, 0x66, 0x5E, 0x7E, 0xFF, 0x9E, 0x7F, 0xC7, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xF7, 0xBF, 0xCF, 0x1E, 0xA7, 0xDF, 0x7E, 0x9F, 0x66, 0xDF, 0x5E, 0xFF, 0x66, 0xBE, 0x6E, 0xDE, 0x7E, 0x5F, 0xA7, 0xFF, 0x76, 0xBF, 0x5E, 0xBF, 0x66, 0xBF, 0x66, 0x5F, 0xAF, 0xDF, 0xFF, 
+0xBE, 0xFF, 0xBF, 0xEF, 0x9D, 0x66, 0xBD, 0x15, 0x9F, 0x15, 0x9F, 0x15, 0x9E, 0x0D, 0x7E, 0x0D, 0x7E, 0x0D, 0x7D, 0x0D, 0x5E, 0x15, 0x5D, 0x1D, 0x3D, 0x0D, 0x5E, 0x0D, 0x7C, 0x04, 0x37, 0x34, 
+0xD9, 0x9D, 0x3C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xDE, 0xEF, 0xFA, 0xDE, 0x35, 0x6C, 0xF8, 0x1B, 0xBB, 0x04, 0xFC, 0x0C, 0xFD, 0x0C, 0xFC, 0x0C, 0x1B, 0x0D, 
+0x3A, 0x0D, 0x1B, 0x05, 0x1C, 0x0D, 0xFC, 0x0C, 0xDC, 0x0C, 0xFC, 0x14, 0x1C, 0x05, 0x7B, 0x2D, 0x5F, 0xB7, 0xFE, 0xFF, 0xBE, 0xFF, 0xFF, 0xE7, 0x5C, 0x8E, 0x5D, 0x5E, 0x3D, 0x66, 0x1C, 0x66, 
+0x1C, 0x56, 0x3D, 0x5E, 0xFD, 0x65, 0xFD, 0x65, 0x3D, 0x66, 0x1C, 0x66, 0x7D, 0x86, 0x3E, 0xBF, 0xDF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xE7, 0xBF, 0xDF, 0x3E, 0xC7, 0x3E, 0xBF, 0x5E, 0xBF, 
+0x7E, 0xBF, 0xBF, 0xC7, 0xDF, 0xDF, 0xDF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0x7F, 0xAF, 0xDF, 0x66, 0xBF, 0x5E, 0xDF, 0x86, 0xDF, 0xD7, 0xDF, 0xF7, 0x5E, 0x97, 0xFF, 0x5E, 
+0xDF, 0x5E, 0xBF, 0x56, 0xBE, 0x6E, 0x3F, 0xAF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBF, 0xDF, 0x5F, 0x5E, 0x9E, 0x05, 0x9F, 0x0D, 0x9F, 0x15, 0x9E, 0x0D, 0x5E, 0x15, 0x5E, 0x0D, 0x3C, 0x05, 0x5D, 0x15, 
+0x3D, 0x15, 0x5E, 0x0D, 0xFC, 0x04, 0x38, 0x1C, 0xB8, 0x5C, 0xFB, 0xDE, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBD, 0xEF, 0x39, 0xBE, 0x18, 0x24, 0x79, 0x14, 0xBC, 0x0C, 
+0xFB, 0x04, 0xFB, 0x04, 0xFB, 0x0C, 0xFC, 0x0C, 0xFD, 0x0C, 0x1B, 0x05, 0x1A, 0x05, 0x1B, 0x15, 0xDC, 0x0C, 0x1D, 0x0D, 0x19, 0x15, 0xDD, 0x9E, 0xFF, 0xFF, 0xDE, 0xFF, 0x9F, 0xEF, 0x9E, 0x8E, 
+0x3D, 0x56, 0x5D, 0x5E, 0x1D, 0x5E, 0xFC, 0x65, 0xFC, 0x5D, 0x3F, 0x5E, 0x1E, 0x5E, 0xDB, 0x65, 0x7D, 0x76, 0x1D, 0xB7, 0xBF, 0xE7, 0xFF, 0xFF, 0x7F, 0xE7, 0xFD, 0xB6, 0xBE, 0x8E, 0x7F, 0x7E, 
+0x3F, 0x6E, 0x3E, 0x66, 0x3E, 0x5E, 0x3E, 0x5E, 0x7F, 0x5E, 0x9F, 0x66, 0x9F, 0x76, 0xFF, 0x86, 0x5F, 0x97, 0xBF, 0xC7, 0xDF, 0xE7, 0xFF, 0xF7, 0x7F, 0xCF, 0xDE, 0x56, 0xFF, 0x66, 0x9F, 0xBF, 
+0xFF, 0xFF, 0x9F, 0xB7, 0x1F, 0x5F, 0x9F, 0x6E, 0xDE, 0x5E, 0xDF, 0x5E, 0x9F, 0x6E, 0x9F, 0x56, 0x7F, 0xBF, 0xFE, 0xFF, 0xDF, 0xF7, 0x5E, 0xCF, 0xFE, 0x35, 0x7D, 0x05, 0x7D, 0x0D, 0x7E, 0x15, 
+0x7E, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 0x5D, 0x15, 0x3D, 0x15, 0x3D, 0x0D, 0x3C, 0x0D, 0xDB, 0x14, 0x19, 0x1C, 0x39, 0xC6, 0x7D, 0xF7, 0xDF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0xDF, 
+0x57, 0x9D, 0xF8, 0x1B, 0x9A, 0x14, 0xDC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 0x1B, 0x0D, 0xFB, 0x0C, 0xFC, 0x14, 0xDC, 0x0C, 0x1C, 0x05, 0x1D, 0x76, 0xDF, 0xE7, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xBD, 0x9E, 0x1C, 0x6E, 0x1C, 0x66, 0x1E, 0x5E, 0x3C, 0x66, 0x3D, 0x5E, 0x3E, 0x66, 0xDC, 0x65, 0xDC, 0x5D, 0xDF, 0x8E, 0x7F, 0xD7, 0xDF, 0xFF, 0x5E, 0xCF, 0xDE, 0x96, 
+0x7E, 0x6E, 0x5E, 0x66, 0x3E, 0x66, 0x3D, 0x66, 0x3C, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x5E, 0x66, 0x5E, 0x6E, 0x9E, 0x76, 0xDE, 0x76, 0x1F, 0x97, 0x1F, 0xAF, 
+0xFF, 0x7E, 0xFE, 0x7E, 0x7E, 0xB7, 0xDF, 0xFF, 0x9E, 0xDF, 0xFF, 0x7E, 0xBF, 0x56, 0xBF, 0x66, 0xFF, 0x66, 0x7E, 0x5E, 0x9F, 0x66, 0xBF, 0x5E, 0x9D, 0x7E, 0x9F, 0xCF, 0xFF, 0xFF, 0xBF, 0xE7, 
+0xDE, 0x86, 0xBE, 0x15, 0x7E, 0x15, 0x7E, 0x15, 0x5D, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 0x3D, 0x0D, 0x1D, 0x0D, 0x3D, 0x0D, 0x5C, 0x0D, 0xDB, 0x14, 0x19, 0x1C, 0x97, 0x9D, 0x1C, 0xE7, 0xDF, 0xF7, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xBF, 0xF7, 0xBA, 0xCE, 0x95, 0x6C, 0xF8, 0x0B, 0xBB, 0x14, 0xFC, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 
+0xDC, 0x0C, 0x5C, 0x35, 0x5F, 0xD7, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0xB7, 0x5C, 0x66, 0xBB, 0x5D, 0x1D, 0x6E, 0x1D, 0x66, 0xFD, 0x5D, 0x3D, 0x66, 0x1D, 0x5E, 0xFC, 0x6D, 0xFE, 0xAE, 0xDF, 0xE7, 
+0x9F, 0xE7, 0xFE, 0xA6, 0x7C, 0x7E, 0x1C, 0x56, 0x1E, 0x56, 0x1F, 0x66, 0xFE, 0x65, 0x1D, 0x5E, 0x7D, 0x56, 0x1D, 0x5E, 0x3E, 0x5E, 0x5E, 0x66, 0x7E, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 
+0x9F, 0x66, 0x9E, 0x5E, 0xBF, 0x66, 0x7F, 0x6E, 0xBF, 0x66, 0x7F, 0xAF, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x97, 0xDF, 0x5E, 0xBF, 0x76, 0xBF, 0x56, 0xDF, 0x66, 0x5F, 0x6E, 0x9F, 0x5E, 0xBF, 0x66, 
+0x5E, 0x5E, 0xDF, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xDF, 0x1E, 0x46, 0x9E, 0x15, 0x3C, 0x15, 0x5D, 0x15, 0x5D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x1D, 0x0D, 0x3D, 0x0D, 0x5D, 0x05, 0xFC, 0x0C, 
+0x3A, 0x14, 0xB5, 0x6C, 0xBB, 0xD6, 0xDF, 0xF7, 0xFE, 0xFF, 0xDE, 0xFF, 0xBE, 0xEF, 0x59, 0xBE, 0x15, 0x44, 0x5A, 0x0C, 0xDC, 0x0C, 0xDC, 0x0C, 0xFA, 0x0C, 0xDB, 0x14, 0xDC, 0x0C, 0xFB, 0x04, 
+0xFB, 0x04, 0xFC, 0x14, 0xDC, 0x0C, 0xDB, 0x04, 0x1B, 0x15, 0x3D, 0x8E, 0xFF, 0xF7, 0xFD, 0xFF, 0x9F, 0xDF, 0x5D, 0x76, 0x3D, 0x66, 0xDC, 0x6D, 0x3D, 0x5E, 0x1C, 0x66, 0xFE, 0x65, 0xFD, 0x65, 
+0xFC, 0x5D, 0x1E, 0x9F, 0xFF, 0xF7, 0x7E, 0xE7, 0x7E, 0x96, 0x1E, 0x5E, 0x1E, 0x66, 0x1D, 0x66, 0x3D, 0x66, 0x3D, 0x66, 0x1E, 0x66, 0x1F, 0x66, 0x3F, 0x6E, 0x3E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 
+0x5E, 0x66, 0x7F, 0x66, 0x9F, 0x66, 0x9F, 0x5E, 0x9F, 0x5E, 0xDF, 0x6E, 0xBF, 0x66, 0xDF, 0x66, 0x3F, 0xA7, 0xDF, 0xDF, 0xFF, 0xFF, 0x7F, 0xB7, 0xFF, 0x66, 0x1F, 0x7F, 0x3F, 0xAF, 0xDE, 0x6E, 
+0xBF, 0x5E, 0x9F, 0x6E, 0xBF, 0x5E, 0x9F, 0x5E, 0x9F, 0x5E, 0x7F, 0x5E, 0x1E, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0x9E, 0x9E, 0x1D, 0x3D, 0x0D, 0x5E, 0x15, 0x3D, 0x0D, 0x3D, 0x05, 0x3D, 0x0D, 
+0x1D, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0xFC, 0x0C, 0x5B, 0x14, 0x35, 0x44, 0x5A, 0xBE, 0xBF, 0xF7, 0xFE, 0xFF, 0xDE, 0xFF, 0x9D, 0xE7, 0xF8, 0xB5, 0xD6, 0x2B, 0xBB, 0x0C, 0xFC, 0x0C, 0xBC, 0x04, 
+0xFB, 0x0C, 0xFB, 0x14, 0xFC, 0x0C, 0x1C, 0x05, 0x1B, 0x05, 0xFC, 0x14, 0xDC, 0x04, 0xFB, 0x04, 0x9C, 0x3D, 0x7F, 0xDF, 0xFF, 0xF7, 0xDF, 0xFF, 0x9D, 0x9E, 0x3D, 0x5E, 0xDC, 0x65, 0x3E, 0x6E, 
+0xDE, 0x55, 0xFD, 0x5D, 0x3D, 0x66, 0xFD, 0x5D, 0x9F, 0x96, 0xDF, 0xE7, 0x5D, 0xCF, 0x5C, 0x7E, 0xFD, 0x6D, 0xFE, 0x65, 0xFE, 0x6D, 0xDD, 0x6D, 0xFD, 0x65, 0x3D, 0x5E, 0x5D, 0x5E, 0x3E, 0x66, 
+0xFE, 0x6D, 0x3E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x7F, 0x66, 0x9F, 0x5E, 0x9F, 0x5E, 0x9F, 0x5E, 0xBF, 0x5E, 0xBF, 0x6E, 0x7F, 0x9F, 0xDF, 0xEF, 0xFF, 0xFF, 0x9F, 0xE7, 0xDF, 0x86, 
+0xFF, 0x6E, 0x7F, 0xBF, 0xBF, 0xEF, 0x3E, 0xA7, 0xDF, 0x6E, 0x9F, 0x66, 0xBF, 0x5E, 0x7E, 0x56, 0x7F, 0x66, 0x9F, 0x5E, 0x5F, 0x6E, 0xBF, 0xE7, 0xDF, 0xFF, 0xDF, 0xEF, 0xDD, 0x4D, 0x5E, 0x0D, 
+0x5E, 0x15, 0x1D, 0x0D, 0x3D, 0x05, 0x3D, 0x0D, 0x1D, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0x1C, 0x0D, 0x9B, 0x0C, 0x16, 0x2C, 0x19, 0xB6, 0x7E, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9C, 0xDF, 0xB7, 0xB5, 
+0xD6, 0x23, 0xDB, 0x04, 0xDC, 0x0C, 0xBB, 0x04, 0xFB, 0x0C, 0xFB, 0x0C, 0xDC, 0x0C, 0x1C, 0x05, 0x1A, 0x05, 0xFC, 0x14, 0xDC, 0x04, 0x1B, 0x15, 0x5D, 0x7E, 0xFF, 0xF7, 0xFF, 0xFF, 0x7F, 0xDF, 
+0x1C, 0x6E, 0x1D, 0x5E, 0xDB, 0x65, 0x3D, 0x5E, 0xDF, 0x6D, 0xFD, 0x5D, 0x3E, 0x66, 0x5D, 0x8E, 0xBF, 0xDF, 0x9F, 0xD7, 0x1D, 0x76, 0x3E, 0x56, 0x1C, 0x5E, 0x1D, 0x56, 0xFD, 0x5D, 0xFD, 0x65, 
+0x1D, 0x66, 0x3E, 0x6E, 0x5E, 0x66, 0x3D, 0x5E, 0x3D, 0x5E, 0x1D, 0x5E, 0x3E, 0x66, 0x5E, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x9F, 0x5E, 0xBF, 0x66, 0xBF, 0x66, 0xBF, 0x96, 0xDF, 0xEF, 
+0xFD, 0xFF, 0xFF, 0xF7, 0x3F, 0xA7, 0x9F, 0x76, 0x1F, 0x6F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xE7, 0x3F, 0x97, 0x5E, 0x66, 0x9F, 0x5E, 0x9F, 0x5E, 0x1F, 0x6E, 0x7E, 0x66, 0x5F, 0x56, 0xDF, 0x96, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xA6, 0x5E, 0x15, 0x3D, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0x3D, 0x0D, 0x1D, 0x15, 0xFC, 0x0C, 0x1C, 0x05, 0x1C, 0x05, 0xDC, 0x0C, 0xF7, 0x23, 0xD8, 0xB5, 0x3D, 0xEF, 
+0xFF, 0xF7, 0xDF, 0xFF, 0x7C, 0xDF, 0x97, 0xB5, 0xD7, 0x1B, 0xBA, 0x04, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x04, 0xBC, 0x14, 0xDC, 0x0C, 0xFA, 0x04, 0xDB, 0x14, 0xDC, 0x04, 0x7B, 0x35, 
+0x3E, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xBE, 0xA6, 0xFD, 0x65, 0xFD, 0x5D, 0x1D, 0x66, 0xFC, 0x5D, 0x1E, 0x76, 0x1D, 0x5E, 0x1D, 0x76, 0x1E, 0xBF, 0xBE, 0xD7, 0x9D, 0x86, 0xDE, 0x5D, 0x7F, 0x6E, 
+0x3C, 0x56, 0x3E, 0x66, 0x3D, 0x5E, 0x3D, 0x56, 0x3D, 0x5E, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x3E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x5F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 
+0xBF, 0x6E, 0x3F, 0x9F, 0x7F, 0xDF, 0xDF, 0xFF, 0xFF, 0xF7, 0x9F, 0xC7, 0xFF, 0x76, 0xDF, 0x5E, 0xFE, 0x66, 0x9F, 0xB7, 0xFF, 0xEF, 0xFF, 0xFF, 0x9F, 0xD7, 0x7E, 0x86, 0x9F, 0x5E, 0x9F, 0x66, 
+0x5E, 0x6E, 0x5E, 0x6E, 0x9F, 0x56, 0x1D, 0x56, 0xBF, 0xDF, 0xBF, 0xFF, 0xDF, 0xE7, 0xBC, 0x45, 0x3D, 0x0D, 0x1D, 0x0D, 0x3C, 0x05, 0x3D, 0x0D, 0x1C, 0x15, 0xFC, 0x0C, 0x1C, 0x05, 0x1C, 0x05, 
+0xDB, 0x0C, 0xF7, 0x1B, 0xB7, 0xB5, 0x3C, 0xEF, 0xFF, 0xF7, 0xDF, 0xFF, 0x7C, 0xDF, 0x96, 0xB5, 0xF8, 0x1B, 0xD9, 0x04, 0x1C, 0x15, 0xDC, 0x0C, 0xBB, 0x0C, 0xFB, 0x04, 0x9C, 0x14, 0xDC, 0x0C, 
+0xDA, 0x0C, 0xFC, 0x14, 0xFC, 0x0C, 0xBB, 0x45, 0xDF, 0xF7, 0xDF, 0xFF, 0x7F, 0xD7, 0x3C, 0x76, 0xDD, 0x65, 0xFD, 0x5D, 0x1E, 0x5E, 0xDD, 0x6D, 0x3C, 0x5E, 0xFE, 0x65, 0x9B, 0x9E, 0xFF, 0xD7, 
+0xDE, 0x9E, 0xBC, 0x65, 0x3D, 0x6E, 0xFC, 0x5D, 0xFD, 0x65, 0xFC, 0x65, 0x1D, 0x6E, 0x1E, 0x6E, 0xFE, 0x65, 0xFE, 0x65, 0x3E, 0x66, 0x5E, 0x5E, 0x5D, 0x5E, 0x3E, 0x66, 0x3E, 0x66, 0x5F, 0x5E, 
+0x7F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x9F, 0x6E, 0xFF, 0x7E, 0xDD, 0xCF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xEF, 0x1F, 0x97, 0x9E, 0x5E, 0xFF, 0x56, 0x7F, 0x6E, 0x9E, 0x76, 0x9F, 0xCF, 0xFE, 0xFF, 
+0xDF, 0xFF, 0x3F, 0xAF, 0xBF, 0x5E, 0x3F, 0x5E, 0x9E, 0x66, 0x3F, 0x66, 0x9E, 0x5E, 0x1C, 0x56, 0xFF, 0xA6, 0xDF, 0xFF, 0xFF, 0xEF, 0x7C, 0x86, 0x3E, 0x0D, 0x3D, 0x0D, 0x3C, 0x05, 0x3C, 0x05, 
+0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x05, 0xDB, 0x0C, 0xF7, 0x13, 0xD7, 0xB5, 0x3C, 0xF7, 0xFF, 0xEF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0xBB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 
+0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x04, 0xDB, 0x0C, 0xDC, 0x14, 0xFC, 0x0C, 0xFC, 0x0C, 0x7B, 0xA6, 0xFF, 0xEF, 0xFF, 0xFF, 0x1E, 0x9F, 0xFC, 0x65, 0xFE, 0x6D, 0xFD, 0x5D, 0x1C, 0x66, 0xFE, 0x5D, 
+0xFC, 0x65, 0x3D, 0x6E, 0x5E, 0xD7, 0x5E, 0xAF, 0x3E, 0x66, 0xDD, 0x65, 0x1C, 0x66, 0x1D, 0x66, 0x3D, 0x5E, 0xFC, 0x65, 0x1D, 0x66, 0x3E, 0x66, 0x3E, 0x5E, 0x1D, 0x66, 0x1D, 0x66, 0x3E, 0x66, 
+0x3E, 0x66, 0x7F, 0x5E, 0x5E, 0x66, 0x7E, 0x66, 0x3E, 0x66, 0x3F, 0x6E, 0x9F, 0x56, 0xFF, 0x76, 0x9E, 0xD7, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0xAF, 0xDF, 0x66, 0xDF, 0x66, 0x7E, 0x66, 
+0xDF, 0x5E, 0x9F, 0x6E, 0x1F, 0x8F, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xBE, 0x8E, 0x7F, 0x5E, 0x7E, 0x5E, 0x5E, 0x5E, 0xFF, 0x65, 0x5C, 0x6E, 0x9F, 0x56, 0xBF, 0xF7, 0xDF, 0xFF, 0x7D, 0xC7, 
+0x3D, 0x15, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x04, 0xDB, 0x0C, 0xFC, 0x14, 0xFB, 0x04, 0x3C, 0x1D, 0x3E, 0xCF, 0xFF, 0xF7, 0x9E, 0xF7, 0xBD, 0x8E, 0xFC, 0x65, 
+0xFE, 0x65, 0xFD, 0x5D, 0x1C, 0x66, 0x1E, 0x5E, 0xFC, 0x65, 0x7D, 0x8E, 0x5F, 0xCF, 0xBC, 0x8E, 0xFD, 0x65, 0xDD, 0x65, 0x1D, 0x5E, 0xFD, 0x65, 0x1D, 0x5E, 0xFD, 0x65, 0x1D, 0x66, 0x1D, 0x66, 
+0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x3D, 0x66, 0x3E, 0x66, 0xFD, 0x5D, 0x3D, 0x66, 0x7F, 0x6E, 0x5F, 0x66, 0x7E, 0x5E, 0xFE, 0x7E, 0x5F, 0xBF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xD7, 
+0xDF, 0x86, 0x9F, 0x5E, 0xDF, 0x66, 0x9F, 0x66, 0x9F, 0x66, 0x9F, 0x66, 0xBF, 0x76, 0x7E, 0xD7, 0xFF, 0xFF, 0xFF, 0xF7, 0x5F, 0xB7, 0x7F, 0x6E, 0x5E, 0x5E, 0x5E, 0x66, 0x1F, 0x66, 0x3C, 0x66, 
+0xDD, 0x45, 0x3F, 0xCF, 0xFF, 0xFF, 0xDF, 0xDF, 0x9D, 0x35, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x04, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 
+0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xFC, 0x04, 0xDB, 0x0C, 0x1C, 0x15, 0xDB, 0x04, 0x7C, 0x3D, 0xFF, 0xEF, 
+0xFF, 0xFF, 0x3E, 0xD7, 0x3C, 0x76, 0xFC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFC, 0x65, 0x1E, 0x5E, 0xFC, 0x65, 0x1E, 0xB7, 0x5F, 0xBF, 0xFB, 0x6D, 0xFD, 0x65, 0x1D, 0x66, 0x1D, 0x66, 0xFD, 0x65, 
+0x1D, 0x5E, 0x1E, 0x66, 0x1D, 0x5E, 0xFD, 0x65, 0xFD, 0x65, 0x1D, 0x66, 0x1D, 0x66, 0x3D, 0x66, 0x3D, 0x5E, 0x3F, 0x6E, 0x7F, 0x66, 0x7F, 0x66, 0x3F, 0x5E, 0xBD, 0x6E, 0x9D, 0xBF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x3E, 0x9F, 0x9E, 0x5E, 0x9F, 0x5E, 0xBF, 0x66, 0xBF, 0x5E, 0x7F, 0x6E, 0xBF, 0x5E, 0x7E, 0x66, 0xFE, 0xA6, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xE7, 0x9F, 0x86, 
+0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x5F, 0x6E, 0xBC, 0x4D, 0xDE, 0x9E, 0xFF, 0xFF, 0xFF, 0xF7, 0x1D, 0x6E, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0x1C, 0x0D, 0xFC, 0x0C, 
+0xDB, 0x04, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 
+0xFC, 0x0C, 0xDB, 0x04, 0xDC, 0x65, 0xFF, 0xFF, 0xFE, 0xFF, 0x1E, 0xBF, 0x1C, 0x6E, 0xFC, 0x65, 0xFD, 0x65, 0x1D, 0x66, 0xFC, 0x5D, 0x1E, 0x5E, 0x1D, 0x76, 0x7F, 0xDF, 0xDE, 0x9E, 0xDC, 0x5D, 
+0xFD, 0x65, 0x1C, 0x5E, 0x1D, 0x5E, 0xFE, 0x6D, 0x1C, 0x5E, 0x1D, 0x5E, 0x1D, 0x5E, 0xFD, 0x65, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1E, 0x5E, 0x3E, 0x5E, 0x1E, 0x66, 0x5E, 0x56, 0x3E, 0x56, 
+0x5E, 0x76, 0x3F, 0xB7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x5F, 0xBF, 0xBF, 0x6E, 0xBF, 0x56, 0xDF, 0x66, 0x9F, 0x66, 0x9F, 0x5E, 0x9F, 0x66, 0xBF, 0x5E, 0x7E, 0x5E, 0x9F, 0x7E, 
+0x9F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x3E, 0x66, 0x3D, 0x5E, 0x3D, 0x5E, 0x7F, 0x66, 0x1D, 0x66, 0x7D, 0x76, 0xFF, 0xEF, 0xFF, 0xFF, 0xDE, 0xA6, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x14, 0xDB, 0x04, 0xFB, 0x0C, 0x7D, 0x96, 0xDF, 0xFF, 0xDE, 0xFF, 0xDE, 0xA6, 0xFD, 0x65, 0x1C, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0xDC, 0x5D, 0x1D, 0x5E, 
+0x7D, 0x86, 0x9F, 0xDF, 0x1C, 0x76, 0xFE, 0x5D, 0x1D, 0x66, 0x1C, 0x5E, 0xFD, 0x5D, 0xFD, 0x65, 0xFC, 0x5D, 0x1D, 0x66, 0xFD, 0x65, 0x1D, 0x66, 0x1D, 0x66, 0x1E, 0x5E, 0x1E, 0x56, 0x1E, 0x5E, 
+0x3E, 0x66, 0x5C, 0x7E, 0xBF, 0x8E, 0xFF, 0x96, 0x3F, 0xBF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xDF, 0xDF, 0xDE, 0x86, 0x9F, 0x5E, 0xBF, 0x66, 0xBF, 0x6E, 0x9F, 0x66, 0x5F, 0x5E, 
+0xBF, 0x5E, 0x9F, 0x66, 0x7F, 0x66, 0x7F, 0x6E, 0x3E, 0xBF, 0xFF, 0xF7, 0xFE, 0xFF, 0x9F, 0xC7, 0x5E, 0x6E, 0x3E, 0x66, 0x3D, 0x5E, 0x1F, 0x5E, 0x1D, 0x6E, 0xFC, 0x4D, 0xBE, 0xDF, 0xDF, 0xFF, 
+0x5F, 0xCF, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x04, 0xDB, 0x14, 0xBB, 0x04, 0xFB, 0x0C, 0x1E, 0xBF, 0xBF, 0xFF, 0xDE, 0xEF, 0x9E, 0x8E, 0xDD, 0x5D, 0x1C, 0x5E, 
+0xFD, 0x5D, 0xFD, 0x65, 0xDC, 0x5D, 0x1D, 0x5E, 0xDE, 0xA6, 0x5F, 0xCF, 0xDB, 0x5D, 0x3F, 0x66, 0x1D, 0x66, 0x1D, 0x5E, 0xDD, 0x65, 0x1D, 0x66, 0xFD, 0x65, 0xFD, 0x65, 0xFC, 0x65, 0x1D, 0x66, 
+0x1E, 0x66, 0x1E, 0x5E, 0xFE, 0x5D, 0x3D, 0x76, 0xBE, 0x8E, 0xBE, 0xC7, 0xDF, 0xE7, 0xDF, 0xEF, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0x5F, 0xA7, 0x9E, 0x66, 0x9F, 0x5E, 
+0x7F, 0x6E, 0x5E, 0x66, 0x9F, 0x66, 0x7F, 0x66, 0x9E, 0x56, 0x5F, 0x66, 0x7F, 0x6E, 0x5F, 0x66, 0xDE, 0xA6, 0xFF, 0xF7, 0xDD, 0xFF, 0xFF, 0xDF, 0x7E, 0x76, 0x3E, 0x66, 0x3E, 0x66, 0xFE, 0x5D, 
+0x1D, 0x66, 0xBC, 0x45, 0x9F, 0xD7, 0xFF, 0xFF, 0x9E, 0xDF, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 
+0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x14, 0xFB, 0x0C, 0xFB, 0x0C, 0x7F, 0xD7, 0xDF, 0xFF, 
+0xBE, 0xDF, 0x5D, 0x86, 0xDD, 0x65, 0xFC, 0x5D, 0xFD, 0x5D, 0xDD, 0x65, 0xDC, 0x5D, 0xFC, 0x65, 0x3E, 0xBF, 0xFE, 0xA6, 0xFC, 0x5D, 0x1D, 0x6E, 0x1C, 0x66, 0x1E, 0x66, 0xDD, 0x6D, 0x1C, 0x5E, 
+0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0x1D, 0x66, 0x3E, 0x5E, 0x1D, 0x5E, 0x1D, 0x6E, 0xDE, 0xA6, 0x7F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0x9E, 0xDF, 0xDF, 0x76, 0x7F, 0x5E, 0x9F, 0x66, 0x7F, 0x66, 0x5E, 0x5E, 0x9F, 0x66, 0x7F, 0x66, 0x5F, 0x66, 0x5E, 0x66, 0x7E, 0x66, 0x5F, 0x5E, 0x9E, 0x8E, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 
+0x9F, 0x86, 0x1D, 0x66, 0x3E, 0x5E, 0x1E, 0x5E, 0x3E, 0x66, 0xDC, 0x55, 0x3F, 0xC7, 0xFF, 0xFF, 0x9E, 0xE7, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xDB, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xBB, 0x14, 
+0xFC, 0x0C, 0xDB, 0x0C, 0xBF, 0xE7, 0xFF, 0xFF, 0x9D, 0xCF, 0x3D, 0x7E, 0xFD, 0x65, 0xFC, 0x5D, 0xFD, 0x5D, 0xDE, 0x65, 0xDD, 0x65, 0xFB, 0x65, 0x5F, 0xCF, 0x9D, 0x86, 0x1D, 0x66, 0xDC, 0x65, 
+0xFC, 0x5D, 0xFE, 0x65, 0xDE, 0x6D, 0xFB, 0x55, 0xFE, 0x65, 0xFE, 0x65, 0xFD, 0x65, 0x1D, 0x5E, 0x3D, 0x5E, 0x1D, 0x5E, 0x5D, 0x86, 0x3E, 0xC7, 0xFF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 0x1D, 0x8F, 0x7F, 0x5E, 0x7F, 0x6E, 0x7F, 0x66, 0x9F, 0x5E, 0x9E, 0x66, 0x7E, 0x5E, 0x7F, 0x5E, 0x1F, 0x6E, 0x9F, 0x66, 0x7E, 0x66, 0x5E, 0x5E, 
+0x7E, 0x7E, 0xDF, 0xEF, 0xFF, 0xFF, 0xBE, 0xF7, 0xDF, 0x96, 0x1D, 0x66, 0x1E, 0x5E, 0x3D, 0x66, 0x3D, 0x5E, 0xDD, 0x5D, 0x9E, 0xAE, 0xFF, 0xFF, 0xDE, 0xE7, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xDC, 0x04, 0xDA, 0x04, 0xBA, 0x14, 0xBC, 0x0C, 0x1B, 0x05, 0x9E, 0xEF, 0xFF, 0xFF, 0x7F, 0xE7, 0x3D, 0x76, 0xDD, 0x65, 0xFB, 0x65, 0x1D, 0x66, 0xDD, 0x65, 0xFD, 0x5D, 0xFC, 0x5D, 
+0x1E, 0xBF, 0x1E, 0x6E, 0x1D, 0x66, 0xDC, 0x5D, 0xDC, 0x65, 0xFD, 0x6D, 0xFD, 0x5D, 0x1D, 0x5E, 0xFC, 0x65, 0xDC, 0x5D, 0x5E, 0x5E, 0xFD, 0x5D, 0xFD, 0x5D, 0x1D, 0x5E, 0x7D, 0x8E, 0x9F, 0xE7, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x3E, 0x9F, 0x7F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 0x5F, 0x66, 0x5F, 0x66, 0x5E, 0x66, 
+0x5E, 0x66, 0x7F, 0x5E, 0x3D, 0x6E, 0x3F, 0x6E, 0x5D, 0x5E, 0x9E, 0xE7, 0xFF, 0xF7, 0xDF, 0xFF, 0xDD, 0xA6, 0xFD, 0x65, 0x3E, 0x5E, 0x3D, 0x66, 0x1C, 0x66, 0x3E, 0x76, 0x1E, 0x97, 0xDF, 0xFF, 
+0xDF, 0xE7, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBC, 0x0C, 0xDA, 0x04, 0xDA, 0x14, 0xBC, 0x0C, 0xFB, 0x04, 0xBE, 0xEF, 0xFF, 0xFF, 0x7F, 0xDF, 0x3D, 0x76, 0xFD, 0x65, 0xFB, 0x5D, 
+0xFD, 0x5D, 0xDD, 0x65, 0xDC, 0x5D, 0xFC, 0x5D, 0x1E, 0xBF, 0xFD, 0x6D, 0xFD, 0x65, 0xFC, 0x5D, 0xDD, 0x65, 0xDD, 0x65, 0xFD, 0x5D, 0x1D, 0x5E, 0xFC, 0x65, 0xFD, 0x65, 0x3D, 0x5E, 0xFD, 0x5D, 
+0xFD, 0x65, 0x3D, 0x66, 0xBE, 0x96, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xAF, 0x7F, 0x66, 0x7F, 0x66, 0x7F, 0x66, 
+0x5F, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x5F, 0x5E, 0x3D, 0x6E, 0x1E, 0x66, 0x3D, 0x5E, 0x9E, 0xE7, 0xFF, 0xF7, 0xFF, 0xFF, 0x1E, 0xAF, 0xFD, 0x65, 0x1E, 0x5E, 0x1D, 0x66, 
+0xFD, 0x5D, 0x1E, 0x6E, 0xFD, 0x9E, 0xDF, 0xFF, 0xBF, 0xE7, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 
+0xBF, 0xFF, 0xDF, 0xFF, 0x3D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBC, 0x14, 0xDB, 0x04, 0xFB, 0x0C, 0xBC, 0x0C, 0xDB, 0x0C, 0xBF, 0xEF, 0xFF, 0xFF, 
+0x7F, 0xDF, 0x3D, 0x7E, 0xFE, 0x5D, 0xFC, 0x5D, 0xDC, 0x5D, 0xDD, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0x1E, 0xBF, 0xDD, 0x6D, 0xFC, 0x65, 0x1D, 0x5E, 0xDD, 0x65, 0xDD, 0x65, 0xFD, 0x5D, 0x1D, 0x5E, 
+0xDC, 0x65, 0x1D, 0x66, 0xFC, 0x5D, 0xDD, 0x65, 0x1E, 0x6E, 0x1D, 0x5E, 0xBE, 0x8E, 0xDF, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFE, 0xFF, 0xFF, 0xF7, 
+0xFE, 0xAE, 0x5E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x5E, 0x66, 0x5E, 0x5E, 0x5E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x5E, 0x5E, 0x3D, 0x66, 0x1E, 0x66, 0x5E, 0x6E, 0x9E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x1E, 0xB7, 0xFD, 0x65, 0x1D, 0x5E, 0x1D, 0x66, 0x1D, 0x5E, 0x1E, 0x66, 0xFE, 0xA6, 0xDF, 0xFF, 0xBE, 0xE7, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 
+0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9C, 0x14, 0xDA, 0x04, 0xFB, 0x0C, 
+0xDB, 0x04, 0xBB, 0x14, 0xBF, 0xE7, 0xFF, 0xFF, 0x9E, 0xDF, 0x3D, 0x7E, 0xFD, 0x5D, 0xFC, 0x5D, 0xDC, 0x5D, 0xFD, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0x1F, 0xB7, 0x1D, 0x76, 0xDC, 0x5D, 0xFD, 0x5D, 
+0xDD, 0x65, 0xDD, 0x65, 0xFD, 0x5D, 0xFD, 0x5D, 0xDC, 0x65, 0x1D, 0x5E, 0xFC, 0x65, 0xDD, 0x6D, 0x1E, 0x66, 0xFC, 0x5D, 0x5D, 0x7E, 0x7F, 0xCF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDF, 0xE7, 0xDE, 0x8E, 0x5E, 0x5E, 0x5E, 0x66, 0x5E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x1E, 0x66, 
+0x7E, 0x7E, 0xDF, 0xEF, 0xFF, 0xFF, 0xDE, 0xFF, 0xDE, 0xA6, 0xFC, 0x65, 0x1D, 0x5E, 0x1D, 0x66, 0x1E, 0x5E, 0xFE, 0x5D, 0xFD, 0xAE, 0xDF, 0xFF, 0x9F, 0xE7, 0xFB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 
+0xDB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0x9B, 0x14, 0xDB, 0x04, 0xFB, 0x0C, 0xDB, 0x04, 0xDB, 0x14, 0xBF, 0xD7, 0xFF, 0xFF, 0x9D, 0xDF, 0x3D, 0x86, 0xFD, 0x55, 0x1D, 0x66, 0xDD, 0x65, 0xFD, 0x65, 0xFC, 0x65, 0xFD, 0x65, 
+0xDE, 0xA6, 0x7E, 0x8E, 0xDC, 0x65, 0xFD, 0x55, 0xFE, 0x65, 0xDD, 0x65, 0xFD, 0x65, 0xFC, 0x5D, 0xFD, 0x65, 0xFC, 0x55, 0xFC, 0x65, 0xFD, 0x65, 0x1E, 0x66, 0x1D, 0x5E, 0x1C, 0x6E, 0xFE, 0xA6, 
+0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x5F, 0xB7, 0x7E, 0x6E, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 
+0x1E, 0x66, 0x1E, 0x66, 0x3D, 0x66, 0x1D, 0x66, 0xBE, 0x96, 0xDF, 0xF7, 0xFF, 0xFF, 0xDE, 0xF7, 0xBE, 0x9E, 0x1D, 0x66, 0x1C, 0x5E, 0x1D, 0x66, 0x1E, 0x5E, 0xDD, 0x55, 0x1D, 0xBF, 0xFF, 0xFF, 
+0xBF, 0xE7, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x14, 0xDB, 0x04, 0xFB, 0x0C, 0xDB, 0x04, 0xDC, 0x14, 0x3E, 0xB7, 0xFF, 0xFF, 0xBE, 0xE7, 0x5D, 0x8E, 0xFC, 0x55, 0x1D, 0x66, 
+0xDD, 0x65, 0xFD, 0x5D, 0xDC, 0x5D, 0xFD, 0x65, 0x7D, 0x8E, 0xDE, 0x9E, 0xDB, 0x65, 0xFC, 0x5D, 0xFE, 0x65, 0xDD, 0x65, 0xFC, 0x65, 0xDC, 0x5D, 0xFD, 0x65, 0xFC, 0x5D, 0xFD, 0x65, 0xFC, 0x65, 
+0x1D, 0x5E, 0x1E, 0x66, 0xFC, 0x5D, 0x3C, 0x76, 0xFE, 0xAE, 0xBF, 0xCF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xF7, 0xBF, 0xDF, 0x5D, 0xB7, 0x9D, 0x7E, 0x1E, 0x5E, 0x3E, 0x66, 0x3E, 0x66, 0x3E, 0x66, 
+0x3E, 0x66, 0x1E, 0x66, 0x1E, 0x66, 0x1E, 0x66, 0x1E, 0x66, 0x1D, 0x66, 0x1D, 0x5E, 0x1C, 0x66, 0xFF, 0xB6, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xEF, 0x7E, 0x8E, 0x1D, 0x66, 0x1C, 0x5E, 0xFC, 0x65, 
+0xFE, 0x5D, 0xDC, 0x4D, 0x3E, 0xCF, 0xFF, 0xFF, 0xBF, 0xDF, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 
+0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xDB, 0x0C, 0xBC, 0x14, 0xBC, 0x96, 0xDF, 0xFF, 
+0xDF, 0xF7, 0xBE, 0xA6, 0xFC, 0x5D, 0x1C, 0x66, 0xDD, 0x65, 0xFD, 0x5D, 0xFC, 0x5D, 0xFD, 0x65, 0x1C, 0x76, 0xFE, 0xAE, 0xFB, 0x6D, 0xFD, 0x5D, 0xFD, 0x65, 0xBC, 0x65, 0xFD, 0x65, 0xFC, 0x5D, 
+0xFD, 0x65, 0xFD, 0x65, 0xDD, 0x65, 0xFC, 0x5D, 0x1C, 0x5E, 0xFD, 0x65, 0xFD, 0x65, 0xFC, 0x5D, 0x1C, 0x6E, 0x7D, 0x7E, 0xBD, 0xA6, 0x1E, 0xB7, 0xFE, 0xAE, 0x9E, 0x8E, 0x7C, 0x6E, 0x5C, 0x5E, 
+0x1E, 0x6E, 0x1E, 0x66, 0x1E, 0x66, 0x1E, 0x66, 0x1E, 0x66, 0x1E, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x5E, 0x5C, 0x6E, 0x5F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xDF, 
+0x3E, 0x76, 0x1E, 0x66, 0x1C, 0x5E, 0xFC, 0x65, 0xFE, 0x65, 0xFC, 0x55, 0x7F, 0xE7, 0xFF, 0xFF, 0x5F, 0xC7, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDA, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xBB, 0x0C, 0x5A, 0x76, 0xDF, 0xFF, 0xFF, 0xFF, 0x1F, 0xB7, 0x1C, 0x5E, 0x1D, 0x66, 0xDD, 0x6D, 0xFD, 0x5D, 0xFD, 0x5D, 0xFE, 0x5D, 0xDC, 0x65, 0xFE, 0xAE, 0xFB, 0x75, 0x1D, 0x66, 
+0xFD, 0x65, 0xBC, 0x65, 0x1D, 0x6E, 0xFD, 0x65, 0xFD, 0x65, 0xBD, 0x65, 0xBC, 0x65, 0x1C, 0x66, 0x1C, 0x5E, 0xDD, 0x6D, 0xFE, 0x6D, 0x3E, 0x5E, 0xFD, 0x5D, 0x3E, 0x66, 0xDB, 0x65, 0x3C, 0x6E, 
+0x3E, 0x66, 0xDE, 0x65, 0x1E, 0x5E, 0x5D, 0x5E, 0xFD, 0x6D, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x3E, 0x66, 0x9D, 0x7E, 
+0xBF, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xD7, 0xDE, 0x65, 0xFE, 0x5D, 0x1C, 0x5E, 0xFC, 0x65, 0x1E, 0x6E, 0x3D, 0x5E, 0xBF, 0xEF, 0xFE, 0xF7, 0xDE, 0xB6, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDE, 0xF7, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 
+0xBB, 0x0C, 0xBA, 0x0C, 0x9B, 0x0C, 0xFC, 0x04, 0x99, 0x14, 0xDC, 0x0C, 0x5B, 0x35, 0xFF, 0xFF, 0xDF, 0xF7, 0x5F, 0xCF, 0xFB, 0x6D, 0x1D, 0x66, 0x1D, 0x6E, 0xBB, 0x5D, 0xFD, 0x65, 0xDD, 0x6D, 
+0xFC, 0x5D, 0x5D, 0x86, 0x9E, 0x8E, 0xDC, 0x6D, 0xBC, 0x65, 0xFD, 0x65, 0xDD, 0x5D, 0xFD, 0x65, 0xDD, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 
+0x1D, 0x66, 0x1D, 0x66, 0x1C, 0x76, 0x3F, 0xBF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xEF, 0x9D, 0x96, 0x1D, 0x66, 0x3D, 0x5E, 0x1E, 0x6E, 0x1E, 0x5E, 0xDD, 0x55, 0xBC, 0x86, 0xDF, 0xFF, 0xDF, 0xFF, 
+0x7C, 0x76, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x04, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xF7, 0x5D, 0xEF, 0x96, 0xAD, 
+0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xDA, 0x0C, 0xBB, 0x0C, 0xDC, 0x04, 0x9A, 0x0C, 0xDC, 0x0C, 0x1B, 0x2D, 0x9F, 0xDF, 0xFF, 0xFF, 0xBF, 0xDF, 0x3C, 0x7E, 0xFD, 0x5D, 
+0xDC, 0x65, 0xFC, 0x5D, 0xFD, 0x65, 0xFD, 0x6D, 0xFC, 0x5D, 0x3C, 0x7E, 0xBF, 0x8E, 0x3D, 0x76, 0xDC, 0x65, 0xFD, 0x65, 0xDD, 0x5D, 0xFD, 0x65, 0xDC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 
+0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 
+0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1E, 0x5E, 0x1D, 0x7E, 0x1F, 0xC7, 0xFF, 0xFF, 0xDE, 0xFF, 0xBF, 0xE7, 0x5D, 0x8E, 0x1E, 0x5E, 0x1D, 0x5E, 0xDC, 0x65, 0xFD, 0x6D, 
+0xBC, 0x3D, 0x5E, 0xBF, 0xDF, 0xFF, 0xDF, 0xF7, 0x9B, 0x45, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x04, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xDE, 0xF7, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0xBB, 0x1C, 0xBE, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xA6, 0xDC, 0x65, 0xDD, 0x5D, 0x1D, 0x66, 0xFD, 0x65, 0xDC, 0x65, 0xFC, 0x5D, 0xFC, 0x75, 0x9F, 0x86, 0x5E, 0x76, 0x1D, 0x66, 0xFD, 0x65, 0xDC, 0x5D, 0xFD, 0x65, 
+0xFC, 0x5D, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x5D, 0xFD, 0x5D, 0xFD, 0x5D, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 
+0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0x1D, 0x66, 0xFD, 0x55, 0x3D, 0x76, 0xFF, 0xAE, 0xDF, 0xEF, 0xDF, 0xF7, 0x1E, 0xC7, 0xFC, 0x75, 
+0xDD, 0x4D, 0x1D, 0x66, 0xFC, 0x65, 0xBC, 0x65, 0xDC, 0x4D, 0xDF, 0xE7, 0xFE, 0xFF, 0x7F, 0xCF, 0xFB, 0x14, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0x9B, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xFB, 0x0C, 0xBB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0x9C, 0x0C, 0xFD, 0x5D, 0xDE, 0xF7, 0xFE, 0xFF, 0x7F, 0xC7, 0x1C, 0x76, 0xFE, 0x65, 0xFD, 0x5D, 0xFD, 0x65, 0xBB, 0x5D, 0xFD, 0x5D, 0xDB, 0x65, 0x5D, 0x76, 0x3E, 0x6E, 
+0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x5D, 0xFD, 0x65, 0xFC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x5D, 0xFD, 0x5D, 0xFD, 0x5D, 0xFD, 0x5D, 0xFD, 0x5D, 0xFD, 0x5D, 0xFD, 0x5D, 0xFD, 0x5D, 0x1C, 0x5E, 0x1C, 0x66, 0x3C, 0x76, 
+0x9D, 0x8E, 0x9D, 0x96, 0x1C, 0x7E, 0xDB, 0x65, 0x1D, 0x5E, 0x1D, 0x66, 0xFD, 0x6D, 0x9B, 0x4D, 0x9D, 0x9E, 0xDF, 0xEF, 0xFE, 0xFF, 0x9D, 0x86, 0xDC, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x14, 0x9C, 0x0C, 0x5C, 0x2D, 0x5E, 0xCF, 0xFE, 0xFF, 0xDF, 0xE7, 0x7D, 0x96, 0xDC, 0x65, 0xFD, 0x65, 0xFC, 0x65, 0xFC, 0x65, 
+0xFD, 0x65, 0xDC, 0x65, 0xFC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x5D, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 
+0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0xFD, 0x65, 0x1D, 0x66, 0xDC, 0x55, 0xDC, 0x55, 0x1C, 0x5E, 0xDC, 0x55, 0xFC, 0x5D, 0x1E, 0x66, 0x1D, 0x66, 0xBD, 0x65, 0xDD, 0x4D, 0x7D, 0xDF, 0xFF, 0xFF, 0xBF, 0xEF, 0x9B, 0x3D, 
+0xFC, 0x1C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 
+0xB6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0x9B, 0x0C, 0xDB, 0x14, 0x7D, 0x8E, 0xFF, 0xF7, 0xFF, 0xFF, 0x3E, 0xC7, 
+0xDB, 0x75, 0xFD, 0x6D, 0xDC, 0x5D, 0x1D, 0x66, 0xBC, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xDC, 0x5D, 0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 
+0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xDE, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFC, 0x5D, 0x3D, 0x66, 0xFD, 0x65, 0xFE, 0x65, 0xDE, 0x65, 0xFD, 0x65, 0x9C, 0x55, 0x9F, 0x8E, 
+0xFD, 0xFF, 0xFF, 0xFF, 0x1E, 0xA7, 0x1B, 0x25, 0xFA, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0x9B, 0x0C, 
+0x9C, 0x45, 0x9F, 0xD7, 0xFF, 0xFF, 0xDF, 0xEF, 0x9C, 0x96, 0xFD, 0x75, 0xDC, 0x5D, 0x1D, 0x5E, 0xBC, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 
+0xFC, 0x5D, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFE, 0x65, 0xDD, 0x65, 0xDC, 0x65, 0xBB, 0x65, 0xDC, 0x65, 0xDD, 0x65, 0xFD, 0x65, 
+0xDD, 0x65, 0xDC, 0x5D, 0xFC, 0x6D, 0x5F, 0xD7, 0xFF, 0xFF, 0xDF, 0xEF, 0xFE, 0x5D, 0xBC, 0x14, 0xDA, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0x5A, 0x0C, 
+0x39, 0x04, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0x9C, 0x0C, 0xBA, 0x0C, 
+0x9B, 0x0C, 0xBB, 0x0C, 0xFA, 0x14, 0x7B, 0x0C, 0xFB, 0x14, 0x9C, 0xAE, 0xBF, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xFC, 0x75, 0x1D, 0x66, 0xFC, 0x5D, 0xDD, 0x6D, 0xDD, 0x65, 0xDD, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0xDC, 0x5D, 0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 
+0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0x1C, 0x66, 0xDB, 0x5D, 0x1D, 0x66, 
+0xDD, 0x5D, 0xFD, 0x5D, 0xFD, 0x5D, 0x1C, 0x66, 0xFB, 0x65, 0xBC, 0x5D, 0x9E, 0x8E, 0xFE, 0xFF, 0xFF, 0xFF, 0x1C, 0xBF, 0x1E, 0x35, 0xBB, 0x14, 0x1B, 0x05, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0x9B, 0x0C, 0x5A, 0x0C, 0xF9, 0x03, 0xB8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xA5, 0xB6, 0x1B, 0x9A, 0x14, 0xDB, 0x0C, 0xBA, 0x0C, 
+0xBA, 0x04, 0xBB, 0x14, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x3C, 0x3D, 0x7F, 0xD7, 0xFE, 0xFF, 0xDE, 0xFF, 0xDE, 0xA6, 0xDD, 0x65, 0x1B, 0x5E, 
+0x1C, 0x5E, 0xBC, 0x65, 0xDC, 0x5D, 0xFD, 0x5D, 0xFC, 0x5D, 0xDC, 0x65, 0xDC, 0x6D, 0xDD, 0x65, 0xDD, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 
+0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0xFE, 0x65, 0xFC, 0x55, 0xFC, 0x65, 0xDC, 0x65, 0xBC, 0x65, 0xFC, 0x5D, 0xFC, 0x55, 0x1D, 0x6E, 0xDC, 0x6D, 0xBF, 0xDF, 0xFD, 0xFF, 0xBF, 0xF7, 0xFD, 0x65, 0xFC, 0x0C, 0x9C, 0x0C, 
+0xFA, 0x0C, 0xDB, 0x04, 0xDC, 0x0C, 0xBB, 0x0C, 0x7A, 0x0C, 0x19, 0x0C, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xB6, 0x1B, 0x7A, 0x14, 0x9A, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0x9A, 0x04, 0x9A, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x14, 0x5C, 0x76, 0xBF, 0xF7, 
+0xFF, 0xF7, 0xDF, 0xEF, 0x9D, 0x96, 0xBD, 0x55, 0xDC, 0x6D, 0xDC, 0x65, 0xDC, 0x65, 0xDD, 0x65, 0xFD, 0x65, 0xFC, 0x65, 0xDB, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 
+0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xBC, 0x5D, 0x1D, 0x76, 0xDC, 0x5D, 0xDE, 0x65, 0xFD, 0x65, 0x1B, 0x5E, 0x3D, 0x6E, 0xBD, 0x5D, 0x3F, 0xC7, 0xFF, 0xF7, 0xFF, 0xFF, 
+0x1F, 0xAF, 0xBA, 0x24, 0xBC, 0x0C, 0x1C, 0x05, 0xBA, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0x5A, 0x0C, 0x19, 0x04, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x0B, 0xD9, 0x0B, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0xB7, 0xAD, 0xB5, 0x1B, 0x39, 0x0C, 0x59, 0x0C, 0x79, 0x0C, 0xBB, 0x14, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x14, 0x99, 0x04, 0x3B, 0x25, 0xFE, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xD7, 0x3E, 0x8E, 0xBC, 0x6D, 0x1D, 0x66, 0xDC, 0x65, 0xBC, 0x65, 0xDC, 0x65, 0xFC, 0x5D, 0xFB, 0x5D, 0xDB, 0x5D, 
+0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFC, 0x6D, 0xFD, 0x55, 0xDE, 0x65, 0xBC, 0x65, 0x1D, 0x5E, 0xDD, 0x55, 0xBB, 0x4D, 
+0xBF, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xD7, 0x7C, 0x3D, 0xDC, 0x0C, 0x9B, 0x0C, 0x1B, 0x05, 0x7B, 0x0C, 0x5A, 0x0C, 0x19, 0x0C, 0xD9, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 
+0xB8, 0x0B, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0xB7, 0xAD, 0x95, 0x1B, 0xF8, 0x0B, 0xF8, 0x03, 0x18, 0x0C, 0x3A, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0x9A, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x14, 0x9C, 0x4D, 0x5E, 0xE7, 0xFE, 0xF7, 0xFF, 0xFF, 0x5D, 0xCF, 0x5D, 0x7E, 0xDB, 0x5D, 0xDC, 0x5D, 0xDD, 0x65, 
+0xDD, 0x5D, 0xDC, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xDC, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x65, 
+0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFC, 0x65, 0xFE, 0x65, 0xDD, 0x5D, 
+0xFD, 0x6D, 0xFD, 0x5D, 0xBD, 0x45, 0x9E, 0x9E, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xEF, 0xFC, 0x65, 0xDB, 0x0C, 0xDC, 0x0C, 0xFB, 0x0C, 0x59, 0x0C, 0x3A, 0x04, 0xF9, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xD8, 0x0B, 0xD9, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0xB7, 0xAD, 0x95, 0x1B, 0xD8, 0x0B, 0xD7, 0x03, 0xD7, 0x03, 
+0xD8, 0x03, 0x39, 0x0C, 0x59, 0x0C, 0x7A, 0x0C, 0x9A, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBA, 0x04, 0xBA, 0x04, 0xBD, 0x04, 0x99, 0x14, 0x9A, 0x14, 0xFC, 0x5D, 0x9F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x7D, 0xC7, 0x1C, 0x76, 0xFC, 0x6D, 0xFD, 0x5D, 0xFD, 0x5D, 0xDD, 0x65, 0xBC, 0x65, 0xDC, 0x65, 0xFC, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 
+0xDC, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xFD, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 
+0xDC, 0x65, 0xDE, 0x55, 0xFC, 0x6D, 0x1C, 0x6E, 0xFE, 0x55, 0x9D, 0x55, 0x7D, 0x9E, 0xDF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0x7D, 0x86, 0xDA, 0x1C, 0x9A, 0x0C, 0x79, 0x0C, 0x59, 0x04, 0xF9, 0x13, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD9, 0x0B, 0xD9, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xFE, 0xFF, 0x5D, 0xE7, 0x97, 0xAD, 
+0xB6, 0x23, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0x19, 0x0C, 0x39, 0x0C, 0x7A, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBB, 0x04, 0xDC, 0x0C, 0x99, 0x04, 
+0xFB, 0x0C, 0x3E, 0x8E, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xBF, 0x5C, 0x8E, 0xBA, 0x5D, 0xBB, 0x5D, 0xDD, 0x65, 0xBD, 0x6D, 0xBC, 0x65, 0xFD, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 
+0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xDC, 0x5D, 0xDC, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 
+0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x65, 0xDC, 0x5D, 0xDC, 0x65, 0xBC, 0x55, 0xBE, 0x9E, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xBF, 0xA6, 0x99, 0x14, 0x7B, 0x0C, 
+0xF8, 0x03, 0x37, 0x0C, 0x97, 0x03, 0xF9, 0x0B, 0x97, 0x0B, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xF9, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xFE, 0xFF, 0x3C, 0xE7, 0x97, 0xAD, 0xB6, 0x23, 0xB8, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 0x98, 0x03, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0x19, 0x0C, 0x59, 0x0C, 
+0x7A, 0x0C, 0xB9, 0x14, 0xDD, 0x04, 0xBA, 0x04, 0x9A, 0x14, 0xDB, 0x14, 0x7E, 0x96, 0xBF, 0xDF, 0xDF, 0xFF, 0xFF, 0xFF, 0x3E, 0xCF, 0x3C, 0x96, 0xDB, 0x75, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 
+0xDD, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xDC, 0x5D, 
+0xDC, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDB, 0x5D, 0xFE, 0x6D, 0xDC, 0x65, 0xDC, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xEF, 
+0x3F, 0xAF, 0xBA, 0x3C, 0xD8, 0x03, 0xD9, 0x03, 0xF8, 0x03, 0xB7, 0x0B, 0xB9, 0x13, 0x98, 0x03, 0xD8, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 
+0xD8, 0x0B, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x97, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0x58, 0x0C, 0x38, 0x0C, 0x5C, 0x0C, 0x9B, 0x0C, 0xB9, 0x04, 0xFA, 0x0C, 0x3C, 0x96, 0xBF, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xBF, 0xDF, 
+0xDE, 0x9E, 0x1C, 0x6E, 0xFB, 0x5D, 0xFC, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x5D, 0xDC, 0x5D, 0xFC, 0x65, 
+0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xFC, 0x65, 0xDC, 0x5D, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xFD, 0x55, 0x1D, 0x76, 0x5F, 0xCF, 
+0xFF, 0xF7, 0xDD, 0xFF, 0xDF, 0xFF, 0x7E, 0xA6, 0x37, 0x34, 0xF9, 0x0B, 0xB9, 0x13, 0xD8, 0x03, 0xD8, 0x03, 0x78, 0x0B, 0xD9, 0x03, 0xF9, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 
+0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x3D, 0xE7, 0x96, 0xAD, 0xB6, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x77, 0x03, 0xD8, 0x0B, 0xD8, 0x03, 0x18, 0x04, 0x59, 0x14, 0x38, 0x0C, 0x9A, 0x24, 
+0xBE, 0x4D, 0xBE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0x3E, 0xCF, 0x5C, 0x8E, 0xDC, 0x65, 0xDE, 0x5D, 0xDC, 0x5D, 0xDC, 0x5D, 0xDC, 0x65, 0xBC, 0x65, 0xBC, 0x65, 0xBD, 0x65, 0xDD, 0x65, 
+0xDE, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xDC, 0x65, 0xBC, 0x65, 0xDC, 0x5D, 0xFD, 0x65, 0xDC, 0x65, 0xBB, 0x65, 0xBB, 0x65, 0xDB, 0x6D, 0x9B, 0x65, 
+0x9B, 0x5D, 0x5C, 0x9E, 0xDF, 0xE7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xEF, 0xFB, 0x85, 0xB7, 0x13, 0xFA, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0xB7, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xD8, 0x0B, 0xB7, 0x03, 
+0xB7, 0x03, 0xD8, 0x03, 0x97, 0x03, 0x96, 0x03, 0x18, 0x14, 0x5A, 0x5D, 0xFE, 0xB6, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xF7, 0xBF, 0xDF, 0xFE, 0xAE, 0x1B, 0x8E, 0xBB, 0x65, 0xBC, 0x65, 0xDC, 0x5D, 
+0xFD, 0x5D, 0xFD, 0x5D, 0xFC, 0x5D, 0xDB, 0x5D, 0xDB, 0x5D, 0xFC, 0x5D, 0xFC, 0x5D, 0xDC, 0x5D, 0xDC, 0x5D, 0xDC, 0x5D, 0xDC, 0x5D, 0xDC, 0x5D, 0xDC, 0x5D, 0xDC, 0x5D, 0x9B, 0x5D, 0xBC, 0x5D, 
+0xFE, 0x65, 0xBD, 0x5D, 0x5A, 0x65, 0x3C, 0x96, 0x9F, 0xCF, 0xFF, 0xF7, 0xBD, 0xF7, 0xFE, 0xFF, 0x7F, 0xD7, 0x5B, 0x5D, 0xF9, 0x0B, 0xD9, 0x0B, 0x96, 0x13, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0x97, 0xAD, 0x5C, 0xEF, 
+0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0x77, 0x03, 0x17, 0x24, 0x1C, 0x86, 0xBF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBE, 0xDF, 0x3E, 0xB7, 0x9C, 0x9E, 0xFB, 0x75, 0xBB, 0x65, 0xBC, 0x5D, 0xBC, 0x5D, 0xDC, 0x65, 0xFC, 0x6D, 0xBC, 0x65, 0xBC, 0x65, 0xBC, 0x65, 0x9C, 0x65, 0x7B, 0x65, 0x7B, 0x5D, 0x7B, 0x5D, 
+0x7B, 0x5D, 0x5A, 0x65, 0x7B, 0x65, 0x9C, 0x65, 0x9B, 0x6D, 0x3C, 0x9E, 0x7F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xEF, 0x9D, 0xA6, 0x99, 0x3C, 0x98, 0x03, 0xB9, 0x03, 0xD9, 0x03, 
+0x97, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB5, 0x1B, 0x97, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB8, 0x0B, 0x98, 0x0B, 0x97, 0x03, 0x98, 0x0B, 0xB8, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 0xB7, 0x03, 0xD7, 0x13, 
+0xFA, 0x54, 0x7D, 0xA6, 0x5E, 0xDF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xEF, 0x1E, 0xD7, 0xBE, 0xB6, 0x3C, 0x96, 0xDB, 0x7D, 0x9A, 0x6D, 0x9A, 0x65, 0x7B, 0x65, 0x7C, 0x65, 0x7B, 0x6D, 
+0x5B, 0x6D, 0x5B, 0x6D, 0x5B, 0x6D, 0x7B, 0x75, 0x9B, 0x75, 0xFC, 0x85, 0x3B, 0x9E, 0xFC, 0xCE, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xFF, 0x9C, 0xB6, 0x5A, 0x6D, 0xF8, 0x13, 
+0xB8, 0x03, 0xF7, 0x0B, 0xB6, 0x13, 0x97, 0x03, 0xFA, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0xB7, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0x95, 0x23, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 
+0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x0B, 0x98, 0x0B, 0x77, 0x03, 0x77, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0xD8, 0x03, 0x97, 0x03, 0x77, 0x0B, 0x76, 0x0B, 0xB7, 0x13, 0xDA, 0x44, 0x7E, 0xA6, 0x7F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9F, 0xEF, 0x3F, 0xDF, 
+0xFF, 0xCE, 0xDD, 0xB6, 0xBC, 0xB6, 0xBC, 0xB6, 0xBC, 0xB6, 0xBC, 0xB6, 0xFD, 0xC6, 0x3E, 0xCF, 0x7F, 0xD7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xDE, 0xB6, 
+0x39, 0x65, 0x59, 0x2C, 0xD8, 0x13, 0x98, 0x03, 0xB8, 0x03, 0xD7, 0x0B, 0xD7, 0x13, 0xB8, 0x0B, 0x98, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0xB7, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0xB6, 0xAD, 
+0xB6, 0x23, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x77, 0x03, 0x97, 0x03, 
+0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0x96, 0x03, 0xD8, 0x13, 0x97, 0x0B, 0x98, 0x03, 0xF9, 0x03, 0xB8, 0x03, 0xB6, 0x13, 0x59, 0x44, 0xBA, 0x8D, 0xDD, 0xB6, 0xDF, 0xE7, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0x3E, 0xC7, 0xDB, 0x7D, 0xDA, 0x3C, 0x38, 0x1C, 0xB7, 0x03, 0x97, 0x03, 0xB8, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0xD8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x23, 0xB7, 0xAD, 0x5C, 0xEF, 
+0xDE, 0xF7, 0xDE, 0xFF, 0x7D, 0xEF, 0xB7, 0xAD, 0xB6, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB8, 0x0B, 0xD9, 0x03, 0x98, 0x03, 0x76, 0x03, 0x97, 0x03, 0xD8, 0x0B, 
+0xB9, 0x03, 0xD9, 0x03, 0xF8, 0x0B, 0x58, 0x2C, 0x39, 0x65, 0x5C, 0x9E, 0x3E, 0xCF, 0x9F, 0xE7, 0x7E, 0xEF, 0x9F, 0xEF, 0x9F, 0xEF, 0x9F, 0xEF, 0x9F, 0xEF, 0x9F, 0xEF, 0x7E, 0xE7, 0x5E, 0xE7, 
+0x3D, 0xDF, 0x7C, 0xA6, 0x7A, 0x75, 0x98, 0x44, 0x17, 0x24, 0xD7, 0x13, 0xB7, 0x03, 0xD9, 0x03, 0x1A, 0x04, 0xF8, 0x13, 0xB7, 0x03, 0x98, 0x03, 0xD8, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xD8, 0x0B, 
+0xD8, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xD6, 0x23, 0xD7, 0xAD, 0x7C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x7D, 0xEF, 0xD7, 0xB5, 0xD6, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x77, 0x03, 0xB8, 0x0B, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB9, 0x0B, 0x77, 0x03, 0x96, 0x03, 
+0xD7, 0x0B, 0x98, 0x0B, 0x98, 0x03, 0xB7, 0x0B, 0xB6, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x98, 0x0B, 0x98, 0x03, 0x98, 0x03, 0x98, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x96, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xB7, 0x0B, 0x96, 0x13, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x0B, 
+0xB8, 0x13, 0xD8, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0x96, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xF6, 0x2B, 0xD8, 0xB5, 0x9D, 0xEF, 0xFF, 0xF7, 0xFF, 0xF7, 0x9E, 0xF7, 0x59, 0xBE, 0x14, 0x3C, 0x77, 0x03, 0xB8, 0x13, 0xD6, 0x13, 
+0x99, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x35, 0x03, 0x91, 0x0A, 0xD2, 0x02, 0x92, 0x02, 0xB2, 0x0A, 0xD1, 0x02, 0x71, 0x02, 0xF3, 0x02, 0xD2, 0x02, 0xD3, 0x02, 0xB2, 0x02, 0xB2, 0x0A, 0x90, 0x02, 0xB9, 0x03, 0xD8, 0x0B, 
+0xB7, 0x0B, 0xB8, 0x0B, 0x98, 0x0B, 0x97, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0x97, 0x03, 0xB8, 0x0B, 0x98, 0x03, 0x77, 0x0B, 0x98, 0x03, 0xB7, 0x0B, 0xD9, 0x03, 0xD7, 0x0B, 0xB9, 0x03, 0x97, 0x0B, 
+0xB9, 0x0B, 0x79, 0x0B, 0xD8, 0x0B, 0xF8, 0x0B, 0xB8, 0x03, 0x19, 0x0C, 0xF8, 0x03, 0x96, 0x03, 0x98, 0x13, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0x97, 0x03, 0xD8, 0x0B, 0xB8, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xF3, 0x53, 0x7C, 0xB6, 0x9E, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0xDA, 0xD6, 
+0x95, 0x64, 0x97, 0x0B, 0x97, 0x03, 0x96, 0x13, 0xD9, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xE5, 0x00, 0xCF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xDD, 0xFF, 0xFE, 0xFF, 0xDE, 0xF7, 
+0xC8, 0x41, 0x00, 0x00, 0xB5, 0x0B, 0xD7, 0x0B, 0x77, 0x0B, 0x97, 0x03, 0x96, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0xD7, 0x0B, 0xB7, 0x03, 0xD7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xD8, 0x0B, 
+0xB7, 0x0B, 0x76, 0x03, 0x97, 0x13, 0xD8, 0x13, 0xB7, 0x03, 0xB7, 0x03, 0xB6, 0x03, 0xD7, 0x0B, 0xB8, 0x13, 0x97, 0x13, 0xB6, 0x0B, 0xF7, 0x0B, 0xD7, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB6, 0x0B, 0x95, 0x6C, 0xDC, 0xC6, 0xBE, 0xF7, 
+0xDE, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x3C, 0xEF, 0x57, 0x95, 0xB5, 0x13, 0x77, 0x03, 0x77, 0x0B, 0xD7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x07, 0x01, 0xF3, 0xA4, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xDE, 0xF7, 0x0D, 0x63, 0x00, 0x00, 0x96, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0x97, 0x0B, 0xD9, 0x13, 0x77, 0x0B, 0x56, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x77, 0x03, 
+0x97, 0x0B, 0xB7, 0x03, 0x76, 0x03, 0xB8, 0x03, 0x76, 0x0B, 0x99, 0x03, 0xB7, 0x13, 0xD8, 0x03, 0x96, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xD8, 0x03, 0xB9, 0x03, 0xB8, 0x03, 0x96, 0x03, 0xD8, 0x0B, 
+0x98, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xF7, 0x13, 0xB7, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 
+0xB5, 0x1B, 0x77, 0x9D, 0x3D, 0xDF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xF7, 0x3A, 0xBE, 0xB4, 0x33, 0x97, 0x03, 0xB8, 0x03, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x27, 0x01, 0x44, 0x29, 0x8D, 0x73, 
+0x8E, 0x6B, 0xCB, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xC5, 0x0D, 0x5B, 0x6D, 0x6B, 0x6B, 0x83, 0xA2, 0x10, 0x00, 0x00, 0xD9, 0x0B, 0xB8, 0x03, 0x76, 0x03, 0x76, 0x03, 0x97, 0x03, 0xB7, 0x0B, 
+0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB8, 0x03, 0xD7, 0x13, 0x98, 0x03, 0x76, 0x0B, 0x76, 0x03, 0xD7, 0x0B, 0xB7, 0x0B, 0x97, 0x0B, 0x77, 0x0B, 
+0x78, 0x0B, 0x98, 0x13, 0x56, 0x0B, 0x96, 0x0B, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB6, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 
+0x96, 0x0B, 0x97, 0x03, 0xFA, 0x03, 0x97, 0x03, 0x93, 0x2B, 0x39, 0xC6, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x9D, 0xF7, 0xFB, 0xD6, 0x75, 0x6C, 0x76, 0x0B, 0xF9, 0x03, 
+0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x26, 0x01, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x21, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xD2, 0x94, 0x00, 0x08, 0x00, 0x00, 0x21, 0x00, 0x21, 0x00, 0x00, 0x00, 0xB8, 0x13, 0x97, 0x03, 
+0x76, 0x03, 0x97, 0x03, 0x56, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x35, 0x03, 0x77, 0x03, 0x76, 0x03, 0x97, 0x03, 0x36, 0x03, 0x98, 0x03, 0x77, 0x03, 0xD9, 0x03, 0x77, 0x03, 0x78, 0x03, 0xB8, 0x13, 
+0x77, 0x03, 0x76, 0x03, 0x55, 0x03, 0x76, 0x03, 0xF9, 0x03, 0xD8, 0x03, 0x96, 0x03, 0x96, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0x96, 0x0B, 0xB8, 0x03, 0xD9, 0x03, 0x77, 0x03, 0xB8, 0x0B, 0xFA, 0x0B, 0x55, 0x13, 0x96, 0x5C, 0xDA, 0xDE, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xDF, 0xF7, 
+0x7D, 0xE7, 0xB8, 0xA5, 0x73, 0x23, 0xD7, 0x03, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB9, 0x03, 0xF8, 0x0B, 0x97, 0x0B, 0xD6, 0x1B, 0x2C, 0x12, 0xBF, 0xF7, 0xFF, 0xFF, 0xB1, 0xA4, 0x65, 0x00, 0xB5, 0x13, 0xD7, 0x0B, 
+0x48, 0x09, 0x6B, 0x8B, 0x4D, 0x5B, 0x60, 0x00, 0x00, 0x08, 0x2C, 0x6B, 0xCF, 0x7B, 0x21, 0x08, 0x10, 0x84, 0x9E, 0xF7, 0x71, 0x8C, 0xEB, 0x5A, 0x5D, 0xEF, 0xBB, 0xDE, 0xE4, 0x10, 0x20, 0x00, 
+0x4A, 0x2A, 0x65, 0x21, 0x77, 0x9D, 0x3C, 0xE7, 0x5D, 0xEF, 0x75, 0xB5, 0xA6, 0x41, 0x41, 0x00, 0x50, 0x13, 0xF7, 0x03, 0xB8, 0x03, 0xFA, 0x0B, 0x58, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB8, 0x03, 0xD9, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0x97, 0x0B, 0x94, 0x33, 0xB8, 0x9D, 0x5C, 0xEF, 0xDE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xBA, 0xD6, 0x75, 0x64, 0x96, 0x13, 0x76, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB6, 0x13, 0x95, 0x03, 0x98, 0x0B, 0x96, 0x03, 0x0C, 0x0A, 0xFF, 0xFF, 0xFF, 0xF7, 
+0x72, 0x8C, 0x43, 0x08, 0x74, 0x0B, 0xF8, 0x03, 0xC9, 0x29, 0xBE, 0xFF, 0xFF, 0xFF, 0x23, 0x19, 0x21, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x52, 0xDA, 0xD6, 0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 
+0xFE, 0xF7, 0xDF, 0xFF, 0xB6, 0xB5, 0x00, 0x00, 0xC7, 0x31, 0xDB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xFC, 0xEE, 0x25, 0x29, 0x29, 0x01, 0x76, 0x13, 0x78, 0x0B, 0x56, 0x0B, 
+0xD6, 0x13, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x0B, 0x75, 0x13, 0x95, 0x64, 
+0x9A, 0xCE, 0x9D, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xBE, 0xFF, 0x5C, 0xEF, 0xF9, 0xA5, 0xB6, 0x33, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x96, 0x0B, 0xB7, 0x03, 0xB9, 0x03, 
+0xD9, 0x03, 0xEB, 0x01, 0xFF, 0xFF, 0xFE, 0xFF, 0xD2, 0x9C, 0xA6, 0x00, 0xD8, 0x13, 0xB8, 0x03, 0xE7, 0x31, 0xFF, 0xF7, 0xDF, 0xF7, 0x03, 0x21, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0x4A, 
+0xBB, 0xD6, 0xBF, 0xF7, 0xFF, 0xFF, 0x1C, 0xE7, 0xFB, 0xDE, 0xFF, 0xFF, 0x7D, 0xEF, 0x21, 0x00, 0xF3, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xA5, 0x33, 0x9D, 0x7D, 0xDF, 0xDD, 0xFF, 0x44, 0x31, 
+0x48, 0x01, 0xB7, 0x0B, 0xD9, 0x03, 0xD8, 0x03, 0xB6, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB6, 0x0B, 
+0xB8, 0x03, 0xB7, 0x0B, 0xD5, 0x2B, 0xF9, 0xA5, 0x5B, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0x1C, 0xD7, 0x78, 0x85, 
+0x51, 0x2B, 0x97, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0x97, 0x0B, 0x96, 0x13, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0xB7, 0x0B, 0x98, 0x03, 0xB7, 0x0B, 0xB6, 0x03, 0xEC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x84, 0xA3, 0x00, 0xD8, 0x0B, 0xB8, 0x03, 0xE8, 0x29, 0xFF, 0xF7, 0xFF, 0xFF, 0xE5, 0x10, 
+0x41, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0x4A, 0x99, 0xCE, 0xFF, 0xFF, 0xBE, 0xF7, 0x0C, 0x5B, 0xB2, 0x94, 0xFF, 0xFF, 0xDE, 0xF7, 0x61, 0x08, 0x9D, 0xEF, 0xDF, 0xF7, 0xF3, 0x9C, 0x0C, 0x63, 
+0xF3, 0x9C, 0x5C, 0xF7, 0x35, 0x9D, 0x82, 0x08, 0xE6, 0x00, 0xB8, 0x03, 0x95, 0x0B, 0x96, 0x0B, 0x98, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0x96, 0x0B, 0x96, 0x13, 0xB7, 0x13, 0xB7, 0x0B, 0xB7, 0x03, 
+0xD9, 0x03, 0xD8, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xB6, 0x23, 0x38, 0x85, 0xFB, 0xDE, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0x9E, 0xEF, 0x5A, 0xB6, 0xB5, 0x6C, 0xB6, 0x13, 0x76, 0x0B, 0x97, 0x03, 0xD8, 0x0B, 0x96, 0x0B, 0x55, 0x03, 0x77, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0x96, 0x0B, 0xB8, 0x03, 0xB7, 0x0B, 0x96, 0x03, 0x2D, 0x02, 0xFF, 0xFF, 0xBE, 0xFF, 0xB2, 0x94, 0x62, 0x00, 0x76, 0x03, 0x76, 0x03, 
+0xE8, 0x31, 0xDF, 0xFF, 0xDD, 0xFF, 0x44, 0x31, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0x4A, 0xBA, 0xD6, 0xDF, 0xFF, 0xFC, 0xE6, 0xA2, 0x10, 0xB3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0x08, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0xDF, 0xFF, 0x79, 0xCE, 0x88, 0x42, 0x41, 0x00, 0x00, 0x00, 0x07, 0x09, 0x99, 0x03, 0xD8, 0x13, 0x97, 0x03, 0xD9, 0x03, 0x76, 0x03, 0xB8, 0x0B, 0xD8, 0x03, 
+0x98, 0x03, 0x98, 0x03, 0xB8, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xF9, 0x03, 0xB8, 0x03, 0x75, 0x1B, 0x95, 0x64, 0x39, 0xBE, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x5D, 0xE7, 0x59, 0xBE, 0x36, 0x44, 0x95, 0x1B, 0x77, 0x0B, 0xB8, 0x0B, 0x96, 0x0B, 0xB6, 0x13, 0xD7, 0x13, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x96, 0x0B, 0x96, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x76, 0x0B, 0xB8, 0x03, 0x97, 0x03, 0xD7, 0x03, 0x2E, 0x02, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xD3, 0x8C, 0x84, 0x00, 0x77, 0x0B, 0xB7, 0x13, 0xA6, 0x31, 0x7F, 0xDF, 0xDE, 0xFF, 0x65, 0x29, 0x86, 0x19, 0xFE, 0xFF, 0xBD, 0xF7, 0xA9, 0x4A, 0x78, 0xCE, 0xFF, 0xFF, 0x1A, 0xDF, 0x20, 0x00, 
+0xB1, 0x8C, 0xDE, 0xF7, 0xFE, 0xFF, 0x81, 0x08, 0xFF, 0xFF, 0xFE, 0xFF, 0xFA, 0xD6, 0x48, 0x42, 0x20, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x98, 0x03, 0x76, 0x03, 0xF8, 0x13, 
+0x55, 0x0B, 0x96, 0x0B, 0x97, 0x03, 0x98, 0x03, 0xB8, 0x03, 0xF9, 0x03, 0xD8, 0x03, 0x97, 0x03, 0x76, 0x03, 0xD8, 0x0B, 0x98, 0x03, 0x96, 0x13, 0x75, 0x64, 0x17, 0xBE, 0x5C, 0xEF, 0xDF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0x5C, 0xE7, 0x19, 0xAE, 0x54, 0x5C, 0x54, 0x13, 
+0x97, 0x03, 0xB8, 0x03, 0x97, 0x03, 0x77, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x96, 0x0B, 0xB8, 0x0B, 0x76, 0x03, 
+0xD7, 0x0B, 0x0C, 0x02, 0xBF, 0xFF, 0xDE, 0xFF, 0x90, 0x9C, 0x40, 0x08, 0xB9, 0x03, 0x77, 0x03, 0x89, 0x09, 0xBA, 0xD6, 0xFF, 0xFF, 0xDC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0x4A, 
+0x59, 0xC6, 0xFF, 0xFF, 0xBB, 0xD6, 0x00, 0x00, 0x35, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x96, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xFF, 0xDE, 0xFF, 0x64, 0x31, 
+0x06, 0x01, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0x77, 0x0B, 0x97, 0x03, 0xB7, 0x0B, 0x96, 0x0B, 0x76, 0x0B, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0xD8, 0x0B, 0xB8, 0x0B, 0x54, 0x13, 0x54, 0x5C, 
+0x18, 0xBE, 0x5C, 0xEF, 0xDF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xF7, 0x5C, 0xEF, 0x19, 0xB6, 0x96, 0x64, 0xB5, 0x23, 0x77, 0x03, 0x98, 0x03, 0x98, 0x03, 0xB8, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x96, 0x03, 0xB8, 0x0B, 0x76, 0x0B, 0x97, 0x03, 0x2E, 0x02, 0x56, 0xA5, 0x7A, 0xD6, 0x4C, 0x63, 0xA2, 0x08, 0x77, 0x03, 0xB7, 0x0B, 0xA3, 0x08, 0x4D, 0x6B, 0x7F, 0xE7, 0xDF, 0xF7, 
+0xFF, 0xFF, 0x7D, 0xEF, 0xFF, 0xFF, 0x49, 0x4A, 0xAF, 0x7B, 0xBB, 0xDE, 0x14, 0xA5, 0x00, 0x00, 0x6D, 0x6B, 0xFB, 0xE6, 0x55, 0xAD, 0x20, 0x00, 0x45, 0x29, 0xD7, 0xBD, 0x9E, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xDF, 0x14, 0x9D, 0x61, 0x10, 0x28, 0x01, 0xB9, 0x0B, 0x77, 0x03, 0xD9, 0x03, 0xB7, 0x03, 0x97, 0x03, 0xB8, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x0B, 0xB8, 0x0B, 0x97, 0x0B, 
+0x77, 0x03, 0xB6, 0x23, 0x95, 0x6C, 0x18, 0xC6, 0x5C, 0xEF, 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x9D, 0xEF, 0x9A, 0xC6, 0xF6, 0x7C, 0xF5, 0x43, 0x95, 0x1B, 0x76, 0x03, 0x77, 0x03, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x98, 0x03, 0x96, 0x13, 0x76, 0x03, 0x2D, 0x02, 0xA3, 0x08, 0x66, 0x29, 0x81, 0x00, 0x82, 0x00, 0xD7, 0x0B, 0x97, 0x03, 
+0x82, 0x00, 0x20, 0x08, 0xC7, 0x41, 0x49, 0x42, 0x6A, 0x4A, 0xC6, 0x31, 0x48, 0x42, 0xC2, 0x10, 0x40, 0x00, 0x65, 0x29, 0x81, 0x08, 0x60, 0x00, 0x40, 0x00, 0x24, 0x21, 0xE2, 0x10, 0x00, 0x00, 
+0x20, 0x00, 0x81, 0x08, 0x07, 0x3A, 0xAA, 0x52, 0x48, 0x42, 0x85, 0x21, 0x40, 0x08, 0x20, 0x00, 0x07, 0x01, 0x76, 0x0B, 0x96, 0x13, 0xB8, 0x03, 0x56, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xB8, 0x03, 
+0xD9, 0x03, 0xD9, 0x03, 0x76, 0x0B, 0x75, 0x13, 0xD5, 0x2B, 0x17, 0x7D, 0x7A, 0xC6, 0x7C, 0xF7, 0xBF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x7D, 0xEF, 0xFB, 0xDE, 0xB7, 0xA5, 0x54, 0x64, 0x94, 0x33, 
+0x75, 0x1B, 0x96, 0x13, 0x96, 0x0B, 0x96, 0x0B, 0x97, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x98, 0x03, 0x77, 0x03, 0x96, 0x13, 0x95, 0x0B, 0x6E, 0x0A, 0x00, 0x00, 0x00, 0x00, 
+0x40, 0x00, 0x62, 0x00, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x00, 0x00, 0x01, 0x00, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x63, 0x00, 0x11, 0x1B, 0xB7, 0x03, 0xF7, 0x13, 0x79, 0x03, 
+0x99, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x95, 0x13, 0x93, 0x2B, 0x95, 0x64, 0xF9, 0xA5, 0xDB, 0xDE, 0x9E, 0xF7, 0xDF, 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 
+0xBE, 0xF7, 0x3B, 0xEF, 0xDB, 0xD6, 0xD9, 0x9D, 0x96, 0x5C, 0xB6, 0x1B, 0xB6, 0x13, 0x96, 0x13, 0x96, 0x0B, 0x76, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x96, 0x0B, 0x97, 0x0B, 0x76, 0x0B, 
+0xB8, 0x03, 0xB8, 0x03, 0xB6, 0x23, 0x97, 0x13, 0x97, 0x03, 0xB8, 0x03, 0xD7, 0x13, 0x55, 0x0B, 0x97, 0x0B, 0x77, 0x03, 0xB9, 0x03, 0x98, 0x03, 0xB6, 0x0B, 0xB7, 0x0B, 0x76, 0x03, 0xB7, 0x0B, 
+0xB7, 0x0B, 0x76, 0x03, 0xB7, 0x0B, 0xD7, 0x0B, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0x76, 0x03, 0xB7, 0x0B, 0x76, 0x03, 0xB7, 0x13, 0x77, 0x0B, 
+0x98, 0x03, 0xB9, 0x03, 0x75, 0x13, 0x97, 0x03, 0x75, 0x0B, 0x96, 0x03, 0xB7, 0x13, 0x95, 0x1B, 0xB4, 0x2B, 0x95, 0x64, 0xB8, 0x9D, 0xBA, 0xD6, 0x5B, 0xEF, 0x9D, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0x19, 0xBE, 0x57, 0x9D, 0x75, 0x6C, 0xF4, 0x43, 0xB4, 0x2B, 0x95, 0x23, 0x95, 0x1B, 
+0x94, 0x1B, 0x1F, 0x80, 0x74, 0x1B, 0x33, 0x00, 0x94, 0x1B, 0x94, 0x1B, 0x94, 0x1B, 0x94, 0x1B, 0x74, 0x1B, 0x94, 0x1B, 0xB5, 0x23, 0xD5, 0x23, 0xD3, 0x4B, 0x74, 0x6C, 0x57, 0x9D, 0x59, 0xC6, 
+0xDA, 0xDE, 0x5C, 0xEF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 
+0x9C, 0xF7, 0x3B, 0xE7, 0xBA, 0xCE, 0x59, 0xBE, 0x19, 0xB6, 0xD8, 0xB5, 0xB7, 0xB5, 0x97, 0xB5, 0x1F, 0x80, 0x97, 0xAD, 0x33, 0x00, 0x77, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 
+0x97, 0xAD, 0xB7, 0xB5, 0xD8, 0xB5, 0x7B, 0xB6, 0xDC, 0xC6, 0x3D, 0xDF, 0x7D, 0xEF, 0x9D, 0xF7, 0xBE, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xDF, 0xF7, 0xBF, 0xF7, 0x9E, 0xEF, 0x7E, 0xEF, 0x5D, 0xEF, 0x5C, 0xE7, 0x3B, 0xE7, 0x1F, 0x80, 
+0x5C, 0xEF, 0x09, 0x00, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x9D, 0xF7, 0xBE, 0xF7, 0xDE, 0xF7, 0x27, 0x80, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF7, 
+0x14, 0x00, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+};
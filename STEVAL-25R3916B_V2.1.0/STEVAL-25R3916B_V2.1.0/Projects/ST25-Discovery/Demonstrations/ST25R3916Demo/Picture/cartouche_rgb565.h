@@ -0,0 +1,55 @@
+/* 304x44 RGB565 RLE picture converted from cartouche_jpg.h by pict2rgb565, 1626 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char cartouche[] = {
+0x52, 0x35, 0x36, 0x35, 0x01, 0x00, 0x30, 0x01, 0x2C, 0x00, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x0F, 0x81, 0xFF, 0xFF, 0x1F, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x75, 0xAD, 0xD3, 0x9C, 0x75, 0xAD, 0x55, 0xAD, 0xB2, 0x94, 0xF3, 0x9C, 0x55, 0xAD, 0x0F, 0x81, 0x14, 0xA5, 0x1F, 0x00, 0x55, 0xAD, 
+0xF3, 0x9C, 0xB2, 0x94, 0x55, 0xAD, 0x75, 0xAD, 0xD3, 0x9C, 0x75, 0xAD, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xB2, 0x94, 0x96, 0xB5, 0xF3, 0x9C, 0x14, 0xA5, 0x34, 0xA5, 0x34, 0xA5, 0xB2, 0x94, 0x55, 0xAD, 0x75, 0xAD, 0xF3, 0x9C, 0x0F, 0x81, 
+0x14, 0xA5, 0x1E, 0x00, 0xF3, 0x9C, 0x75, 0xAD, 0x55, 0xAD, 0xB2, 0x94, 0x34, 0xA5, 0x34, 0xA5, 0x14, 0xA5, 0xF3, 0x9C, 0x96, 0xB5, 0xB2, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x55, 0xAD, 0xD3, 0x9C, 0x75, 0xAD, 0x92, 0x94, 0x55, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9E, 0xF7, 0x11, 0x81, 0xFF, 0xFF, 0x1E, 0x00, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0x92, 0x94, 0x75, 0xAD, 0xD3, 0x9C, 0x55, 0xAD, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x92, 0x94, 0x55, 0xAD, 0x14, 0xA5, 0x75, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x0F, 0x81, 0xFF, 0xFF, 0x1D, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x75, 0xAD, 0x14, 0xA5, 
+0x34, 0xA5, 0x92, 0x94, 0xDF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0xD7, 0xBD, 0x34, 0xA5, 0xD3, 0x9C, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0xBE, 0xF7, 0x13, 0x81, 0xFF, 0xFF, 0x1D, 0x00, 0xBE, 0xF7, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xD3, 0x9C, 0x34, 0xA5, 
+0xD7, 0xBD, 0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x94, 0x55, 0xAD, 0x92, 0x94, 0xF3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x0F, 0x81, 0xFF, 0xFF, 0x1D, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9C, 0x92, 0x94, 0x55, 0xAD, 0x92, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0x55, 0xAD, 0xF3, 0x9C, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0x13, 0x81, 0xFF, 0xFF, 0x13, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9C, 0x55, 0xAD, 0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF3, 0x9C, 0x96, 0xB5, 0xFF, 0xFF, 0xDF, 0xFF, 0x23, 0x81, 0xFF, 0xFF, 0x0C, 0x00, 
+0xDF, 0xFF, 0xDF, 0xFF, 0x96, 0xB5, 0xF3, 0x9C, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x14, 0xA5, 0x92, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x21, 0x81, 0xFF, 0xFF, 0x0D, 0x00, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x94, 0x14, 0xA5, 0x96, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x94, 0x55, 0xAD, 0x55, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x21, 0x81, 0xFF, 0xFF, 
+0x0E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0x55, 0xAD, 0x92, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x34, 0xA5, 0x9E, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x1F, 0x81, 0xFF, 0xFF, 0x0D, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0x9E, 0xF7, 0x34, 0xA5, 0x55, 0xAD, 0xFF, 0xFF, 0xBE, 0xF7, 0x55, 0xAD, 0xD3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9E, 0xF7, 0x23, 0x81, 0xFF, 0xFF, 0x08, 0x00, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x9C, 0x55, 0xAD, 0xBE, 0xF7, 0xFF, 0xFF, 0xF3, 0x9C, 0xF3, 0x9C, 0x29, 0x81, 0xFF, 0xFF, 0x06, 0x00, 
+0xF3, 0x9C, 0xF3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9C, 0x34, 0xA5, 0xBE, 0xF7, 0x27, 0x81, 0xFF, 0xFF, 0x0A, 0x00, 0xDF, 0xFF, 0x34, 0xA5, 0xF3, 0x9C, 0xFF, 0xFF, 0xDF, 0xFF, 0x75, 0xAD, 
+0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x21, 0x81, 0xFF, 0xFF, 0x09, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x14, 0xA5, 0x75, 0xAD, 0xDF, 0xFF, 0xFF, 0xFF, 
+0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 
+0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 
+0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 
+0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 
+0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 
+0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 
+0x29, 0x81, 0xFF, 0xFF, 0x05, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x14, 0xA5, 0x29, 0x81, 0xFF, 0xFF, 0x09, 0x00, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x75, 0xAD, 0xF3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x21, 0x81, 0xFF, 0xFF, 0x0E, 0x00, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9C, 0x75, 0xAD, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xD3, 0x9C, 0x14, 0xA5, 0x34, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x1F, 0x81, 0xFF, 0xFF, 0x0F, 0x00, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 
+0x14, 0xA5, 0xD3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0x34, 0xA5, 0xF3, 0x9C, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x1F, 0x81, 0xFF, 0xFF, 0x0E, 0x00, 0xBE, 0xF7, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xF3, 0x9C, 0x34, 0xA5, 0x55, 0xAD, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xF3, 0x9C, 0x55, 0xAD, 0xBE, 0xF7, 0xFF, 0xFF, 0x9E, 0xF7, 0x21, 0x81, 0xFF, 0xFF, 0x0D, 0x00, 
+0x9E, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0x55, 0xAD, 0xF3, 0x9C, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0xD3, 0x9C, 0x75, 0xAD, 0xFF, 0xFF, 0x9E, 0xF7, 0x21, 0x81, 0xFF, 0xFF, 
+0x0E, 0x00, 0x9E, 0xF7, 0xFF, 0xFF, 0x75, 0xAD, 0xD3, 0x9C, 0x55, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0xF3, 0x9C, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x1F, 0x81, 0xFF, 0xFF, 0x0E, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9C, 0xD3, 0x9C, 0xF3, 0x9C, 0x34, 0xA5, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x14, 0xA5, 0x75, 0xAD, 
+0x34, 0xA5, 0xD3, 0x9C, 0x21, 0x81, 0xFF, 0xFF, 0x0E, 0x00, 0xD3, 0x9C, 0x34, 0xA5, 0x75, 0xAD, 0x14, 0xA5, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xF3, 0x9C, 0x55, 0xAD, 0xF3, 0x9C, 0x34, 0xA5, 0x1F, 0x81, 0xFF, 0xFF, 0x12, 0x00, 0x34, 0xA5, 0xF3, 0x9C, 0x55, 0xAD, 0xF3, 0x9C, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xB6, 0xB5, 0x92, 0x94, 0x55, 0xAD, 0x34, 0xA5, 0xD3, 0x9C, 0x34, 0xA5, 0x19, 0x81, 0xFF, 0xFF, 0x1A, 0x00, 0x34, 0xA5, 0xD3, 0x9C, 0x34, 0xA5, 
+0x55, 0xAD, 0x92, 0x94, 0xB6, 0xB5, 0x9E, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x75, 0xAD, 0xF3, 0x9C, 
+0x55, 0xAD, 0xD3, 0x9C, 0x14, 0xA5, 0x55, 0xAD, 0xD3, 0x9C, 0xF3, 0x9C, 0x34, 0xA5, 0xF3, 0x9C, 0x0F, 0x81, 0x14, 0xA5, 0x1F, 0x00, 0xF3, 0x9C, 0x34, 0xA5, 0xF3, 0x9C, 0xD3, 0x9C, 0x55, 0xAD, 
+0x14, 0xA5, 0xD3, 0x9C, 0x55, 0xAD, 0xF3, 0x9C, 0x75, 0xAD, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x34, 0xA5, 0x55, 0xAD, 0x14, 0xA5, 0x96, 0xB5, 0x14, 0xA5, 0xF3, 0x9C, 0x34, 0xA5, 0x0F, 0x81, 0x14, 0xA5, 0x1D, 0x00, 0x34, 0xA5, 0xF3, 0x9C, 
+0x14, 0xA5, 0x96, 0xB5, 0x14, 0xA5, 0x55, 0xAD, 0x34, 0xA5, 0x9E, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0x7D, 0xEF, 0xDF, 0xFF, 0xDF, 0xFF, 0x13, 0x81, 0xFF, 0xFF, 0x0D, 0x00, 0xDF, 0xFF, 
+0xFF, 0xFF, 0x7D, 0xEF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 
+};
@@ -0,0 +1,436 @@
+/* 84x84 RGB565 RLE picture converted from emulate_84x84_jpg.h by pict2rgb565, 13804 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char emulate_84x84[] = {
+0x52, 0x35, 0x36, 0x35, 0x01, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0xEE, 0x1A, 0x00, 0x00, 0x57, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBD, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFC, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xF7, 0xFE, 0xF7, 0xFE, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xF7, 
+0xBE, 0xEF, 0x9D, 0xEF, 0x9D, 0xE7, 0x9C, 0xDF, 0x9C, 0xDF, 0x7C, 0xE7, 0x3D, 0xE7, 0x5D, 0xEF, 0x7C, 0xE7, 0x7C, 0xEF, 0x7E, 0xEF, 0x3D, 0xE7, 0x7D, 0xEF, 0x5B, 0xE7, 0x1E, 0xEF, 0x5C, 0xE7, 
+0x7B, 0xDF, 0x7D, 0xEF, 0x5C, 0xEF, 0x3D, 0xE7, 0x7D, 0xEF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 
+0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x7C, 0xEF, 0x7D, 0xEF, 0x9D, 0xF7, 0x5D, 0xF7, 0xBD, 0xF7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xF7, 
+0xDE, 0xF7, 0xBD, 0xEF, 0x5C, 0xDF, 0xBB, 0xCE, 0x5A, 0xC6, 0x19, 0xBE, 0xB8, 0xB5, 0x77, 0xB5, 0x56, 0xB5, 0xD6, 0xA5, 0x57, 0xB5, 0x97, 0xAD, 0x95, 0x9D, 0x76, 0xA5, 0x78, 0xAD, 0x56, 0xA5, 
+0x96, 0xAD, 0x97, 0xAD, 0x58, 0xAD, 0xB7, 0xAD, 0xB6, 0x9D, 0xD7, 0xAD, 0x77, 0xB5, 0x57, 0xA5, 0xB6, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xA5, 0x77, 0xA5, 
+0x77, 0xA5, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0xB7, 0xA5, 0xB7, 0xA5, 0xB7, 0xA5, 0xB7, 0xA5, 0xB7, 0xAD, 0xB7, 0xAD, 0xB7, 0xA5, 0x97, 0xA5, 0xB7, 0xA5, 0xB7, 0xAD, 0xD8, 0xB5, 
+0xF8, 0xB5, 0x79, 0xCE, 0xDB, 0xDE, 0x3C, 0xE7, 0x5D, 0xEF, 0x7E, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0x1A, 0xDF, 0x59, 0xBE, 0x76, 0x9D, 0x75, 0x64, 0xF4, 0x43, 0xD6, 0x2B, 0xD7, 0x1B, 0xD8, 0x1B, 0xF8, 0x1B, 0xF7, 0x0B, 0x98, 0x23, 0xB6, 0x23, 
+0xF6, 0x23, 0xB8, 0x23, 0xB8, 0x1B, 0xF7, 0x1B, 0xF6, 0x1B, 0xF7, 0x1B, 0xD7, 0x13, 0xD5, 0x2B, 0xB6, 0x23, 0x18, 0x1C, 0xD7, 0x13, 0xF9, 0x1B, 0xF7, 0x13, 0x18, 0x1C, 0x18, 0x14, 0x38, 0x1C, 
+0x38, 0x1C, 0x38, 0x1C, 0x58, 0x1C, 0x59, 0x1C, 0x59, 0x1C, 0x5B, 0x1C, 0x5B, 0x1C, 0x7B, 0x1C, 0x7B, 0x1C, 0x9B, 0x1C, 0x9B, 0x1C, 0x9B, 0x1C, 0x9B, 0x1C, 0x9B, 0x1C, 0xBB, 0x1C, 0xBB, 0x1C, 
+0xBB, 0x1C, 0xBB, 0x1C, 0xBB, 0x1C, 0xBC, 0x24, 0xBC, 0x24, 0x79, 0x34, 0xF9, 0x64, 0xB8, 0x9D, 0x59, 0xBE, 0xFB, 0xCE, 0x7E, 0xDF, 0x9E, 0xEF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xF7, 0x5C, 0xE7, 0xFB, 0xCE, 0xB8, 0x9D, 0x55, 0x6C, 0xF8, 0x23, 0xD7, 0x1B, 0xF8, 0x0B, 0x7A, 0x0C, 0xDC, 0x0C, 0xDB, 0x04, 0xDA, 0x04, 
+0xDA, 0x04, 0x9B, 0x14, 0xBD, 0x0C, 0xFB, 0x04, 0xD8, 0x1C, 0xDB, 0x14, 0x1C, 0x05, 0x59, 0x1C, 0x53, 0x2B, 0x78, 0x14, 0xDA, 0x0C, 0x52, 0x2B, 0x74, 0x33, 0xFC, 0x14, 0x1B, 0x05, 0x3C, 0x15, 
+0xFC, 0x0C, 0x1C, 0x0D, 0x1D, 0x0D, 0x1D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x5E, 0x0D, 0x5E, 0x0D, 0x5E, 0x0D, 0x7E, 0x0D, 0x7E, 0x0D, 0x7F, 0x0D, 0x9F, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 
+0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xBF, 0x0D, 0x5D, 0x15, 0xFE, 0x04, 0x9D, 0x0C, 0x9B, 0x34, 0xF7, 0x6C, 0xD7, 0xAD, 0xBA, 0xD6, 
+0x7D, 0xEF, 0xBE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0x7C, 0xF7, 0x1C, 0xE7, 0xF9, 0xAD, 0x96, 0x5C, 0xD6, 0x23, 0xF8, 0x13, 0x79, 0x14, 0x7A, 0x0C, 0xBB, 0x0C, 
+0xDC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x3D, 0x15, 0xFA, 0x0C, 0x3E, 0x05, 0x99, 0x1C, 0x6E, 0x42, 0x13, 0x33, 0xDB, 0x24, 0x33, 0x23, 0xAA, 0x21, 0x36, 0x14, 0x98, 0x1C, 0xCC, 0x21, 
+0x90, 0x2A, 0x1D, 0x15, 0x3C, 0x05, 0x3C, 0x0D, 0xFD, 0x0C, 0x3D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x5D, 0x0D, 0x5E, 0x0D, 0x7E, 0x0D, 0x7E, 0x0D, 0x9F, 0x0D, 0xBE, 0x0D, 0xBE, 0x0D, 0xBE, 0x0D, 
+0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0xFF, 0x0D, 0xFF, 0x0D, 0xDF, 0x05, 0xDF, 0x0D, 0xBF, 0x15, 
+0x3F, 0x15, 0x9E, 0x0C, 0x5A, 0x24, 0x18, 0x6D, 0xF7, 0xA5, 0x1B, 0xDF, 0x7D, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x9D, 0xEF, 0xBA, 0xC6, 0xF6, 0x7C, 0xF5, 0x3B, 0xF8, 0x1B, 0x9B, 0x0C, 
+0xDC, 0x04, 0xDD, 0x0C, 0xFD, 0x0C, 0x1D, 0x0D, 0x1D, 0x0D, 0xFD, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 0x3A, 0x05, 0x5C, 0x0D, 0xB3, 0x23, 0x69, 0x29, 0x73, 0x1B, 0x39, 0x1D, 0xCF, 0x2A, 
+0x4C, 0x1A, 0x9A, 0x24, 0xF7, 0x2B, 0x8B, 0x29, 0x33, 0x23, 0x3D, 0x15, 0x1D, 0x15, 0x1D, 0x0D, 0x1E, 0x0D, 0x3D, 0x15, 0x3D, 0x15, 0x3D, 0x15, 0x5D, 0x15, 0x5D, 0x15, 0x7E, 0x15, 0x7E, 0x15, 
+0x7E, 0x15, 0xBF, 0x15, 0xBF, 0x0D, 0xBF, 0x15, 0xDF, 0x15, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x15, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0x1F, 0x0E, 0xFF, 0x15, 0xFF, 0x15, 
+0xFF, 0x0D, 0xDF, 0x15, 0xBF, 0x15, 0xBD, 0x15, 0xDE, 0x0D, 0xBF, 0x05, 0x3F, 0x0D, 0xBD, 0x1C, 0x5A, 0x2C, 0xB9, 0x8D, 0x5B, 0xB6, 0x3D, 0xE7, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x5B, 0xF7, 0xF9, 0xB5, 0x97, 0x64, 
+0xF7, 0x2B, 0x59, 0x14, 0xBB, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1B, 0x0D, 0x1B, 0x0D, 0x1B, 0x0D, 0xFB, 0x0C, 0x1B, 0x0D, 0x3C, 0x15, 0x1C, 0x0D, 0x1C, 0x0D, 0xFD, 0x14, 0x9A, 0x34, 0x4D, 0x2A, 
+0xCD, 0x29, 0xDA, 0x1C, 0x76, 0x14, 0xEC, 0x31, 0x13, 0x2B, 0x1B, 0x1D, 0x53, 0x23, 0x0C, 0x2A, 0x96, 0x1C, 0x5B, 0x05, 0x1B, 0x15, 0x5E, 0x0D, 0x3C, 0x05, 0x3D, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 
+0x5E, 0x0D, 0x7E, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 
+0x1F, 0x0E, 0x3F, 0x0E, 0x1F, 0x0E, 0xFF, 0x0D, 0xFF, 0x0D, 0x1E, 0x0E, 0xFF, 0x0D, 0xFF, 0x15, 0xDF, 0x15, 0xBF, 0x0D, 0x9F, 0x0D, 0x5E, 0x15, 0xFE, 0x14, 0x17, 0x24, 0x19, 0x6D, 0x3A, 0xBE, 
+0x3C, 0xEF, 0xBD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 
+0x5B, 0xEF, 0x19, 0xAE, 0x75, 0x54, 0xF7, 0x13, 0x7B, 0x04, 0xBC, 0x04, 0xDC, 0x0C, 0x1C, 0x15, 0xFB, 0x0C, 0xDA, 0x0C, 0x1C, 0x15, 0xFD, 0x14, 0xFC, 0x04, 0x3C, 0x05, 0xFC, 0x14, 0xBC, 0x1C, 
+0xFC, 0x0C, 0x1C, 0x15, 0x93, 0x2B, 0x88, 0x21, 0x72, 0x23, 0x1C, 0x15, 0x10, 0x23, 0xEA, 0x31, 0x37, 0x1C, 0x18, 0x0D, 0x2E, 0x2A, 0x8E, 0x22, 0xF9, 0x2C, 0xFB, 0x14, 0x5D, 0x0D, 0x1D, 0x0D, 
+0xFD, 0x0C, 0x5D, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 0x7E, 0x0D, 0x7E, 0x0D, 0x9E, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0x1F, 0x0E, 
+0x1F, 0x0E, 0x3F, 0x0E, 0x1E, 0x06, 0x1E, 0x06, 0x1F, 0x0E, 0x3F, 0x0E, 0x1F, 0x0E, 0xFF, 0x05, 0xFF, 0x05, 0xDF, 0x0D, 0xBF, 0x15, 0xDF, 0x15, 0xBE, 0x0D, 0xFF, 0x05, 0xBF, 0x0D, 0xBF, 0x15, 
+0x7E, 0x0D, 0x1E, 0x0D, 0x9B, 0x14, 0xB9, 0x4C, 0xFB, 0xAD, 0x3C, 0xEF, 0xBD, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0x7D, 0xEF, 0x19, 0xB6, 0x76, 0x54, 0xF6, 0x23, 0x59, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x04, 0xDD, 0x04, 0xBC, 0x04, 0xFB, 0x04, 
+0x1C, 0x0D, 0xDB, 0x14, 0xBB, 0x0C, 0xFC, 0x04, 0x3C, 0x05, 0xD6, 0x2B, 0x0C, 0x2A, 0x4C, 0x2A, 0xD9, 0x2C, 0x9A, 0x2C, 0x0D, 0x22, 0xAF, 0x2A, 0xFA, 0x14, 0xD5, 0x2B, 0x8C, 0x31, 0x53, 0x2B, 
+0xDB, 0x0C, 0x1D, 0x15, 0x3C, 0x0D, 0x3C, 0x05, 0x3C, 0x05, 0x3D, 0x0D, 0x5D, 0x0D, 0x5E, 0x0D, 0x5E, 0x0D, 0x5E, 0x0D, 0x7E, 0x0D, 0x7F, 0x0D, 0x7F, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 
+0xDF, 0x15, 0xDF, 0x0D, 0xDF, 0x15, 0xFF, 0x15, 0xFF, 0x15, 0x1F, 0x0E, 0xFF, 0x15, 0xFF, 0x0D, 0xFF, 0x15, 0xFF, 0x15, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x05, 0xBF, 0x05, 0xDF, 0x0D, 
+0xDF, 0x0D, 0xDF, 0x05, 0x7F, 0x15, 0x7E, 0x05, 0xBE, 0x15, 0x5D, 0x15, 0x1E, 0x15, 0x7A, 0x24, 0xD7, 0x5C, 0x59, 0xBE, 0x7D, 0xEF, 0xBF, 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xF7, 0x99, 0xBE, 0xB7, 0x64, 0xF8, 0x13, 0x39, 0x0C, 0xDB, 0x04, 0x1C, 0x0D, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 
+0xFD, 0x04, 0x3D, 0x15, 0xDB, 0x14, 0x1B, 0x0D, 0xFC, 0x0C, 0xBC, 0x0C, 0x1D, 0x05, 0x1B, 0x15, 0x17, 0x24, 0x0D, 0x32, 0xEB, 0x29, 0x36, 0x24, 0x1B, 0x25, 0xF1, 0x2A, 0xED, 0x21, 0x37, 0x2C, 
+0xDA, 0x1C, 0x6E, 0x2A, 0xEB, 0x29, 0x78, 0x24, 0x1E, 0x05, 0x9A, 0x24, 0x57, 0x24, 0x78, 0x14, 0x57, 0x24, 0x77, 0x24, 0x78, 0x24, 0x78, 0x24, 0x98, 0x24, 0x98, 0x24, 0x98, 0x24, 0xB8, 0x24, 
+0xB9, 0x24, 0xD9, 0x24, 0xD9, 0x24, 0xD9, 0x24, 0xD9, 0x24, 0xD9, 0x24, 0xF9, 0x24, 0xF9, 0x24, 0xF9, 0x24, 0xF9, 0x24, 0xF9, 0x24, 0xF9, 0x24, 0xF9, 0x24, 0xF9, 0x24, 0xFA, 0x24, 0x1A, 0x25, 
+0x5B, 0x25, 0xFD, 0x15, 0xFF, 0x0D, 0xDF, 0x05, 0x9F, 0x0D, 0xBF, 0x0D, 0x7F, 0x1D, 0xBF, 0x05, 0xBE, 0x15, 0x7D, 0x15, 0x9F, 0x15, 0xDD, 0x04, 0x58, 0x14, 0x17, 0x65, 0x7B, 0xC6, 0x7D, 0xEF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7E, 0xF7, 0x3C, 0xE7, 0x16, 0x75, 0x17, 0x24, 0x9B, 0x04, 0xDD, 0x0C, 0x1D, 0x0D, 
+0xFC, 0x04, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0x1C, 0x05, 0x1A, 0x05, 0xFA, 0x0C, 0xFB, 0x04, 0x3C, 0x05, 0x3D, 0x15, 0xFA, 0x1C, 0x93, 0x1B, 0xCB, 0x21, 0x2B, 0x2A, 0xB3, 0x13, 0x3C, 0x15, 
+0xF5, 0x2B, 0xEA, 0x31, 0x11, 0x1B, 0xDB, 0x1C, 0x94, 0x23, 0xA9, 0x19, 0x51, 0x2B, 0x1A, 0x15, 0xDB, 0x1C, 0xD1, 0x22, 0x0D, 0x22, 0x4E, 0x1A, 0x0C, 0x22, 0xEC, 0x21, 0xEC, 0x21, 0x0C, 0x22, 
+0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0D, 0x22, 0x0D, 0x22, 0x0D, 0x22, 0x2C, 0x22, 0x2D, 0x22, 0x2D, 0x22, 0x2C, 0x22, 0x2C, 0x22, 0x0D, 0x22, 0x0D, 0x22, 0x2D, 0x22, 
+0x2D, 0x22, 0x2D, 0x22, 0x2D, 0x22, 0x4E, 0x2A, 0x8F, 0x2A, 0x95, 0x1C, 0x5D, 0x35, 0xDF, 0x05, 0x9F, 0x0D, 0xDE, 0x0D, 0x7F, 0x15, 0xFF, 0x15, 0x5D, 0x0D, 0x7F, 0x0D, 0x9E, 0x0D, 0x9F, 0x0D, 
+0xDD, 0x04, 0x39, 0x24, 0x37, 0x85, 0xDA, 0xD6, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0x5C, 0xE7, 0xF9, 0xA5, 0x16, 0x3C, 
+0x18, 0x0C, 0xDB, 0x04, 0xFC, 0x0C, 0xFD, 0x0C, 0xDC, 0x0C, 0xFC, 0x14, 0xFC, 0x14, 0xFB, 0x0C, 0xFB, 0x04, 0xDC, 0x04, 0x3D, 0x15, 0xDA, 0x24, 0x17, 0x24, 0x93, 0x2B, 0x8F, 0x2A, 0xEC, 0x29, 
+0x2C, 0x2A, 0x15, 0x24, 0x3A, 0x1D, 0xF6, 0x23, 0xCB, 0x29, 0x4D, 0x2A, 0x99, 0x24, 0x78, 0x24, 0x4C, 0x22, 0x0B, 0x2A, 0x78, 0x1C, 0x1B, 0x15, 0xB3, 0x2B, 0x69, 0x19, 0x08, 0x19, 0x48, 0x11, 
+0x07, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 
+0x49, 0x11, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x11, 0x48, 0x11, 0x49, 0x11, 0x69, 0x11, 0x0B, 0x0A, 0x75, 0x3B, 0xBE, 0x1D, 0xBF, 0x15, 0xDF, 0x0D, 0x9E, 0x05, 0xBF, 0x15, 
+0x7E, 0x0D, 0x7F, 0x0D, 0x5C, 0x0D, 0x9D, 0x0D, 0x3F, 0x05, 0x7C, 0x0C, 0x77, 0x44, 0xB7, 0xA5, 0x3C, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 
+0x9F, 0xF7, 0xFC, 0xCE, 0x55, 0x5C, 0x18, 0x1C, 0xBA, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDC, 0x14, 0xDC, 0x0C, 0xDB, 0x0C, 0x1B, 0x0D, 0xFD, 0x04, 0xDB, 0x24, 0x54, 0x33, 
+0xCB, 0x29, 0xA8, 0x19, 0xCB, 0x21, 0xD2, 0x22, 0x79, 0x24, 0x9B, 0x24, 0xD6, 0x2B, 0xAB, 0x29, 0x0B, 0x22, 0x57, 0x1C, 0xFB, 0x2C, 0xD1, 0x2A, 0xAA, 0x21, 0x95, 0x33, 0xDD, 0x0C, 0x99, 0x1C, 
+0x6C, 0x22, 0x28, 0x19, 0x4A, 0x21, 0x48, 0x19, 0x6A, 0x21, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x21, 0x29, 0x21, 0x49, 0x21, 0x29, 0x19, 0x29, 0x19, 
+0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x49, 0x21, 0x29, 0x21, 0x29, 0x21, 0x28, 0x21, 0x29, 0x21, 0x29, 0x19, 0x29, 0x19, 0x49, 0x19, 0x07, 0x19, 0x8C, 0x29, 0xB8, 0x2C, 
+0xBD, 0x15, 0xBF, 0x15, 0xDE, 0x05, 0x3D, 0x0D, 0x9F, 0x15, 0x9E, 0x0D, 0x3D, 0x15, 0x5D, 0x15, 0x5E, 0x0D, 0x1E, 0x0D, 0x39, 0x1C, 0x96, 0x64, 0xDA, 0xD6, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xF7, 0x5C, 0xEF, 0xB9, 0x9D, 0xB5, 0x23, 0x7B, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 
+0x1C, 0x0D, 0x5C, 0x05, 0xD9, 0x14, 0x73, 0x23, 0x8F, 0x1A, 0x71, 0x1B, 0x96, 0x24, 0xDA, 0x1C, 0xDB, 0x14, 0x34, 0x23, 0xED, 0x29, 0xEC, 0x21, 0x56, 0x24, 0x7C, 0x25, 0x32, 0x23, 0xAB, 0x21, 
+0xD0, 0x2A, 0xFB, 0x24, 0xBA, 0x0C, 0x32, 0x23, 0x68, 0x19, 0x29, 0x19, 0x2A, 0x21, 0x28, 0x11, 0x2A, 0x19, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 
+0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x68, 0x19, 0x48, 0x11, 0x48, 0x19, 0x48, 0x19, 0x68, 0x19, 0x48, 0x19, 0x68, 0x19, 
+0x69, 0x19, 0x49, 0x21, 0x08, 0x19, 0xF1, 0x22, 0x9C, 0x05, 0x7F, 0x15, 0xBE, 0x0D, 0x5D, 0x05, 0x9F, 0x15, 0x7D, 0x0D, 0x5E, 0x15, 0x5D, 0x1D, 0x3D, 0x0D, 0x5E, 0x0D, 0x7C, 0x04, 0x37, 0x34, 
+0xD9, 0x9D, 0x3C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xDE, 0xEF, 0xFA, 0xDE, 0x35, 0x6C, 0xF8, 0x1B, 0xBB, 0x04, 0xFC, 0x0C, 0xFD, 0x0C, 0xFC, 0x0C, 0x1B, 0x0D, 
+0x3A, 0x0D, 0x1B, 0x05, 0x1C, 0x0D, 0xFC, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x1C, 0xFB, 0x14, 0xDB, 0x14, 0xBC, 0x1C, 0x79, 0x1C, 0x93, 0x13, 0x4E, 0x2A, 0x09, 0x1A, 0x8E, 0x32, 0x58, 0x34, 
+0xDB, 0x0C, 0x54, 0x1B, 0xAA, 0x29, 0xAE, 0x2A, 0xDA, 0x2C, 0xDB, 0x0C, 0x15, 0x1C, 0xAA, 0x29, 0x08, 0x19, 0x8A, 0x19, 0x29, 0x19, 0x68, 0x19, 0x69, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x6A, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x4A, 0x19, 0x48, 0x11, 0xAC, 0x19, 0xDD, 0x05, 0x5F, 0x15, 0x5D, 0x15, 0xBD, 0x05, 0x5E, 0x0D, 0x5E, 0x0D, 0x3C, 0x05, 0x5D, 0x15, 
+0x3D, 0x15, 0x5E, 0x0D, 0xFC, 0x04, 0x38, 0x1C, 0xB8, 0x5C, 0xFB, 0xDE, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBD, 0xEF, 0x39, 0xBE, 0x18, 0x24, 0x79, 0x14, 0xBC, 0x0C, 
+0xFB, 0x04, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xBD, 0x0C, 0xFA, 0x24, 0xB2, 0x0B, 0x53, 0x23, 0x91, 0x3A, 0xCB, 0x29, 0x0B, 0x22, 
+0x0D, 0x2A, 0xB6, 0x1B, 0xDA, 0x1C, 0xD9, 0x24, 0x11, 0x2B, 0xAB, 0x29, 0x6E, 0x32, 0x37, 0x24, 0x1E, 0x15, 0x14, 0x3C, 0x6D, 0x1A, 0x49, 0x11, 0x49, 0x21, 0x48, 0x19, 0x48, 0x19, 0x49, 0x19, 
+0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x4A, 0x11, 0x0A, 0x21, 0x48, 0x21, 0x47, 0x09, 0x69, 0x19, 0x0A, 0x29, 
+0x09, 0x21, 0x28, 0x11, 0x69, 0x19, 0x28, 0x11, 0x49, 0x19, 0x69, 0x19, 0x48, 0x11, 0x49, 0x11, 0x48, 0x19, 0x2A, 0x19, 0x69, 0x19, 0x6A, 0x11, 0xBF, 0x05, 0x3F, 0x05, 0x9D, 0x0D, 0x5E, 0x1D, 
+0x7E, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 0x5D, 0x15, 0x3D, 0x15, 0x3D, 0x0D, 0x3C, 0x0D, 0xDB, 0x14, 0x19, 0x1C, 0x39, 0xC6, 0x7D, 0xF7, 0xDF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0xDF, 
+0x57, 0x9D, 0xF8, 0x1B, 0x9A, 0x14, 0xDC, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0x3A, 0x0D, 0xD4, 0x33, 0xCB, 0x29, 
+0xEB, 0x29, 0x8E, 0x2A, 0x31, 0x1B, 0x16, 0x14, 0x79, 0x1C, 0xBA, 0x24, 0xF4, 0x23, 0x8D, 0x22, 0xCB, 0x21, 0xD0, 0x22, 0xD8, 0x1C, 0x1A, 0x1D, 0xF7, 0x13, 0x8E, 0x1A, 0x8A, 0x11, 0x28, 0x11, 
+0x29, 0x21, 0x48, 0x19, 0x48, 0x19, 0x69, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x47, 0x19, 0x6A, 0x21, 0x49, 0x11, 
+0x69, 0x09, 0x69, 0x11, 0x89, 0x19, 0x68, 0x11, 0xA8, 0x11, 0x89, 0x19, 0xAA, 0x21, 0x6A, 0x21, 0x6A, 0x21, 0x6A, 0x19, 0x69, 0x19, 0x8A, 0x21, 0x6A, 0x21, 0x69, 0x21, 0x88, 0x21, 0xEA, 0x19, 
+0x7D, 0x0D, 0x7E, 0x15, 0x9D, 0x0D, 0x5E, 0x15, 0x5E, 0x05, 0x5D, 0x0D, 0x5D, 0x0D, 0x3D, 0x0D, 0x1D, 0x0D, 0x3D, 0x0D, 0x5C, 0x0D, 0xDB, 0x14, 0x19, 0x1C, 0x97, 0x9D, 0x1C, 0xE7, 0xDF, 0xF7, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xBF, 0xF7, 0xBA, 0xCE, 0x95, 0x6C, 0xF8, 0x0B, 0xBB, 0x14, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 
+0xFB, 0x0C, 0xFB, 0x0C, 0x9A, 0x24, 0x17, 0x1C, 0x57, 0x1C, 0xB8, 0x24, 0xFA, 0x1C, 0x99, 0x24, 0xD7, 0x2B, 0xAF, 0x1A, 0xAC, 0x29, 0xAC, 0x31, 0x32, 0x2B, 0xDA, 0x14, 0x3C, 0x0D, 0x16, 0x1C, 
+0xAE, 0x22, 0x69, 0x11, 0x29, 0x11, 0x29, 0x21, 0x29, 0x21, 0x28, 0x19, 0x49, 0x19, 0x69, 0x19, 0x28, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x27, 0x11, 0x69, 0x21, 0x28, 0x19, 0x49, 0x19, 0x49, 0x21, 0xE8, 0x20, 0x28, 0x11, 0x6D, 0x1A, 0xD5, 0x13, 0xF6, 0x1B, 0xD5, 0x1B, 0xF6, 0x1B, 0xF6, 0x1B, 0xD6, 0x1B, 0xD6, 0x1B, 
+0xB5, 0x1B, 0x17, 0x1C, 0xB5, 0x1B, 0xD5, 0x1B, 0x7F, 0x05, 0x9E, 0x0D, 0x5C, 0x0D, 0x7E, 0x0D, 0x5C, 0x0D, 0x5D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x1D, 0x0D, 0x3D, 0x0D, 0x5D, 0x05, 0xFC, 0x0C, 
+0x3A, 0x14, 0xB5, 0x6C, 0xBB, 0xD6, 0xDF, 0xF7, 0xFE, 0xFF, 0xDE, 0xFF, 0xBE, 0xEF, 0x59, 0xBE, 0x15, 0x44, 0x5A, 0x0C, 0xDC, 0x0C, 0xDC, 0x0C, 0xFA, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 
+0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0x99, 0x1C, 0x98, 0x24, 0x37, 0x1C, 0x74, 0x23, 0x11, 0x2B, 0x6D, 0x22, 0xA9, 0x29, 0x0A, 0x32, 0xB0, 0x32, 0xF8, 0x2B, 
+0xDC, 0x14, 0xDA, 0x14, 0x16, 0x2C, 0x6E, 0x32, 0x08, 0x19, 0x48, 0x19, 0x29, 0x19, 0x49, 0x21, 0x49, 0x21, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x28, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x4A, 0x21, 0x68, 0x11, 0x28, 0x19, 0x6B, 0x29, 0xEC, 0x19, 0x8B, 0x19, 0x2F, 0x2A, 0x98, 0x34, 0x5F, 0x16, 0x1F, 0x0E, 0xDE, 0x0D, 
+0xFF, 0x15, 0xFF, 0x0D, 0xDE, 0x0D, 0xBE, 0x0D, 0x9E, 0x0D, 0xBF, 0x05, 0x5E, 0x15, 0x3D, 0x1D, 0x9F, 0x05, 0x5E, 0x0D, 0x1D, 0x15, 0x5E, 0x15, 0x3C, 0x15, 0x3D, 0x0D, 0x3D, 0x05, 0x3D, 0x0D, 
+0x1D, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0xFC, 0x0C, 0x5B, 0x14, 0x35, 0x44, 0x5A, 0xBE, 0xBF, 0xF7, 0xFE, 0xFF, 0xDE, 0xFF, 0x9D, 0xE7, 0xF8, 0xB5, 0xD6, 0x2B, 0xBB, 0x0C, 0xFC, 0x0C, 0xBC, 0x04, 
+0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0x1A, 0x0D, 0xD1, 0x2A, 0xCC, 0x39, 0xEC, 0x21, 0xEC, 0x19, 0xCB, 0x29, 0x4C, 0x22, 
+0x10, 0x23, 0x57, 0x2C, 0xD9, 0x0C, 0x5B, 0x05, 0xD9, 0x1C, 0x52, 0x33, 0xEB, 0x29, 0x49, 0x21, 0x2A, 0x21, 0x48, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x28, 0x21, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x4A, 0x21, 0x89, 0x11, 0x4D, 0x22, 0x94, 0x33, 0x76, 0x1C, 0x76, 0x14, 0xD9, 0x24, 
+0x1F, 0x26, 0x3A, 0x35, 0x37, 0x1C, 0xB5, 0x0B, 0xB5, 0x13, 0xD5, 0x13, 0xB5, 0x13, 0xB5, 0x13, 0xB5, 0x13, 0x94, 0x0B, 0x94, 0x13, 0xF4, 0x1B, 0x3D, 0x0D, 0x5C, 0x0D, 0x3D, 0x15, 0x3E, 0x0D, 
+0x3D, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0x3D, 0x0D, 0x1D, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0x1C, 0x0D, 0x9B, 0x0C, 0x16, 0x2C, 0x19, 0xB6, 0x7E, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9C, 0xDF, 0xB7, 0xB5, 
+0xD6, 0x23, 0xDB, 0x04, 0xDC, 0x0C, 0xBB, 0x04, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0x33, 0x23, 0xAF, 0x32, 
+0x32, 0x23, 0xB4, 0x1B, 0xF4, 0x1B, 0x98, 0x1C, 0xFE, 0x1C, 0xBC, 0x04, 0xDA, 0x14, 0x15, 0x24, 0xAF, 0x2A, 0x6A, 0x21, 0x29, 0x19, 0x69, 0x19, 0x49, 0x11, 0x69, 0x19, 0x48, 0x11, 0x28, 0x11, 
+0x49, 0x19, 0x69, 0x19, 0x49, 0x19, 0x29, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x27, 0x19, 0x2C, 0x22, 0x76, 0x24, 
+0xDE, 0x1D, 0x3F, 0x16, 0x3F, 0x0E, 0x3E, 0x16, 0x7D, 0x1D, 0xCF, 0x3A, 0xAB, 0x19, 0x49, 0x11, 0x6A, 0x19, 0x6A, 0x19, 0x6A, 0x19, 0x49, 0x19, 0x4A, 0x21, 0x69, 0x21, 0x69, 0x19, 0x0B, 0x12, 
+0x3C, 0x0D, 0x9C, 0x0D, 0x9D, 0x0D, 0x3E, 0x05, 0x3E, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0x3D, 0x0D, 0x1D, 0x15, 0xFC, 0x0C, 0x1C, 0x05, 0x1C, 0x05, 0xDC, 0x0C, 0xF7, 0x23, 0xD8, 0xB5, 0x3D, 0xEF, 
+0xFF, 0xF7, 0xDF, 0xFF, 0x7C, 0xDF, 0x97, 0xB5, 0xD7, 0x1B, 0xBA, 0x04, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 
+0xFB, 0x0C, 0xFB, 0x0C, 0xD9, 0x14, 0xF9, 0x14, 0xBA, 0x14, 0xBB, 0x1C, 0xFA, 0x0C, 0x1B, 0x0D, 0x7A, 0x0C, 0x17, 0x24, 0xB1, 0x32, 0x8C, 0x31, 0x6A, 0x21, 0x49, 0x11, 0x29, 0x19, 0x28, 0x19, 
+0x87, 0x11, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x88, 0x19, 0x31, 0x2B, 0xBC, 0x1D, 0x5F, 0x06, 0xDF, 0x0D, 0xFF, 0x05, 0x1E, 0x16, 0xDA, 0x2C, 0x2C, 0x22, 0x69, 0x09, 0x48, 0x11, 0x69, 0x19, 0x68, 0x11, 0x69, 0x19, 0x48, 0x11, 
+0x49, 0x19, 0x2A, 0x29, 0x08, 0x19, 0x6A, 0x11, 0x5E, 0x05, 0x5E, 0x0D, 0x5C, 0x05, 0x1D, 0x0D, 0x5D, 0x0D, 0x1D, 0x0D, 0x3C, 0x05, 0x3D, 0x0D, 0x1C, 0x15, 0xFC, 0x0C, 0x1C, 0x05, 0x1C, 0x05, 
+0xDB, 0x0C, 0xF7, 0x1B, 0xB7, 0xB5, 0x3C, 0xEF, 0xFF, 0xF7, 0xDF, 0xFF, 0x7C, 0xDF, 0x96, 0xB5, 0xF8, 0x1B, 0xD9, 0x04, 0x1C, 0x15, 0xDC, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBC, 0x14, 0xDC, 0x14, 0x1C, 0x05, 0xFB, 0x04, 0x1D, 0x15, 0xFC, 0x0C, 0xFB, 0x14, 0x38, 0x14, 0x2A, 0x1A, 0x69, 0x21, 0x09, 0x19, 
+0x69, 0x11, 0x89, 0x11, 0x48, 0x21, 0x49, 0x21, 0x49, 0x19, 0x09, 0x19, 0x49, 0x21, 0x49, 0x19, 0x48, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x69, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x6A, 0x21, 0x73, 0x1B, 0xDD, 0x15, 0x1F, 0x06, 0xFF, 0x15, 0xFF, 0x0D, 0x1E, 0x0E, 0x19, 0x1D, 0xCB, 0x21, 0x29, 0x11, 0x49, 0x21, 
+0x49, 0x21, 0x08, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x49, 0x11, 0x68, 0x19, 0x8B, 0x21, 0x3F, 0x0D, 0xDE, 0x14, 0x1B, 0x0D, 0x1C, 0x1D, 0x3C, 0x05, 0x3D, 0x0D, 0x3C, 0x05, 0x3C, 0x05, 
+0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x05, 0xDB, 0x0C, 0xF7, 0x13, 0xD7, 0xB5, 0x3C, 0xF7, 0xFF, 0xEF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0xBB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 
+0xDB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xFB, 0x0C, 
+0x16, 0x1C, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x8A, 0x11, 0xB1, 0x32, 0x5B, 0x2D, 0x7F, 0x06, 0x9F, 0x05, 0xFF, 0x0D, 0x3E, 0x0E, 
+0xB7, 0x1C, 0x8A, 0x21, 0x69, 0x21, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x21, 0x69, 0x19, 0xAB, 0x19, 0x1D, 0x0D, 0x3D, 0x0D, 0x3C, 0x0D, 0x3D, 0x0D, 
+0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 
+0xFB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xFB, 0x0C, 0xF6, 0x13, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0xCD, 0x31, 0xF4, 0x2B, 
+0xBB, 0x15, 0xDE, 0x15, 0xDE, 0x15, 0xF9, 0x24, 0xD1, 0x32, 0x6A, 0x21, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x21, 0x69, 0x19, 0x8A, 0x19, 
+0x1D, 0x0D, 0x3D, 0x0D, 0x3C, 0x0D, 0x3D, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x04, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 
+0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0x1B, 0x0D, 0xDB, 0x0C, 0xDC, 0x0C, 0xFB, 0x0C, 0x16, 0x1C, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x11, 0x29, 0x21, 0x0D, 0x22, 0x52, 0x23, 0x15, 0x1C, 0xF4, 0x1B, 0xD0, 0x22, 0x4B, 0x29, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x21, 0x69, 0x19, 0x8A, 0x19, 0x1D, 0x0D, 0x3C, 0x0D, 0x1C, 0x0D, 0x3D, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0x1C, 0x0D, 0xFC, 0x0C, 
+0xDB, 0x04, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xFB, 0x0C, 0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 
+0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x11, 0x28, 0x11, 0x28, 0x19, 0x8A, 0x21, 0xAB, 0x21, 0x8B, 0x19, 0x69, 0x19, 0x28, 0x11, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x21, 0x69, 0x19, 0x8A, 0x19, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x3D, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xFB, 0x0C, 
+0x17, 0x1C, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x09, 0x21, 0x49, 0x19, 0x48, 0x11, 0x48, 0x19, 0x28, 0x19, 0x08, 0x19, 0x08, 0x19, 
+0x69, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x8A, 0x19, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 
+0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xFA, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x21, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x68, 0x11, 0x69, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x8A, 0x19, 
+0xFC, 0x0C, 0x1C, 0x05, 0xFC, 0x0C, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 
+0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xFA, 0x0C, 0xBB, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x89, 0x11, 0x49, 0x19, 0x09, 0x19, 0x29, 0x19, 0x28, 0x19, 0x69, 0x19, 0x69, 0x19, 0x28, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x8A, 0x19, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xDB, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xFA, 0x04, 0xBB, 0x0C, 0xBC, 0x0C, 0xDA, 0x04, 0xD6, 0x13, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 
+0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x68, 0x19, 0x28, 0x19, 0x49, 0x19, 0x69, 0x19, 0x29, 0x19, 0x48, 0x19, 0x69, 0x19, 0x29, 0x21, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x8A, 0x19, 0xFC, 0x0C, 0xFC, 0x04, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 0xDA, 0x04, 0xDB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 
+0xF7, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x69, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0xAA, 0x11, 0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x05, 0xFC, 0x0C, 
+0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 
+0xDA, 0x04, 0xDB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 0xF7, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x28, 0x11, 0x29, 0x11, 0x49, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0xAA, 0x11, 
+0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x05, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 
+0xBF, 0xFF, 0xDF, 0xFF, 0x3D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 0xDA, 0x04, 0xDB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 0xF7, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x69, 0x19, 0x69, 0x19, 0x48, 0x19, 0x48, 0x11, 0x28, 0x19, 0x49, 0x19, 
+0x69, 0x19, 0x49, 0x19, 0x49, 0x19, 0x8A, 0x11, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x04, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 
+0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 0xDA, 0x04, 0xDB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 0xF7, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 
+0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x48, 0x19, 
+0x48, 0x19, 0x48, 0x19, 0x49, 0x19, 0x28, 0x19, 0x28, 0x19, 0x49, 0x19, 0x49, 0x19, 0x8A, 0x11, 0xFC, 0x0C, 0xDC, 0x0C, 0xFB, 0x04, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 
+0xDB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 0xDA, 0x04, 0xDB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 
+0xF7, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x28, 0x19, 0x28, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x48, 0x19, 0x8A, 0x11, 0xFC, 0x0C, 0xDC, 0x0C, 0xFB, 0x04, 0xFC, 0x0C, 
+0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 
+0xDA, 0x04, 0xDB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 0xF7, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x21, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x28, 0x11, 0x28, 0x19, 0x49, 0x19, 0x49, 0x21, 0x49, 0x19, 0x48, 0x19, 0x8A, 0x11, 
+0xDC, 0x0C, 0xDB, 0x0C, 0xFB, 0x04, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 
+0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 0xDA, 0x04, 0xDB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 0xF7, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x29, 0x11, 0x49, 0x11, 0x69, 0x19, 0x69, 0x19, 0x49, 0x19, 
+0x29, 0x19, 0x49, 0x19, 0x48, 0x19, 0x8A, 0x11, 0xDC, 0x0C, 0xDB, 0x0C, 0xFB, 0x04, 0xDC, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 0xDA, 0x04, 0xDB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 0xF7, 0x1B, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 
+0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x8A, 0x19, 
+0x0C, 0x2A, 0x6E, 0x32, 0x6D, 0x32, 0xCB, 0x21, 0x49, 0x11, 0x49, 0x19, 0x48, 0x19, 0x8A, 0x11, 0xDC, 0x0C, 0xDB, 0x0C, 0xFB, 0x04, 0xDC, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDE, 0xF7, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 0xDA, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xDA, 0x0C, 
+0x16, 0x1C, 0xCB, 0x21, 0x49, 0x19, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x48, 0x19, 0x67, 0x19, 0xAF, 0x32, 0xF6, 0x2B, 0x9A, 0x14, 0xBA, 0x14, 0xF6, 0x2B, 0x2B, 0x22, 0x48, 0x11, 0x2A, 0x29, 0x4B, 0x11, 0xDC, 0x0C, 0x1B, 0x05, 0x9B, 0x0C, 0xDC, 0x14, 
+0x1A, 0x05, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x04, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xF7, 0x5D, 0xEF, 0x96, 0xAD, 
+0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xBB, 0x0C, 
+0xDA, 0x0C, 0xBB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x19, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x2A, 0x11, 0x0D, 0x2A, 0x16, 0x24, 0x1B, 0x05, 0xFB, 0x0C, 0xDB, 0x0C, 0xBB, 0x1C, 0xD6, 0x2B, 0xAE, 0x1A, 0x6E, 0x22, 0xAF, 0x1A, 
+0xBA, 0x0C, 0xB9, 0x0C, 0xBA, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x04, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xDE, 0xF7, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0x9B, 0x0C, 0xDA, 0x0C, 0xBB, 0x0C, 0xBC, 0x0C, 0xDA, 0x04, 0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x19, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0xD0, 0x22, 0xB9, 0x1C, 0x1C, 0x05, 0xDA, 0x0C, 0xBA, 0x0C, 0xFC, 0x0C, 
+0xFB, 0x0C, 0x9B, 0x14, 0x58, 0x0C, 0x78, 0x1C, 0xDD, 0x04, 0x9A, 0x0C, 0xFB, 0x0C, 0xFC, 0x04, 0x9B, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0x9B, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0x9B, 0x0C, 0xDA, 0x0C, 0xBB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x19, 0x49, 0x19, 
+0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0xCF, 0x1A, 0x79, 0x1C, 
+0xDC, 0x0C, 0xFA, 0x0C, 0xDA, 0x0C, 0xDB, 0x14, 0xDA, 0x04, 0x9B, 0x14, 0x39, 0x04, 0x78, 0x14, 0xFE, 0x04, 0x9A, 0x0C, 0xFB, 0x0C, 0xFC, 0x04, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0x9B, 0x0C, 0xDA, 0x0C, 0xBB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 
+0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x19, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x29, 0x11, 0xED, 0x29, 0xF6, 0x23, 0xFC, 0x04, 0xFC, 0x0C, 0xFB, 0x0C, 0xDB, 0x14, 0xB5, 0x23, 0x6D, 0x22, 0x4D, 0x1A, 0x8E, 0x1A, 0x9B, 0x14, 0x9A, 0x0C, 0xDB, 0x0C, 0xDC, 0x04, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 
+0xB6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0x9B, 0x0C, 
+0xDA, 0x0C, 0xBB, 0x0C, 0xBC, 0x0C, 0xDA, 0x0C, 0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x19, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x69, 0x19, 0x89, 0x29, 0xD0, 0x32, 0xF6, 0x23, 0x78, 0x24, 0x78, 0x24, 0xF5, 0x2B, 0x8D, 0x32, 0x27, 0x21, 0x28, 0x21, 0x6A, 0x11, 
+0xBB, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x04, 0xFA, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBC, 0x0C, 0xBA, 0x04, 0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x19, 0x49, 0x19, 0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x28, 0x19, 0x26, 0x19, 0x69, 0x21, 0xCC, 0x29, 0x8E, 0x2A, 0x6F, 0x2A, 0xEC, 0x21, 
+0x47, 0x19, 0x49, 0x19, 0x4A, 0x19, 0xAC, 0x09, 0xDC, 0x0C, 0xFB, 0x04, 0xDC, 0x0C, 0xBB, 0x0C, 0xDA, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0x5A, 0x0C, 
+0x39, 0x04, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBC, 0x0C, 0xBA, 0x04, 0xF6, 0x1B, 0xCB, 0x21, 0x49, 0x19, 0x49, 0x19, 
+0x48, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x4B, 0x19, 0x49, 0x21, 0x69, 0x11, 
+0x49, 0x09, 0x69, 0x21, 0x29, 0x19, 0x4A, 0x11, 0x49, 0x21, 0x48, 0x19, 0x49, 0x19, 0xAA, 0x11, 0x9A, 0x0C, 0xB9, 0x04, 0xDB, 0x0C, 0xBC, 0x04, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0x9B, 0x0C, 0x5A, 0x0C, 0xF9, 0x03, 0xB8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xA5, 0xB6, 0x1B, 0x9A, 0x14, 0xDB, 0x0C, 0xBA, 0x0C, 
+0xBA, 0x04, 0xBB, 0x14, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xBB, 0x04, 0xDB, 0x04, 0xDB, 0x0C, 0x79, 0x14, 
+0xF7, 0x1B, 0xCE, 0x29, 0x2A, 0x11, 0x29, 0x11, 0x69, 0x21, 0x28, 0x21, 0x08, 0x19, 0x49, 0x21, 0x69, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x6A, 0x21, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x21, 0x4B, 0x19, 0x69, 0x21, 0x69, 0x09, 0x1A, 0x05, 0x7D, 0x0C, 0xBC, 0x04, 0xFB, 0x04, 
+0xBB, 0x0C, 0xDB, 0x04, 0xDC, 0x0C, 0xBB, 0x0C, 0x7A, 0x0C, 0x19, 0x0C, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xB6, 0x1B, 0x7A, 0x14, 0x9A, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0x9A, 0x04, 0x9A, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x04, 0xBA, 0x0C, 0x79, 0x14, 0x38, 0x14, 0x0A, 0x22, 0x68, 0x11, 0x48, 0x19, 0x69, 0x19, 0x29, 0x11, 0x29, 0x11, 0x4A, 0x19, 0x2A, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 
+0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 
+0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x49, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x11, 0x49, 0x11, 0x07, 0x19, 0xAB, 0x21, 
+0xD9, 0x0C, 0xBD, 0x14, 0xDB, 0x0C, 0xDA, 0x04, 0xDB, 0x04, 0xBB, 0x0C, 0x9B, 0x0C, 0x5A, 0x0C, 0x19, 0x04, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x0B, 0xD9, 0x0B, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0xB7, 0xAD, 0xB5, 0x1B, 0x39, 0x0C, 0x59, 0x0C, 0x79, 0x0C, 0xBB, 0x14, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x14, 0xBB, 0x04, 0xBB, 0x0C, 0xBB, 0x14, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x14, 0x79, 0x14, 0x6D, 0x2A, 0x89, 0x19, 0x28, 0x19, 0x69, 0x19, 0x89, 0x11, 0x88, 0x09, 0x88, 0x11, 
+0x67, 0x11, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 
+0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x29, 0x19, 0x49, 0x19, 0x49, 0x19, 0x28, 0x11, 0x28, 0x11, 0x49, 0x19, 0x69, 0x19, 
+0x69, 0x19, 0x89, 0x21, 0x48, 0x21, 0xB1, 0x32, 0xB9, 0x04, 0xBC, 0x14, 0xDA, 0x04, 0xB9, 0x04, 0xBB, 0x0C, 0x5A, 0x0C, 0x19, 0x0C, 0xD9, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 
+0xB8, 0x0B, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0xB7, 0xAD, 0x95, 0x1B, 0xF8, 0x0B, 0xF8, 0x03, 0x18, 0x0C, 0x3A, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0x9A, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x14, 0x72, 0x33, 0xED, 0x19, 0xE9, 0x18, 
+0x09, 0x21, 0x4A, 0x21, 0x29, 0x11, 0x29, 0x19, 0x2A, 0x21, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 
+0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x49, 0x19, 0x69, 0x19, 
+0x69, 0x19, 0x69, 0x19, 0x49, 0x19, 0x28, 0x19, 0x08, 0x11, 0xE7, 0x18, 0xCB, 0x19, 0xF6, 0x33, 0xFB, 0x04, 0xBB, 0x0C, 0xFA, 0x04, 0x79, 0x0C, 0xFA, 0x13, 0xF9, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xD8, 0x0B, 0xD9, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0xB7, 0xAD, 0x95, 0x1B, 0xD8, 0x0B, 0xD7, 0x03, 0xD7, 0x03, 
+0xD8, 0x03, 0x39, 0x0C, 0x59, 0x0C, 0x7A, 0x0C, 0x9A, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBA, 0x04, 0xBA, 0x04, 0xBB, 0x04, 0xBB, 0x0C, 0xBA, 0x0C, 0x9A, 0x0C, 0x9B, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBA, 0x0C, 0xB9, 0x2C, 0x12, 0x1B, 0x8A, 0x11, 0x08, 0x19, 0x48, 0x21, 0x89, 0x19, 0x49, 0x19, 0x09, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 
+0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 0x29, 0x19, 
+0x29, 0x19, 0x29, 0x19, 0x09, 0x19, 0x29, 0x19, 0x49, 0x21, 0x49, 0x21, 0x29, 0x19, 0x29, 0x19, 0x49, 0x21, 0xED, 0x29, 0x52, 0x23, 0xB9, 0x14, 0xDB, 0x04, 0x1A, 0x0C, 0x79, 0x04, 0x18, 0x04, 
+0x99, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD9, 0x0B, 0xD9, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xFE, 0xFF, 0x5D, 0xE7, 0x97, 0xAD, 
+0xB6, 0x23, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0x19, 0x0C, 0x39, 0x0C, 0x7A, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 
+0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x04, 0xDB, 0x04, 0xBA, 0x1C, 0xD5, 0x2B, 0xAF, 0x2A, 0xAA, 0x11, 0x69, 0x11, 0x6A, 0x19, 0x8B, 0x21, 0x8A, 0x19, 0x8A, 0x19, 0x8A, 0x19, 
+0x8A, 0x19, 0x8A, 0x19, 0x8A, 0x19, 0x8A, 0x19, 0x8A, 0x19, 0x8B, 0x19, 0x8B, 0x19, 0x8B, 0x19, 0x8B, 0x19, 0x8B, 0x19, 0x8B, 0x19, 0x8B, 0x19, 0x8B, 0x19, 0x8A, 0x19, 0x8A, 0x19, 0x8A, 0x19, 
+0x8A, 0x19, 0x8A, 0x19, 0x8A, 0x19, 0x8A, 0x19, 0x8A, 0x19, 0xAB, 0x11, 0x8A, 0x11, 0x8A, 0x11, 0xAB, 0x11, 0x8A, 0x11, 0x8A, 0x11, 0xEC, 0x21, 0x6E, 0x32, 0xF6, 0x33, 0x78, 0x1C, 0x79, 0x04, 
+0x1A, 0x0C, 0x78, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD9, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xF9, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xFE, 0xFF, 0x3C, 0xE7, 0x97, 0xAD, 0xB6, 0x23, 0xB8, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 0x98, 0x03, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0x19, 0x0C, 0x59, 0x0C, 
+0x7A, 0x0C, 0x7B, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0x9B, 0x04, 0xBB, 0x0C, 0x9A, 0x14, 0x79, 0x0C, 0x9A, 0x14, 0xDB, 0x14, 0xDB, 0x0C, 
+0xBB, 0x04, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 
+0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x14, 0xBB, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 
+0x9A, 0x14, 0x18, 0x04, 0xD8, 0x0B, 0xD8, 0x03, 0xB8, 0x0B, 0x98, 0x0B, 0xD9, 0x0B, 0xB8, 0x0B, 0xF8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 
+0xD8, 0x0B, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x97, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0x39, 0x0C, 0x59, 0x04, 0x79, 0x04, 0x9A, 0x04, 0x9A, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBA, 0x04, 
+0xBA, 0x04, 0xBB, 0x0C, 0x9B, 0x0C, 0x9B, 0x0C, 0xBA, 0x14, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 
+0x5A, 0x0C, 0x5A, 0x0C, 0x19, 0x0C, 0xD9, 0x03, 0xB8, 0x03, 0x19, 0x04, 0x79, 0x0B, 0xB9, 0x13, 0x97, 0x03, 0xD8, 0x03, 0xF9, 0x0B, 0x98, 0x13, 0xD7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 
+0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x3D, 0xE7, 0x96, 0xAD, 0xB6, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xD7, 0x03, 0xD8, 0x03, 0xF8, 0x0B, 0x39, 0x0C, 0x59, 0x0C, 0x79, 0x0C, 
+0x7A, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xDA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x04, 0xBA, 0x04, 0xBA, 0x04, 0xBA, 0x04, 
+0xBA, 0x04, 0xBA, 0x04, 0xBA, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 
+0x5A, 0x0C, 0x39, 0x0C, 0x39, 0x0C, 0xF9, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0xB7, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0x59, 0x0C, 0x59, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 
+0x5A, 0x0C, 0x39, 0x0C, 0x19, 0x0C, 0xF9, 0x03, 0xF8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0x97, 0xAD, 0x5C, 0xEF, 
+0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0x18, 0x04, 
+0x19, 0x0C, 0x39, 0x0C, 0x39, 0x0C, 0x39, 0x0C, 0x59, 0x0C, 0x59, 0x0C, 0x59, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x5A, 0x0C, 0x59, 0x0C, 0x3A, 0x0C, 0x39, 0x0C, 0x39, 0x0C, 0x19, 0x0C, 0x19, 0x0C, 
+0x18, 0x04, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 
+0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB5, 0x1B, 0x97, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 
+0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0xD7, 0x03, 0xD7, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 
+0xB7, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 
+0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0xB7, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0x95, 0x23, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 
+0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0xB7, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0xB6, 0xAD, 
+0xB6, 0x23, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 
+0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x23, 0xB7, 0xAD, 0x5C, 0xEF, 
+0xDE, 0xF7, 0xDE, 0xFF, 0x7D, 0xEF, 0xB7, 0xAD, 0xB6, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 
+0xB7, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xD6, 0x23, 0xD7, 0xAD, 0x7C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x7D, 0xEF, 0xD7, 0xB5, 0xD6, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 
+0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x76, 0x03, 0x76, 0x03, 0x76, 0x03, 0x76, 0x03, 0x76, 0x03, 0x76, 0x03, 0x56, 0x03, 0x56, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 
+0x76, 0x03, 0x76, 0x03, 0x76, 0x03, 0x77, 0x0B, 0x97, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xF6, 0x2B, 0xD8, 0xB5, 0x9D, 0xEF, 0xFF, 0xF7, 0xFF, 0xF7, 0x9E, 0xF7, 0x59, 0xBE, 0x14, 0x3C, 0x77, 0x03, 0xB8, 0x13, 0xD6, 0x13, 
+0x99, 0x03, 0xB8, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0x98, 0x0B, 0x98, 0x0B, 0xD7, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0xB0, 0x02, 0x96, 0x13, 0xB8, 0x0B, 0xD9, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0x97, 0x03, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xD8, 0x0B, 0x97, 0x13, 0x76, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x79, 0x0B, 0xD8, 0x0B, 0xB7, 0x0B, 0xB8, 0x13, 0x97, 0x0B, 0x97, 0x03, 0xB8, 0x03, 0x97, 0x03, 
+0xD8, 0x0B, 0xB7, 0x0B, 0xDA, 0x03, 0xF7, 0x0B, 0xD7, 0x03, 0x19, 0x0C, 0xD6, 0x13, 0xB8, 0x03, 0x99, 0x03, 0xF8, 0x0B, 0x19, 0x0C, 0xB7, 0x03, 0xB7, 0x0B, 0xF8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 
+0xB7, 0x0B, 0xB8, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0x97, 0x03, 0xD8, 0x0B, 0xB8, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xF3, 0x53, 0x7C, 0xB6, 0x9E, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0xDA, 0xD6, 
+0x95, 0x64, 0x97, 0x0B, 0x97, 0x03, 0x96, 0x13, 0xD9, 0x03, 0x97, 0x03, 0x97, 0x03, 0xD7, 0x03, 0xB8, 0x0B, 0xB9, 0x0B, 0x76, 0x03, 0x05, 0x09, 0xDA, 0xD6, 0x9E, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0x8C, 0x61, 0x08, 0x91, 0x02, 0x96, 0x0B, 0xB8, 0x03, 0x98, 0x03, 0x97, 0x03, 0xD8, 0x0B, 0x97, 0x03, 0x98, 0x03, 0x98, 0x0B, 0x57, 0x03, 0xD9, 0x13, 
+0x98, 0x0B, 0x98, 0x0B, 0x77, 0x0B, 0x77, 0x03, 0xD8, 0x13, 0xB7, 0x03, 0x97, 0x13, 0x36, 0x03, 0x88, 0x42, 0x54, 0xA5, 0x89, 0x5A, 0x00, 0x00, 0xB8, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 
+0xB8, 0x03, 0x98, 0x03, 0xB9, 0x03, 0xD8, 0x03, 0xB7, 0x03, 0x0E, 0x02, 0x0D, 0x02, 0x0D, 0x0A, 0x0D, 0x12, 0xD1, 0x02, 0xB7, 0x03, 0xB7, 0x0B, 0xD7, 0x03, 0xF7, 0x0B, 0x96, 0x03, 0xD7, 0x0B, 
+0xD7, 0x0B, 0x96, 0x03, 0xB7, 0x03, 0xD8, 0x0B, 0xD7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB6, 0x0B, 0x95, 0x6C, 0xDC, 0xC6, 0xBE, 0xF7, 
+0xDE, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x3C, 0xEF, 0x57, 0x95, 0xB5, 0x13, 0x77, 0x03, 0x77, 0x0B, 0xD7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xD7, 0x03, 0x97, 0x03, 0x98, 0x0B, 0xF8, 0x0B, 0x26, 0x09, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xBE, 0xF7, 0x97, 0xB5, 0x42, 0x10, 0xB2, 0x02, 0x96, 0x13, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0x97, 0x0B, 0x76, 0x03, 
+0xB8, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xD8, 0x0B, 0x97, 0x03, 0x76, 0x03, 0xF8, 0x13, 0x96, 0x03, 0x97, 0x0B, 0xFB, 0xDE, 0xDE, 0xFF, 0x1B, 0xE7, 0x00, 0x00, 
+0xB7, 0x03, 0xFB, 0x03, 0xB8, 0x03, 0x76, 0x03, 0x96, 0x13, 0x75, 0x0B, 0x55, 0x03, 0xB7, 0x0B, 0x96, 0x03, 0xE4, 0x08, 0xE2, 0x10, 0x62, 0x08, 0x00, 0x00, 0x0C, 0x0A, 0x99, 0x03, 0xF9, 0x0B, 
+0xD7, 0x03, 0xB7, 0x03, 0x19, 0x0C, 0x97, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0x97, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD7, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xF7, 0x13, 0xB7, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 
+0xB5, 0x1B, 0x77, 0x9D, 0x3D, 0xDF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xF7, 0x3A, 0xBE, 0xB4, 0x33, 0x97, 0x03, 0xB8, 0x03, 0x96, 0x0B, 0x97, 0x0B, 0x97, 0x03, 0x96, 0x03, 
+0xB8, 0x0B, 0x77, 0x03, 0xB6, 0x03, 0x26, 0x11, 0xBE, 0xF7, 0xFF, 0xEF, 0x34, 0x95, 0x4D, 0x63, 0x8E, 0x6B, 0x6D, 0x6B, 0x8D, 0x73, 0xA4, 0x39, 0x00, 0x08, 0xB2, 0x02, 0x76, 0x0B, 0x76, 0x03, 
+0x97, 0x03, 0x77, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x03, 0x76, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xD8, 0x0B, 0xB7, 0x03, 0x97, 0x0B, 0xF7, 0x03, 0x76, 0x0B, 
+0xBE, 0xC6, 0xBF, 0xEF, 0x1B, 0xDF, 0x40, 0x00, 0xB7, 0x0B, 0x56, 0x03, 0xD7, 0x13, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x03, 0x98, 0x03, 0xB8, 0x0B, 0xB7, 0x0B, 0x48, 0x32, 0xDB, 0xD6, 0xD8, 0xAD, 
+0x40, 0x10, 0xAC, 0x09, 0xDB, 0x03, 0x76, 0x0B, 0x78, 0x03, 0x96, 0x0B, 0xB7, 0x0B, 0xB8, 0x03, 0x99, 0x03, 0x98, 0x03, 0xF7, 0x1B, 0x95, 0x13, 0xB7, 0x13, 0xB6, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 
+0x96, 0x0B, 0x97, 0x03, 0xFA, 0x03, 0x97, 0x03, 0x93, 0x2B, 0x39, 0xC6, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x9D, 0xF7, 0xFB, 0xD6, 0x75, 0x6C, 0x76, 0x0B, 0xF9, 0x03, 
+0x96, 0x0B, 0x76, 0x03, 0xB8, 0x0B, 0x96, 0x03, 0x98, 0x0B, 0xB8, 0x13, 0x76, 0x03, 0x25, 0x11, 0xFF, 0xFF, 0xDD, 0xFF, 0x09, 0x32, 0x2D, 0x02, 0x96, 0x03, 0x97, 0x03, 0xB6, 0x0B, 0x6F, 0x12, 
+0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x08, 0x79, 0xDE, 0xFF, 0xFF, 0xB9, 0xE6, 0x00, 0x00, 0x19, 0x04, 0x6D, 0x22, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x08, 0x42, 0xDF, 0xFF, 0x9B, 0xFF, 0x41, 0x00, 0x00, 0x08, 0x20, 0x00, 0x96, 0x03, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x63, 0x00, 0x54, 0x1B, 
+0xDA, 0x03, 0x96, 0x0B, 0xB8, 0x03, 0xD9, 0x03, 0x77, 0x03, 0xB8, 0x0B, 0xFA, 0x0B, 0x55, 0x13, 0x96, 0x5C, 0xDA, 0xDE, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xDF, 0xF7, 
+0x7D, 0xE7, 0xB8, 0xA5, 0x73, 0x23, 0xD7, 0x03, 0x96, 0x0B, 0x77, 0x03, 0xB7, 0x0B, 0xD7, 0x03, 0x57, 0x03, 0xD8, 0x13, 0xD7, 0x0B, 0xE5, 0x08, 0xDF, 0xFF, 0xFF, 0xFF, 0x28, 0x4A, 0x00, 0x08, 
+0x00, 0x00, 0x21, 0x00, 0x01, 0x00, 0x41, 0x00, 0x8A, 0x4A, 0x9D, 0xEF, 0xB2, 0x94, 0x48, 0x4A, 0xFB, 0xDE, 0xBA, 0xD6, 0x49, 0x42, 0x92, 0x8C, 0x5C, 0xE7, 0x1C, 0xE7, 0x28, 0x42, 0x00, 0x00, 
+0xEB, 0x5A, 0xEF, 0x7B, 0xC3, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xB3, 0x8C, 0x03, 0x21, 0x00, 0x00, 0xBB, 0xD6, 0xDF, 0xF7, 0xDB, 0xDE, 0x00, 0x08, 0xF2, 0x0A, 0x00, 0x00, 0xC7, 0x39, 0x59, 0xCE, 
+0x7E, 0xEF, 0x19, 0xBE, 0x87, 0x21, 0x00, 0x00, 0xF0, 0x7B, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0xFF, 0x87, 0x52, 0x40, 0x00, 0x01, 0x00, 0xC6, 0x39, 0xB6, 0xB5, 0x9D, 0xF7, 0x1B, 0xE7, 
+0x55, 0xAD, 0xC3, 0x18, 0x00, 0x00, 0x8A, 0x01, 0x77, 0x03, 0xB7, 0x0B, 0xB8, 0x03, 0xD9, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0x97, 0x0B, 0x94, 0x33, 0xB8, 0x9D, 0x5C, 0xEF, 0xDE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xBA, 0xD6, 0x75, 0x64, 0x96, 0x13, 0x76, 0x0B, 0xD8, 0x13, 0x56, 0x03, 0xD7, 0x03, 0x97, 0x0B, 0x98, 0x0B, 0x96, 0x03, 0xE5, 0x08, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xCF, 0x7B, 0xFB, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x52, 0x61, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x9D, 0x40, 0x00, 0xBB, 0xD6, 0xFF, 0xFF, 0xFC, 0xCE, 0x00, 0x00, 
+0x23, 0x00, 0x6E, 0x5B, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0x40, 0x08, 0x13, 0xA5, 0xFE, 0xFF, 0xBD, 0xEF, 0xFF, 0xF7, 0xFE, 0xFF, 0xEE, 0x7B, 0x21, 0x00, 0x48, 0x62, 
+0x9F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xD6, 0x41, 0x00, 0x8A, 0x01, 0xD9, 0x0B, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x0B, 0x75, 0x13, 0x95, 0x64, 
+0x9A, 0xCE, 0x9D, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xBE, 0xFF, 0x5C, 0xEF, 0xF9, 0xA5, 0xB6, 0x33, 0xB7, 0x0B, 0x77, 0x03, 0xB7, 0x0B, 0xB6, 0x03, 
+0x97, 0x0B, 0x77, 0x0B, 0xD7, 0x0B, 0x05, 0x11, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x54, 0xA5, 0xBE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0xEF, 
+0x7D, 0xEF, 0xFF, 0xFF, 0xDF, 0xF7, 0x9A, 0xD6, 0x9A, 0xD6, 0xFF, 0xFF, 0xDF, 0xFF, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xEC, 0x62, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x9C, 0x00, 0x00, 
+0xB9, 0xC6, 0xFE, 0xFF, 0xDD, 0xCE, 0x00, 0x00, 0x64, 0x41, 0x7D, 0xEF, 0xFF, 0xFF, 0x1B, 0xE7, 0xD7, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x07, 0x42, 0xD5, 0xBD, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xB2, 0x9C, 0x47, 0x29, 0xC3, 0x18, 0x16, 0xBE, 0xFF, 0xF7, 0xDF, 0xF7, 0x54, 0xAD, 0x54, 0xAD, 0x7D, 0xE7, 0xFF, 0xFF, 0x81, 0x10, 0x48, 0x01, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB6, 0x0B, 
+0xB8, 0x03, 0xB7, 0x0B, 0xD5, 0x2B, 0xF9, 0xA5, 0x5B, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0x1C, 0xD7, 0x78, 0x85, 
+0x51, 0x2B, 0xD7, 0x13, 0x75, 0x0B, 0xB7, 0x0B, 0x96, 0x0B, 0x96, 0x0B, 0xB7, 0x0B, 0xC4, 0x10, 0xFF, 0xFF, 0xFE, 0xFF, 0x70, 0x8C, 0xCB, 0x5A, 0x0C, 0x63, 0xEC, 0x5A, 0xEB, 0x5A, 0x03, 0x19, 
+0x3B, 0xDF, 0xFF, 0xFF, 0x9D, 0xEF, 0x89, 0x4A, 0xB6, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x10, 0x8D, 0x6B, 0xFF, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0x52, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xA5, 0x00, 0x00, 0xD9, 0xDE, 0xFE, 0xFF, 0xDA, 0xDE, 0x20, 0x00, 0x51, 0x74, 0xDF, 0xF7, 0xFE, 0xFF, 0xE6, 0x39, 0x69, 0x52, 0xDF, 0xFF, 0xFE, 0xFF, 0x60, 0x00, 
+0xCC, 0x09, 0xAD, 0x3A, 0xDE, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xCD, 0x01, 0xAB, 0x42, 0x7E, 0xF7, 0xFF, 0xFF, 0x51, 0x8C, 0x0B, 0x63, 0x75, 0xA5, 0x9F, 0xE7, 0x30, 0x8C, 0x00, 0x08, 0x89, 0x09, 
+0xB7, 0x0B, 0xD8, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xB6, 0x23, 0x38, 0x85, 0xFB, 0xDE, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0x9E, 0xEF, 0x5A, 0xB6, 0xB5, 0x6C, 0x53, 0x13, 0xB8, 0x03, 0xFA, 0x03, 0xB7, 0x0B, 0xB8, 0x03, 0x98, 0x03, 0x04, 0x11, 0xBF, 0xFF, 0xBF, 0xFF, 0x0B, 0x32, 0x0D, 0x02, 
+0x55, 0x0B, 0x75, 0x13, 0xED, 0x01, 0xE6, 0x00, 0x3D, 0xEF, 0xFF, 0xFF, 0x58, 0xCE, 0x00, 0x00, 0x75, 0xAD, 0xFF, 0xFF, 0xBE, 0xF7, 0x00, 0x00, 0x8E, 0x73, 0xFF, 0xFF, 0xDF, 0xFF, 0x00, 0x00, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0x5A, 0x20, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x94, 0x42, 0x00, 0xBB, 0xD6, 0xFF, 0xFF, 0xBB, 0xE6, 0x00, 0x00, 0xB3, 0x9C, 0xFF, 0xF7, 0xFF, 0xFF, 0x41, 0x00, 
+0x8A, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0x61, 0x00, 0xB0, 0x0A, 0x0E, 0x53, 0xDF, 0xF7, 0xFF, 0xF7, 0x00, 0x00, 0x6F, 0x0A, 0xEC, 0x4A, 0xFF, 0xFF, 0xFF, 0xF7, 0x9E, 0xF7, 0x9D, 0xF7, 0x38, 0xC6, 
+0x49, 0x3A, 0x20, 0x08, 0x00, 0x00, 0x89, 0x01, 0xB8, 0x03, 0x97, 0x03, 0xF9, 0x03, 0xB8, 0x03, 0x75, 0x1B, 0x95, 0x64, 0x39, 0xBE, 0x7D, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x5D, 0xE7, 0x59, 0xBE, 0x96, 0x5C, 0x76, 0x0B, 0x35, 0x03, 0x95, 0x1B, 0xD9, 0x03, 0xB9, 0x03, 0x25, 0x11, 
+0xFF, 0xF7, 0xFF, 0xFF, 0x68, 0x4A, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x08, 0x20, 0x00, 0x3B, 0xE7, 0xFF, 0xFF, 0xD7, 0xBD, 0x00, 0x00, 0x75, 0xAD, 0xBE, 0xF7, 0xFF, 0xFF, 0x41, 0x08, 
+0x2C, 0x63, 0xFF, 0xFF, 0xDF, 0xFF, 0x20, 0x00, 0x5D, 0xEF, 0xBE, 0xF7, 0x2C, 0x63, 0x61, 0x08, 0xDF, 0xFF, 0xBE, 0xFF, 0xF3, 0xA4, 0x00, 0x00, 0xDB, 0xD6, 0xFF, 0xF7, 0xDA, 0xD6, 0x20, 0x00, 
+0x4F, 0x8C, 0xFF, 0xFF, 0xBE, 0xFF, 0xC7, 0x31, 0xCE, 0x73, 0xDE, 0xFF, 0xFE, 0xFF, 0x41, 0x00, 0x2E, 0x02, 0x8A, 0x4A, 0xFF, 0xFF, 0xDF, 0xFF, 0x81, 0x00, 0x6E, 0x0A, 0xAB, 0x4A, 0xFE, 0xFF, 
+0xDF, 0xF7, 0x39, 0xB6, 0xC7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xCA, 0x01, 0x97, 0x03, 0xD8, 0x0B, 0x98, 0x03, 0x96, 0x13, 0x75, 0x64, 0x17, 0xBE, 0x5C, 0xEF, 0xDF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0x5C, 0xE7, 0x18, 0xB6, 0x75, 0x5C, 0x54, 0x23, 
+0x76, 0x0B, 0x76, 0x03, 0x95, 0x13, 0xC2, 0x10, 0xFB, 0xD6, 0xDF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x72, 0x94, 0xBE, 0xF7, 0xFF, 0xFF, 0x38, 0xBE, 0x00, 0x00, 
+0x96, 0xAD, 0xFF, 0xFF, 0xDF, 0xF7, 0x00, 0x00, 0x6D, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xD7, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x34, 0x9D, 0x20, 0x00, 
+0xDB, 0xCE, 0xFF, 0xFF, 0xDA, 0xD6, 0x20, 0x00, 0xCB, 0x52, 0xBD, 0xF7, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xBD, 0xFF, 0x41, 0x00, 0xB0, 0x02, 0x0D, 0x53, 0xDE, 0xEF, 0xFE, 0xFF, 
+0x40, 0x00, 0x0E, 0x02, 0x0B, 0x22, 0x78, 0xC6, 0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0x21, 0x00, 0x8A, 0x01, 0x96, 0x13, 0xB8, 0x0B, 0x54, 0x13, 0x54, 0x5C, 
+0x18, 0xBE, 0x5C, 0xEF, 0xDF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xF7, 0x5D, 0xDF, 0x39, 0xBE, 0x75, 0x6C, 0x96, 0x1B, 0xD8, 0x0B, 0x97, 0x03, 0xA4, 0x00, 0x09, 0x73, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0x13, 0x9D, 
+0xB2, 0x94, 0xDA, 0xDE, 0x0F, 0x84, 0x00, 0x00, 0xCE, 0x7B, 0xBA, 0xDE, 0xB6, 0xBD, 0x20, 0x08, 0x48, 0x4A, 0x99, 0xDE, 0x79, 0xD6, 0x00, 0x00, 0x69, 0x52, 0x3C, 0xEF, 0xDE, 0xFF, 0xFF, 0xFF, 
+0x5C, 0xEF, 0xFF, 0xFF, 0x92, 0x94, 0x00, 0x00, 0x50, 0x94, 0xDA, 0xE6, 0x31, 0x8C, 0x01, 0x00, 0x43, 0x00, 0xD2, 0x9C, 0xBF, 0xFF, 0xFF, 0xFF, 0xDA, 0xD6, 0xFA, 0xDE, 0xDF, 0xFF, 0x21, 0x00, 
+0x2E, 0x02, 0x49, 0x3A, 0xDC, 0xD6, 0xD7, 0xB5, 0x62, 0x00, 0x0D, 0x0A, 0xE6, 0x00, 0x29, 0x42, 0x39, 0xBE, 0x7E, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0x1B, 0xE7, 0xB2, 0xA4, 0x42, 0x10, 0x29, 0x01, 
+0x95, 0x0B, 0xB6, 0x23, 0x95, 0x6C, 0x18, 0xC6, 0x5C, 0xEF, 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x5C, 0xEF, 0x9A, 0xD6, 0x17, 0x7D, 0xB3, 0x3B, 0xD9, 0x03, 0x13, 0x0B, 0x63, 0x00, 0x64, 0x39, 0x07, 0x4A, 0xAA, 0x52, 
+0xAB, 0x4A, 0x8A, 0x4A, 0x28, 0x42, 0xE3, 0x20, 0x20, 0x10, 0x85, 0x29, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x65, 0x29, 0x82, 0x08, 0x00, 0x00, 0x20, 0x00, 0x45, 0x21, 0x81, 0x08, 0x20, 0x00, 
+0x41, 0x00, 0x65, 0x29, 0x69, 0x4A, 0x69, 0x4A, 0xA6, 0x31, 0x4A, 0x4A, 0xE3, 0x18, 0x40, 0x08, 0x40, 0x08, 0x44, 0x29, 0x61, 0x00, 0x42, 0x00, 0xCD, 0x2A, 0xA2, 0x10, 0xE8, 0x39, 0x6B, 0x42, 
+0x86, 0x31, 0x24, 0x21, 0xE8, 0x39, 0x41, 0x00, 0x6D, 0x1A, 0xC6, 0x00, 0x25, 0x21, 0x80, 0x18, 0x20, 0x00, 0x0D, 0x0A, 0x32, 0x23, 0x02, 0x00, 0xA0, 0x20, 0x28, 0x42, 0xAA, 0x52, 0xE7, 0x41, 
+0x85, 0x31, 0x00, 0x00, 0x22, 0x00, 0x6E, 0x1A, 0xD6, 0x33, 0x17, 0x7D, 0x7A, 0xC6, 0x7C, 0xF7, 0xBF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFF, 0xDF, 0xF7, 0x7E, 0xE7, 0xFC, 0xDE, 0x16, 0xC6, 0x14, 0x54, 0xD6, 0x2B, 
+0x55, 0x0B, 0x75, 0x03, 0x96, 0x0B, 0x56, 0x0B, 0x76, 0x0B, 0x77, 0x0B, 0xB7, 0x0B, 0x76, 0x03, 0x96, 0x03, 0x76, 0x03, 0x97, 0x0B, 0xB7, 0x0B, 0x35, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x76, 0x03, 
+0xD8, 0x13, 0x97, 0x0B, 0xB7, 0x0B, 0x97, 0x0B, 0x56, 0x03, 0x56, 0x03, 0xD8, 0x13, 0x97, 0x0B, 0x76, 0x03, 0xB6, 0x03, 0x96, 0x03, 0x96, 0x03, 0x55, 0x03, 0xB6, 0x13, 0x96, 0x0B, 0x77, 0x03, 
+0x98, 0x03, 0x76, 0x13, 0x76, 0x03, 0x97, 0x03, 0x54, 0x13, 0x76, 0x13, 0x56, 0x03, 0x95, 0x13, 0x57, 0x03, 0x55, 0x0B, 0x76, 0x0B, 0x77, 0x03, 0x78, 0x03, 0xB7, 0x13, 0xF8, 0x13, 0x77, 0x03, 
+0x56, 0x03, 0xB8, 0x03, 0xDA, 0x03, 0x79, 0x03, 0x57, 0x03, 0xD7, 0x13, 0xB3, 0x23, 0x53, 0x64, 0xB8, 0xB5, 0xDB, 0xDE, 0x9E, 0xF7, 0xDF, 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 
+0xBE, 0xF7, 0x3C, 0xEF, 0xDB, 0xCE, 0xB7, 0xAD, 0x74, 0x6C, 0x96, 0x23, 0x76, 0x13, 0xB7, 0x13, 0x96, 0x0B, 0x96, 0x0B, 0x76, 0x03, 0x77, 0x0B, 0x77, 0x0B, 0xB7, 0x0B, 0x76, 0x03, 0xB7, 0x0B, 
+0xB7, 0x0B, 0x97, 0x03, 0x97, 0x0B, 0x76, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x0B, 0x76, 0x03, 0x76, 0x03, 0x97, 0x03, 0x77, 0x0B, 0x77, 0x0B, 0x98, 0x0B, 
+0xB8, 0x0B, 0x77, 0x03, 0x77, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x76, 0x03, 0xD8, 0x03, 0xB7, 0x03, 0x55, 0x0B, 0xB8, 0x0B, 0xD8, 0x03, 0x75, 0x03, 0xB8, 0x0B, 0x97, 0x0B, 0x96, 0x03, 0x97, 0x03, 
+0xF9, 0x03, 0x95, 0x0B, 0x36, 0x03, 0xF9, 0x03, 0x76, 0x0B, 0x55, 0x13, 0x75, 0x0B, 0xF5, 0x1B, 0xD3, 0x2B, 0x34, 0x64, 0xB9, 0xAD, 0xBB, 0xD6, 0x5C, 0xE7, 0x9D, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0x19, 0xBE, 0x57, 0x9D, 0x75, 0x6C, 0xF4, 0x43, 0xB4, 0x2B, 0x95, 0x23, 0x95, 0x1B, 
+0x94, 0x1B, 0x1F, 0x80, 0x74, 0x1B, 0x33, 0x00, 0x94, 0x1B, 0x94, 0x1B, 0x94, 0x1B, 0x94, 0x1B, 0x74, 0x1B, 0x94, 0x1B, 0xB5, 0x23, 0xD5, 0x23, 0xD3, 0x4B, 0x74, 0x6C, 0x57, 0x9D, 0x59, 0xC6, 
+0xDA, 0xDE, 0x5C, 0xEF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 
+0x9C, 0xF7, 0x3B, 0xE7, 0xBA, 0xCE, 0x59, 0xBE, 0x19, 0xB6, 0xD8, 0xB5, 0xB7, 0xB5, 0x97, 0xB5, 0x1F, 0x80, 0x97, 0xAD, 0x33, 0x00, 0x77, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 
+0x97, 0xAD, 0xB7, 0xB5, 0xD8, 0xB5, 0x7B, 0xB6, 0xDC, 0xC6, 0x3D, 0xDF, 0x7D, 0xEF, 0x9D, 0xF7, 0xBE, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xDF, 0xF7, 0xBF, 0xF7, 0x9E, 0xEF, 0x7E, 0xEF, 0x5D, 0xEF, 0x5C, 0xE7, 0x3B, 0xE7, 0x1F, 0x80, 
+0x5C, 0xEF, 0x09, 0x00, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x9D, 0xF7, 0xBE, 0xF7, 0xDE, 0xF7, 0x27, 0x80, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF7, 
+0x14, 0x00, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+};
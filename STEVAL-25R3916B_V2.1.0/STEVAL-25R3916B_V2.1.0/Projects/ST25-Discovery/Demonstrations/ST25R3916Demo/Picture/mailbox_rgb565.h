@@ -0,0 +1,261 @@
+/* 64x64 RGB565 raw picture converted from mailbox_jpg.h by pict2rgb565, 8208 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char mailbox[] = {
+0x52, 0x35, 0x36, 0x35, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xDF, 0xE7, 0x7E, 0xD7, 0xDD, 0xAE, 0x7C, 0x8E, 0x1C, 0x6E, 0xDC, 0x55, 0x9B, 0x45, 0x5B, 0x35, 0x5B, 0x35, 0x9B, 0x45, 0xDC, 0x55, 0x1C, 0x6E, 0x7C, 0x8E, 0xDD, 0xAE, 0x7E, 0xD7, 0xDF, 0xE7, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xF7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBF, 0xE7, 0xFF, 0x9E, 0x9C, 0x4D, 
+0x5B, 0x3D, 0x3B, 0x3D, 0x3B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x7B, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x3B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 
+0x9C, 0x4D, 0xFF, 0x9E, 0xBF, 0xE7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x1D, 0xB7, 0x9A, 0x55, 0x1A, 0x35, 0x5C, 0x3D, 0x3B, 0x3D, 
+0x3B, 0x35, 0x5B, 0x35, 0x5C, 0x35, 0x5C, 0x35, 0x5B, 0x3D, 0x3B, 0x3D, 0x1B, 0x3D, 0x1A, 0x3D, 0x1A, 0x3D, 0x1B, 0x3D, 0x3B, 0x3D, 0x5B, 0x3D, 0x5C, 0x35, 0x5C, 0x35, 0x5B, 0x35, 0x3B, 0x35, 
+0x3B, 0x3D, 0x5C, 0x3D, 0x1A, 0x35, 0x9A, 0x55, 0x1D, 0xB7, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x9C, 0x9E, 0x7C, 0x55, 0x3C, 0x3D, 0x3B, 0x3D, 0x5A, 0x3D, 0x7B, 0x3D, 0x5B, 0x2D, 
+0x39, 0x3D, 0x59, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5C, 0x3D, 0x5C, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5A, 0x35, 0x5A, 0x3D, 0x5A, 0x3D, 0x59, 0x3D, 0x39, 0x3D, 
+0x5B, 0x2D, 0x7B, 0x3D, 0x5A, 0x3D, 0x3B, 0x3D, 0x3C, 0x3D, 0x7C, 0x55, 0x9C, 0x9E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xBE, 0xAE, 0x7A, 0x45, 0x5A, 0x45, 0x3A, 0x3D, 0x3B, 0x35, 0x5C, 0x35, 0x3B, 0x35, 0x3A, 0x35, 0x59, 0x3D, 
+0x7C, 0x3D, 0x7C, 0x3D, 0x5C, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5C, 0x35, 0x7C, 0x3D, 0x7C, 0x3D, 
+0x59, 0x3D, 0x3A, 0x35, 0x3B, 0x35, 0x5C, 0x35, 0x3B, 0x35, 0x3A, 0x3D, 0x5A, 0x45, 0x7A, 0x45, 0xBE, 0xAE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xE7, 0xFA, 0x75, 0x5B, 0x45, 0x1A, 0x35, 0x7C, 0x3D, 0x7B, 0x35, 0x5B, 0x2D, 0x9B, 0x3D, 0x7B, 0x3D, 0x3A, 0x3D, 0x3B, 0x3D, 
+0x1C, 0x3D, 0x1B, 0x35, 0x1B, 0x35, 0x3B, 0x3D, 0x3B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x3B, 0x3D, 0x3B, 0x3D, 0x1B, 0x35, 0x1B, 0x35, 0x1C, 0x3D, 
+0x3B, 0x3D, 0x3A, 0x3D, 0x7B, 0x3D, 0x9B, 0x3D, 0x7B, 0x2D, 0x7B, 0x35, 0x7C, 0x3D, 0x1A, 0x35, 0x5B, 0x45, 0x1A, 0x76, 0xFF, 0xE7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0x9F, 0xCF, 0x39, 0x45, 0x5B, 0x2D, 0x3A, 0x35, 0x5A, 0x3D, 0x5B, 0x35, 0x3B, 0x35, 0x3B, 0x3D, 0x3B, 0x3D, 0x1A, 0x3D, 0x3A, 0x35, 0x9C, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x35, 0x5A, 0x35, 0x5A, 0x35, 0x5B, 0x2D, 0x5B, 0x2D, 0x5A, 0x35, 0x5A, 0x35, 0x5A, 0x35, 0x5A, 0x3D, 0x5A, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 
+0x9C, 0x35, 0x3A, 0x35, 0x1A, 0x3D, 0x3B, 0x45, 0x3B, 0x35, 0x3B, 0x35, 0x5B, 0x35, 0x5A, 0x35, 0x3A, 0x35, 0x5B, 0x2D, 0x39, 0x45, 0x9F, 0xCF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xDD, 0xA6, 0x3B, 0x45, 0x3D, 0x35, 0x5C, 0x35, 0x7B, 0x3D, 0x5B, 0x45, 0x3B, 0x3D, 0x5B, 0x3D, 0x7B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5B, 0x3D, 0x3B, 0x35, 
+0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 
+0x3B, 0x35, 0x5B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x7B, 0x3D, 0x5B, 0x3D, 0x3B, 0x3D, 0x5B, 0x45, 0x7B, 0x3D, 0x5C, 0x35, 0x3D, 0x35, 0x3B, 0x45, 0xDD, 0xA6, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 
+0xFE, 0xFF, 0xFF, 0xEF, 0x3C, 0x7E, 0x3A, 0x35, 0x9C, 0x3D, 0x3B, 0x3D, 0xFA, 0x34, 0x7C, 0x3D, 0x3A, 0x35, 0x5A, 0x3D, 0x7B, 0x3D, 0x5C, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x7B, 0x3D, 
+0x5A, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0x3B, 0x35, 0x5B, 0x35, 0x7B, 0x3D, 0x3A, 0x35, 0x5A, 0x45, 0x7B, 0x3D, 0x3A, 0x35, 0x3A, 0x3D, 0x5A, 0x3D, 0x3A, 0x35, 0x5A, 0x35, 0x5B, 0x3D, 0x3B, 0x35, 
+0x5A, 0x35, 0x5A, 0x35, 0x5B, 0x35, 0x3B, 0x35, 0x3B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x3B, 0x3D, 0x99, 0x2D, 0x3C, 0x35, 0x5A, 0x3D, 0x5A, 0x35, 0x5A, 0x35, 0x3C, 0x7E, 0xDF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xF7, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xE7, 0x1A, 0x86, 0x39, 0x45, 0x5B, 0x3D, 0x3B, 0x35, 0x7B, 0x35, 0x7B, 0x3D, 0x1A, 0x35, 0x5B, 0x3D, 0x5B, 0x35, 0x3B, 0x35, 0x3B, 0x35, 0x3A, 0x35, 0x5A, 0x3D, 0x3A, 0x3D, 0x3A, 0x35, 
+0x7B, 0x3D, 0x9B, 0x35, 0x7A, 0x35, 0x7A, 0x35, 0x5B, 0x3D, 0x1A, 0x3D, 0x3B, 0x35, 0x7C, 0x35, 0x3B, 0x3D, 0x5B, 0x3D, 0x7B, 0x3D, 0x7B, 0x35, 0x3C, 0x35, 0x1C, 0x3D, 0x3B, 0x3D, 0x3A, 0x3D, 
+0x3C, 0x3D, 0x5B, 0x35, 0x7A, 0x35, 0x5A, 0x35, 0x5B, 0x3D, 0x3B, 0x3D, 0x5A, 0x35, 0x59, 0x35, 0x5B, 0x3D, 0x3D, 0x55, 0xFB, 0x2C, 0x5B, 0x3D, 0xFD, 0x34, 0x5A, 0x35, 0xFB, 0x6D, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 
+0x3C, 0x7E, 0x19, 0x45, 0x5B, 0x35, 0x7C, 0x35, 0x1A, 0x35, 0x5A, 0x35, 0x5A, 0x35, 0x5B, 0x3D, 0x5B, 0x35, 0x3B, 0x35, 0x3B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x3D, 
+0x3D, 0x35, 0x3D, 0x45, 0xDB, 0x3C, 0x1B, 0x45, 0x7B, 0x3D, 0x7B, 0x35, 0x7B, 0x35, 0x3B, 0x35, 0x5A, 0x35, 0x5B, 0x35, 0x3C, 0x35, 0x3B, 0x35, 0x7A, 0x3D, 0x9A, 0x3D, 0x7A, 0x3D, 0x5A, 0x35, 
+0x5B, 0x35, 0x1A, 0x35, 0x3A, 0x3D, 0x9A, 0x5D, 0xFB, 0x75, 0xFC, 0x75, 0xDD, 0x65, 0xDE, 0x55, 0x1B, 0x35, 0x3A, 0x3D, 0x78, 0x3D, 0x3A, 0x35, 0x9C, 0x35, 0x59, 0x35, 0x3B, 0x45, 0x3F, 0x76, 
+0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAE, 
+0x3A, 0x35, 0x5B, 0x3D, 0x7C, 0x35, 0x5B, 0x2D, 0x5B, 0x35, 0x5B, 0x45, 0x1A, 0x3D, 0x7B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x5A, 0x3D, 0x3A, 0x3D, 0x3A, 0x35, 0x3B, 0x35, 0x5B, 0x35, 
+0x39, 0x35, 0x7B, 0x3D, 0x5A, 0x35, 0x59, 0x2D, 0x5A, 0x35, 0x3A, 0x35, 0x5B, 0x3D, 0x5B, 0x35, 0x7A, 0x35, 0x9A, 0x3D, 0x7A, 0x3D, 0x5A, 0x35, 0x5B, 0x3D, 0x3B, 0x45, 0xBB, 0x65, 0x5C, 0x8E, 
+0x7F, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBF, 0xFF, 0x7E, 0xEF, 0xBF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xC6, 0x3C, 0x5E, 0x3B, 0x35, 0x5A, 0x2D, 0x5B, 0x3D, 0x38, 0x3D, 0x3D, 0x3D, 
+0xFE, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x7F, 0xCF, 0x3B, 0x45, 
+0x7B, 0x35, 0x5B, 0x35, 0x3B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x1A, 0x45, 0x5B, 0x45, 0x5B, 0x35, 0x5B, 0x3D, 0x3B, 0x3D, 0x3A, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x7C, 0x35, 0x9C, 0x35, 
+0x3A, 0x3D, 0x3A, 0x35, 0x5C, 0x35, 0x5C, 0x35, 0x7D, 0x3D, 0x5C, 0x45, 0xFB, 0x3C, 0x1B, 0x45, 0x3C, 0x45, 0x3B, 0x45, 0x9B, 0x5D, 0xBD, 0xA6, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xBF, 0xF7, 0x3A, 0x96, 0x39, 0x3D, 0x7C, 0x25, 0xBD, 0x35, 0x5C, 0x3D, 0x1A, 0x35, 0x5B, 0x35, 0x9C, 0x45, 0xFB, 0xC6, 0xFF, 0xEF, 0xDE, 0xE7, 0x1B, 0x55, 0x5D, 0x35, 0x7A, 0x35, 0x7B, 0x35, 
+0x3B, 0x45, 0x7F, 0xCF, 0xDE, 0xF7, 0xFF, 0xFF, 0xBE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xE7, 0x39, 0x45, 0x5D, 0x35, 
+0x3B, 0x3D, 0x7B, 0x35, 0x5A, 0x35, 0x7B, 0x45, 0x1A, 0x45, 0xFA, 0x34, 0x7B, 0x3D, 0x3B, 0x3D, 0x5A, 0x3D, 0x3A, 0x35, 0x3A, 0x35, 0x5B, 0x3D, 0x7C, 0x3D, 0x5B, 0x35, 0x3B, 0x35, 0x3B, 0x35, 
+0x7B, 0x35, 0x1A, 0x35, 0x3B, 0x3D, 0x3B, 0x35, 0x1A, 0x2D, 0x19, 0x2D, 0x9A, 0x4D, 0xBF, 0x86, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xDF, 0xFF, 0x3E, 0xBF, 0x3B, 0x6E, 0x7B, 0x45, 0x7C, 0x45, 
+0x9B, 0x35, 0x7B, 0x35, 0x5A, 0x3D, 0x3B, 0x3D, 0x1C, 0x3D, 0x1C, 0x3D, 0x3A, 0x3D, 0x59, 0x3D, 0x5B, 0x2D, 0xB9, 0x2D, 0x3A, 0x45, 0xDF, 0xCF, 0xFF, 0xFF, 0x19, 0x35, 0x9D, 0x35, 0x39, 0x35, 
+0x5D, 0x35, 0x39, 0x45, 0xFF, 0xE7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x75, 0x7B, 0x35, 0x7C, 0x3D, 
+0x1A, 0x3D, 0x7B, 0x3D, 0x5A, 0x35, 0x3A, 0x3D, 0x5B, 0x45, 0x7B, 0x3D, 0x3A, 0x35, 0x1A, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x3A, 0x3D, 0x39, 0x45, 0x59, 0x4D, 
+0x3B, 0x3D, 0x3A, 0x45, 0xDB, 0x65, 0xDD, 0xA6, 0xBF, 0xE7, 0xDF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xDD, 0x9E, 0xFB, 0x6D, 0x5A, 0x35, 0x3B, 0x2D, 0x5C, 0x35, 0x3B, 0x3D, 0x5A, 0x3D, 0x5A, 0x35, 
+0x3C, 0x3D, 0x3C, 0x35, 0x3B, 0x35, 0x5A, 0x35, 0x79, 0x35, 0x79, 0x35, 0x5B, 0x35, 0x5C, 0x3D, 0xFB, 0x3C, 0x3B, 0x3D, 0x3C, 0x45, 0x3A, 0x2D, 0xBF, 0xF7, 0x9F, 0xC7, 0x5A, 0x35, 0x1C, 0x3D, 
+0x7C, 0x3D, 0x7B, 0x2D, 0xFA, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xAE, 0x5B, 0x45, 0x3A, 0x35, 0x7B, 0x3D, 
+0x7C, 0x3D, 0x3B, 0x35, 0x5B, 0x3D, 0x7B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x3A, 0x3D, 0x7B, 0x3D, 0x5A, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x9B, 0x55, 0x5D, 0x7E, 0x1F, 0x9F, 
+0x9E, 0xD7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xF7, 0x3E, 0xC7, 0x3C, 0x86, 0xBC, 0x55, 0x5C, 0x35, 0x5A, 0x35, 0x3A, 0x35, 0x5B, 0x3D, 0x7C, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x3A, 0x3D, 
+0x1A, 0x3D, 0x5A, 0x3D, 0x7B, 0x3D, 0x5B, 0x3D, 0x3B, 0x3D, 0x1B, 0x3D, 0x3B, 0x35, 0x5B, 0x35, 0x9A, 0x2D, 0x3B, 0x35, 0x39, 0x3D, 0x7C, 0x3D, 0x9A, 0x45, 0xDF, 0xFF, 0x7B, 0x4D, 0x3B, 0x35, 
+0x7B, 0x3D, 0x3A, 0x35, 0x5B, 0x45, 0xDE, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0x5B, 0x45, 0x5B, 0x35, 0x9B, 0x3D, 0x1B, 0x3D, 
+0x5C, 0x3D, 0x19, 0x45, 0x3C, 0x3D, 0x7B, 0x1D, 0x9B, 0x3D, 0x1C, 0x2D, 0x1C, 0x4D, 0x9B, 0x35, 0x3B, 0x35, 0x7C, 0x3D, 0xFC, 0x75, 0x1D, 0xCF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0x9D, 0xE7, 
+0xFE, 0xF7, 0xFF, 0xFF, 0x9F, 0xD7, 0x7D, 0x8E, 0x3A, 0x3D, 0x3A, 0x3D, 0x5A, 0x4D, 0x5A, 0x35, 0x5A, 0x35, 0x5C, 0x3D, 0x5B, 0x3D, 0x3A, 0x3D, 0x3C, 0x3D, 0x5B, 0x35, 0x5A, 0x35, 0x3B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x5C, 0x3D, 0x3C, 0x45, 0x3A, 0x35, 0x3A, 0x3D, 0x7F, 0xD7, 0x5C, 0x96, 0x3A, 0x35, 
+0x3B, 0x3D, 0x7A, 0x3D, 0x3B, 0x3D, 0x5A, 0x45, 0xFF, 0xF7, 0xBF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x9E, 0x5A, 0x45, 0x7C, 0x35, 0x5B, 0x35, 0x3A, 0x3D, 
+0x3B, 0x2D, 0x9B, 0x2D, 0x5B, 0x3D, 0x1C, 0x45, 0x5A, 0x3D, 0x78, 0x3D, 0x9A, 0x3D, 0xFA, 0x34, 0x5A, 0x3D, 0x5F, 0xC7, 0xDE, 0xFF, 0xDF, 0xE7, 0xDF, 0xA6, 0x3B, 0x45, 0x3B, 0x35, 0x5C, 0x45, 
+0x1A, 0x3D, 0x3C, 0x76, 0x1E, 0xD7, 0xFE, 0xFF, 0xFF, 0xEF, 0x7D, 0x8E, 0x3C, 0x35, 0x9C, 0x35, 0x9C, 0x35, 0xFA, 0x3C, 0x9C, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0x5B, 0x35, 0x3B, 0x35, 0x5B, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x3B, 0x3D, 0x3C, 0x3D, 0x5B, 0x35, 0x7B, 0x45, 0x9F, 0xD7, 0x9E, 0x9E, 0x7B, 0x3D, 
+0x1A, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5A, 0x45, 0x7C, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x5A, 0x4D, 0x5A, 0x3D, 0x7B, 0x3D, 0x3B, 0x35, 0x5A, 0x35, 
+0x5A, 0x35, 0x59, 0x3D, 0x38, 0x3D, 0x5C, 0x3D, 0x7B, 0x2D, 0x19, 0x3D, 0x9E, 0x2D, 0x5B, 0x3D, 0xBC, 0xF7, 0xFF, 0xFF, 0xBD, 0x9E, 0x5A, 0x3D, 0x1B, 0x2D, 0x5B, 0x35, 0x7C, 0x35, 0x3D, 0x35, 
+0x3C, 0x3D, 0xFB, 0x3C, 0x5D, 0x3D, 0x7B, 0x3D, 0x9F, 0xCF, 0xFF, 0xFF, 0x5D, 0x7E, 0x1C, 0x45, 0x5B, 0x2D, 0x1A, 0x3D, 0x9C, 0x3D, 0x5C, 0x2D, 0x7A, 0x3D, 0x3A, 0x3D, 0x1B, 0x3D, 0x7B, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x3B, 0x35, 0x3B, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0x7F, 0xCF, 0x7D, 0x8E, 0x7B, 0x3D, 
+0x5B, 0x3D, 0x3B, 0x35, 0x7B, 0x35, 0x5B, 0x3D, 0x3A, 0x4D, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x5D, 0xAF, 0x7C, 0x35, 0x3A, 0x3D, 0x9B, 0x3D, 0x3B, 0x35, 0x7B, 0x35, 
+0x3C, 0x3D, 0x7C, 0x3D, 0x7A, 0x35, 0x3B, 0x3D, 0x7A, 0x3D, 0x5B, 0x3D, 0xDA, 0x3C, 0xBF, 0xE7, 0xFF, 0xE7, 0x1C, 0x6E, 0x1C, 0x35, 0x3C, 0x3D, 0x7B, 0x3D, 0x5A, 0x3D, 0xD9, 0x2C, 0x7A, 0x2D, 
+0x59, 0x2D, 0x9B, 0x3D, 0x3A, 0x2D, 0x5C, 0x3D, 0xF9, 0x4C, 0x9D, 0xD7, 0xFE, 0xFF, 0xBB, 0x8E, 0x1A, 0x45, 0x9B, 0x3D, 0x3B, 0x35, 0x5C, 0x35, 0x7A, 0x35, 0x3A, 0x3D, 0x3B, 0x3D, 0x7B, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7B, 0x3D, 0x3B, 0x35, 0x3B, 0x3D, 0x5A, 0x35, 0x3B, 0x35, 0xFD, 0xB6, 0x3C, 0x7E, 0x3A, 0x35, 
+0x5A, 0x3D, 0x3B, 0x3D, 0x9B, 0x35, 0x3B, 0x35, 0x3C, 0x35, 0x3E, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBA, 0x55, 0x5B, 0x35, 0x3B, 0x35, 0x5B, 0x3D, 0x3B, 0x45, 0x5B, 0x35, 
+0x3B, 0x35, 0x3B, 0x3D, 0x1B, 0x45, 0x19, 0x35, 0x7A, 0x2D, 0x7A, 0x3D, 0x7F, 0xD7, 0xFE, 0xFF, 0xFC, 0x75, 0xF9, 0x34, 0x7B, 0x3D, 0x7A, 0x3D, 0x38, 0x2D, 0x9B, 0x3D, 0x5B, 0x3D, 0x5A, 0x3D, 
+0x5B, 0x45, 0x1A, 0x2D, 0xBA, 0x35, 0x39, 0x3D, 0x5D, 0x35, 0x5C, 0x45, 0x5F, 0xCF, 0xFE, 0xFF, 0xFC, 0x8D, 0x9A, 0x2D, 0x1A, 0x35, 0x5B, 0x3D, 0x5B, 0x35, 0x3A, 0x3D, 0x9B, 0x35, 0x3B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0x5B, 0x35, 0x3B, 0x35, 0xBC, 0xA6, 0x3C, 0x7E, 0x5B, 0x35, 
+0x3A, 0x35, 0x3B, 0x3D, 0x9B, 0x3D, 0x5C, 0x35, 0x5C, 0x3D, 0x9A, 0x5D, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xE7, 0x3B, 0x35, 0x3A, 0x3D, 0x7C, 0x3D, 0x3A, 0x35, 0x3A, 0x3D, 0x3B, 0x35, 
+0x39, 0x3D, 0xBC, 0x2D, 0x5C, 0x3D, 0x7B, 0x3D, 0x7E, 0x35, 0xB9, 0x55, 0xFF, 0xFF, 0x7D, 0x7E, 0x9B, 0x45, 0x3A, 0x45, 0x5B, 0x35, 0x7C, 0x2D, 0x3C, 0x35, 0x3A, 0x3D, 0x7B, 0x3D, 0x3B, 0x2D, 
+0x5A, 0x45, 0x3A, 0x35, 0x5C, 0x35, 0x3B, 0x3D, 0x1B, 0x4D, 0xFD, 0x3C, 0x19, 0x35, 0xBF, 0xE7, 0x9F, 0xE7, 0x79, 0x35, 0x5A, 0x3D, 0x3B, 0x45, 0x3C, 0x35, 0x3A, 0x35, 0xBA, 0x35, 0x1B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x3B, 0x35, 0xBC, 0x9E, 0x3C, 0x76, 0x5B, 0x3D, 
+0x5A, 0x3D, 0x3A, 0x3D, 0x5A, 0x3D, 0x5C, 0x35, 0x5A, 0x3D, 0x1A, 0x35, 0xDF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x5C, 0x3D, 0x7B, 0x3D, 0x7B, 0x3D, 0x3A, 0x35, 0x3A, 0x35, 0x5B, 0x45, 
+0x3A, 0x3D, 0x1A, 0x35, 0x3A, 0x45, 0x7B, 0x35, 0xFA, 0x34, 0xFF, 0xFF, 0xBE, 0xFF, 0x58, 0x35, 0xFC, 0x2C, 0x3A, 0x45, 0x39, 0x3D, 0x9B, 0x35, 0x7D, 0x3D, 0x1B, 0x3D, 0x5B, 0x3D, 0x5B, 0x4D, 
+0x3C, 0x3D, 0x79, 0x2D, 0x59, 0x3D, 0x7B, 0x3D, 0x59, 0x2D, 0x5A, 0x2D, 0xBC, 0x45, 0xFD, 0x6D, 0xFF, 0xFF, 0x7C, 0x8E, 0x7A, 0x3D, 0x3B, 0x3D, 0x3C, 0x45, 0x5B, 0x35, 0x7A, 0x35, 0x3B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0x3A, 0x3D, 0x3B, 0x35, 0xBC, 0x96, 0x5D, 0x76, 0x3B, 0x3D, 
+0x7B, 0x3D, 0x3A, 0x35, 0x3A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5C, 0x3D, 0xFF, 0x9E, 0xFF, 0xFF, 0xFE, 0xFF, 0x9C, 0x4D, 0x1A, 0x45, 0x7C, 0x35, 0x39, 0x35, 0x7C, 0x3D, 0x7B, 0x35, 0x7B, 0x4D, 
+0x1F, 0xC7, 0x3D, 0xB7, 0x3C, 0xAF, 0x1F, 0xBF, 0x3E, 0xC7, 0xDE, 0xFF, 0x3E, 0xC7, 0x1F, 0xBF, 0x3E, 0xC7, 0x3E, 0xAF, 0x3E, 0xB7, 0xDC, 0xBE, 0xFD, 0xB6, 0x3F, 0xBF, 0x1E, 0xB7, 0x3C, 0xAF, 
+0x1E, 0xBF, 0xFE, 0xBE, 0x3E, 0xB7, 0xDE, 0xB6, 0x1F, 0xBF, 0x3C, 0xB7, 0xFC, 0xBE, 0x1F, 0xB7, 0x7D, 0xEF, 0xBF, 0xE7, 0x79, 0x35, 0x5C, 0x2D, 0x3B, 0x4D, 0x7B, 0x35, 0x1B, 0x35, 0x7B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x5A, 0x3D, 0x3A, 0x3D, 0x5C, 0x35, 0xDD, 0x96, 0x5D, 0x76, 0x3B, 0x3D, 
+0x5B, 0x35, 0x5B, 0x2D, 0x5B, 0x45, 0x39, 0x3D, 0x7B, 0x35, 0x5B, 0x45, 0x9C, 0x4D, 0xFE, 0xFF, 0xBF, 0xF7, 0x7A, 0x35, 0x7C, 0x35, 0x7B, 0x3D, 0x7B, 0x3D, 0x3B, 0x3D, 0x5C, 0x2D, 0x39, 0x3D, 
+0x5C, 0xB7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xE7, 0xDF, 0xEF, 0x5B, 0x3D, 0x7B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x3A, 0x35, 0x3B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x5C, 0x35, 0x3A, 0x3D, 0x3C, 0x3D, 0x5C, 0x35, 0x59, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0xBF, 0xE7, 0x5E, 0xCF, 0x3A, 0x35, 0x3B, 0x35, 0x3A, 0x3D, 0x5A, 0x3D, 0x3A, 0x35, 0x5B, 0x35, 0x3C, 0x86, 
+0x1C, 0x3D, 0xFB, 0x75, 0xFF, 0xF7, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xE7, 0xDF, 0xEF, 0x5B, 0x3D, 0x7B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x3B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x5B, 0x35, 0x5A, 0x3D, 0x3C, 0x3D, 0x5B, 0x35, 0x59, 0x3D, 0x5C, 0x35, 0x3B, 0x3D, 0x5E, 0xD7, 0xFE, 0xA6, 0x5B, 0x3D, 0x3C, 0x3D, 0x3B, 0x3D, 0x7B, 0x3D, 0x7B, 0x35, 0x7B, 0x45, 0xBF, 0xE7, 
+0xBF, 0xF7, 0x9B, 0x45, 0x7B, 0x3D, 0x9F, 0xE7, 0xFF, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xE7, 0xDF, 0xEF, 0x5B, 0x3D, 0x7B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x3B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x5B, 0x35, 0x5A, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x5A, 0x3D, 0x5C, 0x35, 0x3B, 0x35, 0xDD, 0xAE, 0x5D, 0x86, 0x3B, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0x5C, 0x35, 0x5A, 0x3D, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x8E, 0x7B, 0x35, 0x1E, 0xC7, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xE7, 0xDF, 0xEF, 0x5B, 0x3D, 0x7B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x5B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3A, 0x35, 0x5A, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x5A, 0x3D, 0x5C, 0x35, 0x3B, 0x35, 0x7C, 0x8E, 0xFC, 0x6D, 0x3A, 0x3D, 0x5B, 0x3D, 0x7B, 0x35, 0x1A, 0x3D, 0x5C, 0x35, 0x3A, 0x35, 0xFE, 0xFF, 
+0xFF, 0xF7, 0xDF, 0xFF, 0xFE, 0xFF, 0x1E, 0xC7, 0x7B, 0x35, 0x5D, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xE7, 0xDF, 0xEF, 0x5B, 0x3D, 0x7B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x5B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3A, 0x35, 0x7B, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x5A, 0x35, 0x5B, 0x3D, 0x5B, 0x35, 0x1C, 0x6E, 0xBB, 0x65, 0x5A, 0x35, 0x7B, 0x35, 0x9C, 0x35, 0x3A, 0x3D, 0x7D, 0x3D, 0x7B, 0x3D, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0x9F, 0xE7, 0x7B, 0x3D, 0xBB, 0x45, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xE7, 0xDF, 0xEF, 0x5B, 0x3D, 0x7B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x5B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3A, 0x35, 0x7B, 0x35, 0x3B, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x3B, 0x3D, 0x5B, 0x35, 0xDC, 0x55, 0x7B, 0x55, 0x5A, 0x2D, 0x3B, 0x35, 0x5C, 0x3D, 0x59, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0x1C, 0x7E, 0x3C, 0x3D, 0x9F, 0xCF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xE7, 0xDF, 0xEF, 0x5B, 0x3D, 0x7B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x5B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3A, 0x3D, 0x7B, 0x35, 0x3B, 0x3D, 0x5B, 0x35, 0x5C, 0x3D, 0x1B, 0x3D, 0x5A, 0x3D, 0x9B, 0x45, 0x5B, 0x45, 0x9C, 0x2D, 0x1C, 0x3D, 0x3C, 0x3D, 0x79, 0x3D, 0x5A, 0x35, 0x3B, 0x3D, 0xDF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x3C, 0xB7, 0x38, 0x4D, 0xBD, 0xA6, 0xFF, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xE7, 0xDF, 0xEF, 0x5B, 0x3D, 0x7B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x5B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3B, 0x3D, 0x7B, 0x35, 0x3A, 0x3D, 0x5B, 0x35, 0x7C, 0x3D, 0x1A, 0x3D, 0x5A, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x3A, 0x3D, 0x5D, 0x3D, 0x7B, 0x35, 0x5A, 0x3D, 0x3B, 0x35, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x7A, 0x3D, 0x1C, 0x5E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 
+0xFE, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x96, 0x5C, 0x96, 0xDF, 0xE7, 0x3A, 0x3D, 0x3B, 0x3D, 0x7B, 0x35, 0x1B, 0x3D, 0x7B, 0x3D, 0x5B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3B, 0x3D, 0x7B, 0x35, 0x3A, 0x3D, 0x5B, 0x35, 0x7C, 0x3D, 0x1A, 0x3D, 0x5A, 0x3D, 0x5B, 0x35, 0x9B, 0x45, 0x5B, 0x3D, 0x3A, 0x3D, 0x5D, 0x3D, 0x7A, 0x35, 0x5A, 0x3D, 0x3B, 0x35, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xFD, 0xBE, 0x3A, 0x3D, 0x9D, 0x3D, 0x5E, 0xDF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFD, 0xF7, 0xFE, 0xFF, 0x1C, 0x5E, 0x5B, 0x45, 0x1F, 0xAF, 0xFF, 0xEF, 0x5A, 0x3D, 0x5B, 0x45, 0x9B, 0x3D, 0x1B, 0x3D, 0x5B, 0x35, 0x3B, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3A, 0x35, 0x7B, 0x35, 0x3A, 0x3D, 0x5B, 0x35, 0x5C, 0x3D, 0x1B, 0x3D, 0x5A, 0x3D, 0x9B, 0x45, 0xDB, 0x55, 0x5B, 0x3D, 0x5A, 0x3D, 0x5C, 0x3D, 0x5A, 0x35, 0x7B, 0x3D, 0x5B, 0x3D, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xBB, 0x96, 0x3C, 0x86, 0x7D, 0x96, 0x5B, 0x35, 0x5C, 0x8E, 0xFF, 0xFF, 0xFF, 0xEF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xD7, 0xBE, 0x3D, 0xBF, 0x96, 0xFA, 0x6D, 0x5C, 0x9E, 0xBE, 0xE7, 0x5A, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x3B, 0x3D, 0x7B, 0x3D, 0x3B, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3A, 0x35, 0x7B, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x3B, 0x3D, 0x5B, 0x35, 0xDC, 0x55, 0x1C, 0x6E, 0x5B, 0x35, 0x7B, 0x35, 0x3C, 0x3D, 0x5A, 0x35, 0x7B, 0x3D, 0x3B, 0x3D, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xDF, 0xFF, 0xFE, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xBF, 0xFF, 0xDD, 0xFF, 0x3F, 0xD7, 0x9F, 0xA6, 0xFF, 0xF7, 0xFD, 0xF7, 0xDE, 0xD7, 0x5C, 0x35, 0xFD, 0x7D, 0xDF, 0xFF, 
+0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x1D, 0xA7, 0xBC, 0x4D, 0x5F, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0x7C, 0xAE, 0xDE, 0xEF, 0x7B, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x3B, 0x3D, 0x7B, 0x3D, 0x3B, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3A, 0x35, 0x7B, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x5A, 0x35, 0x5B, 0x3D, 0x5B, 0x35, 0x1C, 0x6E, 0x7C, 0x8E, 0x3B, 0x35, 0x7B, 0x35, 0x5B, 0x3D, 0x5A, 0x35, 0x5B, 0x3D, 0x3A, 0x3D, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xBF, 0xFF, 0xFE, 0xFF, 0xFE, 0xF7, 0xDF, 0xEF, 0xFA, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0x7A, 0x5D, 0x79, 0x35, 
+0xBF, 0xDF, 0xFE, 0xE7, 0x3B, 0x7E, 0x1D, 0x76, 0xDC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xD7, 0xFF, 0xF7, 0x3A, 0x35, 0x5C, 0x3D, 0x9B, 0x3D, 0x3A, 0x3D, 0x3A, 0x35, 0x5B, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x3A, 0x35, 0x5A, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x5A, 0x3D, 0x5C, 0x35, 0x5B, 0x35, 0x7C, 0x8E, 0xDC, 0xAE, 0x3B, 0x35, 0x7B, 0x35, 0x3B, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0x1A, 0x3D, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xFF, 0x7A, 0x3D, 0xFF, 0xFF, 0xBF, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x3D, 0x86, 
+0xD9, 0x2C, 0x7F, 0x45, 0x1F, 0xB7, 0xDD, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0x9F, 0xFF, 0xFD, 0xFF, 0xBF, 0xDF, 0xDE, 0xF7, 0x1A, 0x35, 0x5C, 0x35, 0x7B, 0x35, 0x3A, 0x3D, 0x3A, 0x35, 0x5C, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x5B, 0x35, 0x5A, 0x3D, 0x3B, 0x3D, 0x5B, 0x35, 0x5A, 0x3D, 0x5C, 0x35, 0x3B, 0x35, 0xDD, 0xAE, 0x5E, 0xD7, 0x3B, 0x3D, 0x7B, 0x35, 0x3A, 0x45, 0x7B, 0x35, 0x5C, 0x3D, 0x1A, 0x3D, 0xFF, 0xFF, 
+0xBF, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xBE, 0xFF, 0x7C, 0x5E, 0xFF, 0xF7, 0xFE, 0xF7, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xE7, 0xDF, 0xFF, 
+0x3F, 0xCF, 0x5E, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xDF, 0xFE, 0xF7, 0x7C, 0x3D, 0x7C, 0x3D, 0x7B, 0x35, 0x3A, 0x45, 0x5A, 0x3D, 0x3B, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x5B, 0x35, 0x5A, 0x3D, 0x3C, 0x3D, 0x5B, 0x35, 0x59, 0x3D, 0x5C, 0x35, 0x3B, 0x3D, 0x5E, 0xD7, 0xBF, 0xE7, 0x3B, 0x3D, 0x7B, 0x35, 0x3A, 0x45, 0x7B, 0x35, 0x5C, 0x3D, 0x1A, 0x3D, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xF7, 0x5D, 0x76, 0x3E, 0xE7, 0xFE, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE7, 0xBD, 0xF7, 0x3A, 0x35, 0x5C, 0x35, 0x7B, 0x35, 0x5A, 0x45, 0x5A, 0x3D, 0x5B, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0xBD, 0x9E, 0x5C, 0x7E, 0x5B, 0x3D, 
+0x5C, 0x35, 0x3A, 0x3D, 0x3C, 0x3D, 0x5C, 0x35, 0x59, 0x3D, 0x5B, 0x35, 0x5B, 0x3D, 0xBF, 0xE7, 0xFF, 0xF7, 0x9B, 0x55, 0x3A, 0x35, 0x7C, 0x3D, 0x39, 0x3D, 0x79, 0x35, 0x5B, 0x3D, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0x7E, 0x7E, 0x3C, 0xDF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE7, 0xBF, 0xEF, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0x3C, 0x45, 0x3A, 0x35, 0x5B, 0x3D, 
+0x7C, 0x35, 0x5B, 0x3D, 0x3B, 0x45, 0x3A, 0x3D, 0x7B, 0x35, 0x5B, 0x35, 0x1A, 0x35, 0x7C, 0x45, 0x3B, 0x3D, 0x1B, 0x3D, 0x5A, 0x3D, 0x1A, 0x3D, 0x3A, 0x3D, 0xDF, 0x96, 0x3C, 0x76, 0x3B, 0x3D, 
+0x5B, 0x35, 0x5B, 0x2D, 0x5B, 0x45, 0x39, 0x3D, 0x7B, 0x35, 0x5B, 0x45, 0x9C, 0x4D, 0xFE, 0xFF, 0xFF, 0xF7, 0xBD, 0xA6, 0x3B, 0x35, 0x9B, 0x3D, 0x7B, 0x35, 0x3A, 0x35, 0x5B, 0x45, 0xDE, 0xEF, 
+0xDF, 0xFF, 0xFD, 0xFF, 0x9E, 0xFF, 0x1F, 0xBF, 0xFE, 0xA6, 0xFD, 0xEF, 0xBF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE7, 0xDF, 0xEF, 0x5B, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0x3C, 0x3D, 0x5A, 0x35, 0x5B, 0x3D, 
+0x3A, 0x3D, 0x7A, 0x35, 0x7A, 0x2D, 0x5B, 0x35, 0x3B, 0x35, 0x7B, 0x3D, 0x9C, 0x45, 0x1B, 0x3D, 0x7B, 0x3D, 0x5B, 0x35, 0x9C, 0x2D, 0x7C, 0x35, 0x7A, 0x35, 0xBD, 0x9E, 0x1A, 0x7E, 0x3C, 0x35, 
+0x7B, 0x3D, 0x3A, 0x35, 0x1A, 0x3D, 0x5A, 0x3D, 0x5A, 0x35, 0x5C, 0x3D, 0xFF, 0x9E, 0xFF, 0xFF, 0xFE, 0xF7, 0x9E, 0xEF, 0x3C, 0x3D, 0x9B, 0x3D, 0x7C, 0x35, 0x3A, 0x35, 0x7B, 0x3D, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFE, 0xFF, 0x7F, 0xE7, 0x7E, 0x8E, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xEF, 0xBF, 0xF7, 0x5B, 0x3D, 0x5A, 0x3D, 0x3A, 0x35, 0x3B, 0x3D, 0x7A, 0x35, 0x3B, 0x3D, 
+0x3A, 0x3D, 0x5C, 0x45, 0x1C, 0x3D, 0x7C, 0x3D, 0x7A, 0x35, 0x39, 0x2D, 0x7A, 0x35, 0x5A, 0x35, 0x1B, 0x35, 0x79, 0x35, 0xB9, 0x35, 0x3A, 0x35, 0x1B, 0x35, 0x7E, 0xA6, 0x3B, 0x86, 0xBB, 0x35, 
+0x5A, 0x3D, 0x3A, 0x3D, 0x5A, 0x3D, 0x5C, 0x35, 0x5A, 0x3D, 0x1A, 0x35, 0xDF, 0xE7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0x7B, 0x4D, 0x3A, 0x35, 0x3C, 0x3D, 0x9B, 0x35, 0x39, 0x2D, 0xBF, 0xFF, 
+0xFF, 0xFF, 0x9D, 0xF7, 0xDE, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xE7, 0xBF, 0xF7, 0x3A, 0x35, 0x5A, 0x3D, 0x7B, 0x35, 0x5C, 0x3D, 0x7B, 0x35, 0x3B, 0x3D, 
+0x5B, 0x2D, 0x7C, 0x3D, 0x3A, 0x3D, 0x39, 0x35, 0x7A, 0x3D, 0x5C, 0x3D, 0x5C, 0x3D, 0x7B, 0x3D, 0x9B, 0x3D, 0x3C, 0x4D, 0x3B, 0x35, 0x9C, 0x55, 0x9F, 0xA6, 0x9F, 0xE7, 0x7A, 0x7E, 0x3B, 0x2D, 
+0x39, 0x35, 0x3B, 0x45, 0x9B, 0x3D, 0x3C, 0x35, 0x5C, 0x3D, 0x9A, 0x5D, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x1E, 0xAF, 0x5B, 0x35, 0x3C, 0x45, 0x9B, 0x3D, 0x5A, 0x2D, 0xFF, 0xFF, 
+0xFF, 0xF7, 0x99, 0x45, 0xFE, 0xF7, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE7, 0xDF, 0xF7, 0x3A, 0x35, 0x7A, 0x3D, 0x7B, 0x35, 0x5B, 0x35, 0x7B, 0x35, 0x3B, 0x3D, 
+0x5B, 0x35, 0x38, 0x35, 0x7A, 0x3D, 0x5C, 0x35, 0x3C, 0x35, 0x7B, 0x45, 0x19, 0x3D, 0x1B, 0x3D, 0x5D, 0x45, 0xBB, 0x5D, 0x7E, 0xD7, 0xDF, 0xFF, 0x1C, 0x5E, 0x1B, 0x2D, 0x1B, 0x3D, 0x7B, 0x3D, 
+0x5A, 0x3D, 0x3B, 0x3D, 0x9B, 0x35, 0x3B, 0x35, 0x3C, 0x3D, 0x3E, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 0x9B, 0x55, 0x3B, 0x3D, 0x5A, 0x45, 0x7B, 0x3D, 0x5F, 0xC7, 
+0xBC, 0x65, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xD7, 0xFF, 0xF7, 0x3B, 0x3D, 0x5A, 0x3D, 0x7B, 0x3D, 0x5B, 0x35, 0x7A, 0x35, 0x3B, 0x3D, 
+0x5A, 0x35, 0x5C, 0x35, 0x3C, 0x3D, 0xF9, 0x44, 0x7B, 0x45, 0x3B, 0x1D, 0x39, 0x3D, 0xDF, 0xCF, 0xFE, 0xFF, 0x5D, 0x96, 0x9C, 0x3D, 0x9B, 0x3D, 0x5A, 0x2D, 0x5A, 0x3D, 0x5A, 0x2D, 0x5D, 0x35, 
+0x5B, 0x3D, 0x3B, 0x35, 0x7B, 0x35, 0x5B, 0x45, 0x3A, 0x4D, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xBE, 0xF7, 0xFE, 0xFF, 0x7C, 0x9E, 0x5C, 0x3D, 0x5A, 0x3D, 0x1A, 0x35, 0x5A, 0x55, 
+0x1B, 0x45, 0xFD, 0xAE, 0xFF, 0xC6, 0xFD, 0xBE, 0x1F, 0xB7, 0xBF, 0xFF, 0x5F, 0xBF, 0xDE, 0xBE, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 
+0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1E, 0xB7, 0x1D, 0xB7, 0xFF, 0xEF, 0x5B, 0x3D, 0x3A, 0x3D, 0x7B, 0x3D, 0x3B, 0x35, 0x7A, 0x35, 0x3B, 0x3D, 
+0x9B, 0x3D, 0x1A, 0x35, 0x7C, 0x35, 0x7C, 0x35, 0x5C, 0x86, 0xDF, 0xEF, 0x3F, 0xC7, 0x9C, 0x4D, 0x7B, 0x3D, 0x3C, 0x3D, 0x3B, 0x35, 0x39, 0x3D, 0x79, 0x2D, 0x79, 0x3D, 0x59, 0x3D, 0x3B, 0x4D, 
+0x1A, 0x3D, 0x5B, 0x35, 0x7B, 0x3D, 0x7A, 0x45, 0x7C, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xF7, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x9E, 0x45, 0x9B, 0x35, 0x7B, 0x35, 0x1C, 0x35, 
+0x79, 0x35, 0x5C, 0x35, 0x3C, 0x2D, 0x5B, 0x3D, 0xBA, 0x4D, 0xDF, 0xFF, 0x99, 0x35, 0x3B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 
+0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x96, 0xDF, 0xE7, 0x5C, 0x3D, 0x1A, 0x3D, 0x7B, 0x3D, 0x5B, 0x3D, 0x7A, 0x35, 0x3A, 0x3D, 
+0xDA, 0x34, 0x5D, 0x7E, 0xBF, 0xD7, 0x5D, 0xD7, 0x3B, 0x96, 0x9B, 0x45, 0x3B, 0x35, 0x1B, 0x3D, 0x3B, 0x35, 0x7B, 0x35, 0x59, 0x3D, 0x1A, 0x45, 0x7D, 0x2D, 0x3D, 0x45, 0x3A, 0x3D, 0x9C, 0x2D, 
+0x3B, 0x3D, 0x7A, 0x3D, 0x3B, 0x3D, 0x5A, 0x45, 0xFF, 0xF7, 0xBF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xAE, 0x5B, 0x45, 0x3A, 0x35, 0x7B, 0x3D, 
+0x7D, 0x35, 0x3A, 0x35, 0x5A, 0x3D, 0x9C, 0x2D, 0x9A, 0x55, 0xDF, 0xF7, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0x3E, 0xCF, 0x5E, 0xBF, 0x7B, 0x8E, 0xBD, 0x7E, 0xDB, 0x4D, 0xFC, 0x4D, 0x5A, 0x3D, 
+0x9C, 0x35, 0x5B, 0x2D, 0x3B, 0x35, 0x3B, 0x3D, 0x3B, 0x3D, 0x3B, 0x3D, 0x3A, 0x3D, 0x5B, 0x3D, 0x9A, 0x7E, 0x9F, 0xFF, 0x5C, 0x35, 0x99, 0x35, 0x39, 0x35, 0x3B, 0x2D, 0x1C, 0x56, 0x9C, 0x8E, 
+0xBF, 0xE7, 0x9D, 0xA6, 0x7A, 0x55, 0x3A, 0x2D, 0x3C, 0x2D, 0x5C, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x7B, 0x3D, 0x3A, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x7B, 0x35, 0x5B, 0x3D, 0x3B, 0x35, 0x7C, 0x3D, 
+0x7B, 0x3D, 0x3A, 0x35, 0x5B, 0x45, 0xDE, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFA, 0x75, 0x7B, 0x2D, 0x7C, 0x3D, 
+0x3C, 0x3D, 0x5B, 0x45, 0x39, 0x3D, 0x7B, 0x3D, 0x3B, 0x35, 0x3A, 0x45, 0xFC, 0x75, 0x7B, 0x86, 0xBB, 0xB6, 0x9F, 0xD7, 0x7F, 0xE7, 0xBF, 0xF7, 0x5E, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xBF, 0xFF, 0x7E, 0xE7, 0xFC, 0xB6, 0x7B, 0x8E, 0x1B, 0x66, 0xDB, 0x55, 0x9B, 0x45, 0x5B, 0x3D, 0x5C, 0x7E, 0x9E, 0xEF, 0x5A, 0x3D, 0x7B, 0x35, 0x7E, 0x7E, 0x7F, 0xE7, 0x7E, 0xDF, 0xFC, 0x85, 
+0x59, 0x45, 0x59, 0x3D, 0x5A, 0x35, 0x7B, 0x3D, 0x7C, 0x45, 0x3A, 0x45, 0x3A, 0x3D, 0x5A, 0x35, 0x1A, 0x35, 0x5B, 0x35, 0x7B, 0x3D, 0x5B, 0x45, 0x3A, 0x3D, 0x5A, 0x35, 0x7B, 0x3D, 0x1A, 0x3D, 
+0x7C, 0x3D, 0x7B, 0x35, 0xFA, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xE7, 0x39, 0x45, 0x5D, 0x35, 
+0x59, 0x3D, 0x3A, 0x3D, 0x9B, 0x2D, 0x5C, 0x3D, 0x3B, 0x3D, 0x5B, 0x2D, 0x5D, 0x45, 0xFB, 0x2C, 0x5C, 0x35, 0x5C, 0x35, 0xFA, 0x24, 0xBC, 0x3D, 0x7A, 0x35, 0x59, 0x3D, 0x59, 0x4D, 0xDF, 0x86, 
+0xBA, 0xA6, 0x9E, 0xCF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBE, 0xF7, 0x5F, 0xD7, 0xDF, 0xFF, 0x3B, 0x8E, 0xDC, 0x2C, 0xBE, 0x2D, 0x59, 0x2D, 
+0x5C, 0x2D, 0x5B, 0x2D, 0x5B, 0x35, 0x3B, 0x3D, 0x3A, 0x3D, 0x3A, 0x3D, 0x5A, 0x35, 0x9B, 0x35, 0x3B, 0x3D, 0x7B, 0x3D, 0xFA, 0x34, 0x1A, 0x45, 0x7B, 0x45, 0x5A, 0x35, 0x7B, 0x35, 0x3B, 0x3D, 
+0x5D, 0x35, 0x39, 0x45, 0xFF, 0xE7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x7F, 0xCF, 0x3B, 0x45, 
+0x7B, 0x2D, 0x5A, 0x35, 0x9C, 0x35, 0x3C, 0x35, 0x1A, 0x3D, 0x79, 0x3D, 0x3A, 0x3D, 0x7D, 0x3D, 0x19, 0x2D, 0x7B, 0x3D, 0x7B, 0x45, 0x1A, 0x35, 0x3B, 0x3D, 0x3A, 0x35, 0x3B, 0x35, 0x3B, 0x35, 
+0x3B, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5B, 0x2D, 0x9B, 0x35, 0xBD, 0x45, 0x9C, 0x55, 0x3B, 0x4D, 0xDD, 0xBE, 0xFD, 0xA6, 0x3C, 0x4D, 0xDB, 0x44, 0x9B, 0x35, 0x39, 0x3D, 0x58, 0x35, 0x7C, 0x3D, 
+0x5C, 0x4D, 0x5C, 0x45, 0x3B, 0x3D, 0x3A, 0x35, 0x5A, 0x3D, 0x5B, 0x3D, 0x5C, 0x35, 0x5C, 0x2D, 0x5B, 0x35, 0x5B, 0x45, 0x1A, 0x45, 0x5B, 0x3D, 0x5B, 0x35, 0x3B, 0x35, 0x5B, 0x35, 0x7B, 0x35, 
+0x3B, 0x45, 0x7F, 0xCF, 0xDE, 0xF7, 0xFF, 0xFF, 0xBE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAE, 
+0x3C, 0x3D, 0x7B, 0x3D, 0xD9, 0x3C, 0xFA, 0x34, 0x9C, 0x3D, 0x5A, 0x35, 0x59, 0x2D, 0x39, 0x3D, 0x9B, 0x35, 0x3A, 0x35, 0x1A, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5A, 0x35, 0x7B, 0x3D, 
+0x3A, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x79, 0x35, 0x79, 0x35, 0xFA, 0x3C, 0x9B, 0x35, 0x9A, 0x2D, 0x7B, 0x35, 0x7B, 0x35, 0x5C, 0x3D, 0x7B, 0x35, 0x1C, 0x3D, 
+0x19, 0x3D, 0x3A, 0x3D, 0x5B, 0x35, 0x7B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x1B, 0x3D, 0x1B, 0x45, 0x7B, 0x35, 0x1A, 0x3D, 0x5B, 0x45, 0x5B, 0x35, 0x5B, 0x2D, 0x7C, 0x35, 0x5B, 0x3D, 0x3A, 0x35, 
+0xFE, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 
+0xFB, 0x7D, 0x3A, 0x35, 0x5C, 0x3D, 0x5A, 0x3D, 0x7B, 0x3D, 0x3B, 0x2D, 0xBD, 0x2D, 0x3A, 0x3D, 0x5B, 0x45, 0x3B, 0x3D, 0x5B, 0x3D, 0x7C, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x3B, 0x3D, 0xFA, 0x3C, 
+0x7B, 0x3D, 0x5B, 0x3D, 0x3B, 0x35, 0x3B, 0x35, 0x3B, 0x3D, 0x3B, 0x3D, 0x3C, 0x3D, 0x5C, 0x45, 0x5B, 0x3D, 0x1B, 0x2D, 0x5B, 0x2D, 0x5C, 0x35, 0x1A, 0x3D, 0x3B, 0x35, 0x99, 0x2D, 0x3B, 0x45, 
+0x9A, 0x35, 0x9B, 0x35, 0x7C, 0x35, 0x5C, 0x35, 0x3B, 0x35, 0x5A, 0x35, 0x5A, 0x3D, 0x5A, 0x3D, 0x5B, 0x3D, 0x5A, 0x35, 0x5A, 0x35, 0x1A, 0x35, 0x7C, 0x35, 0x5B, 0x35, 0x19, 0x45, 0x3C, 0x7E, 
+0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xF7, 0xFB, 0x75, 0x7C, 0x35, 0x3A, 0x2D, 0x5A, 0x3D, 0x3B, 0x3D, 0x5D, 0x3D, 0x3B, 0x35, 0x7A, 0x25, 0x5A, 0x2D, 0x5B, 0x3D, 0xFA, 0x3C, 0x3B, 0x45, 0x3B, 0x3D, 0x5C, 0x45, 0x3B, 0x3D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x7B, 0x35, 0x7B, 0x35, 0x7B, 0x35, 0x5A, 0x35, 0x3A, 0x35, 0x3A, 0x3D, 0x5A, 0x3D, 0x3D, 0x3D, 0x7A, 0x3D, 0x59, 0x45, 0x39, 0x45, 0x7B, 0x35, 0x5A, 0x35, 0xFD, 0x44, 
+0x7B, 0x35, 0x3B, 0x35, 0x3B, 0x35, 0x3B, 0x3D, 0x5B, 0x3D, 0x7B, 0x35, 0x7A, 0x2D, 0x7A, 0x2D, 0x1A, 0x35, 0x7B, 0x3D, 0x7B, 0x35, 0x3B, 0x35, 0x5B, 0x3D, 0x39, 0x45, 0x1A, 0x86, 0xFF, 0xEF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 
+0xDE, 0xFF, 0xFF, 0xF7, 0x3B, 0x76, 0x7A, 0x3D, 0x7B, 0x3D, 0x3B, 0x35, 0x1B, 0x45, 0x7A, 0x35, 0x3B, 0x3D, 0x5C, 0x45, 0x3B, 0x3D, 0x3B, 0x35, 0x9C, 0x3D, 0x7A, 0x35, 0x3A, 0x2D, 0x9B, 0x3D, 
+0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5A, 0x35, 0x58, 0x35, 0x5D, 0x3D, 0x9A, 0x35, 0x3C, 0x35, 0x1C, 0x3D, 0x5C, 0x3D, 0x38, 0x3D, 0x9B, 0x35, 
+0x5B, 0x3D, 0x3B, 0x3D, 0x3B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x3B, 0x3D, 0x3C, 0x3D, 0x7C, 0x3D, 0xFA, 0x34, 0x3B, 0x3D, 0x9C, 0x3D, 0x3A, 0x35, 0x3C, 0x7E, 0xFF, 0xEF, 0xFE, 0xFF, 
+0xFF, 0xF7, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xDD, 0xA6, 0x3B, 0x45, 0x3D, 0x35, 0x5C, 0x35, 0x7B, 0x3D, 0x5B, 0x45, 0x3B, 0x3D, 0x5B, 0x3D, 0x7B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5B, 0x3D, 0x3B, 0x35, 
+0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5B, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 
+0x3B, 0x35, 0x5B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x7B, 0x3D, 0x5B, 0x3D, 0x3B, 0x3D, 0x5B, 0x45, 0x7B, 0x3D, 0x5C, 0x35, 0x3D, 0x35, 0x3B, 0x45, 0xDD, 0xA6, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0x9F, 0xCF, 0x39, 0x45, 0x5B, 0x2D, 0x3A, 0x35, 0x5A, 0x35, 0x5B, 0x35, 0x3B, 0x35, 0x3B, 0x35, 0x3B, 0x45, 0x1A, 0x3D, 0x3A, 0x35, 0x9C, 0x35, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x5A, 0x3D, 0x7A, 0x3D, 0x5A, 0x35, 0x5A, 0x35, 0x5A, 0x35, 0x5B, 0x2D, 0x5A, 0x2D, 0x5A, 0x35, 0x5A, 0x35, 0x5A, 0x35, 0x5A, 0x3D, 0x5A, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 
+0x9C, 0x35, 0x3A, 0x35, 0x1A, 0x3D, 0x3B, 0x3D, 0x3B, 0x3D, 0x3B, 0x35, 0x5B, 0x35, 0x5A, 0x35, 0x3A, 0x35, 0x5B, 0x2D, 0x39, 0x45, 0x9F, 0xCF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xE7, 0xFA, 0x75, 0x5B, 0x45, 0x1A, 0x35, 0x7C, 0x3D, 0x7B, 0x35, 0x5B, 0x2D, 0x9B, 0x3D, 0x7B, 0x3D, 0x3A, 0x3D, 0x3B, 0x3D, 
+0x1C, 0x3D, 0x1B, 0x35, 0x1B, 0x35, 0x3B, 0x3D, 0x3B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x5B, 0x3D, 0x3B, 0x3D, 0x3B, 0x3D, 0x1B, 0x35, 0x1B, 0x35, 0x1C, 0x3D, 
+0x3B, 0x3D, 0x3A, 0x3D, 0x7B, 0x3D, 0x9B, 0x3D, 0x7B, 0x2D, 0x7B, 0x35, 0x7C, 0x3D, 0x1A, 0x35, 0x5B, 0x45, 0xFA, 0x75, 0xFF, 0xE7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xBE, 0xAE, 0x7A, 0x45, 0x5A, 0x45, 0x3A, 0x3D, 0x3B, 0x35, 0x5C, 0x35, 0x3B, 0x35, 0x3A, 0x35, 0x59, 0x3D, 
+0x7C, 0x3D, 0x7C, 0x3D, 0x5C, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x5C, 0x35, 0x7C, 0x3D, 0x7C, 0x3D, 
+0x59, 0x3D, 0x3A, 0x35, 0x3B, 0x35, 0x5C, 0x35, 0x3B, 0x35, 0x3A, 0x3D, 0x5A, 0x45, 0x7A, 0x45, 0xBE, 0xAE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x9C, 0x9E, 0x7C, 0x55, 0x3C, 0x3D, 0x3B, 0x3D, 0x5A, 0x3D, 0x7B, 0x3D, 0x5B, 0x2D, 
+0x39, 0x3D, 0x59, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x35, 0x5B, 0x35, 0x5C, 0x35, 0x5C, 0x3D, 0x5C, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x5A, 0x35, 0x5A, 0x3D, 0x5A, 0x3D, 0x59, 0x3D, 0x39, 0x3D, 
+0x5B, 0x2D, 0x7B, 0x3D, 0x5A, 0x3D, 0x3B, 0x3D, 0x3C, 0x3D, 0x7C, 0x55, 0x9C, 0x9E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x1D, 0xB7, 0x9A, 0x55, 0x1A, 0x35, 0x5C, 0x3D, 0x3B, 0x3D, 
+0x3B, 0x35, 0x5B, 0x35, 0x5C, 0x35, 0x5C, 0x35, 0x5B, 0x3D, 0x3B, 0x3D, 0x1B, 0x3D, 0x1A, 0x3D, 0x1A, 0x3D, 0x1B, 0x3D, 0x3B, 0x3D, 0x5B, 0x3D, 0x5C, 0x35, 0x5C, 0x35, 0x5B, 0x35, 0x3B, 0x35, 
+0x3B, 0x3D, 0x5C, 0x3D, 0x1A, 0x35, 0x9A, 0x55, 0x1D, 0xB7, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBF, 0xE7, 0xFF, 0x9E, 0x9C, 0x4D, 
+0x5B, 0x3D, 0x5B, 0x3D, 0x3B, 0x35, 0x5B, 0x35, 0x5B, 0x35, 0x7B, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x5A, 0x3D, 0x7B, 0x3D, 0x5B, 0x35, 0x5B, 0x35, 0x3B, 0x35, 0x5B, 0x3D, 0x5B, 0x3D, 
+0x9C, 0x4D, 0xFF, 0x9E, 0xBF, 0xE7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xDF, 0xE7, 0x7E, 0xD7, 0xDD, 0xAE, 0x7C, 0x8E, 0x1C, 0x6E, 0xDC, 0x55, 0x9B, 0x45, 0x5B, 0x35, 0x5B, 0x35, 0x9B, 0x45, 0xDC, 0x55, 0x1C, 0x6E, 0x7C, 0x8E, 0xDD, 0xAE, 0x7E, 0xD7, 0xDF, 0xE7, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xF7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+};
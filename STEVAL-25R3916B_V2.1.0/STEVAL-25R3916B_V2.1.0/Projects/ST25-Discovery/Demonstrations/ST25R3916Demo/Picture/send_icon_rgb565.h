@@ -0,0 +1,105 @@
+/* 40x40 RGB565 raw picture converted from send_icon_jpg.h by pict2rgb565, 3216 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char send_icon[] = {
+0x52, 0x35, 0x36, 0x35, 0x00, 0x00, 0x28, 0x00, 0x28, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xCF, 0x3B, 0x8E, 0x5D, 0x4D, 0xDB, 0x2C, 0x39, 0x14, 0xF9, 0x03, 0xF9, 0x03, 0x39, 0x14, 0xDB, 0x2C, 0x5D, 0x4D, 
+0x5C, 0x8E, 0x5E, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x9E, 0xFF, 0xDB, 0x85, 0x79, 0x1C, 0xD8, 0x03, 0x98, 0x03, 
+0xB6, 0x0B, 0x97, 0x03, 0xD8, 0x03, 0x19, 0x04, 0x19, 0x04, 0xD8, 0x03, 0x97, 0x03, 0xB6, 0x0B, 0x97, 0x03, 0xB9, 0x03, 0x59, 0x1C, 0xDA, 0x85, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0x9E, 0xEF, 0x9A, 0x7D, 0x96, 0x03, 0xB8, 0x03, 0xB9, 0x03, 0xBA, 0x03, 0x1A, 0x04, 0xF8, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0x19, 0x04, 0x19, 0x04, 0xF9, 0x03, 0xF8, 0x03, 0xF8, 0x03, 
+0x1B, 0x04, 0xD8, 0x03, 0xD9, 0x0B, 0x9A, 0x03, 0xB7, 0x03, 0xB9, 0x7D, 0xBF, 0xF7, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFE, 0xF7, 0xDE, 0xFF, 0xFF, 0xF7, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xAE, 0x59, 0x1C, 0x99, 0x03, 0x1A, 0x04, 0x1A, 0x04, 0xB8, 0x03, 0xF8, 0x0B, 0xB8, 0x03, 
+0xF9, 0x03, 0xF9, 0x03, 0xF8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xD7, 0x03, 0xD9, 0x0B, 0xD8, 0x03, 0x18, 0x04, 0x1A, 0x04, 0x79, 0x03, 0x59, 0x1C, 0xBE, 0xA6, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0x9C, 0x65, 
+0xB9, 0x03, 0x96, 0x03, 0xF8, 0x03, 0xFA, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0x39, 0x04, 0xB8, 0x03, 0xD8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xD8, 0x03, 
+0xB9, 0x03, 0x39, 0x04, 0x18, 0x04, 0xD8, 0x03, 0x19, 0x04, 0xD8, 0x03, 0x77, 0x03, 0xB8, 0x03, 0xBD, 0x6D, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xD8, 0x44, 0x77, 0x03, 0xD7, 0x0B, 0xFA, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0x3A, 0x04, 0xBA, 0x03, 0x97, 0x03, 0x18, 0x04, 
+0xF9, 0x03, 0xF9, 0x03, 0xF8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0x18, 0x04, 0x98, 0x03, 0xD9, 0x03, 0x3A, 0x04, 0xF9, 0x03, 0x18, 0x04, 0x18, 0x04, 0xB8, 0x0B, 
+0x97, 0x0B, 0xB8, 0x44, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xD8, 0x44, 0xDB, 0x03, 0xF8, 0x03, 
+0xF9, 0x03, 0x18, 0x04, 0xF9, 0x03, 0xB9, 0x03, 0xD8, 0x03, 0x38, 0x04, 0x39, 0x04, 0xB9, 0x03, 0xF8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 
+0xB8, 0x03, 0x19, 0x04, 0x18, 0x04, 0xD7, 0x03, 0xD8, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xF7, 0x03, 0xF8, 0x03, 0xBA, 0x03, 0xF9, 0x4C, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xDF, 0xF7, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7B, 0x65, 0x77, 0x03, 0x19, 0x04, 0xFA, 0x03, 0x19, 0x04, 0xF9, 0x03, 0xF9, 0x03, 0x3A, 0x0C, 0xB8, 0x03, 0xB8, 0x03, 0xD9, 0x03, 0x19, 0x04, 
+0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0x1A, 0x04, 0xF9, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0x1A, 0x04, 0x19, 0x04, 0xF8, 0x03, 0x39, 0x0C, 
+0x1A, 0x04, 0xF8, 0x03, 0xB8, 0x0B, 0x7B, 0x65, 0xDF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xDF, 0xAE, 0x78, 0x03, 0x38, 0x0C, 0xD8, 0x03, 0x19, 0x04, 
+0xF8, 0x03, 0xD9, 0x03, 0xF9, 0x0B, 0xD8, 0x03, 0x18, 0x04, 0xF8, 0x03, 0xB7, 0x03, 0x19, 0x04, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 
+0x1B, 0x04, 0xB8, 0x03, 0xF8, 0x0B, 0xF9, 0x03, 0xF8, 0x03, 0xD8, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0xF9, 0x03, 0xD9, 0x03, 0xF8, 0x03, 0x77, 0x03, 0x1F, 0xA7, 0xBF, 0xFF, 0xFE, 0xFF, 0xFE, 0xEF, 
+0xFF, 0xF7, 0x9E, 0xFF, 0xBF, 0xEF, 0x59, 0x0C, 0x78, 0x0C, 0x5A, 0x5D, 0x7C, 0x55, 0x39, 0x55, 0x7A, 0x5D, 0x3A, 0x65, 0x1A, 0x55, 0x3A, 0x4D, 0x5A, 0x5D, 0x5C, 0x55, 0x3C, 0x55, 0x7A, 0x65, 
+0x5B, 0x55, 0x5B, 0x55, 0x5B, 0x55, 0x5B, 0x55, 0x5B, 0x55, 0x5B, 0x55, 0x5B, 0x55, 0x5B, 0x55, 0x16, 0x5D, 0x7C, 0x55, 0x7C, 0x4D, 0x19, 0x5D, 0x3A, 0x5D, 0x7C, 0x4D, 0x1B, 0x5D, 0x1A, 0x5D, 
+0x1A, 0x55, 0xBF, 0x45, 0x39, 0x4D, 0x79, 0x0C, 0xF8, 0x0B, 0xDF, 0xF7, 0xDF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDA, 0x65, 0x19, 0x04, 0xFA, 0x03, 0x7F, 0xEF, 0xFE, 0xFF, 0xFF, 0xF7, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xDC, 0xFF, 0x9A, 0x1C, 0x99, 0x03, 0xB9, 0x75, 0xFF, 0xF7, 0xBD, 0xFF, 
+0xDF, 0xEF, 0xBF, 0xE7, 0xD7, 0x03, 0xB9, 0x03, 0x9A, 0x65, 0x19, 0x04, 0x5A, 0x96, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xF7, 
+0xDF, 0xF7, 0x5E, 0xD7, 0xBD, 0x24, 0xFB, 0x44, 0xF9, 0x03, 0x16, 0x04, 0x7E, 0xD7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFB, 0x7D, 0xB9, 0x03, 0xD8, 0x13, 0xFF, 0xFF, 0x3F, 0xC7, 0x3B, 0x0C, 0x59, 0x45, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0x5B, 0x86, 0x9A, 0x24, 0xBE, 0xEF, 0xBE, 0xFF, 0xB9, 0x03, 0xDA, 0x03, 0xF9, 0x85, 0xDF, 0xFF, 
+0xFE, 0xFF, 0x57, 0x24, 0xDA, 0x03, 0xF8, 0x0B, 0xFD, 0xFF, 0xFF, 0xF7, 0xBE, 0xFF, 0x78, 0x34, 0x5A, 0x1C, 0x9D, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xBC, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0x7D, 0x55, 
+0x3B, 0x6D, 0x7C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x38, 0x04, 0xF8, 0x03, 0x3A, 0x0C, 0xDF, 0xFF, 0xDF, 0xC6, 0xF9, 0x03, 0xDA, 0x03, 0xF8, 0x1B, 0xFF, 0xF7, 0xDF, 0xEF, 0xFE, 0xFF, 0xFF, 0xEF, 
+0xDB, 0x7D, 0xB9, 0x03, 0x9C, 0xA6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBF, 0xFF, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0x5E, 0xD7, 0x79, 0x1C, 0x5B, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xD7, 0x0B, 0xF9, 0x03, 0xF9, 0x03, 0x3D, 0xC7, 
+0x1C, 0x8E, 0xB8, 0x03, 0x37, 0x04, 0xB7, 0x03, 0xFF, 0xF7, 0xBD, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x3E, 0xB7, 0xF7, 0x0B, 0x7B, 0x6D, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x96, 0x79, 0x34, 0x7F, 0xD7, 0xFF, 0xFF, 
+0xFD, 0xFF, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xD9, 0x0B, 0xF9, 0x0B, 0x99, 0x03, 0x3B, 0x86, 0x7C, 0x4D, 0x97, 0x0B, 0xF9, 0x0B, 0x19, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0x99, 0x1C, 0xD9, 0x1C, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0x7B, 0x65, 0x7A, 0x4D, 0xBF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xF8, 0x03, 0xB7, 0x0B, 0x3C, 0x45, 
+0xDA, 0x34, 0xB7, 0x03, 0xF9, 0x03, 0x19, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x6D, 0xF8, 0x03, 0x5D, 0xC7, 0xBE, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xDF, 0xFF, 0xDF, 0xEF, 0x19, 0x45, 0x1D, 0x96, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x04, 0xD8, 0x03, 0xB7, 0x03, 0xBA, 0x2C, 0x38, 0x14, 0xD8, 0x03, 0xF9, 0x03, 0x19, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xBB, 0x5D, 0xD8, 0x03, 0xFB, 0x85, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFE, 0xEF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xBC, 0xAE, 0x1A, 0x04, 0x9B, 0x6D, 0xFF, 0xFF, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0x04, 0xD8, 0x03, 0xD8, 0x03, 0x39, 0x14, 
+0xF8, 0x03, 0x19, 0x04, 0xF9, 0x03, 0x18, 0x04, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x6D, 0x7C, 0x55, 0x77, 0x1C, 
+0x99, 0x3C, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x65, 0xF7, 0x3C, 0x3C, 0x55, 0x18, 0x2C, 0xFF, 0xF7, 0xFF, 0xF7, 0xDD, 0xFF, 0xFD, 0xFF, 0xDF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x38, 0x04, 0xD8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF8, 0x03, 0x19, 0x04, 0xF9, 0x03, 0x18, 0x04, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x1A, 0x86, 0x5D, 0x9E, 0xFF, 0xFF, 0xDF, 0xF7, 0x3A, 0x55, 0x17, 0x04, 0x5F, 0xC7, 0xDF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xF9, 0x3C, 0xDB, 0x7D, 
+0xDF, 0xFF, 0xFC, 0xFF, 0xFD, 0x6D, 0x9A, 0x3C, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x38, 0x04, 0xD8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 
+0x38, 0x14, 0xD8, 0x03, 0xF9, 0x03, 0x19, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xDF, 0xEF, 0xDF, 0xF7, 0xDD, 0xB6, 0xFE, 0x75, 0xFD, 0xFF, 0x9D, 0xFF, 0xDF, 0xFF, 
+0xFF, 0xFF, 0x7D, 0x96, 0x19, 0x04, 0xDA, 0x85, 0x1A, 0x96, 0xB9, 0x2C, 0xFD, 0xB6, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFF, 0x5C, 0x35, 0x7B, 0x75, 0xFF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0x04, 0xD8, 0x03, 0xD8, 0x03, 0x39, 0x14, 0xDA, 0x34, 0xB7, 0x03, 0xF9, 0x03, 0x19, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0x5C, 0xD7, 0xDB, 0x65, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0x5E, 0xD7, 0x19, 0x0C, 0xBB, 0x2C, 0x9D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xDF, 0xFF, 0xF7, 0xDE, 0xFF, 0xDD, 0xFF, 0x79, 0x1C, 0xDC, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x04, 0xD8, 0x03, 0xB7, 0x03, 0xBA, 0x2C, 
+0x7C, 0x4D, 0x97, 0x0B, 0xF9, 0x0B, 0x19, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xE7, 0xFB, 0x64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x5D, 0xC7, 0x9E, 0xF7, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0xBE, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xF8, 0x03, 0xB7, 0x0B, 0x3C, 0x45, 0x1E, 0x8E, 0x98, 0x03, 0xF9, 0x03, 0xD8, 0x03, 0xFF, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xF7, 0x38, 0x55, 0xBF, 0xDF, 0xBD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x5A, 0xAE, 
+0x38, 0x1C, 0x9D, 0xDF, 0xDF, 0xFF, 0xDE, 0xE7, 0xDE, 0xFF, 0x1F, 0xD7, 0x37, 0x04, 0x3E, 0xE7, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x03, 0xF9, 0x0B, 0xB9, 0x03, 0xFC, 0x85, 
+0x1B, 0xBF, 0x1A, 0x04, 0xD6, 0x0B, 0x3B, 0x04, 0xFE, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0x38, 0x65, 0xBF, 0xD7, 0xBF, 0xF7, 0xFF, 0xEF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xB6, 0x1B, 0x55, 
+0x5A, 0x65, 0xBB, 0x6D, 0x9B, 0x65, 0x9B, 0x65, 0xBB, 0x6D, 0x5A, 0x65, 0x7B, 0x5D, 0xDD, 0x6D, 0x7B, 0x1C, 0x59, 0x04, 0x1E, 0xCF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDD, 0xFF, 0x5B, 0xC6, 0x7B, 0x04, 
+0xFF, 0xEF, 0xBF, 0xFF, 0xDD, 0xFF, 0xDE, 0xFF, 0xF9, 0x03, 0x57, 0x04, 0xBB, 0x03, 0x7D, 0xC7, 0xFE, 0xF7, 0x7B, 0x1C, 0xD8, 0x03, 0xB8, 0x03, 0xFF, 0xFF, 0xBF, 0xF7, 0xFE, 0xFF, 0xBC, 0x75, 
+0xDF, 0xBE, 0xDE, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xDE, 0xFF, 0xFF, 0xF7, 0x39, 0x45, 0xD7, 0x0B, 0xD8, 0x03, 0xF8, 0x03, 0x19, 0x04, 0xF7, 0x03, 0xF7, 0x03, 0x17, 0x04, 0xF8, 0x03, 0x19, 0x04, 
+0xF7, 0x03, 0xD9, 0x03, 0x59, 0x1C, 0xDD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0x1C, 0x86, 0x38, 0x2C, 0xFF, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0x39, 0x04, 0xF8, 0x03, 0x1A, 0x14, 0xFF, 0xFF, 
+0xFF, 0xF7, 0x9D, 0x85, 0x99, 0x03, 0x39, 0x0C, 0xBE, 0xFF, 0xFF, 0xF7, 0x9D, 0x86, 0x3C, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0x5E, 0xBF, 0x3C, 0xAE, 
+0x7E, 0xA6, 0x5D, 0x9E, 0x5D, 0x9E, 0x7D, 0x9E, 0x7D, 0xA6, 0x5D, 0x9E, 0x5D, 0xA6, 0x9E, 0xA6, 0x99, 0x24, 0x7B, 0x2C, 0xFE, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 
+0x5B, 0x65, 0x3A, 0x2D, 0xDF, 0xFF, 0xFE, 0xFF, 0x39, 0x04, 0x78, 0x03, 0xFB, 0x75, 0xDF, 0xFF, 0xDE, 0xF7, 0xFF, 0xF7, 0xB8, 0x03, 0xF5, 0x0B, 0xFE, 0xFF, 0xFF, 0xB6, 0xDA, 0x7D, 0xDE, 0xFF, 
+0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xD8, 0xA5, 
+0x9A, 0x34, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x97, 0x3C, 0xBB, 0x85, 0xFE, 0xFF, 0x18, 0x0C, 0xD9, 0x0B, 0xBD, 0xE7, 0xFD, 0xF7, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xDC, 0x5D, 0xB5, 0x03, 0x7E, 0x96, 0xFC, 0x3C, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xE7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0x7A, 0x14, 0xFD, 0x75, 0x56, 0x03, 0x9D, 0x65, 0xDE, 0xFF, 0xFF, 0xF7, 0xDF, 0xF7, 0xBE, 0xFF, 0xFF, 0xEF, 0x3A, 0x0C, 0xB8, 0x03, 0x97, 0x03, 0x5A, 0x55, 0x7A, 0x5D, 
+0x7C, 0x4D, 0x59, 0x55, 0x9A, 0x4D, 0x3B, 0x5D, 0xFA, 0x54, 0x5A, 0x4D, 0x5C, 0x65, 0x3C, 0x5D, 0x5A, 0x55, 0x7B, 0x55, 0x5A, 0x55, 0x5A, 0x55, 0x3A, 0x55, 0x5A, 0x55, 0x9B, 0x55, 0x3A, 0x45, 
+0x7C, 0x5D, 0x39, 0x5D, 0x7B, 0x4D, 0x3B, 0x55, 0x3A, 0x5D, 0x7C, 0x45, 0xFB, 0x5C, 0x9B, 0x55, 0x5A, 0x65, 0x59, 0x4D, 0x7A, 0x14, 0xD9, 0x03, 0x5B, 0x14, 0xDF, 0xEF, 0x9F, 0xFF, 0xFF, 0xF7, 
+0xDE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBE, 0xAE, 0x77, 0x03, 0x1A, 0x04, 0x19, 0x04, 0x17, 0x04, 0xF9, 0x03, 0xD8, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0x19, 0x04, 0xF8, 0x03, 0x98, 0x0B, 0x17, 0x04, 
+0xD9, 0x03, 0xD9, 0x03, 0x1A, 0x04, 0x19, 0x04, 0xF8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xF9, 0x03, 0xB7, 0x03, 0xF7, 0x03, 0xD7, 0x03, 0xF8, 0x0B, 0x18, 0x04, 0xD8, 0x03, 
+0xD9, 0x03, 0xD9, 0x03, 0xFA, 0x03, 0x97, 0x0B, 0x7B, 0xAE, 0xFF, 0xF7, 0xFF, 0xFF, 0xDD, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xF7, 0xDD, 0x6D, 0x97, 0x0B, 0xD8, 0x03, 0x1A, 0x04, 
+0x19, 0x0C, 0xD8, 0x03, 0xF9, 0x03, 0xFA, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD9, 0x03, 0xFA, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 
+0x1A, 0x04, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x03, 0xFA, 0x03, 0x1A, 0x04, 0xB8, 0x03, 0x3A, 0x0C, 0xFA, 0x03, 0xF8, 0x03, 0xB8, 0x0B, 0x9B, 0x65, 0xDF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBF, 0xFF, 0xB8, 0x44, 0xDA, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0x1A, 0x04, 0xD9, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0x38, 0x04, 0x59, 0x04, 0xB8, 0x03, 
+0xD8, 0x03, 0xF8, 0x03, 0x19, 0x04, 0x19, 0x04, 0x19, 0x04, 0x19, 0x04, 0xF8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0x7A, 0x04, 0x18, 0x04, 0x18, 0x0C, 0xF8, 0x03, 0xD9, 0x03, 0x3A, 0x04, 0xF7, 0x03, 
+0xF8, 0x03, 0xBA, 0x03, 0xD8, 0x44, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0xFF, 0xFF, 0x19, 0x55, 0x97, 0x03, 
+0xD8, 0x0B, 0xF8, 0x03, 0x18, 0x04, 0xD8, 0x03, 0x19, 0x04, 0xD9, 0x03, 0x77, 0x03, 0x38, 0x04, 0xD9, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD9, 0x03, 
+0x38, 0x04, 0x97, 0x03, 0xB9, 0x03, 0x19, 0x04, 0xF8, 0x03, 0xF8, 0x03, 0x18, 0x04, 0xD8, 0x0B, 0xB8, 0x0B, 0xD8, 0x44, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7B, 0x65, 0x98, 0x03, 0xB8, 0x0B, 0xB7, 0x03, 0x19, 0x04, 0xD8, 0x03, 0xD7, 0x03, 0x59, 0x0C, 0xB9, 0x03, 
+0xF9, 0x03, 0xF9, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xB9, 0x03, 0x39, 0x0C, 0xD8, 0x0B, 0xB8, 0x03, 0xF9, 0x03, 0xD8, 0x03, 0x97, 0x0B, 0x98, 0x03, 
+0xBC, 0x65, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xDF, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 
+0x9E, 0xA6, 0x18, 0x14, 0x99, 0x03, 0x1A, 0x0C, 0xF8, 0x03, 0xD8, 0x03, 0x98, 0x03, 0xB7, 0x0B, 0xF9, 0x03, 0xD9, 0x03, 0xD8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xD8, 0x03, 0xD9, 0x03, 0xF9, 0x03, 
+0xB7, 0x0B, 0x78, 0x03, 0xF9, 0x03, 0xF8, 0x03, 0xFA, 0x03, 0x9A, 0x03, 0xD7, 0x13, 0x9E, 0xA6, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xF7, 0xDE, 0xFF, 0xFE, 0xEF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xB9, 0x75, 0xF7, 0x03, 0xBA, 0x03, 0xD9, 0x03, 0x19, 0x04, 0x3B, 0x04, 
+0xD8, 0x03, 0xD8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0x3B, 0x04, 0x39, 0x04, 0xB9, 0x03, 0xDA, 0x03, 0xF7, 0x03, 0x98, 0x6D, 0xFF, 0xF7, 0xFF, 0xF7, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFE, 0xEF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xEF, 0xFF, 0xFF, 0x5C, 0xEF, 0xB9, 0x7D, 0x79, 0x14, 0xB8, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD8, 0x03, 0xF9, 0x03, 0xF9, 0x03, 0xD8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0x97, 0x03, 0xD9, 0x03, 0x58, 0x14, 0xB9, 0x7D, 0x7D, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 
+0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0xCF, 0x1B, 0x86, 
+0x3B, 0x3D, 0xBA, 0x2C, 0x39, 0x0C, 0xF8, 0x03, 0xF8, 0x03, 0x39, 0x0C, 0xBA, 0x2C, 0x3B, 0x3D, 0x1C, 0x8E, 0x3E, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xDE, 0xFF, 
+};
@@ -0,0 +1,432 @@
+/* 84x84 RGB565 RLE picture converted from tag_detection_84x84_jpg.h by pict2rgb565, 13684 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char tag_detection_84x84[] = {
+0x52, 0x35, 0x36, 0x35, 0x01, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0xB2, 0x1A, 0x00, 0x00, 0xF2, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0x7F, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xF7, 0xFE, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xF7, 
+0xBE, 0xEF, 0x9D, 0xEF, 0x9D, 0xE7, 0x9C, 0xDF, 0x9C, 0xDF, 0x5C, 0xEF, 0x3C, 0xEF, 0x3C, 0xEF, 0x3C, 0xEF, 0x5C, 0xE7, 0x5C, 0xE7, 0x5C, 0xEF, 0x9C, 0xDF, 0x1D, 0xEF, 0x7C, 0xDF, 0x5C, 0xE7, 
+0x5E, 0xEF, 0x5D, 0xDF, 0x7D, 0xEF, 0x7D, 0xE7, 0x7D, 0xDF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5E, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 
+0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xEF, 0x7C, 0xEF, 0x7D, 0xEF, 0x9D, 0xF7, 0x5D, 0xF7, 0xBD, 0xF7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xF7, 
+0xDE, 0xF7, 0xBD, 0xEF, 0x5C, 0xDF, 0xBB, 0xCE, 0x5A, 0xC6, 0x19, 0xBE, 0xB8, 0xB5, 0x77, 0xB5, 0x56, 0xB5, 0xB7, 0xA5, 0x97, 0xAD, 0xB6, 0xA5, 0x96, 0xAD, 0x96, 0xAD, 0xB6, 0xA5, 0x96, 0xAD, 
+0x96, 0xAD, 0x97, 0xAD, 0xB6, 0x9D, 0xB6, 0xA5, 0xB7, 0xA5, 0x57, 0xAD, 0x96, 0xB5, 0xD6, 0xAD, 0x76, 0xA5, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xA5, 0x77, 0xA5, 
+0x77, 0xA5, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0xB7, 0xA5, 0xB7, 0xA5, 0xB7, 0xA5, 0xB7, 0xA5, 0xB7, 0xAD, 0xB7, 0xAD, 0xB7, 0xA5, 0x97, 0xA5, 0xB7, 0xA5, 0xB7, 0xAD, 0xD8, 0xB5, 
+0xF8, 0xB5, 0x79, 0xCE, 0xDB, 0xDE, 0x3C, 0xE7, 0x5D, 0xEF, 0x7E, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0x1A, 0xDF, 0x59, 0xBE, 0x76, 0x9D, 0x75, 0x64, 0xF4, 0x43, 0xD6, 0x2B, 0xD7, 0x1B, 0xD8, 0x1B, 0xF8, 0x1B, 0xB7, 0x1B, 0xB7, 0x1B, 0xB7, 0x1B, 
+0xD7, 0x1B, 0xD7, 0x13, 0xF7, 0x13, 0xD7, 0x1B, 0xB8, 0x23, 0xF7, 0x1B, 0xD7, 0x23, 0xD7, 0x13, 0x17, 0x14, 0xB7, 0x23, 0xD7, 0x1B, 0x17, 0x1C, 0xD7, 0x23, 0x18, 0x1C, 0x18, 0x14, 0x38, 0x1C, 
+0x38, 0x1C, 0x38, 0x1C, 0x58, 0x1C, 0x59, 0x1C, 0x59, 0x1C, 0x5B, 0x1C, 0x5B, 0x1C, 0x7B, 0x1C, 0x7B, 0x1C, 0x9B, 0x1C, 0x9B, 0x1C, 0x9B, 0x1C, 0x9B, 0x1C, 0x9B, 0x1C, 0xBB, 0x1C, 0xBB, 0x1C, 
+0xBB, 0x1C, 0xBB, 0x1C, 0xBB, 0x1C, 0xBC, 0x24, 0xBC, 0x24, 0x79, 0x34, 0xF9, 0x64, 0xB8, 0x9D, 0x59, 0xBE, 0xFB, 0xCE, 0x7E, 0xDF, 0x9E, 0xEF, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xF7, 0x5C, 0xE7, 0xFB, 0xCE, 0xB8, 0x9D, 0x55, 0x6C, 0xF8, 0x23, 0xD7, 0x1B, 0xF8, 0x0B, 0x7A, 0x0C, 0xDC, 0x0C, 0xDB, 0x04, 0xDA, 0x04, 
+0xDA, 0x04, 0xFB, 0x04, 0x1B, 0x05, 0xBB, 0x14, 0xFB, 0x0C, 0x1B, 0x05, 0xDC, 0x0C, 0xBC, 0x14, 0xFC, 0x04, 0x9B, 0x0C, 0xDD, 0x14, 0xBD, 0x04, 0xDC, 0x0C, 0x3D, 0x0D, 0x1D, 0x05, 0x1D, 0x0D, 
+0x1D, 0x05, 0x1C, 0x0D, 0x1D, 0x0D, 0x1D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x5E, 0x0D, 0x5E, 0x0D, 0x5E, 0x0D, 0x7E, 0x0D, 0x7E, 0x0D, 0x7F, 0x0D, 0x9F, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 
+0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xBF, 0x0D, 0x5D, 0x15, 0xFE, 0x04, 0x9D, 0x0C, 0x9B, 0x34, 0xF7, 0x6C, 0xD7, 0xAD, 0xBA, 0xD6, 
+0x7D, 0xEF, 0xBE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0x7C, 0xF7, 0x1C, 0xE7, 0xF9, 0xAD, 0x96, 0x5C, 0xD6, 0x23, 0xF8, 0x13, 0x79, 0x14, 0x7A, 0x0C, 0xBB, 0x0C, 
+0xDC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x3D, 0x15, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x14, 0xDC, 0x1C, 0xFC, 0x14, 0x3C, 0x05, 0x1C, 0x0D, 0x1B, 0x05, 0x3C, 0x15, 0xFD, 0x14, 
+0xFC, 0x0C, 0x5B, 0x0D, 0xDB, 0x14, 0xFE, 0x14, 0x3C, 0x05, 0x3D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x5D, 0x0D, 0x5E, 0x0D, 0x7E, 0x0D, 0x7E, 0x0D, 0x9F, 0x0D, 0xBE, 0x0D, 0xBE, 0x0D, 0xBE, 0x0D, 
+0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0xFF, 0x0D, 0xFF, 0x0D, 0xDF, 0x05, 0xDF, 0x0D, 0xBF, 0x15, 
+0x3F, 0x15, 0x9E, 0x0C, 0x5A, 0x24, 0x18, 0x6D, 0xF7, 0xA5, 0x1B, 0xDF, 0x7D, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x9D, 0xEF, 0xBA, 0xC6, 0xF6, 0x7C, 0xF5, 0x3B, 0xF8, 0x1B, 0x9B, 0x0C, 
+0xDC, 0x04, 0xDD, 0x0C, 0xFD, 0x0C, 0x1D, 0x0D, 0x1D, 0x0D, 0xFD, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 0xFD, 0x14, 0xDC, 0x14, 0x5D, 0x05, 0x3D, 0x05, 0x1D, 0x15, 0x3B, 0x0D, 0xBA, 0x24, 
+0xF9, 0x0C, 0x5C, 0x0D, 0xF6, 0x63, 0xD8, 0x63, 0x3C, 0x1D, 0x58, 0x4C, 0xF5, 0x82, 0x9C, 0x44, 0x3C, 0x0D, 0x3D, 0x15, 0x3D, 0x15, 0x3D, 0x15, 0x5D, 0x15, 0x5D, 0x15, 0x7E, 0x15, 0x7E, 0x15, 
+0x7E, 0x15, 0xBF, 0x15, 0xBF, 0x0D, 0xBF, 0x15, 0xDF, 0x15, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x15, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0x1F, 0x0E, 0xFF, 0x15, 0xFF, 0x15, 
+0xFF, 0x0D, 0xDF, 0x15, 0xBF, 0x15, 0xBD, 0x15, 0xDE, 0x0D, 0xBF, 0x05, 0x3F, 0x0D, 0xBD, 0x1C, 0x5A, 0x2C, 0xB9, 0x8D, 0x5B, 0xB6, 0x3D, 0xE7, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0x5B, 0xF7, 0xF9, 0xB5, 0x97, 0x64, 
+0xF7, 0x2B, 0x59, 0x14, 0xBB, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1B, 0x0D, 0x1B, 0x0D, 0x1B, 0x0D, 0xFB, 0x0C, 0x1B, 0x0D, 0x3C, 0x15, 0x1C, 0x0D, 0x1C, 0x0D, 0x3C, 0x0D, 0xFC, 0x14, 0x3B, 0x05, 
+0xFB, 0x14, 0x3A, 0x0D, 0xF9, 0x5B, 0xF6, 0xC9, 0xB5, 0x53, 0xBC, 0x2C, 0x2F, 0xC9, 0x93, 0xB9, 0xFC, 0x1C, 0xF4, 0x82, 0xAF, 0xD8, 0x59, 0x4C, 0x5D, 0x0D, 0x3D, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 
+0x5E, 0x0D, 0x7E, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 
+0x1F, 0x0E, 0x3F, 0x0E, 0x1F, 0x0E, 0xFF, 0x0D, 0xFF, 0x0D, 0x1E, 0x0E, 0xFF, 0x0D, 0xFF, 0x15, 0xDF, 0x15, 0xBF, 0x0D, 0x9F, 0x0D, 0x5E, 0x15, 0xFE, 0x14, 0x17, 0x24, 0x19, 0x6D, 0x3A, 0xBE, 
+0x3C, 0xEF, 0xBD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 
+0x5B, 0xEF, 0x19, 0xAE, 0x75, 0x54, 0xF7, 0x13, 0x7B, 0x04, 0xBC, 0x04, 0xDC, 0x0C, 0x1C, 0x15, 0xFB, 0x0C, 0xDC, 0x0C, 0xDC, 0x14, 0x1C, 0x05, 0x1C, 0x05, 0xFC, 0x0C, 0xFC, 0x04, 0xFC, 0x04, 
+0x9C, 0x1C, 0xDD, 0x0C, 0x3D, 0x0D, 0xFA, 0x04, 0xDD, 0x0C, 0x1E, 0x15, 0x32, 0xA2, 0x8D, 0xD0, 0x1A, 0x54, 0xF9, 0x5B, 0xAD, 0xC8, 0xF5, 0xA2, 0x3C, 0x1D, 0x8F, 0xB1, 0x6E, 0xB9, 0x7C, 0x34, 
+0x5C, 0x05, 0x3D, 0x15, 0x3D, 0x0D, 0x5D, 0x15, 0x5D, 0x0D, 0x7D, 0x0D, 0x7E, 0x15, 0x9E, 0x0D, 0x9E, 0x0D, 0xBF, 0x15, 0xBE, 0x15, 0xBE, 0x15, 0xDE, 0x0D, 0xDE, 0x0D, 0xFE, 0x0D, 0xFE, 0x0D, 
+0xFE, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x15, 0xFF, 0x0D, 0xFF, 0x0D, 0xBF, 0x1D, 0xDF, 0x05, 0xDE, 0x0D, 0xBF, 0x15, 0xBF, 0x0D, 0xFF, 0x05, 0xBF, 0x0D, 
+0x7D, 0x0D, 0x1E, 0x0D, 0x9B, 0x14, 0xB9, 0x4C, 0xFB, 0xAD, 0x3C, 0xEF, 0xBD, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0x7D, 0xEF, 0x19, 0xB6, 0x76, 0x54, 0xF6, 0x23, 0x59, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x04, 0xFC, 0x14, 0xFC, 0x0C, 0x1C, 0x05, 
+0x1B, 0x05, 0xFB, 0x0C, 0xFB, 0x0C, 0x3B, 0x05, 0x5B, 0x05, 0xFC, 0x0C, 0x9B, 0x14, 0x5E, 0x2D, 0x3C, 0x15, 0x16, 0x44, 0xED, 0xC8, 0xB0, 0xA9, 0xDB, 0x2C, 0xD4, 0x8A, 0x8D, 0xD0, 0xF8, 0x6B, 
+0x78, 0x2C, 0x0F, 0xD1, 0xF3, 0xA1, 0x5D, 0x0D, 0x1C, 0x0D, 0x5E, 0x0D, 0x5E, 0x0D, 0x5E, 0x0D, 0x5E, 0x0D, 0x7E, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0x9F, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xDF, 0x0D, 
+0xDF, 0x0D, 0xFF, 0x0D, 0xFF, 0x0D, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0xFF, 0x0D, 0xFF, 0x0D, 0xFF, 0x05, 0x1F, 0x0E, 0xDF, 0x0D, 
+0x9E, 0x15, 0x9F, 0x15, 0xDF, 0x05, 0x9F, 0x05, 0x5F, 0x1D, 0x5D, 0x15, 0x1E, 0x15, 0x7A, 0x24, 0xD7, 0x5C, 0x59, 0xBE, 0x7D, 0xEF, 0xBF, 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x7D, 0xF7, 0x99, 0xBE, 0xB7, 0x64, 0xF8, 0x13, 0x39, 0x0C, 0xDB, 0x04, 0x1C, 0x0D, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 
+0xFD, 0x04, 0x1C, 0x0D, 0x1C, 0x05, 0xFB, 0x0C, 0xDB, 0x14, 0xFB, 0x14, 0x3C, 0x0D, 0x3C, 0x05, 0x1C, 0x05, 0x1D, 0x15, 0x1A, 0x05, 0xFB, 0x04, 0x3D, 0x1D, 0xF0, 0x99, 0x6C, 0xD8, 0x17, 0x74, 
+0xBB, 0x3C, 0x6E, 0xC1, 0xB1, 0xB1, 0x3B, 0x1D, 0x16, 0x83, 0x8D, 0xD0, 0x98, 0x6B, 0x5D, 0x15, 0xFD, 0x14, 0x5D, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 0x7D, 0x0D, 0x7E, 0x0D, 0x9E, 0x0D, 0x9E, 0x0D, 
+0xBE, 0x0D, 0xBF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xDF, 0x0D, 0xFF, 0x0D, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0x1F, 0x0E, 0xFF, 0x0D, 
+0xFF, 0x0D, 0xBF, 0x0D, 0xFF, 0x0D, 0xDF, 0x0D, 0xBF, 0x05, 0xFF, 0x0D, 0xBF, 0x0D, 0x7F, 0x15, 0x7F, 0x15, 0x7D, 0x15, 0x9F, 0x15, 0xDD, 0x04, 0x58, 0x14, 0x17, 0x65, 0x7B, 0xC6, 0x7D, 0xEF, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7E, 0xF7, 0x3C, 0xE7, 0x16, 0x75, 0x17, 0x24, 0x9B, 0x04, 0xDD, 0x0C, 0x1D, 0x0D, 
+0xFC, 0x04, 0xFB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0x1C, 0x05, 0x1C, 0x05, 0xFB, 0x0C, 0xFB, 0x0C, 0xDC, 0x14, 0xDC, 0x14, 0x1C, 0x0D, 0xFC, 0x0C, 0x9C, 0x1C, 0x9D, 0x0C, 0xFB, 0x0C, 0x3B, 0x1D, 
+0x97, 0x6B, 0x4E, 0xD8, 0x33, 0xAA, 0xFA, 0x2C, 0xF7, 0x92, 0xAC, 0xC8, 0x77, 0x7B, 0xDB, 0x2C, 0x52, 0xD9, 0x2E, 0xB1, 0x7A, 0x3C, 0x3E, 0x1D, 0x7C, 0x05, 0x3C, 0x0D, 0x3D, 0x0D, 0x5D, 0x0D, 
+0x5D, 0x15, 0x7D, 0x15, 0x7E, 0x15, 0x9E, 0x15, 0x9E, 0x15, 0xBF, 0x15, 0xBF, 0x15, 0xDF, 0x15, 0xDF, 0x15, 0xDF, 0x15, 0xFF, 0x15, 0xFF, 0x15, 0xFF, 0x15, 0x1F, 0x16, 0xFF, 0x15, 0xFF, 0x15, 
+0xFF, 0x15, 0xFF, 0x15, 0xFF, 0x15, 0xDF, 0x15, 0xDF, 0x15, 0xDF, 0x0D, 0xFF, 0x0D, 0xBF, 0x15, 0x7F, 0x1D, 0xBF, 0x0D, 0xBE, 0x0D, 0xBE, 0x15, 0xBE, 0x05, 0x7F, 0x0D, 0x9E, 0x0D, 0x9F, 0x0D, 
+0xDD, 0x04, 0x39, 0x24, 0x37, 0x85, 0xDA, 0xD6, 0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0x5C, 0xE7, 0xF9, 0xA5, 0x16, 0x3C, 
+0x18, 0x0C, 0xDB, 0x04, 0xFC, 0x0C, 0xFD, 0x0C, 0xDC, 0x0C, 0xFC, 0x14, 0xFC, 0x14, 0xFB, 0x0C, 0xFB, 0x04, 0x1B, 0x05, 0xDC, 0x14, 0x1C, 0x0D, 0x3C, 0x05, 0xDC, 0x0C, 0xDC, 0x0C, 0x1C, 0x05, 
+0x1C, 0x05, 0x1D, 0x05, 0xDC, 0x24, 0xD7, 0x7B, 0xAC, 0xD0, 0x30, 0xD1, 0x7B, 0x44, 0x5A, 0x3C, 0x0F, 0xC9, 0xB2, 0xB1, 0xFB, 0x34, 0x75, 0x73, 0x8D, 0xD8, 0xF4, 0x92, 0x1B, 0x15, 0x1D, 0x25, 
+0x55, 0x63, 0x77, 0x63, 0x77, 0x63, 0x77, 0x63, 0x97, 0x63, 0x97, 0x63, 0x98, 0x63, 0xB8, 0x63, 0xB8, 0x63, 0xB8, 0x63, 0xB8, 0x63, 0xD8, 0x63, 0xD8, 0x63, 0xD8, 0x63, 0xD8, 0x63, 0xD8, 0x63, 
+0xD8, 0x63, 0xF8, 0x63, 0xF8, 0x63, 0xD8, 0x63, 0xD8, 0x63, 0xD8, 0x63, 0xD8, 0x63, 0xD8, 0x63, 0xD8, 0x63, 0x79, 0x5C, 0x3B, 0x25, 0xFF, 0x0D, 0xFF, 0x0D, 0x7F, 0x0D, 0x7E, 0x15, 0xBE, 0x15, 
+0x9D, 0x15, 0x7F, 0x0D, 0x5C, 0x0D, 0x9D, 0x0D, 0x3F, 0x05, 0x7C, 0x0C, 0x77, 0x44, 0xB7, 0xA5, 0x3C, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 
+0x9F, 0xF7, 0xFC, 0xCE, 0x55, 0x5C, 0x18, 0x1C, 0xBA, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDC, 0x14, 0xDC, 0x0C, 0xDB, 0x0C, 0x1B, 0x0D, 0xFB, 0x0C, 0x1C, 0x0D, 0x1C, 0x05, 
+0x1D, 0x0D, 0xFC, 0x0C, 0x3C, 0x05, 0x5B, 0x05, 0xFA, 0x24, 0x38, 0x44, 0xD4, 0x8A, 0xAD, 0xD0, 0xEF, 0xC8, 0x39, 0x54, 0x1A, 0x1D, 0x12, 0xA2, 0xAC, 0xD0, 0xF9, 0x5B, 0xBA, 0x3C, 0x6E, 0xB9, 
+0x0D, 0xC1, 0x9A, 0x4C, 0x9D, 0x0D, 0x99, 0x5B, 0x8D, 0xD0, 0x4D, 0xD0, 0x2D, 0xD0, 0x2D, 0xD0, 0x2D, 0xD0, 0x2D, 0xD0, 0x2D, 0xD0, 0x2D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 
+0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x4D, 0xD0, 0x2D, 0xD0, 0x2D, 0xD0, 0x8F, 0xE0, 0x71, 0xB9, 0xD8, 0x73, 
+0x9D, 0x2D, 0x9F, 0x0D, 0x5F, 0x0D, 0x9F, 0x15, 0x7E, 0x0D, 0x9E, 0x0D, 0x3D, 0x15, 0x5D, 0x15, 0x5E, 0x0D, 0x1E, 0x0D, 0x39, 0x1C, 0x96, 0x64, 0xDA, 0xD6, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xF7, 0x5C, 0xEF, 0xB9, 0x9D, 0xB5, 0x23, 0x7B, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 
+0x1C, 0x0D, 0xFB, 0x0C, 0x1C, 0x05, 0xFC, 0x0C, 0xDC, 0x14, 0xFB, 0x14, 0x79, 0x34, 0x76, 0x63, 0xD4, 0x8A, 0x30, 0xC9, 0xCE, 0xC8, 0xF1, 0xB1, 0x5A, 0x5C, 0x9A, 0x34, 0x93, 0x92, 0x4D, 0xD8, 
+0x54, 0x7B, 0xFA, 0x34, 0x74, 0x9A, 0x4D, 0xE0, 0xF4, 0x8A, 0x3C, 0x15, 0xBB, 0x44, 0x71, 0xA9, 0x4A, 0xC0, 0x2D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 
+0x0C, 0xD0, 0x0A, 0xB8, 0x2B, 0xD0, 0x30, 0xC9, 0x97, 0x73, 0xBD, 0x15, 0xDF, 0x05, 0x5F, 0x0D, 0x7E, 0x05, 0x7D, 0x0D, 0x5E, 0x15, 0x5D, 0x1D, 0x3D, 0x0D, 0x5E, 0x0D, 0x7C, 0x04, 0x37, 0x34, 
+0xD9, 0x9D, 0x3C, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xF7, 0xDE, 0xEF, 0xFA, 0xDE, 0x35, 0x6C, 0xF8, 0x1B, 0xBB, 0x04, 0xFC, 0x0C, 0xFD, 0x0C, 0xFC, 0x0C, 0x1B, 0x0D, 
+0x3A, 0x0D, 0x1B, 0x05, 0x1C, 0x0D, 0xFC, 0x0C, 0xDC, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xBC, 0x14, 0x1B, 0x05, 0xD9, 0x14, 0x95, 0x8A, 0x90, 0xE8, 0x6C, 0xD0, 0xD0, 0xB1, 0x55, 0x6B, 0xD9, 0x2C, 
+0xB9, 0x3C, 0xF2, 0xB1, 0x4D, 0xC0, 0x94, 0x9A, 0xFC, 0x34, 0xB6, 0x7B, 0xAE, 0xC8, 0xD2, 0xA1, 0x1B, 0x2D, 0x1C, 0x15, 0xF6, 0x82, 0x6B, 0xD0, 0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2D, 0xD0, 0x2D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0D, 0xE0, 0x4C, 0xC8, 0x0B, 0xE0, 0x51, 0xC1, 0xDA, 0x4C, 0xDE, 0x0D, 0x1D, 0x1D, 0x9D, 0x0D, 0x5E, 0x0D, 0x3C, 0x05, 0x5D, 0x15, 
+0x3D, 0x15, 0x5E, 0x0D, 0xFC, 0x04, 0x38, 0x1C, 0xB8, 0x5C, 0xFB, 0xDE, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBD, 0xEF, 0x39, 0xBE, 0x18, 0x24, 0x79, 0x14, 0xBC, 0x0C, 
+0xFB, 0x04, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1B, 0x05, 0xFC, 0x0C, 0x1C, 0x05, 0x1B, 0x15, 0xF8, 0x5B, 0xB6, 0x73, 
+0x37, 0x54, 0x1C, 0x25, 0x1B, 0x25, 0x76, 0x73, 0x2D, 0xB9, 0xAD, 0xC8, 0xD5, 0x8A, 0xDA, 0x44, 0x59, 0x64, 0xAC, 0xD0, 0x4F, 0xC9, 0xD8, 0x5B, 0x3E, 0x15, 0x39, 0x5C, 0x0F, 0xC1, 0x0B, 0xD0, 
+0x4D, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2B, 0xC8, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xC8, 0x2C, 0xC8, 0x2B, 0xD0, 0x2B, 0xD0, 
+0x4C, 0xD0, 0x0B, 0xD8, 0x0C, 0xC8, 0x0E, 0xD0, 0x2C, 0xD0, 0x0B, 0xD0, 0x2C, 0xD0, 0x4D, 0xC8, 0x0B, 0xD0, 0x2D, 0xD0, 0x2C, 0xC8, 0x0C, 0xD0, 0x8E, 0xC8, 0xB7, 0x6B, 0x9D, 0x0D, 0x1E, 0x15, 
+0x7E, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 0x5D, 0x15, 0x3D, 0x15, 0x3D, 0x0D, 0x3C, 0x0D, 0xDB, 0x14, 0x19, 0x1C, 0x39, 0xC6, 0x7D, 0xF7, 0xDF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x3C, 0xDF, 
+0x57, 0x9D, 0xF8, 0x1B, 0x9A, 0x14, 0xDC, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xBC, 0x14, 0xFB, 0x0C, 0xFB, 0x1C, 
+0x9C, 0x0C, 0xDD, 0x0C, 0xDC, 0x14, 0xDB, 0x24, 0x5A, 0x3C, 0x74, 0x6B, 0xB0, 0xB9, 0xAC, 0xD0, 0xEF, 0xC8, 0x17, 0x7B, 0x3C, 0x35, 0xF7, 0x63, 0x6F, 0xB9, 0x50, 0xD1, 0xB8, 0x63, 0x5C, 0x0D, 
+0x99, 0x3C, 0x12, 0xAA, 0x6D, 0xC8, 0x0B, 0xC8, 0x2D, 0xD8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2B, 0xC8, 0x0C, 0xD0, 0x4D, 0xC8, 
+0x4D, 0xC0, 0x0C, 0xD8, 0x0C, 0xD8, 0x2C, 0xC8, 0x0C, 0xC8, 0x2D, 0xD0, 0x4C, 0xC0, 0x2C, 0xC8, 0x0D, 0xD0, 0x2D, 0xC8, 0x0D, 0xD0, 0x2D, 0xC8, 0x0D, 0xD0, 0x2C, 0xD0, 0x0C, 0xC8, 0x0C, 0xD0, 
+0x6D, 0xC8, 0x56, 0x73, 0x9D, 0x0D, 0x5E, 0x0D, 0x7D, 0x0D, 0x5D, 0x0D, 0x5D, 0x0D, 0x3D, 0x0D, 0x1D, 0x0D, 0x3D, 0x0D, 0x5C, 0x0D, 0xDB, 0x14, 0x19, 0x1C, 0x97, 0x9D, 0x1C, 0xE7, 0xDF, 0xF7, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xBF, 0xF7, 0xBA, 0xCE, 0x95, 0x6C, 0xF8, 0x0B, 0xBB, 0x14, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 
+0xFB, 0x0C, 0xDD, 0x1C, 0xFB, 0x0C, 0x1B, 0x05, 0x1B, 0x0D, 0x18, 0x5C, 0x32, 0xAA, 0x2F, 0xC9, 0x8E, 0xC8, 0x4F, 0xD0, 0x2F, 0xB9, 0xD5, 0x92, 0xBB, 0x54, 0xDB, 0x2C, 0xF4, 0x72, 0x2F, 0xC9, 
+0xCE, 0xD0, 0x36, 0x73, 0x9D, 0x05, 0xDB, 0x24, 0x52, 0x9A, 0x2C, 0xD8, 0x4C, 0xC8, 0x0B, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x0C, 0xD0, 0x0C, 0xC8, 0x2D, 0xC8, 0x0D, 0xD8, 0x0C, 0xE0, 0x0C, 0xD8, 0x4D, 0xD0, 0x0D, 0xD8, 0x0D, 0xC8, 0x0B, 0xD8, 0x2A, 0xD0, 0x0B, 0xE0, 0x2C, 0xD0, 0x4B, 0xD0, 0x6C, 0xD0, 
+0x4D, 0xD0, 0x8B, 0xC8, 0x2B, 0xD0, 0x2C, 0xD0, 0x4D, 0xC8, 0xF6, 0x72, 0x5D, 0x0D, 0x5E, 0x0D, 0x3C, 0x0D, 0x5D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x1D, 0x0D, 0x3D, 0x0D, 0x5D, 0x05, 0xFC, 0x0C, 
+0x3A, 0x14, 0xB5, 0x6C, 0xBB, 0xD6, 0xDF, 0xF7, 0xFE, 0xFF, 0xDE, 0xFF, 0xBE, 0xEF, 0x59, 0xBE, 0x15, 0x44, 0x5A, 0x0C, 0xDC, 0x0C, 0xDC, 0x0C, 0xFA, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 
+0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x04, 0xFB, 0x04, 0xFC, 0x0C, 0xFB, 0x14, 0x18, 0x44, 0x32, 0x92, 0x11, 0xAA, 0xD4, 0x8A, 0x38, 0x6C, 0x98, 0x3C, 0x9A, 0x34, 
+0x79, 0x73, 0xB1, 0xA1, 0x6A, 0xD0, 0x4F, 0xC1, 0xF9, 0x5B, 0x1C, 0x15, 0xB9, 0x2C, 0x33, 0x9A, 0x6E, 0xD8, 0x0C, 0xD0, 0x4C, 0xC8, 0x0B, 0xE0, 0x2C, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0D, 0xD8, 0x0C, 0xC8, 0x0C, 0xC8, 0x2C, 0xD0, 0x2C, 0xC8, 0x0B, 0xC0, 0x2C, 0xC8, 0x0C, 0xD0, 0x0C, 0xD0, 0xAE, 0xD0, 0x11, 0xA2, 
+0x13, 0x9A, 0x13, 0x9A, 0xD2, 0xA9, 0xD2, 0xA1, 0xB3, 0xA9, 0xD3, 0xA9, 0x93, 0xA9, 0xF3, 0xA1, 0x13, 0x9A, 0xB9, 0x5B, 0x5E, 0x15, 0x7F, 0x15, 0x7C, 0x0D, 0x3D, 0x0D, 0x3D, 0x05, 0x3D, 0x0D, 
+0x1D, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0xFC, 0x0C, 0x5B, 0x14, 0x35, 0x44, 0x5A, 0xBE, 0xBF, 0xF7, 0xFE, 0xFF, 0xDE, 0xFF, 0x9D, 0xE7, 0xF8, 0xB5, 0xD6, 0x2B, 0xBB, 0x0C, 0xFC, 0x0C, 0xBC, 0x04, 
+0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDC, 0x0C, 0x3B, 0x05, 0xDB, 0x14, 0xDB, 0x0C, 0x1C, 0x0D, 0xDA, 0x1C, 0xFA, 0x34, 
+0x7A, 0x44, 0xF7, 0x53, 0xF4, 0x82, 0x70, 0xB9, 0x6C, 0xD0, 0xED, 0xC0, 0xF3, 0x8A, 0xB9, 0x3C, 0xFD, 0x0C, 0x7A, 0x3C, 0x12, 0xA2, 0x6D, 0xD8, 0x0D, 0xD0, 0x6D, 0xC8, 0x0B, 0xD8, 0x0C, 0xD0, 
+0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2D, 0xC8, 0x0C, 0xD0, 0x2B, 0xD0, 0x4B, 0xC0, 0x2C, 0xC8, 0x0C, 0xD0, 0x0D, 0xD0, 
+0x0C, 0xD0, 0x8D, 0xD0, 0x36, 0x7B, 0x5D, 0x25, 0x9F, 0x1D, 0x9F, 0x15, 0x7E, 0x25, 0x7D, 0x15, 0x9D, 0x0D, 0x7E, 0x1D, 0x3D, 0x1D, 0xBC, 0x0D, 0x1B, 0x1D, 0x5D, 0x15, 0x7E, 0x05, 0xFD, 0x14, 
+0x3B, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0x3D, 0x0D, 0x1D, 0x0D, 0x1D, 0x0D, 0x3D, 0x05, 0x1C, 0x0D, 0x9B, 0x0C, 0x16, 0x2C, 0x19, 0xB6, 0x7E, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9C, 0xDF, 0xB7, 0xB5, 
+0xD6, 0x23, 0xDB, 0x04, 0xDC, 0x0C, 0xBB, 0x04, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDD, 0x14, 0xFC, 0x14, 0x1B, 0x05, 
+0xFA, 0x14, 0xD7, 0x6B, 0x11, 0xAA, 0xB0, 0xB9, 0xCF, 0xC0, 0x6E, 0xD8, 0x6D, 0xC8, 0xCE, 0xD0, 0xF4, 0x92, 0x7A, 0x44, 0xFD, 0x14, 0x1B, 0x0D, 0xF8, 0x5B, 0xF1, 0xA9, 0x4C, 0xD8, 0x0C, 0xD0, 
+0x0D, 0xC8, 0x6C, 0xD0, 0x0B, 0xD0, 0x4D, 0xC0, 0x0D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2D, 0xC8, 0x4C, 0xD8, 0x2B, 0xD0, 
+0x0B, 0xD0, 0x4F, 0xD8, 0xF3, 0xB1, 0xF4, 0x8A, 0xD4, 0x92, 0x97, 0x7B, 0xFD, 0x25, 0xDF, 0x35, 0x9B, 0x5C, 0x79, 0x64, 0x5A, 0x6C, 0x5A, 0x6C, 0x9A, 0x64, 0x9A, 0x5C, 0x39, 0x64, 0x59, 0x6C, 
+0x18, 0x6C, 0xFC, 0x3C, 0x7E, 0x0D, 0xFE, 0x14, 0x5C, 0x15, 0x1D, 0x0D, 0x3D, 0x05, 0x3D, 0x0D, 0x1D, 0x15, 0xFC, 0x0C, 0x1C, 0x05, 0x1C, 0x05, 0xDC, 0x0C, 0xF7, 0x23, 0xD8, 0xB5, 0x3D, 0xEF, 
+0xFF, 0xF7, 0xDF, 0xFF, 0x7C, 0xDF, 0x97, 0xB5, 0xD7, 0x1B, 0xBA, 0x04, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 
+0xFB, 0x0C, 0xDA, 0x04, 0xBC, 0x14, 0xDC, 0x0C, 0xBB, 0x2C, 0x95, 0x92, 0x2D, 0xD0, 0xEE, 0xC0, 0xD2, 0xA1, 0x53, 0x9A, 0x97, 0x6B, 0xDA, 0x2C, 0xBB, 0x0C, 0xBB, 0x04, 0x9B, 0x34, 0xD6, 0x92, 
+0x0F, 0xC9, 0x4C, 0xD8, 0x0C, 0xC8, 0x0D, 0xD0, 0x0C, 0xD8, 0x2B, 0xD0, 0x0B, 0xC8, 0x4D, 0xD0, 0x4D, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x0C, 0xD8, 0x4C, 0xD0, 0x0B, 0xD0, 0x2D, 0xD0, 0xB5, 0x9A, 0x5B, 0x3D, 0x3D, 0x0E, 0x3E, 0x16, 0xDF, 0x1D, 0xBC, 0x25, 0x94, 0xA2, 0xCD, 0xC8, 0x6B, 0xD8, 0x4C, 0xD0, 0x2C, 0xD0, 
+0x4D, 0xD8, 0x8D, 0xC8, 0x6D, 0xD0, 0x4D, 0xE0, 0x8E, 0xD8, 0x36, 0x73, 0x3C, 0x0D, 0x1E, 0x0D, 0x5D, 0x0D, 0x1D, 0x0D, 0x3C, 0x05, 0x3D, 0x0D, 0x1C, 0x15, 0xFC, 0x0C, 0x1C, 0x05, 0x1C, 0x05, 
+0xDB, 0x0C, 0xF7, 0x1B, 0xB7, 0xB5, 0x3C, 0xEF, 0xFF, 0xF7, 0xDF, 0xFF, 0x7C, 0xDF, 0x96, 0xB5, 0xF8, 0x1B, 0xD9, 0x04, 0x1C, 0x15, 0xDC, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x1B, 0x05, 0xDB, 0x0C, 0xFC, 0x0C, 0xFB, 0x24, 0x78, 0x34, 0xFA, 0x34, 0xBA, 0x2C, 0x3B, 0x15, 0xBB, 0x0C, 0xFB, 0x04, 
+0xDA, 0x2C, 0x56, 0x7B, 0x90, 0xB1, 0x6C, 0xC8, 0x2B, 0xC0, 0x0C, 0xD0, 0x2D, 0xD0, 0x2C, 0xD0, 0x8C, 0xC8, 0x0C, 0xC8, 0x2D, 0xD0, 0x0B, 0xD8, 0x2C, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xD0, 0x4C, 0xC0, 0x0C, 0xE0, 0x71, 0xB9, 0x3A, 0x4D, 0x7F, 0x06, 0xDF, 0x0D, 0xFF, 0x05, 0xFF, 0x0D, 0x38, 0x5C, 0x6F, 0xE0, 
+0x2C, 0xC0, 0x0E, 0xD0, 0x0E, 0xD0, 0x0C, 0xC0, 0x2C, 0xD0, 0x0D, 0xD8, 0x6D, 0xC0, 0x4C, 0xC0, 0x2C, 0xC8, 0x15, 0x6B, 0x7C, 0x05, 0x3D, 0x0D, 0x3D, 0x0D, 0x3D, 0x0D, 0x3C, 0x05, 0x3C, 0x05, 
+0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x05, 0xDB, 0x0C, 0xF7, 0x13, 0xD7, 0xB5, 0x3C, 0xF7, 0xFF, 0xEF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0xBB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 
+0xDB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0x9B, 0x1C, 0x90, 0xA9, 0x4D, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0D, 0xD0, 0x2B, 0xC0, 0x4C, 0xD0, 0xF1, 0xC8, 0x1D, 0x26, 0xDF, 0x15, 0xDF, 0x05, 
+0x1E, 0x0E, 0x9F, 0x15, 0xDA, 0x3C, 0x90, 0xC8, 0x2C, 0xD0, 0x0B, 0xD0, 0x0C, 0xC8, 0x6D, 0xC8, 0x2C, 0xC8, 0x0D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 0x6D, 0xC8, 0x15, 0x73, 0x3D, 0x0D, 0x3D, 0x0D, 
+0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 
+0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x04, 0x7B, 0x14, 0x4F, 0xA1, 0x2C, 0xC8, 0x0C, 0xC8, 0x0C, 0xD0, 0x2C, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0D, 0xD8, 0x4B, 0xC8, 0x6C, 0xC8, 
+0xF0, 0xC8, 0x7C, 0x45, 0x3F, 0x0E, 0x9F, 0x15, 0x7F, 0x0D, 0x3E, 0x0E, 0xF8, 0x63, 0x4E, 0xC8, 0x2C, 0xD0, 0x0C, 0xD0, 0x2D, 0xD0, 0x0C, 0xD8, 0x0B, 0xD8, 0x0D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 
+0x6D, 0xC8, 0x15, 0x73, 0x3D, 0x0D, 0x3D, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x04, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 
+0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x7B, 0x14, 0x2F, 0xA1, 0x0C, 0xD0, 0x0C, 0xC8, 0x0D, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2D, 0xC8, 0x0C, 0xD0, 0x0B, 0xD8, 0x8E, 0xC8, 0x36, 0x9B, 0x9C, 0x35, 0x3F, 0x0E, 0xDF, 0x0D, 0xDA, 0x54, 0xD3, 0xB1, 0x0D, 0xD0, 0x0B, 0xD0, 0x2C, 0xD0, 0x4D, 0xC8, 0x0C, 0xD0, 
+0x0C, 0xD0, 0x0D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 0x6D, 0xC8, 0xF5, 0x72, 0x3D, 0x0D, 0x3C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0x1C, 0x0D, 0xFC, 0x0C, 
+0xDB, 0x04, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x7B, 0x1C, 
+0x4F, 0xA1, 0x0C, 0xD0, 0x2C, 0xD0, 0x0D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0D, 0xD0, 0x2D, 0xD8, 0x0C, 0xD0, 0x2B, 0xC8, 0x8D, 0xD8, 0x31, 0x9A, 0x75, 0x63, 0xF6, 0x82, 0xB2, 0xB9, 0x0E, 0xD8, 0x2C, 0xC8, 
+0x0C, 0xD8, 0x0C, 0xD0, 0x4D, 0xC8, 0x2C, 0xC8, 0x2C, 0xD8, 0x0D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 0x4D, 0xC8, 0xF5, 0x72, 0x3C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x7B, 0x1C, 0x2F, 0xA1, 0x0C, 0xD0, 0x2C, 0xD0, 0x0D, 0xD0, 0x2C, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xD8, 0x4D, 0xC8, 0x4D, 0xC8, 0x2C, 0xD0, 0x0B, 0xD8, 0x0B, 0xD8, 0x4C, 0xC8, 
+0x2D, 0xD0, 0x0D, 0xE0, 0x0B, 0xD0, 0x6C, 0xC0, 0x0C, 0xD8, 0x0C, 0xD0, 0x0D, 0xD8, 0x0C, 0xD0, 0x0C, 0xD8, 0x0D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 0x4D, 0xC8, 0xF5, 0x72, 0x1C, 0x0D, 0x1C, 0x0D, 
+0xFC, 0x0C, 0xFC, 0x0C, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x7B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xD0, 0x2D, 0xD0, 0x0B, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x4B, 0xC0, 0x0C, 0xD0, 0x2D, 0xC8, 
+0x0D, 0xD8, 0x2D, 0xD0, 0x0D, 0xD0, 0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0B, 0xC8, 0x6C, 0xC8, 0x0B, 0xD8, 0x2C, 0xC8, 0x0D, 0xD8, 0x0C, 0xC8, 0x2C, 0xC8, 0x0D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 
+0x4D, 0xC8, 0xF5, 0x72, 0x1C, 0x0D, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 
+0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0x7B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xD0, 0x2D, 0xD0, 
+0x2C, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x4D, 0xC8, 0x0C, 0xE8, 0x2C, 0xD0, 0x0C, 0xC8, 0x2E, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0C, 0xD8, 0x4C, 0xD0, 0x2C, 0xD0, 0x4C, 0xD0, 0x0C, 0xD0, 0x4D, 0xD0, 0x2C, 0xD0, 0x2C, 0xC8, 
+0x4B, 0xB8, 0x2D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 0x4D, 0xC8, 0xF5, 0x72, 0xFC, 0x0C, 0x1C, 0x0D, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xDB, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 
+0x2F, 0xA1, 0x0C, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 0x2C, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0D, 0xC8, 0x4C, 0xC8, 0x2B, 0xD0, 0x2B, 0xC8, 0x4C, 0xD0, 0x0D, 0xD8, 0x2C, 0xD0, 0x4B, 0xC8, 0x0C, 0xD0, 0x0C, 0xD8, 0x4C, 0xC8, 
+0x0C, 0xD0, 0x2D, 0xD8, 0x0C, 0xD0, 0x0C, 0xD8, 0x2C, 0xD0, 0x2D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 0x4D, 0xC8, 0xF4, 0x72, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xF7, 0x1B, 0x97, 0xAD, 0x5C, 0xE7, 0xDF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 0x4D, 0xC8, 0xF4, 0x72, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 0x20, 0x80, 0x2C, 0xD0, 0x32, 0x00, 0x0D, 0xD0, 
+0x2B, 0xD0, 0x2D, 0xD0, 0x4D, 0xC8, 0xF4, 0x72, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 
+0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x3D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 
+0x2C, 0xC8, 0x2D, 0xD0, 0x20, 0x80, 0x2C, 0xD0, 0xEF, 0x0E, 0x0D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 0x4D, 0xC8, 0xF4, 0x72, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xFB, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x2D, 0xD0, 0x2B, 0xD0, 0x2D, 0xD0, 0x4D, 0xC8, 0xF4, 0x72, 0xFC, 0x0C, 0xFC, 0x0C, 
+0xDB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x2D, 0xD0, 0x2B, 0xC8, 0x2D, 0xD0, 
+0x4D, 0xC8, 0xF4, 0x72, 0xFC, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFC, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 
+0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xC8, 
+0x0C, 0xC8, 0x2D, 0xD0, 0x2B, 0xC8, 0x2D, 0xD0, 0x4D, 0xC8, 0xF4, 0x72, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 
+0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2D, 0xD0, 0x2B, 0xC8, 0x2D, 0xD0, 0x4D, 0xC8, 0xD4, 0x72, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDF, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xD6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x4C, 0xD0, 0x4C, 0xD0, 0x6D, 0xD0, 0x6D, 0xD0, 0x2D, 0xD0, 0x2B, 0xC8, 0x2D, 0xD0, 0x4D, 0xC8, 0xD4, 0x72, 0xFB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0xB6, 0xAD, 0x7C, 0xE7, 0xBF, 0xFF, 0xDE, 0xF7, 0x5D, 0xEF, 0x96, 0xAD, 
+0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x14, 0xDB, 0x0C, 0xBA, 0x04, 
+0xBB, 0x14, 0xBB, 0x1C, 0xBB, 0x0C, 0xFB, 0x0C, 0x9B, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x0D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x4D, 0xC8, 0x0D, 0xD8, 0x4B, 0xC0, 0x2B, 0xD8, 0x4F, 0xC1, 0x35, 0x73, 0x57, 0x63, 0x16, 0x73, 0x70, 0xB1, 0x2B, 0xD0, 0x0B, 0xC8, 
+0x8D, 0xC0, 0xF5, 0x6A, 0xBB, 0x0C, 0xDB, 0x04, 0xBC, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x04, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xDE, 0xF7, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0x1C, 0x05, 0xDB, 0x04, 0xDB, 0x04, 0xDB, 0x0C, 0xBB, 0x0C, 0xFC, 0x0C, 0xDC, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x0D, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xC8, 0x0B, 0xD0, 0x4C, 0xD0, 0x31, 0xC1, 0xF7, 0x43, 0xFA, 0x0C, 0x1B, 0x05, 
+0xBB, 0x1C, 0xD8, 0x53, 0x51, 0xB9, 0x2D, 0xD8, 0x0D, 0xC8, 0xB5, 0x6A, 0xBB, 0x14, 0xDA, 0x0C, 0xBA, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x04, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xF7, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9B, 0x14, 0xBB, 0x14, 0x9B, 0x0C, 0xDB, 0x04, 0xBB, 0x0C, 0x9B, 0x14, 0x1B, 0x05, 0xDB, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0x5B, 0x1C, 
+0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x0D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2D, 0xD0, 0x2B, 0xD8, 0x2C, 0xD0, 
+0x95, 0x8A, 0xFB, 0x1C, 0xDB, 0x04, 0x1A, 0x05, 0xDB, 0x14, 0xBA, 0x1C, 0xD7, 0x3B, 0xB8, 0x33, 0x97, 0x33, 0x5A, 0x2C, 0xBC, 0x14, 0xFA, 0x04, 0xDB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0x1A, 0x05, 0xBA, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0x9A, 0x14, 0xDA, 0x04, 
+0xBA, 0x14, 0xDB, 0x0C, 0xBA, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x0D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x0D, 0xD8, 0x0C, 0xE0, 0x4C, 0xD0, 0x35, 0x6B, 0x1B, 0x15, 0x9B, 0x0C, 0xBB, 0x0C, 0xD9, 0x04, 0xFA, 0x04, 0xB9, 0x14, 0xFC, 0x14, 0xBB, 0x1C, 0xDC, 0x24, 0xBC, 0x14, 0xFA, 0x04, 
+0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 
+0xB6, 0x1B, 0x9B, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x7B, 0x14, 0xDB, 0x04, 0xDB, 0x0C, 
+0xBB, 0x0C, 0x9B, 0x14, 0xBB, 0x0C, 0xFB, 0x04, 0xBB, 0x14, 0xBB, 0x0C, 0xBA, 0x0C, 0x5B, 0x1C, 0x2F, 0xA1, 0x2C, 0xD0, 0x2C, 0xC8, 0x0D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0xF2, 0xB1, 0xBA, 0x34, 0x9D, 0x1C, 0xBE, 0x1C, 0xDC, 0x0C, 0x1C, 0x25, 0x94, 0x92, 0xF0, 0xA9, 
+0xD0, 0xA9, 0x96, 0x5B, 0xDC, 0x04, 0xBA, 0x0C, 0xDB, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x04, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x04, 0xDB, 0x04, 0x9B, 0x04, 0x9B, 0x0C, 0xDC, 0x04, 0xDC, 0x04, 0xBC, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0x3A, 0x1C, 0x2F, 0xA9, 0x2C, 0xD0, 0x2C, 0xC8, 0x0D, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xC8, 0x2D, 0xD0, 0x0C, 0xC8, 0xAE, 0xD0, 0xD3, 0x7A, 0x18, 0x3C, 0x9A, 0x2C, 
+0x78, 0x34, 0xB6, 0x92, 0xAE, 0xD0, 0x0B, 0xD8, 0x2C, 0xD8, 0xF4, 0x72, 0xDB, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xFB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0x9B, 0x0C, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xDA, 0x0C, 0x99, 0x14, 0xDA, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0x5B, 0x1C, 0xDB, 0x04, 0xBB, 0x0C, 0xBA, 0x0C, 0x3A, 0x1C, 
+0x2F, 0xA9, 0x2C, 0xD0, 0x2C, 0xC8, 0x0D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x4D, 0xC8, 0x2D, 0xD0, 0x0C, 0xC8, 
+0x0B, 0xD8, 0x6D, 0xD0, 0x8F, 0xA9, 0xF0, 0xA1, 0xD0, 0xB1, 0x4D, 0xC8, 0x2B, 0xC8, 0x0D, 0xD0, 0x2F, 0xD0, 0xD5, 0x6A, 0x9B, 0x14, 0xFB, 0x04, 0x9C, 0x14, 0xDB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 
+0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0x5A, 0x0C, 0x39, 0x04, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xAD, 0xB6, 0x1B, 0x9A, 0x0C, 0xDB, 0x0C, 0xBA, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x37, 0x44, 0x97, 0x9A, 0x18, 0x54, 0xD9, 0x24, 0x3A, 0x54, 0xBA, 0x34, 0xD9, 0x0C, 
+0xB9, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0x3A, 0x1C, 0x2F, 0xA9, 0x2C, 0xD0, 0x2C, 0xC8, 0x0D, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x0C, 0xD0, 0x0B, 0xD8, 0x4C, 0xC8, 0x0D, 0xD0, 0x4D, 0xC0, 0x0C, 0xD8, 0x0B, 0xD0, 0x0E, 0xD0, 0x0C, 0xD0, 0x2B, 0xD0, 0x4C, 0xD0, 0x4D, 0xC8, 0xF4, 0x62, 0xBA, 0x14, 0xFA, 0x0C, 
+0xDB, 0x04, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0x9B, 0x0C, 0x5A, 0x0C, 0xF9, 0x03, 0xB8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xEF, 0x96, 0xA5, 
+0xB6, 0x1B, 0x9A, 0x14, 0xDB, 0x0C, 0xBA, 0x0C, 0xBA, 0x04, 0xBB, 0x14, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x56, 0x83, 0x8C, 0xC0, 0xD6, 0x83, 
+0x38, 0x3C, 0x92, 0xD1, 0x73, 0x7A, 0xFA, 0x1C, 0x54, 0x6B, 0x57, 0x83, 0xFB, 0x04, 0x99, 0x24, 0x0F, 0xA9, 0x0C, 0xC8, 0x2D, 0xC8, 0x4C, 0xC8, 0x0C, 0xD8, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 
+0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2D, 0xC8, 0x4D, 0xD0, 0x2C, 0xD0, 
+0x2D, 0xC0, 0xB5, 0x7A, 0x19, 0x05, 0xDB, 0x0C, 0xBB, 0x04, 0xDB, 0x04, 0xDC, 0x0C, 0xBB, 0x0C, 0x7A, 0x0C, 0x19, 0x0C, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0xB6, 0x1B, 0x7A, 0x14, 0x9A, 0x0C, 0xBA, 0x0C, 0xDB, 0x0C, 0x9A, 0x04, 0x9A, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xB7, 0x5B, 0x2C, 0xD0, 0xF5, 0x92, 0x79, 0x3C, 0x30, 0xC9, 0x52, 0x92, 0xBA, 0x1C, 0xF4, 0xB9, 0xCC, 0xC8, 0x99, 0x44, 0x59, 0x0C, 0x72, 0xA9, 0x2C, 0xD0, 0x4C, 0xC8, 0x0B, 0xC8, 
+0x0C, 0xD0, 0x2D, 0xC8, 0x2D, 0xC8, 0x2D, 0xC8, 0x2D, 0xC8, 0x2D, 0xC8, 0x2D, 0xC8, 0x2D, 0xC8, 0x2D, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 
+0x2C, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 
+0x0D, 0xD0, 0x0D, 0xC8, 0x0B, 0xD0, 0x2A, 0xD0, 0x6D, 0xC8, 0xF6, 0x72, 0xBA, 0x0C, 0xDC, 0x0C, 0xDB, 0x14, 0xBB, 0x0C, 0x9B, 0x0C, 0x5A, 0x0C, 0x19, 0x04, 0xD9, 0x03, 0xD9, 0x03, 0xD9, 0x0B, 
+0xD9, 0x0B, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0xB7, 0xAD, 0xB5, 0x1B, 0x39, 0x0C, 0x59, 0x0C, 0x79, 0x0C, 0xBB, 0x14, 0xBB, 0x04, 0xBB, 0x04, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x14, 0xF8, 0x43, 0x8E, 0xD8, 0x52, 0x9A, 0x99, 0x1C, 0xF0, 0xA9, 0xD0, 0xB9, 0x79, 0x14, 0xD5, 0x92, 0x6C, 0xD0, 0x77, 0x6B, 0xDA, 0x14, 
+0xF6, 0x9A, 0x2B, 0xC8, 0x2C, 0xC8, 0x2E, 0xD8, 0x2D, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x4F, 0xD8, 0x4B, 0xD0, 0x4A, 0xC8, 0xEE, 0xB8, 0x97, 0x53, 0x9C, 0x14, 0xDC, 0x04, 0xDB, 0x0C, 0x5A, 0x0C, 0x19, 0x0C, 0xD9, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xB8, 0x0B, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0xB7, 0xAD, 0x95, 0x1B, 0xF8, 0x0B, 0xF8, 0x03, 0x18, 0x0C, 
+0x3A, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBB, 0x0C, 0xDB, 0x0C, 0xB9, 0x24, 0xF1, 0xC0, 0x4F, 0xC1, 0x39, 0x34, 0xD4, 0x82, 0xCC, 0xD0, 0xF7, 0x43, 
+0xF8, 0x53, 0x6E, 0xD0, 0x13, 0xA2, 0x3A, 0x1D, 0xD7, 0x4B, 0xEF, 0xC0, 0x4C, 0xC8, 0x0C, 0xC8, 0x0B, 0xD8, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 0x0C, 0xD0, 
+0x0C, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xD0, 0x0C, 0xC8, 0x0C, 0xC8, 0x0C, 0xC8, 0x0C, 0xC8, 0x0C, 0xC8, 0x0C, 0xC8, 0x0C, 0xC8, 
+0x0C, 0xC8, 0x0C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x0C, 0xC8, 0x0C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x0B, 0xD0, 0x2B, 0xC0, 0x4D, 0xD8, 0x33, 0x9A, 0x1A, 0x1D, 0x1C, 0x05, 0x3A, 0x0C, 
+0x18, 0x04, 0xF9, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0xD9, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x5D, 0xE7, 0xB7, 0xAD, 
+0x95, 0x1B, 0xD8, 0x0B, 0xD7, 0x03, 0xD7, 0x03, 0xD8, 0x03, 0x39, 0x0C, 0x59, 0x0C, 0x7A, 0x0C, 0x9A, 0x0C, 0xBB, 0x0C, 0xBA, 0x0C, 0xBA, 0x04, 0xBA, 0x04, 0xFA, 0x14, 0xD2, 0x91, 0x8C, 0xD0, 
+0xB7, 0x63, 0xB8, 0x53, 0xAC, 0xC8, 0x14, 0x8B, 0x9A, 0x2C, 0x10, 0x9A, 0x8E, 0xD0, 0xB6, 0x63, 0xDA, 0x0C, 0x16, 0x73, 0x30, 0xB9, 0x4D, 0xD8, 0x4A, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 
+0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xC8, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 
+0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2B, 0xD0, 0x2B, 0xD0, 0x2B, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2C, 0xD0, 0x2B, 0xD0, 0x8F, 0xD8, 0xF4, 0xA1, 
+0x58, 0x24, 0x9A, 0x0C, 0x19, 0x0C, 0xF8, 0x03, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD9, 0x0B, 0xD9, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 
+0xBF, 0xFF, 0xFE, 0xFF, 0x5D, 0xE7, 0x97, 0xAD, 0xB6, 0x23, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0x19, 0x0C, 0x39, 0x0C, 0x7A, 0x0C, 0x9A, 0x0C, 0xBA, 0x0C, 
+0xBA, 0x0C, 0x99, 0x14, 0xB8, 0x6B, 0x6B, 0xD0, 0x73, 0x92, 0xBA, 0x2C, 0xB0, 0xA9, 0x0F, 0xC9, 0x79, 0x34, 0xF8, 0x5B, 0xEF, 0xC0, 0x70, 0xB1, 0x58, 0x3C, 0xFB, 0x0C, 0x1A, 0x34, 0x18, 0x93, 
+0x91, 0x99, 0x30, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 
+0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x2F, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x10, 0xA1, 0x10, 0xA1, 
+0x10, 0xA1, 0x52, 0xA2, 0xB6, 0x53, 0xF9, 0x2B, 0x3A, 0x04, 0x98, 0x13, 0xB7, 0x0B, 0xD7, 0x03, 0xB8, 0x13, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 
+0xF9, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xFE, 0xFF, 0x3C, 0xE7, 0x97, 0xAD, 0xB6, 0x23, 0xB8, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 0x98, 0x03, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 
+0xD8, 0x03, 0xF8, 0x03, 0x19, 0x0C, 0x59, 0x0C, 0x7A, 0x0C, 0x99, 0x04, 0xDB, 0x34, 0x30, 0xC1, 0xCF, 0xC8, 0x79, 0x4C, 0x76, 0x73, 0x4E, 0xE0, 0x33, 0xA2, 0x9B, 0x1C, 0x17, 0x7B, 0x8E, 0xD8, 
+0x6F, 0xA1, 0xF8, 0x4B, 0xDC, 0x14, 0xBB, 0x0C, 0x9A, 0x0C, 0x9B, 0x0C, 0x9B, 0x0C, 0x9B, 0x0C, 0x9B, 0x0C, 0x9B, 0x0C, 0x9B, 0x0C, 0x9B, 0x0C, 0x9B, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 
+0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0xDA, 0x0C, 0xDB, 0x0C, 0xDB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 0x7A, 0x0C, 0x5A, 0x0C, 0x16, 0x0C, 0x17, 0x04, 0xB8, 0x03, 0xF9, 0x03, 0xB8, 0x03, 0xD8, 0x0B, 0xB8, 0x0B, 0x78, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 
+0xD8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xFF, 0xFF, 0x3C, 0xE7, 0x97, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xD8, 0x0B, 
+0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0x3A, 0x14, 0x58, 0x04, 0xF4, 0x7A, 0x6D, 0xD8, 0xB5, 0x8A, 0xD9, 0x34, 0x32, 0xAA, 
+0x8C, 0xD0, 0x55, 0x7B, 0xB9, 0x24, 0xB5, 0x8A, 0x8C, 0xC8, 0x6F, 0xC9, 0x74, 0x73, 0x78, 0x1C, 0x9C, 0x14, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x39, 0x0C, 0x19, 0x0C, 0xF8, 0x03, 0xD8, 0x03, 0xBA, 0x0B, 0xD9, 0x03, 0xD8, 0x03, 0x98, 0x1B, 0x97, 0x03, 0xD8, 0x0B, 0xF8, 0x03, 
+0xB9, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xD6, 0x1B, 0x96, 0xAD, 0x5C, 0xE7, 0xBF, 0xFF, 0xDE, 0xFF, 0x3D, 0xE7, 0x96, 0xAD, 
+0xB6, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xBA, 0x0B, 0xB7, 0x2B, 
+0x90, 0xB9, 0x8E, 0xD0, 0xB6, 0x4B, 0x37, 0x34, 0x71, 0xB9, 0xAE, 0xE8, 0x56, 0x7B, 0xB9, 0x2C, 0x56, 0x6B, 0x0F, 0xB1, 0x8F, 0xD8, 0x51, 0xC1, 0x14, 0x6B, 0x39, 0x34, 0xDA, 0x0C, 0xBA, 0x0C, 
+0x9A, 0x14, 0xBA, 0x0C, 0xBB, 0x0C, 0xBB, 0x04, 0x9A, 0x14, 0xBA, 0x04, 0xBA, 0x04, 0xBB, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 
+0xBB, 0x0C, 0x9A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x5A, 0x0C, 0x39, 0x0C, 0x39, 0x0C, 0xF9, 0x0B, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0xB7, 0xAD, 0x5C, 0xEF, 
+0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0x96, 0x03, 0xD8, 0x03, 0xB7, 0x03, 0xF3, 0x5A, 0xCF, 0xD0, 0x91, 0xB1, 0xB5, 0x3B, 0x98, 0x63, 0x8E, 0xB1, 0x0F, 0xC1, 0xB3, 0x82, 0x78, 0x3C, 0x18, 0x44, 0xB3, 0x82, 0x0E, 0xB1, 
+0xEF, 0xD0, 0x73, 0x92, 0x57, 0x14, 0xBB, 0x04, 0x7B, 0x0C, 0xBA, 0x04, 0xBA, 0x0C, 0xBA, 0x0C, 0xBA, 0x04, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0xBB, 0x0C, 0x9A, 0x0C, 0x9A, 0x0C, 
+0x9A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x7A, 0x0C, 0x5A, 0x0C, 0x39, 0x0C, 0x19, 0x0C, 0xF9, 0x03, 0xF8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 
+0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB5, 0x1B, 0x97, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x96, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xD6, 0x13, 0x53, 0x82, 0xAE, 0xD8, 0x90, 0x91, 0xF7, 0x3B, 0x97, 0x43, 0xF1, 0xA1, 0x8C, 0xC8, 
+0xB0, 0xB1, 0x16, 0x6B, 0x17, 0x2C, 0x36, 0x2C, 0xF4, 0x5A, 0x77, 0x43, 0x59, 0x0C, 0x7B, 0x04, 0x7A, 0x0C, 0x9A, 0x04, 0x9B, 0x0C, 0x7A, 0x0C, 0x79, 0x14, 0x59, 0x0C, 0x59, 0x0C, 0x59, 0x0C, 
+0x39, 0x0C, 0x39, 0x0C, 0x19, 0x04, 0x19, 0x04, 0x19, 0x04, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xD8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0x97, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 0x95, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 
+0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x98, 0x03, 0xB8, 0x1B, 0x97, 0x0B, 0xB9, 0x03, 0xB7, 0x23, 0x11, 0x82, 0x4E, 0xD8, 
+0x8F, 0xA1, 0xB7, 0x43, 0xB7, 0x33, 0x35, 0x8A, 0x4E, 0xC8, 0x6C, 0xD0, 0x11, 0xB2, 0x35, 0x5B, 0xD9, 0x33, 0xD8, 0x03, 0xD8, 0x03, 0x78, 0x13, 0x77, 0x13, 0xB7, 0x03, 0x98, 0x0B, 0xD8, 0x03, 
+0xF7, 0x03, 0xD8, 0x03, 0xD7, 0x03, 0xD7, 0x03, 0xD7, 0x03, 0xD7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 
+0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0xB7, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0x96, 0xAD, 
+0x95, 0x23, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x78, 0x0B, 0xB7, 0x03, 0x97, 0x0B, 
+0x78, 0x0B, 0xF9, 0x03, 0x95, 0x2B, 0x11, 0x8A, 0x6D, 0xE0, 0xEE, 0xC0, 0x55, 0x53, 0xF8, 0x2B, 0x57, 0x63, 0x11, 0xA2, 0xAD, 0xC0, 0xCE, 0xD0, 0xAF, 0xC8, 0x31, 0x92, 0xB5, 0x23, 0xF8, 0x03, 
+0xB8, 0x03, 0xF7, 0x03, 0xD7, 0x0B, 0xB8, 0x0B, 0xD8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB5, 0x1B, 0xB7, 0xAD, 0x5C, 0xEF, 
+0xDE, 0xF7, 0xDE, 0xFF, 0x5D, 0xE7, 0xB6, 0xAD, 0xB6, 0x23, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0x97, 0x13, 0xD7, 0x03, 0xD7, 0x03, 0x97, 0x03, 0x96, 0x0B, 0xD6, 0x03, 0xD6, 0x23, 0x75, 0x7A, 0xEF, 0xD0, 0x8D, 0xD0, 0x10, 0xA2, 0x94, 0x3B, 0xF7, 0x23, 0x35, 0x53, 0x31, 0x72, 
+0x90, 0xA1, 0x32, 0xC9, 0x15, 0x43, 0xB7, 0x03, 0x97, 0x0B, 0xB7, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 
+0xB7, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB5, 0x23, 0xB7, 0xAD, 0x5C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x7D, 0xEF, 0xB7, 0xAD, 0xB6, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB6, 0x03, 0xD7, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x96, 0x03, 0xF8, 0x0B, 0x19, 0x0C, 0x34, 0x4B, 0xB1, 0xA1, 0xAE, 0xC8, 
+0xAF, 0xC0, 0xD2, 0xA1, 0xF3, 0x5A, 0xF7, 0x3B, 0xB8, 0x33, 0x77, 0x33, 0x18, 0x04, 0xF7, 0x03, 0xB6, 0x03, 0x77, 0x0B, 0x99, 0x0B, 0xD8, 0x03, 0xB6, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xD6, 0x23, 0xD7, 0xAD, 0x7C, 0xEF, 0xDE, 0xF7, 0xDE, 0xFF, 0x7D, 0xEF, 0xD7, 0xB5, 0xD6, 0x23, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x0B, 
+0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x78, 0x0B, 0x97, 0x03, 0xB7, 0x0B, 0x79, 0x0B, 0xBA, 0x0B, 0x97, 0x03, 0x96, 0x0B, 
+0x97, 0x0B, 0x97, 0x0B, 0x97, 0x23, 0x35, 0x6B, 0x8F, 0xB9, 0xCD, 0xD0, 0x8D, 0xC8, 0xCF, 0xC8, 0xF0, 0xA1, 0xB3, 0x8A, 0x96, 0x33, 0x98, 0x13, 0x78, 0x0B, 0xD7, 0x03, 0x97, 0x0B, 0x77, 0x13, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 
+0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0xF6, 0x2B, 0xD8, 0xB5, 0x9D, 0xEF, 0xFF, 0xF7, 0xFF, 0xF7, 0x9E, 0xF7, 0x59, 0xBE, 
+0x14, 0x3C, 0x77, 0x03, 0xB8, 0x13, 0xD6, 0x13, 0x99, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x76, 0x0B, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x08, 0x20, 0x00, 0x00, 0x00, 0x84, 0x40, 0xAC, 0xB0, 0xF4, 0x7A, 0x9A, 0x03, 
+0xF7, 0x0B, 0xD7, 0x03, 0x99, 0x03, 0x78, 0x13, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x20, 0x00, 0x21, 0x00, 0x00, 0x00, 0x69, 0x01, 0xD9, 0x0B, 0xC6, 0x00, 0x01, 0x00, 0x01, 0x00, 
+0x00, 0x00, 0x4E, 0x02, 0x96, 0x0B, 0xB4, 0x23, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x98, 0x03, 0xD7, 0x0B, 0xB7, 0x13, 0xB6, 0x03, 0xD9, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0x97, 0x03, 0xD8, 0x0B, 0xB8, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xF3, 0x53, 0x7C, 0xB6, 0x9E, 0xEF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0xDA, 0xD6, 0x95, 0x64, 0x97, 0x0B, 0x97, 0x03, 0x96, 0x13, 0xD9, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xD7, 0x0B, 0xC4, 0x18, 0x9A, 0xD6, 0xDE, 0xF7, 0x5D, 0xEF, 0xF7, 0xBD, 0x2D, 0x5B, 
+0x02, 0x18, 0x00, 0x00, 0xB1, 0x0A, 0xD7, 0x0B, 0xB8, 0x03, 0xB7, 0x0B, 0x79, 0x0B, 0x57, 0x0B, 0x60, 0x00, 0x49, 0x4A, 0x9D, 0xF7, 0xE7, 0x31, 0x30, 0x84, 0xBD, 0xF7, 0x34, 0xAD, 0x42, 0x00, 
+0xEC, 0x09, 0xA3, 0x00, 0x64, 0x31, 0xBE, 0xF7, 0xCE, 0x7B, 0x01, 0x00, 0x36, 0x03, 0x22, 0x00, 0x04, 0x21, 0x5D, 0xEF, 0x1B, 0xDF, 0xE3, 0x18, 0xB8, 0x03, 0xD7, 0x0B, 0xB8, 0x13, 0xB7, 0x03, 
+0xD8, 0x03, 0xD8, 0x0B, 0xD8, 0x0B, 0xD8, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0xB7, 0x03, 
+0xB6, 0x0B, 0x95, 0x6C, 0xDC, 0xC6, 0xBE, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x3C, 0xEF, 0x57, 0x95, 0xB5, 0x13, 0x77, 0x03, 0x77, 0x0B, 0xD7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x76, 0x03, 0x86, 0x31, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0x5A, 0xCE, 0x66, 0x21, 0x40, 0x00, 0x6E, 0x02, 0xD7, 0x13, 0xD6, 0x13, 0xB9, 0x03, 0x42, 0x00, 0x00, 0x00, 0x5C, 0xF7, 0x5D, 0xE7, 0xE7, 0x39, 
+0x17, 0xC6, 0xFF, 0xFF, 0x7D, 0xEF, 0xC2, 0x10, 0x20, 0x08, 0x00, 0x00, 0xB9, 0xE6, 0xFF, 0xFF, 0x18, 0xBE, 0x80, 0x10, 0x14, 0x03, 0x00, 0x00, 0x10, 0x74, 0xBF, 0xFF, 0xFE, 0xFF, 0x65, 0x29, 
+0x97, 0x0B, 0x76, 0x03, 0xB8, 0x0B, 0xF8, 0x0B, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xD7, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 
+0xF7, 0x13, 0xB7, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0xB5, 0x1B, 0x77, 0x9D, 0x3D, 0xDF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xF7, 0x3A, 0xBE, 0xB4, 0x33, 0x97, 0x03, 0xB8, 0x03, 
+0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0xB7, 0x0B, 0xB7, 0x0B, 0xA5, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x84, 0xF2, 0x94, 0xFF, 0xF7, 0xDF, 0xFF, 0xDB, 0xE6, 0x25, 0x19, 0x21, 0x00, 0x78, 0x0B, 0xB9, 0x0B, 0x6E, 0x02, 0x21, 0x00, 
+0xEB, 0x62, 0xFF, 0xFF, 0xF8, 0xB5, 0x00, 0x00, 0x4D, 0x63, 0xDF, 0xFF, 0x7E, 0xE7, 0x49, 0x4A, 0x00, 0x08, 0x28, 0x42, 0xBE, 0xF7, 0xFF, 0xFF, 0x79, 0xCE, 0x65, 0x21, 0x89, 0x01, 0x41, 0x00, 
+0x59, 0xC6, 0xFF, 0xFF, 0x74, 0xB5, 0x62, 0x00, 0x96, 0x0B, 0xD8, 0x0B, 0xB8, 0x03, 0xB7, 0x03, 0x97, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB6, 0x0B, 0xD8, 0x03, 0xD8, 0x03, 0x96, 0x0B, 0x97, 0x03, 0xFA, 0x03, 0x97, 0x03, 0x93, 0x2B, 0x39, 0xC6, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x9D, 0xF7, 
+0xFB, 0xD6, 0x75, 0x6C, 0x76, 0x0B, 0xF9, 0x03, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB8, 0x0B, 0xA5, 0x29, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x2B, 0xD0, 0x12, 0x34, 0x4C, 0xBD, 0xF7, 0xFE, 0xFF, 0x34, 0xAD, 0x62, 0x00, 
+0xD6, 0x0B, 0xB7, 0x03, 0x49, 0x01, 0x00, 0x00, 0xBA, 0xDE, 0x9E, 0xEF, 0x4C, 0x6B, 0x00, 0x00, 0x82, 0x08, 0xFF, 0xFF, 0xDF, 0xF7, 0x4D, 0x63, 0x20, 0x00, 0x32, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x3B, 0xEF, 0xE7, 0x39, 0x00, 0x08, 0x01, 0x00, 0x9D, 0xFF, 0xFF, 0xFF, 0x6C, 0x6B, 0x23, 0x00, 0x96, 0x0B, 0xD8, 0x0B, 0xB9, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x96, 0x0B, 0xB8, 0x03, 0xD9, 0x03, 0x77, 0x03, 0xB8, 0x0B, 0xFA, 0x0B, 0x55, 0x13, 0x96, 0x5C, 0xDA, 0xDE, 0xBE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xDF, 0xF7, 0x7D, 0xE7, 0xB8, 0xA5, 0x73, 0x23, 0xD7, 0x03, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x76, 0x03, 0xE7, 0x39, 0xFF, 0xFF, 0xDE, 0xFF, 0xD7, 0x0B, 0x1C, 0x0C, 0xB3, 0x02, 
+0x4E, 0x7C, 0xFE, 0xFF, 0xBE, 0xF7, 0x00, 0x00, 0x96, 0x13, 0x30, 0x02, 0x00, 0x08, 0x6D, 0x63, 0xFE, 0xFF, 0xFB, 0xDE, 0x20, 0x10, 0x21, 0x00, 0x00, 0x00, 0x9A, 0xCE, 0xDE, 0xFF, 0x0F, 0x8C, 
+0x01, 0x00, 0xFB, 0xDE, 0xFF, 0xF7, 0xDE, 0xFF, 0xBE, 0xEF, 0x89, 0x52, 0x00, 0x00, 0xCA, 0x5A, 0xFF, 0xFF, 0xFB, 0xDE, 0xC6, 0x31, 0x6E, 0x1A, 0xF8, 0x13, 0x97, 0x03, 0xB8, 0x0B, 0xB7, 0x03, 
+0x77, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB8, 0x03, 0xD9, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0x97, 0x0B, 0x94, 0x33, 
+0xB8, 0x9D, 0x5C, 0xEF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xBA, 0xD6, 0x75, 0x64, 0x96, 0x13, 0x76, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x96, 0x0B, 0xA5, 0x31, 0xDF, 0xFF, 
+0xFE, 0xFF, 0xD5, 0x23, 0xB3, 0x0A, 0xF3, 0x22, 0xD1, 0x8C, 0xBF, 0xFF, 0x7E, 0xF7, 0x40, 0x00, 0xD9, 0x03, 0xAC, 0x01, 0x60, 0x08, 0x5C, 0xD7, 0xBF, 0xFF, 0xEB, 0x5A, 0x00, 0x00, 0xF2, 0x12, 
+0xC3, 0x10, 0xCF, 0x73, 0xBD, 0xFF, 0xD2, 0xA4, 0x29, 0x3A, 0x7E, 0xEF, 0xDF, 0xF7, 0x79, 0xD6, 0xFF, 0xF7, 0x8D, 0x73, 0x42, 0x00, 0xB5, 0xAD, 0xFF, 0xEF, 0xB6, 0xB5, 0x41, 0x00, 0xF2, 0x12, 
+0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xD7, 0x0B, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 
+0x97, 0x03, 0x97, 0x0B, 0x75, 0x13, 0x95, 0x64, 0x9A, 0xCE, 0x9D, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0xBE, 0xFF, 0x5C, 0xEF, 0xF9, 0xA5, 0xB6, 0x33, 
+0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 
+0xB7, 0x0B, 0x76, 0x13, 0x84, 0x29, 0xFF, 0xF7, 0xDE, 0xFF, 0xD5, 0x6C, 0x6D, 0x73, 0x98, 0xAD, 0xFF, 0xFF, 0xFE, 0xF7, 0x92, 0x94, 0x01, 0x00, 0x55, 0x0B, 0x00, 0x00, 0x92, 0x8C, 0xFE, 0xFF, 
+0x39, 0xCE, 0x00, 0x00, 0x67, 0x11, 0xDA, 0x03, 0x42, 0x00, 0x09, 0x2A, 0xDF, 0xFF, 0x75, 0xB5, 0xD3, 0x94, 0xFF, 0xFF, 0x5C, 0xE7, 0x88, 0x62, 0xDF, 0xF7, 0x91, 0x94, 0x61, 0x08, 0xDE, 0xFF, 
+0x9E, 0xFF, 0xCB, 0x5A, 0xC3, 0x00, 0x15, 0x03, 0xB8, 0x03, 0xD7, 0x0B, 0x76, 0x0B, 0x96, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x03, 
+0xB7, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0xB6, 0x0B, 0xB8, 0x03, 0xB7, 0x0B, 0xD5, 0x2B, 0xF9, 0xA5, 0x5B, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xF7, 0x1C, 0xD7, 0x78, 0x85, 0x51, 0x2B, 0x97, 0x0B, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xB8, 0x03, 0xB8, 0x03, 0x97, 0x0B, 0x96, 0x13, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB9, 0x03, 0x64, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0x91, 0x94, 0x80, 0x10, 0x20, 0x00, 
+0x26, 0x09, 0x86, 0x29, 0x1B, 0xE7, 0xFF, 0xF7, 0x45, 0x21, 0x00, 0x00, 0x13, 0x0B, 0x97, 0x0B, 0x0E, 0x02, 0xA2, 0x10, 0xFF, 0xEF, 0x1B, 0xD7, 0x1B, 0xE7, 0xFF, 0xFF, 0x31, 0x7C, 0x25, 0x11, 
+0xFF, 0xFF, 0xD6, 0xC5, 0x8E, 0x6B, 0xFF, 0xEF, 0xFB, 0xE6, 0x20, 0x00, 0x50, 0x02, 0x98, 0x03, 0x76, 0x0B, 0xB8, 0x03, 0x98, 0x03, 0xB7, 0x13, 0x97, 0x03, 0xB8, 0x03, 0xB7, 0x03, 0x96, 0x0B, 
+0x96, 0x13, 0xB7, 0x13, 0xB7, 0x0B, 0xB7, 0x03, 0xD9, 0x03, 0xD8, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0xB6, 0x23, 0x38, 0x85, 0xFB, 0xDE, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x9E, 0xEF, 0x5A, 0xB6, 0xB5, 0x6C, 0xB6, 0x13, 0x76, 0x0B, 0x97, 0x03, 0xD8, 0x0B, 0x96, 0x0B, 0x55, 0x03, 0x77, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0xB7, 0x0B, 0x76, 0x03, 0xA5, 0x31, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0x99, 0xD6, 0xA6, 0x29, 0x00, 0x00, 0x01, 0x00, 0x41, 0x00, 0xB3, 0x94, 0xFF, 0xF7, 0x0F, 0x84, 0x00, 0x08, 0x97, 0x03, 0xB9, 0x03, 0xB9, 0x03, 0xB8, 0x03, 0x20, 0x00, 0xB6, 0xBD, 0xFF, 0xFF, 
+0xFF, 0xEF, 0xDF, 0xFF, 0x60, 0x18, 0xE3, 0x18, 0xBF, 0xEF, 0x3B, 0xEF, 0x99, 0xD6, 0xFF, 0xFF, 0x0E, 0x84, 0xE4, 0x08, 0x55, 0x0B, 0xB9, 0x03, 0x96, 0x0B, 0x98, 0x03, 0x97, 0x03, 0xB7, 0x0B, 
+0xB8, 0x03, 0x76, 0x03, 0xB8, 0x0B, 0xD8, 0x03, 0x98, 0x03, 0x98, 0x03, 0xB8, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xF9, 0x03, 0xB8, 0x03, 0x75, 0x1B, 0x95, 0x64, 0x39, 0xBE, 0x7D, 0xEF, 
+0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x5D, 0xE7, 0x59, 0xBE, 0x36, 0x44, 0x95, 0x1B, 0x77, 0x0B, 
+0xB8, 0x0B, 0x96, 0x0B, 0xB6, 0x13, 0xD7, 0x13, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x96, 0x0B, 0x96, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x54, 0x0B, 0xA5, 0x39, 0x9E, 0xF7, 
+0xFF, 0xFF, 0x28, 0x4A, 0x74, 0xB5, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x11, 0x7C, 0x00, 0x08, 0xA6, 0x39, 0xFF, 0xFF, 0xB9, 0xE6, 0xE3, 0x10, 0x20, 0x00, 0x95, 0x0B, 0xB6, 0x13, 0x76, 0x03, 
+0xDA, 0x03, 0x00, 0x00, 0x51, 0x84, 0xDF, 0xFF, 0xFF, 0xFF, 0x54, 0xB5, 0x00, 0x00, 0x81, 0x18, 0x5A, 0xCE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDE, 0xFF, 0x62, 0x00, 0x48, 0x01, 0xB7, 0x13, 0xB8, 0x03, 
+0x96, 0x0B, 0xB8, 0x03, 0xB8, 0x03, 0xB7, 0x0B, 0xB8, 0x03, 0x96, 0x0B, 0x97, 0x03, 0x98, 0x03, 0xB8, 0x03, 0xF9, 0x03, 0xD8, 0x03, 0x97, 0x03, 0x76, 0x03, 0xD8, 0x0B, 0x98, 0x03, 0x96, 0x13, 
+0x75, 0x64, 0x17, 0xBE, 0x5C, 0xEF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 
+0x5C, 0xE7, 0x19, 0xAE, 0x54, 0x5C, 0x54, 0x13, 0x97, 0x03, 0xB8, 0x03, 0x97, 0x03, 0x77, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0xA6, 0x39, 0xFF, 0xFF, 0xDF, 0xFF, 0x61, 0x18, 0x21, 0x00, 0xEB, 0x5A, 0x9E, 0xEF, 0xFF, 0xF7, 0xDE, 0xFF, 0xB7, 0xAD, 0x92, 0x94, 0xFF, 0xFF, 0xAE, 0x73, 0x00, 0x00, 
+0xF9, 0x0B, 0x98, 0x03, 0xD7, 0x0B, 0xF8, 0x0B, 0x98, 0x0B, 0x00, 0x00, 0xAA, 0x52, 0xDF, 0xF7, 0xDF, 0xFF, 0xAA, 0x4A, 0x00, 0x00, 0x00, 0x08, 0xD2, 0x94, 0xDF, 0xFF, 0xFF, 0xFF, 0x74, 0xAD, 
+0x01, 0x00, 0xED, 0x01, 0x97, 0x03, 0x98, 0x03, 0x97, 0x0B, 0xB7, 0x0B, 0xB8, 0x03, 0xB7, 0x0B, 0x98, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x96, 0x0B, 0x76, 0x0B, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 
+0xD8, 0x0B, 0xB8, 0x0B, 0x54, 0x13, 0x54, 0x5C, 0x18, 0xBE, 0x5C, 0xEF, 0xDF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x5C, 0xEF, 0x19, 0xB6, 0x96, 0x64, 0xB5, 0x23, 0x77, 0x03, 0x98, 0x03, 0x98, 0x03, 0xB8, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xE2, 0x20, 0x5A, 0xC6, 0x79, 0xD6, 0xA2, 0x10, 0xAA, 0x09, 0x00, 0x08, 0xE6, 0x41, 0x51, 0x84, 0x71, 0x94, 0x69, 0x52, 
+0x9E, 0xEF, 0xBA, 0xCE, 0x23, 0x21, 0x46, 0x09, 0x98, 0x03, 0xB7, 0x03, 0x35, 0x0B, 0x97, 0x0B, 0x95, 0x0B, 0xCA, 0x01, 0x24, 0x21, 0xBE, 0xF7, 0xFF, 0xFF, 0x67, 0x11, 0x6A, 0x09, 0x00, 0x00, 
+0x87, 0x62, 0xFF, 0xFF, 0x9F, 0xE7, 0xC6, 0x31, 0x43, 0x00, 0x55, 0x13, 0x98, 0x03, 0xD9, 0x0B, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0xB8, 0x03, 0x97, 0x03, 0xB8, 0x0B, 0xB7, 0x0B, 
+0x97, 0x03, 0x97, 0x0B, 0xB8, 0x0B, 0x97, 0x0B, 0x77, 0x03, 0xB6, 0x23, 0x95, 0x6C, 0x18, 0xC6, 0x5C, 0xEF, 0xBF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x9D, 0xEF, 0x9A, 0xC6, 0xF6, 0x7C, 0xF5, 0x43, 0x95, 0x1B, 0x76, 0x03, 
+0x77, 0x03, 0x96, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0x97, 0x0B, 0x40, 0x00, 0xE3, 0x18, 0xC2, 0x20, 0x41, 0x00, 0x75, 0x0B, 0x6F, 0x0A, 
+0xB3, 0x02, 0x8F, 0x0A, 0x4F, 0x02, 0x00, 0x00, 0x07, 0x42, 0xA6, 0x29, 0x20, 0x00, 0x34, 0x0B, 0x97, 0x0B, 0x98, 0x03, 0x97, 0x0B, 0xD9, 0x0B, 0xD8, 0x0B, 0x75, 0x0B, 0x21, 0x00, 0xE6, 0x41, 
+0x07, 0x3A, 0x60, 0x10, 0x96, 0x13, 0xCD, 0x01, 0x00, 0x00, 0x49, 0x3A, 0xE5, 0x41, 0x00, 0x08, 0xD1, 0x02, 0xF8, 0x13, 0x77, 0x03, 0xD8, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 
+0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0xB8, 0x03, 0xD9, 0x03, 0xD9, 0x03, 0x76, 0x0B, 0x75, 0x13, 0xD5, 0x2B, 0x17, 0x7D, 0x7A, 0xC6, 0x7C, 0xF7, 0xBF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x7D, 0xEF, 
+0xFB, 0xDE, 0xB7, 0xA5, 0x54, 0x64, 0x94, 0x33, 0x75, 0x1B, 0x96, 0x13, 0x96, 0x0B, 0x96, 0x0B, 0x97, 0x0B, 0x97, 0x03, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x99, 0x03, 0x34, 0x13, 0x35, 0x0B, 
+0x36, 0x03, 0x34, 0x03, 0xB9, 0x03, 0x96, 0x13, 0x76, 0x13, 0x97, 0x03, 0xB7, 0x0B, 0x35, 0x03, 0xF3, 0x02, 0x35, 0x0B, 0x35, 0x03, 0x56, 0x03, 0xB6, 0x13, 0x78, 0x03, 0x56, 0x03, 0x97, 0x03, 
+0xB7, 0x0B, 0xD9, 0x0B, 0x54, 0x0B, 0x13, 0x03, 0x36, 0x03, 0x35, 0x03, 0x97, 0x03, 0xD8, 0x13, 0x14, 0x0B, 0x34, 0x03, 0x75, 0x13, 0x14, 0x0B, 0xB7, 0x03, 0x97, 0x03, 0x76, 0x03, 0x97, 0x03, 
+0x97, 0x03, 0xB7, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x0B, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x03, 0xB7, 0x0B, 0x95, 0x13, 0x93, 0x2B, 0x95, 0x64, 0xF9, 0xA5, 0xDB, 0xDE, 0x9E, 0xF7, 0xDF, 0xF7, 
+0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0x3B, 0xEF, 0xDB, 0xD6, 0xD9, 0x9D, 0x96, 0x5C, 0xB6, 0x1B, 0xB6, 0x13, 0x96, 0x13, 0x96, 0x0B, 0x76, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 
+0x97, 0x0B, 0xB7, 0x13, 0x56, 0x03, 0x95, 0x13, 0xB8, 0x03, 0x74, 0x0B, 0xD7, 0x13, 0x97, 0x0B, 0xB9, 0x0B, 0xB8, 0x03, 0x54, 0x0B, 0xB9, 0x03, 0x77, 0x03, 0x96, 0x13, 0x76, 0x03, 0xB7, 0x0B, 
+0x98, 0x03, 0x75, 0x0B, 0xB8, 0x0B, 0xB7, 0x0B, 0x96, 0x03, 0x96, 0x03, 0xB9, 0x03, 0x98, 0x0B, 0x98, 0x0B, 0x96, 0x03, 0x97, 0x13, 0x97, 0x03, 0xB8, 0x03, 0x99, 0x03, 0x76, 0x0B, 0xD7, 0x0B, 
+0xB8, 0x03, 0x97, 0x03, 0xD7, 0x13, 0x76, 0x03, 0x97, 0x03, 0xB7, 0x03, 0xB7, 0x0B, 0x97, 0x03, 0x97, 0x0B, 0x96, 0x03, 0xB7, 0x13, 0x95, 0x1B, 0xB4, 0x2B, 0x95, 0x64, 0xB8, 0x9D, 0xBA, 0xD6, 
+0x5B, 0xEF, 0x9D, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9E, 0xF7, 0x3C, 0xE7, 0xDB, 0xDE, 0x19, 0xBE, 0x57, 0x9D, 0x75, 0x6C, 
+0xF4, 0x43, 0xB4, 0x2B, 0x95, 0x23, 0x95, 0x1B, 0x94, 0x1B, 0x1F, 0x80, 0x74, 0x1B, 0x33, 0x00, 0x94, 0x1B, 0x94, 0x1B, 0x94, 0x1B, 0x94, 0x1B, 0x74, 0x1B, 0x94, 0x1B, 0xB5, 0x23, 0xD5, 0x23, 
+0xD3, 0x4B, 0x74, 0x6C, 0x57, 0x9D, 0x59, 0xC6, 0xDA, 0xDE, 0x5C, 0xEF, 0xBE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xBE, 0xF7, 0x9C, 0xF7, 0x3B, 0xE7, 0xBA, 0xCE, 0x59, 0xBE, 0x19, 0xB6, 0xD8, 0xB5, 0xB7, 0xB5, 0x97, 0xB5, 0x1F, 0x80, 0x97, 0xAD, 0x33, 0x00, 0x77, 0xAD, 
+0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0xB7, 0xB5, 0xD8, 0xB5, 0x7B, 0xB6, 0xDC, 0xC6, 0x3D, 0xDF, 0x7D, 0xEF, 0x9D, 0xF7, 0xBE, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xDF, 0xF7, 0xBF, 0xF7, 0x9E, 0xEF, 0x7E, 0xEF, 
+0x5D, 0xEF, 0x5C, 0xE7, 0x3B, 0xE7, 0x1F, 0x80, 0x5C, 0xEF, 0x09, 0x00, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x9D, 0xF7, 0xBE, 0xF7, 0xDE, 0xF7, 
+0x27, 0x80, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF7, 0x14, 0x00, 0xFF, 0xFF, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+};
@@ -0,0 +1,257 @@
+/* 64x64 RGB565 RLE picture converted from url_64x64_jpg.h by pict2rgb565, 8090 bytes */
+/* Pixels are read as 16 bits words: the array must be aligned */
+__ALIGNED(4) const char cUrl[] = {
+0x52, 0x35, 0x36, 0x35, 0x01, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC5, 0x0F, 0x00, 0x00, 0x8D, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xF7, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDE, 0xFF, 0xBD, 0xF7, 0x9D, 0xF7, 0x9D, 0xEF, 0x9D, 0xE7, 0x5D, 0xE7, 0x5D, 0xE7, 0x5D, 0xE7, 0x5C, 0xE7, 0x5C, 0xE7, 0x5C, 0xE7, 0x5C, 0xE7, 
+0x5C, 0xE7, 0x3E, 0xE7, 0x5F, 0xEF, 0x5D, 0xE7, 0x7B, 0xE7, 0x5B, 0xDF, 0x7E, 0xE7, 0x1D, 0xE7, 0x5C, 0xEF, 0x3C, 0xEF, 0x5C, 0xEF, 0x1B, 0xE7, 0x5C, 0xEF, 0x5C, 0xEF, 0x5C, 0xE7, 0x3C, 0xE7, 
+0x5D, 0xE7, 0x5D, 0xEF, 0x5D, 0xE7, 0x5D, 0xE7, 0x5D, 0xE7, 0x3D, 0xE7, 0x3D, 0xE7, 0x5D, 0xEF, 0x3D, 0xEF, 0x7E, 0xE7, 0x7E, 0xEF, 0x9D, 0xF7, 0xDE, 0xFF, 0xFE, 0xFF, 0xDF, 0xF7, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 
+0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xF7, 0xDF, 0xEF, 0x5E, 0xE7, 0x1C, 0xE7, 0x9A, 0xD6, 0xF7, 0xC5, 0xB6, 0xB5, 0x75, 0xB5, 0x75, 0xB5, 0x75, 0xB5, 0x75, 0xB5, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 
+0x75, 0xAD, 0x72, 0xB5, 0x74, 0xA5, 0x54, 0xA5, 0x75, 0xBD, 0x75, 0xB5, 0x77, 0xBD, 0x55, 0xB5, 0x74, 0xAD, 0x95, 0x9D, 0x75, 0xAD, 0x76, 0xB5, 0x36, 0xA5, 0x77, 0xAD, 0x76, 0xBD, 0x75, 0xB5, 
+0x75, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0xB7, 0xB5, 0x38, 0xC6, 0xBA, 0xD6, 0xDC, 0xDE, 0x3D, 0xE7, 0xBE, 0xF7, 0xFE, 0xFF, 
+0xBD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xF7, 0xFD, 0xFF, 0x1A, 0xE7, 0x79, 0xD6, 0xB7, 0xBD, 0x74, 0x7C, 0x72, 0x3B, 0x34, 0x13, 0x36, 0x03, 0x56, 0x03, 0x56, 0x03, 0x56, 0x03, 0x56, 0x03, 0x56, 0x03, 0x56, 0x03, 0x56, 0x03, 
+0x56, 0x03, 0x74, 0x0B, 0xB6, 0x03, 0x57, 0x03, 0x17, 0x13, 0x16, 0x03, 0x77, 0x03, 0xB8, 0x03, 0x96, 0x03, 0xB8, 0x03, 0xB6, 0x03, 0xF8, 0x0B, 0xD9, 0x03, 0xD9, 0x03, 0xF9, 0x03, 0xF9, 0x03, 
+0x3B, 0x04, 0x1C, 0x0C, 0x1C, 0x0C, 0x3C, 0x0C, 0x3C, 0x0C, 0x5C, 0x0C, 0x5C, 0x0C, 0x3C, 0x0C, 0x3C, 0x0C, 0x3A, 0x04, 0xF8, 0x13, 0x37, 0x44, 0xF6, 0x7C, 0xD8, 0xB5, 0x9B, 0xD6, 0x5D, 0xEF, 
+0xDD, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 
+0x9D, 0xF7, 0x98, 0xDE, 0xB7, 0xA5, 0x15, 0x4C, 0x14, 0x0B, 0x77, 0x03, 0xD8, 0x03, 0xF7, 0x03, 0x38, 0x0C, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 
+0x39, 0x04, 0x19, 0x04, 0x9B, 0x04, 0x5B, 0x04, 0x3A, 0x14, 0x78, 0x04, 0xB9, 0x04, 0xBA, 0x04, 0x7A, 0x04, 0x3C, 0x04, 0x9A, 0x04, 0xB9, 0x04, 0xFC, 0x0C, 0xDB, 0x04, 0x1B, 0x05, 0xFB, 0x04, 
+0xFE, 0x0C, 0x1D, 0x05, 0x3D, 0x05, 0x3D, 0x05, 0x5D, 0x05, 0x5D, 0x05, 0x5E, 0x05, 0x5D, 0x05, 0x5D, 0x05, 0x3E, 0x05, 0x3D, 0x05, 0xDD, 0x04, 0x3C, 0x04, 0xFA, 0x13, 0x97, 0x4C, 0xB8, 0x9D, 
+0x9B, 0xDE, 0x7B, 0xFF, 0xDF, 0xF7, 0xFF, 0xF7, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xDF, 0xFF, 0x3C, 0xE7, 
+0x59, 0xBE, 0x57, 0x54, 0x54, 0x1B, 0x35, 0x03, 0xD8, 0x03, 0x39, 0x04, 0x39, 0x04, 0x58, 0x04, 0x38, 0x04, 0x58, 0x04, 0x58, 0x04, 0x58, 0x04, 0x58, 0x04, 0x58, 0x04, 0x58, 0x04, 0x58, 0x04, 
+0x58, 0x04, 0x5A, 0x0C, 0x99, 0x04, 0x58, 0x04, 0x59, 0x04, 0xB9, 0x04, 0x58, 0x04, 0x39, 0x04, 0x5B, 0x0C, 0xBB, 0x04, 0xBB, 0x0C, 0x7A, 0x04, 0xBC, 0x04, 0xBC, 0x04, 0xFC, 0x04, 0x3D, 0x05, 
+0xFD, 0x04, 0x3D, 0x05, 0x3D, 0x05, 0x5E, 0x05, 0x7E, 0x05, 0x7E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5C, 0x05, 0xFD, 0x04, 0x1E, 0x05, 0x5D, 0x05, 0xBB, 0x04, 0xD9, 0x03, 0xF8, 0x2B, 
+0xB8, 0x54, 0x59, 0xC6, 0x5D, 0xE7, 0xDF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x3D, 0xE7, 0x1A, 0xAE, 
+0xF2, 0x53, 0x13, 0x03, 0xB6, 0x0B, 0x17, 0x04, 0x38, 0x04, 0x79, 0x04, 0x59, 0x04, 0x39, 0x04, 0x5A, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 
+0x39, 0x04, 0x18, 0x0C, 0x37, 0x0C, 0x98, 0x04, 0x39, 0x04, 0x3A, 0x0C, 0x3A, 0x0C, 0x5A, 0x04, 0xBB, 0x04, 0xD9, 0x04, 0x79, 0x04, 0xBB, 0x04, 0x1D, 0x05, 0x3D, 0x05, 0x9C, 0x04, 0xFD, 0x14, 
+0x1C, 0x05, 0x3D, 0x05, 0x3D, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x3F, 0x05, 0x5E, 0x05, 0x5D, 0x05, 0x3D, 0x05, 0x1D, 0x05, 0x1C, 0x0D, 0x79, 0x0C, 
+0xB7, 0x03, 0x56, 0x4C, 0xF9, 0xAD, 0x3C, 0xF7, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xBE, 0xFF, 0x3C, 0xE7, 0x1A, 0xAE, 0xF4, 0x3B, 
+0x33, 0x03, 0x59, 0x04, 0x18, 0x04, 0x38, 0x04, 0x79, 0x04, 0x38, 0x04, 0x17, 0x04, 0x38, 0x0C, 0x39, 0x0C, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 
+0x59, 0x04, 0xDD, 0x04, 0xD7, 0x03, 0x78, 0x14, 0x79, 0x04, 0x5A, 0x0C, 0x7B, 0x0C, 0xB9, 0x04, 0x99, 0x04, 0xBA, 0x0C, 0x7B, 0x04, 0x1D, 0x0D, 0x1B, 0x0D, 0xDA, 0x04, 0x3E, 0x05, 0x1E, 0x05, 
+0x3D, 0x05, 0x3D, 0x05, 0x5D, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x3E, 0x05, 0x3E, 0x05, 0x1D, 0x05, 0x3C, 0x05, 0x3C, 0x05, 0xFD, 0x04, 0xDD, 0x04, 
+0xDC, 0x04, 0xB7, 0x03, 0x76, 0x4C, 0xF8, 0xAD, 0x5D, 0xE7, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDE, 0xF7, 0x7D, 0xEF, 0x59, 0xC6, 0xD2, 0x4B, 0x13, 0x03, 
+0x1A, 0x04, 0x58, 0x04, 0x59, 0x04, 0x5A, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 0x59, 0x04, 
+0x59, 0x04, 0x15, 0x04, 0x44, 0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x08, 0x21, 0x00, 0x01, 0x00, 0x00, 0x08, 0x22, 0x00, 0xB8, 0x1C, 0x5D, 0x05, 
+0x5E, 0x05, 0x5D, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x5E, 0x05, 0x7E, 0x05, 0x5D, 0x05, 0x3C, 0x05, 0x1D, 0x0D, 0x1D, 0x0D, 0xFC, 0x04, 0xFC, 0x0C, 
+0xDC, 0x0C, 0x9C, 0x0C, 0x97, 0x03, 0x56, 0x4C, 0x38, 0xC6, 0x5B, 0xF7, 0xDE, 0xF7, 0xFF, 0xF7, 0xDE, 0xFF, 0xDF, 0xFF, 0xFE, 0xF7, 0xDE, 0xF7, 0x99, 0xDE, 0x78, 0x54, 0x54, 0x0B, 0x38, 0x04, 
+0x18, 0x04, 0x19, 0x04, 0x7A, 0x04, 0x19, 0x04, 0xF8, 0x03, 0x98, 0x04, 0xF7, 0x03, 0xF8, 0x0B, 0x59, 0x04, 0x39, 0x04, 0xF9, 0x0B, 0x98, 0x04, 0x3A, 0x04, 0x37, 0x04, 0x9A, 0x04, 0x39, 0x0C, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x77, 0x95, 0x75, 0x55, 0x51, 0x1D, 0xB4, 0x04, 0xF5, 0x04, 0x94, 0x04, 0xD5, 0x04, 0xB5, 0x2B, 0x96, 0x4C, 0x97, 0x95, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 
+0x3D, 0x05, 0x9C, 0x05, 0x7F, 0x05, 0x5E, 0x05, 0x7E, 0x05, 0x5D, 0x0D, 0x5E, 0x05, 0x5E, 0x05, 0x1E, 0x0D, 0x5D, 0x05, 0x3D, 0x05, 0x3D, 0x05, 0x1D, 0x05, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x04, 
+0xDC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0xB6, 0x0B, 0x98, 0x54, 0xB9, 0xEE, 0xDD, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x1B, 0xE7, 0xB8, 0xAD, 0x74, 0x23, 0xD6, 0x0B, 0xF7, 0x03, 
+0x39, 0x04, 0x37, 0x04, 0x18, 0x0C, 0xF8, 0x13, 0x19, 0x04, 0x59, 0x04, 0x39, 0x04, 0x39, 0x0C, 0x58, 0x04, 0x77, 0x04, 0x5B, 0x04, 0x37, 0x04, 0x37, 0x04, 0x39, 0x04, 0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x50, 0x24, 0xD4, 0x03, 0xB7, 0x05, 0xF7, 0x05, 0xB6, 0x05, 0x59, 0x05, 0x37, 0x0E, 0x19, 0x06, 0xBA, 0x05, 0x1B, 0x04, 0x5B, 0x0C, 0x1C, 0x04, 0x77, 0x03, 0x93, 0x44, 0x00, 0x00, 
+0x20, 0x00, 0x00, 0x00, 0x1D, 0x05, 0x5E, 0x0D, 0x3F, 0x05, 0x3D, 0x0D, 0x9F, 0x05, 0x7F, 0x05, 0x3B, 0x05, 0x3D, 0x05, 0x3D, 0x05, 0x1D, 0x05, 0xFD, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x04, 
+0xDC, 0x04, 0xBB, 0x04, 0x9A, 0x04, 0x18, 0x04, 0xD6, 0x2B, 0x97, 0xA5, 0x3B, 0xE7, 0xFF, 0xF7, 0xDF, 0xFF, 0xBE, 0xF7, 0xDF, 0xEF, 0x99, 0xD6, 0x35, 0x4C, 0x54, 0x03, 0x17, 0x04, 0x18, 0x04, 
+0x1A, 0x04, 0x58, 0x04, 0xD7, 0x03, 0x18, 0x04, 0x79, 0x04, 0xF9, 0x03, 0xD9, 0x03, 0x18, 0x04, 0x57, 0x04, 0x19, 0x04, 0x58, 0x04, 0xFA, 0x0B, 0xD8, 0x0B, 0x01, 0x10, 0x00, 0x00, 0x6E, 0x3C, 
+0x6A, 0x05, 0x4E, 0x05, 0x8C, 0x05, 0x8E, 0x06, 0xB3, 0x06, 0x15, 0x06, 0xD8, 0x05, 0x5A, 0x05, 0x7D, 0x06, 0xBA, 0x06, 0x3C, 0x0E, 0x7A, 0x04, 0x3B, 0x04, 0x7A, 0x04, 0x14, 0x05, 0xB1, 0x05, 
+0x71, 0x44, 0x01, 0x08, 0x20, 0x00, 0x3D, 0x15, 0x7C, 0x05, 0x7E, 0x0D, 0x5E, 0x0D, 0xFE, 0x04, 0x5E, 0x05, 0x3D, 0x05, 0x1D, 0x05, 0x1D, 0x05, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 
+0xBB, 0x04, 0xBC, 0x04, 0x9A, 0x04, 0x79, 0x04, 0x97, 0x03, 0x56, 0x54, 0x79, 0xD6, 0xDF, 0xEF, 0xDF, 0xFF, 0xBE, 0xF7, 0x7E, 0xE7, 0xD7, 0xBD, 0x34, 0x0B, 0xF7, 0x03, 0x37, 0x04, 0x59, 0x04, 
+0xF9, 0x03, 0x19, 0x04, 0x18, 0x04, 0x39, 0x04, 0x59, 0x04, 0x38, 0x04, 0x79, 0x04, 0x38, 0x04, 0x38, 0x14, 0xF8, 0x03, 0x9A, 0x04, 0x00, 0x00, 0x20, 0x00, 0xA5, 0x21, 0x2D, 0x04, 0xC6, 0x0D, 
+0x67, 0x05, 0x68, 0x06, 0x8D, 0x05, 0xB2, 0x05, 0x74, 0x05, 0xAF, 0x06, 0xBA, 0x06, 0x9B, 0x05, 0x9B, 0x0E, 0xBC, 0x06, 0x1B, 0x05, 0xFB, 0x0C, 0x17, 0x05, 0x7C, 0x04, 0x3E, 0x14, 0xB8, 0x05, 
+0x34, 0x05, 0x70, 0x04, 0xC5, 0x18, 0x40, 0x00, 0x20, 0x00, 0x7E, 0x05, 0x5E, 0x05, 0x7E, 0x05, 0x3C, 0x0D, 0x1D, 0x05, 0x1D, 0x05, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 
+0xBB, 0x04, 0x9B, 0x04, 0xBA, 0x04, 0xBA, 0x04, 0x39, 0x04, 0x96, 0x13, 0xB7, 0xB5, 0x7E, 0xE7, 0xDE, 0xF7, 0xBE, 0xF7, 0xFC, 0xDE, 0x73, 0x7C, 0x76, 0x03, 0x38, 0x04, 0x58, 0x04, 0x18, 0x04, 
+0xF9, 0x03, 0x18, 0x04, 0x7A, 0x04, 0x19, 0x04, 0xF8, 0x03, 0x37, 0x04, 0xB9, 0x04, 0x18, 0x04, 0xDA, 0x03, 0x59, 0x04, 0x00, 0x08, 0x20, 0x00, 0x16, 0x85, 0x8F, 0x0C, 0xC7, 0x05, 0x48, 0x06, 
+0x48, 0x06, 0x98, 0x05, 0xFD, 0x05, 0x1A, 0x06, 0x38, 0x06, 0x5C, 0x06, 0x1E, 0x06, 0x5F, 0x06, 0x7C, 0x06, 0x7C, 0x06, 0xBF, 0x05, 0x7C, 0x0D, 0x5B, 0x05, 0xFC, 0x04, 0x9A, 0x04, 0x9C, 0x04, 
+0x9B, 0x0B, 0x75, 0x03, 0xC9, 0x05, 0x36, 0x8D, 0x01, 0x00, 0x00, 0x08, 0x5E, 0x1D, 0x1C, 0x05, 0x5F, 0x05, 0x1D, 0x05, 0x1C, 0x05, 0xFC, 0x04, 0xDC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 
+0xBB, 0x04, 0x7A, 0x04, 0x9A, 0x04, 0x9A, 0x04, 0xBB, 0x04, 0x98, 0x03, 0x94, 0x84, 0xFC, 0xDE, 0xBD, 0xF7, 0x9D, 0xF7, 0x79, 0xCE, 0x72, 0x43, 0xD7, 0x03, 0x59, 0x04, 0x18, 0x04, 0xF7, 0x03, 
+0x18, 0x04, 0x17, 0x04, 0x79, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF7, 0x03, 0xD7, 0x03, 0x19, 0x04, 0x9C, 0x04, 0xF9, 0x0B, 0x60, 0x00, 0x38, 0x9D, 0x2D, 0x04, 0x66, 0x05, 0xC9, 0x05, 0x27, 0x05, 
+0xC9, 0x05, 0xF3, 0x05, 0x5F, 0x06, 0x34, 0x06, 0xD2, 0x06, 0xB3, 0x06, 0x3D, 0x0E, 0xDF, 0x0E, 0x5F, 0x06, 0x1C, 0x06, 0xFE, 0x05, 0x9E, 0x05, 0x9D, 0x05, 0x1A, 0x05, 0x5A, 0x04, 0x99, 0x0C, 
+0x74, 0x05, 0xB2, 0x0C, 0x6A, 0x06, 0x8A, 0x05, 0x75, 0x9D, 0x04, 0x00, 0x3A, 0x05, 0x1D, 0x15, 0x3D, 0x05, 0x1C, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0x9B, 0x04, 
+0x9B, 0x04, 0x9A, 0x04, 0x79, 0x04, 0x7A, 0x04, 0x9A, 0x04, 0xF9, 0x03, 0xB3, 0x43, 0x7A, 0xCE, 0x9D, 0xF7, 0x9E, 0xEF, 0xD7, 0xBD, 0x54, 0x1B, 0xD7, 0x03, 0x38, 0x04, 0xF8, 0x03, 0x17, 0x04, 
+0x38, 0x04, 0xF8, 0x03, 0x17, 0x04, 0x37, 0x04, 0x79, 0x04, 0xF9, 0x0B, 0xB9, 0x0B, 0x79, 0x14, 0xD5, 0x03, 0x40, 0x00, 0x01, 0x00, 0xF2, 0x02, 0xA4, 0x04, 0xA9, 0x05, 0x28, 0x06, 0x65, 0x05, 
+0x2A, 0x0E, 0x50, 0x06, 0x77, 0x06, 0xB6, 0x06, 0xF9, 0x06, 0xD7, 0x06, 0x19, 0x07, 0xFF, 0x06, 0xFF, 0x06, 0x5F, 0x16, 0x7C, 0x06, 0xBE, 0x05, 0xFC, 0x0C, 0xB9, 0x04, 0x5A, 0x04, 0x19, 0x04, 
+0x58, 0x03, 0x94, 0x04, 0x08, 0x06, 0x8D, 0x0E, 0xAA, 0x05, 0x00, 0x00, 0x20, 0x00, 0x1F, 0x05, 0x1C, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0x9B, 0x04, 0x9B, 0x04, 
+0x9A, 0x04, 0x9A, 0x04, 0x59, 0x0C, 0x7A, 0x04, 0x79, 0x04, 0x59, 0x04, 0x75, 0x13, 0x18, 0xC6, 0x9D, 0xEF, 0x7D, 0xE7, 0xB6, 0xB5, 0x76, 0x03, 0x17, 0x04, 0xF8, 0x03, 0x1A, 0x04, 0x18, 0x04, 
+0x58, 0x04, 0x3A, 0x04, 0x18, 0x0C, 0x16, 0x04, 0xF8, 0x03, 0xFA, 0x03, 0x79, 0x04, 0xF3, 0x03, 0x04, 0x00, 0x40, 0x00, 0x31, 0x02, 0x27, 0x05, 0x27, 0x06, 0x85, 0x05, 0x68, 0x05, 0x0B, 0x06, 
+0xF2, 0x05, 0xB5, 0x0E, 0x97, 0x06, 0x35, 0x07, 0xFC, 0x06, 0x1B, 0x0F, 0xDB, 0x06, 0xDF, 0x0E, 0x3E, 0x07, 0xDF, 0x06, 0x1E, 0x06, 0xBC, 0x15, 0xDA, 0x04, 0xDD, 0x04, 0x1C, 0x0C, 0x99, 0x03, 
+0xB8, 0x03, 0xF8, 0x02, 0xF0, 0x05, 0x51, 0x04, 0xF3, 0x04, 0x50, 0x09, 0x00, 0x00, 0x20, 0x00, 0xBD, 0x04, 0xFC, 0x04, 0xFC, 0x04, 0xDC, 0x04, 0xBB, 0x04, 0x9B, 0x04, 0x9B, 0x04, 0x9A, 0x04, 
+0x7A, 0x04, 0x7A, 0x04, 0x5A, 0x0C, 0x5B, 0x04, 0x9A, 0x04, 0x79, 0x04, 0x97, 0x03, 0x96, 0xB5, 0x5D, 0xEF, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0x37, 0x04, 0x5A, 0x0C, 0xF8, 0x03, 0xD6, 0x03, 0x3A, 0x04, 0x18, 0x04, 0xB6, 0x13, 0x20, 0x00, 0x53, 0x3B, 0x29, 0x0C, 0xA6, 0x05, 0x69, 0x06, 0x08, 0x0E, 0x07, 0x06, 0xEB, 0x05, 
+0x33, 0x06, 0x98, 0x06, 0xD8, 0x06, 0x19, 0x07, 0x3A, 0x07, 0x3D, 0x07, 0x3F, 0x07, 0x1F, 0x07, 0x1E, 0x07, 0x9F, 0x06, 0x3E, 0x06, 0x9D, 0x05, 0x1C, 0x05, 0xBB, 0x04, 0x5A, 0x04, 0xFA, 0x03, 
+0x79, 0x03, 0x96, 0x03, 0x6E, 0x06, 0x75, 0x03, 0x72, 0x01, 0x73, 0x01, 0x30, 0x53, 0x00, 0x00, 0x3C, 0x0D, 0xBB, 0x04, 0x1B, 0x05, 0xDC, 0x04, 0x9C, 0x04, 0xDB, 0x04, 0x79, 0x04, 0x79, 0x0C, 
+0x7A, 0x04, 0x79, 0x04, 0x5A, 0x04, 0x7A, 0x04, 0x79, 0x04, 0x7A, 0x04, 0x76, 0x03, 0x75, 0xAD, 0x3D, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0x19, 0x04, 0xB8, 0x03, 0x77, 0x04, 0x58, 0x04, 0xF8, 0x03, 0x17, 0x04, 0x22, 0x00, 0x20, 0x00, 0x10, 0x02, 0x83, 0x04, 0x08, 0x06, 0x68, 0x06, 0xC4, 0x0D, 0xAA, 0x05, 0x0B, 0x06, 
+0x6E, 0x06, 0xF4, 0x06, 0x18, 0x07, 0x1D, 0x07, 0x1F, 0x07, 0x3F, 0x07, 0x3F, 0x07, 0x3F, 0x07, 0x1F, 0x07, 0x9F, 0x06, 0x1E, 0x06, 0xBD, 0x05, 0x3C, 0x05, 0xBB, 0x04, 0x5B, 0x04, 0xFA, 0x03, 
+0x99, 0x03, 0x57, 0x03, 0x8E, 0x06, 0x72, 0x04, 0xF1, 0x02, 0x75, 0x02, 0xAE, 0x01, 0x00, 0x00, 0x02, 0x00, 0xFD, 0x04, 0xBB, 0x0C, 0x9B, 0x04, 0x9A, 0x04, 0x9A, 0x04, 0xBA, 0x04, 0xBA, 0x04, 
+0x9A, 0x04, 0x79, 0x04, 0x5A, 0x04, 0x5A, 0x04, 0x79, 0x04, 0x7A, 0x04, 0x56, 0x03, 0x75, 0xAD, 0x3D, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0xF8, 0x03, 0x5B, 0x04, 0xD6, 0x03, 0x37, 0x04, 0x18, 0x04, 0x1A, 0x04, 0x00, 0x00, 0x53, 0x5B, 0x6C, 0x02, 0x03, 0x05, 0xE6, 0x05, 0xA5, 0x05, 0x25, 0x05, 0x88, 0x05, 0x29, 0x06, 
+0xAD, 0x06, 0xF8, 0x06, 0x1C, 0x07, 0x1F, 0x07, 0x3F, 0x07, 0x5F, 0x07, 0x5F, 0x07, 0x1F, 0x07, 0xDF, 0x06, 0x9F, 0x06, 0x1E, 0x06, 0x9D, 0x05, 0x3C, 0x05, 0xBB, 0x04, 0x5B, 0x04, 0xFA, 0x03, 
+0x99, 0x03, 0xFA, 0x02, 0x19, 0x03, 0x74, 0x03, 0x4F, 0x06, 0xE8, 0x05, 0x0B, 0x05, 0x50, 0x5C, 0x40, 0x08, 0xFC, 0x04, 0x5B, 0x04, 0x9A, 0x0C, 0xDA, 0x04, 0x7A, 0x04, 0x5A, 0x04, 0x5A, 0x04, 
+0x7A, 0x04, 0x59, 0x04, 0x5A, 0x04, 0x5A, 0x04, 0x79, 0x04, 0x7A, 0x04, 0x56, 0x03, 0x75, 0xAD, 0x3D, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0x36, 0x04, 0xB9, 0x03, 0x38, 0x04, 0xF8, 0x03, 0x18, 0x04, 0xD7, 0x03, 0x00, 0x00, 0x2E, 0x01, 0x32, 0x02, 0x22, 0x05, 0x24, 0x05, 0x25, 0x05, 0x26, 0x05, 0x6A, 0x05, 0x08, 0x06, 
+0x6D, 0x06, 0xBF, 0x06, 0xFF, 0x06, 0x3F, 0x07, 0x5F, 0x07, 0x5E, 0x07, 0x3F, 0x07, 0xFF, 0x06, 0xBF, 0x06, 0x5E, 0x06, 0xFD, 0x05, 0x7C, 0x05, 0x1C, 0x05, 0xBB, 0x04, 0x5A, 0x04, 0xDA, 0x03, 
+0x79, 0x03, 0x19, 0x03, 0x56, 0x02, 0x2E, 0x0D, 0xF1, 0x06, 0xAB, 0x05, 0xE9, 0x05, 0x09, 0x04, 0x20, 0x00, 0x98, 0x14, 0xFC, 0x0C, 0x79, 0x04, 0x99, 0x04, 0x5A, 0x04, 0x7A, 0x04, 0x3A, 0x04, 
+0x3A, 0x04, 0x59, 0x04, 0x39, 0x04, 0x5A, 0x04, 0x59, 0x04, 0x7A, 0x04, 0x55, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0x38, 0x04, 0x18, 0x04, 0x18, 0x04, 0x19, 0x04, 0xF7, 0x03, 0x02, 0x08, 0x81, 0x10, 0x0E, 0x01, 0xEF, 0x01, 0xE3, 0x04, 0x65, 0x0C, 0xA6, 0x04, 0xC9, 0x04, 0x48, 0x05, 0xAD, 0x05, 
+0xDC, 0x05, 0x7F, 0x06, 0xBF, 0x06, 0xFF, 0x06, 0x1F, 0x07, 0xFF, 0x06, 0xDF, 0x06, 0xBE, 0x06, 0xBC, 0x06, 0x3E, 0x06, 0xDD, 0x05, 0x7C, 0x05, 0xFB, 0x04, 0x9B, 0x04, 0x3A, 0x04, 0xBA, 0x03, 
+0x59, 0x03, 0xD8, 0x02, 0x7A, 0x0A, 0x8F, 0x05, 0x0A, 0x06, 0x48, 0x0D, 0xA9, 0x05, 0xCA, 0x05, 0x80, 0x08, 0x23, 0x00, 0x38, 0x04, 0xBB, 0x04, 0x7A, 0x04, 0x5A, 0x04, 0x78, 0x04, 0x9A, 0x04, 
+0x7A, 0x04, 0x59, 0x04, 0x39, 0x04, 0x5A, 0x04, 0x59, 0x04, 0x7A, 0x04, 0x55, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0x16, 0x04, 0x19, 0x0C, 0x39, 0x04, 0xFA, 0x03, 0xD7, 0x03, 0x00, 0x08, 0x14, 0x6C, 0x51, 0x01, 0xCD, 0x01, 0xC3, 0x04, 0x0D, 0x03, 0xD9, 0x02, 0x98, 0x03, 0x94, 0x04, 0x5A, 0x05, 
+0xFB, 0x05, 0x3C, 0x06, 0x5D, 0x06, 0x9F, 0x06, 0x9F, 0x06, 0x9F, 0x06, 0x9F, 0x06, 0x7E, 0x06, 0x5E, 0x06, 0xDE, 0x05, 0x9D, 0x05, 0x3C, 0x05, 0xDB, 0x04, 0x7B, 0x04, 0x1A, 0x04, 0xBA, 0x03, 
+0x39, 0x03, 0xF7, 0x02, 0x36, 0x02, 0xCC, 0x05, 0x09, 0x06, 0x0C, 0x06, 0xAB, 0x05, 0xCB, 0x05, 0x32, 0x7D, 0x00, 0x08, 0xD9, 0x04, 0x9A, 0x04, 0x3A, 0x04, 0x5B, 0x0C, 0x98, 0x04, 0x7A, 0x0C, 
+0x39, 0x04, 0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x7A, 0x04, 0x55, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0x57, 0x04, 0x19, 0x04, 0x1A, 0x04, 0xD7, 0x03, 0x38, 0x04, 0x22, 0x00, 0x94, 0x2B, 0xB1, 0x00, 0xAE, 0x01, 0x64, 0x04, 0x13, 0x02, 0x77, 0x02, 0x77, 0x03, 0x56, 0x0C, 0x36, 0x05, 
+0x3B, 0x05, 0xBC, 0x05, 0xDD, 0x05, 0x1E, 0x06, 0x1E, 0x06, 0x3D, 0x06, 0x1D, 0x06, 0xFE, 0x05, 0xBF, 0x05, 0x7D, 0x05, 0x3C, 0x05, 0xFB, 0x04, 0x9B, 0x04, 0x5A, 0x04, 0xFA, 0x03, 0x99, 0x03, 
+0x39, 0x03, 0xD8, 0x02, 0x95, 0x03, 0x4B, 0x06, 0x0A, 0x06, 0x89, 0x05, 0x28, 0x06, 0xCB, 0x05, 0x4F, 0x54, 0x00, 0x00, 0x99, 0x04, 0x79, 0x04, 0x9A, 0x04, 0x3B, 0x0C, 0x57, 0x04, 0x39, 0x04, 
+0x19, 0x0C, 0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x7A, 0x04, 0x76, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x35, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0x18, 0x04, 0xF9, 0x03, 0xF6, 0x03, 0x58, 0x0C, 0x37, 0x04, 0x00, 0x00, 0x8E, 0x3A, 0x8E, 0x00, 0xAD, 0x01, 0x25, 0x04, 0xB2, 0x01, 0x55, 0x02, 0x19, 0x03, 0x9A, 0x03, 0x7A, 0x04, 
+0xBE, 0x04, 0x5D, 0x05, 0x7E, 0x05, 0xBE, 0x05, 0xDD, 0x05, 0xDC, 0x05, 0xBC, 0x05, 0x9C, 0x05, 0x7C, 0x05, 0x3C, 0x05, 0xFC, 0x04, 0xBB, 0x04, 0x7B, 0x04, 0x1A, 0x04, 0xBA, 0x03, 0x79, 0x03, 
+0x18, 0x03, 0x39, 0x0A, 0x31, 0x04, 0x0D, 0x06, 0xEC, 0x15, 0x68, 0x0D, 0xC6, 0x05, 0x87, 0x05, 0xAB, 0x2B, 0x01, 0x00, 0x3A, 0x04, 0x59, 0x14, 0x98, 0x04, 0xFA, 0x0B, 0x78, 0x04, 0x7A, 0x04, 
+0x59, 0x04, 0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x79, 0x04, 0x76, 0x03, 0x75, 0xAD, 0x5C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x35, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0xF9, 0x03, 0xD6, 0x03, 0x18, 0x04, 0x59, 0x04, 0xF8, 0x03, 0x00, 0x00, 0x2E, 0x22, 0x90, 0x00, 0x8F, 0x00, 0x88, 0x0B, 0xEE, 0x02, 0x86, 0x0B, 0x7A, 0x0A, 0x95, 0x03, 0x55, 0x04, 
+0x7C, 0x04, 0xBB, 0x04, 0xFD, 0x04, 0x3B, 0x05, 0x3C, 0x05, 0x3E, 0x05, 0x3D, 0x05, 0x3B, 0x05, 0x1C, 0x05, 0xDC, 0x04, 0x9B, 0x04, 0x5B, 0x04, 0x1A, 0x04, 0xFA, 0x03, 0x9A, 0x03, 0x19, 0x03, 
+0xB8, 0x02, 0x38, 0x02, 0xF6, 0x12, 0xCB, 0x05, 0xAB, 0x05, 0x28, 0x05, 0xA7, 0x04, 0xE7, 0x14, 0x2A, 0x1B, 0x00, 0x00, 0x59, 0x0C, 0x77, 0x0C, 0x59, 0x04, 0x3A, 0x04, 0x38, 0x0C, 0x5A, 0x04, 
+0x59, 0x04, 0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x59, 0x04, 0x55, 0x03, 0x75, 0xB5, 0x5C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x35, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0x39, 0x04, 0x17, 0x04, 0x38, 0x04, 0x17, 0x04, 0x19, 0x04, 0x00, 0x00, 0x6F, 0x22, 0xAF, 0x00, 0xAD, 0x00, 0x52, 0x01, 0xCB, 0x02, 0x50, 0x03, 0xB6, 0x02, 0x38, 0x03, 0xB9, 0x03, 
+0x19, 0x04, 0xD7, 0x04, 0xBA, 0x04, 0xBB, 0x04, 0xBB, 0x04, 0xDC, 0x04, 0xDD, 0x04, 0xDB, 0x0C, 0xBC, 0x0C, 0x9B, 0x04, 0x5B, 0x04, 0x1A, 0x04, 0xFA, 0x03, 0xBA, 0x03, 0x59, 0x03, 0xD9, 0x02, 
+0x78, 0x02, 0xF6, 0x01, 0x94, 0x02, 0xC8, 0x05, 0xC5, 0x04, 0xA5, 0x04, 0xA4, 0x04, 0xE5, 0x03, 0x8B, 0x33, 0x20, 0x00, 0x5A, 0x04, 0x58, 0x04, 0x59, 0x04, 0x39, 0x04, 0x39, 0x04, 0x5A, 0x0C, 
+0x3A, 0x0C, 0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x59, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x35, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0xF9, 0x03, 0x38, 0x04, 0xB6, 0x03, 0xF6, 0x03, 0x3A, 0x04, 0x00, 0x00, 0xB0, 0x2A, 0x6D, 0x00, 0x8F, 0x00, 0x70, 0x00, 0x73, 0x01, 0x6A, 0x03, 0x6F, 0x03, 0x97, 0x02, 0x3A, 0x13, 
+0x59, 0x03, 0xD9, 0x03, 0xFA, 0x03, 0x3A, 0x04, 0x59, 0x04, 0x5B, 0x04, 0x5A, 0x04, 0x59, 0x04, 0x5B, 0x04, 0x3A, 0x04, 0x1A, 0x04, 0xDA, 0x03, 0x9A, 0x03, 0x59, 0x03, 0xF9, 0x02, 0x98, 0x02, 
+0x58, 0x02, 0xD7, 0x01, 0xB3, 0x02, 0xC8, 0x04, 0xC7, 0x04, 0x26, 0x04, 0xE3, 0x03, 0x0A, 0x0C, 0x4D, 0x33, 0x00, 0x00, 0x5B, 0x04, 0x3A, 0x04, 0x5A, 0x0C, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 
+0x18, 0x04, 0x59, 0x04, 0x39, 0x04, 0x59, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x35, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0x18, 0x04, 0x19, 0x04, 0xD7, 0x03, 0x18, 0x04, 0x17, 0x04, 0xD9, 0x03, 0x00, 0x00, 0x92, 0x53, 0xEF, 0x08, 0x8E, 0x00, 0xAF, 0x08, 0xB1, 0x00, 0x14, 0x02, 0x8F, 0x03, 0x76, 0x02, 0xD9, 0x0A, 
+0xFA, 0x02, 0x39, 0x03, 0x3A, 0x03, 0x99, 0x03, 0xDA, 0x0B, 0xDB, 0x03, 0xF9, 0x03, 0x19, 0x04, 0xFC, 0x03, 0xDA, 0x03, 0xBA, 0x03, 0x9A, 0x03, 0x59, 0x03, 0x19, 0x03, 0xB8, 0x02, 0x58, 0x02, 
+0x37, 0x02, 0x19, 0x02, 0x15, 0x02, 0xB1, 0x02, 0x67, 0x04, 0x65, 0x0C, 0x6C, 0x02, 0x13, 0x02, 0x90, 0x5C, 0x20, 0x08, 0x7B, 0x04, 0x19, 0x04, 0x18, 0x04, 0x39, 0x04, 0x7A, 0x04, 0x78, 0x0C, 
+0x39, 0x04, 0x38, 0x04, 0x39, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x34, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0xF8, 0x03, 0xF8, 0x03, 0x17, 0x04, 0xD7, 0x03, 0x18, 0x04, 0xF9, 0x03, 0x00, 0x00, 0xD4, 0x8C, 0xCF, 0x00, 0xCD, 0x00, 0xD2, 0x00, 0xF2, 0x08, 0x51, 0x01, 0x92, 0x02, 0xF2, 0x02, 0x59, 0x02, 
+0xB2, 0x0B, 0x77, 0x03, 0x3B, 0x03, 0x3C, 0x03, 0x99, 0x03, 0x79, 0x03, 0x9A, 0x03, 0xBA, 0x03, 0xBA, 0x03, 0x7A, 0x03, 0x59, 0x03, 0x39, 0x03, 0xF9, 0x02, 0xB8, 0x02, 0x98, 0x02, 0x57, 0x02, 
+0x17, 0x02, 0x15, 0x02, 0x16, 0x02, 0xD5, 0x09, 0xF0, 0x02, 0x53, 0x02, 0x90, 0x01, 0x2F, 0x0A, 0x34, 0x85, 0x00, 0x00, 0x59, 0x04, 0x79, 0x04, 0x17, 0x04, 0x18, 0x04, 0x3A, 0x04, 0xF7, 0x03, 
+0x39, 0x04, 0x38, 0x04, 0x19, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x34, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0xF7, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0xF8, 0x03, 0x19, 0x04, 0xF8, 0x0B, 0x63, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xEC, 0x00, 0x0F, 0x01, 0x31, 0x01, 0x15, 0x01, 0x75, 0x01, 0x56, 0x02, 0xAA, 0x03, 
+0x26, 0x0C, 0x65, 0x04, 0x87, 0x04, 0xAC, 0x04, 0x35, 0x04, 0x5B, 0x03, 0x19, 0x03, 0x57, 0x03, 0x18, 0x0B, 0x39, 0x03, 0x19, 0x03, 0xD9, 0x02, 0xB8, 0x02, 0x98, 0x02, 0x77, 0x02, 0x57, 0x02, 
+0x36, 0x02, 0x17, 0x0A, 0x35, 0x02, 0xB4, 0x01, 0xF4, 0x01, 0x92, 0x01, 0x11, 0x02, 0x2F, 0x01, 0x00, 0x00, 0x44, 0x00, 0xD6, 0x03, 0x58, 0x04, 0x18, 0x04, 0x18, 0x0C, 0x3A, 0x04, 0x37, 0x04, 
+0xBA, 0x04, 0x38, 0x04, 0x19, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x34, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0xF7, 0x03, 0x18, 0x04, 0xD7, 0x03, 0xF8, 0x03, 0x39, 0x04, 0xD6, 0x03, 0xD5, 0x1B, 0x00, 0x00, 0x8E, 0x11, 0xF0, 0x00, 0xF3, 0x00, 0x12, 0x01, 0x73, 0x09, 0x53, 0x01, 0xD7, 0x01, 0x07, 0x0C, 
+0x05, 0x04, 0x06, 0x04, 0x69, 0x04, 0x28, 0x0D, 0x28, 0x0D, 0x2E, 0x04, 0x76, 0x03, 0x1A, 0x03, 0xB9, 0x02, 0xD8, 0x02, 0xD8, 0x02, 0xB8, 0x02, 0x97, 0x02, 0x97, 0x02, 0x97, 0x02, 0x76, 0x02, 
+0x56, 0x02, 0x35, 0x02, 0x34, 0x02, 0x35, 0x02, 0x92, 0x01, 0x72, 0x01, 0x52, 0x02, 0xD0, 0x21, 0x00, 0x00, 0xD6, 0x13, 0x99, 0x04, 0x58, 0x04, 0xF8, 0x03, 0x18, 0x0C, 0x3A, 0x04, 0x18, 0x04, 
+0xF8, 0x03, 0x38, 0x04, 0x19, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x34, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0xF7, 0x03, 0xD7, 0x03, 0x39, 0x04, 0x18, 0x04, 0xD6, 0x03, 0x16, 0x0C, 0x3B, 0x04, 0x20, 0x00, 0x76, 0x7C, 0x52, 0x11, 0xB0, 0x00, 0x70, 0x01, 0x52, 0x01, 0x93, 0x01, 0x50, 0x02, 0x85, 0x03, 
+0xC6, 0x03, 0xA7, 0x03, 0xC7, 0x03, 0x67, 0x04, 0xE7, 0x04, 0xE8, 0x04, 0xEB, 0x0C, 0x50, 0x0C, 0x15, 0x03, 0xB8, 0x02, 0x98, 0x02, 0x98, 0x02, 0x97, 0x02, 0x97, 0x02, 0x96, 0x02, 0x76, 0x02, 
+0x75, 0x02, 0x56, 0x02, 0x73, 0x02, 0xF3, 0x01, 0x33, 0x02, 0xB3, 0x01, 0x72, 0x02, 0xB5, 0x84, 0x01, 0x00, 0x3B, 0x04, 0xF8, 0x03, 0x38, 0x04, 0x3A, 0x04, 0x18, 0x04, 0x39, 0x04, 0x58, 0x04, 
+0x39, 0x0C, 0x38, 0x04, 0x19, 0x04, 0x39, 0x04, 0x58, 0x04, 0x39, 0x04, 0x35, 0x03, 0x75, 0xB5, 0x5C, 0xE7, 0x5C, 0xDF, 0x75, 0xAD, 0x34, 0x03, 0x17, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0xF7, 0x03, 0xF7, 0x03, 0xD7, 0x03, 0x1A, 0x04, 0x17, 0x0C, 0xF9, 0x03, 0xF7, 0x03, 0x01, 0x00, 0x00, 0x00, 0x0E, 0x01, 0xF1, 0x10, 0x11, 0x01, 0x12, 0x01, 0xD3, 0x01, 0x0A, 0x03, 0x47, 0x0B, 
+0xE5, 0x02, 0x85, 0x03, 0x68, 0x03, 0xE7, 0x0B, 0x07, 0x04, 0x0B, 0x04, 0xC8, 0x04, 0x89, 0x04, 0x74, 0x03, 0xB7, 0x0A, 0x98, 0x0A, 0xD7, 0x12, 0xD7, 0x02, 0x16, 0x03, 0xB6, 0x02, 0xD6, 0x0A, 
+0xB5, 0x02, 0x55, 0x02, 0x75, 0x0A, 0x73, 0x02, 0x74, 0x02, 0x55, 0x02, 0xAE, 0x01, 0x01, 0x08, 0x00, 0x00, 0x39, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xF8, 0x03, 0x18, 0x04, 0x38, 0x04, 
+0x38, 0x04, 0x18, 0x04, 0x38, 0x04, 0x59, 0x04, 0x38, 0x0C, 0xF8, 0x03, 0x76, 0x03, 0x75, 0xAD, 0x1C, 0xE7, 0x3C, 0xE7, 0x54, 0xAD, 0x14, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF7, 0x03, 
+0xF7, 0x03, 0xF8, 0x0B, 0xD9, 0x03, 0x97, 0x03, 0xF6, 0x03, 0xD7, 0x03, 0x39, 0x04, 0x36, 0x04, 0x00, 0x00, 0xB4, 0x84, 0x34, 0x02, 0xB2, 0x01, 0x35, 0x02, 0x14, 0x02, 0x11, 0x13, 0x66, 0x03, 
+0x87, 0x03, 0x26, 0x03, 0x46, 0x03, 0xC6, 0x03, 0xC7, 0x03, 0xA7, 0x03, 0x07, 0x04, 0x48, 0x0C, 0x4B, 0x04, 0xAC, 0x04, 0x12, 0x04, 0xD4, 0x0B, 0x97, 0x0B, 0x37, 0x0B, 0xD8, 0x0A, 0xD5, 0x0A, 
+0xD6, 0x02, 0xD4, 0x02, 0x55, 0x0A, 0x16, 0x03, 0xB4, 0x02, 0x92, 0x02, 0x55, 0x95, 0x02, 0x00, 0x36, 0x04, 0xF8, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 
+0x18, 0x04, 0x38, 0x04, 0x18, 0x04, 0x18, 0x04, 0xD7, 0x03, 0x97, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3D, 0xE7, 0x3D, 0xE7, 0x55, 0xB5, 0x14, 0x03, 0xF8, 0x03, 0x17, 0x04, 0xF8, 0x03, 0xD7, 0x03, 
+0xF8, 0x03, 0x17, 0x04, 0x39, 0x04, 0x77, 0x04, 0xF7, 0x03, 0x16, 0x04, 0xD9, 0x03, 0xDA, 0x03, 0x20, 0x00, 0x20, 0x00, 0x4E, 0x2A, 0xB4, 0x01, 0x10, 0x02, 0x13, 0x02, 0x33, 0x02, 0x0C, 0x04, 
+0x88, 0x03, 0x27, 0x0B, 0x26, 0x03, 0x67, 0x03, 0xA6, 0x03, 0xA6, 0x03, 0xA8, 0x03, 0x0C, 0x0C, 0x4C, 0x04, 0xAC, 0x04, 0xAC, 0x04, 0xEA, 0x04, 0x29, 0x05, 0xD3, 0x03, 0x55, 0x0B, 0xF7, 0x0A, 
+0xF7, 0x02, 0x37, 0x03, 0xF7, 0x02, 0xB4, 0x02, 0x59, 0x0B, 0x32, 0x33, 0x20, 0x00, 0x20, 0x00, 0x39, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 
+0x18, 0x04, 0x18, 0x04, 0xD7, 0x03, 0xB7, 0x03, 0x75, 0x03, 0x56, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x5D, 0xE7, 0x55, 0xAD, 0xF4, 0x02, 0xF8, 0x03, 0x17, 0x04, 0xF8, 0x03, 0xD8, 0x03, 
+0x18, 0x04, 0xD7, 0x13, 0xD8, 0x03, 0x58, 0x04, 0xD6, 0x03, 0x17, 0x04, 0x39, 0x04, 0xF7, 0x03, 0x36, 0x04, 0x20, 0x00, 0x40, 0x08, 0xAF, 0x11, 0xF5, 0x01, 0x13, 0x02, 0xD3, 0x01, 0x97, 0x0A, 
+0x27, 0x04, 0x07, 0x04, 0xA8, 0x03, 0x69, 0x03, 0xA8, 0x03, 0xE7, 0x03, 0x27, 0x04, 0x48, 0x04, 0x28, 0x04, 0x6B, 0x04, 0xCA, 0x04, 0xEE, 0x04, 0xF0, 0x0C, 0x97, 0x03, 0x77, 0x03, 0x97, 0x03, 
+0xB5, 0x03, 0x74, 0x0B, 0x74, 0x03, 0xFA, 0x0B, 0x92, 0x0A, 0x01, 0x00, 0x20, 0x00, 0x18, 0x04, 0x98, 0x0B, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0x18, 0x04, 0xF8, 0x03, 
+0xF8, 0x03, 0xB6, 0x03, 0x76, 0x03, 0x56, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x5D, 0xE7, 0x55, 0xAD, 0x14, 0x03, 0xF8, 0x03, 0x17, 0x04, 0xF8, 0x03, 0xD8, 0x03, 
+0xF7, 0x03, 0xD8, 0x03, 0x17, 0x04, 0xF7, 0x03, 0x77, 0x04, 0xD8, 0x03, 0xB8, 0x03, 0xF5, 0x0B, 0xFA, 0x03, 0xF9, 0x0B, 0x00, 0x00, 0x20, 0x00, 0x4F, 0x11, 0xF3, 0x01, 0xD2, 0x01, 0xD0, 0x01, 
+0xB4, 0x0A, 0x2A, 0x04, 0x69, 0x04, 0x29, 0x04, 0x0B, 0x04, 0x2A, 0x04, 0x48, 0x04, 0x6A, 0x04, 0x4C, 0x04, 0xEE, 0x04, 0x0D, 0x05, 0x2F, 0x05, 0x38, 0x04, 0xD7, 0x03, 0xBA, 0x03, 0x18, 0x04, 
+0xF8, 0x03, 0x18, 0x04, 0x37, 0x04, 0x54, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x37, 0x04, 0x1B, 0x04, 0x18, 0x04, 0x18, 0x04, 0x38, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF8, 0x03, 0xB7, 0x03, 
+0x97, 0x03, 0x55, 0x03, 0x35, 0x03, 0x55, 0x03, 0x35, 0x0B, 0x36, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xDF, 0x75, 0xAD, 0x15, 0x03, 0x18, 0x04, 0x17, 0x04, 0x18, 0x04, 0xF7, 0x03, 
+0xF7, 0x03, 0xF8, 0x03, 0xF7, 0x03, 0xD6, 0x0B, 0x16, 0x04, 0xD8, 0x03, 0x19, 0x04, 0x39, 0x0C, 0xF8, 0x03, 0xF6, 0x03, 0x18, 0x04, 0x00, 0x08, 0x20, 0x00, 0x8F, 0x09, 0x73, 0x02, 0x34, 0x02, 
+0xD2, 0x01, 0xB5, 0x02, 0x4E, 0x04, 0xCC, 0x04, 0xAF, 0x04, 0x8B, 0x04, 0x68, 0x04, 0xCC, 0x04, 0x0C, 0x05, 0x2E, 0x0D, 0x2C, 0x05, 0xF0, 0x04, 0xF9, 0x03, 0x58, 0x04, 0x5A, 0x04, 0x9A, 0x04, 
+0x79, 0x04, 0x5B, 0x04, 0x55, 0x13, 0x20, 0x00, 0x20, 0x00, 0x18, 0x04, 0x39, 0x04, 0xD8, 0x03, 0x15, 0x04, 0x38, 0x04, 0x38, 0x04, 0x18, 0x04, 0xF7, 0x03, 0xD7, 0x03, 0x96, 0x03, 0x55, 0x03, 
+0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xB5, 0x14, 0x03, 0xD7, 0x03, 0xD6, 0x03, 0xF8, 0x03, 0xF8, 0x03, 
+0xD7, 0x03, 0x18, 0x04, 0xF7, 0x03, 0xF7, 0x0B, 0x97, 0x03, 0xF7, 0x03, 0x38, 0x04, 0x98, 0x03, 0x17, 0x04, 0xFA, 0x13, 0x97, 0x03, 0x56, 0x04, 0x21, 0x00, 0x20, 0x00, 0xD0, 0x42, 0xD1, 0x01, 
+0x30, 0x02, 0xD2, 0x01, 0xAB, 0x03, 0x8A, 0x04, 0xAF, 0x04, 0xCE, 0x0C, 0xAA, 0x04, 0x0C, 0x0D, 0x4D, 0x05, 0x71, 0x04, 0x73, 0x04, 0xF9, 0x03, 0xD9, 0x03, 0x59, 0x0C, 0xB7, 0x04, 0x7A, 0x04, 
+0x9A, 0x14, 0xF3, 0x4B, 0x00, 0x08, 0x40, 0x00, 0x19, 0x0C, 0xD8, 0x03, 0xF8, 0x03, 0x1B, 0x0C, 0x17, 0x04, 0x18, 0x04, 0xF7, 0x03, 0xB7, 0x03, 0x76, 0x03, 0x55, 0x03, 0x35, 0x03, 0x35, 0x03, 
+0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x55, 0xB5, 0xD4, 0x02, 0x76, 0x03, 0x75, 0x03, 0xB7, 0x03, 0xD7, 0x03, 
+0xD7, 0x03, 0x16, 0x04, 0xF8, 0x03, 0xD8, 0x03, 0xF9, 0x03, 0xF7, 0x03, 0xF6, 0x0B, 0x17, 0x04, 0xD8, 0x0B, 0xD7, 0x03, 0x56, 0x04, 0xD9, 0x03, 0xD7, 0x03, 0x21, 0x00, 0x00, 0x08, 0x73, 0x84, 
+0xCE, 0x09, 0xF4, 0x01, 0xEF, 0x0A, 0x69, 0x03, 0x0A, 0x04, 0xAD, 0x04, 0xEA, 0x04, 0x0C, 0x05, 0xB2, 0x04, 0x56, 0x03, 0xB8, 0x03, 0xF8, 0x03, 0x78, 0x04, 0xB9, 0x04, 0x59, 0x04, 0xD5, 0x1B, 
+0x51, 0x5C, 0x00, 0x00, 0x20, 0x00, 0x37, 0x04, 0xD8, 0x03, 0x17, 0x14, 0x19, 0x04, 0xD8, 0x03, 0x17, 0x04, 0x76, 0x03, 0x55, 0x03, 0x55, 0x03, 0x35, 0x03, 0x15, 0x03, 0x35, 0x03, 0x35, 0x03, 
+0x55, 0x03, 0x15, 0x03, 0x15, 0x03, 0x35, 0x03, 0x35, 0x03, 0x56, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x1D, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 
+0x14, 0x03, 0xB6, 0x03, 0xB6, 0x03, 0xD6, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0xF7, 0x03, 0x17, 0x04, 0xD9, 0x03, 0xF8, 0x03, 0xB5, 0x13, 0x19, 0x04, 0xD6, 0x03, 0x68, 0x01, 0x00, 0x10, 
+0x00, 0x00, 0xD6, 0x8C, 0xEC, 0x42, 0xA5, 0x01, 0xA8, 0x02, 0x6D, 0x03, 0xB1, 0x03, 0xB5, 0x0B, 0x35, 0x03, 0x77, 0x0B, 0xF8, 0x03, 0xF7, 0x03, 0xB2, 0x02, 0x13, 0x3C, 0x72, 0x84, 0x00, 0x00, 
+0x20, 0x00, 0xED, 0x01, 0xD6, 0x0B, 0x37, 0x04, 0x18, 0x04, 0xB7, 0x03, 0x15, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 
+0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x34, 0x03, 0x36, 0x03, 0x15, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 
+0x14, 0x03, 0xF4, 0x02, 0x14, 0x03, 0x34, 0x03, 0x55, 0x03, 0x76, 0x03, 0xB6, 0x03, 0xD7, 0x03, 0xD7, 0x03, 0x15, 0x14, 0x39, 0x04, 0xB7, 0x03, 0xD7, 0x03, 0x18, 0x04, 0xD8, 0x03, 0xF6, 0x13, 
+0x46, 0x01, 0x01, 0x00, 0x00, 0x00, 0x22, 0x08, 0xA4, 0x10, 0xB5, 0x84, 0xF3, 0x63, 0xB4, 0x53, 0x15, 0x54, 0x55, 0x54, 0xD5, 0x7C, 0xC3, 0x18, 0x20, 0x00, 0x00, 0x00, 0x01, 0x08, 0x4B, 0x01, 
+0xD7, 0x03, 0x54, 0x03, 0x76, 0x03, 0x14, 0x03, 0x56, 0x03, 0x36, 0x03, 0x56, 0x03, 0xF3, 0x02, 0x34, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 
+0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x34, 0x03, 0x36, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 
+0xF4, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x15, 0x03, 0x35, 0x03, 0x14, 0x03, 0xB0, 0x02, 0x85, 0x00, 0x42, 0x00, 0x81, 0x00, 0x2C, 0x02, 0x99, 0x03, 
+0x58, 0x04, 0xAE, 0x0A, 0xE6, 0x00, 0x21, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x70, 0x02, 0xF5, 0x02, 0x35, 0x03, 0x15, 0x03, 
+0x2A, 0x02, 0x00, 0x00, 0x62, 0x08, 0x42, 0x00, 0x68, 0x01, 0x54, 0x03, 0x15, 0x03, 0xF4, 0x02, 0x36, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 
+0x35, 0x03, 0x35, 0x03, 0x15, 0x03, 0x35, 0x03, 0x34, 0x03, 0x35, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 
+0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0x35, 0x0B, 0x02, 0x00, 0xCF, 0x93, 0x7E, 0xEF, 0x75, 0xBD, 0x01, 0x00, 0xD3, 0x02, 
+0x14, 0x03, 0x00, 0x00, 0x70, 0x94, 0xBD, 0xFF, 0x75, 0xB5, 0x00, 0x08, 0x00, 0x00, 0xF4, 0x9C, 0xBF, 0xF7, 0xFD, 0xEE, 0x59, 0xC6, 0x6B, 0x7B, 0x82, 0x00, 0xC6, 0x00, 0xF2, 0x02, 0x35, 0x0B, 
+0x00, 0x08, 0x75, 0xA5, 0x9E, 0xEF, 0x75, 0xB5, 0x01, 0x00, 0x14, 0x13, 0x35, 0x03, 0x13, 0x03, 0xD2, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x35, 0x03, 0x35, 0x03, 0x35, 0x03, 
+0x35, 0x03, 0x14, 0x03, 0x15, 0x03, 0x35, 0x03, 0x34, 0x03, 0x35, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0xF4, 0x02, 0x14, 0x03, 0x13, 0x03, 
+0xF4, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x35, 0x03, 0x01, 0x00, 0x7D, 0xF7, 0xFF, 0xF7, 0xBE, 0xFF, 0x00, 0x00, 0x14, 0x03, 
+0x34, 0x0B, 0x20, 0x00, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x40, 0x00, 0xDE, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFA, 0xDE, 0x83, 0x29, 0x03, 0x00, 0xD3, 0x0A, 
+0x00, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0x00, 0xF5, 0x02, 0x16, 0x03, 0x76, 0x03, 0x55, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x14, 0x03, 0x35, 0x03, 0x35, 0x03, 0x34, 0x03, 0x35, 0x03, 0x35, 0x03, 0x75, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0xF4, 0x02, 0x14, 0x03, 0x13, 0x03, 
+0xF4, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0xF3, 0x02, 0xF2, 0x02, 0x61, 0x00, 0xDE, 0xFF, 0xFE, 0xF7, 0xFE, 0xF7, 0x00, 0x00, 0xF4, 0x0A, 
+0xF3, 0x02, 0x01, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xBE, 0xF7, 0xFE, 0xFF, 0xDF, 0xFF, 0x9D, 0xF7, 0x46, 0x29, 0x89, 0x01, 
+0x20, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x55, 0x03, 0x14, 0x03, 0xD3, 0x02, 0xF3, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x14, 0x03, 0x15, 0x03, 0x35, 0x03, 0x34, 0x03, 0x35, 0x03, 0x34, 0x03, 0x95, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0xF4, 0x02, 0x14, 0x03, 0xF3, 0x02, 
+0xF4, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x55, 0x03, 0x00, 0x08, 0xFF, 0xFF, 0xFE, 0xEF, 0xDF, 0xFF, 0x00, 0x00, 0xF4, 0x02, 
+0x16, 0x03, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xDD, 0xF7, 0xFF, 0xFF, 0xA3, 0x10, 0xB6, 0xB5, 0xDF, 0xFF, 0xBF, 0xFF, 0x56, 0xA5, 0xA3, 0x00, 
+0x00, 0x08, 0xFE, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0x00, 0x08, 0x16, 0x03, 0x15, 0x03, 0x55, 0x03, 0x35, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x14, 0x03, 0x15, 0x03, 0x35, 0x03, 0x34, 0x03, 0x35, 0x03, 0x34, 0x03, 0x95, 0xAD, 0x3C, 0xE7, 0x3C, 0xE7, 0x75, 0xAD, 0x14, 0x03, 0x14, 0x03, 0xF4, 0x02, 0x14, 0x03, 0xF3, 0x02, 
+0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0x33, 0x03, 0x01, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xF7, 0x00, 0x00, 0x13, 0x03, 
+0x13, 0x03, 0x82, 0x08, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xDF, 0xFF, 0xDD, 0xFF, 0x01, 0x00, 0xA4, 0x10, 0xFD, 0xEF, 0xDD, 0xFF, 0xDE, 0xEF, 0x41, 0x00, 
+0x20, 0x00, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0x35, 0x03, 0x54, 0x03, 0xF3, 0x02, 0x16, 0x13, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x14, 0x03, 0x15, 0x03, 0x35, 0x03, 0x34, 0x03, 0x55, 0x03, 0x34, 0x03, 0x95, 0xAD, 0x5C, 0xE7, 0x3D, 0xEF, 0xB6, 0xB5, 0x35, 0x03, 0x13, 0x03, 0xF3, 0x02, 0xF5, 0x02, 0xD3, 0x02, 
+0xF3, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xD3, 0x02, 0x00, 0x08, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x08, 0xF5, 0x02, 
+0xF2, 0x0A, 0xE3, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0x5B, 0xFD, 0xFF, 0xBF, 0xF7, 0x1C, 0xE7, 0x62, 0x00, 
+0x01, 0x00, 0xFF, 0xFF, 0xBE, 0xFF, 0xDF, 0xFF, 0x20, 0x08, 0x35, 0x03, 0xF3, 0x02, 0x76, 0x03, 0xF4, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x13, 0x03, 0x13, 0x03, 0x35, 0x03, 0x14, 0x03, 0x34, 0x03, 0x54, 0x03, 0xD6, 0xB5, 0x7D, 0xE7, 0x7E, 0xEF, 0xF7, 0xBD, 0x33, 0x13, 0xF3, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xD3, 0x02, 
+0x13, 0x03, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0x35, 0x03, 0x20, 0x00, 0xDF, 0xEF, 0xFF, 0xFF, 0xBD, 0xF7, 0x03, 0x11, 0xD1, 0x02, 
+0x6E, 0x02, 0x07, 0x4A, 0xDF, 0xFF, 0xFF, 0xFF, 0x99, 0xD6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDE, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xBB, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0x8D, 0x7B, 0x82, 0x00, 
+0x21, 0x00, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF3, 0x02, 0x74, 0x13, 0xF3, 0x02, 0x34, 0x13, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x34, 0x03, 0x34, 0x03, 0x15, 0x03, 0x35, 0x03, 0x14, 0x03, 0x33, 0x13, 0x17, 0xBE, 0x7D, 0xEF, 0x7D, 0xF7, 0x7A, 0xCE, 0x71, 0x3B, 0x14, 0x03, 0xD3, 0x02, 0x14, 0x03, 0xD2, 0x02, 
+0xF4, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0x15, 0x03, 0x42, 0x00, 0xBB, 0xD6, 0xFF, 0xFF, 0xFE, 0xFF, 0xEC, 0x4A, 0xC5, 0x00, 
+0x27, 0x01, 0xAE, 0x73, 0xBE, 0xFF, 0xFE, 0xFF, 0x91, 0x9C, 0x28, 0x01, 0x40, 0x08, 0xBE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x5D, 0xDF, 0xEC, 0x5A, 0x00, 0x00, 0x92, 0x02, 
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x00, 0x00, 0x15, 0x03, 0x15, 0x03, 0x15, 0x03, 0x16, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x15, 0x03, 0xF4, 0x02, 0x35, 0x03, 0x14, 0x03, 0x55, 0x03, 0x71, 0x3B, 0x9A, 0xCE, 0x7D, 0xF7, 0x9D, 0xF7, 0xFC, 0xD6, 0x73, 0x7C, 0x14, 0x03, 0xF4, 0x02, 0x14, 0x0B, 0xD2, 0x02, 
+0xF4, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0x13, 0x13, 0x07, 0x01, 0xB2, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xCE, 0x03, 0x29, 
+0x61, 0x08, 0x9B, 0xCE, 0xFF, 0xF7, 0xDF, 0xFF, 0x49, 0x42, 0x2E, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0xFF, 0xFF, 0xF7, 0xBD, 0x03, 0x21, 0x20, 0x08, 0xF4, 0x02, 
+0x00, 0x08, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xEF, 0x20, 0x08, 0x42, 0x00, 0x00, 0x08, 0x41, 0x00, 0x47, 0x09, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0xF4, 0x02, 0x14, 0x03, 0x34, 0x03, 0x35, 0x03, 0x35, 0x03, 0x93, 0x74, 0x1C, 0xDF, 0x9D, 0xFF, 0xDF, 0xFF, 0x5E, 0xDF, 0xF7, 0xBD, 0x13, 0x0B, 0x14, 0x03, 0xD3, 0x02, 0x14, 0x03, 
+0xF4, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xD2, 0x02, 0xEC, 0x01, 0x64, 0x29, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xF7, 0xDD, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF8, 0xCD, 0x61, 0x00, 0x13, 0x0B, 0x00, 0x00, 0xFF, 0xF7, 0xBF, 0xFF, 0xDF, 0xFF, 0xE7, 0x39, 0x16, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x4A, 0x01, 0x00, 
+0x41, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xF7, 0xDE, 0xFF, 0xD7, 0xBD, 0x62, 0x00, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0xF5, 0x02, 0x55, 0x03, 0x13, 0x03, 0x55, 0x03, 0x33, 0x0B, 0xF7, 0xBD, 0x5E, 0xE7, 0xDE, 0xFF, 0xFF, 0xFF, 0xBF, 0xEF, 0x99, 0xD6, 0xF4, 0x4B, 0xD2, 0x02, 0xF2, 0x02, 0xD3, 0x02, 
+0x15, 0x03, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0x14, 0x03, 0x13, 0x03, 0x00, 0x00, 0xEF, 0x7B, 0xFE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0xDF, 0xFF, 0xDC, 0xFF, 0x85, 0x41, 0x89, 0x01, 0xD3, 0x02, 0x00, 0x08, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x21, 0x00, 0x92, 0x94, 0xDF, 0xF7, 0x7D, 0xF7, 0x40, 0x10, 
+0x20, 0x00, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0x01, 0x00, 0xF4, 0x02, 0xF4, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x35, 0x03, 0x34, 0x03, 0x13, 0x03, 0x13, 0x03, 0x14, 0x4C, 0x99, 0xD6, 0xBF, 0xEF, 0xDE, 0xFF, 0xFF, 0xF7, 0xDF, 0xF7, 0xFB, 0xE6, 0xB7, 0xA5, 0x53, 0x1B, 0x12, 0x0B, 0xB2, 0x02, 
+0x14, 0x03, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xB3, 0x02, 0x4E, 0x1A, 0x23, 0x00, 0xCB, 0x52, 0xF8, 0xBD, 0x9E, 0xFF, 
+0xBF, 0xF7, 0x39, 0xBE, 0xC6, 0x39, 0x21, 0x00, 0xD3, 0x02, 0x55, 0x03, 0x21, 0x00, 0x33, 0xB5, 0xBE, 0xEF, 0x95, 0xC5, 0x20, 0x00, 0xED, 0x01, 0x00, 0x00, 0x50, 0x7C, 0x38, 0xC6, 0x63, 0x00, 
+0x20, 0x00, 0x73, 0x84, 0xFE, 0xFF, 0xDD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xD8, 0xB5, 0x41, 0x00, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x55, 0x03, 0xF3, 0x02, 0x33, 0x0B, 0x73, 0x1B, 0xB7, 0xAD, 0xFB, 0xE6, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xDE, 0xFF, 0xBE, 0xFF, 0xDA, 0xDE, 0x97, 0x4C, 0xF2, 0x0A, 0xF3, 0x02, 
+0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0x35, 0x03, 0x14, 0x03, 0xF3, 0x02, 0x8E, 0x0A, 0x07, 0x01, 0x63, 0x00, 0x20, 0x08, 
+0x00, 0x00, 0x20, 0x00, 0x08, 0x01, 0xD1, 0x02, 0x15, 0x03, 0xD2, 0x0A, 0xCB, 0x01, 0x24, 0x00, 0x00, 0x00, 0x42, 0x00, 0xAA, 0x01, 0xF2, 0x02, 0x2E, 0x0A, 0x27, 0x01, 0x27, 0x01, 0x28, 0x01, 
+0x2C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x08, 0x01, 0x00, 0x26, 0x09, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0xF2, 0x0A, 0x97, 0x54, 0xBA, 0xE6, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xBE, 0xEF, 0x9E, 0xF7, 0x59, 0xC6, 0xB1, 0x4B, 0xD2, 0x02, 
+0x36, 0x03, 0xF4, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0xF3, 0x02, 0x13, 0x03, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 
+0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0x14, 0x03, 0x14, 0x03, 
+0x14, 0x03, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x34, 0x03, 0x14, 0x03, 0x14, 0x03, 0x15, 0x03, 0x15, 0x03, 0x15, 0x03, 0x15, 0x03, 
+0xF3, 0x02, 0x37, 0x03, 0xD2, 0x02, 0xF2, 0x4B, 0x59, 0xBE, 0x9D, 0xF7, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xFF, 0xBE, 0xF7, 0x1C, 0xDF, 0x3A, 0xAE, 0xB3, 0x3B, 
+0xD2, 0x0A, 0xF3, 0x02, 0xD2, 0x02, 0xF3, 0x02, 0x34, 0x03, 0xF3, 0x02, 0xB2, 0x02, 0xD3, 0x02, 0xF3, 0x02, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 
+0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 
+0x13, 0x03, 0x13, 0x03, 0x34, 0x03, 0x34, 0x03, 0x34, 0x03, 0x34, 0x03, 0x34, 0x03, 0x34, 0x03, 0x34, 0x03, 0xF3, 0x02, 0xF3, 0x02, 0xD3, 0x02, 0xF3, 0x02, 0x34, 0x03, 0xF4, 0x02, 0xD3, 0x02, 
+0x34, 0x03, 0xD2, 0x02, 0xF4, 0x43, 0xF9, 0xAD, 0x3C, 0xE7, 0xBE, 0xF7, 0xFF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x3D, 0xE7, 0x1A, 0xB6, 
+0xF2, 0x4B, 0xD1, 0x02, 0x12, 0x0B, 0xF2, 0x02, 0xD2, 0x02, 0x14, 0x0B, 0x15, 0x03, 0x21, 0x80, 0xF4, 0x02, 0x1F, 0x01, 0x36, 0x03, 0x15, 0x03, 0x14, 0x03, 0x14, 0x03, 0xF3, 0x02, 0x13, 0x03, 
+0x33, 0x0B, 0xD1, 0x02, 0xF2, 0x53, 0x3A, 0xAE, 0x5D, 0xEF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBE, 0xFF, 
+0x7D, 0xEF, 0x59, 0xBE, 0x77, 0x4C, 0x53, 0x1B, 0xD2, 0x02, 0x14, 0x03, 0xD3, 0x02, 0xB3, 0x02, 0xD3, 0x02, 0xF3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 
+0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 
+0xD3, 0x02, 0xD3, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF4, 0x02, 0xF3, 0x02, 0x14, 0x03, 0xF4, 0x02, 0x14, 0x03, 0xF4, 0x02, 0xB2, 0x02, 
+0x53, 0x1B, 0x98, 0x4C, 0x39, 0xC6, 0x5D, 0xE7, 0xFE, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9D, 0xEF, 0x9E, 0xF7, 0x9A, 0xDE, 0xB7, 0xA5, 0xF3, 0x4B, 0xD2, 0x0A, 0x14, 0x03, 0x35, 0x03, 0xF3, 0x02, 0xD2, 0x02, 0x13, 0x03, 0x13, 0x03, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 
+0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 
+0x13, 0x03, 0x13, 0x03, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0xF3, 0x02, 0x14, 0x03, 0x14, 0x03, 0xF3, 0x0A, 0x15, 0x4C, 
+0xB8, 0xA5, 0x99, 0xD6, 0x9E, 0xF7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xF7, 0xDF, 0xFF, 0xBE, 0xFF, 0x1B, 0xEF, 0xB9, 0xDE, 0x17, 0xBE, 0x73, 0x7C, 0x30, 0x33, 0xF2, 0x0A, 0x14, 0x03, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xD3, 0x02, 
+0xD3, 0x02, 0xD3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xD3, 0x02, 0xD3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 
+0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0xF3, 0x02, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x14, 0x03, 0x12, 0x13, 0x71, 0x3B, 0x93, 0x7C, 0xF7, 0xBD, 0x99, 0xD6, 
+0xFB, 0xEE, 0xBE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xBE, 0xEF, 0x5D, 0xDF, 0x1D, 0xDF, 0xBA, 0xD6, 0x17, 0xC6, 0xB6, 0xB5, 0x96, 0xB5, 0x96, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 
+0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 0x76, 0xB5, 
+0x76, 0xB5, 0x76, 0xB5, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0xD6, 0xBD, 0x17, 0xBE, 0x9A, 0xCE, 0x1C, 0xDF, 0x5E, 0xDF, 0xBF, 0xEF, 
+0xDF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xBE, 0xFF, 0x9E, 0xF7, 0x7E, 0xF7, 0x5E, 0xEF, 0x1F, 0x80, 0x5C, 0xE7, 0x0F, 0x00, 0x5E, 0xEF, 0x7E, 0xF7, 0x9E, 0xF7, 
+0xBE, 0xFF, 0xDF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+};
@@ -25,7 +25,8 @@ C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Projects/ST2
 C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Projects/ST25-Discovery/Demonstrations/ST25R3916Demo/Src/usb_hid_stream_driver.c \
 C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Projects/ST25-Discovery/Demonstrations/ST25R3916Demo/Src/usbd_conf.c \
 C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Projects/ST25-Discovery/Demonstrations/ST25R3916Demo/Src/usbd_customhid_if.c \
-C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Projects/ST25-Discovery/Demonstrations/ST25R3916Demo/Src/usbd_desc.c 
+C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Projects/ST25-Discovery/Demonstrations/ST25R3916Demo/Src/usbd_desc.c \
+C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Projects/ST25-Discovery/Demonstrations/ST25R3916Demo/Src/usbd_storage.c 
 
 OBJS += \
 ./Example/Menu_config.o \
@@ -48,7 +49,8 @@ OBJS += \
 ./Example/usb_hid_stream_driver.o \
 ./Example/usbd_conf.o \
 ./Example/usbd_customhid_if.o \
-./Example/usbd_desc.o 
+./Example/usbd_desc.o \
+./Example/usbd_storage.o 
 
 C_DEPS += \
 ./Example/Menu_config.d \
@@ -71,7 +73,8 @@ C_DEPS += \
 ./Example/usb_hid_stream_driver.d \
 ./Example/usbd_conf.d \
 ./Example/usbd_customhid_if.d \
-./Example/usbd_desc.d 
+./Example/usbd_desc.d \
+./Example/usbd_storage.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -117,11 +120,13 @@ Example/usbd_customhid_if.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Example/usbd_desc.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Projects/ST25-Discovery/Demonstrations/ST25R3916Demo/Src/usbd_desc.c Example/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Example/usbd_storage.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Projects/ST25-Discovery/Demonstrations/ST25R3916Demo/Src/usbd_storage.c Example/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 
 clean: clean-Example
 
 clean-Example:
-	-$(RM) ./Example/Menu_config.cyclo ./Example/Menu_config.d ./Example/Menu_config.o ./Example/Menu_config.su ./Example/Menu_definition.cyclo ./Example/Menu_definition.d ./Example/Menu_definition.o ./Example/Menu_definition.su ./Example/aat.cyclo ./Example/aat.d ./Example/aat.o ./Example/aat.su ./Example/boardcheck.cyclo ./Example/boardcheck.d ./Example/boardcheck.o ./Example/boardcheck.su ./Example/card_emulation.cyclo ./Example/card_emulation.d ./Example/card_emulation.o ./Example/card_emulation.su ./Example/exampleRfalPoller.cyclo ./Example/exampleRfalPoller.d ./Example/exampleRfalPoller.o ./Example/exampleRfalPoller.su ./Example/flashl4_if.cyclo ./Example/flashl4_if.d ./Example/flashl4_if.o ./Example/flashl4_if.su ./Example/fs_api.cyclo ./Example/fs_api.d ./Example/fs_api.o ./Example/fs_api.su ./Example/jdata_conf.cyclo ./Example/jdata_conf.d ./Example/jdata_conf.o ./Example/jdata_conf.su ./Example/jpeg_decode.cyclo ./Example/jpeg_decode.d ./Example/jpeg_decode.o ./Example/jpeg_decode.su ./Example/main.cyclo ./Example/main.d ./Example/main.o ./Example/main.su ./Example/ndef_demo.cyclo ./Example/ndef_demo.d ./Example/ndef_demo.o ./Example/ndef_demo.su ./Example/p2p.cyclo ./Example/p2p.d ./Example/p2p.o ./Example/p2p.su ./Example/stm32l4xx_hal_msp.cyclo ./Example/stm32l4xx_hal_msp.d ./Example/stm32l4xx_hal_msp.o ./Example/stm32l4xx_hal_msp.su ./Example/stm32l4xx_it.cyclo ./Example/stm32l4xx_it.d ./Example/stm32l4xx_it.o ./Example/stm32l4xx_it.su ./Example/system_stm32l4xx.cyclo ./Example/system_stm32l4xx.d ./Example/system_stm32l4xx.o ./Example/system_stm32l4xx.su ./Example/usb_device.cyclo ./Example/usb_device.d ./Example/usb_device.o ./Example/usb_device.su ./Example/usb_hid_stream_driver.cyclo ./Example/usb_hid_stream_driver.d ./Example/usb_hid_stream_driver.o ./Example/usb_hid_stream_driver.su ./Example/usbd_conf.cyclo ./Example/usbd_conf.d ./Example/usbd_conf.o ./Example/usbd_conf.su ./Example/usbd_customhid_if.cyclo ./Example/usbd_customhid_if.d ./Example/usbd_customhid_if.o ./Example/usbd_customhid_if.su ./Example/usbd_desc.cyclo ./Example/usbd_desc.d ./Example/usbd_desc.o ./Example/usbd_desc.su
+	-$(RM) ./Example/Menu_config.cyclo ./Example/Menu_config.d ./Example/Menu_config.o ./Example/Menu_config.su ./Example/Menu_definition.cyclo ./Example/Menu_definition.d ./Example/Menu_definition.o ./Example/Menu_definition.su ./Example/aat.cyclo ./Example/aat.d ./Example/aat.o ./Example/aat.su ./Example/boardcheck.cyclo ./Example/boardcheck.d ./Example/boardcheck.o ./Example/boardcheck.su ./Example/card_emulation.cyclo ./Example/card_emulation.d ./Example/card_emulation.o ./Example/card_emulation.su ./Example/exampleRfalPoller.cyclo ./Example/exampleRfalPoller.d ./Example/exampleRfalPoller.o ./Example/exampleRfalPoller.su ./Example/flashl4_if.cyclo ./Example/flashl4_if.d ./Example/flashl4_if.o ./Example/flashl4_if.su ./Example/fs_api.cyclo ./Example/fs_api.d ./Example/fs_api.o ./Example/fs_api.su ./Example/jdata_conf.cyclo ./Example/jdata_conf.d ./Example/jdata_conf.o ./Example/jdata_conf.su ./Example/jpeg_decode.cyclo ./Example/jpeg_decode.d ./Example/jpeg_decode.o ./Example/jpeg_decode.su ./Example/main.cyclo ./Example/main.d ./Example/main.o ./Example/main.su ./Example/ndef_demo.cyclo ./Example/ndef_demo.d ./Example/ndef_demo.o ./Example/ndef_demo.su ./Example/p2p.cyclo ./Example/p2p.d ./Example/p2p.o ./Example/p2p.su ./Example/stm32l4xx_hal_msp.cyclo ./Example/stm32l4xx_hal_msp.d ./Example/stm32l4xx_hal_msp.o ./Example/stm32l4xx_hal_msp.su ./Example/stm32l4xx_it.cyclo ./Example/stm32l4xx_it.d ./Example/stm32l4xx_it.o ./Example/stm32l4xx_it.su ./Example/system_stm32l4xx.cyclo ./Example/system_stm32l4xx.d ./Example/system_stm32l4xx.o ./Example/system_stm32l4xx.su ./Example/usb_device.cyclo ./Example/usb_device.d ./Example/usb_device.o ./Example/usb_device.su ./Example/usb_hid_stream_driver.cyclo ./Example/usb_hid_stream_driver.d ./Example/usb_hid_stream_driver.o ./Example/usb_hid_stream_driver.su ./Example/usbd_conf.cyclo ./Example/usbd_conf.d ./Example/usbd_conf.o ./Example/usbd_conf.su ./Example/usbd_customhid_if.cyclo ./Example/usbd_customhid_if.d ./Example/usbd_customhid_if.o ./Example/usbd_customhid_if.su ./Example/usbd_desc.cyclo ./Example/usbd_desc.d ./Example/usbd_desc.o ./Example/usbd_desc.su ./Example/usbd_storage.cyclo ./Example/usbd_storage.d ./Example/usbd_storage.o ./Example/usbd_storage.su
 
 .PHONY: clean-Example
 
@@ -5,28 +5,45 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/CompositeBuilder/Src/usbd_composite_builder.c \
 C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Core/Src/usbd_core.c \
 C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Core/Src/usbd_ctlreq.c \
 C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/CustomHID/Src/usbd_customhid.c \
 C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/HID/Src/usbd_hid.c \
-C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Core/Src/usbd_ioreq.c 
+C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Core/Src/usbd_ioreq.c \
+C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/MSC/Src/usbd_msc.c \
+C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/MSC/Src/usbd_msc_bot.c \
+C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/MSC/Src/usbd_msc_data.c \
+C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/MSC/Src/usbd_msc_scsi.c 
 
 OBJS += \
+./Middleware/STM32_USB_Device_Library/usbd_composite_builder.o \
 ./Middleware/STM32_USB_Device_Library/usbd_core.o \
 ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.o \
 ./Middleware/STM32_USB_Device_Library/usbd_customhid.o \
 ./Middleware/STM32_USB_Device_Library/usbd_hid.o \
-./Middleware/STM32_USB_Device_Library/usbd_ioreq.o 
+./Middleware/STM32_USB_Device_Library/usbd_ioreq.o \
+./Middleware/STM32_USB_Device_Library/usbd_msc.o \
+./Middleware/STM32_USB_Device_Library/usbd_msc_bot.o \
+./Middleware/STM32_USB_Device_Library/usbd_msc_data.o \
+./Middleware/STM32_USB_Device_Library/usbd_msc_scsi.o 
 
 C_DEPS += \
+./Middleware/STM32_USB_Device_Library/usbd_composite_builder.d \
 ./Middleware/STM32_USB_Device_Library/usbd_core.d \
 ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.d \
 ./Middleware/STM32_USB_Device_Library/usbd_customhid.d \
 ./Middleware/STM32_USB_Device_Library/usbd_hid.d \
-./Middleware/STM32_USB_Device_Library/usbd_ioreq.d 
+./Middleware/STM32_USB_Device_Library/usbd_ioreq.d \
+./Middleware/STM32_USB_Device_Library/usbd_msc.d \
+./Middleware/STM32_USB_Device_Library/usbd_msc_bot.d \
+./Middleware/STM32_USB_Device_Library/usbd_msc_data.d \
+./Middleware/STM32_USB_Device_Library/usbd_msc_scsi.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
+Middleware/STM32_USB_Device_Library/usbd_composite_builder.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/CompositeBuilder/Src/usbd_composite_builder.c Middleware/STM32_USB_Device_Library/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Middleware/STM32_USB_Device_Library/usbd_core.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Core/Src/usbd_core.c Middleware/STM32_USB_Device_Library/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Middleware/STM32_USB_Device_Library/usbd_ctlreq.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Core/Src/usbd_ctlreq.c Middleware/STM32_USB_Device_Library/subdir.mk
@@ -37,11 +54,19 @@ Middleware/STM32_USB_Device_Library/usbd_hid.o: C:/Users/lenat/STM32CubeIDE/work
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Middleware/STM32_USB_Device_Library/usbd_ioreq.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Core/Src/usbd_ioreq.c Middleware/STM32_USB_Device_Library/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Middleware/STM32_USB_Device_Library/usbd_msc.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/MSC/Src/usbd_msc.c Middleware/STM32_USB_Device_Library/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Middleware/STM32_USB_Device_Library/usbd_msc_bot.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/MSC/Src/usbd_msc_bot.c Middleware/STM32_USB_Device_Library/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Middleware/STM32_USB_Device_Library/usbd_msc_data.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/MSC/Src/usbd_msc_data.c Middleware/STM32_USB_Device_Library/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Middleware/STM32_USB_Device_Library/usbd_msc_scsi.o: C:/Users/lenat/STM32CubeIDE/workspace_1.18.1/STEVAL-25R3916B_V2.1.0/Middlewares/ST/STM32_USB_Device_Library/Class/MSC/Src/usbd_msc_scsi.c Middleware/STM32_USB_Device_Library/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -DUSE_HAL_DRIVER -DSTM32L476xx -c -I../Core/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc -I../Drivers/STM32L4xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32L4xx/Include -I../Drivers/CMSIS/Include -Os -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 
 clean: clean-Middleware-2f-STM32_USB_Device_Library
 
 clean-Middleware-2f-STM32_USB_Device_Library:
-	-$(RM) ./Middleware/STM32_USB_Device_Library/usbd_core.cyclo ./Middleware/STM32_USB_Device_Library/usbd_core.d ./Middleware/STM32_USB_Device_Library/usbd_core.o ./Middleware/STM32_USB_Device_Library/usbd_core.su ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.cyclo ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.d ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.o ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.su ./Middleware/STM32_USB_Device_Library/usbd_customhid.cyclo ./Middleware/STM32_USB_Device_Library/usbd_customhid.d ./Middleware/STM32_USB_Device_Library/usbd_customhid.o ./Middleware/STM32_USB_Device_Library/usbd_customhid.su ./Middleware/STM32_USB_Device_Library/usbd_hid.cyclo ./Middleware/STM32_USB_Device_Library/usbd_hid.d ./Middleware/STM32_USB_Device_Library/usbd_hid.o ./Middleware/STM32_USB_Device_Library/usbd_hid.su ./Middleware/STM32_USB_Device_Library/usbd_ioreq.cyclo ./Middleware/STM32_USB_Device_Library/usbd_ioreq.d ./Middleware/STM32_USB_Device_Library/usbd_ioreq.o ./Middleware/STM32_USB_Device_Library/usbd_ioreq.su
+	-$(RM) ./Middleware/STM32_USB_Device_Library/usbd_composite_builder.cyclo ./Middleware/STM32_USB_Device_Library/usbd_composite_builder.d ./Middleware/STM32_USB_Device_Library/usbd_composite_builder.o ./Middleware/STM32_USB_Device_Library/usbd_composite_builder.su ./Middleware/STM32_USB_Device_Library/usbd_core.cyclo ./Middleware/STM32_USB_Device_Library/usbd_core.d ./Middleware/STM32_USB_Device_Library/usbd_core.o ./Middleware/STM32_USB_Device_Library/usbd_core.su ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.cyclo ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.d ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.o ./Middleware/STM32_USB_Device_Library/usbd_ctlreq.su ./Middleware/STM32_USB_Device_Library/usbd_customhid.cyclo ./Middleware/STM32_USB_Device_Library/usbd_customhid.d ./Middleware/STM32_USB_Device_Library/usbd_customhid.o ./Middleware/STM32_USB_Device_Library/usbd_customhid.su ./Middleware/STM32_USB_Device_Library/usbd_hid.cyclo ./Middleware/STM32_USB_Device_Library/usbd_hid.d ./Middleware/STM32_USB_Device_Library/usbd_hid.o ./Middleware/STM32_USB_Device_Library/usbd_hid.su ./Middleware/STM32_USB_Device_Library/usbd_ioreq.cyclo ./Middleware/STM32_USB_Device_Library/usbd_ioreq.d ./Middleware/STM32_USB_Device_Library/usbd_ioreq.o ./Middleware/STM32_USB_Device_Library/usbd_ioreq.su ./Middleware/STM32_USB_Device_Library/usbd_msc.cyclo ./Middleware/STM32_USB_Device_Library/usbd_msc.d ./Middleware/STM32_USB_Device_Library/usbd_msc.o ./Middleware/STM32_USB_Device_Library/usbd_msc.su ./Middleware/STM32_USB_Device_Library/usbd_msc_bot.cyclo ./Middleware/STM32_USB_Device_Library/usbd_msc_bot.d ./Middleware/STM32_USB_Device_Library/usbd_msc_bot.o ./Middleware/STM32_USB_Device_Library/usbd_msc_bot.su ./Middleware/STM32_USB_Device_Library/usbd_msc_data.cyclo ./Middleware/STM32_USB_Device_Library/usbd_msc_data.d ./Middleware/STM32_USB_Device_Library/usbd_msc_data.o ./Middleware/STM32_USB_Device_Library/usbd_msc_data.su ./Middleware/STM32_USB_Device_Library/usbd_msc_scsi.cyclo ./Middleware/STM32_USB_Device_Library/usbd_msc_scsi.d ./Middleware/STM32_USB_Device_Library/usbd_msc_scsi.o ./Middleware/STM32_USB_Device_Library/usbd_msc_scsi.su
 
 .PHONY: clean-Middleware-2f-STM32_USB_Device_Library
 
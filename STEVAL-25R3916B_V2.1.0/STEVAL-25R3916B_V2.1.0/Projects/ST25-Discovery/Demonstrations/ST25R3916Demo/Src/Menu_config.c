@@ -274,13 +274,25 @@ void Menu_DisplayClearLine(uint16_t Line)
 uint8_t Menu_ReadPosition(Menu_Position_t* State)
 {
   TS_StateTypeDef TS_State;
+  TS_EventTypeDef TS_Event;
   BSP_TS_GetState(&TS_State);
 
   State->Sel = TS_State.TouchDetected;
   State->X = TS_State.X;
   State->Y = TS_State.Y;
 
-  return TS_State.TouchDetected;
+  /* Consume the gesture events: a tap released since last call is only visible from the queue */
+  while(BSP_TS_GetEvent(&TS_Event))
+  {
+    if((TS_Event.Id == TS_EVENT_PRESS) && !TS_State.TouchDetected)
+    {
+      State->Sel = 1;
+      State->X = TS_Event.X;
+      State->Y = TS_Event.Y;
+    }
+  }
+
+  return State->Sel;
 
 }
 
@@ -40,18 +40,18 @@ void ReturnFunc(void);
 void IdleFunc(void){};
 
 /* icon main menu */
-#include "aat_84x84_jpg.h"
-#include "tag_detection_84x84_jpg.h"
-#include "emulate_84x84_jpg.h"
-#include "P2P_84x84_jpg.h"
+#include "aat_84x84_rgb565.h"
+#include "tag_detection_84x84_rgb565.h"
+#include "emulate_84x84_rgb565.h"
+#include "P2P_84x84_rgb565.h"
 
 /* icon file for menu */
-#include "url_64x64_jpg.h"
+#include "url_64x64_rgb565.h"
 #include "vcard_64x64_jpg.h"
 #include "nmark_64x64_jpg.h"
 #include "email_64x64_jpg.h"
-#include "Contact_jpg.h"
-#include "mailbox_jpg.h"
+#include "Contact_rgb565.h"
+#include "mailbox_rgb565.h"
 
 /** @defgroup ST25R3916_Menu_Definition ST25R3916 Menu Definition
   * @ingroup  ST25_Discovery_Demo
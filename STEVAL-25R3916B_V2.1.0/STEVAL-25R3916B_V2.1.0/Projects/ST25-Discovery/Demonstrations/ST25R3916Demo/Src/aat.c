@@ -34,20 +34,21 @@
 #include "rfal_rf.h"
 #include "stm32l4xx_hal.h"
 #ifdef ST25R3916B
-#include "3916b_aat_jpg.h"
+#include "3916b_aat_rgb565.h"
 #else
-#include "Gauge_light_jpg.h"
+#include "Gauge_light_rgb565.h"
 #endif
 
 #include "BarV_jpg.h"
-#include "CursorV_jpg.h"
-#include "CursorBlue_jpg.h"
-#include "CadreCp_jpg.h"
-#include "CadreCs_jpg.h"
+#include "CursorV_rgb565.h"
+#include "CursorBlue_rgb565.h"
+#include "CadreCp_rgb565.h"
+#include "CadreCs_rgb565.h"
 #include "st25_discovery_lcd.h"
 
 #include "Menu_config.h"
 #include "Menu_cursor.h"
+#include "Menu_Plot.h"
 #include "tuneAntenna.h"
 #include "math.h"
 #include "stdio.h"
@@ -86,12 +87,13 @@ static const double realLengthFactor = 0.01302;
 /* Method to draw a needle with a given amplitude & phase */
 static void drawNeedle(double amp, double phase)
 {
+  Menu_Plot_Point_t center = {160, 143};
+  Menu_Plot_Point_t tip;
   phase = round(phase) * 3.141592 / 180;
   amp *= 30;
-  for(int i = 0 ; i < amp ; i +=1)
-  {
-      BSP_LCD_FillRect(160 + i * cos(phase),143 - i * sin(phase),3,3);
-  }
+  tip.x = center.x + (int)round(amp * cos(phase));
+  tip.y = center.y - (int)round(amp * sin(phase));
+  Menu_DisplaySegmentWidth(center, tip, 3);
 }
 
 /* Helper function to know if Amplitude or Phase has changed, and so a refresh is needed */
@@ -44,10 +44,10 @@
 #include "Menu_core.h"
 #include "Menu_config.h"
 #include "Menu_tab.h"
-#include "cartouche_jpg.h"
-#include "send_icon_jpg.h"
-#include "Error_jpg.h"
-#include "Success_jpg.h"
+#include "cartouche_rgb565.h"
+#include "send_icon_rgb565.h"
+#include "Error_rgb565.h"
+#include "Success_rgb565.h"
 
 #ifdef ENABLE_TRUST25_SIGNATURE_VERIFICATION
 #include "TruST25.h"
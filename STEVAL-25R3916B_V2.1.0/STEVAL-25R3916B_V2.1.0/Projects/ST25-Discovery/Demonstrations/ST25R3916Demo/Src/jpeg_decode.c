@@ -57,31 +57,73 @@ void jpeg_decode_exit (j_common_ptr cinfo)
   jpeg_error++;
 }
 
+/**
+  * @brief  Convert the window part of a decoded scanline to RGB565.
+  * @param  Row Decoded scanline (RGB888, or luma only when Window->grey_lut is set).
+  * @param  Window Output window.
+  * @param  Pixels RGB565 output.
+  * @return None
+  */
+static void jpeg_convert_row(const uint8_t *Row, const jpeg_window_t *Window, uint16_t *Pixels)
+{
+  uint32_t count = Window->width;
+
+  if(Window->grey_lut != NULL)
+  {
+    Row += Window->first_col;
+    while(count--)
+    {
+      *Pixels++ = Window->grey_lut[*Row++];
+    }
+  }
+  else
+  {
+    Row += Window->first_col * 3;
+    while(count--)
+    {
+      *Pixels++ = (uint16_t)(((Row[0] & 0xF8) << 8) | ((Row[1] & 0xFC) << 3) | (Row[2] >> 3));
+      Row += 3;
+    }
+  }
+}
+
 /**
   * @brief  Decode a jpeg formatted picture calling the Cube libJPEG middleware.
+  * @details The header is read once and passed to the setup callback, which selects the
+  *          DCT scaling and the output window. Only the window rows are converted to RGB565,
+  *          JPEG_DECODE_STRIP_ROWS rows at a time, and decoding stops after the last one.
   * @param  jpeg Pointer to the data array with jpeg format picture.
-  * @param  callback Callback function to be called after a line of the picture has been decoded.
+  * @param  setup Callback called with the picture geometry, to fill the output window (non-zero return aborts).
+  * @param  callback Callback called with a strip of RGB565 pixels, window rows one after the other (non-zero return aborts).
   * @return Number of errors
   */
-uint32_t jpeg_decode(const char* jpeg, uint8_t (*callback)(uint8_t* , uint32_t))
+uint32_t jpeg_decode(const char* jpeg,
+                     uint8_t (*setup)(uint32_t Width, uint32_t Height, jpeg_window_t *Window),
+                     uint8_t (*callback)(uint16_t *Pixels, uint32_t NbPixels))
 { 
   /* This struct contains the JPEG decompression parameters */
   struct jpeg_decompress_struct cinfo;
   /* This struct represents a JPEG error handler */
   struct jpeg_error_mgr jerr;
+  jpeg_window_t window = {8, 0, 0, 0, 0, NULL};
+  JSAMPROW scanlines[4] = {0}; /* Output rows of one jpeg_read_scanlines call */
+  uint16_t *strip = NULL;      /* RGB565 rows sent to the callback */
+  uint8_t *buffer = NULL;
+  uint32_t row_stride;
+  uint32_t strip_rows = 0;
+  uint32_t last_row;
+  uint32_t row;
+  uint32_t nb_lines;
+  uint32_t i;
+  uint8_t stop = 0;
 
   /* reset global error counter */
   jpeg_error = 0;
 
-	// open the 'file' which is a simple char* array
-	FIL fh;
-	f_open(&fh,jpeg,FA_READ);
+  // open the 'file' which is a simple char* array
+  FIL fh;
+  f_open(&fh,jpeg,FA_READ);
 
-  /* Decode JPEG Image */
-  JSAMPROW buffer[2] = {0}; /* Output row buffer */
-  uint32_t row_stride = 0; /* Physical row width in image buffer */
-	
-  
   /* Step 1: Allocate and initialize JPEG decompression object */
   cinfo.err = jpeg_std_error(&jerr);
   cinfo.err->error_exit = &jpeg_decode_exit;
@@ -91,84 +133,184 @@ uint32_t jpeg_decode(const char* jpeg, uint8_t (*callback)(uint8_t* , uint32_t))
   
   jpeg_stdio_src (&cinfo, &fh);
   
-  /* Step 3: read image parameters with jpeg_read_header() */
+  /* Step 3: read image parameters with jpeg_read_header(), once for geometry and decoding */
   jpeg_read_header(&cinfo, TRUE);
-  
-  buffer[0] = malloc(cinfo.image_width*3);
-  if(buffer[0] == NULL)
+
+  window.width = cinfo.image_width;
+  window.height = cinfo.image_height;
+  if((jpeg_error != 0) || (setup(cinfo.image_width, cinfo.image_height, &window) != 0))
   {
-    //Menu_MsgStatus("Jpeg error","Picture width is too big!!!",MSG_STATUS_ERROR);
-    return 1;
+    stop = 1;
   }
+
   /* Step 4: set parameters for decompression */
-  cinfo.dct_method = JDCT_FLOAT;
-  
+  if(!stop)
+  {
+    if((window.scale_num == 0) || (window.scale_num > 8))
+    {
+      window.scale_num = 8;
+    }
+    cinfo.scale_num = window.scale_num;
+    cinfo.scale_denom = 8;
+    cinfo.dct_method = JPEG_DECODE_DCT_METHOD;
+    /* Merged upsampling: chroma is replicated rather than interpolated, fine on a 16 bpp LCD */
+    cinfo.do_fancy_upsampling = FALSE;
+    if(window.grey_lut != NULL)
+    {
+      /* Luma only: chroma is neither upsampled nor converted */
+      cinfo.out_color_space = JCS_GRAYSCALE;
+    }
+    jpeg_calc_output_dimensions(&cinfo);
+
+    /* Clip the window to the scaled picture */
+    if(window.first_col > cinfo.output_width)
+    {
+      window.first_col = cinfo.output_width;
+    }
+    if(window.first_row > cinfo.output_height)
+    {
+      window.first_row = cinfo.output_height;
+    }
+    if(window.width > (cinfo.output_width - window.first_col))
+    {
+      window.width = cinfo.output_width - window.first_col;
+    }
+    if(window.height > (cinfo.output_height - window.first_row))
+    {
+      window.height = cinfo.output_height - window.first_row;
+    }
+    if((window.width == 0) || (window.height == 0) || (cinfo.rec_outbuf_height > 4))
+    {
+      stop = 1;
+    }
+  }
+
+  if(!stop)
+  {
+    row_stride = cinfo.output_width * cinfo.output_components;
+    buffer = malloc((row_stride * cinfo.rec_outbuf_height) + (JPEG_DECODE_STRIP_ROWS * window.width * sizeof(uint16_t)));
+    if(buffer == NULL)
+    {
+      //Menu_MsgStatus("Jpeg error","Picture width is too big!!!",MSG_STATUS_ERROR);
+      jpeg_error++;
+      stop = 1;
+    }
+    else
+    {
+      /* The RGB565 strip comes first to keep it half-word aligned */
+      strip = (uint16_t *)buffer;
+      for(i = 0; i < (uint32_t)cinfo.rec_outbuf_height; i++)
+      {
+        scanlines[i] = buffer + (JPEG_DECODE_STRIP_ROWS * window.width * sizeof(uint16_t)) + (i * row_stride);
+      }
+    }
+  }
+
   /* Step 5: start decompressor */
-  jpeg_start_decompress(&cinfo);
+  if(!stop)
+  {
+    jpeg_start_decompress(&cinfo);
+  }
 
   /* only display the picture if no error is detected */
-  if(!jpeg_error)
+  if((!stop) && (!jpeg_error))
   {
-    row_stride = cinfo.image_width * 3;
-    while (cinfo.output_scanline < cinfo.output_height)
+    last_row = window.first_row + window.height;
+    while((cinfo.output_scanline < last_row) && (!stop))
     {
-      (void) jpeg_read_scanlines(&cinfo, buffer, 1);
-    
-      if (callback(buffer[0], row_stride) != 0)
+      row = cinfo.output_scanline;
+      nb_lines = jpeg_read_scanlines(&cinfo, scanlines, cinfo.rec_outbuf_height);
+      if(nb_lines == 0)
       {
+        /* Corrupted or truncated data */
         break;
       }
+
+      /* Rows above the window are decoded (the entropy data is sequential) but not converted */
+      for(i = 0; (i < nb_lines) && (row < last_row); i++, row++)
+      {
+        if(row < window.first_row)
+        {
+          continue;
+        }
+        jpeg_convert_row(scanlines[i], &window, &strip[strip_rows * window.width]);
+        strip_rows++;
+        if((strip_rows == JPEG_DECODE_STRIP_ROWS) || ((row + 1) == last_row))
+        {
+          stop = callback(strip, strip_rows * window.width);
+          strip_rows = 0;
+        }
+      }
     }
   }
-  /* Step 6: Finish decompression */
-  jpeg_finish_decompress(&cinfo);
+
+  /* Step 6: Finish decompression, rows below the window are not decoded */
+  if(cinfo.output_scanline == cinfo.output_height)
+  {
+    jpeg_finish_decompress(&cinfo);
+  }
+  else
+  {
+    jpeg_abort_decompress(&cinfo);
+  }
   
   /* Step 7: Release JPEG decompression object */
   jpeg_destroy_decompress(&cinfo);   
-	f_close(NULL)	;
-  free (buffer[0]);
+  f_close(&fh);
+  free(buffer);
   return jpeg_error;
 }
 
 
 /**
   * @brief  Get the geometry of a JPEG picture.
-  * @details Calls the Cube libJPEG middleware to read the jpeg header and extract the geometry info.
+  * @details Walks the marker segments up to the first Start Of Frame, without
+  *          instantiating a libJPEG decompressor.
   * @param  jpeg Pointer to the data array with jpeg format picture.
-  * @param  Width Pointer used to return the width of the JPEG picture.
-  * @param  Height Pointer used to return the height of the JPEG picture.
+  * @param  Width Pointer used to return the width of the JPEG picture (0 if not found).
+  * @param  Height Pointer used to return the height of the JPEG picture (0 if not found).
   * @return None
   */
 void jpeg_getsize(const char* jpeg, uint32_t* Width, uint32_t* Height)
 { 
-/* This struct contains the JPEG decompression parameters */
-struct jpeg_decompress_struct cinfo;
-/* This struct represents a JPEG error handler */
-struct jpeg_error_mgr jerr;
-
-	// open the 'file' which is a simple char* array
-	FIL fh;
-	f_open(&fh,jpeg,FA_READ);
-	
-  
-  /* Step 1: Allocate and initialize JPEG decompression object */
-  cinfo.err = jpeg_std_error(&jerr);
-  
-  /* Step 2: Initialize the JPEG decompression object */  
-  jpeg_create_decompress(&cinfo);
-  
-  jpeg_stdio_src (&cinfo, &fh);
-  
-  /* Step 3: read image parameters with jpeg_read_header() */
-  jpeg_read_header(&cinfo, TRUE);
-  
-	*Width = cinfo.image_width;
-	*Height = cinfo.image_height;
+  const uint8_t *ptr = (const uint8_t *)jpeg + 2; /* skip SOI */
+  uint8_t marker;
 
+  *Width = 0;
+  *Height = 0;
 
-  /* Step 7: Release JPEG decompression object */
-  jpeg_destroy_decompress(&cinfo);  
-	f_close(NULL)	;
+  while(ptr[0] == 0xFF)
+  {
+    /* Skip fill bytes */
+    while(ptr[1] == 0xFF)
+    {
+      ptr++;
+    }
+    marker = ptr[1];
+
+    if((marker == 0xDA) || (marker == 0xD9))
+    {
+      /* Start Of Scan or End Of Image reached without frame header */
+      return;
+    }
+    if((marker >= 0xC0) && (marker <= 0xCF) && (marker != 0xC4) && (marker != 0xC8) && (marker != 0xCC))
+    {
+      /* SOFn: length(2) precision(1) height(2) width(2) */
+      *Height = ((uint32_t)ptr[5] << 8) | ptr[6];
+      *Width = ((uint32_t)ptr[7] << 8) | ptr[8];
+      return;
+    }
+    if((marker >= 0xD0) && (marker <= 0xD7))
+    {
+      /* RSTn: no payload */
+      ptr += 2;
+    }
+    else
+    {
+      /* Skip the segment: 2 bytes of marker + segment length */
+      ptr += 2 + (((uint32_t)ptr[2] << 8) | ptr[3]);
+    }
+  }
 }
 
 /**
@@ -48,6 +48,7 @@
 
 #include "bootloader.h"
 #include "usbd_custom_hid_if.h"
+#include "usbd_storage.h"
 #include "ce.h"
 
 #include "stream_dispatcher.h"
@@ -284,6 +285,7 @@ int main( void )
   HAL_Delay( 50 );
 
   BSP_TS_Init( 240, 320 );
+  BSP_TS_ITConfig( );
   BSP_LCD_Init( );
   BSP_LCD_SetFont( &Font22 );
 
@@ -329,6 +331,8 @@ int main( void )
       ProcessIO();
       dispatcherWorker(); /* Call all functions need by the dispatcher */
       ceHandler();
+      STORAGE_Task();     /* Write the USB disk page staged by the USB interrupt, if any */
+      logUsartFlush();    /* Send pending binary log records, if any */
   }
 
 }
@@ -41,6 +41,9 @@
 #include "stm32l4xx.h"
 #include "fw_command.h"
 #include "st25r3916_irq.h"
+#include "st25_discovery.h"
+#include "st25_discovery_ts.h"
+#include "flash_driver.h"
 
 /** @defgroup ST25Discovery_IT ST25 Discovery interrupt routines
   * @ingroup ST25_Discovery_Demo
@@ -81,6 +84,8 @@ volatile uint32_t ms_counter = 0;
   */
 void NMI_Handler(void)
 {
+  /* Flash double ECC error, e.g. the PAC log reading a double-word torn by a power loss */
+  flash_EccNmiHandler();
 }
 
 /**
@@ -193,6 +198,15 @@ void NFCMEM_GPO_EXTIHandler( void )
 {
 }
 
+/**
+  * @brief  This function handles the touch screen controller interrupt request.
+  */
+void ST25_DISCOVERY_STMPE811_INT_EXTIHandler( void )
+{
+  HAL_GPIO_EXTI_IRQHandler( ST25_DISCOVERY_STMPE811_INT_PIN );
+  BSP_TS_IRQHandler( );
+}
+
 void EXTI15_10_IRQHandler(void)
 {
   /* USER CODE BEGIN EXTI15_10_IRQn 0 */
@@ -204,6 +218,50 @@ void EXTI15_10_IRQHandler(void)
   /* USER CODE END EXTI15_10_IRQn 1 */
 }
 
+#if defined(USE_LCD)
+/**
+* @brief This function handles the SPI2 TX DMA interrupt (LCD transfer queue).
+*/
+void ST25_DISCOVERY_SPI2_TX_DMA_IRQHandler(void)
+{
+  BSP_LCD_DMA_IRQHandler();
+}
+#endif /* USE_LCD */
+
+#if defined(USE_NFCTAG) && defined(USE_ST25DV)
+/**
+* @brief This function handles the I2C2 event interrupt (NFCTAG transfer engine).
+*/
+void ST25_DISCOVERY_I2C2_EV_IRQHandler(void)
+{
+  BSP_NFCMEM_I2C_EV_IRQHandler();
+}
+
+/**
+* @brief This function handles the I2C2 error interrupt (NFCTAG transfer engine).
+*/
+void ST25_DISCOVERY_I2C2_ER_IRQHandler(void)
+{
+  BSP_NFCMEM_I2C_ER_IRQHandler();
+}
+
+/**
+* @brief This function handles the I2C2 TX DMA interrupt (NFCTAG transfer engine).
+*/
+void ST25_DISCOVERY_I2C2_TX_DMA_IRQHandler(void)
+{
+  BSP_NFCMEM_DMA_IRQHandler();
+}
+
+/**
+* @brief This function handles the NFCTAG write cycle timer interrupt.
+*/
+void ST25_DISCOVERY_NFCTAG_TIM_IRQHandler(void)
+{
+  BSP_NFCMEM_TIM_IRQHandler();
+}
+#endif /* USE_NFCTAG && USE_ST25DV */
+
 /**
 * @brief This function handles USB OTG FS global interrupt.
 */
@@ -39,7 +39,7 @@
 #include "st25_discovery_lcd.h"
 #include "Menu_core.h"
 #include "Menu_config.h"
-#include "cartouche_jpg.h"
+#include "cartouche_rgb565.h"
 
 extern LCD_DrawPropTypeDef DrawProp;
 void tagDetectionDemo (void)
@@ -54,12 +54,22 @@
 #include "usbd_desc.h"
 #include "usbd_customhid.h"
 #include "usbd_custom_hid_if.h"
+#if (USBD_MSC_DISK == 1U)
+#include "usbd_composite_builder.h"
+#include "usbd_storage.h"
+#endif /* USBD_MSC_DISK */
 
 /* Return USBD_OK if the Battery Charging Detection mode (BCD) is used, else USBD_FAIL */
 extern USBD_StatusTypeDef USBD_LL_BatteryCharging(USBD_HandleTypeDef *pdev);
 /* USB Device Core handle declaration */
 USBD_HandleTypeDef USBD_Device;
 
+#if (USBD_MSC_DISK == 1U)
+/* Endpoints of each class in the composite device: IN, OUT */
+static uint8_t CustomHidEpAdd[] = { CUSTOM_HID_EPIN_ADDR, CUSTOM_HID_EPOUT_ADDR };
+static uint8_t MscEpAdd[] = { MSC_EPIN_ADDR, MSC_EPOUT_ADDR };
+#endif /* USBD_MSC_DISK */
+
 /* init function */                                        
 void MX_USB_DEVICE_Init(void)
 {
@@ -69,8 +79,19 @@ void MX_USB_DEVICE_Init(void)
   
   /* Init Device Library,Add Supported Class and Start the library*/
   USBD_Init(&USBD_Device, &HID_Desc, DEVICE_FS);
+#if (USBD_MSC_DISK == 1U)
+  /* CUSTOM_HID first (USBD_CUSTOMHID_CLASS_ID), then the flash disk */
+  USBD_RegisterClassComposite(&USBD_Device, &USBD_CUSTOM_HID, CLASS_TYPE_CHID, CustomHidEpAdd);
+  USBD_RegisterClassComposite(&USBD_Device, &USBD_MSC, CLASS_TYPE_MSC, MscEpAdd);
+  /* The interfaces are registered for the current class */
+  (void)USBD_CMPSIT_SetClassID(&USBD_Device, CLASS_TYPE_CHID, 0);
+  USBD_CUSTOM_HID_RegisterInterface(&USBD_Device, &USBD_CustomHID_fops_FS);
+  (void)USBD_CMPSIT_SetClassID(&USBD_Device, CLASS_TYPE_MSC, 0);
+  USBD_MSC_RegisterStorage(&USBD_Device, &USBD_DISK_fops);
+#else
   USBD_RegisterClass(&USBD_Device, &USBD_CUSTOM_HID);
   USBD_CUSTOM_HID_RegisterInterface(&USBD_Device, &USBD_CustomHID_fops_FS);
+#endif /* USBD_MSC_DISK */
   /* Verify if the Battery Charging Detection mode (BCD) is used : */
   /* If yes, the USB device is started in the HAL_PCDEx_BCD_Callback */
   /* upon reception of PCD_BCD_DISCOVERY_COMPLETED message. */
@@ -24,6 +24,10 @@
 #include "usbd_def.h"
 #include "usbd_core.h"
 #include "usbd_customhid.h"
+#if (USBD_MSC_DISK == 1U)
+#include "usbd_msc.h"
+#include "usbd_storage.h"
+#endif /* USBD_MSC_DISK */
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
@@ -311,7 +315,13 @@ USBD_StatusTypeDef USBD_LL_Init (USBD_HandleTypeDef *pdev)
 
   HAL_PCDEx_SetRxFiFo(&hpcd_USB_OTG_FS, 0x80);
   HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 0, 0x40);
+#if (USBD_MSC_DISK == 1U)
+  /* 320 words of FIFO: one 64 bytes packet per IN endpoint of CUSTOM_HID and MSC */
+  HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 1, 0x40);
+  HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 2, 0x40);
+#else
   HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 1, 0x80);
+#endif /* USBD_MSC_DISK */
   }
   return USBD_OK;
 }
@@ -689,6 +699,14 @@ USBD_StatusTypeDef USBD_LL_PrepareReceive(USBD_HandleTypeDef *pdev,
   HAL_StatusTypeDef hal_status = HAL_OK;
   USBD_StatusTypeDef usb_status = USBD_OK;
 
+#if (USBD_MSC_DISK == 1U)
+  /* Next CBW or data packet of the disk: held while a page is written to flash */
+  if ((ep_addr == MSC_EPOUT_ADDR) && (STORAGE_HoldReceive(pbuf, size) != 0U))
+  {
+    return USBD_OK;
+  }
+#endif /* USBD_MSC_DISK */
+
   hal_status = HAL_PCD_EP_Receive(pdev->pData, ep_addr, pbuf, size);
      
   switch (hal_status) {
@@ -791,6 +809,14 @@ void *USBD_static_malloc(uint32_t size)
 {
   UNUSED(size);
   static uint32_t mem[(sizeof(USBD_CUSTOM_HID_HandleTypeDef)/4+1)];/* On 32-bit boundary */
+#if (USBD_MSC_DISK == 1U)
+  /* Composite device: one handle per class, told apart by their size */
+  static uint32_t memMsc[(sizeof(USBD_MSC_BOT_HandleTypeDef)/4+1)];/* On 32-bit boundary */
+  if (size == sizeof(USBD_MSC_BOT_HandleTypeDef))
+  {
+    return memMsc;
+  }
+#endif /* USBD_MSC_DISK */
   return mem;
 }
 
@@ -28,6 +28,9 @@ EndBSPDependencies */
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
+/* pClassData is the last class initialized in a composite device */
+#define FS_CUSTOM_HID_HANDLE()    ((USBD_CUSTOM_HID_HandleTypeDef*)USBD_Device.pClassDataCmsit[USBD_CUSTOMHID_CLASS_ID])
+
 /* Private function prototypes -----------------------------------------------*/
 
 static int8_t FS_CUSTOM_HID_Init(void);
@@ -117,7 +120,7 @@ static int8_t FS_CUSTOM_HID_DeInit(void)
   */
 static int8_t FS_CUSTOM_HID_OutEvent(uint8_t event_idx, uint8_t state)
 {
-  USBD_CUSTOM_HID_HandleTypeDef *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)USBD_Device.pClassData;
+  USBD_CUSTOM_HID_HandleTypeDef *hhid = FS_CUSTOM_HID_HANDLE();
   UNUSED(event_idx);
   UNUSED(state);
 
@@ -133,19 +136,23 @@ static int8_t FS_CUSTOM_HID_OutEvent(uint8_t event_idx, uint8_t state)
 
 uint8_t UsbTransmitReady()
 {
-  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)USBD_Device.pClassData;
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = FS_CUSTOM_HID_HANDLE();
   return (hhid->state == CUSTOM_HID_IDLE) ? 1 : 0;
 }
 
 uint8_t UsbTransmit(uint8_t *data, uint16_t dataLen)
 {
+#ifdef USE_USBD_COMPOSITE
+  return USBD_CUSTOM_HID_SendReport(&USBD_Device, data, dataLen, USBD_CUSTOMHID_CLASS_ID);
+#else
   return USBD_CUSTOM_HID_SendReport(&USBD_Device, data, dataLen);
+#endif /* USE_USBD_COMPOSITE */
 }
 
 uint8_t UsbReceive(uint8_t *data, uint16_t *dataLen)
 {
     uint8_t status = USBD_FAIL;
-    USBD_CUSTOM_HID_HandleTypeDef *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)USBD_Device.pClassData;
+    USBD_CUSTOM_HID_HandleTypeDef *hhid = FS_CUSTOM_HID_HANDLE();
     *dataLen = 0;
   
     if(hhid->IsReportAvailable == 0) return USBD_FAIL;
@@ -157,7 +164,12 @@ uint8_t UsbReceive(uint8_t *data, uint16_t *dataLen)
         data[i] = hhid->Report_buf[i];
     }
     *dataLen = USBD_CUSTOMHID_OUTREPORT_BUF_SIZE;
+#ifdef USE_USBD_COMPOSITE
+    /* USBD_CUSTOM_HID_ReceivePacket() works on pdev->classId, which the USB interrupt changes */
+    (void)USBD_LL_PrepareReceive(&USBD_Device, CUSTOM_HID_EPOUT_ADDR, hhid->Report_buf, USBD_CUSTOMHID_OUTREPORT_BUF_SIZE);
+#else
     USBD_CUSTOM_HID_ReceivePacket(&USBD_Device);
+#endif /* USE_USBD_COMPOSITE */
     status = USBD_OK;
 
     return status;
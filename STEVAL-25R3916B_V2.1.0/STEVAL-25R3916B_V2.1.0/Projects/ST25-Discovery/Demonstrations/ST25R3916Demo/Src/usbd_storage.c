@@ -27,18 +27,55 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "usbd_storage.h"
+#include "usbd_conf.h"
+#include "flashl4_if.h"
+#include <string.h>
 
 uint8_t Test_USB_status = 0;
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/* The medium is the internal flash user data area, cached one flash page at a time */
 #define STORAGE_LUN_NBR                  1  
-#define STORAGE_BLK_NBR                  0x10000  
 #define STORAGE_BLK_SIZ                  0x200
+#define STORAGE_BLK_NBR                  (USER_DATA_FLASH_SIZE / STORAGE_BLK_SIZ)
+#define STORAGE_PAGE_SIZ                 FLASH_PAGE_SIZE
+#define STORAGE_BLK_PER_PAGE             (STORAGE_PAGE_SIZ / STORAGE_BLK_SIZ)
+#define STORAGE_NO_PAGE                  0xFFFFFFFFU
+#define STORAGE_ERASED_DWORD             0xFFFFFFFFFFFFFFFFU
+#define STORAGE_FLUSH_DELAY              500U      /* Idle time (ms) before a partially written page is flushed */
+
+/* The ST25R_PAC analog config log (2 pages at ANALOG_CONFIG_OFFSET) must stay out of the medium */
+#ifdef ANALOG_CONFIG_OFFSET
+#define STORAGE_PAC_ADDRESS              (FLASH_BASE + ANALOG_CONFIG_OFFSET)
+#define STORAGE_PAC_SIZE                 (2U * FLASH_PAGE_SIZE)
+extern uint8_t checker_storage_pac[ (((STORAGE_PAC_ADDRESS + STORAGE_PAC_SIZE) <= USER_DATA_ADDRESS) ||
+                                     (STORAGE_PAC_ADDRESS >= (USER_DATA_ADDRESS + (STORAGE_BLK_NBR * STORAGE_BLK_SIZ)))) ? 1 : -1 ];
+#endif
+
+/* One block per STORAGE_Write() call: a page staged by a call is written before the next call */
+extern uint8_t checker_storage_packet[ (MSC_MEDIA_PACKET == STORAGE_BLK_SIZ) ? 1 : -1 ];
 
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Write-back cache of one flash page: consecutive block writes to the same page
+   cost a single erase/program when the page is left or fully written.
+   The USB interrupt never erases: it hands the page over (staged page) and the main
+   loop writes it (STORAGE_Task) while the next MSC OUT transfer is held back        */
+static uint64_t StoragePages[2][STORAGE_PAGE_SIZ / sizeof(uint64_t)];
+static uint64_t *StorageCache = StoragePages[0];
+static uint32_t StorageCachePage = STORAGE_NO_PAGE;
+static uint8_t  StorageCacheDirty = 0;
+static uint32_t StorageLastWrite = 0;
+static uint64_t *StorageStaged = StoragePages[1];
+static volatile uint32_t StorageStagedPage = STORAGE_NO_PAGE;
+static uint8_t  *StorageHeldBuf;
+static uint32_t StorageHeldSize;
+static volatile uint8_t StorageHeld = 0;
+
+extern USBD_HandleTypeDef USBD_Device;
+
 /* USB Mass storage Standard Inquiry Data */
 int8_t STORAGE_Inquirydata[] = { /* 36 */
   /* LUN 0 */
@@ -64,6 +101,9 @@ int8_t STORAGE_IsWriteProtected(uint8_t lun);
 int8_t STORAGE_Read(uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len);
 int8_t STORAGE_Write(uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len);
 int8_t STORAGE_GetMaxLun(void);
+static int8_t STORAGE_WritePage(uint32_t page, const uint64_t *data);
+static int8_t STORAGE_Stage(void);
+static int8_t STORAGE_LoadPage(uint32_t page);
 
 USBD_StorageTypeDef USBD_DISK_fops = {
   STORAGE_Init,
@@ -77,6 +117,171 @@ USBD_StorageTypeDef USBD_DISK_fops = {
 };
 /* Private functions ---------------------------------------------------------*/
 
+/**
+  * @brief  Writes a page of the medium to flash.
+  *         The page is only erased when a doubleword to change is not erased yet,
+  *         and only the doublewords which differ are programmed.
+  * @param  page: Page index in the user data area
+  * @param  data: Page content
+  * @retval Status (0 : Ok / -1 : Error)
+  */
+static int8_t STORAGE_WritePage(uint32_t page, const uint64_t *data)
+{
+  const uint64_t *flash;
+  uint32_t address;
+  uint32_t i;
+  uint8_t  erase = 0;
+  uint8_t  changed = 0;
+  uint32_t ret = 0;
+
+  address = USER_DATA_ADDRESS + (page * STORAGE_PAGE_SIZ);
+  flash = (const uint64_t *)address;
+
+  for(i = 0; i < (STORAGE_PAGE_SIZ / sizeof(uint64_t)); i++)
+  {
+    if(flash[i] != data[i])
+    {
+      changed = 1;
+      if(flash[i] != STORAGE_ERASED_DWORD)
+      {
+        erase = 1;
+        break;
+      }
+    }
+  }
+
+  if(changed != 0)
+  {
+    FLASH_If_FlashUnlock( );
+    if(erase != 0)
+    {
+      ret = FLASH_If_PageErase( address, address + STORAGE_PAGE_SIZ - 1 );
+    }
+    for(i = 0; (i < (STORAGE_PAGE_SIZ / sizeof(uint64_t))) && (ret == 0); i++)
+    {
+      if((data[i] != flash[i]) && (data[i] != STORAGE_ERASED_DWORD))
+      {
+        ret = FLASH_If_WriteDWord( address + (i * sizeof(uint64_t)), data[i] );
+      }
+    }
+    FLASH_If_FlashLock( );
+  }
+
+  return (ret == 0) ? 0 : -1;
+}
+
+/**
+  * @brief  Hands the cached page over to the main loop if it was modified.
+  *         Called from the USB interrupt: the page is written by STORAGE_Task().
+  * @retval Status (0 : Ok / -1 : previous page not written yet)
+  */
+static int8_t STORAGE_Stage(void)
+{
+  uint64_t *page;
+
+  if((StorageCacheDirty == 0) || (StorageCachePage == STORAGE_NO_PAGE))
+  {
+    return 0;
+  }
+  if(StorageStagedPage != STORAGE_NO_PAGE)
+  {
+    return -1;
+  }
+  page = StorageStaged;
+  StorageStaged = StorageCache;
+  StorageCache = page;
+  StorageStagedPage = StorageCachePage;
+  StorageCachePage = STORAGE_NO_PAGE;
+  StorageCacheDirty = 0;
+  return 0;
+}
+
+/**
+  * @brief  Loads a flash page into the cache, staging the previous one.
+  * @param  page: Page index in the user data area
+  * @retval Status (0 : Ok / -1 : Error)
+  */
+static int8_t STORAGE_LoadPage(uint32_t page)
+{
+  if(page == StorageCachePage)
+  {
+    return 0;
+  }
+  if(STORAGE_Stage() != 0)
+  {
+    return -1;
+  }
+  memcpy(StorageCache, (const void *)(USER_DATA_ADDRESS + (page * STORAGE_PAGE_SIZ)), STORAGE_PAGE_SIZ);
+  StorageCachePage = page;
+  return 0;
+}
+
+/**
+  * @brief  Holds an MSC OUT transfer while a staged page waits to be written.
+  *         Called by USBD_LL_PrepareReceive() for the MSC OUT endpoint: neither
+  *         the next CBW nor the next data packet is received before STORAGE_Task().
+  * @param  pbuf: Reception buffer
+  * @param  size: Reception size
+  * @retval 1 if the transfer is held, 0 if it can be started
+  */
+uint8_t STORAGE_HoldReceive(uint8_t *pbuf, uint32_t size)
+{
+  if(StorageStagedPage == STORAGE_NO_PAGE)
+  {
+    return 0;
+  }
+  StorageHeldBuf = pbuf;
+  StorageHeldSize = size;
+  StorageHeld = 1;
+  return 1;
+}
+
+/**
+  * @brief  Writes the staged page to flash, then starts the held MSC OUT transfer.
+  *         To be called from the main loop.
+  * @retval None
+  */
+void STORAGE_Task(void)
+{
+  if(StorageHeld == 0)
+  {
+    return;
+  }
+  /* The SCSI command completed already: a flash error cannot be reported to the host */
+  (void)STORAGE_WritePage(StorageStagedPage, StorageStaged);
+  StorageStagedPage = STORAGE_NO_PAGE;
+  StorageHeld = 0;
+  (void)USBD_LL_PrepareReceive(&USBD_Device, MSC_EPOUT_ADDR, StorageHeldBuf, StorageHeldSize);
+}
+
+/**
+  * @brief  Writes the staged and cached pages to flash if they were modified.
+  *         Thread mode, USB device stopped (e.g. before a reset).
+  * @retval Status (0 : Ok / -1 : Error)
+  */
+int8_t STORAGE_Flush(void)
+{
+  int8_t ret = 0;
+
+  if(StorageStagedPage != STORAGE_NO_PAGE)
+  {
+    ret = STORAGE_WritePage(StorageStagedPage, StorageStaged);
+    StorageStagedPage = STORAGE_NO_PAGE;
+    StorageHeld = 0;
+  }
+  if((StorageCacheDirty != 0) && (StorageCachePage != STORAGE_NO_PAGE))
+  {
+    if(STORAGE_WritePage(StorageCachePage, StorageCache) != 0)
+    {
+      /* Content no longer known: reload from flash on next access */
+      StorageCachePage = STORAGE_NO_PAGE;
+      ret = -1;
+    }
+    StorageCacheDirty = 0;
+  }
+  return ret;
+}
+
 /**
   * @brief  Initailizes the storage unit (medium)       
   * @param  lun: Logical unit number
@@ -84,7 +289,8 @@ USBD_StorageTypeDef USBD_DISK_fops = {
   */
 int8_t STORAGE_Init(uint8_t lun)
 {
-  //BSP_SD_Init();
+  /* A page left modified by the previous session is written from the main loop */
+  (void)STORAGE_Stage();
 	Test_USB_status = 1;
   return 0;
 }
@@ -98,25 +304,11 @@ int8_t STORAGE_Init(uint8_t lun)
   */
 int8_t STORAGE_GetCapacity(uint8_t lun, uint32_t *block_num, uint16_t *block_size)
 {
-//  HAL_SD_CardInfoTypedef info;
-  int8_t ret = -1;  
- /*
-  if(BSP_SD_IsDetected() != SD_NOT_PRESENT)
-  {
-    BSP_SD_GetCardInfo(&info);
-    
-    *block_num = (info.CardCapacity)/STORAGE_BLK_SIZ  - 1;
-    *block_size = STORAGE_BLK_SIZ;
-    ret = 0;
-  } else */{
-		 *block_num = STORAGE_BLK_NBR/STORAGE_BLK_SIZ  - 1;
-    *block_size = STORAGE_BLK_SIZ;
-    ret = 0;
-
-	}
+  *block_num = STORAGE_BLK_NBR;
+  *block_size = STORAGE_BLK_SIZ;
 		Test_USB_status = 1;
 
-  return ret;
+  return 0;
 }
 
 /**
@@ -126,29 +318,12 @@ int8_t STORAGE_GetCapacity(uint8_t lun, uint32_t *block_num, uint16_t *block_siz
   */
 int8_t STORAGE_IsReady(uint8_t lun)
 {
-/*
-  static int8_t prev_status = 0;
-  int8_t ret = -1;
-  
-  if(BSP_SD_IsDetected() != SD_NOT_PRESENT)
-  {
-    if(prev_status < 0)
-    {
-      BSP_SD_Init();
-      prev_status = 0;
-      
-    }
-    if(BSP_SD_GetStatus() == SD_TRANSFER_OK)
-    {
-      ret = 0;
-    }
-  }
-  else if(prev_status == 0)
+  /* Hosts poll TEST UNIT READY while idle: stage a page left partially written */
+  if((StorageCacheDirty != 0) && (StorageStagedPage == STORAGE_NO_PAGE) &&
+     ((HAL_GetTick() - StorageLastWrite) > STORAGE_FLUSH_DELAY))
   {
-    prev_status = -1;
+    (void)STORAGE_Stage();
   }
-  return ret;
-	*/
 		Test_USB_status = 1;
 
 	return 0;
@@ -175,16 +350,31 @@ int8_t STORAGE_IsWriteProtected(uint8_t lun)
   */
 int8_t STORAGE_Read(uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len)
 {
-  /*
-  int8_t ret = -1;  
-  
-  if(BSP_SD_IsDetected() != SD_NOT_PRESENT)
-  {  
-    BSP_SD_ReadBlocks_DMA((uint32_t *)buf, blk_addr * STORAGE_BLK_SIZ, STORAGE_BLK_SIZ, blk_len);
-    ret = 0;
+  uint32_t blk;
+  uint32_t page;
+
+  if((blk_addr + blk_len) > STORAGE_BLK_NBR)
+  {
+    return -1;
+  }
+  for(blk = blk_addr; blk < (blk_addr + blk_len); blk++)
+  {
+    /* Flash is memory mapped: only the cached and staged pages need to be read from RAM */
+    page = blk / STORAGE_BLK_PER_PAGE;
+    if(page == StorageCachePage)
+    {
+      memcpy(buf, (uint8_t *)StorageCache + ((blk % STORAGE_BLK_PER_PAGE) * STORAGE_BLK_SIZ), STORAGE_BLK_SIZ);
+    }
+    else if(page == StorageStagedPage)
+    {
+      memcpy(buf, (uint8_t *)StorageStaged + ((blk % STORAGE_BLK_PER_PAGE) * STORAGE_BLK_SIZ), STORAGE_BLK_SIZ);
+    }
+    else
+    {
+      memcpy(buf, (const void *)(USER_DATA_ADDRESS + (blk * STORAGE_BLK_SIZ)), STORAGE_BLK_SIZ);
+    }
+    buf += STORAGE_BLK_SIZ;
   }
-  return ret;
-	*/
 		Test_USB_status = 1;
 
 	return 0;
@@ -199,16 +389,32 @@ int8_t STORAGE_Read(uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_l
   */
 int8_t STORAGE_Write(uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len)
 {
-  /*
-  int8_t ret = -1;  
-  
-  if(BSP_SD_IsDetected() != SD_NOT_PRESENT)
-  { 
-    BSP_SD_WriteBlocks_DMA((uint32_t *)buf, blk_addr * STORAGE_BLK_SIZ, STORAGE_BLK_SIZ, blk_len);
-    ret = 0;
+  uint32_t blk;
+
+  if((blk_addr + blk_len) > STORAGE_BLK_NBR)
+  {
+    return -1;
   }
-  return ret;
-	*/
+  for(blk = blk_addr; blk < (blk_addr + blk_len); blk++)
+  {
+    if(STORAGE_LoadPage(blk / STORAGE_BLK_PER_PAGE) != 0)
+    {
+      return -1;
+    }
+    memcpy((uint8_t *)StorageCache + ((blk % STORAGE_BLK_PER_PAGE) * STORAGE_BLK_SIZ), buf, STORAGE_BLK_SIZ);
+    StorageCacheDirty = 1;
+    buf += STORAGE_BLK_SIZ;
+
+    /* Last block of the page written: a sequential stream is done with this page */
+    if((blk % STORAGE_BLK_PER_PAGE) == (STORAGE_BLK_PER_PAGE - 1))
+    {
+      if(STORAGE_Stage() != 0)
+      {
+        return -1;
+      }
+    }
+  }
+  StorageLastWrite = HAL_GetTick();
 		Test_USB_status = 1;
 
 	return 0;
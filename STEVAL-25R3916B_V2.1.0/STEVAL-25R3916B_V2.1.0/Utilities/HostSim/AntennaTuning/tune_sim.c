@@ -0,0 +1,196 @@
+/**
+  ******************************************************************************
+  * @file    tune_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the antenna tuning algorithms (tuneAntenna.c)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "tuneAntenna.h"
+#include "st25r3916.h"
+#include "st25r3916_com.h"
+#include "rfal_chip.h"
+
+/*
+******************************************************************************
+* ANTENNA MODEL
+******************************************************************************
+*/
+/* Amplitude and phase follow a resonance surface centred on (S0, P0) of the serial and
+   parallel caps. A cap reaches a new register value with a first order response (TAU).
+   An SPI register write costs 5 us, an amplitude or phase measure 0.3 ms. */
+#define S0        150.0
+#define P0        90.0
+#define TAU       0.7       /* ms */
+#define T_WRITE   0.005     /* ms */
+#define T_MEASURE 0.3       /* ms */
+
+static double  simTime;    /* ms */
+static double  sSet, pSet, sFrom, pFrom, tChange;
+static uint8_t regA, regB;
+static long    regWrites;
+
+static double capValue(double set, double from)
+{
+  return set + ((from - set) * exp(-(simTime - tChange) / TAU));
+}
+
+ReturnCode st25r3916WriteRegister(uint8_t reg, uint8_t val)
+{
+  regWrites++;
+  sFrom   = capValue(sSet, sFrom);
+  pFrom   = capValue(pSet, pFrom);
+  tChange = simTime;
+  if( reg == ST25R3916_REG_ANT_TUNE_A )
+  {
+    sSet = val;
+    regA = val;
+  }
+  else if( reg == ST25R3916_REG_ANT_TUNE_B )
+  {
+    pSet = val;
+    regB = val;
+  }
+  simTime += T_WRITE;
+  return RFAL_ERR_NONE;
+}
+
+static void surface(double s, double p, uint8_t *amp, uint8_t *pha)
+{
+  double ds = (s - S0) / 40.0;
+  double dp = (p - P0) / 25.0;
+  double d  = (ds * ds) + (dp * dp) + (0.6 * ds * dp);
+
+  *amp = (uint8_t)((40.0 + (180.0 / (1.0 + d))) + 0.5);
+  *pha = (uint8_t)((128.0 + (60.0 * tanh((((s - S0) * 0.7) + ((p - P0) * 1.3)) / 60.0))) + 0.5);
+}
+
+ReturnCode rfalChipMeasureAmplitude(uint8_t *result)
+{
+  uint8_t pha;
+  surface(capValue(sSet, sFrom), capValue(pSet, pFrom), result, &pha);
+  simTime += T_MEASURE;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalChipMeasurePhase(uint8_t *result)
+{
+  uint8_t amp;
+  surface(capValue(sSet, sFrom), capValue(pSet, pFrom), &amp, result);
+  simTime += T_MEASURE;
+  return RFAL_ERR_NONE;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  simTime += Delay;
+}
+
+int logUsart(const char* format, ...)
+{
+  (void)format;
+  return 0;
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+int main(void)
+{
+  static const struct
+  {
+    tuningAlgorithmMode_t mode;
+    const char           *name;
+    uint8_t               first;
+    uint8_t               step;
+  } algo[] =
+  {
+    { MODE_ALGO_SER_SWEEP_AND_PAR_BINARY_SEARCH, "sweep ser",      0, 16 },
+    { MODE_ALGO_PAR_SWEEP_AND_SER_BINARY_SEARCH, "sweep par",      0, 16 },
+    { MODE_ALGO_2DIM_BINARY_SEARCH,              "2-D binary",     0, 16 },
+    { MODE_ALGO_HILL_CLIMB,                      "hill climb",   128,  4 },
+#ifndef TUNE_SIM_NO_COARSE_TO_FINE
+    { MODE_ALGO_COARSE_TO_FINE,                  "coarse-to-fine", 0, 16 },
+#endif
+  };
+  unsigned best = ~0U;
+  int      bestS = 0;
+  int      bestP = 0;
+  int      fail = 0;
+  int      s, p;
+  size_t   i;
+
+  printf("algorithm       err   A   B  amp  pha  measures  regs  time [ms]\n");
+  for( i = 0; i < (sizeof(algo) / sizeof(algo[0])); i++ )
+  {
+    tuningParams_t tp = { 0 };
+    tuningStatus_t ts = { 0 };
+    ReturnCode     err;
+
+    tp.mode            = algo[i].mode;
+    tp.AAT_A_first     = algo[i].first;
+    tp.AAT_A_last      = 255;
+    tp.AAT_A_stepWidth = algo[i].step;
+    tp.AAT_B_first     = algo[i].first;
+    tp.AAT_B_last      = 255;
+    tp.AAT_B_stepWidth = algo[i].step;
+    tp.ampTarget       = 200;
+    tp.ampWeight       = 1;
+    tp.phaTarget       = 128;
+    tp.phaWeight       = 2;
+
+    simTime   = 0;
+    regWrites = 0;
+    sSet = pSet = sFrom = pFrom = tChange = 0;
+    regA = regB = 0;
+    err = tuneAntenna(&tp, &ts);
+
+    printf("%-14s %4d %3d %3d  %3d  %3d  %8u  %4ld  %9.1f\n", algo[i].name, err, ts.AAT_A_tuned, ts.AAT_B_tuned,
+           ts.ampTuned, ts.phaTuned, ts.measureCnt, regWrites, simTime);
+    /* The chip must be left on the reported point */
+    if( (regA != ts.AAT_A_tuned) || (regB != ts.AAT_B_tuned) )
+    {
+      printf("  FAIL: ANT_TUNE_A/B left at %d/%d\n", regA, regB);
+      fail++;
+    }
+  }
+
+  /* Global optimum of the same cost function, by brute force */
+  for( s = 0; s < 256; s++ )
+  {
+    for( p = 0; p < 256; p++ )
+    {
+      uint8_t  amp, pha;
+      unsigned f;
+
+      surface(s, p, &amp, &pha);
+      f = (unsigned)abs(amp - 200) + (2U * (unsigned)abs(pha - 128));
+      if( f < best )
+      {
+        best  = f;
+        bestS = s;
+        bestP = p;
+      }
+    }
+  }
+  printf("optimum: cost %u at A=%d B=%d\n", best, bestS, bestP);
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,224 @@
+/**
+  ******************************************************************************
+  * @file    ce_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the ISO-DEP card emulation (ce.c) against reader APDUs
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ce.h"
+#include "rfal_rf.h"
+#include "rfal_isoDep.h"
+#include "rfal_nfca.h"
+
+/* ISO-DEP link as seen by ce.c: one C-APDU pending, the R-APDU it starts */
+extern rfalIsoDepTxRxParam isoDepTxRxParam;
+
+static const uint8_t *capdu;
+static uint16_t       capduLen;
+static bool           capduPending;
+static bool           answered;
+static uint8_t        rapdu[300];
+static uint16_t       rapduLen;
+
+/*
+******************************************************************************
+* RFAL STUBS
+******************************************************************************
+*/
+int logUsart(const char* format, ...)                      { (void)format; return 0; }
+int dispatcherPushEvent(void)                              { return 0; }
+
+rfalLmState rfalListenGetState(bool *dataFlag, rfalBitRate *lastBR)
+{
+  (void)lastBR;
+  if( dataFlag != NULL )
+  {
+    *dataFlag = false;
+  }
+  return RFAL_LM_STATE_CARDEMU_4A;
+}
+
+ReturnCode rfalListenSetState(rfalLmState newSt)           { (void)newSt; return RFAL_ERR_NONE; }
+ReturnCode rfalListenStop(void)                            { return RFAL_ERR_NONE; }
+ReturnCode rfalIsoDepListenGetActivationStatus(void)       { return RFAL_ERR_NONE; }
+void       rfalIsoDepInitialize(void)                      { }
+uint16_t   rfalIsoDepFSxI2FSx(uint8_t FSxI)                { (void)FSxI; return 256; }
+ReturnCode rfalStartTransceive(const rfalTransceiveContext *ctx) { (void)ctx; return RFAL_ERR_NONE; }
+ReturnCode rfalGetTransceiveStatus(void)                   { return RFAL_ERR_BUSY; }
+bool       rfalIsoDepIsRats(const uint8_t *buf, uint8_t bufLen)            { (void)buf; (void)bufLen; return false; }
+bool       rfalNfcaListenerIsSleepReq(const uint8_t *buf, uint16_t bufLen) { (void)buf; (void)bufLen; return false; }
+
+ReturnCode rfalListenStart(uint32_t lmMask, const rfalLmConfPA *confA, const rfalLmConfPB *confB, const rfalLmConfPF *confF,
+                           uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rxLen)
+{
+  (void)lmMask; (void)confA; (void)confB; (void)confF; (void)rxBuf; (void)rxBufLen; (void)rxLen;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalListenSleepStart(rfalLmState sleepSt, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rxLen)
+{
+  (void)sleepSt; (void)rxBuf; (void)rxBufLen; (void)rxLen;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalIsoDepListenStartActivation(rfalIsoDepAtsParam *atsParam, const rfalIsoDepAttribResParam *attribResParam,
+                                           const uint8_t *buf, uint16_t bufLen, rfalIsoDepListenActvParam actParam)
+{
+  (void)atsParam; (void)attribResParam; (void)buf; (void)bufLen; (void)actParam;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalIsoDepGetTransceiveStatus(void)
+{
+  if( !capduPending )
+  {
+    return RFAL_ERR_BUSY;
+  }
+  capduPending = false;
+  memcpy(isoDepTxRxParam.rxBuf->inf, capdu, capduLen);
+  *isoDepTxRxParam.rxLen = capduLen;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalIsoDepStartTransceive(rfalIsoDepTxRxParam param)
+{
+  answered = true;
+  rapduLen = param.txBufLen;
+  memcpy(rapdu, param.txBuf->inf, param.txBufLen);
+  return RFAL_ERR_NONE;
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+static int fail;
+
+/* Reader sends a C-APDU, returns true if ce.c answered without the host */
+static bool exchange(const uint8_t *c, uint16_t len)
+{
+  capdu        = c;
+  capduLen     = len;
+  capduPending = true;
+  answered     = false;
+  ceHandler();
+  return answered;
+}
+
+static void expect(const char *name, const uint8_t *c, uint16_t len, const uint8_t *r, uint16_t rLen)
+{
+  bool local = exchange(c, len);
+  int  i;
+
+  printf("%-16s:", name);
+  for( i = 0; i < rapduLen; i++ )
+  {
+    printf(" %02X", rapdu[i]);
+  }
+  if( !local || (rapduLen != rLen) || (memcmp(rapdu, r, rLen) != 0) )
+  {
+    printf("  <- FAIL");
+    fail++;
+  }
+  printf("\n");
+}
+
+/* C-APDU not answered on target: must be forwarded to the host through ceGetRx() */
+static void expectForwarded(const char *name, const uint8_t *c, uint16_t len)
+{
+  static const uint8_t r9000[] = { 0x90, 0x00 };
+  uint8_t  out[300];
+  uint16_t outLen = sizeof(out);
+  bool     local = exchange(c, len);
+
+  ceGetRx(CARDEMULATION_CMD_GET_RX_A, out, &outLen);
+  printf("%-16s: forwarded to host, %u bytes\n", name, (unsigned)outLen);
+  if( local || (outLen != len) || (memcmp(out, c, len) != 0) )
+  {
+    printf("  <- FAIL\n");
+    fail++;
+  }
+  ceSetTx(CARDEMULATION_CMD_SET_TX_A, r9000, sizeof(r9000));
+}
+
+int main(void)
+{
+  static const uint8_t start[]   = { 0x01, 0, 0, 0, 0, 0, 0, 0, 0 };   /* CARDEMULATION_MODE_NDEF */
+  static const uint8_t ndef[]    = { 0x00, 0x00, 0x00, 0x0C, 0xD1, 0x01, 0x08, 0x55, 0x01, 's', 't', '.', 'c', 'o', 'm', 0x00 };
+  static const uint8_t rule[]    = { 4, 0x80, 0xCA, 0x00, 0x00,  0xFF, 0xFF, 0x00, 0x00,  4, 0x12, 0x34, 0x90, 0x00 };
+  static const uint8_t selApp[]  = { 0x00, 0xA4, 0x04, 0x00, 0x07, 0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01, 0x00 };
+  static const uint8_t selCc[]   = { 0x00, 0xA4, 0x00, 0x0C, 0x02, 0xE1, 0x03 };
+  static const uint8_t rdCc[]    = { 0x00, 0xB0, 0x00, 0x00, 0x0F };
+  static const uint8_t selNdef[] = { 0x00, 0xA4, 0x00, 0x0C, 0x02, 0xE1, 0x04 };
+  static const uint8_t rdNlen[]  = { 0x00, 0xB0, 0x00, 0x00, 0x02 };
+  static const uint8_t rdNdef[]  = { 0x00, 0xB0, 0x00, 0x02, 0x0C };
+  static const uint8_t updNlen[] = { 0x00, 0xD6, 0x00, 0x00, 0x02, 0x00, 0x00 };
+  static const uint8_t getData[] = { 0x80, 0xCA, 0x9F, 0x7F, 0x00 };
+  static const uint8_t miss[]    = { 0x90, 0x60, 0x00, 0x00, 0x00 };
+  static const uint8_t r9000[]   = { 0x90, 0x00 };
+  static const uint8_t rCc[]     = { 0x00, 0x0F, 0x20, 0x00, 0x3B, 0x00, 0x34, 0x04, 0x06, 0xE1, 0x04, 0x04, 0x00, 0x00, 0x00, 0x90, 0x00 };
+  static const uint8_t rNlen[]   = { 0x00, 0x0C, 0x90, 0x00 };
+  static const uint8_t rNdef[]   = { 0xD1, 0x01, 0x08, 0x55, 0x01, 's', 't', '.', 'c', 'o', 'm', 0x00, 0x90, 0x00 };
+  static const uint8_t rRule[]   = { 0x12, 0x34, 0x90, 0x00 };
+  static const uint8_t qNlen[]   = { 0x00, 0x00, 0x02 };
+  uint8_t         out[16];
+  uint16_t        outLen = sizeof(out);
+  struct timespec t0, t1;
+  const int       N = 1000000;
+  int             i;
+
+  ceInitalize();
+  ceStart(start, sizeof(start));
+  ceHandler();   /* Activation */
+
+  /* NDEF mode without PROCESS_INTERNAL: the host owns the NDEF application until SET_NDEF */
+  expectForwarded("SELECT (no file)", selApp, sizeof(selApp));
+
+  ceSetNdef(ndef, sizeof(ndef));
+  ceAddRule(rule, sizeof(rule));
+  expect("SELECT AID", selApp, sizeof(selApp), r9000, sizeof(r9000));
+  expect("SELECT CC", selCc, sizeof(selCc), r9000, sizeof(r9000));
+  expect("READ CC", rdCc, sizeof(rdCc), rCc, sizeof(rCc));
+  expect("SELECT NDEF", selNdef, sizeof(selNdef), r9000, sizeof(r9000));
+  expect("READ NLEN", rdNlen, sizeof(rdNlen), rNlen, sizeof(rNlen));
+  expect("READ NDEF", rdNdef, sizeof(rdNdef), rNdef, sizeof(rNdef));
+  expect("rule GET DATA", getData, sizeof(getData), rRule, sizeof(rRule));
+  expectForwarded("unknown APDU", miss, sizeof(miss));
+  expect("UPDATE NLEN", updNlen, sizeof(updNlen), r9000, sizeof(r9000));
+  ceGetNdef(qNlen, sizeof(qNlen), out, &outLen);
+  printf("NLEN after UPDATE: %02X%02X\n", out[0], out[1]);
+  if( (out[0] != 0U) || (out[1] != 0U) )
+  {
+    fail++;
+  }
+
+  /* Cost of an APDU answered on target (host CPU), versus a USB poll round trip before */
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for( i = 0; i < N; i++ )
+  {
+    exchange(rdNdef, sizeof(rdNdef));
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  printf("READ BINARY answered locally: %.0f ns per APDU (host)\n",
+         (((double)(t1.tv_sec - t0.tv_sec) * 1e9) + (double)(t1.tv_nsec - t0.tv_nsec)) / N);
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,385 @@
+/**
+  ******************************************************************************
+  * @file    jpg_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the JPEG display path (jpeg_decode.c, st25_discovery_lcd.c)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "st25_discovery_lcd.h"
+#include "jpeglib.h"
+#include "lcd_model.h"
+
+/* Bundled pictures of the demo */
+#include "st_logo_jpg.h"
+#include "bridgebynight_jpg.h"
+#include "mountainview_jpg.h"
+#include "running_jpg.h"
+#include "stwireless_jpg.h"
+#include "Gauge_320x240_jpg.h"
+#include "Contact_jpg.h"
+#include "home_64x64_jpg.h"
+#include "aat_100x100_jpg.h"
+#include "nmark_64x64_jpg.h"
+
+#define REPS        20
+#define MIN_PSNR    35.0    /* Fast integer IDCT and RGB565 against the float IDCT */
+#define GREY_TOL    6       /* Luma levels */
+
+/* Size once decoded at n/8, as the libJPEG rounds it */
+#define SCALED(size, n)   ((((size) * (n)) + 7U) / 8U)
+
+typedef struct
+{
+  const char *name;
+  const char *jpg;
+} picture;
+
+static const picture pictures[] =
+{
+  { "st_logo",         cStLogo            },
+  { "bridgebynight",   cBridgeByNight     },
+  { "mountainview",    cMountainView      },
+  { "running",         cRunning           },
+  { "stwireless",      cStWireless        },
+  { "Gauge_320x240",   Gauge_320x240      },
+  { "Contact",         Contact            },
+  { "home_64x64",      cHome              },
+  { "aat_100x100",     aat_100x100        },
+  { "nmark_64x64",     nmark_64x64        },
+};
+
+/*
+******************************************************************************
+* REFERENCE DECODER
+******************************************************************************
+*/
+/* Decodes with the libJPEG API only: float IDCT at full scale, RGB565 output */
+static uint16_t *refDecode(const char *jpg, size_t len, unsigned scaleNum, unsigned grey, uint32_t *w, uint32_t *h)
+{
+  struct jpeg_decompress_struct d;
+  struct jpeg_error_mgr         je;
+  uint16_t                     *img;
+  JSAMPROW                      row;
+  uint32_t                      x;
+
+  d.err = jpeg_std_error(&je);
+  jpeg_create_decompress(&d);
+  jpeg_mem_src(&d, (unsigned char *)jpg, len);
+  jpeg_read_header(&d, TRUE);
+  d.scale_num       = scaleNum;
+  d.scale_denom     = 8;
+  d.dct_method      = JDCT_FLOAT;
+  d.out_color_space = (grey != 0U) ? JCS_GRAYSCALE : JCS_RGB;
+  jpeg_start_decompress(&d);
+  *w  = d.output_width;
+  *h  = d.output_height;
+  img = malloc(sizeof(uint16_t) * (*w) * (*h));
+  row = malloc((size_t)d.output_components * (*w));
+  while( d.output_scanline < d.output_height )
+  {
+    uint16_t *out = &img[d.output_scanline * (*w)];
+
+    jpeg_read_scanlines(&d, &row, 1);
+    for( x = 0; x < *w; x++ )
+    {
+      if( grey != 0U )
+      {
+        out[x] = row[x];   /* Luma only, compared as such */
+      }
+      else
+      {
+        out[x] = (uint16_t)(((row[3 * x] & 0xF8U) << 8) | ((row[(3 * x) + 1] & 0xFCU) << 3) | (row[(3 * x) + 2] >> 3));
+      }
+    }
+  }
+  jpeg_finish_decompress(&d);
+  jpeg_destroy_decompress(&d);
+  free(row);
+  return img;
+}
+
+/* The C array of a bundled picture is padded: the data ends at the EOI marker */
+static size_t jpgLen(const char *jpg)
+{
+  size_t i = 2;
+
+  while( !(((uint8_t)jpg[i] == 0xFFU) && ((uint8_t)jpg[i + 1] == 0xD9U)) )
+  {
+    i++;
+  }
+  return i + 2U;
+}
+
+/* PSNR of the LCD window at (0,0) against the reference picture window at (col,row) */
+static double psnr(const uint16_t *ref, uint32_t refW, uint32_t col, uint32_t row, uint32_t w, uint32_t h)
+{
+  double   se = 0.0;
+  uint32_t x, y;
+  int      c;
+
+  for( y = 0; y < h; y++ )
+  {
+    for( x = 0; x < w; x++ )
+    {
+      uint16_t a = lcdModelFb[y][x];
+      uint16_t b = ref[((row + y) * refW) + col + x];
+      int      ca[3] = { (a >> 11) << 3, ((a >> 5) & 0x3F) << 2, (a & 0x1F) << 3 };
+      int      cb[3] = { (b >> 11) << 3, ((b >> 5) & 0x3F) << 2, (b & 0x1F) << 3 };
+
+      for( c = 0; c < 3; c++ )
+      {
+        se += (double)(ca[c] - cb[c]) * (ca[c] - cb[c]);
+      }
+    }
+  }
+  return (se == 0.0) ? 99.0 : 10.0 * log10((255.0 * 255.0 * 3.0 * w * h) / se);
+}
+
+/* Large photo: a bundled picture upscaled x6 (bilinear) and encoded at quality 90 */
+static char *mkPhoto(const char *jpg, size_t len, unsigned k, uint32_t *pw, uint32_t *ph)
+{
+  struct jpeg_decompress_struct d;
+  struct jpeg_compress_struct   c;
+  struct jpeg_error_mgr         je;
+  unsigned char                *img;
+  unsigned char                *big;
+  unsigned char                *out = NULL;
+  unsigned long                 outLen = 0;
+  JSAMPROW                      row;
+  uint32_t                      w, h, W, H, x, y;
+  int                           ch;
+
+  d.err = jpeg_std_error(&je);
+  jpeg_create_decompress(&d);
+  jpeg_mem_src(&d, (unsigned char *)jpg, len);
+  jpeg_read_header(&d, TRUE);
+  jpeg_start_decompress(&d);
+  w   = d.output_width;
+  h   = d.output_height;
+  img = malloc(3U * w * h);
+  while( d.output_scanline < h )
+  {
+    row = &img[d.output_scanline * w * 3U];
+    jpeg_read_scanlines(&d, &row, 1);
+  }
+  jpeg_finish_decompress(&d);
+  jpeg_destroy_decompress(&d);
+
+  W   = w * k;
+  H   = h * k;
+  big = malloc(3U * W * H);
+  for( y = 0; y < H; y++ )
+  {
+    for( x = 0; x < W; x++ )
+    {
+      float    fx = ((x + 0.5f) / k) - 0.5f;
+      float    fy = ((y + 0.5f) / k) - 0.5f;
+      uint32_t x0, y0, x1, y1;
+      float    ax, ay;
+
+      fx = (fx < 0.0f) ? 0.0f : fx;
+      fy = (fy < 0.0f) ? 0.0f : fy;
+      x0 = (uint32_t)fx;
+      y0 = (uint32_t)fy;
+      x1 = ((x0 + 1U) < w) ? (x0 + 1U) : x0;
+      y1 = ((y0 + 1U) < h) ? (y0 + 1U) : y0;
+      ax = fx - x0;
+      ay = fy - y0;
+      for( ch = 0; ch < 3; ch++ )
+      {
+        float v = (((img[((y0 * w) + x0) * 3 + ch] * (1 - ax)) + (img[((y0 * w) + x1) * 3 + ch] * ax)) * (1 - ay)) +
+                  (((img[((y1 * w) + x0) * 3 + ch] * (1 - ax)) + (img[((y1 * w) + x1) * 3 + ch] * ax)) * ay);
+        big[((y * W) + x) * 3 + ch] = (unsigned char)(v + 0.5f);
+      }
+    }
+  }
+
+  c.err = jpeg_std_error(&je);
+  jpeg_create_compress(&c);
+  jpeg_mem_dest(&c, &out, &outLen);
+  c.image_width      = W;
+  c.image_height     = H;
+  c.input_components = 3;
+  c.in_color_space   = JCS_RGB;
+  jpeg_set_defaults(&c);
+  jpeg_set_quality(&c, 90, TRUE);
+  jpeg_start_compress(&c, TRUE);
+  while( c.next_scanline < H )
+  {
+    row = &big[c.next_scanline * W * 3U];
+    jpeg_write_scanlines(&c, &row, 1);
+  }
+  jpeg_finish_compress(&c);
+  jpeg_destroy_compress(&c);
+  free(img);
+  free(big);
+  *pw = W;
+  *ph = H;
+  return (char *)out;
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+typedef enum { FIT, GREY, CROP } mode;
+
+static double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + (t.tv_nsec * 1e-9);
+}
+
+/* Displays a picture REPS times: best host CPU time, LCD transfers of one display */
+static double display(const char *jpg, mode m)
+{
+  Point  pos  = { 0, 0 };
+  Point  from = { 20, 30 };
+  double best = 1e9;
+  int    r;
+
+  BSP_LCD_SetGreyScale((m == GREY) ? 1U : 0U);
+  for( r = 0; r < REPS; r++ )
+  {
+    double t;
+
+    lcdModelReset();
+    t = now();
+    if( m == CROP )
+    {
+      BSP_LCD_DisplayCropJpeg(&pos, &from, 100, 80, jpg);
+    }
+    else
+    {
+      BSP_LCD_DisplayCropPicture(0, 0, 320, 240, jpg);
+    }
+    t = now() - t;
+    best = (t < best) ? t : best;
+  }
+  BSP_LCD_SetGreyScale(0);
+  return best * 1e3;
+}
+
+static void report(const char *name, double cpu, unsigned long txn, double bus, double q)
+{
+  printf("%-32s cpu %5.2f ms  LCD transactions %4lu  bus %6.1f ms", name, cpu, txn, bus);
+  if( q > 0.0 )
+  {
+    printf("  PSNR %4.1f dB", q);
+  }
+  printf("\n");
+}
+
+int main(void)
+{
+  const int n = (int)(sizeof(pictures) / sizeof(pictures[0]));
+  double    cpu = 0.0;
+  double    bus = 0.0;
+  double    worst = 99.0;
+  unsigned long txn = 0;
+  uint16_t *ref;
+  uint32_t  w, h, pw, ph, scale;
+  char     *photo;
+  double    q;
+  int       fail = 0;
+  int       bad;
+  int       i;
+
+  BSP_LCD_Init();
+
+  /* Every bundled picture at full scale (none is bigger than the LCD) */
+  for( i = 0; i < n; i++ )
+  {
+    cpu += display(pictures[i].jpg, FIT);
+    txn += lcdModelCnt.transactions;
+    bus += lcdModelBusMs();
+    ref  = refDecode(pictures[i].jpg, jpgLen(pictures[i].jpg), 8, 0, &w, &h);
+    q    = psnr(ref, w, 0, 0, w, h);
+    worst = (q < worst) ? q : worst;
+    fail += (q < MIN_PSNR) ? 1 : 0;
+    free(ref);
+  }
+  {
+    char name[40];
+
+    snprintf(name, sizeof(name), "%d bundled pictures (worst)", n);
+    report(name, cpu, txn, bus, worst);
+  }
+
+  /* st_logo in grey: luma only, mapped through the palette */
+  cpu = display(cStLogo, GREY);
+  ref = refDecode(cStLogo, jpgLen(cStLogo), 8, 1, &w, &h);
+  bad = 0;
+  for( i = 0; i < (int)(w * h); i++ )
+  {
+    /* Palette colour of a luma level close to the reference one (IDCT rounding) */
+    int l = ((int)ref[i] > GREY_TOL) ? ((int)ref[i] - GREY_TOL) : 0;
+
+    while( (l <= ((int)ref[i] + GREY_TOL)) && (l < 256) &&
+           (BSP_LCD_FadeColor(LCD_COLOR_GRAY, LCD_COLOR_WHITE, 255, l) != lcdModelFb[i / w][i % w]) )
+    {
+      l++;
+    }
+    bad += ((l > ((int)ref[i] + GREY_TOL)) || (l == 256)) ? 1 : 0;
+  }
+  fail += bad;
+  free(ref);
+  report("st_logo greyscale", cpu, lcdModelCnt.transactions, lcdModelBusMs(), -1.0);
+  printf("  %d pixel(s) off the grey palette\n", bad);
+
+  /* st_logo 100x80 crop from (20,30): same pixels as the full display */
+  ref = refDecode(cStLogo, jpgLen(cStLogo), 8, 0, &w, &h);
+  cpu = display(cStLogo, CROP);
+  q   = psnr(ref, w, 20, 30, 100, 80);
+  fail += (q < MIN_PSNR) ? 1 : 0;
+  free(ref);
+  report("st_logo 100x80 crop", cpu, lcdModelCnt.transactions, lcdModelBusMs(), q);
+
+  /* Large photo fitted to the LCD: DCT scaled to the smallest N/8 covering 320x240, centered */
+  photo = mkPhoto(cBridgeByNight, jpgLen(cBridgeByNight), 6, &pw, &ph);
+  cpu   = display(photo, FIT);
+  w     = pw;
+  h     = ph;
+  for( scale = 1; scale < 8; scale++ )
+  {
+    if( (SCALED(w, scale) >= 320U) && (SCALED(h, scale) >= 240U) )
+    {
+      break;
+    }
+  }
+  ref = refDecode(photo, jpgLen(photo), scale, 0, &w, &h);
+  q   = psnr(ref, w, (w - 320U) / 2U, (h - 240U) / 2U, 320, 240);
+  fail += (q < MIN_PSNR) ? 1 : 0;
+  free(ref);
+  {
+    char name[40];
+
+    snprintf(name, sizeof(name), "%ux%u photo at %u/8", (unsigned)pw, (unsigned)ph, (unsigned)scale);
+    report(name, cpu, lcdModelCnt.transactions, lcdModelBusMs(), q);
+  }
+  free(photo);
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
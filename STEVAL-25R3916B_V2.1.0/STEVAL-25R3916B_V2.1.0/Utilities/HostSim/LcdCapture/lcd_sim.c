@@ -0,0 +1,218 @@
+/**
+  ******************************************************************************
+  * @file    lcd_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the ILI9341 GRAM readback (ili9341_cube.c) over a SPI model
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ili9341_cube.h"
+
+#define W            320
+#define H            240
+#define SPI_US_BYTE  3.2     /* 2.5 MHz read clock */
+#define SPI_US_TXN   4.0     /* CS, command and DC switching per transaction */
+
+/*
+******************************************************************************
+* GRAM MODEL
+******************************************************************************
+*/
+static uint8_t  gram[H][W][3];   /* 18-bit pixels as read back: R, G, B with 2 LSBs unused */
+static uint8_t  reg;
+static int      argn;
+static uint8_t  args[4];
+static uint16_t xs, xe, ys, ye;
+static long     txn;
+static long     bytes;
+
+/* RAMRD: dummy byte, then R, G, B per pixel from the window start, wrapping at the column end */
+static void gramRead(uint8_t *buf, uint32_t len)
+{
+  uint32_t i;
+  uint32_t n;
+  int      x = xs;
+  int      y = ys;
+
+  buf[0] = 0xA5;
+  for( i = 1; i < len; i += 3 )
+  {
+    n = ((len - i) < 3U) ? (len - i) : 3U;
+    if( (x >= W) || (y >= H) )
+    {
+      memset(&buf[i], 0xEE, n);
+    }
+    else
+    {
+      memcpy(&buf[i], gram[y][x], n);
+    }
+    if( ++x > xe )
+    {
+      x = xs;
+      y++;
+    }
+  }
+}
+
+/*
+******************************************************************************
+* LCD IO STUBS
+******************************************************************************
+*/
+void LCD_IO_Init(void)                                       { }
+void LCD_Delay(uint32_t delay)                               { (void)delay; }
+void LCD_IO_WriteData16(uint16_t v)                          { (void)v; txn++; bytes += 2; }
+void LCD_IO_WriteBuffer16(uint16_t *b, uint32_t l)           { (void)b; txn++; bytes += 2 * l; }
+void LCD_IO_WriteConstBuffer16(const uint16_t *b, uint32_t l) { (void)b; txn++; bytes += 2 * l; }
+void LCD_IO_WriteRepeat16(uint16_t v, uint32_t c)            { (void)v; txn++; bytes += 2 * c; }
+void LCD_IO_Notify(void (*cb)(void))                         { cb(); }
+void LCD_IO_WaitIdle(void)                                   { }
+
+void LCD_IO_WriteReg(uint8_t r)
+{
+  reg  = r;
+  argn = 0;
+  txn++;
+  bytes++;
+}
+
+void LCD_IO_WriteData(uint8_t v)
+{
+  txn++;
+  bytes++;
+  if( argn < 4 )
+  {
+    args[argn++] = v;
+  }
+  if( argn == 4 )
+  {
+    if( reg == 0x2A )
+    {
+      xs = (uint16_t)((args[0] << 8) | args[1]);
+      xe = (uint16_t)((args[2] << 8) | args[3]);
+    }
+    if( reg == 0x2B )
+    {
+      ys = (uint16_t)((args[0] << 8) | args[1]);
+      ye = (uint16_t)((args[2] << 8) | args[3]);
+    }
+  }
+}
+
+uint32_t LCD_IO_ReadData(uint16_t r, uint8_t n)
+{
+  uint8_t b[4] = { 0, 0, 0, 0 };
+
+  txn++;
+  bytes += 1 + n;
+  if( r == 0x2E )
+  {
+    gramRead(b, n);
+  }
+  return ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | b[3];
+}
+
+void LCD_IO_ReadBuffer(uint16_t r, uint8_t *buf, uint32_t len)
+{
+  (void)r;
+  txn++;
+  bytes += 1 + len;
+  gramRead(buf, len);
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+static double busTime(long t, long b)
+{
+  return ((b * SPI_US_BYTE) + (t * SPI_US_TXN)) / 1e6;
+}
+
+int main(void)
+{
+  static const int widths[] = { 1, 3, 7, 40, 161, 319 };
+  static uint16_t  ref[H * W];
+  static uint8_t   out[H * W * 2];
+  long             t1, b1;
+  int              fail = 0;
+  int              bad = 0;
+  int              x, y, k, i;
+
+  srand(1);
+  for( y = 0; y < H; y++ )
+  {
+    for( x = 0; x < W; x++ )
+    {
+      for( i = 0; i < 3; i++ )
+      {
+        gram[y][x][i] = (uint8_t)(rand() & 0xFC);
+      }
+    }
+  }
+
+  /* Reference: the former capture, one window setup and 4-byte RAMRD per pixel */
+  txn = bytes = 0;
+  for( y = 0; y < H; y++ )
+  {
+    for( x = 0; x < W; x++ )
+    {
+      ref[(y * W) + x] = ili9341_ReadPixel((uint16_t)x, (uint16_t)y);
+    }
+  }
+  t1 = txn;
+  b1 = bytes;
+
+  txn = bytes = 0;
+  ili9341_ReadRegion(0, 0, W, H, out);
+  for( i = 0; i < (W * H); i++ )
+  {
+    bad += ((out[2 * i] | (out[(2 * i) + 1] << 8)) != ref[i]) ? 1 : 0;
+  }
+  printf("320x240 pixel loop: %7ld transactions %8ld bytes  %.2f s\n", t1, b1, busTime(t1, b1));
+  printf("320x240 row reads : %7ld transactions %8ld bytes  %.2f s  mismatches %d\n", txn, bytes, busTime(txn, bytes), bad);
+  fail += bad;
+
+  /* Narrow regions: several rows per burst, windows ending on the last column */
+  for( k = 0; k < (int)(sizeof(widths) / sizeof(widths[0])); k++ )
+  {
+    int w  = widths[k];
+    int h  = 37;
+    int x0 = W - w - (k % 2);
+    int y0 = 200;
+
+    memset(out, 0, sizeof(out));
+    txn = 0;
+    ili9341_ReadRegion((uint16_t)x0, (uint16_t)y0, (uint16_t)w, (uint16_t)h, out);
+    bad = 0;
+    for( y = 0; y < h; y++ )
+    {
+      for( x = 0; x < w; x++ )
+      {
+        i    = (y * w) + x;
+        bad += ((out[2 * i] | (out[(2 * i) + 1] << 8)) != ref[((y0 + y) * W) + x0 + x]) ? 1 : 0;
+      }
+    }
+    printf("region x=%3d w=%3d h=%d: %4ld transactions, mismatches %d\n", x0, w, h, txn, bad);
+    fail += bad;
+  }
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,503 @@
+/**
+  ******************************************************************************
+  * @file    dma_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the LCD transfer queue (st25_discovery.c) over a SPI2/DMA model
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "st25_discovery.h"
+#include "st25_discovery_lcd.h"
+#include "jpeg_decode.h"
+#include "hal_model.h"
+#include "lcd_model.h"
+
+/* Cost of the SPI calls, CPU cycles (the frames cost 8 or 16 bits at the SPI clock) */
+#define COST_POLL       120U   /* HAL_SPI_Transmit call and end of transfer checks   */
+#define COST_SPI_INIT   250U   /* HAL_SPI_Init (data width or clock change)          */
+#define COST_DMA_START  200U   /* HAL_SPI_Transmit_DMA and HAL_DMA_Start_IT          */
+#define COST_DMA_ISR    300U   /* Entry, HAL_DMA_IRQHandler, end of transfer checks  */
+
+extern uint32_t SpixTimeout;
+
+/* BSP handler of the DMA interrupt: not there before the transfer queue */
+void BSP_LCD_DMA_IRQHandler(void) __attribute__((weak));
+
+static unsigned long spiOps;
+
+/*
+******************************************************************************
+* STUBS
+******************************************************************************
+*/
+uint32_t jpeg_decode(const char* jpeg,
+                     uint8_t (*setup)(uint32_t Width, uint32_t Height, jpeg_window_t *Window),
+                     uint8_t (*callback)(uint16_t *Pixels, uint32_t NbPixels))
+{
+  (void)jpeg; (void)setup; (void)callback;
+  return 0;
+}
+
+void jpeg_getsize(const char* jpeg, uint32_t* Width, uint32_t* Height)
+{
+  (void)jpeg;
+  *Width  = 0;
+  *Height = 0;
+}
+
+/* Before the transfer queue (and with ST25_DISCOVERY_LCD_DMA=0) every write is done on return */
+__attribute__((weak)) void LCD_IO_Notify(void (*Callback)(void))
+{
+  Callback();
+}
+
+__attribute__((weak)) void LCD_IO_WaitIdle(void)
+{
+}
+
+__attribute__((weak)) void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  (void)hspi;
+}
+
+/*
+******************************************************************************
+* MODEL: SPI2, DMA1 CHANNEL 5, ILI9341
+******************************************************************************
+*/
+static struct
+{
+  int                active;
+  int                lost;     /* Completion never raised (lost interrupt test) */
+  const uint16_t    *src;
+  uint32_t           n;
+  int                minc;
+  DMA_HandleTypeDef *hdma;
+} dma;
+
+static int lostNext;
+
+static int csLow(void)
+{
+  return (ST25_DISCOVERY_SPI2_SCK_NSS_GPIO_PORT->ODR & ST25_DISCOVERY_SPI2_NSS_PIN) == 0U;
+}
+
+static int wrxHigh(void)
+{
+  return (ST25_DISCOVERY_LCD_WRX_GPIO_PORT->ODR & ST25_DISCOVERY_LCD_WRX_PIN) != 0U;
+}
+
+/* CPU cycles per bit: PCLK (80 MHz) divided by the baud rate prescaler */
+static uint32_t bitCycles(const SPI_HandleTypeDef *hspi)
+{
+  return 2U << (hspi->Init.BaudRatePrescaler >> SPI_CR1_BR_Pos);
+}
+
+static void sendFrame(const SPI_HandleTypeDef *hspi, uint16_t frame)
+{
+  if( !csLow() )
+  {
+    halModelError("LCD write with CS high");
+    return;
+  }
+  if( hspi->Init.DataSize == SPI_DATASIZE_16BIT )
+  {
+    if( wrxHigh() )
+    {
+      lcdModelPixel(frame);
+    }
+    else
+    {
+      halModelError("16 bits command");
+    }
+  }
+  else if( wrxHigh() )
+  {
+    lcdModelData((uint8_t)frame);
+  }
+  else
+  {
+    lcdModelCommand((uint8_t)frame);
+  }
+}
+
+/* End of a DMA transfer: the DMA reads the memory while it runs, the data is taken now */
+static void dmaDone(void)
+{
+  uint32_t i;
+
+  for( i = 0; i < dma.n; i++ )
+  {
+    sendFrame(dma.hdma->Parent, dma.src[(dma.minc != 0) ? i : 0U]);
+  }
+  dma.active = 0;
+  halModelAdvance(COST_DMA_ISR);
+  if( BSP_LCD_DMA_IRQHandler != NULL )
+  {
+    BSP_LCD_DMA_IRQHandler();
+  }
+}
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
+{
+  hspi->State = HAL_SPI_STATE_READY;
+  halModelAdvance(COST_SPI_INIT);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef *hspi)
+{
+  hspi->State = HAL_SPI_STATE_RESET;
+  halModelAdvance(COST_SPI_INIT);
+  return HAL_OK;
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef *hspi)
+{
+  return hspi->State;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  uint32_t bits = (hspi->Init.DataSize == SPI_DATASIZE_16BIT) ? 16U : 8U;
+  uint16_t i;
+
+  (void)Timeout;
+  if( dma.active )
+  {
+    halModelError("polled transmit during a DMA transfer");
+  }
+  spiOps++;
+  for( i = 0; i < Size; i++ )
+  {
+    sendFrame(hspi, (bits == 16U) ? ((uint16_t *)pData)[i] : pData[i]);
+  }
+  halModelAdvance(COST_POLL + (Size * bits * bitCycles(hspi)));
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  (void)Timeout;
+  memset(pData, 0, Size);
+  halModelAdvance(COST_POLL + (Size * 8U * bitCycles(hspi)));
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+  if( dma.active )
+  {
+    halModelError("DMA restarted while busy");
+    return HAL_BUSY;
+  }
+  if( (hspi->Init.DataSize != SPI_DATASIZE_16BIT) || !wrxHigh() || !csLow() )
+  {
+    halModelError("DMA started with a wrong bus state");
+  }
+  spiOps++;
+  halModelAdvance(COST_DMA_START);
+  dma.active = 1;
+  dma.lost   = lostNext;
+  dma.src    = (const uint16_t *)pData;
+  dma.n      = Size;
+  dma.minc   = (hspi->hdmatx->Instance->CCR & DMA_CCR_MINC) != 0U;
+  dma.hdma   = hspi->hdmatx;
+  lostNext   = 0;
+  if( !dma.lost )
+  {
+    halModelRaise(DMA1_Channel5_IRQn, halModelNow + (Size * 16U * bitCycles(hspi)), dmaDone);
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+  hdma->Instance->CCR = hdma->Init.MemInc;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  halModelCancel(DMA1_Channel5_IRQn);
+  dma.active = 0;
+  halModelAdvance(COST_POLL);
+  return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+  HAL_SPI_TxCpltCallback((SPI_HandleTypeDef *)hdma->Parent);
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+#define FB_SIZE   sizeof(lcdModelFb)
+
+static FILE    *save;
+static FILE    *check;
+static int      fail;
+static uint64_t t0;
+static uint64_t isr0;
+static uint64_t appWork;
+static unsigned long ops0;
+
+static void start(void)
+{
+  LCD_IO_WaitIdle();
+  lcdModelClear(0);
+  t0      = halModelNow;
+  isr0    = halModelIsrCycles;
+  ops0    = spiOps;
+  appWork = 0;
+}
+
+static void work(uint64_t cycles)
+{
+  halModelWork(cycles);
+  appWork += cycles;
+}
+
+/* "LCD CPU": time not available to the application until the last call returned, plus the
+   interrupts of the final drain (the application runs during the drain) */
+static void stop(const char *what)
+{
+  static uint16_t ref[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+  uint64_t        cpuEnd = halModelNow;
+  uint64_t        isr1   = halModelIsrCycles;
+  uint64_t        lcd;
+  const char     *cmp = "";
+
+  LCD_IO_WaitIdle();
+  lcd = (cpuEnd - t0 - appWork) + (halModelIsrCycles - isr1);
+  if( save != NULL )
+  {
+    fwrite(lcdModelFb, 1, FB_SIZE, save);
+  }
+  if( check != NULL )
+  {
+    cmp = "same";
+    if( (fread(ref, 1, FB_SIZE, check) != FB_SIZE) || (memcmp(ref, lcdModelFb, FB_SIZE) != 0) )
+    {
+      cmp = "differs";
+      fail++;
+    }
+  }
+  printf("%-32s screen %8.3f ms  app %7.3f ms  LCD CPU %8.3f ms (isr %6.3f)  spi ops %6lu  %s\n", what,
+         HAL_MODEL_MS(halModelNow - t0), HAL_MODEL_MS(appWork), HAL_MODEL_MS(lcd),
+         HAL_MODEL_MS(halModelIsrCycles - isr0), spiOps - ops0, cmp);
+}
+
+/* Notify ordering: the pixel drawn just before must be in the GRAM when the callback runs */
+static struct
+{
+  int      x;
+  int      y;
+  uint16_t color;
+} expected[1024];
+static int nExpected;
+static int nNotified;
+static int outOfOrder;
+
+static void notified(void)
+{
+  if( lcdModelFb[expected[nNotified].y][expected[nNotified].x] != expected[nNotified].color )
+  {
+    outOfOrder++;
+  }
+  nNotified++;
+}
+
+int main(int argc, char **argv)
+{
+  static uint16_t strip[16 * 320];
+  static uint8_t  pict[2 * 96 * 64];
+  unsigned long   errors;
+  int             i;
+
+  if( (argc == 3) && (strcmp(argv[1], "-save") == 0) )
+  {
+    save = fopen(argv[2], "wb");
+  }
+  if( (argc == 3) && (strcmp(argv[1], "-check") == 0) )
+  {
+    check = fopen(argv[2], "rb");
+  }
+  if( (argc != 1) && (save == NULL) && (check == NULL) )
+  {
+    fprintf(stderr, "usage: dma_sim [-save ref.raw | -check ref.raw]\n");
+    return 2;
+  }
+
+  BSP_LCD_Init();
+  BSP_LCD_SetFont(&Font16);
+  srand(7);
+
+  start();
+  BSP_LCD_Clear(LCD_COLOR_WHITE);
+  for( i = 0; i < 12; i++ )
+  {
+    work(4000);
+    BSP_LCD_SetTextColor((uint16_t)(i * 0x1111));
+    BSP_LCD_DisplayStringAt(0, (uint16_t)(10 + (i * 18)), (uint8_t *)"Menu entry text ##", LEFT_MODE);
+  }
+  stop("menu (clear + 12 strings)");
+
+  /* Screen change followed by 25 ms of application work */
+  start();
+  BSP_LCD_Clear(LCD_COLOR_BLUE);
+  work(25U * (HAL_MODEL_HZ / 1000U));
+  BSP_LCD_SetTextColor(LCD_COLOR_WHITE);
+  BSP_LCD_DisplayStringAt(0, 100, (uint8_t *)"Ready", CENTER_MODE);
+  stop("clear + 25 ms app work + title");
+
+  /* Decoder output: the strip buffer is reused as soon as the write returns */
+  start();
+  for( i = 0; i < 15; i++ )
+  {
+    int p;
+
+    work(16U * 320U * 40U);   /* Decode and colour conversion, ~40 cycles per pixel */
+    for( p = 0; p < (16 * 320); p++ )
+    {
+      strip[p] = (uint16_t)((i * 977) + (p * 13));
+    }
+    BSP_LCD_SetDisplayWindow(0, (uint16_t)(i * 16), 319, 15);
+    LCD_IO_WriteBuffer16(strip, 16U * 320U);
+    memset(strip, 0xA5, sizeof(strip));
+  }
+  stop("JPEG-like 16-row strips");
+
+  start();
+  for( i = 0; i < 60; i++ )
+  {
+    work(1500);
+    BSP_LCD_SetTextColor((uint16_t)rand());
+    BSP_LCD_FillRect((uint16_t)(rand() % 280), (uint16_t)(rand() % 200), (uint16_t)(1 + (rand() % 40)), (uint16_t)(rand() % 40));
+  }
+  for( i = 0; i < 200; i++ )
+  {
+    work(1500);
+    BSP_LCD_SetTextColor((uint16_t)rand());
+    if( (i & 1) != 0 )
+    {
+      BSP_LCD_DrawHLine((uint16_t)(rand() % 200), (uint16_t)(rand() % 240), (uint16_t)(1 + (rand() % 120)));
+    }
+    else
+    {
+      BSP_LCD_DrawVLine((uint16_t)(rand() % 320), (uint16_t)(rand() % 120), (uint16_t)(1 + (rand() % 120)));
+    }
+  }
+  stop("60 rects + 200 h/v lines");
+
+  /* Lines, text, fills, pixels and blits, with Notify after some rectangles */
+  start();
+  for( i = 0; i < (int)sizeof(pict); i++ )
+  {
+    pict[i] = (uint8_t)rand();
+  }
+  for( i = 0; i < 3000; i++ )
+  {
+    int      op    = rand() % 5;
+    uint16_t x     = (uint16_t)(rand() % 300);
+    uint16_t y     = (uint16_t)(rand() % 220);
+    uint16_t color = (uint16_t)rand();
+
+    work((uint64_t)(rand() % 3000));
+    switch( op )
+    {
+      case 0:
+        BSP_LCD_SetTextColor(color);
+        BSP_LCD_FillRect(x, y, (uint16_t)(1 + (rand() % 20)), (uint16_t)(1 + (rand() % 20)));
+        if( ((rand() & 7) == 0) && (nExpected < (int)(sizeof(expected) / sizeof(expected[0]))) )
+        {
+          expected[nExpected].x     = x;
+          expected[nExpected].y     = y;
+          expected[nExpected].color = color;
+          nExpected++;
+          LCD_IO_Notify(notified);
+        }
+        break;
+      case 1:
+        BSP_LCD_SetTextColor(color);
+        BSP_LCD_DrawLine(x, y, (uint16_t)(rand() % 320), (uint16_t)(rand() % 240));
+        break;
+      case 2:
+        BSP_LCD_SetTextColor(color);
+        BSP_LCD_DisplayStringAt((uint16_t)(x % 200), y, (uint8_t *)"Stress", LEFT_MODE);
+        break;
+      case 3:
+        BSP_LCD_BlitRGB565BE((uint16_t)(x % 224), (uint16_t)(y % 176), 96, 64, pict);
+        pict[rand() % (int)sizeof(pict)] ^= 0xFFU;   /* Caller changes its picture at once */
+        break;
+      default:
+        BSP_LCD_DrawPixel(x, y, color);
+        break;
+    }
+  }
+  stop("3000-op random mix");
+  printf("Notify callbacks %d/%d, out of order %d\n", nNotified, nExpected, outOfOrder);
+  if( (nNotified != nExpected) || (outOfOrder != 0) )
+  {
+    fail++;
+  }
+
+#if ST25_DISCOVERY_LCD_DMA
+  {
+    /* A DMA completion that never comes: the queue waits SpixTimeout ms, then drops the
+       transfer and goes on */
+    uint64_t lost0;
+
+    SpixTimeout = 10;
+    lostNext    = 1;
+    BSP_LCD_SetTextColor(LCD_COLOR_RED);
+    BSP_LCD_FillRect(0, 0, 320, 20);
+    lost0 = halModelNow;
+    BSP_LCD_SetTextColor(LCD_COLOR_GREEN);
+    BSP_LCD_FillRect(0, 0, 320, 20);
+    LCD_IO_WaitIdle();
+    printf("lost DMA completion: queue resumed after %.3f ms, %s\n", HAL_MODEL_MS(halModelNow - lost0),
+           (lcdModelFb[10][160] == LCD_COLOR_GREEN) ? "next fill drawn" : "next fill missing");
+    if( lcdModelFb[10][160] != LCD_COLOR_GREEN )
+    {
+      fail++;
+    }
+  }
+#endif /* ST25_DISCOVERY_LCD_DMA */
+
+  errors = halModelErrors;
+  printf("model errors %lu\n", errors);
+  if( save != NULL )
+  {
+    fclose(save);
+  }
+  if( check != NULL )
+  {
+    fclose(check);
+  }
+  if( errors != 0U )
+  {
+    fail++;
+  }
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,298 @@
+/**
+  ******************************************************************************
+  * @file    line_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the LCD line and bitmap drawing (st25_discovery_lcd.c) on a LCD model
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "st25_discovery_lcd.h"
+#include "lcd_model.h"
+#include "jpeg_decode.h"
+
+/*
+******************************************************************************
+* STUBS
+******************************************************************************
+*/
+/* The JPEG decoder is not used by the line and bitmap functions */
+uint32_t jpeg_decode(const char* jpeg,
+                     uint8_t (*setup)(uint32_t Width, uint32_t Height, jpeg_window_t *Window),
+                     uint8_t (*callback)(uint16_t *Pixels, uint32_t NbPixels))
+{
+  (void)jpeg; (void)setup; (void)callback;
+  return 0;
+}
+
+void jpeg_getsize(const char* jpeg, uint32_t* Width, uint32_t* Height)
+{
+  (void)jpeg;
+  *Width  = 0;
+  *Height = 0;
+}
+
+/*
+******************************************************************************
+* REFERENCE
+******************************************************************************
+*/
+static uint16_t ref[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+
+static void refPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if( ((uint16_t)x < LCD_MODEL_WIDTH) && ((uint16_t)y < LCD_MODEL_HEIGHT) )
+  {
+    ref[(uint16_t)y][(uint16_t)x] = color;
+  }
+}
+
+/* Stepping of BSP_LCD_DrawLine and FillTriangle, plot() called for each point */
+static void refWalk(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, void (*plot)(int16_t x, int16_t y))
+{
+  int16_t deltax = (int16_t)abs(x2 - x1);
+  int16_t deltay = (int16_t)abs(y2 - y1);
+  int16_t x = (int16_t)x1, y = (int16_t)y1;
+  int16_t xinc1 = (x2 >= x1) ? 1 : -1, xinc2 = xinc1;
+  int16_t yinc1 = (y2 >= y1) ? 1 : -1, yinc2 = yinc1;
+  int16_t den, num, numadd, numpixels, curpixel;
+
+  if( deltax >= deltay )
+  {
+    xinc1 = 0; yinc2 = 0; den = deltax; num = deltax / 2; numadd = deltay; numpixels = deltax;
+  }
+  else
+  {
+    xinc2 = 0; yinc1 = 0; den = deltay; num = deltay / 2; numadd = deltax; numpixels = deltay;
+  }
+  for( curpixel = 0; curpixel <= numpixels; curpixel++ )
+  {
+    plot(x, y);
+    num += numadd;
+    if( num >= den )
+    {
+      num -= den;
+      x += xinc1;
+      y += yinc1;
+    }
+    x += xinc2;
+    y += yinc2;
+  }
+}
+
+static uint16_t refColor;
+static int16_t  refX3, refY3;
+
+static void plotPixel(int16_t x, int16_t y)
+{
+  refPixel(x, y, refColor);
+}
+
+/* One pixel at a time, pixels out of the screen dropped */
+static void refLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+  refColor = color;
+  refWalk(x1, y1, x2, y2, plotPixel);
+}
+
+/* FillTriangle: a line from each point of the (1, 2) side to point 3 */
+static void plotFan(int16_t x, int16_t y)
+{
+  refWalk((uint16_t)x, (uint16_t)y, (uint16_t)refX3, (uint16_t)refY3, plotPixel);
+}
+
+static void refTriangle(int16_t x1, int16_t x2, int16_t x3, int16_t y1, int16_t y2, int16_t y3)
+{
+  refX3 = x3;
+  refY3 = y3;
+  refWalk((uint16_t)x1, (uint16_t)y1, (uint16_t)x2, (uint16_t)y2, plotFan);
+}
+
+/* BSP_LCD_FillPolygon: three triangles per side around the bounding box center */
+static void refPolygon(const Point *p, int n, uint16_t color)
+{
+  int16_t l = p[0].X, r = p[0].X, t = p[0].Y, b = p[0].Y;
+  int16_t xc, yc;
+  int     i;
+
+  for( i = 1; i < n; i++ )
+  {
+    l = (p[i].X < l) ? p[i].X : l;
+    r = (p[i].X > r) ? p[i].X : r;
+    t = (p[i].Y < t) ? p[i].Y : t;
+    b = (p[i].Y > b) ? p[i].Y : b;
+  }
+  xc = (int16_t)((l + r) / 2);
+  yc = (int16_t)((t + b) / 2);
+  refColor = color;
+  for( i = 0; i < n; i++ )
+  {
+    const Point *a = &p[i];
+    const Point *c = &p[(i + 1) % n];
+
+    refTriangle(a->X, c->X, xc, a->Y, c->Y, yc);
+    refTriangle(a->X, xc, c->X, a->Y, yc, c->Y);
+    refTriangle(xc, c->X, a->X, yc, c->Y, a->Y);
+  }
+}
+
+static void line(int x1, int y1, int x2, int y2, uint16_t color)
+{
+  BSP_LCD_SetTextColor(color);
+  BSP_LCD_DrawLine((uint16_t)x1, (uint16_t)y1, (uint16_t)x2, (uint16_t)y2);
+  refLine((uint16_t)x1, (uint16_t)y1, (uint16_t)x2, (uint16_t)y2, color);
+}
+
+/* In-house BMP: width - 1, height - 1, 3 unused bytes, then RGB565 high byte first */
+static char bmp[5 + (2 * 320 * 240)];
+
+static void makeBmp(int w, int h)
+{
+  int i;
+
+  bmp[0] = (char)(w - 1);
+  bmp[1] = (char)(h - 1);
+  for( i = 0; i < 2 * w * h; i++ )
+  {
+    bmp[5 + i] = (char)((i * 37) + (i >> 9));
+  }
+}
+
+static void picture(int x0, int y0)
+{
+  int w = (uint8_t)bmp[0] + 1;
+  int h = (uint8_t)bmp[1] + 1;
+  int x, y;
+
+  BSP_LCD_DisplayPicture((uint16_t)x0, (uint16_t)y0, bmp);
+  for( y = 0; y < h; y++ )
+  {
+    for( x = 0; x < w; x++ )
+    {
+      const uint8_t *p = (const uint8_t *)&bmp[5 + (2 * ((y * w) + x))];
+
+      refPixel((int16_t)(x0 + x), (int16_t)(y0 + y), (uint16_t)((p[0] << 8) | p[1]));
+    }
+  }
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+static int fail;
+
+static void start(void)
+{
+  lcdModelClear(0);
+  memset(ref, 0, sizeof(ref));
+  lcdModelReset();
+}
+
+static void check(const char *name)
+{
+  int bad = 0;
+  int x, y;
+
+  for( y = 0; y < (int)LCD_MODEL_HEIGHT; y++ )
+  {
+    for( x = 0; x < (int)LCD_MODEL_WIDTH; x++ )
+    {
+      bad += (lcdModelFb[y][x] != ref[y][x]) ? 1 : 0;
+    }
+  }
+  printf("%-28s transactions %7lu  bytes %8lu  bus %7.2f ms  %s\n", name, lcdModelCnt.transactions,
+         lcdModelCnt.bytes, lcdModelBusMs(), (bad == 0) ? "ok" : "differs");
+  fail += (bad == 0) ? 0 : 1;
+}
+
+int main(void)
+{
+  int i;
+
+  BSP_LCD_Init();
+  srand(1);
+
+  start();
+  makeBmp(64, 64);
+  picture(20, 30);
+  check("BMP 64x64 icon");
+
+  start();
+  makeBmp(256, 240);
+  picture(32, 0);
+  check("BMP 256x240");
+
+  start();
+  makeBmp(100, 80);
+  picture(260, 200);
+  check("BMP 100x80 partly off screen");
+
+  start();
+  for( i = 0; i < 200; i++ )
+  {
+    line(rand() % 320, rand() % 240, rand() % 320, rand() % 240, (uint16_t)rand());
+  }
+  check("200 random lines");
+
+  start();
+  for( i = 0; i < 200; i++ )
+  {
+    int x = rand() % 320;
+    int y = rand() % 240;
+    int l = rand() % 120;
+
+    if( (i & 1) != 0 )
+    {
+      line(x, y, ((x + l) < 320) ? (x + l) : 319, y + (rand() % 3) - 1, (uint16_t)rand());
+    }
+    else
+    {
+      line(x, y, x, ((y + l) < 240) ? (y + l) : 239, (uint16_t)rand());
+    }
+  }
+  check("200 axis-aligned/shallow");
+
+  /* Ends out of the screen, on every side (negative coordinates wrap as uint16_t) */
+  start();
+  for( i = 0; i < 200; i++ )
+  {
+    line((rand() % 400) - 40, (rand() % 320) - 40, (rand() % 400) - 40, (rand() % 320) - 40, (uint16_t)rand());
+  }
+  check("200 lines across the edges");
+
+  start();
+  line(5, 10, -20, 12, 0xF800);
+  line(10, 3, 12, -30, 0x07E0);
+  line(300, 100, 360, 102, 0x001F);
+  line(100, 230, 101, 260, 0xFFFF);
+  check("ends past each edge");
+
+  start();
+  {
+    Point p[3] = { { 20, 200 }, { 160, 20 }, { 300, 180 } };
+
+    BSP_LCD_SetTextColor(0x1234);
+    BSP_LCD_FillPolygon(p, 3);
+    refPolygon(p, 3, 0x1234);
+  }
+  check("FillPolygon triangle");
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+/**
+  ******************************************************************************
+  * @file    plot_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the menu plot drawing (Menu_Plot.c) on a framebuffer
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "Menu_Plot.h"
+
+#define LCD_W   320
+#define LCD_H   240
+
+/*
+******************************************************************************
+* MENU DISPLAY STAND-IN
+******************************************************************************
+*/
+static uint8_t fb[LCD_H][LCD_W];
+static long    pixels;                             /* Pixel writes                         */
+static long    lines;                              /* Height + 1 lines per fill            */
+static long    fills;                              /* Menu_FillRectangle() calls           */
+
+/* Same argument order as BSP_LCD_FillRect(): x, y, width, height (height + 1 lines) */
+void Menu_FillRectangle(uint32_t PosX, uint32_t PosY, uint32_t Height, uint32_t Width)
+{
+  uint32_t r;
+  uint32_t c;
+
+  fills++;
+  for( r = 0; r <= Width; r++ )
+  {
+    lines++;
+    for( c = 0; c < Height; c++ )
+    {
+      pixels++;
+      if( ((PosX + c) < LCD_W) && ((PosY + r) < LCD_H) )
+      {
+        fb[PosY + r][PosX + c] = 1;
+      }
+    }
+  }
+}
+
+void     Menu_SetStyle(ColorStyles_t style)                           { (void)style; }
+uint32_t Menu_GetFontHeight(void)                                     { return 12; }
+uint16_t Menu_GetDisplayWidth(void)                                   { return LCD_W; }
+uint16_t Menu_GetDisplayHeight(void)                                  { return LCD_H; }
+void     Menu_DisplayStringAt(uint32_t PosX, uint32_t PosY, const char *Str) { (void)PosX; (void)PosY; (void)Str; }
+
+/* Not in Menu_Plot.h */
+void Menu_DisplayPoints(Menu_Plot_Geo_t *geo, Menu_Plot_t *plots);
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+static void reset(void)
+{
+  memset(fb, 0, sizeof(fb));
+  pixels = 0;
+  lines  = 0;
+  fills  = 0;
+}
+
+static long lit(void)
+{
+  long n = 0;
+  int  x;
+  int  y;
+
+  for( y = 0; y < LCD_H; y++ )
+  {
+    for( x = 0; x < LCD_W; x++ )
+    {
+      n += fb[y][x];
+    }
+  }
+  return n;
+}
+
+static void report(const char *name)
+{
+  printf("%-36s: %6ld pixel writes %6ld lines %5ld fills, %5ld px lit\n", name, pixels, lines, fills, lit());
+}
+
+/* aat.c needle before Menu_DisplaySegmentWidth: one 3x3 fill per unit step along the needle */
+static void needleFormer(double amp, double phase)
+{
+  int i;
+
+  phase = round(phase) * 3.141592 / 180;
+  amp  *= 30;
+  for( i = 0; i < amp; i++ )
+  {
+    Menu_FillRectangle((uint32_t)(160 + (i * cos(phase))), (uint32_t)(143 - (i * sin(phase))), 3, 3);
+  }
+}
+
+static void needle(double amp, double phase)
+{
+  Menu_Plot_Point_t c = { 160, 143 };
+  Menu_Plot_Point_t t;
+
+  phase = round(phase) * 3.141592 / 180;
+  amp  *= 30;
+  t.x   = c.x + (int)round(amp * cos(phase));
+  t.y   = c.y - (int)round(amp * sin(phase));
+  Menu_DisplaySegmentWidth(c, t, 3);
+}
+
+int main(void)
+{
+  static Menu_Plot_Point_t pts[2][65];
+  Menu_Plot_t              plots[2];
+  Menu_Plot_Geo_t          geo;
+  Menu_Plot_Point_t        a = { 10, 10 };
+  Menu_Plot_Point_t        b = { 90, 40 };
+  Menu_Plot_Point_t        c = { 30, 100 };
+  int                      fail = 0;
+  int                      i;
+  int                      ph;
+
+  for( i = 0; i < 65; i++ )
+  {
+    pts[0][i].x = i * 4;
+    pts[0][i].y = (int)(60 * sin(i / 6.0));
+    pts[1][i].x = i * 4;
+    pts[1][i].y = (int)(40 * cos(i / 9.0));
+  }
+  plots[0].points = pts[0];
+  plots[0].length = 64;
+  plots[0].style  = PLAIN;
+  plots[1].points = pts[1];
+  plots[1].length = 64;
+  plots[1].style  = ACTIVE;
+
+  reset();
+  geo = Menu_DisplayCenterPlot(300, 200, plots, 2, 20);
+  report("full plot (grid + 2 x 64 points)");
+  reset();
+  Menu_DisplayPoints(&geo, &plots[0]);
+  Menu_DisplayPoints(&geo, &plots[1]);
+  report("curves only");
+
+  /* One new point per curve: only it and the segment to the previous point are drawn */
+  reset();
+  fail += (Menu_UpdatePlot(&geo, &plots[0], 63) == 1U) ? 0 : 1;
+  fail += (Menu_UpdatePlot(&geo, &plots[1], 63) == 1U) ? 0 : 1;
+  report("Menu_UpdatePlot, last point");
+  /* A point out of the scale asks for a full redraw and draws nothing */
+  reset();
+  plots[0].length = 65;
+  fail += (Menu_UpdatePlot(&geo, &plots[0], 64) == 0U) ? 0 : 1;
+  fail += (pixels == 0) ? 0 : 1;
+  printf("%-36s: %s\n", "Menu_UpdatePlot, out of scale", (pixels == 0) ? "redraw requested" : "FAIL");
+
+  reset();
+  for( ph = 0; ph < 180; ph += 15 )
+  {
+    needleFormer(2.5, ph);
+  }
+  report("12 needles, 75 px, former aat.c");
+  reset();
+  for( ph = 0; ph < 180; ph += 15 )
+  {
+    needle(2.5, ph);
+  }
+  report("12 needles, 75 px");
+
+  reset();
+  Menu_DisplaySegment(a, b);
+  Menu_DisplaySegment(a, c);
+  report("2 segments, 85 and 92 px");
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+/**
+  ******************************************************************************
+  * @file    Menu_plot.h
+  * @author  MMY Application Team
+  * @brief   Menu_Plot.c includes its header as "Menu_plot.h": forward it on case
+  *          sensitive file systems
+  ******************************************************************************
+  */
+#include "Menu_Plot.h"
@@ -0,0 +1,363 @@
+/**
+  ******************************************************************************
+  * @file    widget_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the menu cursors and tickboxes (menu_demo) on a LCD model
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "st25_discovery_lcd.h"
+#include "jpeg_decode.h"
+#include "Menu_config.h"
+#include "Menu_cursor.h"
+#include "Menu_Tickbox.h"
+#include "lcd_model.h"
+
+#define CPU_HZ           80e6
+#define DECODE_CYCLES    20000U                     /* JPEG decode set-up                       */
+#define DECODE_PIXEL     40U                        /* JPEG decode, per pixel                   */
+#define MAX_STEPS        4000
+
+/*
+******************************************************************************
+* MENU_CONFIG STUBS
+******************************************************************************
+*/
+/* Pictures: 'J', width, height, id. A stand-in for the aat.c cursors, the decode costs CPU time */
+static double   decodeMs;
+static uint16_t pictBuf[32 * 32];
+
+uint16_t Menu_GetDisplayWidth(void)                   { return BSP_LCD_GetXSize(); }
+uint16_t Menu_GetDisplayHeight(void)                  { return BSP_LCD_GetYSize(); }
+uint32_t Menu_GetFontHeight(void)                     { return BSP_LCD_GetFont()->Height; }
+uint32_t Menu_GetFontWidth(void)                      { return BSP_LCD_GetFont()->Width; }
+void     Menu_DisplayClear(void)                      { BSP_LCD_Clear(LCD_COLOR_WHITE); }
+
+void Menu_SetStyle(ColorStyles_t style)
+{
+  switch( style )
+  {
+    case HEADER:
+    case CLEAR_PLAIN:
+      BSP_LCD_SetBackColor(LCD_COLOR_BLUEST);
+      BSP_LCD_SetTextColor(LCD_COLOR_WHITE);
+      break;
+    case GREY:
+      BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
+      BSP_LCD_SetTextColor(LCD_COLOR_LIGHTGRAY);
+      break;
+    case TICKBOX_CHECK:
+      BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
+      BSP_LCD_SetTextColor(LCD_COLOR_GREEN);
+      break;
+    default:
+      BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
+      BSP_LCD_SetTextColor(LCD_COLOR_BLUEST);
+      break;
+  }
+}
+
+void Menu_GetPictureDim(const char *pict, uint32_t *width, uint32_t *height)
+{
+  *width  = (uint8_t)pict[1];
+  *height = (uint8_t)pict[2];
+}
+
+void Menu_DisplayPicture(uint32_t PosX, uint32_t PosY, const char *pict)
+{
+  uint32_t w = (uint8_t)pict[1];
+  uint32_t h = (uint8_t)pict[2];
+  uint32_t i;
+
+  decodeMs += (double)(DECODE_CYCLES + (DECODE_PIXEL * w * h)) * 1000.0 / CPU_HZ;
+  for( i = 0; i < (w * h); i++ )
+  {
+    pictBuf[i] = (uint16_t)((pict[3] * 977) + (i * 31U));
+  }
+  BSP_LCD_SetDisplayWindow(PosX, PosY, w - 1U, h - 1U);
+  LCD_IO_WriteBuffer16(pictBuf, w * h);
+}
+
+void Menu_DisplayRectangle(uint32_t PosX, uint32_t PosY, uint32_t Height, uint32_t Width)
+{
+  BSP_LCD_DrawRect(PosX, PosY, Height, Width);
+}
+
+void Menu_FillRectangle(uint32_t PosX, uint32_t PosY, uint32_t Height, uint32_t Width)
+{
+  BSP_LCD_FillRect(PosX, PosY, Height, Width);
+}
+
+void Menu_DisplayStringAt(uint32_t PosX, uint32_t PosY, const char *Str)
+{
+  BSP_LCD_DisplayStringAt(PosX, PosY, (uint8_t *)Str, LEFT_MODE);
+}
+
+/* The JPEG decoder is not used: BSP_LCD_DisplayPicture() is replaced by Menu_DisplayPicture() above */
+uint32_t jpeg_decode(const char* jpeg,
+                     uint8_t (*setup)(uint32_t Width, uint32_t Height, jpeg_window_t *Window),
+                     uint8_t (*callback)(uint16_t *Pixels, uint32_t NbPixels))
+{
+  (void)jpeg; (void)setup; (void)callback;
+  return 0;
+}
+
+void jpeg_getsize(const char* jpeg, uint32_t* Width, uint32_t* Height)
+{
+  (void)jpeg;
+  *Width  = 0;
+  *Height = 0;
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+static const char CursorBlue[] = { 'J', 19, 13, 1 };
+static const char CursorV[]    = { 'J', 19, 13, 2 };
+
+static Menu_Bar_t    CpBar, CsBar;
+static Menu_Cursor_t CpCursor, CsCursor;
+
+static unsigned long stepHash[MAX_STEPS];
+static int           steps;
+static double        decode0;
+
+/* aat.c value label, drawn by the cursor callback */
+static void updateCursorText(Menu_Cursor_t *cursor)
+{
+  char text[10];
+
+  sprintf(text, "%03" PRIu32, cursor->Value);
+  BSP_LCD_DisplayStringAt(cursor->Bar->X - 24U, 190, (uint8_t *)text, LEFT_MODE);
+}
+
+/* GRAM after each step, to compare two builds */
+static void step(void)
+{
+  unsigned long h = 5381;
+  uint32_t      x, y;
+
+  for( y = 0; y < LCD_MODEL_HEIGHT; y++ )
+  {
+    for( x = 0; x < LCD_MODEL_WIDTH; x++ )
+    {
+      h = (h * 33U) ^ lcdModelFb[y][x];
+    }
+  }
+  if( steps < MAX_STEPS )
+  {
+    stepHash[steps++] = h;
+  }
+}
+
+static void start(void)
+{
+  lcdModelReset();
+  decode0 = decodeMs;
+}
+
+static void report(const char *what, int n)
+{
+  double decode = decodeMs - decode0;
+
+  printf("  %-38s %7.0f px/action %7.3f ms/action (decode %5.3f)  %5.1f windows/action\n", what,
+         (double)lcdModelCnt.pixels / n, (lcdModelBusMs() + decode) / n, decode / n,
+         (double)lcdModelCnt.windows / n);
+}
+
+int main(int argc, char **argv)
+{
+  Menu_Direction_t joy;
+  Menu_Position_t  pos;
+  Menu_Tickbox_t   tb;
+  Menu_Tickbox_t   tb2;
+  FILE            *f;
+  int              fail = 0;
+  int              i;
+
+  BSP_LCD_Init();
+  BSP_LCD_SetFont(&Font16);
+  BSP_LCD_Clear(LCD_COLOR_WHITE);
+  Menu_SetStyle(GREY);
+  Menu_BarInit(290, 30, 125, MENU_BAR_VERTICAL, GREY, &CsBar);
+  Menu_BarInit(30, 30, 125, MENU_BAR_VERTICAL, GREY, &CpBar);
+  Menu_CursorInit(&CsBar, 0, 0xFF, 0xFF, CursorBlue, 20, &updateCursorText, &CsCursor);
+  Menu_CursorInit(&CpBar, 0, 0xFF, 0x7F, CursorV, 20, &updateCursorText, &CpCursor);
+  Menu_CursorSetValue(&CsCursor, 0xFF);
+  Menu_CursorSetValue(&CpCursor, 0x7F);
+  step();
+
+  /* Joystick: one pixel per press, as Menu_CursorJoyInput() */
+  memset(&joy, 0, sizeof(joy));
+  joy.Dir = MENU_UP;
+  start();
+  for( i = 0; i < 40; i++ )
+  {
+    Menu_CursorJoyInput(&CsCursor, &joy);
+    step();
+  }
+  report("joystick step (1 px)", 40);
+
+  /* Touch drag on the bar: 4 px per touch report, then the aat.c repaint of both cursors */
+  memset(&pos, 0, sizeof(pos));
+  pos.Sel = 1;
+  start();
+  for( i = 0; i < 25; i++ )
+  {
+    pos.X = 290;
+    pos.Y = 40 + (4 * i);
+    Menu_CursorInput(&CsCursor, &pos);
+    CsCursor.Picture = CursorBlue;
+    CpCursor.Picture = CursorV;
+    Menu_CursorSetValue(&CpCursor, CpCursor.Value);
+    Menu_CursorSetValue(&CsCursor, CsCursor.Value);
+    step();
+  }
+  report("touch drag step (4 px) + aat repaint", 25);
+
+  /* Select the other cursor: the pictures swap, the values do not change */
+  start();
+  for( i = 0; i < 10; i++ )
+  {
+    Menu_Cursor_t *a = ((i & 1) != 0) ? &CsCursor : &CpCursor;
+    Menu_Cursor_t *b = ((i & 1) != 0) ? &CpCursor : &CsCursor;
+
+    a->Picture = CursorBlue;
+    b->Picture = CursorV;
+    Menu_CursorSetValue(&CpCursor, CpCursor.Value);
+    Menu_CursorSetValue(&CsCursor, CsCursor.Value);
+    step();
+  }
+  report("select other cursor (picture swap)", 10);
+
+  /* Auto tune result: both cursors jump */
+  srand(3);
+  start();
+  for( i = 0; i < 20; i++ )
+  {
+    Menu_CursorSetValue(&CsCursor, rand() & 0xFF);
+    Menu_CursorSetValue(&CpCursor, rand() & 0xFF);
+    step();
+  }
+  report("auto tune: both cursors jump", 20);
+
+  /* Tickbox toggles */
+  BSP_LCD_SetFont(&Font16);
+  tb  = Menu_InitTickbox(120, 60, 20, 0, "Option");
+  tb2 = Menu_InitTickbox(120, 100, 16, 1, "Other");
+  step();
+  pos.X = 130;
+  pos.Y = 70;
+  start();
+  for( i = 0; i < 20; i++ )
+  {
+    Menu_TickboxInput(&tb, &pos);
+    step();
+  }
+  report("tickbox toggle (size 20)", 20);
+  pos.X = 128;
+  pos.Y = 108;
+  start();
+  for( i = 0; i < 20; i++ )
+  {
+    Menu_TickboxInput(&tb2, &pos);
+    step();
+  }
+  report("tickbox toggle (size 16)", 20);
+
+  /* Random mix, the GRAM is compared after every step */
+  srand(11);
+  for( i = 0; i < 3000; i++ )
+  {
+    Menu_Cursor_t *c = ((rand() & 1) != 0) ? &CsCursor : &CpCursor;
+
+    switch( rand() % 5 )
+    {
+      case 0:
+        joy.Dir = ((rand() & 1) != 0) ? MENU_UP : MENU_DOWN;
+        Menu_CursorJoyInput(c, &joy);
+        break;
+      case 1:
+        pos.X = ((rand() & 1) != 0) ? 290 : 30;
+        pos.Y = 20 + (rand() % 150);
+        Menu_CursorInput(&CsCursor, &pos);
+        Menu_CursorInput(&CpCursor, &pos);
+        break;
+      case 2:
+        c->Picture = ((rand() & 1) != 0) ? CursorBlue : CursorV;
+        Menu_CursorSetValue(c, rand() & 0xFF);
+        break;
+      case 3:
+        pos.X = 130;
+        pos.Y = 70;
+        Menu_TickboxInput(&tb, &pos);
+        break;
+      default:
+        if( (c->Value > 0U) && (c->Value < 255U) )
+        {
+          Menu_CursorSetValue(c, c->Value + (uint32_t)((rand() % 3) - 1));
+        }
+        break;
+    }
+    step();
+  }
+  printf("  %d steps\n", steps);
+
+  if( (argc > 2) && (strcmp(argv[1], "-save") == 0) )
+  {
+    f = fopen(argv[2], "wb");
+    if( (f == NULL) || (fwrite(stepHash, sizeof(stepHash[0]), steps, f) != (size_t)steps) )
+    {
+      fail++;
+    }
+    if( f != NULL )
+    {
+      fclose(f);
+    }
+  }
+  else if( (argc > 2) && (strcmp(argv[1], "-check") == 0) )
+  {
+    static unsigned long ref[MAX_STEPS];
+    int n = 0;
+
+    f = fopen(argv[2], "rb");
+    if( f != NULL )
+    {
+      n = (int)fread(ref, sizeof(ref[0]), MAX_STEPS, f);
+      fclose(f);
+    }
+    for( i = 0; (i < n) && (i < steps) && (ref[i] == stepHash[i]); i++ )
+    {
+    }
+    if( (n != steps) || (i != steps) )
+    {
+      printf("  GRAM differs from the reference at step %d\n", i);
+      fail++;
+    }
+    else
+    {
+      printf("  GRAM same as the reference after every step\n");
+    }
+  }
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
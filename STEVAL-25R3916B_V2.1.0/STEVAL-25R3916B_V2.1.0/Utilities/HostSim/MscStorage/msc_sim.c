@@ -0,0 +1,393 @@
+/**
+  ******************************************************************************
+  * @file    msc_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the USB disk (usbd_storage.c) over a flash model
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "usbd_storage.h"
+#include "flashl4_if.h"
+
+#define SIM_PAGE_SIZE     2048U
+#define SIM_DISK_SIZE     0x20000U
+#define SIM_BLK_SIZE      512U
+#define SIM_BLK_NBR       255U
+#define SIM_ERASE_MS      22.0      /* Page erase */
+#define SIM_DWORD_MS      0.082     /* Doubleword program */
+#define SIM_USB_MS_PER_KB 0.9       /* Full speed bulk payload, ~1.1 MB/s */
+
+static double   simMs;              /* Simulated time */
+static int      inIrq;              /* 1 while the MSC class runs (USB interrupt) */
+static double   irqMs;              /* Flash time of the current USB interrupt */
+static double   irqMaxMs;           /* Longest USB interrupt spent on flash */
+static long     erases;
+static long     dwords;
+static int      perBlock;           /* Baseline: erase/program of the page at every block, in the interrupt */
+static int      fail;
+
+static uint8_t *flash;
+static uint8_t  ref[SIM_DISK_SIZE];
+
+/*
+******************************************************************************
+* FLASH MODEL
+******************************************************************************
+*/
+static void flashTime(double ms)
+{
+  simMs += ms;
+  if( inIrq != 0 )
+  {
+    irqMs += ms;
+  }
+}
+
+void FLASH_If_FlashUnlock(void) { }
+void FLASH_If_FlashLock(void)   { }
+
+uint32_t FLASH_If_PageErase(const uint32_t Address, const uint32_t LastAddress)
+{
+  uint32_t n = ((LastAddress - Address) / SIM_PAGE_SIZE) + 1U;
+
+  memset((void *)(uintptr_t)Address, 0xFF, n * SIM_PAGE_SIZE);
+  erases += n;
+  flashTime(SIM_ERASE_MS * n);
+  return 0;
+}
+
+uint32_t FLASH_If_WriteDWord(const uint32_t Address, const uint64_t Data)
+{
+  uint64_t *p = (uint64_t *)(uintptr_t)Address;
+
+  if( *p != 0xFFFFFFFFFFFFFFFFULL )
+  {
+    printf("program over a non erased doubleword at 0x%08X\n", (unsigned)Address);
+    exit(1);
+  }
+  *p = Data;
+  dwords++;
+  flashTime(SIM_DWORD_MS);
+  return 0;
+}
+
+uint32_t HAL_GetTick(void)
+{
+  return (uint32_t)simMs;
+}
+
+/*
+******************************************************************************
+* USB STUBS
+******************************************************************************
+*/
+USBD_HandleTypeDef USBD_Device;
+
+static uint8_t  armed;              /* MSC OUT endpoint ready to receive */
+static uint8_t  cbw[31];
+static uint8_t  packet[SIM_BLK_SIZE];
+
+USBD_StatusTypeDef USBD_LL_PrepareReceive(USBD_HandleTypeDef *pdev, uint8_t ep_addr, uint8_t *pbuf, uint32_t size)
+{
+  (void)pdev;
+  /* Same hook as usbd_conf.c */
+  if( (ep_addr == MSC_EPOUT_ADDR) && (STORAGE_HoldReceive(pbuf, size) != 0U) )
+  {
+    return USBD_OK;
+  }
+  armed = 1;
+  return USBD_OK;
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+static void irqEnter(void)
+{
+  inIrq = 1;
+  irqMs = 0;
+}
+
+static void irqExit(void)
+{
+  inIrq = 0;
+  if( irqMs > irqMaxMs )
+  {
+    irqMaxMs = irqMs;
+  }
+}
+
+/* The host sends a packet once the OUT endpoint is armed: the main loop runs meanwhile */
+static void hostSend(uint32_t len)
+{
+  if( armed == 0 )
+  {
+    STORAGE_Task();
+  }
+  if( armed == 0 )
+  {
+    printf("MSC OUT endpoint never armed again\n");
+    exit(1);
+  }
+  armed  = 0;
+  simMs += (len / 1024.0) * SIM_USB_MS_PER_KB;
+}
+
+/* Command status sent, next CBW expected */
+static void sendCsw(void)
+{
+  (void)USBD_LL_PrepareReceive(&USBD_Device, MSC_EPOUT_ADDR, cbw, sizeof(cbw));
+}
+
+static void perBlockWrite(uint32_t blk, const uint8_t *buf)
+{
+  uint32_t address = USER_DATA_ADDRESS + ((blk * SIM_BLK_SIZE) / SIM_PAGE_SIZE) * SIM_PAGE_SIZE;
+  uint64_t page[SIM_PAGE_SIZE / 8U];
+  uint32_t i;
+
+  memcpy(page, (void *)(uintptr_t)address, SIM_PAGE_SIZE);
+  memcpy((uint8_t *)page + ((blk * SIM_BLK_SIZE) % SIM_PAGE_SIZE), buf, SIM_BLK_SIZE);
+  (void)FLASH_If_PageErase(address, address + SIM_PAGE_SIZE - 1U);
+  for( i = 0; i < (SIM_PAGE_SIZE / 8U); i++ )
+  {
+    if( page[i] != 0xFFFFFFFFFFFFFFFFULL )
+    {
+      (void)FLASH_If_WriteDWord(address + (8U * i), page[i]);
+    }
+  }
+}
+
+/* SCSI WRITE(10): CBW, one OUT packet per block (MSC_MEDIA_PACKET), CSW */
+static void cmdWrite(uint32_t blk, uint16_t n, const uint8_t *data)
+{
+  uint16_t i;
+
+  hostSend(sizeof(cbw));
+  irqEnter();
+  (void)USBD_DISK_fops.IsReady(0);
+  (void)USBD_LL_PrepareReceive(&USBD_Device, MSC_EPOUT_ADDR, packet, sizeof(packet));
+  irqExit();
+  for( i = 0; i < n; i++ )
+  {
+    hostSend(SIM_BLK_SIZE);
+    memcpy(packet, &data[i * SIM_BLK_SIZE], SIM_BLK_SIZE);
+    memcpy(&ref[(blk + i) * SIM_BLK_SIZE], packet, SIM_BLK_SIZE);
+    irqEnter();
+    if( perBlock != 0 )
+    {
+      perBlockWrite(blk + i, packet);
+    }
+    else if( USBD_DISK_fops.Write(0, packet, blk + i, 1) != 0 )
+    {
+      printf("Write error at block %u\n", (unsigned)(blk + i));
+      fail++;
+    }
+    if( i == (n - 1U) )
+    {
+      sendCsw();
+    }
+    else
+    {
+      (void)USBD_LL_PrepareReceive(&USBD_Device, MSC_EPOUT_ADDR, packet, sizeof(packet));
+    }
+    irqExit();
+  }
+}
+
+/* SCSI READ(10): CBW, one IN packet per block, CSW */
+static void cmdRead(uint32_t blk, uint16_t n, uint8_t *buf)
+{
+  uint16_t i;
+
+  hostSend(sizeof(cbw));
+  irqEnter();
+  (void)USBD_DISK_fops.IsReady(0);
+  for( i = 0; i < n; i++ )
+  {
+    if( perBlock != 0 )
+    {
+      memcpy(&buf[i * SIM_BLK_SIZE], &flash[(blk + i) * SIM_BLK_SIZE], SIM_BLK_SIZE);
+    }
+    else
+    {
+      (void)USBD_DISK_fops.Read(0, &buf[i * SIM_BLK_SIZE], blk + i, 1);
+    }
+    simMs += (SIM_BLK_SIZE / 1024.0) * SIM_USB_MS_PER_KB;
+  }
+  sendCsw();
+  irqExit();
+}
+
+/* Idle host: TEST UNIT READY at the end of the idle time */
+static void idle(double ms)
+{
+  simMs += ms;
+  hostSend(sizeof(cbw));
+  irqEnter();
+  (void)USBD_DISK_fops.IsReady(0);
+  sendCsw();
+  irqExit();
+}
+
+static uint8_t data[SIM_DISK_SIZE];
+
+/* Copy of a 96 KB file: FAT and directory, data clusters, FAT again */
+static void scnFile(void)
+{
+  uint32_t b;
+
+  cmdWrite(1, 1, data);
+  cmdWrite(3, 1, data + 512);
+  for( b = 0; b < 192U; b += 64U )
+  {
+    cmdWrite(40U + b, 64, data + (b * 512U));
+  }
+  cmdWrite(1, 1, data + 1024);
+  cmdWrite(3, 1, data + 1536);
+  idle(600);
+}
+
+/* 20 log appends of one block, FAT and directory updated, idle in between */
+static void scnLog(void)
+{
+  int i;
+
+  for( i = 0; i < 20; i++ )
+  {
+    cmdWrite(40U + i, 1, data + (i * 512));
+    cmdWrite(1, 1, data + 20000 + i);
+    cmdWrite(3, 1, data + 30000 + i);
+    idle(700);
+  }
+}
+
+/* Format like rewrite of the whole disk */
+static void scnRewrite(void)
+{
+  cmdWrite(0, SIM_BLK_NBR, data);
+}
+
+/* Same, over former data */
+static void scnOver(void)
+{
+  cmdWrite(0, SIM_BLK_NBR, data);
+  idle(600);
+  erases   = 0;
+  dwords   = 0;
+  simMs    = 0;
+  irqMaxMs = 0;
+  cmdWrite(0, SIM_BLK_NBR, data + 7);
+}
+
+/* Block read back before its page is written: served from the staged page */
+static void scnReadStaged(void)
+{
+  uint8_t buf[SIM_BLK_SIZE];
+
+  cmdWrite(10, 1, data + 100);
+  simMs += 600;   /* No TEST UNIT READY: the page is staged by the READ(10) */
+  cmdRead(10, 1, buf);
+  if( (memcmp(buf, data + 100, SIM_BLK_SIZE) != 0) ||
+      ((perBlock == 0) && (memcmp(&flash[10 * SIM_BLK_SIZE], data + 100, SIM_BLK_SIZE) == 0)) )
+  {
+    printf("read before the flash write: wrong data\n");
+    fail++;
+  }
+}
+
+static int run(const char *name, void (*scn)(void))
+{
+  int mode;
+  int status;
+  int ret = 0;
+
+  /* Each run in a child process: fresh flash content and usbd_storage.c state */
+  for( mode = 1; mode >= 0; mode-- )
+  {
+    fflush(stdout);
+    if( fork() == 0 )
+    {
+      uint8_t  buf[SIM_BLK_SIZE];
+      uint32_t i;
+      int      ok = 1;
+
+      perBlock = mode;
+      (void)USBD_DISK_fops.Init(0);
+      sendCsw();
+      scn();
+      idle(1000);
+      for( i = 0; i < SIM_BLK_NBR; i++ )
+      {
+        cmdRead(i, 1, buf);
+        if( memcmp(buf, &ref[i * SIM_BLK_SIZE], SIM_BLK_SIZE) != 0 )
+        {
+          ok = 0;
+        }
+      }
+      if( (memcmp(flash, ref, SIM_BLK_NBR * SIM_BLK_SIZE) != 0) || (fail != 0) )
+      {
+        ok = 0;
+      }
+      printf("%-28s %-9s %s  erases %4ld  dwords %6ld  %8.1f ms  USB interrupt %5.1f ms\n", name,
+             (perBlock != 0) ? "per-block" : "staged", (ok != 0) ? "ok " : "BAD", erases, dwords, simMs, irqMaxMs);
+      /* The staged disk never erases nor programs in the USB interrupt */
+      exit(((ok != 0) && ((perBlock != 0) || (irqMaxMs == 0.0))) ? 0 : 1);
+    }
+    (void)wait(&status);
+    ret |= (WIFEXITED(status) && (WEXITSTATUS(status) == 0)) ? 0 : 1;
+  }
+  return ret;
+}
+
+int main(void)
+{
+  uint32_t n;
+  uint16_t s;
+  size_t   i;
+  int      ret = 0;
+
+  flash = mmap((void *)(uintptr_t)USER_DATA_ADDRESS, SIM_DISK_SIZE, PROT_READ | PROT_WRITE,
+               MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if( flash != (uint8_t *)(uintptr_t)USER_DATA_ADDRESS )
+  {
+    perror("mmap");
+    return 1;
+  }
+  memset(flash, 0xFF, SIM_DISK_SIZE);
+  memset(ref, 0xFF, SIM_DISK_SIZE);
+  for( i = 0; i < sizeof(data); i++ )
+  {
+    data[i] = (uint8_t)rand();
+  }
+  (void)USBD_DISK_fops.GetCapacity(0, &n, &s);
+  printf("capacity %u blocks of %u\n", (unsigned)n, (unsigned)s);
+
+  ret |= run("96 KB file copy", scnFile);
+  ret |= run("20 x 1-block log append", scnLog);
+  ret |= run("full 127 KB rewrite", scnRewrite);
+  ret |= run("127 KB rewrite over old data", scnOver);
+  ret |= run("read before the flash write", scnReadStaged);
+
+  printf("%s\n", (ret == 0) ? "PASS" : "FAIL");
+  return ret;
+}
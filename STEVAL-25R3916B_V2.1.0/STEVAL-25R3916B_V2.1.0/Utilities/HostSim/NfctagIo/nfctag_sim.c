@@ -0,0 +1,688 @@
+/**
+  ******************************************************************************
+  * @file    nfctag_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulator of the NFCTAG I2C transfers of the BSP (st25_discovery.c)
+  *          against a ST25DV model
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "st25_discovery.h"
+#include "st25_discovery_nfctag.h"
+#include "hal_model.h"
+
+/* ST25DV: 400 kHz I2C (9 clocks per byte), EEPROM programmed in 4 to 5 ms per 4-byte block */
+#define BYTE_CYCLES     1800U    /* 22.5 us                                          */
+#define STOP_CYCLES      200U    /* STOP condition after the last byte               */
+#define BLOCK_MIN_US    4000U
+#define BLOCK_MAX_US    5000U
+#define EEPROM_SIZE     8192U
+#define RAM_SIZE        0x108U   /* Dynamic registers and mailbox, from ST25DV_GPO_DYN_REG */
+
+/* Cost of the I2C calls, CPU cycles */
+#define COST_INIT        400U    /* HAL_I2C_Init, HAL_DMA_Init                       */
+#define COST_START       480U    /* Transfer set-up of the HAL                       */
+#define COST_READY       640U    /* HAL_I2C_IsDeviceReady trial, out of the bus time */
+#define COST_ISR         160U    /* Entry and HAL handler of an interrupt            */
+#define COST_RXNE         96U    /* Byte received on interrupt                       */
+
+#define US(u)           ((uint64_t)(u) * (HAL_MODEL_HZ / 1000000U))
+#define APP_SLICE       US(10)   /* Application work between two checks of the end   */
+#define XFER_MAX        (20ULL * HAL_MODEL_HZ)
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+#define I2C_CALLBACK(h, cb)     (h)->cb(h)
+#else
+#define I2C_CALLBACK(h, cb)     HAL_I2C_##cb(h)
+#endif
+
+static int fail;
+
+/*
+******************************************************************************
+* MODEL: ST25DV
+******************************************************************************
+*/
+static struct
+{
+  uint8_t       eeprom[EEPROM_SIZE];
+  uint8_t       ram[RAM_SIZE];
+  uint64_t      busyUntil;   /* End of the write cycle, the address is NACKed until then */
+  int           stuck;       /* The next write cycle never ends                          */
+  unsigned long polls;       /* Address only transactions                                */
+} dev;
+
+static uint32_t seed = 1234U;
+
+static uint32_t blockUs(void)
+{
+  seed = (seed * 1103515245U) + 12345U;
+  return BLOCK_MIN_US + ((seed >> 16) % (BLOCK_MAX_US - BLOCK_MIN_US + 1U));
+}
+
+static int devAck(uint16_t DevAddr)
+{
+  return (DevAddr == ST25DV_ADDR_DATA_I2C) && (halModelNow >= dev.busyUntil);
+}
+
+static uint8_t *devMem(uint16_t addr, uint32_t n)
+{
+  if( (addr + n) <= EEPROM_SIZE )
+  {
+    return &dev.eeprom[addr];
+  }
+  if( (addr >= ST25DV_GPO_DYN_REG) && ((addr + n) <= (ST25DV_GPO_DYN_REG + RAM_SIZE)) )
+  {
+    return &dev.ram[addr - ST25DV_GPO_DYN_REG];
+  }
+  halModelError("access out of the ST25DV memory");
+  return NULL;
+}
+
+/* End of a write on the bus: the EEPROM bytes start a write cycle, the RAM ones do not */
+static void devWrite(uint16_t addr, const uint8_t *p, uint32_t n)
+{
+  uint8_t *m = devMem(addr, n);
+  uint64_t t = 0;
+  uint32_t blocks;
+
+  if( m == NULL )
+  {
+    return;
+  }
+  memcpy(m, p, n);
+  if( addr < EEPROM_SIZE )
+  {
+    if( n > 256U )
+    {
+      halModelError("EEPROM write of more than 256 bytes");
+    }
+    for( blocks = ((addr % 4U) + n + 3U) / 4U; blocks > 0U; blocks-- )
+    {
+      t += US(blockUs());
+    }
+    dev.busyUntil = (dev.stuck != 0) ? UINT64_MAX : (halModelNow + t);
+  }
+}
+
+static void devRead(uint16_t addr, uint8_t *p, uint32_t n)
+{
+  const uint8_t *m = devMem(addr, n);
+
+  if( m != NULL )
+  {
+    memcpy(p, m, n);
+  }
+}
+
+/*
+******************************************************************************
+* MODEL: TIM7 (write cycle timer, 10 kHz counter set by the BSP registers)
+******************************************************************************
+*/
+static int timArmed;
+
+static void timIsr(void);
+
+/* The BSP starts the counter from the I2C callbacks: checked after each interrupt */
+static void timCheck(void)
+{
+  TIM_TypeDef *tim = ST25_DISCOVERY_NFCTAG_TIM;
+
+  if( ((tim->CR1 & TIM_CR1_CEN) != 0U) && (timArmed == 0) )
+  {
+    timArmed = 1;
+    halModelRaise(ST25_DISCOVERY_NFCTAG_TIM_IRQn,
+                  halModelNow + ((uint64_t)(tim->ARR + 1U) * (tim->PSC + 1U)), timIsr);
+  }
+}
+
+static void timIsr(void)
+{
+  TIM_TypeDef *tim = ST25_DISCOVERY_NFCTAG_TIM;
+
+  timArmed = 0;
+  if( (tim->CR1 & TIM_CR1_CEN) == 0U )
+  {
+    return;   /* Stopped meanwhile */
+  }
+  tim->CR1 &= ~TIM_CR1_CEN;   /* One pulse mode */
+  tim->SR  |= TIM_SR_UIF;
+  halModelAdvance(COST_ISR);
+  BSP_NFCMEM_TIM_IRQHandler();
+  timCheck();
+}
+
+/*
+******************************************************************************
+* MODEL: I2C2 AND ITS TX DMA (DMA1 CHANNEL 4)
+******************************************************************************
+*/
+enum
+{
+  OP_NONE = 0,
+  OP_MEM_TX,   /* Mem_Write_DMA       */
+  OP_MEM_RX,   /* Mem_Read_IT         */
+  OP_POLL      /* Master_Transmit_IT  */
+};
+
+static struct
+{
+  int       op;
+  int       nack;
+  uint16_t  mem;
+  uint8_t  *p;
+  uint16_t  n;
+  int       lost;   /* The end of the next transfer raises no interrupt */
+} i2c;
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+/* Application I2C callbacks: they link with the BSP, which registers its own on I2C2 */
+static unsigned long appCallbacks;
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)    { (void)hi2c; appCallbacks++; }
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)    { (void)hi2c; appCallbacks++; }
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) { (void)hi2c; appCallbacks++; }
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)        { (void)hi2c; appCallbacks++; }
+#else
+/* HAL defaults, defined by the BSP */
+__attribute__((weak)) void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)    { (void)hi2c; }
+__attribute__((weak)) void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)    { (void)hi2c; }
+__attribute__((weak)) void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) { (void)hi2c; }
+__attribute__((weak)) void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)        { (void)hi2c; }
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+
+static void i2cEvIsr(void)
+{
+  BSP_NFCMEM_I2C_EV_IRQHandler();
+  timCheck();
+}
+
+static void dmaIsr(void)
+{
+  BSP_NFCMEM_DMA_IRQHandler();
+}
+
+/* Interrupt driven transfer: the address is sent now, the end raises the event interrupt */
+static HAL_StatusTypeDef i2cStart(I2C_HandleTypeDef *hi2c, int op, uint16_t DevAddr, uint16_t MemAddr,
+                                  uint8_t *p, uint16_t n)
+{
+  uint64_t end;
+
+  if( hi2c->State != HAL_I2C_STATE_READY )
+  {
+    return HAL_BUSY;
+  }
+  halModelAdvance(COST_START);
+  hi2c->State     = (op == OP_MEM_RX) ? HAL_I2C_STATE_BUSY_RX : HAL_I2C_STATE_BUSY_TX;
+  hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+  i2c.op   = op;
+  i2c.mem  = MemAddr;
+  i2c.p    = p;
+  i2c.n    = n;
+  i2c.nack = !devAck(DevAddr);
+  if( op == OP_POLL )
+  {
+    dev.polls++;
+  }
+
+  end = halModelNow + BYTE_CYCLES;
+  if( i2c.nack == 0 )
+  {
+    end += BYTE_CYCLES * ((op == OP_MEM_TX) ? (2U + n) : (op == OP_MEM_RX) ? (3U + n) : 0U);
+  }
+  if( i2c.lost != 0 )
+  {
+    i2c.lost = 0;
+    return HAL_OK;
+  }
+  if( (op == OP_MEM_TX) && (i2c.nack == 0) )
+  {
+    halModelRaise(ST25_DISCOVERY_I2C2_TX_DMA_IRQn, end, dmaIsr);
+  }
+  halModelRaise(ST25_DISCOVERY_I2C2_EV_IRQn, end + STOP_CYCLES, i2cEvIsr);
+  return HAL_OK;
+}
+
+/* Polled transfer: the CPU waits for the bytes */
+static HAL_StatusTypeDef i2cPolled(I2C_HandleTypeDef *hi2c, uint16_t DevAddr, uint32_t bytes)
+{
+  if( hi2c->State != HAL_I2C_STATE_READY )
+  {
+    halModelError("polled I2C transfer during a transfer");
+    return HAL_BUSY;
+  }
+  halModelAdvance(COST_START);
+  if( !devAck(DevAddr) )
+  {
+    halModelAdvance(BYTE_CYCLES);
+    hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+    return HAL_ERROR;
+  }
+  halModelAdvance(BYTE_CYCLES * bytes);
+  hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+  if( hi2c->State == HAL_I2C_STATE_RESET )
+  {
+    hi2c->MemTxCpltCallback    = HAL_I2C_MemTxCpltCallback;
+    hi2c->MemRxCpltCallback    = HAL_I2C_MemRxCpltCallback;
+    hi2c->MasterTxCpltCallback = HAL_I2C_MasterTxCpltCallback;
+    hi2c->ErrorCallback        = HAL_I2C_ErrorCallback;
+  }
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+  hi2c->State     = HAL_I2C_STATE_READY;
+  hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+  halModelAdvance(COST_INIT);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c)
+{
+  hi2c->State = HAL_I2C_STATE_RESET;
+  i2c.op      = OP_NONE;
+  halModelCancel(ST25_DISCOVERY_I2C2_EV_IRQn);
+  halModelCancel(ST25_DISCOVERY_I2C2_TX_DMA_IRQn);
+  halModelAdvance(COST_INIT);
+  return HAL_OK;
+}
+
+HAL_I2C_StateTypeDef HAL_I2C_GetState(const I2C_HandleTypeDef *hi2c)
+{
+  return hi2c->State;
+}
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+HAL_StatusTypeDef HAL_I2C_RegisterCallback(I2C_HandleTypeDef *hi2c, HAL_I2C_CallbackIDTypeDef CallbackID,
+                                           pI2C_CallbackTypeDef pCallback)
+{
+  if( hi2c->State != HAL_I2C_STATE_READY )
+  {
+    halModelError("I2C callback registered out of the ready state");
+    return HAL_ERROR;
+  }
+  switch( CallbackID )
+  {
+    case HAL_I2C_MEM_TX_COMPLETE_CB_ID:
+      hi2c->MemTxCpltCallback = pCallback;
+      break;
+    case HAL_I2C_MEM_RX_COMPLETE_CB_ID:
+      hi2c->MemRxCpltCallback = pCallback;
+      break;
+    case HAL_I2C_MASTER_TX_COMPLETE_CB_ID:
+      hi2c->MasterTxCpltCallback = pCallback;
+      break;
+    case HAL_I2C_ERROR_CB_ID:
+      hi2c->ErrorCallback = pCallback;
+      break;
+    default:
+      halModelError("I2C callback not modelled");
+      return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  HAL_StatusTypeDef ret = i2cPolled(hi2c, DevAddress, 3U + Size);
+
+  (void)MemAddSize; (void)Timeout;
+  if( ret == HAL_OK )
+  {
+    devWrite(MemAddress, pData, Size);
+  }
+  return ret;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                   uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  HAL_StatusTypeDef ret = i2cPolled(hi2c, DevAddress, 4U + Size);
+
+  (void)MemAddSize; (void)Timeout;
+  if( ret == HAL_OK )
+  {
+    devRead(MemAddress, pData, Size);
+  }
+  return ret;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                          uint16_t Size, uint32_t Timeout)
+{
+  (void)pData; (void)Timeout;
+  if( Size != 0U )
+  {
+    halModelError("I2C write without memory address");
+  }
+  dev.polls++;
+  return i2cPolled(hi2c, DevAddress, 1U);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                         uint16_t Size, uint32_t Timeout)
+{
+  (void)hi2c; (void)DevAddress; (void)pData; (void)Size; (void)Timeout;
+  halModelError("I2C read at the current address not modelled");
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials,
+                                        uint32_t Timeout)
+{
+  uint32_t i;
+
+  (void)Timeout;
+  for( i = 0; i < Trials; i++ )
+  {
+    dev.polls++;
+    halModelAdvance(COST_READY + BYTE_CYCLES);
+    if( devAck(DevAddress) )
+    {
+      return HAL_OK;
+    }
+  }
+  hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+  return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+  (void)MemAddSize;
+  if( hi2c->hdmatx == NULL )
+  {
+    halModelError("I2C TX DMA not linked");
+    return HAL_ERROR;
+  }
+  return i2cStart(hi2c, OP_MEM_TX, DevAddress, MemAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                      uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+  (void)MemAddSize;
+  return i2cStart(hi2c, OP_MEM_RX, DevAddress, MemAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size)
+{
+  if( Size != 0U )
+  {
+    halModelError("I2C write without memory address");
+  }
+  return i2cStart(hi2c, OP_POLL, DevAddress, 0U, pData, 0U);
+}
+
+/* End of transfer (STOP) or NACK: the NACK is reported by the event interrupt, as on the STM32L4 */
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c)
+{
+  int op = i2c.op;
+
+  halModelAdvance(COST_ISR);
+  if( op == OP_NONE )
+  {
+    halModelError("I2C event without transfer");
+    return;
+  }
+  i2c.op      = OP_NONE;
+  hi2c->State = HAL_I2C_STATE_READY;
+  if( i2c.nack != 0 )
+  {
+    hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+    I2C_CALLBACK(hi2c, ErrorCallback);
+    return;
+  }
+  switch( op )
+  {
+    case OP_MEM_TX:
+      devWrite(i2c.mem, i2c.p, i2c.n);
+      I2C_CALLBACK(hi2c, MemTxCpltCallback);
+      break;
+    case OP_MEM_RX:
+      halModelAdvance(COST_RXNE * i2c.n);
+      devRead(i2c.mem, i2c.p, i2c.n);
+      I2C_CALLBACK(hi2c, MemRxCpltCallback);
+      break;
+    default:
+      I2C_CALLBACK(hi2c, MasterTxCpltCallback);
+      break;
+  }
+}
+
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
+{
+  (void)hi2c;
+  halModelError("I2C error interrupt not modelled");
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  halModelAdvance(COST_INIT);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  halModelAdvance(COST_INIT);
+  return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  halModelAdvance(COST_ISR);
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+typedef struct
+{
+  int32_t       status;
+  double        ms;
+  double        cpuMs;
+  unsigned long polls;
+} xferResult;
+
+static int      doneCount;
+static int32_t  doneStatus;
+static uint64_t doneAt;
+
+static void done(int32_t Status)
+{
+  doneCount++;
+  doneStatus = Status;
+  doneAt     = halModelNow;
+}
+
+/* Asynchronous transfer, the application working until its callback. NFCTAG CPU: the start
+   call (the whole transfer when blocking), plus the interrupts until the end */
+static void run(int write, uint16_t addr, uint8_t *p, uint32_t n, xferResult *r)
+{
+  uint64_t      t0     = halModelNow;
+  uint64_t      isr0   = halModelIsrCycles;
+  unsigned long polls0 = dev.polls;
+  uint64_t      call;
+
+  doneCount = 0;
+  if( write != 0 )
+  {
+    r->status = NFCMEM_IO_MemWriteAsync(ST25DV_ADDR_DATA_I2C, addr, p, n, done);
+  }
+  else
+  {
+    r->status = NFCMEM_IO_MemReadAsync(ST25DV_ADDR_DATA_I2C, addr, p, n, done);
+  }
+  call = halModelNow - t0;
+  while( (r->status == NFCTAG_OK) && (doneCount == 0) && ((halModelNow - t0) < XFER_MAX) )
+  {
+    halModelWork(APP_SLICE);
+  }
+  if( r->status == NFCTAG_OK )
+  {
+    r->status = (doneCount == 1) ? doneStatus : NFCTAG_ERROR;
+  }
+  r->ms    = HAL_MODEL_MS(doneAt - t0);
+  r->cpuMs = HAL_MODEL_MS(call + (halModelIsrCycles - isr0));
+  r->polls = dev.polls - polls0;
+}
+
+static void workload(const char *what, uint16_t addr, uint32_t n)
+{
+  static uint8_t src[EEPROM_SIZE];
+  static uint8_t dst[EEPROM_SIZE];
+  const uint8_t *mem = devMem(addr, n);
+  xferResult     w;
+  xferResult     r;
+  uint32_t       i;
+  int            same;
+
+  for( i = 0; i < n; i++ )
+  {
+    src[i] = (uint8_t)rand();
+  }
+  memset(dst, 0, n);
+  run(1, addr, src, n, &w);
+  run(0, addr, dst, n, &r);
+  same = (memcmp(src, dst, n) == 0) && (mem != NULL) && (memcmp(src, mem, n) == 0);
+  printf("%-18s %4lu B  write %7.1f ms %5.1f kB/s cpu %7.2f ms (%5.1f%%) polls %6lu | "
+         "read %6.2f ms %5.1f kB/s cpu %5.2f ms (%4.1f%%)  %s\n", what, (unsigned long)n,
+         w.ms, n / w.ms / 1.024, w.cpuMs, (100.0 * w.cpuMs) / w.ms, w.polls,
+         r.ms, n / r.ms / 1.024, r.cpuMs, (100.0 * r.cpuMs) / r.ms, same ? "ok" : "MISMATCH");
+  if( (w.status != NFCTAG_OK) || (r.status != NFCTAG_OK) || !same )
+  {
+    fail++;
+  }
+}
+
+int main(void)
+{
+  static uint8_t buf[512];
+  static uint8_t rd[64];
+  unsigned long  errors;
+  uint64_t       t0;
+  int32_t        ret;
+  uint32_t       i;
+
+  srand(7);
+  if( NFCMEM_IO_Init() != NFCTAG_OK )
+  {
+    printf("NFCMEM_IO_Init failed\n");
+    return 1;
+  }
+
+  workload("user memory", 0x0000, 8192);
+  workload("unaligned", 0x0013, 1000);
+  workload("mailbox", 0x2008, 256);
+
+  /* Blocking write of the ST25DV component */
+  for( i = 0; i < 64U; i++ )
+  {
+    buf[i] = (uint8_t)(i ^ 0x5AU);
+  }
+  t0  = halModelNow;
+  ret = NFCMEM_IO_MemWrite(ST25DV_ADDR_DATA_I2C, 0x0100, buf, 64);
+  printf("NFCMEM_IO_MemWrite 64 B: status %ld after %.1f ms, %s\n", (long)ret, HAL_MODEL_MS(halModelNow - t0),
+         (memcmp(&dev.eeprom[0x0100], buf, 64) == 0) ? "ok" : "MISMATCH");
+  if( (ret != NFCTAG_OK) || (memcmp(&dev.eeprom[0x0100], buf, 64) != 0) )
+  {
+    fail++;
+  }
+
+  /* A blocking read waits for the asynchronous write in progress */
+  for( i = 0; i < sizeof(buf); i++ )
+  {
+    buf[i] = (uint8_t)rand();
+  }
+  doneCount = 0;
+  t0  = halModelNow;
+  ret = NFCMEM_IO_MemWriteAsync(ST25DV_ADDR_DATA_I2C, 0x0400, buf, sizeof(buf), done);
+  if( ret == NFCTAG_OK )
+  {
+    ret = NFCMEM_IO_MemRead(ST25DV_ADDR_DATA_I2C, 0x0400, rd, sizeof(rd));
+  }
+  printf("NFCMEM_IO_MemRead during a 512 B write: status %ld after %.1f ms, %s\n", (long)ret,
+         HAL_MODEL_MS(halModelNow - t0), (memcmp(rd, buf, sizeof(rd)) == 0) ? "ok" : "MISMATCH");
+  if( (ret != NFCTAG_OK) || (doneCount != 1) || (memcmp(rd, buf, sizeof(rd)) != 0) )
+  {
+    fail++;
+  }
+
+#if ST25_DISCOVERY_NFCTAG_ASYNC
+  {
+    xferResult r;
+
+    /* Write cycle that never ends: the ready polls stop after ST25DV_WRITE_TIMEOUT */
+    dev.stuck = 1;
+    run(1, 0x0200, buf, 16, &r);
+    dev.stuck     = 0;
+    dev.busyUntil = halModelNow;
+    printf("write cycle never ending: status %ld after %.1f ms (%lu polls)\n", (long)r.status, r.ms, r.polls);
+    if( r.status != NFCTAG_TIMEOUT )
+    {
+      fail++;
+    }
+
+    /* End of transfer interrupt lost: NFCMEM_IO_Wait gives up, the next transfers run */
+    i2c.lost  = 1;
+    doneCount = 0;
+    t0  = halModelNow;
+    ret = NFCMEM_IO_MemReadAsync(ST25DV_ADDR_DATA_I2C, 0x0000, rd, sizeof(rd), done);
+    if( ret == NFCTAG_OK )
+    {
+      ret = NFCMEM_IO_Wait();
+    }
+    printf("lost I2C interrupt: NFCMEM_IO_Wait status %ld after %.1f ms, callback %d (status %ld)\n", (long)ret,
+           HAL_MODEL_MS(halModelNow - t0), doneCount, (long)doneStatus);
+    if( (ret != NFCTAG_TIMEOUT) || (doneCount != 1) || (doneStatus != NFCTAG_TIMEOUT) )
+    {
+      fail++;
+    }
+    workload("after the reset", 0x0040, 32);
+  }
+#endif /* ST25_DISCOVERY_NFCTAG_ASYNC */
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+  printf("application I2C callbacks called %lu times\n", appCallbacks);
+  if( appCallbacks != 0U )
+  {
+    fail++;
+  }
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+
+  errors = halModelErrors;
+  printf("model errors %lu\n", errors);
+  if( errors != 0U )
+  {
+    fail++;
+  }
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
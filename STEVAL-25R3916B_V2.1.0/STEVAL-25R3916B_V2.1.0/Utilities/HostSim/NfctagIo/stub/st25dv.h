@@ -0,0 +1,7 @@
+/* Host stub: the ST25DV component is not part of this package, only the values used by
+   st25_discovery.c. The write timeout covers the write cycle of a 256-byte write (64 blocks
+   of up to 5 ms), with margin. */
+#define ST25DV_ADDR_DATA_I2C        0xA6U      /* I2C address of the user memory and dynamic registers */
+#define ST25DV_GPO_DYN_REG          0x2000U    /* First dynamic register, the mailbox follows          */
+#define ST25DV_WRITE_TIMEOUT        400U       /* ms                                                   */
+#define ST25DV_I2C_TIMEOUT          200U       /* ms                                                   */
@@ -0,0 +1 @@
+/* Host stub: st25_discovery.c does not use the ST25DVxxKC declarations */
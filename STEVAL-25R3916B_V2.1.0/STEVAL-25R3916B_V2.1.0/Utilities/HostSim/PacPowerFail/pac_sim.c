@@ -0,0 +1,308 @@
+/**
+  ******************************************************************************
+  * @file    pac_sim.c
+  * @author  MMY Application Team
+  * @brief   Host power-fail simulator of the Persistent Analog Config log (pac.c)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "pac.h"
+#include "rfal_analogConfig.h"
+#include "flash_driver.h"
+
+/* pac.c places its 2 pages log in a read-only section, the simulator writes it */
+extern const uint8_t PersistentAnalogConfigLog[];
+#define LOG                 ((uint8_t *)PersistentAnalogConfigLog)
+#define LOG_SIZE            (2U * FLASH_PAGE_SIZE)
+#define LOG_FIRST_PAGE      ((ANALOG_CONFIG_OFFSET % FLASH_BANK_SIZE) / FLASH_PAGE_SIZE)
+
+/* RFAL analog config table: ram is the table to store, inst the last one installed */
+static uint8_t  ram[RFAL_ANALOG_CONFIG_TBL_SIZE];
+static uint16_t ramLen;
+static uint8_t  inst[RFAL_ANALOG_CONFIG_TBL_SIZE];
+static uint16_t instLen;
+static int      installed;
+
+/* Power cut after 'budget' flash operations (-1: never) */
+static long     budget = -1;
+static jmp_buf  powerCut;
+static long     nProg, nErase;
+
+/* Double-words torn by a power cut: their ECC bits are not consistent, they can't
+   be programmed before an erase and a read raises a double ECC error (eccModel) */
+static uint8_t  torn[LOG_SIZE / 8U];
+static int      eccModel = 1;
+
+ReturnCode rfalAnalogConfigListWriteRaw( const uint8_t *configTbl, uint16_t configTblSize )
+{
+  memcpy(inst, configTbl, configTblSize);
+  instLen   = configTblSize;
+  installed = 1;
+  return 0;
+}
+
+ReturnCode rfalAnalogConfigListReadRaw( uint8_t *tblBuf, uint16_t tblBufLen, uint16_t *configTblSize )
+{
+  (void)tblBufLen;
+  memcpy(tblBuf, ram, ramLen);
+  *configTblSize = ramLen;
+  return 0;
+}
+
+/* pac.c works with 32-bit addresses: keep the same truncation */
+static uint32_t logOffset(uint32_t addr)
+{
+  return addr - (uint32_t)(uintptr_t)PersistentAnalogConfigLog;
+}
+
+stError flash_PageErase(uint32_t pageStart, uint32_t nb, uint32_t bank)
+{
+  uint32_t o = (pageStart - LOG_FIRST_PAGE) * FLASH_PAGE_SIZE;
+
+  (void)bank;
+  for (uint32_t i = 0; i < nb; i++, o += FLASH_PAGE_SIZE)
+  {
+    nErase++;
+    if (budget == 0)
+    {
+      /* Interrupted erase: page content undefined */
+      for (uint32_t k = 0; k < FLASH_PAGE_SIZE; k += 7U)
+      {
+        LOG[o + k] = (uint8_t)rand();
+      }
+      memset(&torn[o / 8U], 1, FLASH_PAGE_SIZE / 8U);
+      longjmp(powerCut, 1);
+    }
+    if (budget > 0)
+    {
+      budget--;
+    }
+    memset(&LOG[o], 0xFF, FLASH_PAGE_SIZE);
+    memset(&torn[o / 8U], 0, FLASH_PAGE_SIZE / 8U);
+  }
+  return ERR_NONE;
+}
+
+stError flash_Program(uint32_t flashAddr, const uint64_t* data, uint32_t length)
+{
+  uint32_t o = logOffset(flashAddr);
+
+  for (uint32_t i = 0; i < ((length + 7U) / 8U); i++, o += 8U)
+  {
+    nProg++;
+    if (torn[o / 8U] != 0U)
+    {
+      return ERR_WRITE;         /* ECC bits already programmed */
+    }
+    for (uint32_t k = 0; k < 8U; k++)
+    {
+      if (LOG[o + k] != 0xFFU)
+      {
+        return ERR_WRITE;       /* programming a non erased double-word */
+      }
+    }
+    if (budget == 0)
+    {
+      /* Interrupted program: part of the bits only */
+      int h = rand() % 9;
+      memcpy(&LOG[o], &data[i], (size_t)h);
+      torn[o / 8U] = 1U;
+      longjmp(powerCut, 1);
+    }
+    if (budget > 0)
+    {
+      budget--;
+    }
+    memcpy(&LOG[o], &data[i], 8U);
+  }
+  return ERR_NONE;
+}
+
+void flash_EccNmiHandler(void)
+{
+}
+
+/* pac.c calls this after reading a range: report a torn double-word in it */
+bool flash_EccError(uint32_t flashAddr, uint32_t length)
+{
+  uint32_t o = logOffset(flashAddr) & ~7U;
+
+  if (eccModel == 0)
+  {
+    return false;
+  }
+  for (; o < (logOffset(flashAddr) + length); o += 8U)
+  {
+    if (torn[o / 8U] != 0U)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void randomTable(uint8_t *t, uint16_t *n, int seed)
+{
+  srand((unsigned)seed);
+  *n = (uint16_t)(300 + (rand() % 700));
+  for (int i = 0; i < *n; i++)
+  {
+    t[i] = (uint8_t)rand();
+  }
+}
+
+static int isInstalled(const uint8_t *t, uint16_t n)
+{
+  return installed && (instLen == n) && (memcmp(inst, t, n) == 0);
+}
+
+int main(int argc, char *argv[])
+{
+  static uint8_t save[LOG_SIZE];
+  static uint8_t saveTorn[sizeof(torn)];
+  uint8_t  a[RFAL_ANALOG_CONFIG_TBL_SIZE], b[RFAL_ANALOG_CONFIG_TBL_SIZE];
+  uint16_t an, bn;
+  long     p0, e0;
+  int      fails = 0, trials = 0, seeds = 2000;
+  uintptr_t pg = (uintptr_t)PersistentAnalogConfigLog & ~((uintptr_t)sysconf(_SC_PAGESIZE) - 1U);
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-noecc") == 0)
+    {
+      eccModel = 0;     /* torn double-words read back without ECC error */
+    }
+    else
+    {
+      seeds = atoi(argv[i]);
+    }
+  }
+  if (mprotect((void *)pg, ((uintptr_t)PersistentAnalogConfigLog + LOG_SIZE) - pg, PROT_READ | PROT_WRITE) != 0)
+  {
+    perror("mprotect");
+    return 2;
+  }
+  memset(LOG, 0, LOG_SIZE);
+
+  /* Functional: sequence of single byte updates */
+  randomTable(ram, &ramLen, 1);
+  installed = 0;
+  persistentAnalogConfig_Enable();
+  p0 = nProg;
+  e0 = nErase;
+  for (int u = 0; u < 200; u++)
+  {
+    ram[rand() % ramLen] ^= (uint8_t)(1 + (rand() % 255));
+    if (persistentAnalogConfig_Program() != ERR_NONE)
+    {
+      printf("update %d: program error\n", u);
+      return 1;
+    }
+    memcpy(a, ram, ramLen);
+    an = ramLen;
+    installed = 0;
+    persistentAnalogConfig_Enable();
+    if (!isInstalled(a, an))
+    {
+      printf("update %d: table mismatch\n", u);
+      return 1;
+    }
+  }
+  printf("200 single-byte updates: %ld double-word programs, %ld page erases\n", nProg - p0, nErase - e0);
+
+  /* Power cut injected after each flash operation of an update from a to b */
+  for (int seed = 0; seed < seeds; seed++)
+  {
+    randomTable(a, &an, 1000 + seed);
+    randomTable(b, &bn, 5000 + seed);
+    memcpy(b, a, (an < bn) ? an : bn);
+    for (int k = 0; k < (1 + (seed % 5)); k++)
+    {
+      b[rand() % bn] ^= 0x5A;
+    }
+    memcpy(ram, a, an);
+    ramLen = an;
+    budget = -1;
+    persistentAnalogConfig_Enable();
+    persistentAnalogConfig_Program();
+    for (int pre = 0; pre < (seed % 40); pre++)
+    {
+      ram[rand() % ramLen] ^= 1U;
+      persistentAnalogConfig_Program();
+    }
+    memcpy(a, ram, ramLen);
+    an = ramLen;
+
+    for (long cut = 0; ; cut++)
+    {
+      volatile int done = 0;
+
+      memcpy(save, LOG, LOG_SIZE);
+      memcpy(saveTorn, torn, sizeof(torn));
+      memcpy(ram, b, bn);
+      ramLen = bn;
+      budget = -1;
+      persistentAnalogConfig_Enable();
+      budget = cut;
+      if (setjmp(powerCut) == 0)
+      {
+        persistentAnalogConfig_Program();
+        done = 1;
+      }
+
+      /* Reboot: either the old or the new table, the new one if the update completed */
+      budget = -1;
+      installed = 0;
+      persistentAnalogConfig_Enable();
+      trials++;
+      if (!(isInstalled(a, an) || isInstalled(b, bn)) || (done && !isInstalled(b, bn)))
+      {
+        if (fails++ < 5)
+        {
+          printf("seed %d cut %ld: wrong table after reboot (installed %d)\n", seed, cut, installed);
+        }
+      }
+
+      /* The next update after the recovery must work */
+      memcpy(ram, b, bn);
+      ramLen = bn;
+      persistentAnalogConfig_Program();
+      installed = 0;
+      persistentAnalogConfig_Enable();
+      if (!isInstalled(b, bn))
+      {
+        if (fails++ < 5)
+        {
+          printf("seed %d cut %ld: no recovery\n", seed, cut);
+        }
+      }
+
+      memcpy(LOG, save, LOG_SIZE);
+      memcpy(torn, saveTorn, sizeof(torn));
+      if (done)
+      {
+        break;
+      }
+    }
+  }
+  printf("power-fail trials %d (%s), failures %d\n", trials, eccModel ? "torn double-words raise ECC errors" : "torn double-words read without ECC error", fails);
+  return (fails != 0);
+}
@@ -0,0 +1,25 @@
+/* Host stub: the part of rfal_analogConfig.h and of the STM32 HAL used by pac.c */
+#ifndef RFAL_ANALOG_CONFIG_H
+#define RFAL_ANALOG_CONFIG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "st_errno.h"
+
+typedef uint16_t ReturnCode;
+#define RFAL_ERR_NONE                  (0U)
+
+#define RFAL_ANALOG_CONFIG_TBL_SIZE    (1024U)
+
+/* STM32L476 Flash geometry */
+#define FLASH_BASE                     (0x08000000UL)
+#define FLASH_BANK_SIZE                (0x00080000UL)
+#define FLASH_PAGE_SIZE                (0x00000800UL)
+#define FLASH_BANK_1                   (1U)
+#define FLASH_BANK_2                   (2U)
+
+ReturnCode rfalAnalogConfigListWriteRaw( const uint8_t *configTbl, uint16_t configTblSize );
+ReturnCode rfalAnalogConfigListReadRaw( uint8_t *tblBuf, uint16_t tblBufLen, uint16_t *configTblSize );
+
+#endif /* RFAL_ANALOG_CONFIG_H */
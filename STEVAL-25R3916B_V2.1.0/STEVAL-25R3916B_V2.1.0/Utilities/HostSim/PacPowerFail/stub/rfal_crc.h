@@ -0,0 +1 @@
+/* Host stub: pac.c does not use the RFAL CRC */
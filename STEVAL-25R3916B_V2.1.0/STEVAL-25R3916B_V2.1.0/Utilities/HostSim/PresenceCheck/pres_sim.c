@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * @file    pres_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the T4T presence check (rfal_isoDep.c, ndef_t4t.c)
+  *          against an ISO14443-4 PICC model, and T5T/T2T air time of the probes
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <string.h>
+#include "rfal_rf.h"
+#include "rfal_isoDep.h"
+#include "ndef_poller.h"
+#include "ndef_t4t.h"
+
+/* 106 kbps: one byte with parity is 9 bit times of 128/fc */
+#define BYTE_MS          (9.0 * 9.44e-3)
+#define PICC_TURN_MS     0.02                       /* Frame delay PICC to PCD              */
+#define PICC_APDU_MS     1.5                        /* Application processing of an APDU    */
+#define PICC_BLOCK_MS    0.09                       /* ISO-DEP processing of an R-block     */
+
+/*
+******************************************************************************
+* PICC MODEL
+******************************************************************************
+*/
+static double     simMs;                           /* Simulated time                       */
+static int        frames;                          /* Frames sent by the PCD               */
+static int        rBlocks;                         /* R-blocks sent by the PCD             */
+static bool       present = true;
+static bool       ignoresRnak;                     /* Does not answer R-blocks at all      */
+
+static uint8_t    piccBN = 1;
+static uint8_t    lastTx[64];
+static uint16_t   lastTxLen;
+static uint8_t   *rxBuf;
+static uint16_t  *rxRcvdLen;
+static ReturnCode pending;
+
+static void piccReply(const uint8_t *buf, uint16_t len, double procMs)
+{
+  memcpy(rxBuf, buf, len);
+  *rxRcvdLen = (uint16_t)(len * 8U);
+  simMs     += procMs + (len * BYTE_MS) + PICC_TURN_MS;
+  memcpy(lastTx, buf, len);
+  lastTxLen  = len;
+  pending    = RFAL_ERR_NONE;
+}
+
+ReturnCode rfalStartTransceive(const rfalTransceiveContext *ctx)
+{
+  const uint8_t *tx  = ctx->txBuf;
+  uint16_t       len = (uint16_t)(ctx->txBufLen / 8U);
+  uint8_t        pcb = tx[0];
+  uint8_t        r[8];
+
+  frames++;
+  simMs    += (len + 2U) * BYTE_MS;                /* + CRC */
+  rxBuf     = ctx->rxBuf;
+  rxRcvdLen = ctx->rxRcvdLen;
+
+  if( (pcb & 0xC0U) == 0x80U )
+  {
+    rBlocks++;
+  }
+  if( !present || (ignoresRnak && ((pcb & 0xC0U) == 0x80U)) )
+  {
+    simMs  += ctx->fwt / 13560.0;
+    pending = RFAL_ERR_TIMEOUT;
+    return RFAL_ERR_NONE;
+  }
+
+  if( (pcb & 0xC0U) == 0x00U )
+  {
+    /* I-block: the PICC toggles its block number and answers the APDU */
+    piccBN ^= 1U;
+    r[0]    = (uint8_t)(0x02U | piccBN);
+    if( len == 1U )
+    {
+      r[1] = 0x67; r[2] = 0x00;                    /* Empty APDU: wrong length */
+      piccReply(r, 3, PICC_APDU_MS);
+    }
+    else
+    {
+      r[1] = 0x00; r[2] = 0x90; r[3] = 0x00;
+      piccReply(r, 4, PICC_APDU_MS);
+    }
+  }
+  else if( (pcb & 0xC0U) == 0x80U )
+  {
+    if( (pcb & 0x01U) == piccBN )
+    {
+      uint8_t last[64];
+
+      memcpy(last, lastTx, lastTxLen);             /* Rule 11: re-send the last I-block */
+      piccReply(last, lastTxLen, PICC_BLOCK_MS);
+    }
+    else if( (pcb & 0x10U) != 0U )
+    {
+      r[0] = (uint8_t)(0xA2U | piccBN);            /* Rule 12: R(NAK) answered by R(ACK) */
+      piccReply(r, 1, PICC_BLOCK_MS);
+    }
+    else
+    {
+      pending = RFAL_ERR_PROTO;
+    }
+  }
+  else
+  {
+    pending = RFAL_ERR_PROTO;
+  }
+  return RFAL_ERR_NONE;
+}
+
+/*
+******************************************************************************
+* RFAL STUBS
+******************************************************************************
+*/
+ReturnCode rfalGetTransceiveStatus(void)                  { return pending; }
+void       rfalWorker(void)                               { }
+bool       rfalIsTransceiveInTx(void)                     { return false; }
+void       HAL_Delay(uint32_t delay)                      { (void)delay; }
+uint32_t   timerCalculateTimer(uint16_t time)             { (void)time; return 0; }
+bool       timerIsExpired(uint32_t timer)                 { (void)timer; return true; }
+ReturnCode rfalFieldOnAndStartGT(void)                    { return RFAL_ERR_NONE; }
+uint32_t   rfalGetFDTPoll(void)                           { return 0; }
+void       rfalSetFDTPoll(uint32_t FDTPoll)               { (void)FDTPoll; }
+uint32_t   rfalNfcbTR2ToFDT(uint8_t tr2Code)              { (void)tr2Code; return 0; }
+ReturnCode rfalSetBitRate(rfalBitRate txBR, rfalBitRate rxBR)  { (void)txBR; (void)rxBR; return RFAL_ERR_NONE; }
+void       rfalSetErrorHandling(rfalEHandling eHandle)    { (void)eHandle; }
+void       rfalSetGT(uint32_t GT)                         { (void)GT; }
+
+ReturnCode rfalTransceiveBlockingTx(uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen,
+                                    uint16_t *actLen, uint32_t flags, uint32_t fwt)
+{
+  (void)txBuf; (void)txBufLen; (void)rxBuf; (void)rxBufLen; (void)actLen; (void)flags; (void)fwt;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalTransceiveBlockingTxRx(uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen,
+                                      uint16_t *actLen, uint32_t flags, uint32_t fwt)
+{
+  (void)txBuf; (void)txBufLen; (void)rxBuf; (void)rxBufLen; (void)actLen; (void)flags; (void)fwt;
+  return RFAL_ERR_NONE;
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+#define SIM_FWT          (4096U * 16U)             /* FWI 4, ~4.8 ms */
+
+static int fail;
+
+static ReturnCode readBinary(void)
+{
+  static rfalIsoDepApduBufFormat tx;
+  static rfalIsoDepApduBufFormat rx;
+  static rfalIsoDepBufFormat     tmp;
+  static uint16_t                rxLen;
+  static const uint8_t           apdu[] = { 0x00, 0xB0, 0x00, 0x00, 0x01 };
+  rfalIsoDepApduTxRxParam        param;
+  ReturnCode                     ret;
+
+  memcpy(tx.apdu, apdu, sizeof(apdu));
+  param.txBuf    = &tx;
+  param.txBufLen = sizeof(apdu);
+  param.rxBuf    = &rx;
+  param.rxLen    = &rxLen;
+  param.tmpBuf   = &tmp;
+  param.FWT      = SIM_FWT;
+  param.dFWT     = 0;
+  param.FSx      = 256;
+  param.ourFSx   = 256;
+  param.DID      = RFAL_ISODEP_NO_DID;
+
+  (void)rfalIsoDepStartApduTransceive(param);
+  do {
+    ret = rfalIsoDepGetApduTransceiveStatus();
+  } while( ret == RFAL_ERR_BUSY );
+  return ret;
+}
+
+static ReturnCode presenceCheck(rfalIsoDepPresCheckMethod method)
+{
+  rfalIsoDepPresCheckParam param = { method, SIM_FWT, 0, 256, RFAL_ISODEP_NO_DID };
+
+  return rfalIsoDepPresenceCheck(param);
+}
+
+/* Runs one exchange, prints its cost; expected: return code and frames sent */
+static void measure(const char *name, ReturnCode ret, double t0, int f0, ReturnCode expRet)
+{
+  printf("%-22s: ret %2d  %5.2f ms  %d frame(s)\n", name, ret, simMs - t0, frames - f0);
+  if( ret != expRet )
+  {
+    printf("  <- FAIL\n");
+    fail++;
+  }
+}
+
+static void inSync(const char *name)
+{
+  ReturnCode ret = readBinary();
+
+  printf("ReadBinary after %-12s: %s\n", name, (ret == RFAL_ERR_NONE) ? "in sync" : "FAIL");
+  fail += (ret == RFAL_ERR_NONE) ? 0 : 1;
+}
+
+/* T5T (ISO15693) air time at 26.48 kbps: 1 of 4 request, high data rate one subcarrier response */
+static double t5tMs(unsigned reqBytes, unsigned rspBytes)
+{
+  const double byteUs = 4.0 * 75.52;               /* 1 of 4: 2 bits per 75.52 us; response: 8 x 37.76 us */
+  const double t1Us   = 4192.0 / 13.56;
+
+  return (75.52 + (reqBytes * byteUs) + 37.76 + t1Us + 113.28 + (rspBytes * byteUs) + 113.28) / 1000.0;
+}
+
+/* T2T (ISO14443A) air time at 106 kbps, 1172/fc frame delay */
+static double t2tMs(unsigned reqBytes, unsigned rspBytes)
+{
+  return (((reqBytes + rspBytes) * 9.0 * 9.44) + (1172.0 / 13.56)) / 1000.0;
+}
+
+int main(void)
+{
+  ndefContext ctx;
+  ndefStatus  st;
+  double      t0;
+  int         f0;
+  int         r0;
+  ReturnCode  ret;
+
+  rfalIsoDepInitialize();
+
+  /* T4T: cost of each probe against a PICC that follows ISO14443-4 */
+  (void)readBinary();
+  t0 = simMs; f0 = frames; ret = readBinary();
+  measure("ReadBinary", ret, t0, f0, RFAL_ERR_NONE);
+  t0 = simMs; f0 = frames; ret = presenceCheck(RFAL_ISODEP_PRES_CHK_IBLOCK);
+  measure("empty I-block", ret, t0, f0, RFAL_ERR_NONE);
+  inSync("I-block");
+  t0 = simMs; f0 = frames; ret = presenceCheck(RFAL_ISODEP_PRES_CHK_RNAK);
+  measure("R(NAK)", ret, t0, f0, RFAL_ERR_NONE);
+  inSync("R(NAK)");
+  ret  = presenceCheck(RFAL_ISODEP_PRES_CHK_RNAK);
+  ret |= presenceCheck(RFAL_ISODEP_PRES_CHK_RNAK);
+  fail += (ret == RFAL_ERR_NONE) ? 0 : 1;
+  inSync("2x R(NAK)");
+
+  /* Tag removed: every frame runs to FWT, R(NAK) retries are shorter frames */
+  present = false;
+  t0 = simMs; f0 = frames; ret = presenceCheck(RFAL_ISODEP_PRES_CHK_RNAK);
+  measure("R(NAK), removed", ret, t0, f0, RFAL_ERR_TIMEOUT);
+  rfalIsoDepInitialize();
+  t0 = simMs; f0 = frames; ret = readBinary();
+  measure("ReadBinary, removed", ret, t0, f0, RFAL_ERR_TIMEOUT);
+
+  /* NDEF_PRES_CHK_AUTO against a PICC that ignores R(NAK): confirmed by ReadBinary, kept for the session */
+  present     = true;
+  ignoresRnak = true;
+  piccBN      = 1;
+  rfalIsoDepInitialize();
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.type             = NDEF_DEV_T4T;
+  ctx.presChk          = NDEF_PRES_CHK_AUTO;
+  ctx.subCtx.t4t.FWT   = SIM_FWT;
+  ctx.subCtx.t4t.FSx   = 256;
+  ctx.subCtx.t4t.DID   = RFAL_ISODEP_NO_DID;
+
+  t0 = simMs; f0 = frames; r0 = rBlocks; st = ndefT4TPollerCheckPresence(&ctx);
+  printf("AUTO, R(NAK) ignored  : ret %2d  %5.2f ms  %d frame(s), method %s\n", st, simMs - t0, frames - f0,
+         (ctx.presChk == NDEF_PRES_CHK_READ) ? "ReadBinary" : "unchanged");
+  fail += ((st == ERR_NONE) && (ctx.presChk == NDEF_PRES_CHK_READ) && (rBlocks > r0)) ? 0 : 1;
+  t0 = simMs; f0 = frames; r0 = rBlocks; st = ndefT4TPollerCheckPresence(&ctx);
+  printf("AUTO, next check      : ret %2d  %5.2f ms  %d frame(s), %d R-block(s)\n", st, simMs - t0, frames - f0,
+         rBlocks - r0);
+  fail += ((st == ERR_NONE) && (rBlocks == r0) && ((frames - f0) == 1)) ? 0 : 1;
+
+  /* T5T addressed: READ_SINGLE_BLOCK (flags cmd UID blk CRC / flags 4 data CRC) vs 1 slot Inventory (flags cmd len CRC / flags DSFID UID CRC) */
+  printf("T5T addressed read    : %5.2f ms\n", t5tMs(13, 7));
+  printf("T5T inventory 1 slot  : %5.2f ms\n", t5tMs(5, 12));
+  /* T2T in sector 1: SECTOR_SELECT (2 packets, passive ACK of 1 ms) + READ, vs READ of the current sector */
+  printf("T2T select + read     : %5.2f ms\n", t2tMs(4, 0) + (4.0 * 9.44e-3) + (6.0 * 9.0 * 9.44e-3) + 1.0 + t2tMs(4, 18));
+  printf("T2T read              : %5.2f ms\n", t2tMs(4, 18));
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
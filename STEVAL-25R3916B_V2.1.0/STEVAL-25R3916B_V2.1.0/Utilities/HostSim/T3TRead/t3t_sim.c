@@ -0,0 +1,205 @@
+/**
+  ******************************************************************************
+  * @file    t3t_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the T3T NDEF read (ndef_t3t.c, rfal_nfcf.c) against
+  *          a FeliCa tag model
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rfal_nfcf.h"
+#include "ndef_poller.h"
+#include "ndef_t3t.h"
+
+/* 212 kbps: 8 bits per byte, preamble + sync + CRC around each frame */
+#define BYTE_MS          (8.0 / 212.0)
+#define FRAME_OVH        10U
+#define HOST_TURN_MS     0.4                        /* Host turnaround between two Checks   */
+#define TAG_CHECK_MS     0.3                        /* Tag processing of a Check ...        */
+#define TAG_BLOCK_MS     0.1                        /* ... plus per block read              */
+
+/*
+******************************************************************************
+* FELICA TAG MODEL
+******************************************************************************
+*/
+static uint8_t mem[0x10000];
+static int     tagNbr;                             /* Max blocks per Check of the tag      */
+static double  simMs;
+static int     checks;
+static long    copied;                             /* Bytes moved by memcpy/memmove        */
+
+void *__real_memcpy(void *dst, const void *src, size_t n);
+void *__real_memmove(void *dst, const void *src, size_t n);
+
+void *__wrap_memcpy(void *dst, const void *src, size_t n)
+{
+  copied += (long)n;
+  return __real_memcpy(dst, src, n);
+}
+
+void *__wrap_memmove(void *dst, const void *src, size_t n)
+{
+  copied += (long)n;
+  return __real_memmove(dst, src, n);
+}
+
+/* Check command: LEN 06h NFCID2[8] NoS SC[2*NoS] NoB BlockList, answered with the blocks */
+ReturnCode rfalTransceiveBlockingTxRx(uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen,
+                                      uint16_t *actLen, uint32_t flags, uint32_t fwt)
+{
+  uint8_t rsp[300];
+  int     nos;
+  int     nob;
+  int     p;
+  int     n = 0;
+  int     i;
+
+  (void)flags; (void)fwt;
+  checks++;
+  simMs += ((txBufLen + 1U + FRAME_OVH) * BYTE_MS) + HOST_TURN_MS;
+
+  nos = txBuf[9];
+  p   = 10 + (2 * nos);
+  nob = txBuf[p++];
+  rsp[n++] = 0;
+  rsp[n++] = 0x07;
+  __real_memcpy(&rsp[n], &txBuf[1], 8);
+  n += 8;
+  if( nob > tagNbr )
+  {
+    rsp[n++] = 0xFF;                               /* Status flags: too many blocks */
+    rsp[n++] = 0xA2;
+  }
+  else
+  {
+    rsp[n++] = 0;
+    rsp[n++] = 0;
+    rsp[n++] = (uint8_t)nob;
+    for( i = 0; i < nob; i++ )
+    {
+      int bn;
+
+      if( (txBuf[p] & 0x80U) != 0U )
+      {
+        bn = txBuf[p + 1];
+        p += 2;
+      }
+      else
+      {
+        bn = txBuf[p + 1] | (txBuf[p + 2] << 8);
+        p += 3;
+      }
+      __real_memcpy(&rsp[n], &mem[bn * 16], 16);
+      n += 16;
+    }
+  }
+  rsp[0] = (uint8_t)n;
+  simMs += TAG_CHECK_MS + (TAG_BLOCK_MS * nob) + ((n + FRAME_OVH) * BYTE_MS);
+
+  if( n > rxBufLen )
+  {
+    return RFAL_ERR_NOMEM;
+  }
+  __real_memcpy(rxBuf, rsp, (size_t)n);
+  *actLen = (uint16_t)n;
+  return RFAL_ERR_NONE;
+}
+
+/*
+******************************************************************************
+* RFAL STUBS
+******************************************************************************
+*/
+ReturnCode rfalFeliCaPoll(rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollRes *pollResList,
+                          uint8_t pollResListSize, uint8_t *devicesDetected, uint8_t *collisionsDetected)
+{
+  (void)slots; (void)sysCode; (void)reqCode; (void)pollResList; (void)pollResListSize;
+  (void)devicesDetected; (void)collisionsDetected;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalStartFeliCaPoll(rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollRes *pollResList,
+                               uint8_t pollResListSize, uint8_t *devicesDetected, uint8_t *collisionsDetected)
+{
+  (void)slots; (void)sysCode; (void)reqCode; (void)pollResList; (void)pollResListSize;
+  (void)devicesDetected; (void)collisionsDetected;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalGetFeliCaPollStatus(void)                              { return RFAL_ERR_NONE; }
+ReturnCode rfalSetMode(rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR) { (void)mode; (void)txBR; (void)rxBR; return RFAL_ERR_NONE; }
+void       rfalSetErrorHandling(rfalEHandling eHandle)                { (void)eHandle; }
+void       rfalSetFDTListen(uint32_t FDTListen)                       { (void)FDTListen; }
+void       rfalSetFDTPoll(uint32_t FDTPoll)                           { (void)FDTPoll; }
+void       rfalSetGT(uint32_t GT)                                     { (void)GT; }
+void       rfalWorker(void)                                           { }
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+static int fail;
+
+static void run(const char *name, int nbr, uint32_t offset, uint32_t len)
+{
+  static ndefContext ctx;
+  static uint8_t     out[0x4000];
+  uint32_t           rcvd = 0;
+  ndefStatus         st;
+  bool               ok;
+
+  tagNbr          = nbr;
+  ctx.type        = NDEF_DEV_T3T;
+  ctx.state       = NDEF_STATE_READWRITE;
+  ctx.cc.t3t.nbR  = (uint8_t)nbr;
+  __real_memmove(out, &mem[0x8000], sizeof(out));   /* Garbage around the destination */
+  simMs  = 0;
+  checks = 0;
+  copied = 0;
+
+  st = ndefT3TPollerReadBytes(&ctx, offset, len, out, &rcvd);
+  ok = (st == ERR_NONE) && (rcvd == len) && (memcmp(out, &mem[offset], len) == 0) && (out[len] == mem[0x8000 + len]);
+  printf("%-21s Nbr %2d off %3u len %4u : %s  Checks %2d  %6.2f ms  %4.1f B/ms  copied %6ld B\n",
+         name, nbr, (unsigned)offset, (unsigned)len, ok ? "ok " : "BAD", checks, simMs, len / simMs, copied);
+  fail += ok ? 0 : 1;
+}
+
+int main(void)
+{
+  int i;
+
+  srand(1);
+  for( i = 0; i < (int)sizeof(mem); i++ )
+  {
+    mem[i] = (uint8_t)rand();
+  }
+
+  run("Lite-S full", 4, 16, 208);
+  run("Lite-S unaligned", 4, 21, 190);
+  run("Nbr 12 1 KB", 12, 16, 1024);
+  run("Nbr 12 1 KB unaligned", 12, 23, 1001);
+  run("Nbr 15 4 KB", 15, 16, 4096);
+  run("Nbr 15 4 KB unaligned", 15, 19, 4090);
+  run("Nbr 1 small", 1, 16, 40);
+  run("Nbr 15 tiny", 15, 17, 3);
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,862 @@
+/**
+  ******************************************************************************
+  * @file    caps_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the NFCTAG transfers (st25_discovery_st25r.c) against tag models
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <string.h>
+#include "st25_discovery_st25r.h"
+
+#define NO_ANSWER_MS     4.8                        /* Frame sent to a tag that does not answer */
+#define T5T_WRITE_MS     5.0                        /* Programming time of a T5T block          */
+#define T2T_WRITE_MS     4.1                        /* Programming time of a T2T page           */
+#define T3T_WRITE_MS     2.5                        /* Programming time of a T3T block          */
+
+/*
+******************************************************************************
+* TAG MODEL
+******************************************************************************
+*/
+enum { TAG_T2T, TAG_T4T, TAG_T3T, TAG_T5T };
+
+typedef struct {
+  const char *name;
+  int         kind;
+  int         size;                                 /* User memory in bytes                     */
+  int         fastRead;                             /* T2T: FAST_READ supported                 */
+  int         mle, mlc, fsc;                        /* T4T: CC file MLe, MLc and the FSC        */
+  int         nbr, nbw;                             /* T3T: blocks per Check and per Update     */
+  int         bs, maxRmb, ext, wmb;                 /* T5T: block size, blocks per Read Multiple,
+                                                       extended commands, blocks per Write Multiple */
+} TagModel;
+
+static const TagModel models[] = {
+  { "T2T NTAG216 (FAST_READ)",              TAG_T2T,  924, 1 },
+  { "T2T Ultralight (no FAST_READ)",        TAG_T2T,   64, 0 },
+  { "T4T ST25TA (MLe/MLc 0xF6)",            TAG_T4T, 1024, 0, 0xF6, 0xF6, 256 },
+  { "T4T small MLe/MLc 0x3B, FSC 64",       TAG_T4T, 1024, 0, 0x3B, 0x3B,  64 },
+  { "T3T Lite-S (Nbr 4, Nbw 1)",            TAG_T3T, 1024, 0, 0, 0, 0,  4, 1 },
+  { "T3T (Nbr 12, Nbw 8)",                  TAG_T3T, 4096, 0, 0, 0, 0, 12, 8 },
+  { "T5T ST25DV64K (ext, WMB 4)",           TAG_T5T, 8192, 0, 0, 0, 0, 0, 0, 4, 256, 1, 4 },
+  { "T5T ICODE-like (RMB 32, no WMB/ext)",  TAG_T5T,  320, 0, 0, 0, 0, 0, 0, 4,  32, 0, 0 },
+};
+
+static const TagModel *tag;
+static uint8_t  mem[16384];                         /* Tag memory                               */
+static bool     idle;                               /* T2T: NAKed, back to IDLE until WUPA      */
+static uint8_t  loseCmd;                            /* Next frame with this command is lost     */
+static uint8_t  t4tFile;                            /* T4T: 0 CC file selected, 1 NDEF file     */
+static rfalIsoDepTxRxParam isoDepParam;
+static long     frames;
+static long     txBytes;
+static long     rxBytes;
+static long     violations;                         /* Frames above the limits of the tag      */
+static double   airMs;
+
+/* Air time of a frame: 106 kbps (T2T, T4T), 212 kbps (T3T), 26.48 kbps high data rate (T5T) */
+static void account(int tx, int rx, double extraMs)
+{
+  double byteMs;
+  double turnMs;
+
+  frames++;
+  txBytes += tx;
+  rxBytes += rx;
+  switch( tag->kind )
+  {
+    case TAG_T2T:
+    case TAG_T4T:
+      byteMs = 9.0 / 106.0;
+      turnMs = 0.3;
+      break;
+    case TAG_T3T:
+      byteMs = 8.0 / 212.0;
+      turnMs = 0.5;
+      tx += 8;                                      /* Preamble, sync code                      */
+      rx += 8;
+      break;
+    default:
+      byteMs = 8.0 / 26.48;
+      turnMs = 0.6;
+      break;
+  }
+  airMs += turnMs + ((double)(tx + 2 + rx + 2) * byteMs) + extraMs;   /* CRC included */
+}
+
+/* Loses the frame when it is the one selected by the test: no answer, the reader times out */
+static bool lost(uint8_t cmd, int tx)
+{
+  if( (loseCmd == 0U) || (cmd != loseCmd) )
+  {
+    return false;
+  }
+  loseCmd = 0;
+  account(tx, 0, NO_ANSWER_MS);
+  return true;
+}
+
+/* T2T frames: READ, FAST_READ, WRITE. A NAK sends the tag to IDLE */
+static ReturnCode t2tHandle(const uint8_t *tx, uint16_t txLen, uint8_t *rx, uint16_t rxSize, uint16_t *rxLen)
+{
+  int pages = tag->size / 4;
+  int i;
+  int n;
+
+  if( idle || lost(tx[0], txLen) )
+  {
+    if( idle )
+    {
+      account(txLen, 0, 0);
+    }
+    return RFAL_ERR_TIMEOUT;
+  }
+  switch( tx[0] )
+  {
+    case 0x30:
+      if( tx[1] >= pages )
+      {
+        break;
+      }
+      /* READ rolls over to page 0 at the end of the memory */
+      for( i = 0; i < 16; i++ )
+      {
+        rx[i] = mem[((tx[1] * 4) + i) % tag->size];
+      }
+      *rxLen = 16;
+      account(txLen, 16, 0);
+      return RFAL_ERR_NONE;
+
+    case 0x3A:
+      if( (tag->fastRead == 0) || (tx[2] >= pages) || (tx[1] > tx[2]) )
+      {
+        break;
+      }
+      n = ((tx[2] - tx[1]) + 1) * 4;
+      account(txLen, n, 0);
+      if( n > rxSize )
+      {
+        return RFAL_ERR_NOMEM;
+      }
+      memcpy(rx, &mem[tx[1] * 4], n);
+      *rxLen = n;
+      return RFAL_ERR_NONE;
+
+    case 0xA2:
+      if( tx[1] >= pages )
+      {
+        break;
+      }
+      memcpy(&mem[tx[1] * 4], &tx[2], 4);
+      *rxLen = 1;                                   /* 4-bit ACK */
+      account(txLen, 1, T2T_WRITE_MS);
+      return RFAL_ERR_INCOMPLETE_BYTE;
+
+    default:
+      account(txLen, 0, 0);
+      return RFAL_ERR_TIMEOUT;
+  }
+  /* 4-bit NAK */
+  idle   = true;
+  *rxLen = 1;
+  account(txLen, 1, 0);
+  return RFAL_ERR_INCOMPLETE_BYTE;
+}
+
+/* T3T frames: Check and Update without encryption, one service, Nbr/Nbw enforced */
+static ReturnCode t3tHandle(const uint8_t *tx, uint16_t txLen, uint8_t *rx, uint16_t *rxLen)
+{
+  int blocks[64];
+  int n = tx[12];
+  int limit = (tx[0] == 0x06) ? tag->nbr : tag->nbw;
+  int pos = 13;
+  int k;
+
+  for( k = 0; (k < n) && (k < 64); k++ )
+  {
+    if( (tx[pos] & 0x80U) != 0U )
+    {
+      blocks[k] = tx[pos + 1];
+      pos += 2;
+    }
+    else
+    {
+      blocks[k] = tx[pos + 1] | (tx[pos + 2] << 8);
+      pos += 3;
+    }
+  }
+  rx[1] = tx[0] + 1U;
+  memcpy(&rx[2], &tx[1], 8);                        /* NFCID2 */
+  if( n > limit )
+  {
+    rx[10] = 0xFF;
+    rx[11] = 0xA2;                                  /* Wrong number of blocks */
+    rx[0]  = 12;
+    *rxLen = 12;
+    account(txLen, 12, 0);
+    return RFAL_ERR_NONE;
+  }
+  rx[10] = 0;
+  rx[11] = 0;
+  if( tx[0] == 0x06 )
+  {
+    rx[12] = n;
+    for( k = 0; k < n; k++ )
+    {
+      memcpy(&rx[13 + (16 * k)], &mem[16 * blocks[k]], 16);
+    }
+    *rxLen = 13 + (16 * n);
+    account(txLen, *rxLen, 0.3 * n);
+  }
+  else
+  {
+    for( k = 0; k < n; k++ )
+    {
+      memcpy(&mem[16 * blocks[k]], &tx[pos + (16 * k)], 16);
+    }
+    *rxLen = 12;
+    account(txLen, 12, T3T_WRITE_MS * n);
+  }
+  rx[0] = (uint8_t)*rxLen;
+  return RFAL_ERR_NONE;
+}
+
+/* T5T addressed request: flags, command, UID, parameters. Answers with the ISO15693 error codes */
+static ReturnCode t5tHandle(const uint8_t *req, int len, uint8_t *rx, uint16_t rxSize, uint16_t *rxLen)
+{
+  const uint8_t *p = &req[10];
+  int nblocks = tag->size / tag->bs;
+  int first = p[0];
+  int n = 1;
+  bool write = false;
+
+  *rxLen = 0;
+  if( lost(req[1], len) )
+  {
+    return RFAL_ERR_TIMEOUT;
+  }
+  switch( req[1] )
+  {
+    case 0x20:                                      /* Read Single Block */
+      break;
+    case 0x23:                                      /* Read Multiple Blocks */
+      n = p[1] + 1;
+      break;
+    case 0x21:                                      /* Write Single Block */
+      write = true;
+      p += 1;
+      break;
+    case 0x24:                                      /* Write Multiple Blocks */
+      write = true;
+      n = p[1] + 1;
+      p += 2;
+      break;
+    case 0x30:                                      /* Extended Read Single Block */
+    case 0x33:                                      /* Extended Read Multiple Blocks */
+    case 0x31:                                      /* Extended Write Single Block */
+    case 0x34:                                      /* Extended Write Multiple Blocks */
+    case 0x3B:                                      /* Extended Get System Information */
+      if( tag->ext == 0 )
+      {
+        goto notSupported;
+      }
+      first = p[0] | (p[1] << 8);
+      if( req[1] == 0x3B )
+      {
+        rx[0]  = 0;
+        *rxLen = 1 + 14;
+        account(len, *rxLen, 0);
+        return RFAL_ERR_NONE;
+      }
+      if( (req[1] == 0x33) || (req[1] == 0x34) )
+      {
+        n = (p[2] | (p[3] << 8)) + 1;
+      }
+      write = (req[1] == 0x31) || (req[1] == 0x34);
+      p += ((req[1] == 0x34) ? 4 : 2);
+      break;
+    default:
+      goto notSupported;
+  }
+  if( ((req[1] == 0x24) || (req[1] == 0x34)) && (tag->wmb == 0) )
+  {
+    goto notSupported;
+  }
+  /* Block not available: too many blocks, across a Write Multiple group, or out of the memory */
+  if( (!write && (n > tag->maxRmb)) ||
+      (write && (n > 1) && ((n > tag->wmb) || ((first / 4) != ((first + n - 1) / 4)))) ||
+      ((first + n) > nblocks) )
+  {
+    rx[0]  = 0x01;
+    rx[1]  = 0x10;
+    *rxLen = 2;
+    account(len, 2, 0);
+    return RFAL_ERR_REQUEST;
+  }
+  if( write )
+  {
+    memcpy(&mem[first * tag->bs], p, n * tag->bs);
+    rx[0]  = 0;
+    *rxLen = 1;
+    account(len, 1, T5T_WRITE_MS * n);
+    return RFAL_ERR_NONE;
+  }
+  account(len, 1 + (n * tag->bs), 0);
+  if( (1 + (n * tag->bs)) > rxSize )
+  {
+    return RFAL_ERR_NOMEM;
+  }
+  rx[0] = 0;
+  memcpy(&rx[1], &mem[first * tag->bs], n * tag->bs);
+  *rxLen = 1 + (n * tag->bs);
+  return RFAL_ERR_NONE;
+
+notSupported:
+  rx[0]  = 0x01;
+  rx[1]  = 0x01;
+  *rxLen = 2;
+  account(len, 2, 0);
+  return RFAL_ERR_NOTSUPP;
+}
+
+static uint8_t uidA[7] = { 0x04, 1, 2, 3, 4, 5, 6 };
+static uint8_t uidV[8] = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x26, 0x02, 0xE0 };
+
+static ReturnCode t5tRequest(uint8_t cmd, const uint8_t *params, int paramLen, uint8_t *rx, uint16_t rxSize, uint16_t *rxLen)
+{
+  uint8_t frame[300];
+
+  frame[0] = 0x22;
+  frame[1] = cmd;
+  memcpy(&frame[2], uidV, 8);
+  memcpy(&frame[10], params, paramLen);
+  return t5tHandle(frame, 10 + paramLen, rx, rxSize, rxLen);
+}
+
+/*
+******************************************************************************
+* RFAL STUBS
+******************************************************************************
+*/
+void       HAL_Delay(uint32_t Delay)                         { (void)Delay; }
+void       rfalWorker(void)                                  { }
+void       rfalIsoDepInitialize(void)                        { }
+ReturnCode rfalFieldOff(void)                                { return RFAL_ERR_NONE; }
+ReturnCode rfalFieldOnAndStartGT(void)                       { return RFAL_ERR_NONE; }
+ReturnCode rfalNfcaPollerInitialize(void)                    { return RFAL_ERR_NONE; }
+ReturnCode rfalNfcbPollerInitialize(void)                    { return RFAL_ERR_NONE; }
+ReturnCode rfalNfcfPollerInitialize(rfalBitRate bitRate)     { (void)bitRate; return RFAL_ERR_NONE; }
+ReturnCode rfalT1TPollerInitialize(void)                     { return RFAL_ERR_NONE; }
+ReturnCode rfalSt25tbPollerInitialize(void)                  { return RFAL_ERR_NONE; }
+ReturnCode rfalSt25tbPollerCheckPresence(uint8_t *chipId)    { (void)chipId; return RFAL_ERR_TIMEOUT; }
+ReturnCode rfalSt25tbPollerSelect(uint8_t chipId)            { (void)chipId; return RFAL_ERR_TIMEOUT; }
+
+uint16_t rfalIsoDepFSxI2FSx(uint8_t FSxI)
+{
+  static const uint16_t fsx[] = { 16, 24, 32, 40, 48, 64, 96, 128, 256, 512, 1024, 2048, 4096 };
+  return fsx[FSxI];
+}
+
+ReturnCode rfalSt25tbPollerReadBlock(uint8_t blockAddr, rfalSt25tbBlock *blockData)
+{
+  (void)blockAddr; (void)blockData;
+  return RFAL_ERR_TIMEOUT;
+}
+
+ReturnCode rfalSt25tbPollerWriteBlock(uint8_t blockAddr, const rfalSt25tbBlock *blockData)
+{
+  (void)blockAddr; (void)blockData;
+  return RFAL_ERR_TIMEOUT;
+}
+
+ReturnCode rfalT1TPollerRall(const uint8_t *uid, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rxRcvdLen)
+{
+  (void)uid; (void)rxBuf; (void)rxBufLen; (void)rxRcvdLen;
+  return RFAL_ERR_TIMEOUT;
+}
+
+ReturnCode rfalT1TPollerWrite(const uint8_t *uid, uint8_t address, uint8_t data)
+{
+  (void)uid; (void)address; (void)data;
+  return RFAL_ERR_TIMEOUT;
+}
+
+ReturnCode rfalNfcbPollerCheckPresence(rfalNfcbSensCmd cmd, rfalNfcbSlots slots, rfalNfcbSensbRes *sensbRes, uint8_t *sensbResLen)
+{
+  (void)cmd; (void)slots; (void)sensbRes; (void)sensbResLen;
+  return RFAL_ERR_TIMEOUT;
+}
+
+ReturnCode rfalIsoDepPollBHandleActivation(rfalIsoDepFSxI FSDI, uint8_t DID, rfalBitRate maxBR, uint8_t PARAM,
+                                           const rfalNfcbListenDevice *nfcbDev, const uint8_t *HLInfo, uint8_t HLInfoLen,
+                                           rfalIsoDepDevice *isoDepDev)
+{
+  (void)FSDI; (void)DID; (void)maxBR; (void)PARAM; (void)nfcbDev; (void)HLInfo; (void)HLInfoLen; (void)isoDepDev;
+  return RFAL_ERR_TIMEOUT;
+}
+
+/* WUPA/REQA: wakes up a T2T sent to IDLE by a NAK */
+ReturnCode rfalNfcaPollerCheckPresence(rfal14443AShortFrameCmd cmd, rfalNfcaSensRes *sensRes)
+{
+  (void)cmd; (void)sensRes;
+  account(1, 2, 0);
+  idle = false;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalNfcaPollerSelect(const uint8_t *nfcid1, uint8_t nfcidLen, rfalNfcaSelRes *selRes)
+{
+  (void)nfcid1; (void)nfcidLen; (void)selRes;
+  account(2 * 7, 2 * 3, 0);                         /* Two cascade levels */
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalIsoDepPollAHandleActivation(rfalIsoDepFSxI FSDI, uint8_t DID, rfalBitRate maxBR, rfalIsoDepDevice *isoDepDev)
+{
+  (void)FSDI; (void)DID; (void)maxBR;
+  account(2, 8, 0);                                 /* RATS, ATS */
+  isoDepDev->info.FSx = tag->fsc;
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalTransceiveBlockingTxRx(uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen,
+                                      uint16_t *actLen, uint32_t flags, uint32_t fwt)
+{
+  (void)flags; (void)fwt;
+  *actLen = 0;
+  switch( tag->kind )
+  {
+    case TAG_T2T:
+      return t2tHandle(txBuf, txBufLen, rxBuf, rxBufLen, actLen);
+    case TAG_T3T:
+      return t3tHandle(txBuf, txBufLen, rxBuf, actLen);
+    case TAG_T5T:
+      return t5tHandle(txBuf, txBufLen, rxBuf, rxBufLen, actLen);
+    default:
+      account(txBufLen, 0, 0);
+      return RFAL_ERR_TIMEOUT;
+  }
+}
+
+/* ISO-DEP: the APDU is answered by rfalIsoDepGetTransceiveStatus() */
+ReturnCode rfalIsoDepStartTransceive(rfalIsoDepTxRxParam param)
+{
+  if( tag->kind != TAG_T4T )
+  {
+    account(param.txBufLen + 1, 0, NO_ANSWER_MS);
+    return RFAL_ERR_TIMEOUT;
+  }
+  isoDepParam = param;
+  return RFAL_ERR_NONE;
+}
+
+static void t4tAnswer(const uint8_t *data, int len, uint8_t sw1)
+{
+  if( len > 0 )
+  {
+    memcpy(isoDepParam.rxBuf->inf, data, len);
+  }
+  isoDepParam.rxBuf->inf[len]     = sw1;
+  isoDepParam.rxBuf->inf[len + 1] = 0x00;
+  *isoDepParam.rxLen = len + 2;
+  if( (len + 2 + 3) > 256 )                         /* Response frame above the FSD */
+  {
+    violations++;
+  }
+}
+
+/* T4T APDUs: SELECT, READ BINARY and UPDATE BINARY on the CC and NDEF files, MLe/MLc enforced */
+ReturnCode rfalIsoDepGetTransceiveStatus(void)
+{
+  uint8_t  cc[15] = { 0x00, 0x0F, 0x20, 0, 0, 0, 0, 0x04, 0x06, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00 };
+  uint8_t *apdu = isoDepParam.txBuf->inf;
+  int      txLen = isoDepParam.txBufLen;
+  double   extraMs = 0;
+  int      offset = (apdu[2] << 8) | apdu[3];
+
+  cc[3] = tag->mle >> 8;
+  cc[4] = tag->mle;
+  cc[5] = tag->mlc >> 8;
+  cc[6] = tag->mlc;
+  if( (txLen + 3) > tag->fsc )                      /* Command frame above the FSC */
+  {
+    violations++;
+  }
+  if( apdu[1] == 0xA4 )
+  {
+    if( apdu[2] == 0x00 )
+    {
+      t4tFile = ((apdu[5] == 0xE1) && (apdu[6] == 0x03)) ? 0 : 1;
+    }
+    t4tAnswer(NULL, 0, 0x90);
+  }
+  else if( apdu[1] == 0xB0 )
+  {
+    int le = (apdu[4] != 0U) ? apdu[4] : 256;
+    int fileSize = (t4tFile != 0U) ? tag->size : (int)sizeof(cc);
+
+    if( le > tag->mle )
+    {
+      t4tAnswer(NULL, 0, 0x67);
+    }
+    else
+    {
+      if( (offset + le) > fileSize )
+      {
+        le = fileSize - offset;
+      }
+      t4tAnswer((t4tFile != 0U) ? &mem[offset] : &cc[offset], le, 0x90);
+    }
+  }
+  else if( apdu[1] == 0xD6 )
+  {
+    int lc = apdu[4];
+
+    if( (lc > tag->mlc) || (lc != (txLen - 5)) )
+    {
+      t4tAnswer(NULL, 0, 0x67);
+    }
+    else
+    {
+      memcpy(&mem[offset], &apdu[5], lc);
+      t4tAnswer(NULL, 0, 0x90);
+      extraMs = 5.0 * ((lc + 15) / 16);
+    }
+  }
+  else
+  {
+    t4tAnswer(NULL, 0, 0x6D);
+  }
+  account(txLen + 1, *isoDepParam.rxLen + 1, 0.5 + extraMs);
+  return RFAL_ERR_NONE;
+}
+
+ReturnCode rfalNfcvPollerReadSingleBlock(uint8_t flags, const uint8_t *uid, uint8_t blockNum,
+                                         uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+{
+  (void)flags; (void)uid;
+  return t5tRequest(0x20, &blockNum, 1, rxBuf, rxBufLen, rcvLen);
+}
+
+ReturnCode rfalNfcvPollerExtendedReadSingleBlock(uint8_t flags, const uint8_t *uid, uint16_t blockNum,
+                                                 uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+{
+  uint8_t p[2] = { (uint8_t)blockNum, (uint8_t)(blockNum >> 8) };
+  (void)flags; (void)uid;
+  return t5tRequest(0x30, p, 2, rxBuf, rxBufLen, rcvLen);
+}
+
+ReturnCode rfalNfcvPollerReadMultipleBlocks(uint8_t flags, const uint8_t *uid, uint8_t firstBlockNum, uint8_t numOfBlocks,
+                                            uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+{
+  uint8_t p[2] = { firstBlockNum, numOfBlocks };
+  (void)flags; (void)uid;
+  return t5tRequest(0x23, p, 2, rxBuf, rxBufLen, rcvLen);
+}
+
+ReturnCode rfalNfcvPollerExtendedReadMultipleBlocks(uint8_t flags, const uint8_t *uid, uint16_t firstBlockNum, uint16_t numOfBlocks,
+                                                    uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+{
+  uint8_t p[4] = { (uint8_t)firstBlockNum, (uint8_t)(firstBlockNum >> 8), (uint8_t)numOfBlocks, (uint8_t)(numOfBlocks >> 8) };
+  (void)flags; (void)uid;
+  return t5tRequest(0x33, p, 4, rxBuf, rxBufLen, rcvLen);
+}
+
+ReturnCode rfalNfcvPollerWriteSingleBlock(uint8_t flags, const uint8_t *uid, uint8_t blockNum, const uint8_t *wrData, uint8_t blockLen)
+{
+  uint8_t  p[64];
+  uint8_t  rx[8];
+  uint16_t rxLen;
+  (void)flags; (void)uid;
+  p[0] = blockNum;
+  memcpy(&p[1], wrData, blockLen);
+  return t5tRequest(0x21, p, 1 + blockLen, rx, sizeof(rx), &rxLen);
+}
+
+ReturnCode rfalNfcvPollerExtendedWriteSingleBlock(uint8_t flags, const uint8_t *uid, uint16_t blockNum, const uint8_t *wrData, uint8_t blockLen)
+{
+  uint8_t  p[64];
+  uint8_t  rx[8];
+  uint16_t rxLen;
+  (void)flags; (void)uid;
+  p[0] = (uint8_t)blockNum;
+  p[1] = (uint8_t)(blockNum >> 8);
+  memcpy(&p[2], wrData, blockLen);
+  return t5tRequest(0x31, p, 2 + blockLen, rx, sizeof(rx), &rxLen);
+}
+
+ReturnCode rfalNfcvPollerWriteMultipleBlocks(uint8_t flags, const uint8_t *uid, uint8_t firstBlockNum, uint8_t numOfBlocks,
+                                             uint8_t *txBuf, uint16_t txBufLen, uint8_t blockLen, const uint8_t *wrData, uint16_t wrDataLen)
+{
+  uint8_t  p[300];
+  uint8_t  rx[8];
+  uint16_t rxLen;
+  (void)flags; (void)uid; (void)txBuf; (void)blockLen;
+  if( (4U + 8U + wrDataLen) > txBufLen )
+  {
+    return RFAL_ERR_PARAM;
+  }
+  p[0] = firstBlockNum;
+  p[1] = numOfBlocks - 1U;
+  memcpy(&p[2], wrData, wrDataLen);
+  return t5tRequest(0x24, p, 2 + wrDataLen, rx, sizeof(rx), &rxLen);
+}
+
+ReturnCode rfalNfcvPollerExtendedWriteMultipleBlocks(uint8_t flags, const uint8_t *uid, uint16_t firstBlockNum, uint16_t numOfBlocks,
+                                                     uint8_t *txBuf, uint16_t txBufLen, uint8_t blockLen, const uint8_t *wrData, uint16_t wrDataLen)
+{
+  uint8_t  p[300];
+  uint8_t  rx[8];
+  uint16_t rxLen;
+  (void)flags; (void)uid; (void)txBuf; (void)blockLen;
+  if( (4U + 8U + wrDataLen) > txBufLen )
+  {
+    return RFAL_ERR_PARAM;
+  }
+  p[0] = (uint8_t)firstBlockNum;
+  p[1] = (uint8_t)(firstBlockNum >> 8);
+  p[2] = (uint8_t)(numOfBlocks - 1U);
+  p[3] = (uint8_t)((numOfBlocks - 1U) >> 8);
+  memcpy(&p[4], wrData, wrDataLen);
+  return t5tRequest(0x34, p, 4 + wrDataLen, rx, sizeof(rx), &rxLen);
+}
+
+ReturnCode rfalNfcvPollerExtendedGetSystemInformation(uint8_t flags, const uint8_t *uid, uint8_t requestField,
+                                                      uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+{
+  (void)flags; (void)uid;
+  return t5tRequest(0x3B, &requestField, 1, rxBuf, rxBufLen, rcvLen);
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+static rfalNfcDevice device;
+static uint8_t       ref[sizeof(mem)];              /* Expected tag memory                      */
+static int           fail;
+static bool          baseline;                      /* Skips the cases the code before the caps overflowed on */
+
+static void setup(const TagModel *m)
+{
+  uint16_t sum = 0;
+  int      i;
+
+  tag  = m;
+  idle = false;
+  memset(&device, 0, sizeof(device));
+  uidA[6] = (uint8_t)(m - models);                  /* One cache entry per tag */
+  uidV[0] = (uint8_t)(m - models);
+  for( i = 0; i < (int)sizeof(mem); i++ )
+  {
+    mem[i] = (uint8_t)((i * 7) + 3);
+  }
+  switch( m->kind )
+  {
+    case TAG_T2T:
+    case TAG_T4T:
+      device.type             = RFAL_NFC_LISTEN_TYPE_NFCA;
+      device.dev.nfca.type    = (m->kind == TAG_T2T) ? RFAL_NFCA_T2T : RFAL_NFCA_T4T;
+      device.nfcid            = uidA;
+      device.nfcidLen         = 7;
+      memcpy(device.dev.nfca.nfcId1, uidA, 7);
+      device.dev.nfca.nfcId1Len = 7;
+      device.proto.isoDep.info.FSx = m->fsc;
+      break;
+    case TAG_T3T:
+      /* Attribute information block: Ver, Nbr, Nbw, Nmaxb, checksum */
+      memset(mem, 0, 16);
+      mem[0] = 0x10;
+      mem[1] = m->nbr;
+      mem[2] = m->nbw;
+      mem[4] = 0x3F;
+      for( i = 0; i < 14; i++ )
+      {
+        sum += mem[i];
+      }
+      mem[14] = sum >> 8;
+      mem[15] = sum;
+      device.type     = RFAL_NFC_LISTEN_TYPE_NFCF;
+      device.nfcid    = device.dev.nfcf.sensfRes.NFCID2;
+      device.nfcidLen = 8;
+      memcpy(device.dev.nfcf.sensfRes.NFCID2, uidA, 7);
+      break;
+    default:
+      device.type     = RFAL_NFC_LISTEN_TYPE_NFCV;
+      memcpy(device.dev.nfcv.InvRes.UID, uidV, 8);
+      device.nfcid    = device.dev.nfcv.InvRes.UID;
+      device.nfcidLen = 8;
+      break;
+  }
+  memcpy(ref, mem, sizeof(mem));
+}
+
+static void reset(void)
+{
+  frames  = 0;
+  txBytes = 0;
+  rxBytes = 0;
+  airMs   = 0;
+}
+
+static long activate(const char *what)
+{
+  reset();
+  if( BSP_NFCTAG_Activate(&device) != NFCTAG_OK )
+  {
+    fail++;
+  }
+  printf("  %-30s frames %4ld  air %8.1f ms\n", what, frames, airMs);
+  return frames;
+}
+
+/* Reads or writes through the BSP and checks the data against the tag memory, returns the frames sent */
+static long run(const char *what, bool write, uint32_t offset, uint32_t length, bool expectOk)
+{
+  static uint8_t buf[4096];
+  uint8_t  status;
+  bool     ok;
+  uint32_t i;
+
+  reset();
+  if( write )
+  {
+    for( i = 0; i < length; i++ )
+    {
+      buf[i] = (uint8_t)(0xA5U ^ (i * 13U));
+    }
+    status = BSP_NFCTAG_WriteData(buf, offset, length);
+    memcpy(&ref[offset], buf, length);
+    ok = (status == NFCTAG_OK) && (memcmp(ref, mem, sizeof(mem)) == 0);
+  }
+  else
+  {
+    memset(buf, 0, sizeof(buf));
+    status = BSP_NFCTAG_ReadData(buf, offset, length);
+    ok = (status == NFCTAG_OK) && (memcmp(buf, &mem[offset], length) == 0);
+  }
+  /* Only the next request is checked against the reference */
+  memcpy(ref, mem, sizeof(mem));
+  printf("  %-30s frames %4ld  tx %5ld B  rx %5ld B  air %8.1f ms  %s\n", what, frames, txBytes, rxBytes, airMs,
+         ok ? "ok" : (expectOk ? "FAIL" : "error (expected)"));
+  if( ok != expectOk )
+  {
+    fail++;
+  }
+  return frames;
+}
+
+static void check(const char *what, bool cond)
+{
+  if( !cond )
+  {
+    printf("  %s  <- FAIL\n", what);
+    fail++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  unsigned k;
+  long     first;
+  long     again;
+
+  baseline = (argc > 1) && (strcmp(argv[1], "-baseline") == 0);
+  for( k = 0; k < (sizeof(models) / sizeof(models[0])); k++ )
+  {
+    const TagModel *m = &models[k];
+
+    setup(m);
+    violations = 0;
+    printf("%s\n", m->name);
+    activate("activate (first)");
+    activate("activate (again)");
+    run("read 16 @0", false, 0, 16, true);
+    if( m->kind == TAG_T2T )
+    {
+      run("read 48 @0", false, 0, 48, true);
+      if( m->size > 512 )
+      {
+        run("read 512 @16", false, 16, 512, true);
+        run("read 200 @722 (to end)", false, 722, 200, true);
+      }
+      run("write 32 @16", true, 16, 32, true);
+      if( !baseline )
+      {
+        run("write 7 @18 (unaligned)", true, 18, 7, true);
+      }
+      if( m->fastRead != 0 )
+      {
+        /* Past the end: a FAST_READ up to a NAKed page is not sent again, the limit gets lower at each NAK */
+        first = run("read 40 @900 (past the end)", false, 900, 40, false);
+        again = run("read 40 @900 (again)", false, 900, 40, false);
+        check("past the end, second read not shorter", again < first);
+        run("read 40 @900 (again)", false, 900, 40, false);
+        again = run("read 40 @900 (again)", false, 900, 40, false);
+        check("past the end, FAST_READ still NAKed", again == 4);
+        check("read to end after the NAKs not in one frame", run("read 200 @722 (again)", false, 722, 200, true) == 1);
+      }
+    }
+    else if( (m->kind == TAG_T5T) && (m->size < 1024) )
+    {
+      run("read 300 @0", false, 0, 300, true);
+      run("read 300 @0 (again)", false, 0, 300, true);
+      run("write 128 @16", true, 16, 128, true);
+      run("write 9 @6 (unaligned)", true, 6, 9, true);
+    }
+    else
+    {
+      run("read 512 @0", false, 0, 512, true);
+      run("read 200 @0", false, 0, 200, true);
+      run("write 200 @16", true, 16, 200, true);
+      run("write 9 @21 (unaligned)", true, 21, 9, true);
+      if( m->kind == TAG_T5T )
+      {
+        run("read 512 @2048", false, 2048, 512, true);
+        run("write 128 @2048", true, 2048, 128, true);
+        /* A lost Write Multiple Blocks frame does not tell the tag rejects the command */
+        loseCmd = 0x24;
+        run("write 128 @16 (frame lost)", true, 16, 128, true);
+        check("Write Multiple Blocks given up after a lost frame", run("write 128 @2048 (again)", true, 2048, 128, true) == 8);
+      }
+      else if( !baseline || (m->kind != TAG_T4T) )
+      {
+        run("write 512 @16", true, 16, 512, true);
+      }
+    }
+    if( (m->kind == TAG_T2T) && (m->fastRead != 0) )
+    {
+      /* A lost FAST_READ probe: probed again at the next activation */
+      uidA[6] = 0x80;
+      memcpy(device.dev.nfca.nfcId1, uidA, 7);
+      loseCmd = 0x3A;
+      activate("activate (new tag, probe lost)");
+      again = activate("activate (again)");
+      check("FAST_READ not probed again", again == 4);
+      check("FAST_READ given up after a lost probe", run("read 512 @16", false, 16, 512, true) == 3);
+    }
+    if( violations != 0 )
+    {
+      printf("  frame size violations: %ld\n", violations);
+      fail++;
+    }
+  }
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
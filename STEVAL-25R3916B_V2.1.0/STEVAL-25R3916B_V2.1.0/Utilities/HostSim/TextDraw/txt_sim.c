@@ -0,0 +1,224 @@
+/**
+  ******************************************************************************
+  * @file    txt_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the LCD text drawing (st25_discovery_lcd.c) on a LCD model
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <string.h>
+#include "st25_discovery_lcd.h"
+#include "lcd_model.h"
+#include "jpeg_decode.h"
+
+/*
+******************************************************************************
+* STUBS
+******************************************************************************
+*/
+/* The JPEG decoder is not used by the text functions */
+uint32_t jpeg_decode(const char* jpeg,
+                     uint8_t (*setup)(uint32_t Width, uint32_t Height, jpeg_window_t *Window),
+                     uint8_t (*callback)(uint16_t *Pixels, uint32_t NbPixels))
+{
+  (void)jpeg; (void)setup; (void)callback;
+  return 0;
+}
+
+void jpeg_getsize(const char* jpeg, uint32_t* Width, uint32_t* Height)
+{
+  (void)jpeg;
+  *Width  = 0;
+  *Height = 0;
+}
+
+/*
+******************************************************************************
+* REFERENCE
+******************************************************************************
+*/
+static uint16_t ref[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+
+/* One character, pixel per pixel from the font table (MSB first, rows padded to a byte) */
+static void refChar(uint32_t x, uint32_t y, const sFONT *f, uint8_t ascii, uint16_t fg, uint16_t bg)
+{
+  uint32_t       bytes = (f->Width + 7U) / 8U;
+  const uint8_t *c;
+  uint32_t       i, j;
+
+  if( (ascii < ' ') || (ascii > '~') )
+  {
+    ascii = ' ';
+  }
+  c = &f->table[(ascii - ' ') * f->Height * bytes];
+  for( i = 0; i < f->Height; i++ )
+  {
+    for( j = 0; j < f->Width; j++ )
+    {
+      uint8_t on = (uint8_t)(c[(i * bytes) + (j / 8U)] & (0x80U >> (j % 8U)));
+
+      if( ((x + j) < LCD_MODEL_WIDTH) && ((y + i) < LCD_MODEL_HEIGHT) )
+      {
+        ref[y + i][x + j] = (on != 0U) ? fg : bg;
+      }
+    }
+  }
+}
+
+/* A string from x, whole characters only up to the right edge of the screen */
+static void refString(uint32_t x, uint32_t y, const sFONT *f, const char *s, uint16_t fg, uint16_t bg)
+{
+  while( (*s != '\0') && ((x + f->Width) <= LCD_MODEL_WIDTH) )
+  {
+    refChar(x, y, f, (uint8_t)*s++, fg, bg);
+    x += f->Width;
+  }
+}
+
+/* Same string through the BSP and in the reference */
+static void text(uint32_t x, uint32_t y, sFONT *f, const char *s, uint16_t fg, uint16_t bg)
+{
+  BSP_LCD_SetFont(f);
+  BSP_LCD_SetColors(fg, bg);
+  BSP_LCD_DisplayStringAt((uint16_t)x, (uint16_t)y, (uint8_t *)s, LEFT_MODE);
+  refString(x, y, f, s, fg, bg);
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+static int fail;
+
+static void start(void)
+{
+  lcdModelClear(0);
+  memset(ref, 0, sizeof(ref));
+  lcdModelReset();
+}
+
+static void check(const char *name)
+{
+  int bad = 0;
+  int x, y;
+
+  for( y = 0; y < (int)LCD_MODEL_HEIGHT; y++ )
+  {
+    for( x = 0; x < (int)LCD_MODEL_WIDTH; x++ )
+    {
+      bad += (lcdModelFb[y][x] != ref[y][x]) ? 1 : 0;
+    }
+  }
+  printf("%-24s windows %4lu  transactions %5lu  bytes %6lu  bus %5.2f ms  %s\n", name, lcdModelCnt.windows,
+         lcdModelCnt.transactions, lcdModelCnt.bytes, lcdModelBusMs(), (bad == 0) ? "ok" : "differs");
+  fail += (bad == 0) ? 0 : 1;
+}
+
+/* Main menu: a Font22 title, eight entries padded to the line width in Font16 */
+static void menu(void)
+{
+  static const char *items[] = { "Tag Detection", "Card Emulation", "Peer to Peer", "Antenna Tuning",
+                                 "NDEF Demo", "Low power", "Settings", "About" };
+  char line[32];
+  int  i;
+
+  text(0, 0, &Font22, "     Main menu      ", LCD_COLOR_WHITE, LCD_COLOR_BLUE);
+  for( i = 0; i < 8; i++ )
+  {
+    int n = 29 - (int)strlen(items[i]);
+
+    snprintf(line, sizeof(line), "%*s%s%*s", n / 2, "", items[i], n - (n / 2), "");
+    text(0, (uint32_t)(2 + i) * Font16.Height, &Font16, line,
+         (i == 2) ? LCD_COLOR_WHITE : LCD_COLOR_BLUE, (i == 2) ? LCD_COLOR_BLUE : LCD_COLOR_WHITE);
+  }
+}
+
+/* Tag screen of the poller demo */
+static void poller(void)
+{
+  text(5, 22, &Font16, "ISO14443A/NFC-A", LCD_COLOR_BLUE, LCD_COLOR_WHITE);
+  text(5, 54, &Font16, "UID:", LCD_COLOR_BLUE, LCD_COLOR_WHITE);
+  text(16, 70, &Font16, "04:A1:B2:C3:D4:E5:F6", LCD_COLOR_BLUE, LCD_COLOR_WHITE);
+  text(5, 102, &Font16, "Speed:", LCD_COLOR_BLUE, LCD_COLOR_WHITE);
+  text(16, 118, &Font16, "106 kbps", LCD_COLOR_BLUE, LCD_COLOR_WHITE);
+  text(5, 150, &Font16, "RSSI:", LCD_COLOR_BLUE, LCD_COLOR_WHITE);
+  text(0, 208, &Font16, "Field on            ", LCD_COLOR_BLUE, LCD_COLOR_WHITE);
+}
+
+int main(void)
+{
+  static sFONT * const fonts[] = { &Font8, &Font12, &Font16, &Font20, &Font22, &Font24 };
+  static const char    all[] = " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+  int                  i;
+
+  BSP_LCD_Init();
+
+  start();
+  menu();
+  check("menu redraw");
+
+  start();
+  poller();
+  check("poller tag screen");
+
+  /* Every glyph of every font, colours changing on each line: cache misses and evictions */
+  start();
+  for( i = 0; i < 24; i++ )
+  {
+    sFONT   *f   = fonts[i % 6];
+    uint32_t y   = (uint32_t)i * 10U;
+    uint32_t off = ((uint32_t)i * 7U) % (sizeof(all) - 1U);
+
+    if( (y + f->Height) <= LCD_MODEL_HEIGHT )
+    {
+      text(0, y, f, &all[off], (uint16_t)(0x1234U * (i + 1)), (uint16_t)(0x0F0FU * i));
+    }
+  }
+  check("all glyphs, 6 fonts");
+
+  /* Strings past the right edge: whole characters only */
+  start();
+  text(250, 40, &Font16, "clipped at the edge", LCD_COLOR_RED, LCD_COLOR_BLACK);
+  text(300, 80, &Font24, "AB", LCD_COLOR_GREEN, LCD_COLOR_BLACK);
+  text(312, 120, &Font8, "xyz", LCD_COLOR_WHITE, LCD_COLOR_BLACK);
+  check("right edge clipping");
+
+  /* BSP_LCD_DrawChar with glyph data outside of the font table */
+  start();
+  {
+    uint8_t glyph[16 * 2];
+
+    for( i = 0; i < (int)sizeof(glyph); i++ )
+    {
+      glyph[i] = (uint8_t)(0x5AU ^ (i * 0x11U));
+    }
+    BSP_LCD_SetFont(&Font16);
+    BSP_LCD_SetColors(LCD_COLOR_YELLOW, LCD_COLOR_BLUE);
+    BSP_LCD_DrawChar(100, 100, glyph);
+    for( i = 0; i < (int)(Font16.Height * Font16.Width); i++ )
+    {
+      uint32_t r = (uint32_t)i / Font16.Width;
+      uint32_t c = (uint32_t)i % Font16.Width;
+
+      ref[100 + r][100 + c] = ((glyph[(r * 2U) + (c / 8U)] & (0x80U >> (c % 8U))) != 0U) ? LCD_COLOR_YELLOW : LCD_COLOR_BLUE;
+    }
+  }
+  check("DrawChar, custom glyph");
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
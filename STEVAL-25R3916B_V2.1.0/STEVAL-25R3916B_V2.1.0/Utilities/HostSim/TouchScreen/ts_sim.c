@@ -0,0 +1,492 @@
+/**
+  ******************************************************************************
+  * @file    ts_sim.c
+  * @author  MMY Application Team
+  * @brief   Host simulation of the touch screen (st25_discovery_ts.c, stmpe811.c) against a STMPE811 model
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "st25_discovery_ts.h"
+
+/* TS_SIM_POLLING builds against the code before the interrupt mode: the menu polls only */
+
+#define FIFO_DEPTH       128U
+#define MENU_POLL_US     10000U                     /* Menu_Delay(10) between two polls         */
+#define TAP_PERIOD_US    100000U
+
+/*
+******************************************************************************
+* STMPE811 MODEL
+******************************************************************************
+*/
+static uint64_t nowUs;
+static uint32_t samplePeriodUs = 2000;              /* Touch sampling of the controller         */
+static uint32_t tapUs = 6000;                       /* Contact time of a tap                    */
+static int      noise = 8;                          /* Panel noise, raw units                   */
+
+static uint8_t  reg[256];
+static uint16_t fifoX[FIFO_DEPTH];
+static uint16_t fifoY[FIFO_DEPTH];
+static uint32_t fifoHead;
+static uint32_t fifoCount;
+static bool     touched;                            /* Finger on the panel                      */
+static bool     tscTouch;                           /* Touch detected by the controller         */
+static uint64_t nextSample;
+static double   posX, posY;                         /* Raw position                             */
+static double   velX, velY;                         /* Raw units per ms                         */
+static int      lastX = -1000, lastY = -1000;       /* Last sample stored, for the tracking     */
+static bool     lineLow;                            /* INT line asserted (active low)           */
+
+static bool     tapMode;
+static uint64_t tapNext;
+static int      tapsDone;
+
+static uint64_t transactions;
+static uint64_t busUs;
+static int      irqs;
+
+/* INT line, level driven: a falling edge raises EXTI0 (PE0) */
+static void updateLine(void)
+{
+  bool low = ((reg[STMPE811_REG_INT_CTRL] & STMPE811_GIT_EN) != 0U) &&
+             ((reg[STMPE811_REG_INT_STA] & reg[STMPE811_REG_INT_EN]) != 0U);
+
+  if( low && !lineLow )
+  {
+#if !defined(TS_SIM_POLLING)
+    if( reg[STMPE811_REG_INT_EN] != 0U )
+    {
+      BSP_TS_IRQHandler();
+      irqs++;
+    }
+#endif
+  }
+  lineLow = low;
+}
+
+/* One sample: panel noise with a spike now and then, window tracking, FIFO threshold and overflow */
+static void pushSample(void)
+{
+  int      track = (reg[STMPE811_REG_TSC_CTRL] >> 4) & 7;
+  double   nx = (rand() % ((2 * noise) + 1)) - noise;
+  double   ny = (rand() % ((2 * noise) + 1)) - noise;
+  uint16_t x;
+  uint16_t y;
+
+  if( (rand() % 50) == 0 )
+  {
+    nx += 600;
+  }
+  x = (uint16_t)(posX + nx);
+  y = (uint16_t)(posY + ny);
+  if( (track != 0) && (abs((int)x - lastX) < (2 << track)) && (abs((int)y - lastY) < (2 << track)) )
+  {
+    return;
+  }
+  lastX = x;
+  lastY = y;
+  if( fifoCount == FIFO_DEPTH )
+  {
+    reg[STMPE811_REG_INT_STA] |= STMPE811_GIT_FOV;
+    updateLine();
+    return;
+  }
+  fifoX[(fifoHead + fifoCount) % FIFO_DEPTH] = x;
+  fifoY[(fifoHead + fifoCount) % FIFO_DEPTH] = y;
+  fifoCount++;
+  if( (reg[STMPE811_REG_FIFO_TH] != 0U) && (fifoCount >= reg[STMPE811_REG_FIFO_TH]) )
+  {
+    reg[STMPE811_REG_INT_STA] |= STMPE811_GIT_FTH;
+  }
+  updateLine();
+}
+
+static void setTouch(bool t)
+{
+  touched = t;
+  if( ((reg[STMPE811_REG_TSC_CTRL] & 1U) == 0U) || (t == tscTouch) )
+  {
+    return;
+  }
+  tscTouch = t;
+  reg[STMPE811_REG_INT_STA] |= STMPE811_GIT_TOUCH;
+  if( t )
+  {
+    nextSample = nowUs + samplePeriodUs;
+    lastX = -1000;
+    lastY = -1000;
+  }
+  updateLine();
+}
+
+static void advanceSamples(uint64_t us)
+{
+  uint64_t end = nowUs + us;
+
+  while( tscTouch && (nextSample <= end) )
+  {
+    double dt = (double)(nextSample - nowUs) / 1000.0;
+
+    nowUs = nextSample;
+    posX += velX * dt;
+    posY += velY * dt;
+    pushSample();
+    nextSample += samplePeriodUs;
+  }
+  if( tscTouch )
+  {
+    posX += velX * (double)(end - nowUs) / 1000.0;
+    posY += velY * (double)(end - nowUs) / 1000.0;
+  }
+  nowUs = end;
+}
+
+/* Model time, with the taps of the taps scenario: one every 100 ms at a random place */
+static void advance(uint64_t us)
+{
+  uint64_t end = nowUs + us;
+
+  while( tapMode )
+  {
+    uint64_t ev = touched ? (tapNext + tapUs) : tapNext;
+
+    if( ev > end )
+    {
+      break;
+    }
+    advanceSamples(ev - nowUs);
+    if( touched )
+    {
+      setTouch(false);
+      tapNext += TAP_PERIOD_US;
+      tapsDone++;
+    }
+    else
+    {
+      posX = 1500 + (rand() % 1000);
+      posY = 1500 + (rand() % 1000);
+      velX = 0;
+      velY = 0;
+      setTouch(true);
+    }
+  }
+  advanceSamples(end - nowUs);
+}
+
+/* I2C at 400 kHz: 9 bits per byte, start, restart and stop about one bit each */
+static void i2cTransaction(uint32_t bytes)
+{
+  uint32_t us = (uint32_t)((double)((bytes * 9U) + 4U) * 2.5);
+
+  transactions++;
+  busUs += us;
+  advance(us);
+}
+
+static uint8_t regRead(uint8_t r)
+{
+  switch( r )
+  {
+    case STMPE811_REG_TSC_CTRL:
+      return (reg[r] & 0x7FU) | (tscTouch ? 0x80U : 0U);
+    case STMPE811_REG_FIFO_SIZE:
+      return (uint8_t)fifoCount;
+    case STMPE811_REG_FIFO_STA:
+      return ((fifoCount == 0U) ? 0x20U : 0U) | ((fifoCount >= reg[STMPE811_REG_FIFO_TH]) ? 0x10U : 0U);
+    default:
+      return reg[r];
+  }
+}
+
+static void regWrite(uint8_t r, uint8_t v)
+{
+  switch( r )
+  {
+    case STMPE811_REG_INT_STA:
+      reg[r] &= (uint8_t)~v;                        /* Write 1 to clear */
+      break;
+    case STMPE811_REG_FIFO_STA:
+      if( (v & 1U) != 0U )
+      {
+        fifoCount = 0;
+        fifoHead  = 0;
+      }
+      break;
+    case STMPE811_REG_SYS_CTRL1:
+      if( (v & 2U) != 0U )                          /* Soft reset */
+      {
+        memset(reg, 0, sizeof(reg));
+        reg[0]    = 0x08;
+        reg[1]    = 0x11;
+        fifoCount = 0;
+      }
+      break;
+    default:
+      reg[r] = v;
+      break;
+  }
+  updateLine();
+}
+
+static void fifoPop(uint8_t *b)
+{
+  uint16_t x = 0;
+  uint16_t y = 0;
+
+  if( fifoCount != 0U )
+  {
+    x = fifoX[fifoHead];
+    y = fifoY[fifoHead];
+    fifoHead = (fifoHead + 1U) % FIFO_DEPTH;
+    fifoCount--;
+  }
+  b[0] = (uint8_t)(x >> 4);
+  b[1] = (uint8_t)(((x & 0xFU) << 4) | (y >> 8));
+  b[2] = (uint8_t)y;
+  b[3] = 0x40;
+}
+
+/*
+******************************************************************************
+* IOE STUBS
+******************************************************************************
+*/
+void IOE_Init(void)                    { }
+void IOE_ITConfig(void)                { }
+void IOE_Delay(uint32_t Delay)         { advance((uint64_t)Delay * 1000U); }
+
+void IOE_Write(uint8_t Addr, uint8_t Reg, uint8_t Value)
+{
+  (void)Addr;
+  i2cTransaction(3);
+  regWrite(Reg, Value);
+}
+
+uint8_t IOE_Read(uint8_t Addr, uint8_t Reg)
+{
+  (void)Addr;
+  i2cTransaction(4);
+  return regRead(Reg);
+}
+
+uint16_t IOE_ReadMultiple(uint8_t Addr, uint8_t Reg, uint8_t *Buffer, uint16_t Length)
+{
+  uint16_t i;
+
+  (void)Addr;
+  i2cTransaction(3U + Length);
+  if( Reg == STMPE811_REG_TSC_DATA_NON_INC )
+  {
+    for( i = 0; (i + 4U) <= Length; i += 4U )
+    {
+      fifoPop(&Buffer[i]);
+    }
+  }
+  else
+  {
+    for( i = 0; i < Length; i++ )
+    {
+      Buffer[i] = regRead(Reg + i);
+    }
+  }
+  updateLine();
+  return 0;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  (void)GPIOx; (void)GPIO_Pin;
+  return lineLow ? GPIO_PIN_RESET : GPIO_PIN_SET;
+}
+
+/*
+******************************************************************************
+* TEST
+******************************************************************************
+*/
+enum { SCEN_IDLE, SCEN_HOLD, SCEN_DRAG, SCEN_TAPS };
+
+typedef struct {
+  const char *name;
+  int         durationMs;
+  int         kind;
+} Scenario;
+
+static int fail;
+
+/* Menu_ReadPosition() of Menu_config.c: state, then the presses queued since the last poll */
+static uint8_t readPosition(uint16_t *X, uint16_t *Y)
+{
+  TS_StateTypeDef state;
+  uint8_t         selected;
+
+  BSP_TS_GetState(&state);
+  selected = state.TouchDetected;
+  *X = state.X;
+  *Y = state.Y;
+#if !defined(TS_SIM_POLLING)
+  {
+    TS_EventTypeDef ev;
+
+    while( BSP_TS_GetEvent(&ev) != 0U )
+    {
+      if( (ev.Id == TS_EVENT_PRESS) && (state.TouchDetected == 0U) )
+      {
+        selected = 1;
+        *X = ev.X;
+        *Y = ev.Y;
+      }
+    }
+  }
+#endif
+  return selected;
+}
+
+static void run(const Scenario *sc)
+{
+  uint64_t t0 = nowUs;
+  uint64_t tr0 = transactions;
+  uint64_t bus0 = busUs;
+  uint64_t end = nowUs + ((uint64_t)sc->durationMs * 1000U);
+  int      irq0 = irqs;
+  int      presses = 0;
+  int      releases = 0;
+  int      taps = 0;
+  uint8_t  prevSel = 0;
+  uint8_t  sel;
+  uint16_t X, Y;
+  uint16_t lastPX = 0;
+  uint16_t lastPY = 0;
+  uint16_t maxJump = 0;
+  double   secs;
+  double   trPerSec;
+  int      k;
+
+  if( (sc->kind == SCEN_DRAG) || (sc->kind == SCEN_HOLD) )
+  {
+    posX = 2000;
+    posY = 2000;
+    velX = (sc->kind == SCEN_DRAG) ? 2.0 : 0;
+    velY = (sc->kind == SCEN_DRAG) ? 1.5 : 0;
+    setTouch(true);
+  }
+  if( sc->kind == SCEN_TAPS )
+  {
+    tapMode  = true;
+    tapNext  = nowUs + TAP_PERIOD_US;
+    tapsDone = 0;
+  }
+  while( nowUs < end )
+  {
+    if( sc->kind == SCEN_DRAG )
+    {
+      velX = ((posX > 3400) || (posX < 600)) ? -velX : velX;
+      velY = ((posY > 3400) || (posY < 600)) ? -velY : velY;
+    }
+    sel = readPosition(&X, &Y);
+    presses  += ((sel != 0U) && (prevSel == 0U)) ? 1 : 0;
+    releases += ((sel == 0U) && (prevSel != 0U)) ? 1 : 0;
+    if( (sel != 0U) && (prevSel != 0U) )
+    {
+      uint16_t jump = (uint16_t)(abs((int)X - lastPX) + abs((int)Y - lastPY));
+
+      maxJump = (jump > maxJump) ? jump : maxJump;
+    }
+    if( sel != 0U )
+    {
+      lastPX = X;
+      lastPY = Y;
+    }
+    prevSel = sel;
+    advance(MENU_POLL_US);
+  }
+  if( tapMode )
+  {
+    tapMode = false;
+    taps    = tapsDone;
+  }
+  setTouch(false);
+  /* Let the release through */
+  for( k = 0; k < 5; k++ )
+  {
+    sel = readPosition(&X, &Y);
+    presses  += ((sel != 0U) && (prevSel == 0U)) ? 1 : 0;
+    releases += ((sel == 0U) && (prevSel != 0U)) ? 1 : 0;
+    prevSel = sel;
+    advance(MENU_POLL_US);
+  }
+
+  secs     = (double)(nowUs - t0) / 1e6;
+  trPerSec = (double)(transactions - tr0) / secs;
+  printf("  %-6s %7.1f tr/s  %6.1f ms bus/s  %5.1f irq/s  presses %3d releases %3d (taps %d)  max jump between polls %u px\n",
+         sc->name, trPerSec, (double)(busUs - bus0) / 1000.0 / secs, (double)(irqs - irq0) / secs,
+         presses, releases, taps, maxJump);
+
+  /* Taps all seen, one press per touch, no polling while nothing happens */
+  if( (presses != releases) ||
+      ((sc->kind == SCEN_TAPS) && (presses < (taps - 2))) ||
+      (((sc->kind == SCEN_HOLD) || (sc->kind == SCEN_DRAG)) && (presses != 1)) ||
+      ((sc->kind == SCEN_IDLE) && ((presses != 0) || (trPerSec > 1.0))) )
+  {
+    printf("  <- FAIL\n");
+    fail++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  static const Scenario scenarios[] = {
+    { "idle", 10000, SCEN_IDLE },
+    { "hold",  5000, SCEN_HOLD },
+    { "drag", 10000, SCEN_DRAG },
+    { "taps", 10000, SCEN_TAPS },
+  };
+  unsigned i;
+
+  if( argc > 1 )
+  {
+    samplePeriodUs = (uint32_t)atoi(argv[1]);
+  }
+  if( argc > 2 )
+  {
+    tapUs = (uint32_t)atoi(argv[2]);
+  }
+  if( argc > 3 )
+  {
+    noise = atoi(argv[3]);
+  }
+  srand(1);
+  reg[0] = 0x08;                                    /* CHIP_ID 0811h */
+  reg[1] = 0x11;
+  BSP_TS_Init(240, 320);
+#if !defined(TS_SIM_POLLING)
+  BSP_TS_ITConfig();
+#endif
+  transactions = 0;
+  busUs        = 0;
+  printf("sample period %u us, tap %u us, noise %d, menu poll %u ms\n",
+         (unsigned)samplePeriodUs, (unsigned)tapUs, noise, MENU_POLL_US / 1000U);
+  for( i = 0; i < (sizeof(scenarios) / sizeof(scenarios[0])); i++ )
+  {
+    run(&scenarios[i]);
+  }
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    stm32l4xx_hal_conf.h
+  * @author  MMY Application Team
+  * @brief   HAL configuration of the host simulators building BSP sources
+  *          (Drivers/BSP/ST25-Discovery/st25_discovery.c)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#ifndef __STM32L4xx_HAL_CONF_H
+#define __STM32L4xx_HAL_CONF_H
+
+/* Only the modules with a model in hal_model.c: the BSP parts using other ones are not built.
+   HOSTSIM_HAL_I2C adds the I2C module. */
+#define HAL_MODULE_ENABLED
+#define HAL_CORTEX_MODULE_ENABLED
+#define HAL_DMA_MODULE_ENABLED
+#define HAL_GPIO_MODULE_ENABLED
+#define HAL_RCC_MODULE_ENABLED
+#define HAL_SPI_MODULE_ENABLED
+#define HAL_TIM_MODULE_ENABLED
+#if defined(HOSTSIM_HAL_I2C)
+#define HAL_I2C_MODULE_ENABLED
+#endif
+
+#define HSE_VALUE                     8000000U
+#define HSE_STARTUP_TIMEOUT           100U
+#define MSI_VALUE                     4000000U
+#define HSI_VALUE                     16000000U
+#define HSI48_VALUE                   48000000U
+#define LSI_VALUE                     32000U
+#define LSE_VALUE                     32768U
+#define LSE_STARTUP_TIMEOUT           5000U
+#define EXTERNAL_SAI1_CLOCK_VALUE     2097000U
+#define EXTERNAL_SAI2_CLOCK_VALUE     2097000U
+#define VDD_VALUE                     3300U
+#define TICK_INT_PRIORITY             0x0FU
+#define USE_RTOS                      0U
+#define PREFETCH_ENABLE               0U
+#define INSTRUCTION_CACHE_ENABLE      1U
+#define DATA_CACHE_ENABLE             1U
+#define USE_SPI_CRC                   0U
+
+#include "stm32l4xx_hal_rcc.h"
+#include "stm32l4xx_hal_gpio.h"
+#include "stm32l4xx_hal_dma.h"
+#include "stm32l4xx_hal_cortex.h"
+#include "stm32l4xx_hal_spi.h"
+#include "stm32l4xx_hal_tim.h"
+#if defined(HAL_I2C_MODULE_ENABLED)
+#include "stm32l4xx_hal_i2c.h"
+#endif
+
+#define assert_param(expr) ((void)0U)
+
+/* The peripheral registers are host memory: the register macros of the BSP (clock enables,
+   DMA channel set-up, ...) work on it, the HAL functions are the models of hal_model.c */
+extern uint8_t hostPeriph[];
+#undef  PERIPH_BASE
+#define PERIPH_BASE                   (hostPeriph)
+#define HOST_PERIPH_SIZE              0x10100000U
+
+#endif /* __STM32L4xx_HAL_CONF_H */
@@ -0,0 +1,255 @@
+/**
+  ******************************************************************************
+  * @file    hal_model.c
+  * @author  MMY Application Team
+  * @brief   Host model of the STM32L4 HAL used by the BSP: virtual time, interrupts,
+  *          GPIO, NVIC, tick (built with hal/stm32l4xx_hal_conf.h)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <string.h>
+#include "hal_model.h"
+
+/* Cost of the calls, CPU cycles */
+#define COST_GPIO      12U
+#define COST_NVIC       6U
+#define COST_INIT     100U
+#define COST_TICK      16U   /* HAL_GetTick() and a polling loop turn */
+
+#define MAX_IRQ       128
+#define MAX_REQUESTS    8
+
+/* Peripheral registers (PERIPH_BASE of hal/stm32l4xx_hal_conf.h) */
+uint8_t  hostPeriph[HOST_PERIPH_SIZE] __attribute__((aligned(8)));
+uint32_t SystemCoreClock = HAL_MODEL_HZ;
+
+uint64_t      halModelNow;
+uint64_t      halModelIsrCycles;
+unsigned long halModelErrors;
+
+static uint8_t enabled[MAX_IRQ];
+static int     inIsr;
+
+static struct
+{
+  int       used;
+  IRQn_Type irq;
+  uint64_t  at;
+  void    (*isr)(void);
+} req[MAX_REQUESTS];
+
+/*
+******************************************************************************
+* TIME AND INTERRUPTS
+******************************************************************************
+*/
+/* Earliest request of an enabled interrupt, or -1 */
+static int nextRequest(void)
+{
+  int best = -1;
+  int i;
+
+  for( i = 0; i < MAX_REQUESTS; i++ )
+  {
+    if( req[i].used && enabled[req[i].irq] && ((best < 0) || (req[i].at < req[best].at)) )
+    {
+      best = i;
+    }
+  }
+  return best;
+}
+
+/* Runs the handlers of the requests due now (no nesting) */
+static void serve(void)
+{
+  int i;
+
+  while( !inIsr && ((i = nextRequest()) >= 0) && (req[i].at <= halModelNow) )
+  {
+    uint64_t t0 = halModelNow;
+    void   (*isr)(void) = req[i].isr;
+
+    req[i].used = 0;
+    inIsr       = 1;
+    isr();
+    inIsr       = 0;
+    halModelIsrCycles += halModelNow - t0;
+  }
+}
+
+void halModelAdvance(uint32_t cycles)
+{
+  halModelNow += cycles;
+  serve();
+}
+
+void halModelWork(uint64_t cycles)
+{
+  uint64_t end = halModelNow + cycles;
+  int      i;
+
+  while( ((i = nextRequest()) >= 0) && (req[i].at <= end) )
+  {
+    uint64_t t0;
+
+    if( halModelNow < req[i].at )
+    {
+      halModelNow = req[i].at;
+    }
+    t0 = halModelNow;
+    serve();
+    end += halModelNow - t0;   /* The application is delayed by the handler */
+  }
+  if( halModelNow < end )
+  {
+    halModelNow = end;
+  }
+}
+
+void halModelRaise(IRQn_Type irq, uint64_t at, void (*isr)(void))
+{
+  int i;
+
+  for( i = 0; i < MAX_REQUESTS; i++ )
+  {
+    if( !req[i].used )
+    {
+      req[i].used = 1;
+      req[i].irq  = irq;
+      req[i].at   = at;
+      req[i].isr  = isr;
+      return;
+    }
+  }
+  halModelError("too many interrupt requests");
+}
+
+void halModelCancel(IRQn_Type irq)
+{
+  int i;
+
+  for( i = 0; i < MAX_REQUESTS; i++ )
+  {
+    if( req[i].used && (req[i].irq == irq) )
+    {
+      req[i].used = 0;
+    }
+  }
+}
+
+int halModelInIsr(void)
+{
+  return inIsr;
+}
+
+void halModelError(const char *what)
+{
+  if( halModelErrors++ < 10U )
+  {
+    fprintf(stderr, "model: %s\n", what);
+  }
+}
+
+/*
+******************************************************************************
+* HAL
+******************************************************************************
+*/
+uint32_t HAL_GetTick(void)
+{
+  halModelAdvance(COST_TICK);
+  return (uint32_t)(halModelNow / (HAL_MODEL_HZ / 1000U));
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  halModelWork((uint64_t)Delay * (HAL_MODEL_HZ / 1000U));
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  (void)IRQn; (void)PreemptPriority; (void)SubPriority;
+  halModelAdvance(COST_NVIC);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  enabled[IRQn] = 1;
+  halModelAdvance(COST_NVIC);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  enabled[IRQn] = 0;
+  halModelAdvance(COST_NVIC);
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+  (void)GPIOx; (void)GPIO_Init;
+  halModelAdvance(COST_INIT);
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+  (void)GPIOx; (void)GPIO_Pin;
+  halModelAdvance(COST_INIT);
+}
+
+/* The pin levels are kept in the ODR of the port (host memory) */
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+  if( PinState == GPIO_PIN_RESET )
+  {
+    GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->ODR |= GPIO_Pin;
+  }
+  halModelAdvance(COST_GPIO);
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  GPIOx->ODR ^= GPIO_Pin;
+  halModelAdvance(COST_GPIO);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  halModelAdvance(COST_GPIO);
+  return ((GPIOx->IDR & GPIO_Pin) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/* LCD backlight */
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim)
+{
+  (void)htim;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *sConfig, uint32_t Channel)
+{
+  (void)htim; (void)sConfig; (void)Channel;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+  (void)htim; (void)Channel;
+  return HAL_OK;
+}
@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file    hal_model.h
+  * @author  MMY Application Team
+  * @brief   Host model of the STM32L4 HAL used by the BSP: virtual time, interrupts,
+  *          GPIO, NVIC, tick (built with hal/stm32l4xx_hal_conf.h)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#ifndef HAL_MODEL_H
+#define HAL_MODEL_H
+
+#include "stm32l4xx_hal.h"
+
+/* Core clock: the time is counted in CPU cycles */
+#define HAL_MODEL_HZ       80000000U
+#define HAL_MODEL_MS(c)    ((double)(c) / (HAL_MODEL_HZ / 1000U))
+
+/* Time is only spent in the HAL calls (their cost in cycles, given by the models) and in
+   halModelWork(). A loop polling a flag set by an interrupt goes on through the cost of
+   its HAL_GetTick() calls, as the timeouts of the BSP do. */
+extern uint64_t halModelNow;         /* Cycles since start                 */
+extern uint64_t halModelIsrCycles;   /* Cycles spent in interrupt handlers */
+extern unsigned long halModelErrors; /* Misuse found by the models         */
+
+void halModelAdvance(uint32_t cycles);     /* Cost of a HAL call, serves the due interrupts */
+void halModelWork(uint64_t cycles);        /* Application work, interrupted when due        */
+void halModelRaise(IRQn_Type irq, uint64_t at, void (*isr)(void));  /* Interrupt request at a time */
+void halModelCancel(IRQn_Type irq);        /* Drops the pending requests of an interrupt    */
+int  halModelInIsr(void);
+void halModelError(const char *what);      /* Counts and prints a misuse                    */
+
+#endif /* HAL_MODEL_H */
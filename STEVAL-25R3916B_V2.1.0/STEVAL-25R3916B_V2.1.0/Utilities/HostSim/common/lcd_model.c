@@ -0,0 +1,289 @@
+/**
+  ******************************************************************************
+  * @file    lcd_model.c
+  * @author  MMY Application Team
+  * @brief   Host model of the ILI9341 LCD behind the LCD_IO_xxx functions of the BSP
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <string.h>
+#include "lcd_model.h"
+
+/* ILI9341 commands decoded by the model */
+#define CMD_CASET   0x2AU
+#define CMD_PASET   0x2BU
+#define CMD_RAMWR   0x2CU
+#define CMD_RAMRD   0x2EU
+
+uint16_t      lcdModelFb[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+lcdModelCount lcdModelCnt;
+
+static uint8_t  cmd;
+static int      argn;
+static uint8_t  args[4];
+static int      half = -1;        /* High byte of a pixel sent as two data bytes */
+static uint16_t xs, xe, ys, ye;   /* Window, inclusive ends */
+static uint16_t cx, cy;           /* GRAM pointer           */
+
+/*
+******************************************************************************
+* GRAM
+******************************************************************************
+*/
+static void gramStart(void)
+{
+  cx = xs;
+  cy = ys;
+}
+
+/* The GRAM pointer wraps to the window start column, then to the window top */
+static void gramNext(void)
+{
+  if( ++cx > xe )
+  {
+    cx = xs;
+    if( ++cy > ye )
+    {
+      cy = ys;
+    }
+  }
+}
+
+static void gramWrite(uint16_t color)
+{
+  lcdModelCnt.pixels++;
+  if( (cx < LCD_MODEL_WIDTH) && (cy < LCD_MODEL_HEIGHT) )
+  {
+    lcdModelFb[cy][cx] = color;
+  }
+  gramNext();
+}
+
+/*
+******************************************************************************
+* BUS
+******************************************************************************
+*/
+void lcdModelCommand(uint8_t reg)
+{
+  cmd  = reg;
+  argn = 0;
+  half = -1;
+  if( reg == CMD_CASET )
+  {
+    lcdModelCnt.windows++;
+  }
+  if( reg == CMD_RAMWR )
+  {
+    gramStart();
+  }
+}
+
+void lcdModelData(uint8_t data)
+{
+  if( cmd == CMD_RAMWR )
+  {
+    if( half < 0 )
+    {
+      half = data;
+    }
+    else
+    {
+      gramWrite((uint16_t)((half << 8) | data));
+      half = -1;
+    }
+    return;
+  }
+  if( argn < 4 )
+  {
+    args[argn++] = data;
+  }
+  if( argn == 4 )
+  {
+    if( cmd == CMD_CASET )
+    {
+      xs = (uint16_t)((args[0] << 8) | args[1]);
+      xe = (uint16_t)((args[2] << 8) | args[3]);
+    }
+    if( cmd == CMD_PASET )
+    {
+      ys = (uint16_t)((args[0] << 8) | args[1]);
+      ye = (uint16_t)((args[2] << 8) | args[3]);
+    }
+  }
+}
+
+void lcdModelPixel(uint16_t color)
+{
+  gramWrite(color);
+}
+
+#if !defined(LCD_MODEL_NO_IO)
+/*
+******************************************************************************
+* LCD IO
+******************************************************************************
+*/
+/* RAMRD: a dummy byte, then R, G, B per pixel (6 bits each, MSB aligned) */
+static void gramRead(uint8_t *buf, uint32_t len)
+{
+  uint8_t  rgb[3];
+  uint16_t c;
+  uint32_t i;
+
+  gramStart();
+  if( len > 0U )
+  {
+    buf[0] = 0U;
+  }
+  for( i = 1; i < len; i++ )
+  {
+    if( ((i - 1U) % 3U) == 0U )
+    {
+      c      = ((cx < LCD_MODEL_WIDTH) && (cy < LCD_MODEL_HEIGHT)) ? lcdModelFb[cy][cx] : 0U;
+      rgb[0] = (uint8_t)((c >> 8) & 0xF8U);
+      rgb[1] = (uint8_t)((c >> 3) & 0xFCU);
+      rgb[2] = (uint8_t)((c << 3) & 0xF8U);
+      gramNext();
+    }
+    buf[i] = rgb[(i - 1U) % 3U];
+  }
+}
+
+static void count(unsigned long bytes)
+{
+  lcdModelCnt.transactions++;
+  lcdModelCnt.bytes += bytes;
+}
+
+void LCD_IO_Init(void)             { }
+void LCD_Delay(uint32_t delay)     { (void)delay; }
+void LCD_IO_WaitIdle(void)         { }
+void BSP_LCD_LowFreq(void)         { }
+void BSP_LCD_HighFreq(void)        { }
+
+void LCD_IO_Notify(void (*Callback)(void))
+{
+  Callback();
+}
+
+void LCD_IO_WriteReg(uint8_t Reg)
+{
+  count(1);
+  lcdModelCommand(Reg);
+}
+
+void LCD_IO_WriteData(uint8_t RegValue)
+{
+  count(1);
+  lcdModelData(RegValue);
+}
+
+void LCD_IO_WriteData16(uint16_t RegValue)
+{
+  count(2);
+  gramWrite(RegValue);
+}
+
+void LCD_IO_WriteBuffer16(uint16_t *buffer, uint32_t length)
+{
+  count(2UL * length);
+  while( length-- > 0U )
+  {
+    gramWrite(*buffer++);
+  }
+}
+
+void LCD_IO_WriteConstBuffer16(const uint16_t *buffer, uint32_t length)
+{
+  count(2UL * length);
+  while( length-- > 0U )
+  {
+    gramWrite(*buffer++);
+  }
+}
+
+void LCD_IO_WriteRepeat16(uint16_t Value, uint32_t Count)
+{
+  count(2UL * Count);
+  while( Count-- > 0U )
+  {
+    gramWrite(Value);
+  }
+}
+
+uint32_t LCD_IO_ReadData(uint16_t RegValue, uint8_t ReadSize)
+{
+  uint8_t b[4] = { 0, 0, 0, 0 };
+
+  count(1UL + ReadSize);
+  if( (RegValue == CMD_RAMRD) && (ReadSize <= 4U) )
+  {
+    gramRead(b, ReadSize);
+  }
+  return ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | b[3];
+}
+
+void LCD_IO_ReadBuffer(uint16_t RegValue, uint8_t *buffer, uint32_t length)
+{
+  count(1UL + length);
+  if( RegValue == CMD_RAMRD )
+  {
+    gramRead(buffer, length);
+  }
+}
+#endif /* LCD_MODEL_NO_IO */
+
+/*
+******************************************************************************
+* MODEL
+******************************************************************************
+*/
+void lcdModelReset(void)
+{
+  memset(&lcdModelCnt, 0, sizeof(lcdModelCnt));
+}
+
+void lcdModelClear(uint16_t color)
+{
+  uint32_t x, y;
+
+  for( y = 0; y < LCD_MODEL_HEIGHT; y++ )
+  {
+    for( x = 0; x < LCD_MODEL_WIDTH; x++ )
+    {
+      lcdModelFb[y][x] = color;
+    }
+  }
+}
+
+double lcdModelBusMs(void)
+{
+  return ((lcdModelCnt.bytes * LCD_MODEL_US_BYTE) + (lcdModelCnt.transactions * LCD_MODEL_US_TXN)) / 1000.0;
+}
+
+int lcdModelDump(const char *file)
+{
+  FILE *f = fopen(file, "wb");
+
+  if( f == NULL )
+  {
+    return -1;
+  }
+  fwrite(lcdModelFb, sizeof(uint16_t), LCD_MODEL_WIDTH * LCD_MODEL_HEIGHT, f);
+  fclose(f);
+  return 0;
+}
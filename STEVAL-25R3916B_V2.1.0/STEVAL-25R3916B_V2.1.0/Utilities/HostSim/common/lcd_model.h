@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    lcd_model.h
+  * @author  MMY Application Team
+  * @brief   Host model of the ILI9341 LCD behind the LCD_IO_xxx functions of the BSP
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#ifndef LCD_MODEL_H
+#define LCD_MODEL_H
+
+#include <stdint.h>
+
+#define LCD_MODEL_WIDTH    320U
+#define LCD_MODEL_HEIGHT   240U
+
+/* SPI write model: 40 MHz clock, CS, command and DC switching per transaction */
+#define LCD_MODEL_US_BYTE  0.2
+#define LCD_MODEL_US_TXN   3.0
+
+typedef struct
+{
+  unsigned long windows;       /* Column address set (window or cursor) */
+  unsigned long transactions;  /* LCD_IO_xxx calls, one CS low each    */
+  unsigned long bytes;         /* Bytes on the bus, commands included   */
+  unsigned long pixels;        /* GRAM writes                           */
+} lcdModelCount;
+
+/* GRAM, RGB565, row after row */
+extern uint16_t      lcdModelFb[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+extern lcdModelCount lcdModelCnt;
+
+/* ILI9341 bus, for a model of the SPI link (built with LCD_MODEL_NO_IO: no LCD_IO_xxx functions) */
+void   lcdModelCommand(uint8_t reg);        /* Byte sent with WRX low             */
+void   lcdModelData(uint8_t data);          /* Byte sent with WRX high            */
+void   lcdModelPixel(uint16_t color);       /* 16 bits frame during a GRAM write  */
+
+void   lcdModelReset(void);                 /* Clears the counters               */
+void   lcdModelClear(uint16_t color);       /* Fills the GRAM, counters unchanged */
+double lcdModelBusMs(void);                 /* Bus time of the counted transfers  */
+int    lcdModelDump(const char *file);      /* Writes the GRAM, 0 when done       */
+
+#endif /* LCD_MODEL_H */
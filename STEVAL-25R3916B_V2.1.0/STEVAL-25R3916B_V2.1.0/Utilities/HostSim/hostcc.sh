@@ -0,0 +1,23 @@
+#!/bin/sh
+# Builds host simulators with the firmware sources of this tree:
+#   hostcc.sh [gcc options] sources... -o program
+# Options and include directories given first take precedence over the tree ones.
+# char is unsigned, as with the ARM compilers of the target.
+T=$(cd "$(dirname "$0")/../.." && pwd)
+exec gcc -std=gnu11 -O2 -funsigned-char -Wall -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast \
+  "$@" \
+  -DSTM32L476xx -DUSE_HAL_DRIVER -DST25R3916B -DST25R3916 \
+  -I$T/Projects/ST25-Discovery/Demonstrations/ST25R3916Demo/Inc \
+  -I$T/Middlewares/ST/RFAL/include -I$T/Middlewares/ST/RFAL/source -I$T/Middlewares/ST/RFAL/source/st25r3916 \
+  -I$T/Middlewares/ST/Reader_common/firmware/STM/utils/Inc -I$T/Middlewares/ST/Reader_common/firmware/STM/STM32/Inc \
+  -I$T/Middlewares/ST/Reader_common/firmware/shared/include \
+  -I$T/Middlewares/ST/fw_3916/DISCO-STM32L4x6/Inc \
+  -I$T/Middlewares/ST/NDEF/include -I$T/Middlewares/ST/NDEF/include/poller -I$T/Middlewares/ST/NDEF/include/message \
+  -I$T/Middlewares/ST/p2p -I$T/Middlewares/ST/menu_demo \
+  -I$T/Drivers/BSP/ST25-Discovery -I$T/Drivers/BSP/Components/Common -I$T/Drivers/BSP/Components/ili9341_cube \
+  -I$T/Drivers/BSP/Components/stmpe811 \
+  -I$T/Drivers/STM32L4xx_HAL_Driver/Inc -I$T/Drivers/CMSIS/Device/ST/STM32L4xx/Include -I$T/Drivers/CMSIS/Include \
+  -I$T/Utilities/Fonts \
+  -I$T/Middlewares/ST/STM32_USB_Device_Library/Core/Inc -I$T/Middlewares/ST/STM32_USB_Device_Library/Class/CustomHID/Inc \
+  -I$T/Middlewares/ST/STM32_USB_Device_Library/Class/MSC/Inc \
+  -I$T/Middlewares/Third_Party/LibJPEG/include -I$T/Middlewares/Third_Party/LibJPEG
@@ -0,0 +1,196 @@
+/**
+  ******************************************************************************
+  * @file    log_decoder.c
+  * @author  MMY Application Team
+  * @brief   Decodes a binary log capture with the format strings of the firmware ELF
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "logdec.h"
+
+/* ELF32 little-endian, only the section headers are used */
+#define SHT_NOBITS   8U
+#define SHF_ALLOC    2U
+
+typedef struct
+{
+  uint32_t addr;
+  uint32_t size;
+  uint32_t offset;
+} elfSection;
+
+typedef struct
+{
+  uint8_t    *data;
+  size_t      size;
+  elfSection  sec[64];
+  int         nsec;
+} elfImage;
+
+static uint8_t *readFile(const char *name, size_t *size)
+{
+  FILE    *f = fopen(name, "rb");
+  uint8_t *buf;
+  long     len;
+
+  if( f == NULL )
+  {
+    return NULL;
+  }
+  fseek(f, 0, SEEK_END);
+  len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  buf = malloc((size_t)len + 1U);
+  if( (buf != NULL) && (fread(buf, 1, (size_t)len, f) != (size_t)len) )
+  {
+    free(buf);
+    buf = NULL;
+  }
+  fclose(f);
+  *size = (size_t)len;
+  return buf;
+}
+
+static uint32_t le32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t le16(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static int elfLoad(elfImage *e, const char *name)
+{
+  uint32_t shoff;
+  uint16_t shentsize;
+  uint16_t shnum;
+  uint16_t i;
+
+  e->data = readFile(name, &e->size);
+  e->nsec = 0;
+  if( (e->data == NULL) || (e->size < 52U) || (memcmp(e->data, "\177ELF", 4) != 0) || (e->data[4] != 1U) || (e->data[5] != 1U) )
+  {
+    return 0;   /* Not an ELF32 little-endian file */
+  }
+  shoff     = le32(&e->data[32]);
+  shentsize = le16(&e->data[46]);
+  shnum     = le16(&e->data[48]);
+  for( i = 0; (i < shnum) && (e->nsec < (int)(sizeof(e->sec) / sizeof(e->sec[0]))); i++ )
+  {
+    const uint8_t *sh = &e->data[shoff + ((uint32_t)i * shentsize)];
+
+    if( (shoff + ((uint32_t)(i + 1U) * shentsize)) > e->size )
+    {
+      return 0;
+    }
+    /* Loaded sections with file contents: .rodata, .text, ... */
+    if( ((le32(&sh[8]) & SHF_ALLOC) != 0U) && (le32(&sh[4]) != SHT_NOBITS) && (le32(&sh[20]) != 0U) )
+    {
+      e->sec[e->nsec].addr   = le32(&sh[12]);
+      e->sec[e->nsec].offset = le32(&sh[16]);
+      e->sec[e->nsec].size   = le32(&sh[20]);
+      e->nsec++;
+    }
+  }
+  return 1;
+}
+
+/* Format string at a target address: must be 0 terminated within its section */
+static const char *elfString(uint32_t addr, void *ctx)
+{
+  const elfImage *e = ctx;
+  int i;
+
+  for( i = 0; i < e->nsec; i++ )
+  {
+    const elfSection *s = &e->sec[i];
+    if( (addr >= s->addr) && ((addr - s->addr) < s->size) && ((s->offset + s->size) <= e->size) )
+    {
+      const char *p = (const char *)&e->data[s->offset + (addr - s->addr)];
+      if( memchr(p, '\0', s->size - (addr - s->addr)) != NULL )
+      {
+        return p;
+      }
+    }
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv)
+{
+  elfImage     elf;
+  logdecState  st;
+  logdecRecord rec;
+  uint8_t     *log;
+  size_t       logLen;
+  size_t       pos = 0;
+  double       mhz = 0.0;
+
+  if( (argc < 3) || (argc > 4) )
+  {
+    fprintf(stderr, "usage: log_decoder firmware.elf capture.bin [cpu MHz]\n");
+    return 2;
+  }
+  if( elfLoad(&elf, argv[1]) == 0 )
+  {
+    fprintf(stderr, "%s: not a 32-bit little-endian ELF file\n", argv[1]);
+    return 1;
+  }
+  log = readFile(argv[2], &logLen);
+  if( log == NULL )
+  {
+    fprintf(stderr, "%s: cannot read\n", argv[2]);
+    return 1;
+  }
+  if( argc == 4 )
+  {
+    mhz = atof(argv[3]);
+  }
+
+  logdecInit(&st, elfString, &elf);
+  while( pos < logLen )
+  {
+    size_t used = logdecNext(&st, &log[pos], logLen - pos, &rec);
+    if( used == 0U )
+    {
+      break;   /* Truncated last record */
+    }
+    pos += used;
+    if( rec.text[0] == '\0' )
+    {
+      continue;
+    }
+    if( rec.gap != 0U )
+    {
+      printf("--- %u record(s) dropped ---\n", (unsigned)rec.gap);
+    }
+    if( mhz > 0.0 )
+    {
+      printf("%12.3f us  %s", (double)rec.cycles / mhz, rec.text);
+    }
+    else
+    {
+      printf("%12llu cy  %s", (unsigned long long)rec.cycles, rec.text);
+    }
+  }
+  fprintf(stderr, "%u dropped record(s), %u byte(s) skipped, %u trailing byte(s)\n",
+          (unsigned)st.dropped, (unsigned)st.skipped, (unsigned)(logLen - pos));
+  return 0;
+}
@@ -0,0 +1,225 @@
+/**
+  ******************************************************************************
+  * @file    log_selftest.c
+  * @author  MMY Application Team
+  * @brief   Round trip of the logger binary mode (logger.c) through the host decoder
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "logger.h"
+#include "logdec.h"
+
+DWT_Type       hostDwt;
+CoreDebug_Type hostCoreDebug;
+
+/* UART: the flushed bytes are appended to the capture */
+static uint8_t            capture[1U << 20];
+static size_t             captureLen;
+static UART_HandleTypeDef huart = { NULL, HAL_UART_STATE_READY };
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *h, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  (void)h;
+  (void)Timeout;
+  if( (captureLen + Size) <= sizeof(capture) )
+  {
+    memcpy(&capture[captureLen], pData, Size);
+    captureLen += Size;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *h, uint8_t *pData, uint16_t Size)
+{
+  return HAL_UART_Transmit(h, pData, Size, 0);
+}
+
+/* The target records the low 32 bits of the format address: map them back */
+static const char *formats[64];
+static int         nFormats;
+
+static const char *hostResolve(uint32_t addr, void *ctx)
+{
+  int i;
+  (void)ctx;
+  for( i = 0; i < nFormats; i++ )
+  {
+    if( (uint32_t)(uintptr_t)formats[i] == addr )
+    {
+      return formats[i];
+    }
+  }
+  return NULL;
+}
+
+static void known(const char *fmt)
+{
+  int i;
+  for( i = 0; i < nFormats; i++ )
+  {
+    if( formats[i] == fmt )
+    {
+      return;
+    }
+  }
+  formats[nFormats++] = fmt;
+}
+
+static char expected[64][512];
+static int  nExpected;
+
+/* Logs through logger.c and keeps the text printf gives */
+#define CHECK(fmt, ...)                                                                   \
+  do {                                                                                    \
+    static const char f_[] = fmt;                                                         \
+    known(f_);                                                                            \
+    snprintf(expected[nExpected++], sizeof(expected[0]), f_, __VA_ARGS__);                \
+    hostDwt.CYCCNT += 1000U;                                                              \
+    logUsart(f_, __VA_ARGS__);                                                            \
+  } while(0)
+
+static double nowNs(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return ((double)t.tv_sec * 1e9) + (double)t.tv_nsec;
+}
+
+static int decodeAll(logdecState *st, int check)
+{
+  logdecRecord rec;
+  size_t       pos = 0;
+  int          n = 0;
+  int          fail = 0;
+
+  while( pos < captureLen )
+  {
+    size_t used = logdecNext(st, &capture[pos], captureLen - pos, &rec);
+    if( used == 0U )
+    {
+      break;
+    }
+    pos += used;
+    if( rec.text[0] == '\0' )
+    {
+      continue;
+    }
+    if( (check != 0) && ((n >= nExpected) || (strcmp(rec.text, expected[n]) != 0)) )
+    {
+      printf("FAIL record %d:\n  got      \"%s\"\n  expected \"%s\"\n", n, rec.text, (n < nExpected) ? expected[n] : "");
+      fail++;
+    }
+    n++;
+  }
+  if( (check != 0) && (n != nExpected) )
+  {
+    printf("FAIL %d records decoded, %d logged\n", n, nExpected);
+    fail++;
+  }
+  return fail;
+}
+
+int main(void)
+{
+  static const uint8_t uid[8] = { 0xE0, 0x02, 0x08, 0x11, 0x22, 0x33, 0x44, 0x55 };
+  static const char    longStr[] = "0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  char                 ramStr[16];
+  logdecState          st;
+  int                  fail;
+  int                  i;
+  const int            N = 1000000;
+  double               t0, t1, t2;
+  char                 buf[256];
+
+  logUsartInit(&huart);
+
+  /* Strings are copied at log time: changing the buffer afterwards must not show */
+  strcpy(ramStr, "before");
+  CHECK("NFC-V UID %s found\r\n", "E002081122334455");
+  CHECK("state %d err %x len %u\r\n", 12, 0x1Au, 300u);
+  CHECK("%s|%-10s|%10s|%.3s\r\n", ramStr, "ab", "cd", "truncated");
+  strcpy(ramStr, "after");
+  CHECK("%*d|%-*d|%.*s|%c%%\r\n", 6, 42, 4, -7, 2, "xyz", 'Q');
+  CHECK("%08lX %hu %p\r\n", 0xDEADBEEFUL, 65535, (void *)(uintptr_t)0x20001000U);
+  CHECK("%.68s\r\n", longStr);
+  CHECK("%d %d %d %d %d %d %d %d\r\n", 1, 2, 3, 4, 5, 6, 7, 8);
+  CHECK("no argument%s", "\r\n");
+  logUsartFlush();
+
+  /* hex2Str(): raw bytes on the target, hex formatted by the decoder */
+  {
+    static const char f_[] = "UID %s %s\r\n";
+    known(f_);
+    snprintf(expected[nExpected++], sizeof(expected[0]), f_, "E002081122334455", "");
+    logUsart(f_, hex2Str((unsigned char *)uid, sizeof(uid)), hex2Str((unsigned char *)uid, 0));
+    logUsartFlush();
+  }
+  logdecInit(&st, hostResolve, NULL);
+  fail = decodeAll(&st, 1);
+  printf("round trip: %d records, %d failure(s)\n", nExpected, fail);
+
+  /* Ring full: records are dropped and the sequence gap is reported */
+  captureLen = 0;
+  for( i = 0; i < 200; i++ )
+  {
+    CHECK("fill %d %s\r\n", i, "0123456789");
+    nExpected = 0;
+  }
+  logUsartFlush();
+  logUsartFlush();
+  {
+    static const char f_[] = "after the gap\r\n%s";
+    known(f_);
+    logUsart(f_, "");
+    logUsartFlush();
+  }
+  logdecInit(&st, hostResolve, NULL);
+  decodeAll(&st, 0);
+  printf("ring full: %u record(s) dropped reported\n", (unsigned)st.dropped);
+  if( st.dropped == 0U )
+  {
+    fail++;
+  }
+
+  /* Cost of a call on the host: vsnprintf path versus binary record */
+  {
+    static const char f_[] = "RFAL: state %d err %x len %d\r\n";
+    t0 = nowNs();
+    for( i = 0; i < N; i++ )
+    {
+      snprintf(buf, sizeof(buf), f_, i, i * 3, i & 255);
+    }
+    t1 = nowNs();
+    for( i = 0; i < N; i++ )
+    {
+      logUsart(f_, i, i * 3, i & 255);
+      if( (i & 15) == 0 )
+      {
+        captureLen = 0;
+        logUsartFlush();
+        logUsartFlush();
+      }
+    }
+    t2 = nowNs();
+    printf("3 arguments call: text %.1f ns, binary %.1f ns (host, flush included)\n", (t1 - t0) / N, (t2 - t1) / N);
+  }
+
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,266 @@
+/**
+  ******************************************************************************
+  * @file    logdec.c
+  * @author  MMY Application Team
+  * @brief   Host decoder of the logger binary records (USE_LOGGER == LOGGER_BINARY)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <string.h>
+#include "logdec.h"
+
+static uint32_t rd32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void logdecInit(logdecState *st, logdecResolve resolve, void *ctx)
+{
+  memset(st, 0, sizeof(*st));
+  st->resolve = resolve;
+  st->ctx     = ctx;
+}
+
+/* Output helper, keeps the text 0 terminated and truncates silently */
+typedef struct
+{
+  char   *buf;
+  size_t  size;
+  size_t  len;
+} outBuf;
+
+static void put(outBuf *o, const char *s, size_t n)
+{
+  while( (n-- != 0U) && ((o->len + 1U) < o->size) )
+  {
+    o->buf[o->len++] = *s++;
+  }
+  o->buf[o->len] = '\0';
+}
+
+/* Argument reader over the record payload */
+typedef struct
+{
+  const uint8_t *p;
+  uint32_t       words;
+  uint32_t       pos;
+  int            error;
+} argReader;
+
+static uint32_t nextWord(argReader *a)
+{
+  if( a->pos >= a->words )
+  {
+    a->error = 1;
+    return 0;
+  }
+  return rd32(&a->p[4U * a->pos++]);
+}
+
+/* Formats fmt with the recorded arguments, returns 0 if the payload does not match */
+static int format(const char *fmt, argReader *a, outBuf *o)
+{
+  char spec[32];
+  char tmp[256];
+
+  while( *fmt != '\0' )
+  {
+    const char *start;
+    size_t      n;
+    int         star[2];
+    int         nstar = 0;
+    int         i;
+
+    if( *fmt != '%' )
+    {
+      start = fmt;
+      while( (*fmt != '\0') && (*fmt != '%') )
+      {
+        fmt++;
+      }
+      put(o, start, (size_t)(fmt - start));
+      continue;
+    }
+    if( fmt[1] == '%' )
+    {
+      put(o, "%", 1);
+      fmt += 2;
+      continue;
+    }
+
+    /* Copy flags, width and precision, drop the length modifiers (32-bit target) */
+    start = fmt++;
+    n = 0;
+    spec[n++] = '%';
+    while( (*fmt != '\0') && (strchr("-+ #0123456789.*", *fmt) != NULL) && (n < (sizeof(spec) - 3U)) )
+    {
+      if( *fmt == '*' )
+      {
+        star[nstar & 1] = (int32_t)nextWord(a);
+        nstar++;
+      }
+      spec[n++] = *fmt++;
+    }
+    while( (*fmt != '\0') && (strchr("hlzjt", *fmt) != NULL) )
+    {
+      if( (fmt[0] == 'l') && (fmt[1] == 'l') )
+      {
+        return 0;   /* 64-bit arguments are not recorded */
+      }
+      fmt++;
+    }
+    if( *fmt == '\0' )
+    {
+      put(o, start, strlen(start));
+      break;
+    }
+    spec[n++] = *fmt;
+    spec[n]   = '\0';
+
+    switch( *fmt )
+    {
+      case 'd':
+      case 'i':
+      case 'c':
+      {
+        int32_t v = (int32_t)nextWord(a);
+        if( nstar == 2 )      { snprintf(tmp, sizeof(tmp), spec, star[0], star[1], v); }
+        else if( nstar == 1 ) { snprintf(tmp, sizeof(tmp), spec, star[0], v); }
+        else                  { snprintf(tmp, sizeof(tmp), spec, v); }
+        break;
+      }
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+      {
+        uint32_t v = nextWord(a);
+        if( nstar == 2 )      { snprintf(tmp, sizeof(tmp), spec, star[0], star[1], v); }
+        else if( nstar == 1 ) { snprintf(tmp, sizeof(tmp), spec, star[0], v); }
+        else                  { snprintf(tmp, sizeof(tmp), spec, v); }
+        break;
+      }
+      case 'p':
+        snprintf(tmp, sizeof(tmp), "0x%08x", (unsigned)nextWord(a));
+        break;
+      case 's':
+      {
+        char     str[2U * LOGDEC_MAX_STR + 1U];
+        uint32_t len = nextWord(a);
+        uint32_t w   = (len + 3U) / 4U;
+        const uint8_t *s = &a->p[4U * a->pos];
+
+        if( (len > LOGDEC_MAX_STR) || ((a->pos + w) > a->words) )
+        {
+          return 0;
+        }
+        a->pos += w;
+        if( (len >= 2U) && (s[0] == LOGDEC_HEX_TAG) && ((2U + s[1]) == len) )
+        {
+          /* hex2Str() data, formatted as the target does in text mode */
+          static const char hex[] = "0123456789ABCDEF";
+          for( i = 0; i < (int)s[1]; i++ )
+          {
+            str[2 * i]     = hex[s[2 + i] >> 4];
+            str[2 * i + 1] = hex[s[2 + i] & 0x0FU];
+          }
+          str[2U * s[1]] = '\0';
+        }
+        else
+        {
+          memcpy(str, s, len);
+          str[len] = '\0';
+        }
+        if( nstar == 2 )      { snprintf(tmp, sizeof(tmp), spec, star[0], star[1], str); }
+        else if( nstar == 1 ) { snprintf(tmp, sizeof(tmp), spec, star[0], str); }
+        else                  { snprintf(tmp, sizeof(tmp), spec, str); }
+        break;
+      }
+      default:
+        /* Floating point and unknown conversions are not recorded */
+        return 0;
+    }
+    if( a->error != 0 )
+    {
+      return 0;
+    }
+    put(o, tmp, strlen(tmp));
+    fmt++;
+  }
+
+  /* All the recorded words must be used */
+  return (a->pos == a->words) ? 1 : 0;
+}
+
+size_t logdecNext(logdecState *st, const uint8_t *buf, size_t len, logdecRecord *rec)
+{
+  uint32_t    hdr;
+  uint32_t    words;
+  const char *fmt;
+  argReader   a;
+  outBuf      o;
+
+  rec->text[0] = '\0';
+  if( len < (4U * LOGDEC_HDR_WORDS) )
+  {
+    return 0;
+  }
+
+  hdr   = rd32(buf);
+  words = hdr & 0xFFU;
+  fmt   = st->resolve(rd32(&buf[4]), st->ctx);
+  if( ((hdr >> 24) != LOGDEC_SYNC) || (words > LOGDEC_MAX_WORDS) || (fmt == NULL) )
+  {
+    st->skipped++;
+    return 1;
+  }
+  if( len < (4U * (LOGDEC_HDR_WORDS + words)) )
+  {
+    return 0;
+  }
+
+  a.p     = &buf[4U * LOGDEC_HDR_WORDS];
+  a.words = words;
+  a.pos   = 0;
+  a.error = 0;
+  o.buf   = rec->text;
+  o.size  = sizeof(rec->text);
+  o.len   = 0;
+  if( format(fmt, &a, &o) == 0 )
+  {
+    /* Arguments don't match the format: not a record */
+    rec->text[0] = '\0';
+    st->skipped++;
+    return 1;
+  }
+
+  rec->seq       = (uint16_t)(hdr >> 8);
+  rec->timestamp = rd32(&buf[8]);
+  rec->gap       = 0;
+  if( st->started != 0 )
+  {
+    rec->gap    = (uint16_t)(rec->seq - st->seq);
+    st->dropped += rec->gap;
+    /* The cycle counter wraps (~53 s at 80 MHz): records must come more often */
+    st->cycles  += (uint32_t)(rec->timestamp - st->lastTs);
+  }
+  st->started = 1;
+  st->seq     = (uint16_t)(rec->seq + 1U);
+  st->lastTs  = rec->timestamp;
+  rec->cycles = st->cycles;
+
+  return 4U * (LOGDEC_HDR_WORDS + words);
+}
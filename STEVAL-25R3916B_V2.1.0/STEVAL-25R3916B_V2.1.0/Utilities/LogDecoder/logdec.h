@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    logdec.h
+  * @author  MMY Application Team
+  * @brief   Host decoder of the logger binary records (USE_LOGGER == LOGGER_BINARY)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#ifndef LOGDEC_H
+#define LOGDEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Record layout, see logBinary() in logger.h */
+#define LOGDEC_SYNC         0xB1U
+#define LOGDEC_HDR_WORDS    3U
+#define LOGDEC_HEX_TAG      0x01U
+#define LOGDEC_MAX_STR      68U
+#define LOGDEC_MAX_WORDS    (8U * (1U + (LOGDEC_MAX_STR / 4U)))
+
+/* Returns the format string at target address addr, NULL if unknown */
+typedef const char *(*logdecResolve)(uint32_t addr, void *ctx);
+
+typedef struct
+{
+  logdecResolve resolve;
+  void         *ctx;
+  int           started;   /* A record was decoded already       */
+  uint16_t      seq;       /* Expected sequence number           */
+  uint32_t      lastTs;    /* Last cycle counter value           */
+  uint64_t      cycles;    /* Cycles since the first record      */
+  uint32_t      dropped;   /* Records lost (sequence gaps)       */
+  uint32_t      skipped;   /* Bytes skipped to find a record     */
+} logdecState;
+
+typedef struct
+{
+  uint16_t  seq;
+  uint32_t  timestamp;     /* Raw DWT cycle counter              */
+  uint64_t  cycles;        /* Wrap-free cycles since first record*/
+  uint32_t  gap;           /* Records dropped just before        */
+  char      text[512];
+} logdecRecord;
+
+void logdecInit(logdecState *st, logdecResolve resolve, void *ctx);
+
+/* Decodes the record at the start of buf.
+   Returns the number of bytes used, 0 if more bytes are needed. When buf does not
+   start with a valid record one byte is skipped and rec->text is left empty. */
+size_t logdecNext(logdecState *st, const uint8_t *buf, size_t len, logdecRecord *rec);
+
+#endif /* LOGDEC_H */
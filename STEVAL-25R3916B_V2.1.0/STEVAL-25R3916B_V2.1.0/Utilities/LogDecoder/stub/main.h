@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file    main.h
+  * @author  MMY Application Team
+  * @brief   Host stand-in of the demo main.h, enough to build logger.c
+  ******************************************************************************
+  */
+#ifndef MAIN_H
+#define MAIN_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum
+{
+  HAL_OK    = 0x00U,
+  HAL_ERROR = 0x01U
+} HAL_StatusTypeDef;
+
+#define HAL_UART_STATE_READY  0x20U
+
+typedef struct
+{
+  void              *hdmatx;
+  volatile uint32_t  gState;
+} UART_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+
+/* Cortex-M cycle counter and interrupt mask */
+typedef struct
+{
+  volatile uint32_t CTRL;
+  volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+  volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type       hostDwt;
+extern CoreDebug_Type hostCoreDebug;
+#define DWT                          (&hostDwt)
+#define CoreDebug                    (&hostCoreDebug)
+#define DWT_CTRL_CYCCNTENA_Msk       1UL
+#define CoreDebug_DEMCR_TRCENA_Msk   (1UL << 24)
+
+static inline uint32_t __get_PRIMASK(void)        { return 0; }
+static inline void     __set_PRIMASK(uint32_t m)  { (void)m; }
+static inline void     __disable_irq(void)        { }
+
+#endif /* MAIN_H */
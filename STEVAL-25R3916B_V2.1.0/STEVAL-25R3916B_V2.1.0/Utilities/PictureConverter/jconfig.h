@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    jconfig.h
+  * @author  MMY Application Team
+  * @brief   libJPEG configuration for the host picture converter.
+  *          Replaces the firmware jconfig.h: files are plain stdio files and
+  *          memory comes from malloc().
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define JFILE     FILE
+
+#define JMALLOC   malloc
+#define JFREE     free
+
+#define JFREAD(file,buf,sizeofbuf)  \
+   fread (buf,1,sizeofbuf,file)
+
+#define JFWRITE(file,buf,sizeofbuf)  \
+   fwrite (buf,1,sizeofbuf,file)
+
+#define NO_GETENV
+#define USE_HEAP_MEM
+
+#define HAVE_PROTOTYPES
+#define HAVE_UNSIGNED_CHAR
+#define HAVE_UNSIGNED_SHORT
+#undef CHAR_IS_UNSIGNED
+#define HAVE_STDDEF_H
+#define HAVE_STDLIB_H
+#undef NEED_BSD_STRINGS
+#undef NEED_SYS_TYPES_H
+#undef NEED_FAR_POINTERS
+#undef NEED_SHORT_EXTERNAL_NAMES
+#undef INCOMPLETE_TYPES_BROKEN
+
+#ifdef _WIN32
+#ifndef __RPCNDR_H__		/* don't conflict if rpcndr.h already read */
+typedef unsigned char boolean;
+#endif
+#define HAVE_BOOLEAN		/* prevent jmorecfg.h from redefining it */
+#endif
+
+#ifdef JPEG_INTERNALS
+#undef RIGHT_SHIFT_IS_UNSIGNED
+#endif /* JPEG_INTERNALS */
@@ -0,0 +1,411 @@
+/**
+  ******************************************************************************
+  * @file    pict2rgb565.c
+  * @author  MMY Application Team
+  * @brief   Host tool converting a JPEG picture to an RGB565 picture array
+  *          displayed by BSP_LCD_DisplayPicture without decoding.
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <setjmp.h>
+#include "jpeglib.h"
+
+/* Picture format, must match the LCD_PICT_xxx definitions of st25_discovery_lcd.h */
+#define PICT_HEADER_SIZE      16U
+#define PICT_FORMAT_RAW       0U
+#define PICT_FORMAT_RLE       1U
+#define PICT_RLE_RUN          0x8000U
+#define PICT_RLE_MAX_COUNT    0x8000U
+
+/* Full scale decoding settings of jpeg_decode(), see jpeg_decode.h */
+#define JPEG_DECODE_DCT_METHOD    JDCT_IFAST
+
+/* Runs shorter than this are kept in the literal packets (each packet is an LCD transfer) */
+#define DEFAULT_MIN_RUN       32U
+
+typedef enum { FORMAT_AUTO, FORMAT_RAW, FORMAT_RLE } format_t;
+
+typedef struct {
+  uint16_t *words;
+  uint32_t count;
+  uint32_t size;
+} stream_t;
+
+static jmp_buf decode_abort;
+
+static void usage(void)
+{
+  fprintf(stderr,
+          "usage: pict2rgb565 [-raw | -rle] [-run N] [-name symbol] <input.jpg | input_jpg.h> <output.h>\n"
+          "  -raw         store the pixels as they are\n"
+          "  -rle         store the pixels run-length encoded\n"
+          "               (default: the smaller of the two)\n"
+          "  -run N       shortest run encoded as a run, default %u\n"
+          "  -name symbol name of the array, default the input array name or file name\n",
+          DEFAULT_MIN_RUN);
+  exit(1);
+}
+
+static void fail(const char *msg, const char *arg)
+{
+  fprintf(stderr, "pict2rgb565: %s %s\n", msg, arg);
+  exit(1);
+}
+
+static void put_word(stream_t *s, uint16_t w)
+{
+  if(s->count == s->size)
+  {
+    s->size = s->size ? (2 * s->size) : 4096;
+    s->words = realloc(s->words, s->size * sizeof(uint16_t));
+    if(s->words == NULL)
+    {
+      fail("out of memory", "");
+    }
+  }
+  s->words[s->count++] = w;
+}
+
+/* Reads a whole file */
+static uint8_t *load_file(const char *name, size_t *size)
+{
+  FILE *f = fopen(name, "rb");
+  uint8_t *data;
+  long len;
+
+  if(f == NULL)
+  {
+    fail("cannot open", name);
+  }
+  fseek(f, 0, SEEK_END);
+  len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data = malloc(len + 1);
+  if((data == NULL) || (fread(data, 1, len, f) != (size_t)len))
+  {
+    fail("cannot read", name);
+  }
+  data[len] = 0;
+  fclose(f);
+  *size = len;
+  return data;
+}
+
+/* Extracts the bytes of a "const char name[] = { 0x.., ... };" array, and its name */
+static uint8_t *parse_array(const char *text, size_t *size, char *symbol, size_t symbol_size)
+{
+  const char *p = strchr(text, '[');
+  const char *start;
+  uint8_t *data;
+  size_t n = 0;
+
+  if(p == NULL)
+  {
+    return NULL;
+  }
+  start = p;
+  while((start > text) && (isalnum((unsigned char)start[-1]) || (start[-1] == '_')))
+  {
+    start--;
+  }
+  if((size_t)(p - start) >= symbol_size)
+  {
+    return NULL;
+  }
+  memcpy(symbol, start, p - start);
+  symbol[p - start] = 0;
+
+  p = strchr(p, '{');
+  if(p == NULL)
+  {
+    return NULL;
+  }
+  data = malloc(strlen(p) / 4 + 1);
+  while(*p && (*p != '}'))
+  {
+    if(isxdigit((unsigned char)*p) || (*p == '-'))
+    {
+      char *end;
+      long v = strtol(p, &end, 0);
+      data[n++] = (uint8_t)v;
+      p = end;
+    }
+    else
+    {
+      p++;
+    }
+  }
+  *size = n;
+  return data;
+}
+
+static void jpeg_error_exit(j_common_ptr cinfo)
+{
+  (*cinfo->err->output_message)(cinfo);
+  longjmp(decode_abort, 1);
+}
+
+/* Decodes with the settings of jpeg_decode() at full scale, so the pixels are the ones the demo displayed */
+static uint16_t *decode(const uint8_t *jpeg, size_t size, uint32_t *width, uint32_t *height)
+{
+  struct jpeg_decompress_struct cinfo;
+  struct jpeg_error_mgr jerr;
+  uint16_t *pixels, *out;
+  JSAMPROW row;
+  uint32_t i;
+
+  cinfo.err = jpeg_std_error(&jerr);
+  jerr.error_exit = jpeg_error_exit;
+  if(setjmp(decode_abort))
+  {
+    fail("cannot decode the picture", "");
+  }
+  jpeg_create_decompress(&cinfo);
+  jpeg_mem_src(&cinfo, (unsigned char *)jpeg, size);
+  jpeg_read_header(&cinfo, TRUE);
+  cinfo.scale_num = 8;
+  cinfo.scale_denom = 8;
+  cinfo.dct_method = JPEG_DECODE_DCT_METHOD;
+  cinfo.do_fancy_upsampling = FALSE;
+  cinfo.out_color_space = JCS_RGB;
+  jpeg_start_decompress(&cinfo);
+
+  *width = cinfo.output_width;
+  *height = cinfo.output_height;
+  pixels = malloc(*width * *height * sizeof(uint16_t));
+  row = malloc(*width * 3);
+  out = pixels;
+  while(cinfo.output_scanline < cinfo.output_height)
+  {
+    jpeg_read_scanlines(&cinfo, &row, 1);
+    for(i = 0; i < *width; i++)
+    {
+      *out++ = (uint16_t)(((row[3 * i] & 0xF8) << 8) | ((row[3 * i + 1] & 0xFC) << 3) | (row[3 * i + 2] >> 3));
+    }
+  }
+  jpeg_finish_decompress(&cinfo);
+  jpeg_destroy_decompress(&cinfo);
+  free(row);
+  return pixels;
+}
+
+static void put_literal(stream_t *s, const uint16_t *pixels, uint32_t count)
+{
+  uint32_t n;
+
+  while(count > 0)
+  {
+    n = (count > PICT_RLE_MAX_COUNT) ? PICT_RLE_MAX_COUNT : count;
+    put_word(s, (uint16_t)(n - 1));
+    while(n--)
+    {
+      put_word(s, *pixels++);
+      count--;
+    }
+  }
+}
+
+/* Packets: a count word, then the pixels (literal) or one colour (run, count bit 15 set) */
+static void encode_rle(stream_t *s, const uint16_t *pixels, uint32_t count, uint32_t min_run)
+{
+  uint32_t literal = 0;
+  uint32_t i = 0;
+  uint32_t run;
+
+  while(i < count)
+  {
+    run = 1;
+    while(((i + run) < count) && (pixels[i + run] == pixels[i]) && (run < PICT_RLE_MAX_COUNT))
+    {
+      run++;
+    }
+    if(run >= min_run)
+    {
+      put_literal(s, &pixels[literal], i - literal);
+      put_word(s, (uint16_t)(PICT_RLE_RUN | (run - 1)));
+      put_word(s, pixels[i]);
+      literal = i + run;
+    }
+    i += run;
+  }
+  put_literal(s, &pixels[literal], count - literal);
+}
+
+static void write_array(const char *name, const char *symbol, const char *source, uint32_t width, uint32_t height,
+                        uint32_t format, const stream_t *s)
+{
+  FILE *f = fopen(name, "w");
+  uint8_t header[PICT_HEADER_SIZE] = {'R', '5', '6', '5'};
+  uint32_t size = PICT_HEADER_SIZE + 2 * s->count;
+  uint32_t i;
+  uint8_t b;
+
+  if(f == NULL)
+  {
+    fail("cannot create", name);
+  }
+  header[4] = (uint8_t)format;
+  header[6] = (uint8_t)width;
+  header[7] = (uint8_t)(width >> 8);
+  header[8] = (uint8_t)height;
+  header[9] = (uint8_t)(height >> 8);
+  header[12] = (uint8_t)s->count;
+  header[13] = (uint8_t)(s->count >> 8);
+  header[14] = (uint8_t)(s->count >> 16);
+  header[15] = (uint8_t)(s->count >> 24);
+
+  fprintf(f, "/* %ux%u RGB565 %s picture converted from %s by pict2rgb565, %u bytes */\n",
+          width, height, (format == PICT_FORMAT_RLE) ? "RLE" : "raw", source, size);
+  fprintf(f, "/* Pixels are read as 16 bits words: the array must be aligned */\n");
+  fprintf(f, "__ALIGNED(4) const char %s[] = {\n", symbol);
+  for(i = 0; i < size; i++)
+  {
+    /* Words are stored low byte first */
+    b = (i < PICT_HEADER_SIZE) ? header[i] : (uint8_t)(s->words[(i - PICT_HEADER_SIZE) / 2] >> (8 * ((i - PICT_HEADER_SIZE) & 1)));
+    fprintf(f, "0x%02X, %s", b, ((i % 32) == 31) ? "\n" : "");
+  }
+  fprintf(f, "%s};\n", ((size % 32) != 0) ? "\n" : "");
+  fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+  format_t format = FORMAT_AUTO;
+  uint32_t min_run = DEFAULT_MIN_RUN;
+  const char *symbol_arg = NULL;
+  char symbol[128];
+  const char *input = NULL, *output = NULL, *base;
+  uint8_t *file, *jpeg;
+  size_t file_size, jpeg_size;
+  uint16_t *pixels;
+  uint32_t width, height, i;
+  stream_t raw = {0}, rle = {0};
+  stream_t *selected;
+  int arg;
+
+  for(arg = 1; arg < argc; arg++)
+  {
+    if(strcmp(argv[arg], "-raw") == 0)
+    {
+      format = FORMAT_RAW;
+    }
+    else if(strcmp(argv[arg], "-rle") == 0)
+    {
+      format = FORMAT_RLE;
+    }
+    else if((strcmp(argv[arg], "-run") == 0) && ((arg + 1) < argc))
+    {
+      min_run = (uint32_t)atoi(argv[++arg]);
+      if(min_run < 2)
+      {
+        usage();
+      }
+    }
+    else if((strcmp(argv[arg], "-name") == 0) && ((arg + 1) < argc))
+    {
+      symbol_arg = argv[++arg];
+    }
+    else if(input == NULL)
+    {
+      input = argv[arg];
+    }
+    else if(output == NULL)
+    {
+      output = argv[arg];
+    }
+    else
+    {
+      usage();
+    }
+  }
+  if(output == NULL)
+  {
+    usage();
+  }
+
+  file = load_file(input, &file_size);
+  if((file_size > 2) && (file[0] == 0xFF) && (file[1] == 0xD8))
+  {
+    /* JPEG file, the array is named after the file */
+    jpeg = file;
+    jpeg_size = file_size;
+    base = strrchr(input, '/');
+    base = (base != NULL) ? (base + 1) : input;
+    snprintf(symbol, sizeof(symbol), "%s", base);
+    for(i = 0; symbol[i] != 0; i++)
+    {
+      if(symbol[i] == '.')
+      {
+        symbol[i] = 0;
+        break;
+      }
+      if(!isalnum((unsigned char)symbol[i]))
+      {
+        symbol[i] = '_';
+      }
+    }
+  }
+  else
+  {
+    /* C array of a JPEG picture, as in the Picture folder of the demonstration */
+    jpeg = parse_array((const char *)file, &jpeg_size, symbol, sizeof(symbol));
+    if((jpeg == NULL) || (jpeg_size < 2) || (jpeg[0] != 0xFF) || (jpeg[1] != 0xD8))
+    {
+      fail("no JPEG picture found in", input);
+    }
+  }
+  if(symbol_arg != NULL)
+  {
+    snprintf(symbol, sizeof(symbol), "%s", symbol_arg);
+  }
+
+  pixels = decode(jpeg, jpeg_size, &width, &height);
+  if((width > 0xFFFF) || (height > 0xFFFF))
+  {
+    fail("picture too big", input);
+  }
+
+  for(i = 0; i < (width * height); i++)
+  {
+    put_word(&raw, pixels[i]);
+  }
+  encode_rle(&rle, pixels, width * height, min_run);
+
+  if(format == FORMAT_RAW)
+  {
+    selected = &raw;
+  }
+  else if(format == FORMAT_RLE)
+  {
+    selected = &rle;
+  }
+  else
+  {
+    selected = (rle.count < raw.count) ? &rle : &raw;
+  }
+  base = strrchr(input, '/');
+  write_array(output, symbol, (base != NULL) ? (base + 1) : input, width, height,
+              (selected == &rle) ? PICT_FORMAT_RLE : PICT_FORMAT_RAW, selected);
+
+  printf("%s: %ux%u, jpeg %u bytes, raw %u bytes, rle %u bytes -> %s %s\n", symbol, width, height,
+         (unsigned)jpeg_size, PICT_HEADER_SIZE + 2 * raw.count, PICT_HEADER_SIZE + 2 * rle.count,
+         (selected == &rle) ? "rle" : "raw", output);
+  return 0;
+}
@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * @file    rfal_platform.h
+  * @author  MMY Application Team
+  * @brief   Host stand-in of the demo rfal_platform.h, enough to build timer.c
+  ******************************************************************************
+  */
+#ifndef RFAL_PLATFORM_H
+#define RFAL_PLATFORM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Simulated time: the test keeps DWT->CYCCNT equal to its low 32 bits */
+extern uint64_t hostCycles;
+extern uint32_t SystemCoreClock;
+
+typedef struct
+{
+  volatile uint32_t CTRL;
+  volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+  volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type       hostDwt;
+extern CoreDebug_Type hostCoreDebug;
+#define DWT                          (&hostDwt)
+#define CoreDebug                    (&hostCoreDebug)
+#define DWT_CTRL_CYCCNTENA_Msk       1UL
+#define CoreDebug_DEMCR_TRCENA_Msk   (1UL << 24)
+
+#define platformGetSysTick()         ((uint32_t)(hostCycles / (SystemCoreClock / 1000U)))
+
+static inline uint32_t __get_PRIMASK(void)        { return 0; }
+static inline void     __set_PRIMASK(uint32_t m)  { (void)m; }
+static inline void     __disable_irq(void)        { }
+
+#endif /* RFAL_PLATFORM_H */
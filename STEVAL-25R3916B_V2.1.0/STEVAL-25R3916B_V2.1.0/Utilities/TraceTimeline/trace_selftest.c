@@ -0,0 +1,182 @@
+/**
+  ******************************************************************************
+  * @file    trace_selftest.c
+  * @author  MMY Application Team
+  * @brief   Runs the RF trace of timer.c over simulated time and checks the decoded timeline
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "timer.h"
+#include "rfal_platform.h"
+#include "tracedec.h"
+
+uint64_t       hostCycles;
+uint32_t       SystemCoreClock = 80000000U;
+DWT_Type       hostDwt;
+CoreDebug_Type hostCoreDebug;
+
+#define MAX_EV     (4U * TIMER_TRACE_LEN)
+
+/* What was recorded: true time of the events that made it into the ring */
+static uint64_t trueCycles[1U << 20];
+static uint8_t  trueEvt[1U << 20];
+static uint32_t trueVal[1U << 20];
+static long     nTrue;
+
+static void advance(uint64_t cycles)
+{
+  hostCycles    += cycles;
+  hostDwt.CYCCNT = (uint32_t)hostCycles;
+}
+
+static void record(uint8_t evt, uint32_t val, uint16_t *pending)
+{
+  timerTraceRecord(evt, val);
+  /* The ring is only read by drain(): count what was stored */
+  if( *pending < TIMER_TRACE_LEN )
+  {
+    trueCycles[nTrue] = hostCycles;
+    trueEvt[nTrue]    = evt;
+    trueVal[nTrue]    = val;
+    nTrue++;
+    (*pending)++;
+  }
+}
+
+/* Time reference of the check: the clear, then the last saturated entry */
+static uint64_t refCycles;
+static uint64_t refUs;
+static int      fail;
+static FILE    *out;   /* Optional copy of the responses, for trace_timeline */
+
+static void drain(traceState *st, long *checked, long *sat)
+{
+  static uint8_t    rsp[4 + (MAX_EV * TIMER_TRACE_ENTRY_LEN)];
+  static traceEvent ev[MAX_EV];
+  static long       next;
+  uint16_t          lost;
+  uint16_t          count;
+  int               n;
+  int               i;
+
+  count  = timerTraceRead(&rsp[4], (uint16_t)(sizeof(rsp) - 4U), &lost);
+  rsp[0] = (uint8_t)count;
+  rsp[1] = (uint8_t)(count >> 8);
+  rsp[2] = (uint8_t)lost;
+  rsp[3] = (uint8_t)(lost >> 8);
+  if( out != NULL )
+  {
+    fwrite(rsp, 1, 4U + (count * TIMER_TRACE_ENTRY_LEN), out);
+  }
+  n = traceDecodeResponse(st, rsp, 4U + (count * TIMER_TRACE_ENTRY_LEN), ev, MAX_EV, &lost);
+  for( i = 0; i < n; i++, next++ )
+  {
+    uint64_t trueUs;
+
+    if( ev[i].saturated != 0 )
+    {
+      /* Gap of 16 s or more: the time is exact again from this entry on */
+      refCycles = trueCycles[next];
+      refUs     = ev[i].us;
+      (*sat)++;
+    }
+    trueUs = (trueCycles[next] - refCycles) / (SystemCoreClock / 1000000U);
+    if( (ev[i].evt != trueEvt[next]) || (ev[i].val != trueVal[next]) || ((ev[i].us - refUs) != trueUs) )
+    {
+      if( fail < 5 )
+      {
+        printf("FAIL event %ld: decoded %llu us, true %llu us\n", next,
+               (unsigned long long)(ev[i].us - refUs), (unsigned long long)trueUs);
+      }
+      fail++;
+    }
+    (*checked)++;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  traceState st = { 0, 0 };
+  uint64_t   base;
+  long       checked = 0;
+  long       sat = 0;
+  long       drops = 0;
+  uint16_t   pending = 0;
+  int        burst;
+  unsigned   seed = (argc > 1) ? (unsigned)atoi(argv[1]) : 1U;
+
+  if( argc > 2 )
+  {
+    out = fopen(argv[2], "wb");
+  }
+  srand(seed);
+  /* The cycle counter runs already (logger) and must not be reset by the trace */
+  advance(0xF0000000ULL);
+  timerTraceClear();
+  base      = hostCycles;
+  refCycles = base;
+  if( (uint32_t)hostCycles != hostDwt.CYCCNT )
+  {
+    fail++;
+  }
+
+  for( burst = 0; burst < 2000; burst++ )
+  {
+    int e;
+    int n = 1 + (rand() % 600);   /* Long bursts overflow the ring: events dropped */
+
+    for( e = 0; e < n; e++ )
+    {
+      uint16_t before = pending;
+      static const uint8_t states[] = { 0, 1, 2, 11, 14, 15, 18, 19, 81, 82, 83, 84, 85, 87, 89 };
+      uint8_t  evt = (uint8_t)(1 + (rand() % 5));
+      uint32_t val = 0;
+
+      switch( evt )
+      {
+        case 1:  val = states[rand() % (int)sizeof(states)];  break;
+        case 2:  val = 1UL << (rand() % 32);                   break;
+        case 5:  val = (uint32_t)(rand() % 512);               break;
+        default:                                               break;
+      }
+      record(evt, val, &pending);
+      drops += (pending == before) ? 1 : 0;
+      advance(1U + ((uint64_t)rand() % 4000U));
+    }
+    drain(&st, &checked, &sat);
+    pending = 0;
+
+    /* Idle between exchanges: ms to seconds, sometimes minutes (past the CYCCNT wrap) */
+    switch( rand() % 8 )
+    {
+      case 0:  advance((uint64_t)SystemCoreClock * (20U + (rand() % 100U)));    break;
+      case 1:  advance((uint64_t)SystemCoreClock * (1U + (rand() % 15U)));      break;
+      default: advance((uint64_t)(SystemCoreClock / 1000U) * (rand() % 500U));  break;
+    }
+  }
+
+  printf("%ld events checked over %.0f s (%ld CYCCNT wraps), %ld dropped, %ld saturated gaps, %d failure(s)\n",
+         checked, (double)(hostCycles - base) / SystemCoreClock, (long)((hostCycles >> 32) - (base >> 32)),
+         drops, sat, fail);
+  if( out != NULL )
+  {
+    fclose(out);
+  }
+  printf("%s\n", (fail == 0) ? "PASS" : "FAIL");
+  return (fail == 0) ? 0 : 1;
+}
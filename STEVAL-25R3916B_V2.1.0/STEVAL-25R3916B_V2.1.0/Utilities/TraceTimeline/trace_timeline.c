@@ -0,0 +1,165 @@
+/**
+  ******************************************************************************
+  * @file    trace_timeline.c
+  * @author  MMY Application Team
+  * @brief   Prints or exports (VCD) the RF trace read with RFAL_CMD_GET_TRACE
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tracedec.h"
+
+#define MAX_EVENTS   4096
+
+static void vcdHeader(FILE *f)
+{
+  fprintf(f, "$timescale 1us $end\n$scope module st25r3916 $end\n");
+  fprintf(f, "$var wire 1 c com $end\n$var wire 8 s txrx_state $end\n");
+  fprintf(f, "$var wire 32 i irq $end\n$var wire 16 r fifo_read $end\n");
+  fprintf(f, "$upscope $end\n$enddefinitions $end\n#0\n0c\nb0 s\nb0 i\nb0 r\n");
+}
+
+static void vcdBits(FILE *f, uint32_t v, char id)
+{
+  char b[33];
+  int  n = 0;
+  int  i;
+
+  for( i = 31; i > 0; i-- )
+  {
+    if( (v >> i) != 0U )
+    {
+      break;
+    }
+  }
+  for( ; i >= 0; i-- )
+  {
+    b[n++] = (char)('0' + ((v >> i) & 1U));
+  }
+  b[n] = '\0';
+  fprintf(f, "b%s %c\n", b, id);
+}
+
+int main(int argc, char **argv)
+{
+  static traceEvent ev[MAX_EVENTS];
+  static uint8_t    rsp[4 + (MAX_EVENTS * TRACEDEC_ENTRY_LEN)];
+  traceState        st = { 0, 0 };
+  FILE             *in;
+  FILE             *vcd = NULL;
+  uint64_t          comStart = 0;
+  uint64_t          stateStart = 0;
+  uint32_t          state = 0;
+  long              total = 0;
+
+  if( (argc != 2) && !((argc == 4) && (strcmp(argv[2], "-vcd") == 0)) )
+  {
+    fprintf(stderr, "usage: trace_timeline trace.bin [-vcd out.vcd]\n");
+    return 2;
+  }
+  in = fopen(argv[1], "rb");
+  if( in == NULL )
+  {
+    fprintf(stderr, "%s: cannot read\n", argv[1]);
+    return 1;
+  }
+  if( argc == 4 )
+  {
+    vcd = fopen(argv[3], "w");
+    if( vcd == NULL )
+    {
+      fprintf(stderr, "%s: cannot write\n", argv[3]);
+      return 1;
+    }
+    vcdHeader(vcd);
+  }
+
+  /* The file holds the RFAL_CMD_GET_TRACE response payloads, one after the other */
+  while( fread(rsp, 1, TRACEDEC_HDR_LEN, in) == TRACEDEC_HDR_LEN )
+  {
+    uint16_t count = (uint16_t)(rsp[0] | (rsp[1] << 8));
+    uint16_t lost;
+    int      n;
+    int      i;
+
+    if( (count > MAX_EVENTS) || (fread(&rsp[TRACEDEC_HDR_LEN], TRACEDEC_ENTRY_LEN, count, in) != count) )
+    {
+      fprintf(stderr, "truncated or malformed response\n");
+      break;
+    }
+    n = traceDecodeResponse(&st, rsp, TRACEDEC_HDR_LEN + ((size_t)count * TRACEDEC_ENTRY_LEN), ev, MAX_EVENTS, &lost);
+    for( i = 0; i < n; i++ )
+    {
+      char txt[128];
+
+      txt[0] = '\0';
+      switch( ev[i].evt )
+      {
+        case TRACEDEC_TXRX_STATE:
+          snprintf(txt, sizeof(txt), "%-14s (%s lasted %llu us)", traceTxRxStateName(ev[i].val),
+                   traceTxRxStateName(state), (unsigned long long)(ev[i].us - stateStart));
+          state      = ev[i].val;
+          stateStart = ev[i].us;
+          break;
+        case TRACEDEC_IRQ:
+          traceIrqNames(ev[i].val, txt, sizeof(txt));
+          break;
+        case TRACEDEC_COM_START:
+          comStart = ev[i].us;
+          break;
+        case TRACEDEC_COM_STOP:
+          snprintf(txt, sizeof(txt), "%llu us", (unsigned long long)(ev[i].us - comStart));
+          break;
+        case TRACEDEC_FIFO_READ:
+          snprintf(txt, sizeof(txt), "%u byte(s)", (unsigned)ev[i].val);
+          break;
+        default:
+          snprintf(txt, sizeof(txt), "0x%08X", (unsigned)ev[i].val);
+          break;
+      }
+      printf("%14llu%s %-5s %s\n", (unsigned long long)ev[i].us, (ev[i].saturated != 0) ? "+" : " ",
+             traceEventName(ev[i].evt), txt);
+
+      if( vcd != NULL )
+      {
+        fprintf(vcd, "#%llu\n", (unsigned long long)ev[i].us);
+        switch( ev[i].evt )
+        {
+          case TRACEDEC_TXRX_STATE: vcdBits(vcd, ev[i].val, 's'); break;
+          case TRACEDEC_IRQ:        vcdBits(vcd, ev[i].val, 'i'); break;
+          case TRACEDEC_COM_START:  fprintf(vcd, "1c\n");         break;
+          case TRACEDEC_COM_STOP:   fprintf(vcd, "0c\n");         break;
+          case TRACEDEC_FIFO_READ:  vcdBits(vcd, ev[i].val, 'r'); break;
+          default:                                                break;
+        }
+      }
+    }
+    /* The ring was full: events after these ones were dropped */
+    if( lost != 0U )
+    {
+      printf("              --- %u event(s) lost, timing stays exact ---\n", (unsigned)lost);
+    }
+    total += n;
+  }
+  fprintf(stderr, "%ld event(s), %u lost, %llu us\n", total, (unsigned)st.lost, (unsigned long long)st.us);
+  fclose(in);
+  if( vcd != NULL )
+  {
+    fclose(vcd);
+  }
+  return 0;
+}
@@ -0,0 +1,127 @@
+/**
+  ******************************************************************************
+  * @file    tracedec.c
+  * @author  MMY Application Team
+  * @brief   Host decoder of the RF trace read with RFAL_CMD_GET_TRACE (0x71)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <string.h>
+#include "tracedec.h"
+
+static uint32_t rd32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+int traceDecodeResponse(traceState *st, const uint8_t *rsp, size_t len, traceEvent *ev, int max, uint16_t *lost)
+{
+  uint16_t count;
+  int      i;
+
+  if( len < TRACEDEC_HDR_LEN )
+  {
+    return -1;
+  }
+  count = (uint16_t)(rsp[0] | (rsp[1] << 8));
+  *lost = (uint16_t)(rsp[2] | (rsp[3] << 8));
+  if( (len < (TRACEDEC_HDR_LEN + ((size_t)count * TRACEDEC_ENTRY_LEN))) || (count > max) )
+  {
+    return -1;
+  }
+  st->lost += *lost;
+
+  for( i = 0; i < count; i++ )
+  {
+    const uint8_t *e     = &rsp[TRACEDEC_HDR_LEN + ((size_t)i * TRACEDEC_ENTRY_LEN)];
+    uint32_t       delta = rd32(e) & TRACEDEC_DELTA_SAT;
+
+    /* Dropped events don't break the sum: the target measures from the last stored entry */
+    st->us          += delta;
+    ev[i].us        = st->us;
+    ev[i].saturated = (delta == TRACEDEC_DELTA_SAT) ? 1 : 0;
+    ev[i].evt       = e[3];
+    ev[i].val       = rd32(&e[4]);
+  }
+  return count;
+}
+
+const char *traceEventName(uint8_t evt)
+{
+  switch( evt )
+  {
+    case TRACEDEC_TXRX_STATE: return "TXRX";
+    case TRACEDEC_IRQ:        return "IRQ";
+    case TRACEDEC_COM_START:  return "COM+";
+    case TRACEDEC_COM_STOP:   return "COM-";
+    case TRACEDEC_FIFO_READ:  return "FIFO";
+    default:                  return "?";
+  }
+}
+
+/* rfalTransceiveState, see rfal_rf.h */
+const char *traceTxRxStateName(uint32_t state)
+{
+  static const struct { uint32_t v; const char *n; } names[] =
+  {
+    {  0, "IDLE" },           {  1, "INIT" },           {  2, "START" },
+    { 11, "TX_IDLE" },        { 12, "TX_WAIT_GT" },     { 13, "TX_WAIT_FDT" },
+    { 14, "TX_PREP_TX" },     { 15, "TX_TRANSMIT" },    { 16, "TX_WAIT_WL" },
+    { 17, "TX_RELOAD_FIFO" }, { 18, "TX_WAIT_TXE" },    { 19, "TX_DONE" },
+    { 20, "TX_FAIL" },        { 81, "RX_IDLE" },        { 82, "RX_WAIT_EON" },
+    { 83, "RX_WAIT_RXS" },    { 84, "RX_WAIT_RXE" },    { 85, "RX_READ_FIFO" },
+    { 86, "RX_ERR_CHECK" },   { 87, "RX_READ_DATA" },   { 88, "RX_WAIT_EOF" },
+    { 89, "RX_DONE" },        { 90, "RX_FAIL" },
+  };
+  size_t i;
+
+  for( i = 0; i < (sizeof(names) / sizeof(names[0])); i++ )
+  {
+    if( names[i].v == state )
+    {
+      return names[i].n;
+    }
+  }
+  return "?";
+}
+
+/* ST25R3916 interrupt status, see ST25R3916_IRQ_MASK_xxx in st25r3916_irq.h */
+void traceIrqNames(uint32_t irq, char *buf, size_t size)
+{
+  static const char *names[32] =
+  {
+    "RFU", "RX_REST", "COL", "TXE", "RXE", "RXS", "FWL", "OSC",
+    "NFCT", "CAT", "CAC", "EOF", "EON", "GPE", "NRE", "DCT",
+    "WCAP", "WPH", "WAM", "WT", "ERR1", "ERR2", "PAR", "CRC",
+    "WU_A", "WU_A_X", "RFU2", "WU_F", "RXE_PTA", "APON", "SL_WL", "PPON2"
+  };
+  size_t len = 0;
+  int    i;
+
+  buf[0] = '\0';
+  for( i = 0; i < 32; i++ )
+  {
+    if( (irq & (1UL << i)) != 0U )
+    {
+      int n = snprintf(&buf[len], size - len, "%s%s", (len != 0U) ? "|" : "", names[i]);
+      if( (n < 0) || ((size_t)n >= (size - len)) )
+      {
+        break;
+      }
+      len += (size_t)n;
+    }
+  }
+}
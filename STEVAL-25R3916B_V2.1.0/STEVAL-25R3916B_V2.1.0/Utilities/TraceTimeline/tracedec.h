@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    tracedec.h
+  * @author  MMY Application Team
+  * @brief   Host decoder of the RF trace read with RFAL_CMD_GET_TRACE (0x71)
+  ******************************************************************************
+  * @attention
+  *
+  * COPYRIGHT 2021 STMicroelectronics, all rights reserved
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+#ifndef TRACEDEC_H
+#define TRACEDEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Entry layout, see timerTraceRead() in timer.h */
+#define TRACEDEC_ENTRY_LEN      8U
+#define TRACEDEC_HDR_LEN        4U       /* count (2), lost (2) */
+#define TRACEDEC_DELTA_SAT      0x00FFFFFFU
+
+/* Events, see ST25R3916_TRACE_xxx in st25r3916_com.h */
+#define TRACEDEC_TXRX_STATE     0x01U
+#define TRACEDEC_IRQ            0x02U
+#define TRACEDEC_COM_START      0x03U
+#define TRACEDEC_COM_STOP       0x04U
+#define TRACEDEC_FIFO_READ      0x05U
+
+typedef struct
+{
+  uint64_t  us;         /* Time since the first clear, exact unless saturated */
+  int       saturated;  /* Time since the previous entry was 16 s or more     */
+  uint8_t   evt;
+  uint32_t  val;
+} traceEvent;
+
+typedef struct
+{
+  uint64_t  us;
+  uint32_t  lost;
+} traceState;
+
+/* Decodes one RFAL_CMD_GET_TRACE response payload into ev (up to max entries).
+   Returns the number of entries, -1 if the payload is malformed. lost is set to the
+   events dropped on the target before these entries. */
+int traceDecodeResponse(traceState *st, const uint8_t *rsp, size_t len, traceEvent *ev, int max, uint16_t *lost);
+
+const char *traceEventName(uint8_t evt);
+const char *traceTxRxStateName(uint32_t state);
+void        traceIrqNames(uint32_t irq, char *buf, size_t size);
+
+#endif /* TRACEDEC_H */